@@ -0,0 +1,642 @@
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/prctl.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "agent.h"
+#include "bcrypt/explicit_bzero.h"
+#include "histogram.h"
+#include "lanes.h"
+#include "nosepass.h"
+#include "secure.h"
+
+#define REQUEST_SIZE 1100
+#define RESPONSE_SIZE (AGENT_OUTPUT_SIZE + 64)
+#define REQUEST_TIMEOUT 5
+
+#define HISTOGRAMS_SUFFIX ".histograms"
+
+#define REQUEST_DERIVE "derive "
+#define RESPONSE_OK "ok "
+#define RESPONSE_ERROR "error "
+
+struct cache_entry {
+	uint8_t key[AGENT_KEY_SIZE];
+	unsigned int rounds;
+	unsigned int lanes;
+
+	/* whether the key is a group’s, named by `name`, rather than a site’s */
+	int group;
+
+	/* 0 for an unused entry */
+	size_t name_length;
+	char name[AGENT_CACHE_NAME_SIZE];
+};
+
+/*
+ * Everything secret the agent holds, in one slot of a secure arena.
+ */
+struct agent_memory {
+	char password[AGENT_PASSWORD_SIZE];
+	size_t password_length;
+	char output[AGENT_OUTPUT_SIZE];
+	char response[RESPONSE_SIZE];
+	struct cache_entry cache[AGENT_CACHE_ENTRIES];
+};
+
+struct agent {
+	struct agent_options options;
+	struct secure_arena* arena;
+	struct agent_memory* memory;
+
+	/* latencies since the agent started, and where SIGUSR1 saves them */
+	struct histograms* histograms;
+	char* histograms_path;
+};
+
+static volatile sig_atomic_t interrupted = 0;
+static volatile sig_atomic_t histograms_requested = 0;
+
+static void interrupt(int const signal_number) {
+	(void)signal_number;
+	interrupted = 1;
+}
+
+static void request_histograms(int const signal_number) {
+	(void)signal_number;
+	histograms_requested = 1;
+}
+
+__attribute__ ((warn_unused_result))
+static time_t now(void) {
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return t.tv_sec;
+}
+
+__attribute__ ((warn_unused_result))
+static uint64_t now_ns(void) {
+	struct timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return (uint64_t)t.tv_sec * UINT64_C(1000000000) + (uint64_t)t.tv_nsec;
+}
+
+__attribute__ ((nonnull, pure, warn_unused_result))
+static size_t get_cache_slot(char const* const name, size_t const name_length) {
+	/* FNV-1a */
+	uint32_t hash = 2166136261u;
+
+	for (size_t i = 0; i < name_length; i++) {
+		hash = (hash ^ (uint8_t)name[i]) * 16777619u;
+	}
+
+	return hash % AGENT_CACHE_ENTRIES;
+}
+
+__attribute__ ((nonnull))
+static void agent_destroy_histograms(struct agent* const agent) {
+	if (agent->histograms != NULL) {
+		histograms_destroy(agent->histograms);
+	}
+
+	free(agent->histograms_path);
+}
+
+struct agent* agent_create(struct agent_options const* const options) {
+	struct agent* const agent = malloc(sizeof *agent);
+
+	if (agent == NULL) {
+		fputs("failed to allocate memory\n", stderr);
+		return NULL;
+	}
+
+	agent->options = *options;
+
+	size_t const socket_path_length = strlen(options->socket_path);
+	agent->histograms = histograms_create();
+	agent->histograms_path = malloc(socket_path_length + sizeof HISTOGRAMS_SUFFIX);
+
+	if (agent->histograms == NULL || agent->histograms_path == NULL) {
+		if (agent->histograms_path == NULL) {
+			fputs("failed to allocate memory\n", stderr);
+		}
+
+		agent_destroy_histograms(agent);
+		free(agent);
+		return NULL;
+	}
+
+	memcpy(agent->histograms_path, options->socket_path, socket_path_length);
+	memcpy(agent->histograms_path + socket_path_length, HISTOGRAMS_SUFFIX, sizeof HISTOGRAMS_SUFFIX);
+
+	if ((agent->arena = secure_arena_create(sizeof *agent->memory, 1)) == NULL) {
+		agent_destroy_histograms(agent);
+		free(agent);
+		return NULL;
+	}
+
+	/* the arena’s only slot, which can’t be taken already */
+	agent->memory = secure_alloc(agent->arena);
+
+	if (prctl(PR_SET_DUMPABLE, 0, 0, 0, 0) != 0) {
+		perror("failed to exclude agent memory from core dumps");
+		secure_arena_destroy(agent->arena);
+		agent_destroy_histograms(agent);
+		free(agent);
+		return NULL;
+	}
+
+	return agent;
+}
+
+char* agent_password(struct agent* const agent) {
+	return agent->memory->password;
+}
+
+void agent_set_password_length(struct agent* const agent, size_t const password_length) {
+	agent->memory->password_length = password_length;
+}
+
+int agent_get_key(struct agent* const agent, char const* const site_name, struct nosepass_schema const* const schema, uint8_t key[const AGENT_KEY_SIZE]) {
+	struct agent_memory* const memory = agent->memory;
+	size_t const site_name_length = strlen(site_name);
+	unsigned int const rounds = schema->rounds;
+	int const group = schema->group_length != 0;
+
+	/* a site in a group caches its group’s key, which every other site in it can be expanded from */
+	char const* const name = group ? schema->group : site_name;
+	size_t const name_length = group ? schema->group_length : site_name_length;
+	struct cache_entry* entry = NULL;
+	int cached = 0;
+
+	if (agent->options.cache_keys && name_length < AGENT_CACHE_NAME_SIZE) {
+		entry = &memory->cache[get_cache_slot(name, name_length)];
+		cached = entry->name_length == name_length && entry->rounds == rounds && entry->lanes == schema->lanes && entry->group == group && memcmp(entry->name, name, name_length) == 0;
+	}
+
+	if (cached) {
+		memcpy(key, entry->key, AGENT_KEY_SIZE);
+	} else {
+		uint64_t const start = now_ns();
+		enum nosepass_status status;
+
+		/* a key of several lanes runs them at once, so it takes about as long as one */
+		if (schema->lanes > 1) {
+			status = lanes_derive_key(memory->password, memory->password_length, site_name, site_name_length, schema, NULL, key);
+		} else if (group) {
+			status = nosepass_derive_group_key(memory->password, memory->password_length, name, name_length, rounds, key);
+		} else {
+			status = nosepass_derive_key(memory->password, memory->password_length, name, name_length, rounds, key);
+		}
+
+		if (status != NOSEPASS_OK) {
+			fprintf(stderr, "%s\n", nosepass_strerror(status));
+			return 0;
+		}
+
+		histograms_record(agent->histograms, rounds, HISTOGRAM_KDF, now_ns() - start);
+
+		if (entry != NULL) {
+			memcpy(entry->key, key, AGENT_KEY_SIZE);
+			memcpy(entry->name, name, name_length);
+			entry->name_length = name_length;
+			entry->rounds = rounds;
+			entry->lanes = schema->lanes;
+			entry->group = group;
+		}
+	}
+
+	if (group) {
+		enum nosepass_status const status = nosepass_expand_key(key, site_name, site_name_length, key);
+
+		if (status != NOSEPASS_OK) {
+			fprintf(stderr, "%s\n", nosepass_strerror(status));
+			return 0;
+		}
+	}
+
+	return 1;
+}
+
+__attribute__ ((nonnull, warn_unused_result))
+static int send_all(int const fd, char const* data, size_t length) {
+	while (length > 0) {
+		ssize_t const sent = send(fd, data, length, MSG_NOSIGNAL);
+
+		if (sent < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+
+			return 0;
+		}
+
+		data += sent;
+		length -= (size_t)sent;
+	}
+
+	return 1;
+}
+
+/*
+ * Reads a line, without its line ending, into a buffer. Returns the line’s length, or -1 on failure.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static ssize_t receive_line(int const fd, char* const buffer, size_t const size) {
+	size_t length = 0;
+
+	while (length < size) {
+		ssize_t const received = recv(fd, buffer + length, size - length, 0);
+
+		if (received < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+
+			return -1;
+		}
+
+		if (received == 0) {
+			return -1;
+		}
+
+		char* const newline = memchr(buffer + length, '\n', (size_t)received);
+
+		if (newline != NULL) {
+			*newline = '\0';
+			return newline - buffer;
+		}
+
+		length += (size_t)received;
+	}
+
+	return -1;
+}
+
+__attribute__ ((nonnull))
+static void respond_error(int const fd, char const* const message) {
+	char response[256];
+	int const length = snprintf(response, sizeof response, RESPONSE_ERROR "%s\n", message);
+
+	if (length > 0 && (size_t)length < sizeof response && !send_all(fd, response, (size_t)length)) {
+		perror("failed to send agent response");
+	}
+}
+
+/*
+ * Answers a connection’s request, recording its latency from `start`, when it was accepted.
+ */
+__attribute__ ((nonnull))
+static void handle_connection(struct agent* const agent, int const client, agent_handler* const handler, uint64_t const start) {
+	struct timeval const timeout = { .tv_sec = REQUEST_TIMEOUT, .tv_usec = 0 };
+	setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof timeout);
+	setsockopt(client, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof timeout);
+
+	char request[REQUEST_SIZE];
+	ssize_t const request_length = receive_line(client, request, sizeof request);
+
+	if (request_length < 0) {
+		return;
+	}
+
+	if (strncmp(request, REQUEST_DERIVE, sizeof REQUEST_DERIVE - 1) != 0 || request_length == sizeof REQUEST_DERIVE - 1) {
+		respond_error(client, "unrecognized request");
+		return;
+	}
+
+	struct agent_memory* const memory = agent->memory;
+	double bits;
+	unsigned int rounds;
+	size_t const output_length = handler(agent, request + (sizeof REQUEST_DERIVE - 1), memory->output, &bits, &rounds);
+
+	if (output_length == 0) {
+		respond_error(client, "failed to derive password; see the agent’s output for details");
+		return;
+	}
+
+	int const response_length = snprintf(memory->response, sizeof memory->response, RESPONSE_OK "%.3f %.*s\n", bits, (int)output_length, memory->output);
+	explicit_bzero(memory->output, sizeof memory->output);
+
+	if (response_length > 0 && (size_t)response_length < sizeof memory->response && !send_all(client, memory->response, (size_t)response_length)) {
+		perror("failed to send agent response");
+	} else {
+		histograms_record(agent->histograms, rounds, HISTOGRAM_REQUEST, now_ns() - start);
+	}
+
+	explicit_bzero(memory->response, sizeof memory->response);
+}
+
+/*
+ * Prints the latency histograms and saves a snapshot of them.
+ */
+__attribute__ ((nonnull))
+static void show_histograms(struct agent const* const agent) {
+	histograms_print(agent->histograms, stderr);
+
+	if (histograms_save(agent->histograms, agent->histograms_path)) {
+		fprintf(stderr, "histograms saved to %s\n", agent->histograms_path);
+	}
+}
+
+/*
+ * Refuses to put the socket in a directory that other users could replace it in.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int check_socket_directory(char const* const socket_path) {
+	char const* const last_slash = strrchr(socket_path, '/');
+	char directory[sizeof ((struct sockaddr_un*)NULL)->sun_path];
+
+	if (last_slash == NULL) {
+		strcpy(directory, ".");
+	} else if (last_slash == socket_path) {
+		strcpy(directory, "/");
+	} else {
+		size_t const directory_length = (size_t)(last_slash - socket_path);
+		memcpy(directory, socket_path, directory_length);
+		directory[directory_length] = '\0';
+	}
+
+	struct stat directory_stat;
+
+	if (stat(directory, &directory_stat) != 0) {
+		fprintf(stderr, "failed to check agent socket directory %s: %s\n", directory, strerror(errno));
+		return 0;
+	}
+
+	if (directory_stat.st_uid != getuid() || (directory_stat.st_mode & (S_IWGRP | S_IWOTH)) != 0) {
+		fprintf(stderr, "agent socket directory %s must be owned by the current user and not writable by others\n", directory);
+		return 0;
+	}
+
+	return 1;
+}
+
+__attribute__ ((nonnull, warn_unused_result))
+static int set_socket_address(struct sockaddr_un* const address, char const* const socket_path) {
+	size_t const path_length = strlen(socket_path);
+
+	if (path_length >= sizeof address->sun_path) {
+		fprintf(stderr, "agent socket path is too long; limit is %zu characters\n", sizeof address->sun_path - 1);
+		return 0;
+	}
+
+	memset(address, 0, sizeof *address);
+	address->sun_family = AF_UNIX;
+	memcpy(address->sun_path, socket_path, path_length + 1);
+	return 1;
+}
+
+/*
+ * Removes a socket left behind by an agent that isn’t running anymore.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int remove_stale_socket(struct sockaddr_un const* const address) {
+	struct stat socket_stat;
+
+	if (lstat(address->sun_path, &socket_stat) != 0) {
+		return errno == ENOENT;
+	}
+
+	if (!S_ISSOCK(socket_stat.st_mode) || socket_stat.st_uid != getuid()) {
+		fprintf(stderr, "%s exists and isn’t an agent socket\n", address->sun_path);
+		return 0;
+	}
+
+	int const probe = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+
+	if (probe >= 0 && connect(probe, (struct sockaddr const*)address, sizeof *address) == 0) {
+		close(probe);
+		fprintf(stderr, "an agent is already listening at %s\n", address->sun_path);
+		return 0;
+	}
+
+	if (probe >= 0) {
+		close(probe);
+	}
+
+	if (unlink(address->sun_path) != 0) {
+		perror("failed to remove stale agent socket");
+		return 0;
+	}
+
+	return 1;
+}
+
+__attribute__ ((nonnull, warn_unused_result))
+static int open_listener(char const* const socket_path) {
+	struct sockaddr_un address;
+
+	if (!set_socket_address(&address, socket_path) || !check_socket_directory(socket_path) || !remove_stale_socket(&address)) {
+		return -1;
+	}
+
+	int const listener = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+
+	if (listener < 0) {
+		perror("failed to create agent socket");
+		return -1;
+	}
+
+	mode_t const original_umask = umask(S_IRWXG | S_IRWXO);
+	int const bound = bind(listener, (struct sockaddr const*)&address, sizeof address);
+	umask(original_umask);
+
+	if (bound != 0) {
+		perror("failed to bind agent socket");
+		close(listener);
+		return -1;
+	}
+
+	if (listen(listener, SOMAXCONN) != 0) {
+		perror("failed to listen on agent socket");
+		close(listener);
+		unlink(socket_path);
+		return -1;
+	}
+
+	return listener;
+}
+
+int agent_serve(struct agent* const agent, agent_handler* const handler) {
+	int const listener = open_listener(agent->options.socket_path);
+
+	if (listener < 0) {
+		return 0;
+	}
+
+	struct sigaction action;
+	memset(&action, 0, sizeof action);
+	action.sa_handler = interrupt;
+	sigemptyset(&action.sa_mask);
+	sigaction(SIGINT, &action, NULL);
+	sigaction(SIGTERM, &action, NULL);
+	sigaction(SIGHUP, &action, NULL);
+
+	action.sa_handler = request_histograms;
+	sigaction(SIGUSR1, &action, NULL);
+
+	printf(AGENT_SOCKET_VARIABLE "=%s; export " AGENT_SOCKET_VARIABLE ";\n", agent->options.socket_path);
+	fflush(stdout);
+
+	unsigned int const timeout = agent->options.timeout;
+	time_t deadline = now() + timeout;
+	int result = 1;
+
+	while (!interrupted) {
+		int timeout_ms = -1;
+
+		if (histograms_requested) {
+			histograms_requested = 0;
+			show_histograms(agent);
+		}
+
+		if (timeout != 0) {
+			time_t const remaining = deadline - now();
+
+			if (remaining <= 0) {
+				fputs("agent idle timeout reached\n", stderr);
+				break;
+			}
+
+			timeout_ms = remaining > INT32_MAX / 1000 ? INT32_MAX : (int)(remaining * 1000);
+		}
+
+		struct pollfd poll_listener = { .fd = listener, .events = POLLIN, .revents = 0 };
+		int const ready = poll(&poll_listener, 1, timeout_ms);
+
+		if (ready < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+
+			perror("failed to wait for agent requests");
+			result = 0;
+			break;
+		}
+
+		if (ready == 0) {
+			continue;
+		}
+
+		int const client = accept4(listener, NULL, NULL, SOCK_CLOEXEC);
+		uint64_t const accepted = now_ns();
+
+		if (client < 0) {
+			if (errno != EINTR && errno != ECONNABORTED) {
+				perror("failed to accept agent connection");
+			}
+
+			continue;
+		}
+
+		struct ucred credentials;
+		socklen_t credentials_size = sizeof credentials;
+
+		if (getsockopt(client, SOL_SOCKET, SO_PEERCRED, &credentials, &credentials_size) != 0 || credentials.uid != getuid()) {
+			fputs("rejected agent connection from another user\n", stderr);
+			close(client);
+			continue;
+		}
+
+		handle_connection(agent, client, handler, accepted);
+		close(client);
+		deadline = now() + timeout;
+	}
+
+	close(listener);
+	unlink(agent->options.socket_path);
+	return result;
+}
+
+void agent_destroy(struct agent* const agent) {
+	secure_arena_destroy(agent->arena);
+	agent_destroy_histograms(agent);
+	free(agent);
+}
+
+int agent_request(char const* const socket_path, char const* const site_name, char output[const AGENT_OUTPUT_SIZE], size_t* const output_length, double* const bits) {
+	struct sockaddr_un address;
+
+	if (!set_socket_address(&address, socket_path)) {
+		return 0;
+	}
+
+	if (strchr(site_name, '\n') != NULL || strlen(site_name) > REQUEST_SIZE - sizeof REQUEST_DERIVE) {
+		fputs("site name can’t be sent to the agent\n", stderr);
+		return 0;
+	}
+
+	struct stat socket_stat;
+
+	if (lstat(socket_path, &socket_stat) != 0 || !S_ISSOCK(socket_stat.st_mode) || socket_stat.st_uid != getuid()) {
+		fprintf(stderr, "%s isn’t an agent socket owned by the current user; unset " AGENT_SOCKET_VARIABLE " to enter the password instead\n", socket_path);
+		return 0;
+	}
+
+	int const fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+
+	if (fd < 0) {
+		perror("failed to create socket");
+		return 0;
+	}
+
+	if (connect(fd, (struct sockaddr const*)&address, sizeof address) != 0) {
+		fprintf(stderr, "failed to connect to agent at %s: %s\n", socket_path, strerror(errno));
+		close(fd);
+		return 0;
+	}
+
+	char request[REQUEST_SIZE];
+	int const request_length = snprintf(request, sizeof request, REQUEST_DERIVE "%s\n", site_name);
+
+	if (!send_all(fd, request, (size_t)request_length)) {
+		perror("failed to send agent request");
+		close(fd);
+		return 0;
+	}
+
+	char response[RESPONSE_SIZE];
+	ssize_t const response_length = receive_line(fd, response, sizeof response);
+	close(fd);
+
+	int result = 0;
+
+	if (response_length < 0) {
+		fputs("failed to read agent response\n", stderr);
+	} else if (strncmp(response, RESPONSE_ERROR, sizeof RESPONSE_ERROR - 1) == 0) {
+		fprintf(stderr, "agent: %s\n", response + (sizeof RESPONSE_ERROR - 1));
+	} else if (strncmp(response, RESPONSE_OK, sizeof RESPONSE_OK - 1) == 0) {
+		char* bits_end;
+		*bits = strtod(response + (sizeof RESPONSE_OK - 1), &bits_end);
+
+		if (*bits_end == ' ') {
+			size_t const length = (size_t)(response_length - (bits_end + 1 - response));
+
+			if (length > 0 && length <= AGENT_OUTPUT_SIZE) {
+				memcpy(output, bits_end + 1, length);
+				*output_length = length;
+				result = 1;
+			}
+		}
+
+		if (!result) {
+			fputs("malformed agent response\n", stderr);
+		}
+	} else {
+		fputs("malformed agent response\n", stderr);
+	}
+
+	explicit_bzero(response, sizeof response);
+	return result;
+}
@@ -0,0 +1,73 @@
+#include <stddef.h>
+#include <stdint.h>
+
+#include "nosepass.h"
+
+#define AGENT_SOCKET_VARIABLE "NOSEPASS_AGENT_SOCK"
+#define AGENT_SOCKET_NAME "/nosepass-agent.sock"
+
+#define AGENT_KEY_SIZE 32
+#define AGENT_PASSWORD_SIZE 1024
+#define AGENT_OUTPUT_SIZE 2048
+#define AGENT_CACHE_ENTRIES 256
+#define AGENT_CACHE_NAME_SIZE 256
+#define DEFAULT_AGENT_TIMEOUT 900
+
+struct agent;
+
+struct agent_options {
+	char const* socket_path;
+
+	/* seconds without a request before the agent exits, or 0 for no limit */
+	unsigned int timeout;
+
+	/* whether to keep derived site and group keys, so repeated requests, and other sites in a group, skip the KDF */
+	int cache_keys;
+};
+
+/*
+ * Answers a derivation request, writing the generated password to `output` (AGENT_OUTPUT_SIZE bytes), its strength to
+ * `bits`, and the rounds of its schema to `rounds`. Returns the password’s length, or 0 on failure.
+ */
+typedef size_t agent_handler(struct agent* agent, char const* site_name, char* output, double* bits, unsigned int* rounds);
+
+/*
+ * Allocates the agent’s memory, locked against swapping and excluded from core dumps.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+struct agent* agent_create(struct agent_options const* options);
+
+/*
+ * Gets the buffer of AGENT_PASSWORD_SIZE bytes that the master password should be read into, in the agent’s memory.
+ */
+__attribute__ ((nonnull, returns_nonnull, warn_unused_result))
+char* agent_password(struct agent* agent);
+
+__attribute__ ((nonnull))
+void agent_set_password_length(struct agent* agent, size_t password_length);
+
+/*
+ * Derives a site key from the master password as its schema says, or gets it, or its group’s key, from the cache.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+int agent_get_key(struct agent* agent, char const* site_name, struct nosepass_schema const* schema, uint8_t key[AGENT_KEY_SIZE]);
+
+/*
+ * Listens on the agent’s socket and answers requests until the idle timeout passes or the agent is interrupted. On
+ * SIGUSR1, prints latency percentiles for requests and key derivations, by rounds, to standard error, and saves a
+ * snapshot of the histograms next to the socket, as `<socket>.histograms`.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+int agent_serve(struct agent* agent, agent_handler* handler);
+
+/*
+ * Wipes and releases the agent’s memory.
+ */
+__attribute__ ((nonnull))
+void agent_destroy(struct agent* agent);
+
+/*
+ * Asks the agent listening at a socket for a site’s password.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+int agent_request(char const* socket_path, char const* site_name, char output[AGENT_OUTPUT_SIZE], size_t* output_length, double* bits);
@@ -0,0 +1,261 @@
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/random.h>
+#include <sys/stat.h>
+
+#include "audit.h"
+#include "bcrypt/explicit_bzero.h"
+#include "nosepass.h"
+
+/* the fewest slots a table has */
+#define MIN_CAPACITY 16
+
+struct audit_entry {
+	uint64_t digest;
+
+	/* NULL for an empty slot */
+	char const* site_name;
+	uint64_t increment;
+	size_t length;
+};
+
+/*
+ * The table, with its entries after it in the same mapping.
+ */
+struct audit_table {
+	size_t mapping_size;
+
+	/* the SipHash key of the table’s digests */
+	uint64_t key[2];
+
+	/* open addressing with linear probing, at most half full */
+	struct audit_entry* entries;
+	size_t mask;
+
+	size_t count;
+	size_t limit;
+
+	/* which password lengths the table holds, as a bitmap */
+	uint8_t lengths[NOSEPASS_MAX_COUNT / 8 + 1];
+};
+
+__attribute__ ((const, warn_unused_result))
+static uint64_t rotate(uint64_t const x, unsigned int const n) {
+	return x << n | x >> (64 - n);
+}
+
+__attribute__ ((nonnull))
+static void sip_round(uint64_t v[const 4]) {
+	v[0] += v[1];
+	v[1] = rotate(v[1], 13) ^ v[0];
+	v[0] = rotate(v[0], 32);
+	v[2] += v[3];
+	v[3] = rotate(v[3], 16) ^ v[2];
+	v[0] += v[3];
+	v[3] = rotate(v[3], 21) ^ v[0];
+	v[2] += v[1];
+	v[1] = rotate(v[1], 17) ^ v[2];
+	v[2] = rotate(v[2], 32);
+}
+
+/*
+ * SipHash-2-4 of a password under the table’s key, which is fast enough to run on every candidate. A digest can only
+ * be checked against a guess with the key, which is drawn for each table and wiped with it.
+ */
+__attribute__ ((nonnull, pure, warn_unused_result))
+static uint64_t digest_password(struct audit_table const* const table, char const* const password, size_t const length) {
+	uint64_t v[4] = {
+		table->key[0] ^ UINT64_C(0x736f6d6570736575),
+		table->key[1] ^ UINT64_C(0x646f72616e646f6d),
+		table->key[0] ^ UINT64_C(0x6c7967656e657261),
+		table->key[1] ^ UINT64_C(0x7465646279746573),
+	};
+	uint64_t last = (uint64_t)length << 56;
+	size_t i = 0;
+
+	for (; i + 8 <= length; i += 8) {
+		uint64_t m = 0;
+
+		for (unsigned int j = 0; j < 8; j++) {
+			m |= (uint64_t)(unsigned char)password[i + j] << (8 * j);
+		}
+
+		v[3] ^= m;
+		sip_round(v);
+		sip_round(v);
+		v[0] ^= m;
+	}
+
+	for (unsigned int j = 0; i + j < length; j++) {
+		last |= (uint64_t)(unsigned char)password[i + j] << (8 * j);
+	}
+
+	v[3] ^= last;
+	sip_round(v);
+	sip_round(v);
+	v[0] ^= last;
+	v[2] ^= 0xff;
+
+	for (unsigned int j = 0; j < 4; j++) {
+		sip_round(v);
+	}
+
+	return v[0] ^ v[1] ^ v[2] ^ v[3];
+}
+
+struct audit_table* audit_table_create(size_t const password_count) {
+	size_t capacity = MIN_CAPACITY;
+
+	while (capacity / 2 < password_count && capacity <= (SIZE_MAX - sizeof(struct audit_table)) / 2 / sizeof(struct audit_entry)) {
+		capacity *= 2;
+	}
+
+	if (capacity / 2 < password_count) {
+		fputs("too many passwords to audit\n", stderr);
+		return NULL;
+	}
+
+	size_t const mapping_size = sizeof(struct audit_table) + capacity * sizeof(struct audit_entry);
+	void* const mapping = mmap(NULL, mapping_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+	if (mapping == MAP_FAILED) {
+		perror("failed to map audit table");
+		return NULL;
+	}
+
+	/* the key is kept out of core dumps, and with it, whatever the digests say */
+	if (madvise(mapping, mapping_size, MADV_DONTDUMP) != 0) {
+		perror("failed to exclude audit table from core dumps");
+		munmap(mapping, mapping_size);
+		return NULL;
+	}
+
+	/* zeroed, so every entry starts empty */
+	struct audit_table* const table = mapping;
+	table->mapping_size = mapping_size;
+
+	if (getrandom(table->key, sizeof table->key, 0) != (ssize_t)sizeof table->key) {
+		perror("failed to generate audit key");
+		munmap(mapping, mapping_size);
+		return NULL;
+	}
+
+	table->entries = (struct audit_entry*)(table + 1);
+	table->mask = capacity - 1;
+	table->count = 0;
+	table->limit = password_count;
+	return table;
+}
+
+int audit_table_add(struct audit_table* const table, char const* const password, size_t const length, char const* const site_name, uint64_t const increment) {
+	if (table->count == table->limit || length > NOSEPASS_MAX_COUNT) {
+		fputs("audit table is full\n", stderr);
+		return 0;
+	}
+
+	uint64_t const digest = digest_password(table, password, length);
+	size_t i = (size_t)digest & table->mask;
+
+	while (table->entries[i].site_name != NULL) {
+		i = (i + 1) & table->mask;
+	}
+
+	table->entries[i] = (struct audit_entry){
+		.digest = digest,
+		.site_name = site_name,
+		.increment = increment,
+		.length = length,
+	};
+
+	table->count++;
+	table->lengths[length / 8] |= (uint8_t)(1u << length % 8);
+	return 1;
+}
+
+/*
+ * Passes every password in the table whose digest a candidate matches to the callback to confirm; normally none, or
+ * one.
+ */
+__attribute__ ((nonnull (1, 2, 4), warn_unused_result))
+static int check_candidate(struct audit_table const* const table, char const* const candidate, size_t const length, audit_match* const match, void* const context, size_t const line_number) {
+	if (length > NOSEPASS_MAX_COUNT || !(table->lengths[length / 8] & 1u << length % 8)) {
+		return 1;
+	}
+
+	uint64_t const digest = digest_password(table, candidate, length);
+
+	for (size_t i = (size_t)digest & table->mask; table->entries[i].site_name != NULL; i = (i + 1) & table->mask) {
+		struct audit_entry const* const entry = &table->entries[i];
+
+		if (entry->digest == digest && entry->length == length && !match(context, candidate, length, entry->site_name, entry->increment, line_number)) {
+			return 0;
+		}
+	}
+
+	return 1;
+}
+
+int audit_scan(struct audit_table const* const table, int const fd, audit_match* const match, void* const context, size_t* const line_count) {
+	struct stat status;
+
+	if (fstat(fd, &status) != 0) {
+		perror("failed to read candidate list");
+		return 0;
+	}
+
+	if (!S_ISREG(status.st_mode)) {
+		fputs("candidate list must be a regular file\n", stderr);
+		return 0;
+	}
+
+	*line_count = 0;
+
+	if (status.st_size == 0) {
+		return 1;
+	}
+
+	size_t const size = (size_t)status.st_size;
+	char* const data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+	if (data == MAP_FAILED) {
+		perror("failed to map candidate list");
+		return 0;
+	}
+
+	/* only advice, so a failure doesn’t matter */
+	madvise(data, size, MADV_SEQUENTIAL);
+
+	char const* const end = data + size;
+	size_t line_number = 0;
+
+	for (char const* line = data; line != end;) {
+		char const* const newline = memchr(line, '\n', (size_t)(end - line));
+		char const* const line_end = newline != NULL ? newline : end;
+		size_t length = (size_t)(line_end - line);
+
+		if (length != 0 && line[length - 1] == '\r') {
+			length--;
+		}
+
+		if (!check_candidate(table, line, length, match, context, ++line_number)) {
+			munmap(data, size);
+			return 0;
+		}
+
+		line = newline != NULL ? newline + 1 : end;
+	}
+
+	munmap(data, size);
+	*line_count = line_number;
+	return 1;
+}
+
+void audit_table_destroy(struct audit_table* const table) {
+	size_t const mapping_size = table->mapping_size;
+
+	explicit_bzero(table, mapping_size);
+	munmap(table, mapping_size);
+}
@@ -0,0 +1,41 @@
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * A set of derived passwords, each with the site and increment it belongs to, for checking a list of candidate
+ * passwords against. Only a keyed digest of each password is kept, under a key drawn at random for each table, so
+ * that the table can live in ordinary memory, excluded from core dumps, however many sites there are. A candidate
+ * whose digest matches is only a likely match, for the caller to confirm by regenerating the password.
+ */
+struct audit_table;
+
+/*
+ * Receives a candidate whose digest matched that of a password of a site, with its line number in the list, counting
+ * from 1. Returns 0 to stop the scan on an error.
+ */
+typedef int audit_match(void* context, char const* candidate, size_t length, char const* site_name, uint64_t increment, size_t line_number);
+
+/*
+ * Creates an empty table with room for `password_count` passwords.
+ */
+__attribute__ ((warn_unused_result))
+struct audit_table* audit_table_create(size_t password_count);
+
+/*
+ * Adds a password’s digest to the table, keeping a pointer to the site name, which must outlive it.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+int audit_table_add(struct audit_table* table, char const* password, size_t length, char const* site_name, uint64_t increment);
+
+/*
+ * Checks every line of a file of candidate passwords, one per line, against the table, counting the lines. The file
+ * is mapped rather than read, and a line only hashed if some password in the table has its length.
+ */
+__attribute__ ((nonnull (1, 3, 5), warn_unused_result))
+int audit_scan(struct audit_table const* table, int fd, audit_match* match, void* context, size_t* line_count);
+
+/*
+ * Wipes the table and unmaps it.
+ */
+__attribute__ ((nonnull))
+void audit_table_destroy(struct audit_table* table);
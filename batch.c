@@ -0,0 +1,871 @@
+#define _GNU_SOURCE
+
+#include <limits.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "batch.h"
+#include "bcrypt/explicit_bzero.h"
+#include "placement.h"
+#include "secure.h"
+#include "trace.h"
+#include "workspace.h"
+
+#define CGROUP_ROOT "/sys/fs/cgroup"
+#define CGROUP_LINE_SIZE 4096
+
+#define CALIBRATION_ROUNDS 16
+#define CALIBRATION_RUNS 3
+
+/* bcrypt_pbkdf runs all of its rounds once for each 32-byte block of key */
+#define KEY_BLOCKS ((NOSEPASS_KEY_SIZE + 31) / 32)
+
+#define STEAL_EMPTY (-1)
+#define STEAL_CONTENDED (-2)
+
+/*
+ * A worker’s share of the batch, as a range of positions in the batch’s order. The owner takes jobs from the bottom
+ * and idle workers steal them from the top. Nothing is added once the batch starts, so this is a Chase–Lev deque
+ * that never grows.
+ */
+struct deque {
+	_Alignas(64) _Atomic ptrdiff_t top;
+	_Atomic ptrdiff_t bottom;
+};
+
+/*
+ * A thread’s derivation in progress, in its slot of the batch’s secure arena.
+ */
+struct job_secrets {
+	struct nosepass_derivation derivation;
+	uint8_t key[NOSEPASS_KEY_SIZE];
+	char password[NOSEPASS_MAX_COUNT];
+};
+
+enum group_state {
+	GROUP_PENDING,
+	GROUP_DERIVING,
+	GROUP_DONE,
+};
+
+/*
+ * A group key that a batch’s jobs share, in the batch’s arena of them.
+ */
+struct group_key {
+	uint8_t key[NOSEPASS_KEY_SIZE];
+	enum nosepass_status status;
+	enum group_state state;
+};
+
+struct batch {
+	struct batch_job const* jobs;
+	size_t const* order;
+
+	/* each job’s group key, as an index into group_keys, or SIZE_MAX */
+	size_t const* groups;
+
+	/* the batch’s group keys, in an arena of their own, guarded by group_lock, which is signalled as each is done */
+	struct secure_arena* group_arena;
+	struct group_key* group_keys;
+	pthread_mutex_t group_lock;
+	pthread_cond_t group_done;
+
+	struct deque* deques;
+	unsigned int thread_count;
+
+	/* the CPU each thread is pinned to, or NULL */
+	int const* cpus;
+
+	char const* master_password;
+	size_t master_password_length;
+
+	/* a slot of job_secrets and a Blowfish workspace for each thread */
+	struct secure_arena* arena;
+	struct workspace_pool* workspaces;
+
+	/* where each thread records its jobs’ stages, or NULL */
+	struct trace* trace;
+
+	/* the passwords to generate from each key, at least 1 */
+	unsigned int increments;
+
+	pthread_mutex_t output_lock;
+	batch_output* output;
+	void* context;
+
+	/* set when the output asks to stop; guarded by output_lock, but read without it */
+	atomic_int stopped;
+	int failed;
+};
+
+struct scheduled_job {
+	uint64_t cost;
+	size_t index;
+};
+
+struct grouped_job {
+	struct batch_job const* job;
+	size_t index;
+};
+
+struct worker {
+	struct batch* batch;
+	unsigned int index;
+	pthread_t thread;
+};
+
+/*
+ * Reads a cgroup v2 cpu.max file, or a cgroup v1 quota and period, as a number of CPUs, rounded up. Returns 0 if
+ * there’s no limit.
+ */
+__attribute__ ((nonnull (1), warn_unused_result))
+static unsigned int read_cpu_limit(char const* const quota_path, char const* const period_path) {
+	FILE* f = fopen(quota_path, "r");
+
+	if (f == NULL) {
+		return 0;
+	}
+
+	long long quota;
+	long long period = 0;
+	int const fields = fscanf(f, "%lld %lld", &quota, &period);
+	fclose(f);
+
+	if (fields < 1 || quota <= 0) {
+		/* “max”, or -1 in cgroup v1 */
+		return 0;
+	}
+
+	if (period_path != NULL) {
+		if ((f = fopen(period_path, "r")) == NULL) {
+			return 0;
+		}
+
+		if (fscanf(f, "%lld", &period) != 1) {
+			period = 0;
+		}
+
+		fclose(f);
+	}
+
+	if (period <= 0) {
+		return 0;
+	}
+
+	long long const cpus = (quota + period - 1) / period;
+	return cpus > UINT32_MAX ? 0 : (unsigned int)cpus;
+}
+
+/*
+ * Finds the CPU quota of this process’s cgroup and its ancestors, in CPUs.
+ */
+__attribute__ ((warn_unused_result))
+static unsigned int get_cgroup_cpu_limit(void) {
+	FILE* const cgroups = fopen("/proc/self/cgroup", "r");
+
+	if (cgroups == NULL) {
+		return 0;
+	}
+
+	char line[CGROUP_LINE_SIZE];
+	char path[CGROUP_LINE_SIZE + 64];
+	char period_path[CGROUP_LINE_SIZE + 64];
+	unsigned int limit = 0;
+
+	while (fgets(line, sizeof line, cgroups) != NULL) {
+		line[strcspn(line, "\n")] = '\0';
+
+		/* hierarchy-ID:controller-list:path */
+		char* const controllers = strchr(line, ':');
+		char* const cgroup = controllers == NULL ? NULL : strchr(controllers + 1, ':');
+
+		if (cgroup == NULL) {
+			continue;
+		}
+
+		*cgroup = '\0';
+
+		int const v2 = strcmp(line, "0:") == 0;
+		int v1_cpu = 0;
+
+		for (char* controller = strtok(controllers + 1, ","); controller != NULL; controller = strtok(NULL, ",")) {
+			if (strcmp(controller, "cpu") == 0) {
+				v1_cpu = 1;
+			}
+		}
+
+		if (!v2 && !v1_cpu) {
+			continue;
+		}
+
+		char* const relative = cgroup + 1;
+		size_t relative_length = strlen(relative);
+
+		/* the quota of every ancestor applies */
+		for (;;) {
+			unsigned int cpus;
+
+			if (v2) {
+				snprintf(path, sizeof path, CGROUP_ROOT "%.*s/cpu.max", (int)relative_length, relative);
+				cpus = read_cpu_limit(path, NULL);
+			} else {
+				snprintf(path, sizeof path, CGROUP_ROOT "/cpu%.*s/cpu.cfs_quota_us", (int)relative_length, relative);
+				snprintf(period_path, sizeof period_path, CGROUP_ROOT "/cpu%.*s/cpu.cfs_period_us", (int)relative_length, relative);
+				cpus = read_cpu_limit(path, period_path);
+			}
+
+			if (cpus != 0 && (limit == 0 || cpus < limit)) {
+				limit = cpus;
+			}
+
+			if (relative_length <= 1) {
+				break;
+			}
+
+			while (relative_length > 1 && relative[relative_length - 1] != '/') {
+				relative_length--;
+			}
+
+			if (relative_length > 1) {
+				relative_length--;
+			}
+		}
+	}
+
+	fclose(cgroups);
+	return limit;
+}
+
+unsigned int batch_default_thread_count(void) {
+	unsigned int count = 1;
+	cpu_set_t cpus;
+
+	if (sched_getaffinity(0, sizeof cpus, &cpus) == 0) {
+		count = (unsigned int)CPU_COUNT(&cpus);
+	} else {
+		long const online = sysconf(_SC_NPROCESSORS_ONLN);
+
+		if (online > 0) {
+			count = (unsigned int)online;
+		}
+	}
+
+	unsigned int const limit = get_cgroup_cpu_limit();
+
+	if (limit != 0 && limit < count) {
+		count = limit;
+	}
+
+	return count == 0 ? 1 : count;
+}
+
+unsigned int batch_shard(char const* const site_name, unsigned int const shard_count) {
+	/* 64-bit FNV-1a, which is the same on every host */
+	uint64_t hash = UINT64_C(0xcbf29ce484222325);
+
+	for (char const* p = site_name; *p != '\0'; p++) {
+		hash = (hash ^ (unsigned char)*p) * UINT64_C(0x100000001b3);
+	}
+
+	return (unsigned int)(hash % shard_count);
+}
+
+double batch_calibrate(void) {
+	uint8_t key[NOSEPASS_KEY_SIZE];
+	double best = 0.0;
+
+	/* the fastest run is the one least disturbed by cold caches and other processes */
+	for (int i = 0; i < CALIBRATION_RUNS; i++) {
+		struct timespec start;
+		struct timespec end;
+
+		clock_gettime(CLOCK_MONOTONIC, &start);
+
+		if (nosepass_derive_key("calibration", 11, "calibration", 11, CALIBRATION_ROUNDS, key) != NOSEPASS_OK) {
+			return 0.0;
+		}
+
+		clock_gettime(CLOCK_MONOTONIC, &end);
+
+		double const elapsed = (double)(end.tv_sec - start.tv_sec) + (double)(end.tv_nsec - start.tv_nsec) / 1e9;
+
+		if (i == 0 || elapsed < best) {
+			best = elapsed;
+		}
+	}
+
+	explicit_bzero(key, sizeof key);
+	return best / (CALIBRATION_ROUNDS * KEY_BLOCKS);
+}
+
+__attribute__ ((nonnull, pure, warn_unused_result))
+static int compare_cost_descending(void const* const a, void const* const b) {
+	struct scheduled_job const* const x = a;
+	struct scheduled_job const* const y = b;
+
+	if (x->cost != y->cost) {
+		return x->cost < y->cost ? 1 : -1;
+	}
+
+	return (x->index > y->index) - (x->index < y->index);
+}
+
+/*
+ * Orders jobs in a group by the group’s name, then rounds, then lanes, then index.
+ */
+__attribute__ ((nonnull, pure, warn_unused_result))
+static int compare_groups(void const* const a, void const* const b) {
+	struct nosepass_schema const* const x = &((struct grouped_job const*)a)->job->schema;
+	struct nosepass_schema const* const y = &((struct grouped_job const*)b)->job->schema;
+
+	if (x->group_length != y->group_length) {
+		return x->group_length < y->group_length ? -1 : 1;
+	}
+
+	int const names = memcmp(x->group, y->group, x->group_length);
+
+	if (names != 0) {
+		return names;
+	}
+
+	if (x->rounds != y->rounds) {
+		return x->rounds < y->rounds ? -1 : 1;
+	}
+
+	if (x->lanes != y->lanes) {
+		return x->lanes < y->lanes ? -1 : 1;
+	}
+
+	size_t const i = ((struct grouped_job const*)a)->index;
+	size_t const j = ((struct grouped_job const*)b)->index;
+	return (i > j) - (i < j);
+}
+
+/*
+ * Numbers the distinct groups, rounds and lanes of a batch’s jobs, since a group key depends on all three, recording
+ * each job’s.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int number_groups(struct batch_job const* const jobs, size_t const job_count, struct batch_schedule* const schedule) {
+	size_t grouped_count = 0;
+
+	schedule->group_count = 0;
+
+	for (size_t i = 0; i < job_count; i++) {
+		schedule->groups[i] = SIZE_MAX;
+
+		if (jobs[i].schema.group_length != 0) {
+			grouped_count++;
+		}
+	}
+
+	if (grouped_count == 0) {
+		return 1;
+	}
+
+	struct grouped_job* const grouped = malloc(grouped_count * sizeof *grouped);
+
+	if (grouped == NULL) {
+		return 0;
+	}
+
+	for (size_t i = 0, n = 0; i < job_count; i++) {
+		if (jobs[i].schema.group_length != 0) {
+			grouped[n].job = &jobs[i];
+			grouped[n].index = i;
+			n++;
+		}
+	}
+
+	qsort(grouped, grouped_count, sizeof *grouped, compare_groups);
+
+	for (size_t n = 0; n < grouped_count; n++) {
+		struct nosepass_schema const* const schema = &grouped[n].job->schema;
+		struct nosepass_schema const* const previous = n != 0 ? &grouped[n - 1].job->schema : NULL;
+
+		if (previous == NULL || previous->group_length != schema->group_length || memcmp(previous->group, schema->group, schema->group_length) != 0 || previous->rounds != schema->rounds || previous->lanes != schema->lanes) {
+			schedule->group_count++;
+		}
+
+		schedule->groups[grouped[n].index] = schedule->group_count - 1;
+	}
+
+	free(grouped);
+	return 1;
+}
+
+int batch_schedule(struct batch_job const* const jobs, size_t const job_count, unsigned int thread_count, struct batch_schedule* const schedule) {
+	if (thread_count > job_count) {
+		thread_count = (unsigned int)job_count;
+	}
+
+	if (thread_count == 0) {
+		thread_count = 1;
+	}
+
+	schedule->thread_count = thread_count;
+	schedule->order = malloc((job_count == 0 ? 1 : job_count) * sizeof *schedule->order);
+	schedule->bounds = calloc(thread_count + 1, sizeof *schedule->bounds);
+	schedule->makespan = 0;
+	schedule->groups = malloc((job_count == 0 ? 1 : job_count) * sizeof *schedule->groups);
+	schedule->group_count = 0;
+	schedule->cpus = NULL;
+	schedule->trace = NULL;
+	schedule->increments = 0;
+
+	struct scheduled_job* const sorted = malloc((job_count == 0 ? 1 : job_count) * sizeof *sorted);
+	unsigned int* const assignments = malloc((job_count == 0 ? 1 : job_count) * sizeof *assignments);
+	uint64_t* const loads = calloc(thread_count, sizeof *loads);
+	size_t* const cursors = malloc(thread_count * sizeof *cursors);
+	int const numbered = schedule->groups != NULL && number_groups(jobs, job_count, schedule);
+	uint8_t* const counted = calloc(schedule->group_count == 0 ? 1 : schedule->group_count, sizeof *counted);
+
+	if (schedule->order == NULL || schedule->bounds == NULL || sorted == NULL || assignments == NULL || loads == NULL || cursors == NULL || !numbered || counted == NULL) {
+		fputs("failed to allocate memory\n", stderr);
+		batch_schedule_free(schedule);
+		free(sorted);
+		free(assignments);
+		free(loads);
+		free(cursors);
+		free(counted);
+		return 0;
+	}
+
+	for (size_t i = 0; i < job_count; i++) {
+		size_t const group = schedule->groups[i];
+
+		/* a group key is derived once, and expanding it for each other job in the group costs next to nothing */
+		sorted[i].cost = group == SIZE_MAX || !counted[group] ? (uint64_t)jobs[i].schema.rounds * jobs[i].schema.lanes * KEY_BLOCKS : 0;
+		sorted[i].index = i;
+
+		if (group != SIZE_MAX) {
+			counted[group] = 1;
+		}
+	}
+
+	free(counted);
+
+	qsort(sorted, job_count, sizeof *sorted, compare_cost_descending);
+
+	/* longest processing time first: each job goes to the thread with the least work so far */
+	for (size_t i = 0; i < job_count; i++) {
+		unsigned int lightest = 0;
+
+		for (unsigned int t = 1; t < thread_count; t++) {
+			if (loads[t] < loads[lightest]) {
+				lightest = t;
+			}
+		}
+
+		loads[lightest] += sorted[i].cost;
+		assignments[i] = lightest;
+		schedule->bounds[lightest + 1]++;
+	}
+
+	for (unsigned int t = 0; t < thread_count; t++) {
+		schedule->bounds[t + 1] += schedule->bounds[t];
+		cursors[t] = schedule->bounds[t + 1];
+
+		if (loads[t] > schedule->makespan) {
+			schedule->makespan = loads[t];
+		}
+	}
+
+	/* threads run their own jobs from the end of their share, so the most expensive go last in it */
+	for (size_t i = 0; i < job_count; i++) {
+		schedule->order[--cursors[assignments[i]]] = sorted[i].index;
+	}
+
+	free(sorted);
+	free(assignments);
+	free(loads);
+	free(cursors);
+	return 1;
+}
+
+void batch_schedule_free(struct batch_schedule* const schedule) {
+	free(schedule->order);
+	free(schedule->bounds);
+	free(schedule->groups);
+	free(schedule->cpus);
+	schedule->order = NULL;
+	schedule->bounds = NULL;
+	schedule->groups = NULL;
+	schedule->cpus = NULL;
+}
+
+/*
+ * Takes the job at the bottom of the worker’s own deque, or returns STEAL_EMPTY.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static ptrdiff_t deque_take(struct deque* const deque) {
+	ptrdiff_t const bottom = atomic_load(&deque->bottom) - 1;
+	atomic_store(&deque->bottom, bottom);
+	ptrdiff_t top = atomic_load(&deque->top);
+
+	if (top > bottom) {
+		atomic_store(&deque->bottom, bottom + 1);
+		return STEAL_EMPTY;
+	}
+
+	if (top < bottom) {
+		return bottom;
+	}
+
+	/* the last job, which a thief might be taking too */
+	int const won = atomic_compare_exchange_strong(&deque->top, &top, top + 1);
+	atomic_store(&deque->bottom, bottom + 1);
+	return won ? bottom : STEAL_EMPTY;
+}
+
+/*
+ * Takes the job at the top of another worker’s deque, or returns STEAL_EMPTY or STEAL_CONTENDED.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static ptrdiff_t deque_steal(struct deque* const deque) {
+	ptrdiff_t top = atomic_load(&deque->top);
+	ptrdiff_t const bottom = atomic_load(&deque->bottom);
+
+	if (top >= bottom) {
+		return STEAL_EMPTY;
+	}
+
+	return atomic_compare_exchange_strong(&deque->top, &top, top + 1) ? top : STEAL_CONTENDED;
+}
+
+/*
+ * Gets the position of the next job for a worker, stealing if its own deque is empty, or returns STEAL_EMPTY once
+ * every deque is.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static ptrdiff_t next_job(struct batch* const batch, unsigned int const index, int* const stolen) {
+	ptrdiff_t position = deque_take(&batch->deques[index]);
+
+	if (position != STEAL_EMPTY) {
+		*stolen = 0;
+		return position;
+	}
+
+	*stolen = 1;
+
+	for (;;) {
+		int contended = 0;
+
+		for (unsigned int i = 1; i < batch->thread_count; i++) {
+			position = deque_steal(&batch->deques[(index + i) % batch->thread_count]);
+
+			if (position >= 0) {
+				return position;
+			}
+
+			if (position == STEAL_CONTENDED) {
+				contended = 1;
+			}
+		}
+
+		if (!contended) {
+			return STEAL_EMPTY;
+		}
+	}
+}
+
+/*
+ * Outputs a password, or a failure, unless the batch has been stopped. Returns 0 if it has, or is now.
+ */
+__attribute__ ((nonnull (1, 2)))
+static int output_password(struct batch* const batch, struct batch_job const* const job, char const* const password, enum nosepass_status const status, struct trace_job* const record) {
+	pthread_mutex_lock(&batch->output_lock);
+
+	if (record != NULL) {
+		record->locked = trace_now(batch->trace);
+	}
+
+	int const stopped = atomic_load(&batch->stopped);
+
+	if (!stopped) {
+		if (status != NOSEPASS_OK) {
+			batch->failed = 1;
+		}
+
+		if (!batch->output(batch->context, job, status == NOSEPASS_OK ? password : NULL, status)) {
+			batch->failed = 1;
+			atomic_store(&batch->stopped, 1);
+		}
+	}
+
+	if (record != NULL) {
+		record->written = trace_now(batch->trace);
+	}
+
+	pthread_mutex_unlock(&batch->output_lock);
+	return !stopped && !atomic_load(&batch->stopped);
+}
+
+/*
+ * Runs a started derivation to completion in a thread’s lane, profiling it if its job is traced, and finishes it.
+ */
+__attribute__ ((nonnull (1, 2), warn_unused_result))
+static enum nosepass_status run_derivation(struct batch* const batch, struct nosepass_derivation* const derivation, unsigned int const lane, struct trace_job* const record) {
+	nosepass_derivation_set_workspace(derivation, workspace_pool_lane(batch->workspaces, lane), workspace_pool_initial(batch->workspaces, lane));
+
+	if (record != NULL) {
+		nosepass_derivation_set_profile(derivation, &record->profile);
+	}
+
+	while (nosepass_derivation_step(derivation, UINT_MAX)) {}
+
+	return nosepass_derivation_finish(derivation);
+}
+
+/*
+ * Gets a job’s group key, deriving it if no other job has started to, or waiting for the job that has.
+ */
+__attribute__ ((nonnull (1, 2, 3), warn_unused_result))
+static enum nosepass_status get_group_key(struct batch* const batch, struct batch_job const* const job, struct job_secrets* const secrets, unsigned int const lane, struct trace_job* const record) {
+	struct group_key* const group = &batch->group_keys[batch->groups[job - batch->jobs]];
+	enum nosepass_status status;
+
+	pthread_mutex_lock(&batch->group_lock);
+
+	while (group->state == GROUP_DERIVING) {
+		pthread_cond_wait(&batch->group_done, &batch->group_lock);
+	}
+
+	int const derive = group->state == GROUP_PENDING;
+
+	if (derive) {
+		group->state = GROUP_DERIVING;
+	} else {
+		memcpy(secrets->key, group->key, sizeof secrets->key);
+		status = group->status;
+	}
+
+	pthread_mutex_unlock(&batch->group_lock);
+
+	if (!derive) {
+		return status;
+	}
+
+	status = nosepass_derivation_init_group(&secrets->derivation, batch->master_password, batch->master_password_length, job->schema.group, job->schema.group_length, job->schema.rounds, secrets->key);
+
+	if (status == NOSEPASS_OK && job->schema.lanes > 1) {
+		status = nosepass_derivation_set_lanes(&secrets->derivation, batch->master_password, batch->master_password_length, job->schema.lanes);
+	}
+
+	if (status == NOSEPASS_OK) {
+		status = run_derivation(batch, &secrets->derivation, lane, record);
+	}
+
+	pthread_mutex_lock(&batch->group_lock);
+	memcpy(group->key, secrets->key, sizeof group->key);
+	group->status = status;
+	group->state = GROUP_DONE;
+	pthread_cond_broadcast(&batch->group_done);
+	pthread_mutex_unlock(&batch->group_lock);
+	return status;
+}
+
+/*
+ * Derives a job’s key, and outputs the passwords it gives for each of the batch’s increments, recording when it
+ * reaches each stage if the batch is traced. With several increments, the generate and output stages are the last
+ * increment’s.
+ */
+__attribute__ ((nonnull))
+static void run_job(struct batch* const batch, struct batch_job const* const job, struct job_secrets* const secrets, unsigned int const lane, int const stolen) {
+	struct trace_job* const record = batch->trace != NULL ? trace_add(batch->trace, lane) : NULL;
+
+	if (record != NULL) {
+		record->job = (size_t)(job - batch->jobs);
+		record->stolen = stolen;
+		record->taken = trace_now(batch->trace);
+	}
+
+	enum nosepass_status status;
+
+	if (batch->groups[job - batch->jobs] == SIZE_MAX) {
+		status = nosepass_derivation_init_site(&secrets->derivation, batch->master_password, batch->master_password_length, job->site_name, strlen(job->site_name), &job->schema, secrets->key);
+
+		if (status == NOSEPASS_OK) {
+			status = run_derivation(batch, &secrets->derivation, lane, record);
+		}
+	} else if ((status = get_group_key(batch, job, secrets, lane, record)) == NOSEPASS_OK) {
+		status = nosepass_expand_key(secrets->key, job->site_name, strlen(job->site_name), secrets->key);
+	}
+
+	if (record != NULL) {
+		record->derived = trace_now(batch->trace);
+	}
+
+	/* the increment is only the keystream’s nonce, so every increment’s password comes from the one key */
+	struct batch_job variant;
+	int output = 1;
+
+	for (unsigned int i = 0; output && i < batch->increments; i++) {
+		struct batch_job const* output_job = job;
+		enum nosepass_status generated = status;
+
+		if (i != 0) {
+			variant = *job;
+			variant.schema.increment += i;
+			output_job = &variant;
+		}
+
+		if (generated == NOSEPASS_OK) {
+			generated =
+				record != NULL
+					? nosepass_generate_profiled(secrets->key, &output_job->schema, secrets->password, sizeof secrets->password, &record->profile)
+					: nosepass_generate(secrets->key, &output_job->schema, secrets->password, sizeof secrets->password);
+		}
+
+		if (record != NULL) {
+			record->generated = trace_now(batch->trace);
+		}
+
+		output = output_password(batch, output_job, secrets->password, generated, record) && generated == NOSEPASS_OK;
+		explicit_bzero(secrets->password, sizeof secrets->password);
+	}
+
+	explicit_bzero(secrets->key, sizeof secrets->key);
+}
+
+static void* work(void* const arg) {
+	struct worker const* const worker = arg;
+	struct batch* const batch = worker->batch;
+
+	/* pinned before it touches its stack and its secure slot, so that both are on its own node */
+	if (batch->cpus != NULL && !placement_pin(batch->cpus[worker->index])) {
+		fprintf(stderr, "failed to pin thread %u to CPU %d\n", worker->index, batch->cpus[worker->index]);
+	}
+
+	/* there’s a slot for every thread */
+	struct job_secrets* const secrets = secure_alloc(batch->arena);
+
+	while (!atomic_load(&batch->stopped)) {
+		int stolen;
+		ptrdiff_t const position = next_job(batch, worker->index, &stolen);
+
+		if (position == STEAL_EMPTY) {
+			break;
+		}
+
+		run_job(batch, &batch->jobs[batch->order[position]], secrets, worker->index, stolen);
+	}
+
+	secure_free(batch->arena, secrets);
+	return NULL;
+}
+
+int batch_run(struct batch_schedule const* const schedule, struct batch_job const* const jobs, char const* const master_password, size_t const master_password_length, batch_output* const output, void* const context) {
+	unsigned int const thread_count = schedule->thread_count;
+
+	if (schedule->bounds[thread_count] == 0) {
+		return 1;
+	}
+
+	struct batch batch = {
+		.jobs = jobs,
+		.order = schedule->order,
+		.groups = schedule->groups,
+		.group_arena = schedule->group_count != 0 ? secure_arena_create(schedule->group_count * sizeof(struct group_key), 1) : NULL,
+		.group_keys = NULL,
+		.deques = aligned_alloc(_Alignof(struct deque), thread_count * sizeof *batch.deques),
+		.thread_count = thread_count,
+		.cpus = schedule->cpus,
+		.master_password = master_password,
+		.master_password_length = master_password_length,
+		.arena = secure_arena_create(sizeof(struct job_secrets), thread_count),
+		.workspaces = workspace_pool_create(thread_count, schedule->cpus),
+		.trace = schedule->trace,
+		.increments = schedule->increments != 0 ? schedule->increments : 1,
+		.output = output,
+		.context = context,
+		.stopped = 0,
+		.failed = 0,
+	};
+	struct worker* const workers = malloc(thread_count * sizeof *workers);
+
+	if (batch.deques == NULL || workers == NULL || batch.arena == NULL || batch.workspaces == NULL || (schedule->group_count != 0 && batch.group_arena == NULL)) {
+		if (batch.deques == NULL || workers == NULL) {
+			fputs("failed to allocate memory\n", stderr);
+		}
+
+		if (batch.arena != NULL) {
+			secure_arena_destroy(batch.arena);
+		}
+
+		if (batch.group_arena != NULL) {
+			secure_arena_destroy(batch.group_arena);
+		}
+
+		if (batch.workspaces != NULL) {
+			workspace_pool_destroy(batch.workspaces);
+		}
+
+		free(batch.deques);
+		free(workers);
+		return 0;
+	}
+
+	for (unsigned int i = 0; i < thread_count; i++) {
+		atomic_init(&batch.deques[i].top, (ptrdiff_t)schedule->bounds[i]);
+		atomic_init(&batch.deques[i].bottom, (ptrdiff_t)schedule->bounds[i + 1]);
+	}
+
+	pthread_mutex_init(&batch.output_lock, NULL);
+	pthread_mutex_init(&batch.group_lock, NULL);
+	pthread_cond_init(&batch.group_done, NULL);
+
+	/* the arena’s only slot, zeroed, so every key starts pending */
+	if (batch.group_arena != NULL) {
+		batch.group_keys = secure_alloc(batch.group_arena);
+	}
+
+	/* the calling thread is worker 0; any worker that fails to start has its share stolen by the others */
+	unsigned int started = 1;
+
+	for (unsigned int i = 1; i < thread_count; i++) {
+		workers[started].batch = &batch;
+		workers[started].index = i;
+
+		if (pthread_create(&workers[started].thread, NULL, work, &workers[started]) == 0) {
+			started++;
+		}
+	}
+
+	/* the calling thread only stays pinned for the batch */
+	cpu_set_t caller_cpus;
+	int const restore_caller = schedule->cpus != NULL && pthread_getaffinity_np(pthread_self(), sizeof caller_cpus, &caller_cpus) == 0;
+
+	workers[0].batch = &batch;
+	workers[0].index = 0;
+	work(&workers[0]);
+
+	if (restore_caller) {
+		pthread_setaffinity_np(pthread_self(), sizeof caller_cpus, &caller_cpus);
+	}
+
+	for (unsigned int i = 1; i < started; i++) {
+		pthread_join(workers[i].thread, NULL);
+	}
+
+	pthread_mutex_destroy(&batch.output_lock);
+	pthread_mutex_destroy(&batch.group_lock);
+	pthread_cond_destroy(&batch.group_done);
+	secure_arena_destroy(batch.arena);
+
+	if (batch.group_arena != NULL) {
+		secure_arena_destroy(batch.group_arena);
+	}
+
+	workspace_pool_destroy(batch.workspaces);
+	free(batch.deques);
+	free(workers);
+	return !batch.failed;
+}
@@ -0,0 +1,86 @@
+#ifndef BATCH_H
+#define BATCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "nosepass.h"
+
+struct trace;
+
+struct batch_job {
+	char const* site_name;
+	struct nosepass_schema schema;
+};
+
+/*
+ * Receives a job’s password, or NULL and the status it failed with. Calls are serialized. Returns 0 to stop the
+ * batch. For a schedule of several increments, each increment after the job’s own comes with a copy of the job with
+ * its schema’s increment raised.
+ */
+typedef int batch_output(void* context, struct batch_job const* job, char const* password, enum nosepass_status status);
+
+/*
+ * Gets the number of threads a batch should use: the CPUs this process may run on, limited by any cgroup CPU quota.
+ */
+__attribute__ ((warn_unused_result))
+unsigned int batch_default_thread_count(void);
+
+/*
+ * Assigns a site to one of `shard_count` shards by a hash of its name, so that separate processes or hosts can split a
+ * list of sites between them without coordinating.
+ */
+__attribute__ ((nonnull, pure, warn_unused_result))
+unsigned int batch_shard(char const* site_name, unsigned int shard_count);
+
+/*
+ * Which jobs each thread of a batch starts with, and in what order.
+ */
+struct batch_schedule {
+	unsigned int thread_count;
+
+	/* job indices; thread i starts with order[bounds[i]] to order[bounds[i + 1] - 1], and runs them from the end */
+	size_t* order;
+	size_t* bounds;
+
+	/* the estimated cost of the longest thread’s share, in KDF rounds of one 32-byte block */
+	uint64_t makespan;
+
+	/* each job’s group key, as an index into the batch’s distinct groups and rounds, or SIZE_MAX for none */
+	size_t* groups;
+	size_t group_count;
+
+	/* the CPU each thread is pinned to, from placement_choose, or NULL to let them move */
+	int* cpus;
+
+	/* where to record each job’s stages, owned by the caller, or NULL */
+	struct trace* trace;
+
+	/* how many consecutive increments, from each job’s own, to generate passwords for from its key; 0 for just one */
+	unsigned int increments;
+};
+
+/*
+ * Times the KDF, in seconds per round of one block.
+ */
+__attribute__ ((warn_unused_result))
+double batch_calibrate(void);
+
+/*
+ * Divides a batch between threads longest-first, by each job’s rounds and key length, so that expensive jobs don’t
+ * run alone at the end. Of the jobs sharing a group key, only one is counted as deriving it, and the rest as free.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+int batch_schedule(struct batch_job const* jobs, size_t job_count, unsigned int thread_count, struct batch_schedule* schedule);
+
+__attribute__ ((nonnull))
+void batch_schedule_free(struct batch_schedule* schedule);
+
+/*
+ * Derives every scheduled job’s password on a work-stealing pool of threads. Each group key is derived once, by the
+ * first job to need it, while any other job needing it waits. Returns 1 if all of them were derived and output.
+ */
+__attribute__ ((nonnull (1, 2, 3, 5), warn_unused_result))
+int batch_run(struct batch_schedule const* schedule, struct batch_job const* jobs, char const* master_password, size_t master_password_length, batch_output* output, void* context);
+
+#endif
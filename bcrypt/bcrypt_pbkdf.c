@@ -22,9 +22,11 @@
 #include "blf.h"
 #include "sha2.h"
 #include <string.h>
+#include <time.h>
 #include "explicit_bzero.h"
 
 #include "bcrypt_pbkdf.h"
+#include "../probes.h"
 
 #define	MINIMUM(a,b) (((a) < (b)) ? (a) : (b))
 
@@ -55,10 +57,17 @@
 #define BCRYPT_WORDS 8
 #define BCRYPT_HASHSIZE (BCRYPT_WORDS * 4)
 
+_Static_assert(sizeof(((struct bcrypt_pbkdf_state *)0)->sha2pass) ==
+    SHA512_DIGEST_LENGTH, "state holds a sha512 digest");
+_Static_assert(sizeof(((struct bcrypt_pbkdf_state *)0)->out) ==
+    BCRYPT_HASHSIZE, "state holds a bcrypt hash");
+
 static void
-bcrypt_hash(uint8_t *sha2pass, uint8_t *sha2salt, uint8_t *out)
+bcrypt_hash(uint8_t *sha2pass, uint8_t *sha2salt, uint8_t *out,
+    blf_ctx *workspace, const blf_ctx *initial)
 {
-	blf_ctx state;
+	blf_ctx local;
+	blf_ctx *state = workspace != NULL ? workspace : &local;
 	uint8_t ciphertext[BCRYPT_HASHSIZE] =
 	    "OxychromaticBlowfishSwatDynamite";
 	uint32_t cdata[BCRYPT_WORDS];
@@ -67,11 +76,14 @@ bcrypt_hash(uint8_t *sha2pass, uint8_t *sha2salt, uint8_t *out)
 	uint16_t shalen = SHA512_DIGEST_LENGTH;
 
 	/* key expansion */
-	Blowfish_initstate(&state);
-	Blowfish_expandstate(&state, sha2salt, shalen, sha2pass, shalen);
+	if (initial != NULL)
+		*state = *initial;
+	else
+		Blowfish_initstate(state);
+	Blowfish_expandstate(state, sha2salt, shalen, sha2pass, shalen);
 	for (i = 0; i < 64; i++) {
-		Blowfish_expand0state(&state, sha2salt, shalen);
-		Blowfish_expand0state(&state, sha2pass, shalen);
+		Blowfish_expand0state(state, sha2salt, shalen);
+		Blowfish_expand0state(state, sha2pass, shalen);
 	}
 
 	/* encryption */
@@ -80,7 +92,7 @@ bcrypt_hash(uint8_t *sha2pass, uint8_t *sha2salt, uint8_t *out)
 		cdata[i] = Blowfish_stream2word(ciphertext, sizeof(ciphertext),
 		    &j);
 	for (i = 0; i < 64; i++)
-		blf_enc(&state, cdata, sizeof(cdata) / sizeof(uint64_t));
+		blf_enc(state, cdata, sizeof(cdata) / sizeof(uint64_t));
 
 	/* copy out */
 	for (i = 0; i < BCRYPT_WORDS; i++) {
@@ -93,79 +105,249 @@ bcrypt_hash(uint8_t *sha2pass, uint8_t *sha2salt, uint8_t *out)
 	/* zap */
 	explicit_bzero(ciphertext, sizeof(ciphertext));
 	explicit_bzero(cdata, sizeof(cdata));
-	explicit_bzero(&state, sizeof(state));
+	explicit_bzero(state, sizeof(*state));
+}
+
+/*
+ * profiling reads the wall and thread cpu clocks around each part of a
+ * round, and only when a derivation has somewhere to add the times up.
+ */
+struct timing_mark {
+	struct timespec wall;
+	struct timespec cpu;
+};
+
+static void
+timing_mark(struct timing_mark *mark)
+{
+	clock_gettime(CLOCK_MONOTONIC, &mark->wall);
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &mark->cpu);
+}
+
+static uint64_t
+timing_elapsed(const struct timespec *start, const struct timespec *end)
+{
+	return (uint64_t)(end->tv_sec - start->tv_sec) * 1000000000 +
+	    (uint64_t)end->tv_nsec - (uint64_t)start->tv_nsec;
 }
 
+/*
+ * incremental interface: the state between calls is the collapsed password,
+ * the counters and the current block's out and tmpout, so a derivation can
+ * be run a few rounds at a time and abandoned at any point. the salt is
+ * referenced, not copied, and must outlive the state.
+ */
 int
-bcrypt_pbkdf(const char *pass, size_t passlen, const uint8_t *salt, size_t saltlen,
-    uint8_t *key, size_t keylen, unsigned int rounds)
+bcrypt_pbkdf_init(struct bcrypt_pbkdf_state *state, const char *pass,
+    size_t passlen, const uint8_t *salt, size_t saltlen, uint8_t *key,
+    size_t keylen, unsigned int rounds)
 {
 	SHA2_CTX ctx;
-	uint8_t sha2pass[SHA512_DIGEST_LENGTH];
-	uint8_t sha2salt[SHA512_DIGEST_LENGTH];
-	uint8_t out[BCRYPT_HASHSIZE];
-	uint8_t tmpout[BCRYPT_HASHSIZE];
-	uint8_t countsalt[4];
-	size_t i, j, amt, stride;
-	uint32_t count;
-	size_t origkeylen = keylen;
 
 	/* nothing crazy */
 	if (rounds < 1)
 		return -1;
 	if (passlen == 0 || saltlen == 0 || keylen == 0 ||
-	    keylen > sizeof(out) * sizeof(out))
+	    keylen > sizeof(state->out) * sizeof(state->out))
 		return -1;
-	stride = (keylen + sizeof(out) - 1) / sizeof(out);
-	amt = (keylen + stride - 1) / stride;
+
+	memset(state, 0, sizeof(*state));
+	state->key = key;
+	state->key_length = keylen;
+	state->original_key_length = keylen;
+	state->rounds = rounds;
+	state->stride = (keylen + sizeof(state->out) - 1) / sizeof(state->out);
+	state->amount = (keylen + state->stride - 1) / state->stride;
+	state->salt = salt;
+	state->salt_length = saltlen;
+	state->count = 1;
+
+	PROBE2(kdf_start, rounds, keylen);
 
 	/* collapse password */
 	SHA512Init(&ctx);
 	SHA512Update(&ctx, pass, passlen);
-	SHA512Final(sha2pass, &ctx);
+	SHA512Final(state->sha2pass, &ctx);
+	explicit_bzero(&ctx, sizeof(ctx));
 
+	return 0;
+}
+
+int
+bcrypt_pbkdf_step(struct bcrypt_pbkdf_state *state, unsigned int rounds)
+{
+	SHA2_CTX ctx;
+	uint8_t sha2salt[SHA512_DIGEST_LENGTH];
+	uint8_t countsalt[4];
+	size_t i, j, dest;
+	struct timing_mark start, hashed, end;
+	int running = state->key_length > 0;
 
-	/* generate key, sizeof(out) at a time */
-	for (count = 1; keylen > 0; count++) {
-		countsalt[0] = (count >> 24) & 0xff;
-		countsalt[1] = (count >> 16) & 0xff;
-		countsalt[2] = (count >> 8) & 0xff;
-		countsalt[3] = count & 0xff;
+	while (state->key_length > 0) {
+		if (state->round == state->rounds) {
+			/*
+			 * pbkdf2 deviation: output the key material non-linearly.
+			 */
+			state->amount = MINIMUM(state->amount, state->key_length);
+			for (i = 0; i < state->amount; i++) {
+				dest = i * state->stride + (state->count - 1);
+				if (dest >= state->original_key_length)
+					break;
+				state->key[dest] = state->out[i];
+			}
+			state->key_length -= i;
+			state->count++;
+			state->round = 0;
+			continue;
+		}
 
-		/* first round, salt is salt */
-		SHA512Init(&ctx);
-		SHA512Update(&ctx, salt, saltlen);
-		SHA512Update(&ctx, countsalt, sizeof(countsalt));
-		SHA512Final(sha2salt, &ctx);
-		bcrypt_hash(sha2pass, sha2salt, tmpout);
-		memcpy(out, tmpout, sizeof(out));
+		if (rounds == 0)
+			break;
+		rounds--;
+
+		if (state->timing != NULL)
+			timing_mark(&start);
 
-		for (i = 1; i < rounds; i++) {
+		if (state->round == 0) {
+			countsalt[0] = (state->count >> 24) & 0xff;
+			countsalt[1] = (state->count >> 16) & 0xff;
+			countsalt[2] = (state->count >> 8) & 0xff;
+			countsalt[3] = state->count & 0xff;
+
+			/* first round, salt is salt */
+			SHA512Init(&ctx);
+			SHA512Update(&ctx, state->salt, state->salt_length);
+			SHA512Update(&ctx, countsalt, sizeof(countsalt));
+		} else {
 			/* subsequent rounds, salt is previous output */
 			SHA512Init(&ctx);
-			SHA512Update(&ctx, tmpout, sizeof(tmpout));
-			SHA512Final(sha2salt, &ctx);
-			bcrypt_hash(sha2pass, sha2salt, tmpout);
-			for (j = 0; j < sizeof(out); j++)
-				out[j] ^= tmpout[j];
+			SHA512Update(&ctx, state->tmpout, sizeof(state->tmpout));
+		}
+		SHA512Final(sha2salt, &ctx);
+
+		if (state->timing != NULL)
+			timing_mark(&hashed);
+
+		bcrypt_hash(state->sha2pass, sha2salt, state->tmpout,
+		    state->workspace, state->initial);
+
+		if (state->timing != NULL) {
+			timing_mark(&end);
+			state->timing->sha512_wall +=
+			    timing_elapsed(&start.wall, &hashed.wall);
+			state->timing->sha512_cpu +=
+			    timing_elapsed(&start.cpu, &hashed.cpu);
+			state->timing->blowfish_wall +=
+			    timing_elapsed(&hashed.wall, &end.wall);
+			state->timing->blowfish_cpu +=
+			    timing_elapsed(&hashed.cpu, &end.cpu);
 		}
 
-		/*
-		 * pbkdf2 deviation: output the key material non-linearly.
-		 */
-		amt = MINIMUM(amt, keylen);
-		for (i = 0; i < amt; i++) {
-			size_t dest = i * stride + (count - 1);
-			if (dest >= origkeylen)
-				break;
-			key[dest] = out[i];
+		if (state->round == 0) {
+			memcpy(state->out, state->tmpout, sizeof(state->out));
+		} else {
+			for (j = 0; j < sizeof(state->out); j++)
+				state->out[j] ^= state->tmpout[j];
 		}
-		keylen -= i;
+
+		state->completed++;
+		state->round++;
+
+		if ((state->completed & (PROBE_ROUND_INTERVAL - 1)) == 0)
+			PROBE2(kdf_round, state->completed, state->rounds);
 	}
 
+	if (running && state->key_length == 0)
+		PROBE2(kdf_end, state->completed, state->rounds);
+
 	/* zap */
 	explicit_bzero(&ctx, sizeof(ctx));
-	explicit_bzero(out, sizeof(out));
+	explicit_bzero(sha2salt, sizeof(sha2salt));
+
+	return state->key_length > 0;
+}
+
+/*
+ * the tmpout chain for more rounds extends the chain for fewer, and out is
+ * its running xor, so a single-block derivation can be carried past its
+ * original rounds, or restarted from the out and tmpout of an earlier one.
+ */
+int
+bcrypt_pbkdf_extend(struct bcrypt_pbkdf_state *state, unsigned int rounds)
+{
+	if (state->stride != 1 || rounds < 1 || rounds < state->completed)
+		return -1;
+
+	state->rounds = rounds;
+	state->round = (unsigned int)state->completed;
+	state->count = 1;
+	state->key_length = state->original_key_length;
+	state->amount = state->original_key_length;
 
 	return 0;
 }
+
+int
+bcrypt_pbkdf_restore(struct bcrypt_pbkdf_state *state, const uint8_t *out,
+    const uint8_t *tmpout, unsigned int completed)
+{
+	if (state->stride != 1 || state->completed != 0 || completed < 1 ||
+	    completed > state->rounds)
+		return -1;
+
+	memcpy(state->out, out, sizeof(state->out));
+	memcpy(state->tmpout, tmpout, sizeof(state->tmpout));
+	state->round = completed;
+	state->completed = completed;
+
+	return 0;
+}
+
+/*
+ * the blowfish state of a round is the bulk of the work's memory, so a
+ * caller running many derivations at once can place it, and the pristine
+ * state each round starts from, where they suit it.
+ */
+void
+bcrypt_pbkdf_set_workspace(struct bcrypt_pbkdf_state *state,
+    struct BlowfishContext *workspace, const struct BlowfishContext *initial)
+{
+	state->workspace = workspace;
+	state->initial = initial;
+}
+
+void
+bcrypt_pbkdf_set_timing(struct bcrypt_pbkdf_state *state,
+    struct bcrypt_pbkdf_timing *timing)
+{
+	state->timing = timing;
+}
+
+int
+bcrypt_pbkdf_finish(struct bcrypt_pbkdf_state *state)
+{
+	int complete = state->key_length == 0;
+
+	/* an abandoned derivation leaves no partial key behind */
+	if (!complete)
+		explicit_bzero(state->key, state->original_key_length);
+
+	/* zap */
+	explicit_bzero(state, sizeof(*state));
+
+	return complete ? 0 : -1;
+}
+
+int
+bcrypt_pbkdf(const char *pass, size_t passlen, const uint8_t *salt, size_t saltlen,
+    uint8_t *key, size_t keylen, unsigned int rounds)
+{
+	struct bcrypt_pbkdf_state state;
+
+	if (bcrypt_pbkdf_init(&state, pass, passlen, salt, saltlen, key,
+	    keylen, rounds) != 0)
+		return -1;
+	while (bcrypt_pbkdf_step(&state, rounds) > 0)
+		;
+	return bcrypt_pbkdf_finish(&state);
+}
@@ -1,6 +1,51 @@
+#ifndef BCRYPT_PBKDF_H
+#define BCRYPT_PBKDF_H
+
 #include <stdint.h>
 #include <stdlib.h>
 
+struct BlowfishContext;
+
+/*
+ * Nanoseconds of wall-clock and thread CPU time that a derivation’s rounds have spent hashing salts with SHA-512 and
+ * running Blowfish.
+ */
+struct bcrypt_pbkdf_timing {
+	uint64_t sha512_wall;
+	uint64_t sha512_cpu;
+	uint64_t blowfish_wall;
+	uint64_t blowfish_cpu;
+};
+
+/*
+ * A bcrypt_pbkdf derivation in progress. All fields are private.
+ */
+struct bcrypt_pbkdf_state {
+	uint8_t sha2pass[64];
+	uint8_t out[32];
+	uint8_t tmpout[32];
+	uint8_t const* salt;
+	size_t salt_length;
+	uint8_t* key;
+	size_t key_length;
+	size_t original_key_length;
+	size_t stride;
+	size_t amount;
+	uint32_t count;
+	unsigned int rounds;
+	unsigned int round;
+
+	/* rounds run so far, out of rounds × ceil(key_length / 32) */
+	uint64_t completed;
+
+	/* where rounds run and what they start from, or NULL for a local and Blowfish_initstate */
+	struct BlowfishContext* workspace;
+	struct BlowfishContext const* initial;
+
+	/* where to add up the time rounds take, or NULL to not time them */
+	struct bcrypt_pbkdf_timing* timing;
+};
+
 __attribute__ ((warn_unused_result))
 int bcrypt_pbkdf(
 	char const* password,
@@ -11,3 +56,61 @@ int bcrypt_pbkdf(
 	size_t key_length,
 	unsigned int rounds
 );
+
+/*
+ * Starts a derivation that bcrypt_pbkdf_step runs and bcrypt_pbkdf_finish ends, with the same arguments and result
+ * as bcrypt_pbkdf. `salt` and `key` must stay valid until it’s finished.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+int bcrypt_pbkdf_init(
+	struct bcrypt_pbkdf_state* state,
+	char const* password,
+	size_t password_length,
+	uint8_t const* salt,
+	size_t salt_length,
+	uint8_t* key,
+	size_t key_length,
+	unsigned int rounds
+);
+
+/*
+ * Runs up to `rounds` more rounds. Returns 1 if the derivation has rounds left, or 0 if it’s done.
+ */
+__attribute__ ((nonnull))
+int bcrypt_pbkdf_step(struct bcrypt_pbkdf_state* state, unsigned int rounds);
+
+/*
+ * Changes the rounds of a derivation with a key of at most 32 bytes to any number at least the rounds it has already
+ * run, even if it’s done; stepping it to completion again rewrites the key.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+int bcrypt_pbkdf_extend(struct bcrypt_pbkdf_state* state, unsigned int rounds);
+
+/*
+ * Continues a newly started derivation with a key of at most 32 bytes from the `out` and `tmpout` (32 bytes each) of
+ * one with the same password and salt after `completed` rounds.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+int bcrypt_pbkdf_restore(struct bcrypt_pbkdf_state* state, uint8_t const* out, uint8_t const* tmpout, unsigned int completed);
+
+/*
+ * Runs the rest of a derivation’s rounds in `workspace` instead of on the stack, starting each from a copy of
+ * `initial` instead of Blowfish_initstate’s; either may be NULL. Both must stay valid until it’s finished. The
+ * workspace is wiped after every round.
+ */
+__attribute__ ((nonnull (1)))
+void bcrypt_pbkdf_set_workspace(struct bcrypt_pbkdf_state* state, struct BlowfishContext* workspace, struct BlowfishContext const* initial);
+
+/*
+ * Adds the time each part of the derivation’s rounds takes from now on to `timing`, or stops timing them if it’s NULL.
+ */
+__attribute__ ((nonnull (1)))
+void bcrypt_pbkdf_set_timing(struct bcrypt_pbkdf_state* state, struct bcrypt_pbkdf_timing* timing);
+
+/*
+ * Wipes the state. Returns 0 if the derivation was complete; otherwise, also wipes the key and returns -1.
+ */
+__attribute__ ((nonnull))
+int bcrypt_pbkdf_finish(struct bcrypt_pbkdf_state* state);
+
+#endif
@@ -0,0 +1,113 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "batch.h"
+#include "placement.h"
+
+/*
+ * Measures batch throughput from one thread up to one for each hardware thread, to show how derivations scale over
+ * cores and their SMT siblings under a placement policy.
+ *
+ * Usage: scaling [none|spread|compact] [<rounds>]
+ */
+
+#define JOBS_PER_THREAD 8
+#define DEFAULT_ROUNDS 16
+#define SITE_NAME_SIZE 32
+
+static int count_password(void* const context, struct batch_job const* const job, char const* const password, enum nosepass_status const status) {
+	size_t* const derived = context;
+	(void)job;
+	(void)status;
+
+	*derived += password != NULL;
+	return 1;
+}
+
+/*
+ * Runs a batch of JOBS_PER_THREAD derivations for each thread, returning derivations per second, or 0 on failure.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static double measure(struct batch_job* const jobs, enum placement_policy const policy, unsigned int const thread_count) {
+	size_t const job_count = (size_t)thread_count * JOBS_PER_THREAD;
+	struct batch_schedule schedule;
+
+	if (!batch_schedule(jobs, job_count, thread_count, &schedule)) {
+		return 0.0;
+	}
+
+	if (!placement_choose(policy, schedule.thread_count, &schedule.cpus)) {
+		batch_schedule_free(&schedule);
+		return 0.0;
+	}
+
+	size_t derived = 0;
+	struct timespec start;
+	struct timespec end;
+
+	clock_gettime(CLOCK_MONOTONIC, &start);
+	int const result = batch_run(&schedule, jobs, "benchmark", 9, count_password, &derived);
+	clock_gettime(CLOCK_MONOTONIC, &end);
+	batch_schedule_free(&schedule);
+
+	double const seconds = (double)(end.tv_sec - start.tv_sec) + (double)(end.tv_nsec - start.tv_nsec) / 1e9;
+	return result && derived == job_count ? (double)derived / seconds : 0.0;
+}
+
+int main(int argc, char* argv[]) {
+	enum placement_policy policy = PLACEMENT_SPREAD;
+	unsigned int rounds = DEFAULT_ROUNDS;
+
+	if (argc > 3 || (argc > 1 && !placement_parse(argv[1], &policy)) || (argc > 2 && (rounds = (unsigned int)strtoul(argv[2], NULL, 10)) == 0)) {
+		fputs("Usage: scaling [none|spread|compact] [<rounds>]\n", stderr);
+		return EXIT_FAILURE;
+	}
+
+	unsigned int const max_threads = batch_default_thread_count();
+	size_t const max_jobs = (size_t)max_threads * JOBS_PER_THREAD;
+	struct batch_job* const jobs = malloc(max_jobs * sizeof *jobs);
+	char (* const site_names)[SITE_NAME_SIZE] = malloc(max_jobs * sizeof *site_names);
+
+	if (jobs == NULL || site_names == NULL) {
+		fputs("failed to allocate memory\n", stderr);
+		free(jobs);
+		free(site_names);
+		return EXIT_FAILURE;
+	}
+
+	for (size_t i = 0; i < max_jobs; i++) {
+		snprintf(site_names[i], sizeof site_names[i], "site-%zu.example", i);
+		jobs[i].site_name = site_names[i];
+		nosepass_schema_init(&jobs[i].schema);
+		jobs[i].schema.rounds = rounds;
+	}
+
+	printf("%u rounds, %d derivations per thread, placement %s\n", rounds, JOBS_PER_THREAD, argc > 1 ? argv[1] : "spread");
+	printf("threads  derivations/s  speedup  efficiency\n");
+
+	double single = 0.0;
+	int result = EXIT_SUCCESS;
+
+	for (unsigned int threads = 1; threads <= max_threads; threads++) {
+		double const throughput = measure(jobs, policy, threads);
+
+		if (throughput == 0.0) {
+			fprintf(stderr, "batch of %u threads failed\n", threads);
+			result = EXIT_FAILURE;
+			break;
+		}
+
+		if (threads == 1) {
+			single = throughput;
+		}
+
+		printf("%7u  %13.1f  %6.2fx  %9.0f%%\n", threads, throughput, throughput / single, 100.0 * throughput / single / threads);
+	}
+
+	free(jobs);
+	free(site_names);
+	return result;
+}
@@ -0,0 +1,334 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "bcrypt/explicit_bzero.h"
+#include "checkpoint.h"
+
+#define CHECKPOINT_HEADER "nosepass-checkpoint 2 "
+#define TEMPORARY_SUFFIX ".new"
+
+/* what the check value is an HMAC of */
+#define CHECK_MESSAGE "nosepass checkpoint"
+
+/* the header, rounds, lanes, the group, the check value and both blocks in hex, the site name, and their separators and line ending */
+#define CHECKPOINT_SIZE (sizeof CHECKPOINT_HEADER + 10 + 3 + 2 * NOSEPASS_MAX_GROUP_LENGTH + 2 * CHECKPOINT_CHECK_SIZE + 4 * NOSEPASS_KEY_SIZE + CHECKPOINT_SITE_LIMIT + 7)
+
+static char const hex_digits[16] = "0123456789abcdef";
+
+__attribute__ ((nonnull))
+static void write_hex(char* const out, uint8_t const* const bytes, size_t const count) {
+	for (size_t i = 0; i < count; i++) {
+		out[2 * i] = hex_digits[bytes[i] >> 4];
+		out[2 * i + 1] = hex_digits[bytes[i] & 0xf];
+	}
+}
+
+__attribute__ ((const, warn_unused_result))
+static int hex_value(char const c) {
+	if (c >= '0' && c <= '9') {
+		return c - '0';
+	}
+
+	if (c >= 'a' && c <= 'f') {
+		return c - 'a' + 10;
+	}
+
+	return -1;
+}
+
+__attribute__ ((nonnull, warn_unused_result))
+static int read_hex(char const* const s, uint8_t* const bytes, size_t const count) {
+	for (size_t i = 0; i < count; i++) {
+		int const high = hex_value(s[2 * i]);
+		int const low = hex_value(s[2 * i + 1]);
+
+		if (high == -1 || low == -1) {
+			return 0;
+		}
+
+		bytes[i] = (uint8_t)(high << 4 | low);
+	}
+
+	return 1;
+}
+
+/*
+ * Parses a positive decimal number of at most `max` followed by a space, advancing past both.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int parse_number(char const** const p, unsigned long const max, unsigned long* const value) {
+	if (**p < '1' || **p > '9') {
+		return 0;
+	}
+
+	char* end;
+	errno = 0;
+	*value = strtoul(*p, &end, 10);
+
+	if (errno != 0 || *value > max || *end != ' ') {
+		return 0;
+	}
+
+	*p = end + 1;
+	return 1;
+}
+
+/*
+ * Parses `count` bytes in hex followed by a space, advancing past both.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int parse_hex(char const** const p, uint8_t* const bytes, size_t const count) {
+	if (strnlen(*p, 2 * count + 1) < 2 * count + 1 || !read_hex(*p, bytes, count) || (*p)[2 * count] != ' ') {
+		return 0;
+	}
+
+	*p += 2 * count + 1;
+	return 1;
+}
+
+/*
+ * Parses the contents of a checkpoint file, which are null-terminated.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int parse_checkpoint(char const* p, struct nosepass_checkpoint* const checkpoint, unsigned long* const lanes, char* const group, size_t* const group_length, uint8_t check[const CHECKPOINT_CHECK_SIZE], char const** const site_name, size_t* const site_name_length) {
+	if (strncmp(p, CHECKPOINT_HEADER, sizeof CHECKPOINT_HEADER - 1) != 0) {
+		return 0;
+	}
+
+	p += sizeof CHECKPOINT_HEADER - 1;
+
+	unsigned long rounds;
+
+	if (!parse_number(&p, UINT_MAX, &rounds) || !parse_number(&p, NOSEPASS_MAX_LANES, lanes)) {
+		return 0;
+	}
+
+	/* the group in hex, or - for none */
+	if (p[0] == '-' && p[1] == ' ') {
+		*group_length = 0;
+		p += 2;
+	} else {
+		char const* const space = strchr(p, ' ');
+
+		if (space == NULL || space == p || (size_t)(space - p) % 2 != 0 || (size_t)(space - p) > 2 * NOSEPASS_MAX_GROUP_LENGTH) {
+			return 0;
+		}
+
+		*group_length = (size_t)(space - p) / 2;
+
+		if (!parse_hex(&p, (uint8_t*)group, *group_length)) {
+			return 0;
+		}
+	}
+
+	if (!parse_hex(&p, check, CHECKPOINT_CHECK_SIZE) || !parse_hex(&p, checkpoint->out, NOSEPASS_KEY_SIZE) || !parse_hex(&p, checkpoint->tmpout, NOSEPASS_KEY_SIZE)) {
+		return 0;
+	}
+
+	char const* const newline = strchr(p, '\n');
+
+	if (newline == NULL || newline == p || newline[1] != '\0') {
+		return 0;
+	}
+
+	checkpoint->rounds = (unsigned int)rounds;
+	*site_name = p;
+	*site_name_length = (size_t)(newline - p);
+	return 1;
+}
+
+enum checkpoint_result checkpoint_load(char const* const path, char const* const site_name, struct nosepass_schema const* const schema, struct nosepass_checkpoint* const checkpoint, uint8_t check[const CHECKPOINT_CHECK_SIZE]) {
+	int const fd = open(path, O_RDONLY | O_CLOEXEC);
+
+	if (fd == -1) {
+		if (errno == ENOENT) {
+			return CHECKPOINT_NOT_FOUND;
+		}
+
+		perror("failed to open checkpoint");
+		return CHECKPOINT_ERROR;
+	}
+
+	char contents[CHECKPOINT_SIZE + 1];
+	size_t length = 0;
+
+	for (;;) {
+		ssize_t const n = read(fd, contents + length, sizeof contents - 1 - length);
+
+		if (n == -1) {
+			if (errno == EINTR) {
+				continue;
+			}
+
+			perror("failed to read checkpoint");
+			close(fd);
+			explicit_bzero(contents, sizeof contents);
+			return CHECKPOINT_ERROR;
+		}
+
+		if (n == 0 || (length += (size_t)n) == sizeof contents - 1) {
+			break;
+		}
+	}
+
+	close(fd);
+	contents[length] = '\0';
+
+	unsigned long lanes;
+	char group[NOSEPASS_MAX_GROUP_LENGTH];
+	size_t group_length;
+	char const* checkpoint_site_name;
+	size_t checkpoint_site_name_length;
+	enum checkpoint_result result = CHECKPOINT_FOUND;
+
+	if (memchr(contents, '\0', length) != NULL || !parse_checkpoint(contents, checkpoint, &lanes, group, &group_length, check, &checkpoint_site_name, &checkpoint_site_name_length)) {
+		fprintf(stderr, "malformed checkpoint file '%s'\n", path);
+		result = CHECKPOINT_ERROR;
+	} else if (checkpoint_site_name_length != strlen(site_name) || memcmp(checkpoint_site_name, site_name, checkpoint_site_name_length) != 0) {
+		fprintf(stderr, "checkpoint file '%s' is for site '%.*s'\n", path, (int)checkpoint_site_name_length, checkpoint_site_name);
+		result = CHECKPOINT_ERROR;
+	} else if (group_length != schema->group_length || memcmp(group, schema->group, group_length) != 0) {
+		fprintf(stderr, "checkpoint file '%s' is for a different group than the site’s\n", path);
+		result = CHECKPOINT_ERROR;
+	} else if (lanes != schema->lanes) {
+		fprintf(stderr, "checkpoint file '%s' is for lanes=%lu, not lanes=%u\n", path, lanes, (unsigned int)schema->lanes);
+		result = CHECKPOINT_ERROR;
+	}
+
+	explicit_bzero(contents, sizeof contents);
+
+	if (result != CHECKPOINT_FOUND) {
+		explicit_bzero(checkpoint, sizeof *checkpoint);
+		explicit_bzero(check, CHECKPOINT_CHECK_SIZE);
+	}
+
+	return result;
+}
+
+__attribute__ ((nonnull, warn_unused_result))
+static int write_all(int const fd, char const* const data, size_t const length) {
+	size_t written = 0;
+
+	while (written < length) {
+		ssize_t const n = write(fd, data + written, length - written);
+
+		if (n == -1) {
+			if (errno == EINTR) {
+				continue;
+			}
+
+			return 0;
+		}
+
+		written += (size_t)n;
+	}
+
+	return 1;
+}
+
+int checkpoint_store(char const* const path, char const* const site_name, struct nosepass_schema const* const schema, struct nosepass_checkpoint const* const checkpoint, uint8_t const check[const CHECKPOINT_CHECK_SIZE]) {
+	size_t const site_name_length = strlen(site_name);
+
+	if (site_name_length > CHECKPOINT_SITE_LIMIT || strchr(site_name, '\n') != NULL) {
+		fputs("site name can’t be stored in a checkpoint\n", stderr);
+		return 0;
+	}
+
+	char contents[CHECKPOINT_SIZE];
+	int length = snprintf(contents, sizeof contents, CHECKPOINT_HEADER "%u %u ", checkpoint->rounds, (unsigned int)schema->lanes);
+
+	if (schema->group_length == 0) {
+		contents[length++] = '-';
+	} else {
+		write_hex(contents + length, (uint8_t const*)schema->group, schema->group_length);
+		length += 2 * schema->group_length;
+	}
+
+	contents[length++] = ' ';
+	write_hex(contents + length, check, CHECKPOINT_CHECK_SIZE);
+	length += 2 * CHECKPOINT_CHECK_SIZE;
+	contents[length++] = ' ';
+	write_hex(contents + length, checkpoint->out, NOSEPASS_KEY_SIZE);
+	length += 2 * NOSEPASS_KEY_SIZE;
+	contents[length++] = ' ';
+	write_hex(contents + length, checkpoint->tmpout, NOSEPASS_KEY_SIZE);
+	length += 2 * NOSEPASS_KEY_SIZE;
+	contents[length++] = ' ';
+	memcpy(contents + length, site_name, site_name_length);
+	length += (int)site_name_length;
+	contents[length++] = '\n';
+
+	size_t const path_length = strlen(path);
+	char* const temporary_path = malloc(path_length + sizeof TEMPORARY_SUFFIX);
+
+	if (temporary_path == NULL) {
+		fputs("failed to allocate memory\n", stderr);
+		explicit_bzero(contents, sizeof contents);
+		return 0;
+	}
+
+	memcpy(temporary_path, path, path_length);
+	memcpy(temporary_path + path_length, TEMPORARY_SUFFIX, sizeof TEMPORARY_SUFFIX);
+
+	/* a leftover temporary file might have looser permissions */
+	if (unlink(temporary_path) == -1 && errno != ENOENT) {
+		perror("failed to remove old temporary checkpoint");
+		free(temporary_path);
+		explicit_bzero(contents, sizeof contents);
+		return 0;
+	}
+
+	int const fd = open(temporary_path, O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0600);
+
+	if (fd == -1) {
+		perror("failed to create checkpoint");
+		free(temporary_path);
+		explicit_bzero(contents, sizeof contents);
+		return 0;
+	}
+
+	int stored = write_all(fd, contents, (size_t)length) && fsync(fd) == 0;
+	explicit_bzero(contents, sizeof contents);
+
+	if (close(fd) != 0) {
+		stored = 0;
+	}
+
+	if (!stored || rename(temporary_path, path) != 0) {
+		perror("failed to write checkpoint");
+		unlink(temporary_path);
+		stored = 0;
+	}
+
+	free(temporary_path);
+	return stored;
+}
+
+enum nosepass_status checkpoint_check(struct nosepass_derivation* const derivation, uint8_t key[const NOSEPASS_KEY_SIZE], uint8_t check[const CHECKPOINT_CHECK_SIZE]) {
+	enum nosepass_status const status = nosepass_derivation_extend(derivation, nosepass_derivation_completed(derivation) + 1);
+
+	if (status != NOSEPASS_OK) {
+		return status;
+	}
+
+	while (nosepass_derivation_step(derivation, UINT_MAX)) {}
+
+	/* an HMAC of the message, keyed with the site key */
+	return nosepass_expand_key(key, CHECK_MESSAGE, sizeof CHECK_MESSAGE - 1, check);
+}
+
+int checkpoint_check_matches(uint8_t const expected[const CHECKPOINT_CHECK_SIZE], uint8_t const check[const CHECKPOINT_CHECK_SIZE]) {
+	uint8_t difference = 0;
+
+	for (size_t i = 0; i < CHECKPOINT_CHECK_SIZE; i++) {
+		difference |= expected[i] ^ check[i];
+	}
+
+	return difference == 0;
+}
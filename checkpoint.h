@@ -0,0 +1,46 @@
+#ifndef CHECKPOINT_H
+#define CHECKPOINT_H
+
+#include "nosepass.h"
+
+/* The longest site name a checkpoint file can hold. */
+#define CHECKPOINT_SITE_LIMIT 1022
+
+#define CHECKPOINT_CHECK_SIZE 32
+
+enum checkpoint_result {
+	CHECKPOINT_ERROR,
+	CHECKPOINT_NOT_FOUND,
+	CHECKPOINT_FOUND,
+};
+
+/*
+ * Reads a site’s checkpoint and its check value from a file written by checkpoint_store, reporting problems, including
+ * a checkpoint for another site, or for another group or number of lanes than the schema’s.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+enum checkpoint_result checkpoint_load(char const* path, char const* site_name, struct nosepass_schema const* schema, struct nosepass_checkpoint* checkpoint, uint8_t check[CHECKPOINT_CHECK_SIZE]);
+
+/*
+ * Replaces a checkpoint file atomically with a site’s checkpoint, the schema’s group and lanes, and the check value,
+ * readable only by the user.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+int checkpoint_store(char const* path, char const* site_name, struct nosepass_schema const* schema, struct nosepass_checkpoint const* checkpoint, uint8_t const check[CHECKPOINT_CHECK_SIZE]);
+
+/*
+ * Runs a derivation one round past the rounds it has completed, and gets the check value of a checkpoint at those
+ * rounds: HMAC-SHA-512 of a fixed string, truncated, keyed with the key that round gives. The round needs the master
+ * password, so a check value tells a mistyped one from the right one, for the cost of the round a resumed derivation
+ * would run next anyway.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+enum nosepass_status checkpoint_check(struct nosepass_derivation* derivation, uint8_t key[NOSEPASS_KEY_SIZE], uint8_t check[CHECKPOINT_CHECK_SIZE]);
+
+/*
+ * Compares two check values in constant time.
+ */
+__attribute__ ((nonnull, pure, warn_unused_result))
+int checkpoint_check_matches(uint8_t const expected[CHECKPOINT_CHECK_SIZE], uint8_t const check[CHECKPOINT_CHECK_SIZE]);
+
+#endif
@@ -0,0 +1,421 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <math.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "histogram.h"
+
+#define SNAPSHOT_HEADER "nosepass-histograms 1"
+#define TEMPORARY_SUFFIX ".new"
+
+/* values below SUB_BUCKET_COUNT get a bucket each; each doubling above that is split into SUB_BUCKET_HALF buckets */
+#define SUB_BUCKET_BITS 7
+#define SUB_BUCKET_COUNT (1u << SUB_BUCKET_BITS)
+#define SUB_BUCKET_HALF (SUB_BUCKET_COUNT / 2)
+#define VALUE_BITS 44
+#define BUCKET_COUNT (SUB_BUCKET_COUNT + (VALUE_BITS - SUB_BUCKET_BITS) * SUB_BUCKET_HALF)
+
+#define MAX_VALUE ((UINT64_C(1) << VALUE_BITS) - 1)
+
+/*
+ * A histogram’s count is its buckets’ total, so that a snapshot taken while it’s recorded to is consistent.
+ */
+struct histogram {
+	_Atomic uint64_t sum;
+	_Atomic uint64_t max;
+	_Atomic uint64_t buckets[BUCKET_COUNT];
+};
+
+struct tier {
+	/* 0 until the tier is claimed for a rounds value */
+	atomic_uint rounds;
+	struct histogram histograms[HISTOGRAM_KIND_COUNT];
+};
+
+struct histograms {
+	struct tier tiers[HISTOGRAM_TIERS];
+
+	/* every rounds value after the tiers are all claimed */
+	struct tier other;
+};
+
+static char const* const kind_names[HISTOGRAM_KIND_COUNT] = {
+	[HISTOGRAM_REQUEST] = "request",
+	[HISTOGRAM_KDF] = "kdf",
+};
+
+__attribute__ ((const, warn_unused_result))
+static unsigned int bucket_index(uint64_t value) {
+	if (value > MAX_VALUE) {
+		value = MAX_VALUE;
+	}
+
+	if (value < SUB_BUCKET_COUNT) {
+		return (unsigned int)value;
+	}
+
+	/* the shift that brings the value into the upper half of the sub-buckets */
+	unsigned int const shift = (unsigned int)(63 - __builtin_clzll(value)) - (SUB_BUCKET_BITS - 1);
+	return SUB_BUCKET_COUNT + (shift - 1) * SUB_BUCKET_HALF + (unsigned int)(value >> shift) - SUB_BUCKET_HALF;
+}
+
+/*
+ * Gets the highest value that falls in a bucket.
+ */
+__attribute__ ((const, warn_unused_result))
+static uint64_t bucket_highest(unsigned int const index) {
+	if (index < SUB_BUCKET_COUNT) {
+		return index;
+	}
+
+	unsigned int const shift = (index - SUB_BUCKET_COUNT) / SUB_BUCKET_HALF + 1;
+	uint64_t const sub_bucket = (index - SUB_BUCKET_COUNT) % SUB_BUCKET_HALF + SUB_BUCKET_HALF;
+	return ((sub_bucket + 1) << shift) - 1;
+}
+
+struct histograms* histograms_create(void) {
+	struct histograms* const histograms = calloc(1, sizeof *histograms);
+
+	if (histograms == NULL) {
+		fputs("failed to allocate memory\n", stderr);
+	}
+
+	return histograms;
+}
+
+/*
+ * Finds the tier for a rounds value, claiming a free one for it if there is one.
+ */
+__attribute__ ((nonnull, returns_nonnull, warn_unused_result))
+static struct tier* find_tier(struct histograms* const histograms, unsigned int const rounds) {
+	for (size_t i = 0; i < HISTOGRAM_TIERS && rounds != 0; i++) {
+		struct tier* const tier = &histograms->tiers[i];
+		unsigned int claimed = atomic_load_explicit(&tier->rounds, memory_order_acquire);
+
+		if (claimed == 0 && atomic_compare_exchange_strong_explicit(&tier->rounds, &claimed, rounds, memory_order_acq_rel, memory_order_acquire)) {
+			return tier;
+		}
+
+		/* either already this value’s, or just claimed by another thread, possibly for this value */
+		if (claimed == rounds) {
+			return tier;
+		}
+	}
+
+	return &histograms->other;
+}
+
+/*
+ * Adds `count` values in a bucket, with a sum and maximum, to a histogram.
+ */
+__attribute__ ((nonnull))
+static void add_to_histogram(struct histogram* const histogram, unsigned int const index, uint64_t const count, uint64_t const sum, uint64_t const max) {
+	atomic_fetch_add_explicit(&histogram->buckets[index], count, memory_order_relaxed);
+	atomic_fetch_add_explicit(&histogram->sum, sum, memory_order_relaxed);
+
+	uint64_t previous = atomic_load_explicit(&histogram->max, memory_order_relaxed);
+
+	while (previous < max && !atomic_compare_exchange_weak_explicit(&histogram->max, &previous, max, memory_order_relaxed, memory_order_relaxed)) {}
+}
+
+void histograms_record(struct histograms* const histograms, unsigned int const rounds, enum histogram_kind const kind, uint64_t const latency) {
+	add_to_histogram(&find_tier(histograms, rounds)->histograms[kind], bucket_index(latency), 1, latency, latency);
+}
+
+/*
+ * Reads a histogram’s buckets into a plain copy, since recording may go on while a table or snapshot is written.
+ */
+__attribute__ ((nonnull))
+static uint64_t load_buckets(struct histogram const* const histogram, uint64_t buckets[const BUCKET_COUNT]) {
+	uint64_t count = 0;
+
+	for (unsigned int i = 0; i < BUCKET_COUNT; i++) {
+		buckets[i] = atomic_load_explicit(&histogram->buckets[i], memory_order_relaxed);
+		count += buckets[i];
+	}
+
+	return count;
+}
+
+/*
+ * Gets the value at a percentile, as the highest value in its bucket, but no more than the maximum.
+ */
+__attribute__ ((nonnull, pure, warn_unused_result))
+static uint64_t percentile(uint64_t const buckets[const BUCKET_COUNT], uint64_t const count, uint64_t const max, double const p) {
+	double const rank = ceil(p / 100.0 * (double)count);
+	uint64_t const target = rank < 1.0 ? 1 : (uint64_t)rank;
+	uint64_t seen = 0;
+
+	for (unsigned int i = 0; i < BUCKET_COUNT; i++) {
+		seen += buckets[i];
+
+		if (seen >= target) {
+			uint64_t const highest = bucket_highest(i);
+			return highest < max ? highest : max;
+		}
+	}
+
+	return max;
+}
+
+__attribute__ ((nonnull, pure, warn_unused_result))
+static int compare_tiers(void const* const a, void const* const b) {
+	unsigned int const x = atomic_load_explicit(&(*(struct tier const* const*)a)->rounds, memory_order_relaxed);
+	unsigned int const y = atomic_load_explicit(&(*(struct tier const* const*)b)->rounds, memory_order_relaxed);
+	return (x > y) - (x < y);
+}
+
+/*
+ * Lists the claimed tiers in order of rounds, followed by the shared one, returning how many there are.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static size_t sorted_tiers(struct histograms const* const histograms, struct tier const* tiers[const HISTOGRAM_TIERS + 1]) {
+	size_t count = 0;
+
+	for (size_t i = 0; i < HISTOGRAM_TIERS; i++) {
+		if (atomic_load_explicit(&histograms->tiers[i].rounds, memory_order_acquire) != 0) {
+			tiers[count++] = &histograms->tiers[i];
+		}
+	}
+
+	qsort(tiers, count, sizeof *tiers, compare_tiers);
+	tiers[count++] = &histograms->other;
+	return count;
+}
+
+__attribute__ ((const, warn_unused_result))
+static double to_ms(uint64_t const ns) {
+	return (double)ns / 1e6;
+}
+
+void histograms_print(struct histograms const* const histograms, FILE* const output) {
+	static double const percentiles[] = {50.0, 90.0, 99.0, 99.9};
+	struct tier const* tiers[HISTOGRAM_TIERS + 1];
+	size_t const tier_count = sorted_tiers(histograms, tiers);
+	uint64_t buckets[BUCKET_COUNT];
+
+	fputs("    rounds  latency       count       p50 ms       p90 ms       p99 ms     p99.9 ms       max ms      mean ms\n", output);
+
+	for (size_t t = 0; t < tier_count; t++) {
+		char rounds[16];
+
+		if (tiers[t] == &histograms->other) {
+			strcpy(rounds, "other");
+		} else {
+			snprintf(rounds, sizeof rounds, "%u", atomic_load_explicit(&tiers[t]->rounds, memory_order_relaxed));
+		}
+
+		for (int kind = 0; kind < HISTOGRAM_KIND_COUNT; kind++) {
+			struct histogram const* const histogram = &tiers[t]->histograms[kind];
+			uint64_t const count = load_buckets(histogram, buckets);
+
+			if (count == 0) {
+				continue;
+			}
+
+			uint64_t const max = atomic_load_explicit(&histogram->max, memory_order_relaxed);
+			uint64_t const sum = atomic_load_explicit(&histogram->sum, memory_order_relaxed);
+
+			fprintf(output, "%10s  %-7s  %10" PRIu64, rounds, kind_names[kind], count);
+
+			for (size_t i = 0; i < sizeof percentiles / sizeof percentiles[0]; i++) {
+				fprintf(output, "  %11.3f", to_ms(percentile(buckets, count, max, percentiles[i])));
+			}
+
+			fprintf(output, "  %11.3f  %11.3f\n", to_ms(max), to_ms(sum) / (double)count);
+		}
+	}
+}
+
+int histograms_save(struct histograms const* const histograms, char const* const path) {
+	size_t const path_length = strlen(path);
+	char* const temporary_path = malloc(path_length + sizeof TEMPORARY_SUFFIX);
+
+	if (temporary_path == NULL) {
+		fputs("failed to allocate memory\n", stderr);
+		return 0;
+	}
+
+	memcpy(temporary_path, path, path_length);
+	memcpy(temporary_path + path_length, TEMPORARY_SUFFIX, sizeof TEMPORARY_SUFFIX);
+
+	if (unlink(temporary_path) == -1 && errno != ENOENT) {
+		perror("failed to remove old temporary histogram snapshot");
+		free(temporary_path);
+		return 0;
+	}
+
+	int const fd = open(temporary_path, O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0600);
+	FILE* const file = fd == -1 ? NULL : fdopen(fd, "w");
+
+	if (file == NULL) {
+		perror("failed to create histogram snapshot");
+
+		if (fd != -1) {
+			close(fd);
+			unlink(temporary_path);
+		}
+
+		free(temporary_path);
+		return 0;
+	}
+
+	struct tier const* tiers[HISTOGRAM_TIERS + 1];
+	size_t const tier_count = sorted_tiers(histograms, tiers);
+	uint64_t buckets[BUCKET_COUNT];
+
+	/* one line for each histogram with anything in it, listing only its buckets with anything in them */
+	int stored = fprintf(file, SNAPSHOT_HEADER " %d %d\n", SUB_BUCKET_BITS, VALUE_BITS) > 0;
+
+	for (size_t t = 0; stored && t < tier_count; t++) {
+		for (int kind = 0; stored && kind < HISTOGRAM_KIND_COUNT; kind++) {
+			struct histogram const* const histogram = &tiers[t]->histograms[kind];
+
+			uint64_t const count = load_buckets(histogram, buckets);
+
+			if (count == 0) {
+				continue;
+			}
+
+			if (tiers[t] == &histograms->other) {
+				stored = fputs("other", file) != EOF;
+			} else {
+				stored = fprintf(file, "%u", atomic_load_explicit(&tiers[t]->rounds, memory_order_relaxed)) > 0;
+			}
+
+			stored = stored && fprintf(file, " %s %" PRIu64 " %" PRIu64 " %" PRIu64, kind_names[kind], count, atomic_load_explicit(&histogram->sum, memory_order_relaxed), atomic_load_explicit(&histogram->max, memory_order_relaxed)) > 0;
+
+			for (unsigned int i = 0; stored && i < BUCKET_COUNT; i++) {
+				if (buckets[i] != 0) {
+					stored = fprintf(file, " %u:%" PRIu64, i, buckets[i]) > 0;
+				}
+			}
+
+			stored = stored && putc('\n', file) != EOF;
+		}
+	}
+
+	stored = stored && fflush(file) == 0 && fsync(fd) == 0;
+
+	if (fclose(file) != 0) {
+		stored = 0;
+	}
+
+	if (!stored || rename(temporary_path, path) != 0) {
+		perror("failed to write histogram snapshot");
+		unlink(temporary_path);
+		stored = 0;
+	}
+
+	free(temporary_path);
+	return stored;
+}
+
+/*
+ * Reads a snapshot’s histogram lines into the histograms, or, if they’re NULL, only checks that they’re valid.
+ */
+__attribute__ ((nonnull (2), warn_unused_result))
+static int merge_lines(struct histograms* const histograms, FILE* const file) {
+	char tier_name[16];
+	char kind_name[16];
+	uint64_t count;
+	uint64_t sum;
+	uint64_t max;
+	int fields;
+
+	while ((fields = fscanf(file, "%15s %15s %" SCNu64 " %" SCNu64 " %" SCNu64, tier_name, kind_name, &count, &sum, &max)) == 5) {
+		struct tier* tier = NULL;
+		int kind = 0;
+
+		if (strcmp(tier_name, "other") == 0) {
+			if (histograms != NULL) {
+				tier = &histograms->other;
+			}
+		} else {
+			char* end;
+			errno = 0;
+			unsigned long const rounds = strtoul(tier_name, &end, 10);
+
+			if (errno != 0 || *end != '\0' || rounds == 0 || rounds > UINT32_MAX) {
+				return 0;
+			}
+
+			if (histograms != NULL) {
+				tier = find_tier(histograms, (unsigned int)rounds);
+			}
+		}
+
+		while (kind < HISTOGRAM_KIND_COUNT && strcmp(kind_name, kind_names[kind]) != 0) {
+			kind++;
+		}
+
+		if (kind == HISTOGRAM_KIND_COUNT) {
+			return 0;
+		}
+
+		struct histogram* const histogram = tier != NULL ? &tier->histograms[kind] : NULL;
+		uint64_t bucketed = 0;
+		int c;
+
+		/* the sum and maximum go with the first bucket */
+		while ((c = getc(file)) == ' ') {
+			unsigned int index;
+			uint64_t bucket_count;
+
+			if (fscanf(file, "%u:%" SCNu64, &index, &bucket_count) != 2 || index >= BUCKET_COUNT) {
+				return 0;
+			}
+
+			if (histogram != NULL) {
+				add_to_histogram(histogram, index, bucket_count, bucketed == 0 ? sum : 0, bucketed == 0 ? max : 0);
+			}
+
+			bucketed += bucket_count;
+		}
+
+		if (c != '\n' || bucketed != count) {
+			return 0;
+		}
+	}
+
+	return fields == EOF && !ferror(file);
+}
+
+int histograms_merge(struct histograms* const histograms, char const* const path) {
+	FILE* const file = fopen(path, "r");
+
+	if (file == NULL) {
+		fprintf(stderr, "failed to open histogram snapshot %s: %s\n", path, strerror(errno));
+		return 0;
+	}
+
+	int sub_bucket_bits;
+	int value_bits;
+	int const valid = fscanf(file, SNAPSHOT_HEADER " %d %d", &sub_bucket_bits, &value_bits) == 2 && getc(file) == '\n';
+
+	if (!valid || sub_bucket_bits != SUB_BUCKET_BITS || value_bits != VALUE_BITS) {
+		fprintf(stderr, "%s isn’t a histogram snapshot this version can read\n", path);
+		fclose(file);
+		return 0;
+	}
+
+	/* checked in full before any of it is added, so that an invalid snapshot leaves the histograms as they were */
+	long const lines_start = ftell(file);
+	int const merged = lines_start != -1 && merge_lines(NULL, file) && fseek(file, lines_start, SEEK_SET) == 0 && merge_lines(histograms, file);
+	fclose(file);
+
+	if (!merged) {
+		fprintf(stderr, "invalid histogram snapshot %s\n", path);
+	}
+
+	return merged;
+}
+
+void histograms_destroy(struct histograms* const histograms) {
+	free(histograms);
+}
@@ -0,0 +1,54 @@
+#include <stdint.h>
+#include <stdio.h>
+
+/* the number of distinct rounds values with histograms of their own; any more share one */
+#define HISTOGRAM_TIERS 16
+
+enum histogram_kind {
+	/* from a request’s arrival to its response */
+	HISTOGRAM_REQUEST,
+
+	/* the key derivation alone, when it isn’t skipped by the cache */
+	HISTOGRAM_KDF,
+
+	HISTOGRAM_KIND_COUNT,
+};
+
+/*
+ * Latency histograms for each tier of schemas, grouped by rounds. Buckets are log-linear, as in HdrHistogram: exact
+ * to the nanosecond below 128 ns, and within 1/64 (under 1.6%) of the value above that, up to about 4.9 hours.
+ * Recording is a few relaxed atomic additions, with no lock, so any number of threads can record at once, and a
+ * snapshot can be taken while they do.
+ */
+struct histograms;
+
+__attribute__ ((warn_unused_result))
+struct histograms* histograms_create(void);
+
+/*
+ * Adds a latency, in nanoseconds, to the histogram of a kind for a rounds value.
+ */
+__attribute__ ((nonnull))
+void histograms_record(struct histograms* histograms, unsigned int rounds, enum histogram_kind kind, uint64_t latency);
+
+/*
+ * Writes a table of each histogram’s count, percentiles, maximum and mean, in milliseconds.
+ */
+__attribute__ ((nonnull))
+void histograms_print(struct histograms const* histograms, FILE* output);
+
+/*
+ * Replaces a file atomically with a snapshot of the histograms, readable only by the user, which histograms_merge can
+ * add to others.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+int histograms_save(struct histograms const* histograms, char const* path);
+
+/*
+ * Adds the histograms in a snapshot file to these, or reports the problem with it and leaves them unchanged.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+int histograms_merge(struct histograms* histograms, char const* path);
+
+__attribute__ ((nonnull))
+void histograms_destroy(struct histograms* histograms);
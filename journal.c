@@ -0,0 +1,444 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/file.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "journal.h"
+#include "nosepass.h"
+
+#define JOURNAL_HEADER "nosepass-journal 2 "
+#define JOURNAL_SUFFIX ".journal"
+
+/* the verifier’s salt, before the site list’s hash */
+#define VERIFIER_SALT "nosepass journal"
+
+/* the header, the site count, the site list’s hash, the verifier’s rounds, the verifier in hex, and their separators and line ending */
+#define HEADER_SIZE (sizeof JOURNAL_HEADER + 20 + 16 + 10 + 2 * NOSEPASS_KEY_SIZE + 4)
+
+static char const hex_digits[16] = "0123456789abcdef";
+
+/*
+ * Identifies a list of sites by a 64-bit FNV-1a hash of its names, so that a journal isn’t resumed against a different
+ * list.
+ */
+__attribute__ ((nonnull, pure, warn_unused_result))
+static uint64_t hash_site_list(char const* const* const site_names, size_t const site_count) {
+	uint64_t hash = UINT64_C(0xcbf29ce484222325);
+
+	for (size_t i = 0; i < site_count; i++) {
+		for (char const* p = site_names[i]; *p != '\0'; p++) {
+			hash = (hash ^ (unsigned char)*p) * UINT64_C(0x100000001b3);
+		}
+
+		hash = (hash ^ '\n') * UINT64_C(0x100000001b3);
+	}
+
+	return hash;
+}
+
+/*
+ * Derives a journal’s verifier, a key from the master password with the site list’s hash in the salt, and writes it in
+ * hex.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int derive_verifier(char const* const master_password, size_t const master_password_length, uint64_t const list_hash, unsigned int const rounds, char hex[const 2 * NOSEPASS_KEY_SIZE]) {
+	char salt[sizeof VERIFIER_SALT + 16 + 1];
+	int const salt_length = snprintf(salt, sizeof salt, VERIFIER_SALT "%c%016" PRIx64, '\0', list_hash);
+	uint8_t verifier[NOSEPASS_KEY_SIZE];
+	enum nosepass_status const status = nosepass_derive_key(master_password, master_password_length, salt, (size_t)salt_length, rounds, verifier);
+
+	if (status != NOSEPASS_OK) {
+		fprintf(stderr, "failed to derive the journal’s verifier: %s\n", nosepass_strerror(status));
+		return 0;
+	}
+
+	for (size_t i = 0; i < NOSEPASS_KEY_SIZE; i++) {
+		hex[2 * i] = hex_digits[verifier[i] >> 4];
+		hex[2 * i + 1] = hex_digits[verifier[i] & 0xf];
+	}
+
+	return 1;
+}
+
+__attribute__ ((nonnull, warn_unused_result))
+static int write_all(int const fd, char const* const data, size_t const length) {
+	size_t written = 0;
+
+	while (written < length) {
+		ssize_t const n = write(fd, data + written, length - written);
+
+		if (n == -1) {
+			if (errno == EINTR) {
+				continue;
+			}
+
+			return 0;
+		}
+
+		written += (size_t)n;
+	}
+
+	return 1;
+}
+
+/*
+ * Parses an unsigned decimal number ending with a given character, advancing past it.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int parse_number(char const** const p, char const* const end, char const terminator, uint64_t* const value) {
+	char const* s = *p;
+	uint64_t n = 0;
+
+	if (s == end || *s < '0' || *s > '9') {
+		return 0;
+	}
+
+	for (; s != end && *s >= '0' && *s <= '9'; s++) {
+		if (n > (UINT64_MAX - 9) / 10) {
+			return 0;
+		}
+
+		n = n * 10 + (uint64_t)(*s - '0');
+	}
+
+	if (s == end || *s != terminator) {
+		return 0;
+	}
+
+	*p = s + 1;
+	*value = n;
+	return 1;
+}
+
+/*
+ * Keeps another batch from writing to the same output while this one runs.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int lock_journal(struct journal const* const journal) {
+	if (flock(journal->fd, LOCK_EX | LOCK_NB) != 0) {
+		if (errno == EWOULDBLOCK) {
+			fprintf(stderr, "journal '%s' is in use by another batch\n", journal->path);
+		} else {
+			perror("failed to lock journal");
+		}
+
+		return 0;
+	}
+
+	return 1;
+}
+
+/*
+ * Reads a journal’s records, stopping at the first incomplete or malformed one, which is what a crash in the middle of
+ * an append leaves behind. Returns the length of the valid part.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static size_t replay(struct journal* const journal, char const* const contents, size_t const length, size_t const header_length) {
+	char const* p = contents + header_length;
+	char const* const end = contents + length;
+	char const* valid_end = p;
+
+	while (p != end) {
+		uint64_t index;
+		uint64_t offset;
+
+		if (!parse_number(&p, end, ' ', &index) || !parse_number(&p, end, '\n', &offset) || index >= journal->site_count || offset < journal->offset || journal->completed[index]) {
+			break;
+		}
+
+		journal->completed[index] = 1;
+		journal->completed_count++;
+		journal->offset = offset;
+		valid_end = p;
+	}
+
+	return (size_t)(valid_end - contents);
+}
+
+/*
+ * Reads an existing journal, checks that it’s for the same list of sites and master password, and truncates it and the
+ * output to the last complete record. `header` is the start of the header, which identifies the list.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int resume_journal(struct journal* const journal, char const* const output_path, char const* const header, size_t const list_header_length, char const* const master_password, size_t const master_password_length, uint64_t const list_hash) {
+	if ((journal->fd = open(journal->path, O_RDWR | O_CLOEXEC)) == -1) {
+		if (errno == ENOENT) {
+			fprintf(stderr, "no journal to resume at '%s'\n", journal->path);
+		} else {
+			perror("failed to open journal");
+		}
+
+		return 0;
+	}
+
+	if (!lock_journal(journal)) {
+		return 0;
+	}
+
+	struct stat status;
+
+	if (fstat(journal->fd, &status) != 0) {
+		perror("failed to read journal");
+		return 0;
+	}
+
+	size_t const length = (size_t)status.st_size;
+	char* const contents = malloc(length + 1);
+
+	if (contents == NULL) {
+		fputs("failed to allocate memory\n", stderr);
+		return 0;
+	}
+
+	size_t read_length = 0;
+
+	while (read_length < length) {
+		ssize_t const n = read(journal->fd, contents + read_length, length - read_length);
+
+		if (n == -1 && errno == EINTR) {
+			continue;
+		}
+
+		if (n <= 0) {
+			perror("failed to read journal");
+			free(contents);
+			return 0;
+		}
+
+		read_length += (size_t)n;
+	}
+
+	if (length < list_header_length || memcmp(contents, header, list_header_length) != 0) {
+		fprintf(stderr, "journal '%s' is for a different list of sites\n", journal->path);
+		free(contents);
+		return 0;
+	}
+
+	char const* p = contents + list_header_length;
+	uint64_t rounds;
+	char verifier[2 * NOSEPASS_KEY_SIZE];
+
+	if (!parse_number(&p, contents + length, ' ', &rounds) || rounds == 0 || rounds > UINT_MAX || (size_t)(contents + length - p) < sizeof verifier + 1 || p[sizeof verifier] != '\n') {
+		fprintf(stderr, "malformed journal '%s'\n", journal->path);
+		free(contents);
+		return 0;
+	}
+
+	if (!derive_verifier(master_password, master_password_length, list_hash, (unsigned int)rounds, verifier)) {
+		free(contents);
+		return 0;
+	}
+
+	/* a mistyped master password would add wrong passwords to the right ones */
+	if (memcmp(p, verifier, sizeof verifier) != 0) {
+		fprintf(stderr, "the master password doesn’t match journal '%s'\n", journal->path);
+		free(contents);
+		return 0;
+	}
+
+	size_t const header_length = (size_t)(p + sizeof verifier + 1 - contents);
+	size_t const valid_length = replay(journal, contents, length, header_length);
+	free(contents);
+
+	if (valid_length != length && (ftruncate(journal->fd, (off_t)valid_length) != 0 || fsync(journal->fd) != 0)) {
+		perror("failed to truncate journal");
+		return 0;
+	}
+
+	if (lseek(journal->fd, 0, SEEK_END) == -1) {
+		perror("failed to seek journal");
+		return 0;
+	}
+
+	if ((journal->output_fd = open(output_path, O_WRONLY | O_CLOEXEC)) == -1) {
+		perror("failed to open output");
+		return 0;
+	}
+
+	if (fstat(journal->output_fd, &status) != 0) {
+		perror("failed to read output");
+		return 0;
+	}
+
+	if ((uint64_t)status.st_size < journal->offset) {
+		fprintf(stderr, "output '%s' is shorter than its journal records\n", output_path);
+		return 0;
+	}
+
+	if (ftruncate(journal->output_fd, (off_t)journal->offset) != 0 || lseek(journal->output_fd, 0, SEEK_END) == -1) {
+		perror("failed to truncate output");
+		return 0;
+	}
+
+	return 1;
+}
+
+/*
+ * Replaces any journal with an empty one for this list of sites, and truncates the output.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int create_journal(struct journal* const journal, char const* const output_path, char const* const header, size_t const header_length) {
+	/* an old journal is locked before anything is truncated, in case its batch is still running */
+	if ((journal->fd = open(journal->path, O_WRONLY | O_CREAT | O_CLOEXEC, 0600)) == -1) {
+		perror("failed to create journal");
+		return 0;
+	}
+
+	if (!lock_journal(journal)) {
+		return 0;
+	}
+
+	if (fchmod(journal->fd, 0600) != 0 || ftruncate(journal->fd, 0) != 0) {
+		perror("failed to create journal");
+		return 0;
+	}
+
+	if ((journal->output_fd = open(output_path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0600)) == -1) {
+		perror("failed to create output");
+		return 0;
+	}
+
+	if (!write_all(journal->fd, header, header_length) || fsync(journal->fd) != 0) {
+		perror("failed to write journal");
+		return 0;
+	}
+
+	return 1;
+}
+
+int journal_open(struct journal* const journal, char const* const output_path, char const* const* const site_names, size_t const site_count, char const* const master_password, size_t const master_password_length, unsigned int const rounds, int const resume) {
+	size_t const output_path_length = strlen(output_path);
+
+	journal->fd = -1;
+	journal->output_fd = -1;
+	journal->offset = 0;
+	journal->completed_count = 0;
+	journal->site_count = site_count;
+	journal->pending_length = 0;
+	journal->pending_count = 0;
+	clock_gettime(CLOCK_MONOTONIC, &journal->last_sync);
+
+	journal->path = malloc(output_path_length + sizeof JOURNAL_SUFFIX);
+	journal->completed = calloc(site_count != 0 ? site_count : 1, sizeof *journal->completed);
+
+	if (journal->path == NULL || journal->completed == NULL) {
+		fputs("failed to allocate memory\n", stderr);
+		free(journal->path);
+		free(journal->completed);
+		return 0;
+	}
+
+	memcpy(journal->path, output_path, output_path_length);
+	memcpy(journal->path + output_path_length, JOURNAL_SUFFIX, sizeof JOURNAL_SUFFIX);
+
+	uint64_t const list_hash = hash_site_list(site_names, site_count);
+	char header[HEADER_SIZE];
+	int header_length = snprintf(header, sizeof header, JOURNAL_HEADER "%zu %016" PRIx64 " ", site_count, list_hash);
+	int opened;
+
+	if (resume) {
+		opened = resume_journal(journal, output_path, header, (size_t)header_length, master_password, master_password_length, list_hash);
+	} else {
+		header_length += snprintf(header + header_length, sizeof header - (size_t)header_length, "%u ", rounds);
+		opened = derive_verifier(master_password, master_password_length, list_hash, rounds, header + header_length);
+		header_length += 2 * NOSEPASS_KEY_SIZE;
+		header[header_length++] = '\n';
+		opened = opened && create_journal(journal, output_path, header, (size_t)header_length);
+	}
+
+	if (!opened) {
+		if (journal->fd != -1) {
+			close(journal->fd);
+		}
+
+		if (journal->output_fd != -1) {
+			close(journal->output_fd);
+		}
+
+		free(journal->path);
+		free(journal->completed);
+		return 0;
+	}
+
+	return 1;
+}
+
+int journal_is_completed(struct journal const* const journal, size_t const index) {
+	return journal->completed[index];
+}
+
+/*
+ * Makes the output durable, then the records describing it, so that a record never refers to output a crash could
+ * lose.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int journal_sync(struct journal* const journal) {
+	if (journal->pending_count == 0) {
+		return 1;
+	}
+
+	if (fsync(journal->output_fd) != 0) {
+		perror("failed to write output");
+		return 0;
+	}
+
+	if (!write_all(journal->fd, journal->pending, journal->pending_length) || fsync(journal->fd) != 0) {
+		perror("failed to write journal");
+		return 0;
+	}
+
+	journal->pending_length = 0;
+	journal->pending_count = 0;
+	clock_gettime(CLOCK_MONOTONIC, &journal->last_sync);
+	return 1;
+}
+
+int journal_append(struct journal* const journal, size_t const index, char const* const line, size_t const length) {
+	if (!write_all(journal->output_fd, line, length)) {
+		perror("failed to write output");
+		return 0;
+	}
+
+	journal->offset += length;
+	journal->completed[index] = 1;
+	journal->completed_count++;
+
+	journal->pending_length += (size_t)snprintf(journal->pending + journal->pending_length, JOURNAL_RECORD_SIZE + 1, "%zu %" PRIu64 "\n", index, journal->offset);
+	journal->pending_count++;
+
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	if (journal->pending_count == JOURNAL_SYNC_LINES || now.tv_sec - journal->last_sync.tv_sec >= JOURNAL_SYNC_SECONDS) {
+		return journal_sync(journal);
+	}
+
+	return 1;
+}
+
+int journal_close(struct journal* const journal, int const finished) {
+	int result = journal_sync(journal);
+
+	if (close(journal->output_fd) != 0) {
+		perror("failed to write output");
+		result = 0;
+	}
+
+	/* removed while still locked, so that no other batch can have opened it */
+	if (result && finished && unlink(journal->path) != 0) {
+		perror("failed to remove journal");
+		result = 0;
+	}
+
+	close(journal->fd);
+
+	free(journal->path);
+	free(journal->completed);
+	return result;
+}
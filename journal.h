@@ -0,0 +1,59 @@
+#include <stddef.h>
+#include <stdint.h>
+#include <time.h>
+
+/* records are made durable after this many lines or this many seconds, whichever comes first */
+#define JOURNAL_SYNC_LINES 64
+#define JOURNAL_SYNC_SECONDS 1
+
+/* one record: an index and an offset in decimal, separated by a space and ended by a newline */
+#define JOURNAL_RECORD_SIZE 42
+
+/*
+ * A batch’s output file and the append-only journal beside it, which records which sites’ lines have been written and
+ * where the output ends after each. Besides those site indices and offsets, the journal holds only a verifier of the
+ * master password, derived with as many rounds as the batch’s cheapest site, so that it costs as much to test a guess
+ * against as the output already does.
+ */
+struct journal {
+	char* path;
+	int fd;
+	int output_fd;
+
+	/* the end of the output written so far */
+	uint64_t offset;
+
+	/* which sites’ lines are already in the output */
+	uint8_t* completed;
+	size_t completed_count;
+	size_t site_count;
+
+	/* records not yet written to the journal, because the output lines they describe might not be durable yet */
+	char pending[JOURNAL_SYNC_LINES * JOURNAL_RECORD_SIZE + 1];
+	size_t pending_length;
+	unsigned int pending_count;
+	struct timespec last_sync;
+};
+
+/*
+ * Opens a batch’s output file and its journal, `<output-path>.journal`. Unless resuming, both are created afresh, with
+ * a verifier of the master password derived with `rounds`. When resuming, the journal must be for the same list of
+ * sites and master password; output past its last record, from lines that weren’t made durable, is discarded.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+int journal_open(struct journal* journal, char const* output_path, char const* const* site_names, size_t site_count, char const* master_password, size_t master_password_length, unsigned int rounds, int resume);
+
+__attribute__ ((nonnull, pure, warn_unused_result))
+int journal_is_completed(struct journal const* journal, size_t index);
+
+/*
+ * Appends a site’s line to the output, and records it in the journal once the line is durable.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+int journal_append(struct journal* journal, size_t index, char const* line, size_t length);
+
+/*
+ * Makes everything appended so far durable and closes the journal, removing it if the batch is finished.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+int journal_close(struct journal* journal, int finished);
@@ -0,0 +1,128 @@
+#include <limits.h>
+#include <pthread.h>
+
+#include "lanes.h"
+#include "secure.h"
+
+struct lane {
+	struct nosepass_derivation derivation;
+	struct nosepass_profile profile;
+	enum nosepass_status status;
+	pthread_t thread;
+	int started;
+};
+
+/*
+ * Every lane of a key, in the only slot of a secure arena; their outputs are together, as nosepass_combine_lanes
+ * takes them.
+ */
+struct lanes {
+	uint8_t keys[NOSEPASS_MAX_LANES][NOSEPASS_KEY_SIZE];
+	struct lane lanes[NOSEPASS_MAX_LANES];
+};
+
+__attribute__ ((nonnull))
+static void* run_lane(void* const argument) {
+	struct lane* const lane = argument;
+
+	while (nosepass_derivation_step(&lane->derivation, UINT_MAX)) {}
+
+	lane->status = nosepass_derivation_finish(&lane->derivation);
+	return NULL;
+}
+
+/*
+ * Starts a lane’s derivation of a site key, or of its group’s key.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static enum nosepass_status start_lane(struct lane* const lane, char const* const master_password, size_t const master_password_length, char const* const site_name, size_t const site_name_length, struct nosepass_schema const* const schema, unsigned int const index, uint8_t key[const NOSEPASS_KEY_SIZE]) {
+	enum nosepass_status const status =
+		schema->group_length != 0
+			? nosepass_derivation_init_group(&lane->derivation, master_password, master_password_length, schema->group, schema->group_length, schema->rounds, key)
+			: nosepass_derivation_init(&lane->derivation, master_password, master_password_length, site_name, site_name_length, schema->rounds, key);
+
+	if (status != NOSEPASS_OK) {
+		return status;
+	}
+
+	return nosepass_derivation_set_lane(&lane->derivation, master_password, master_password_length, schema->lanes, index);
+}
+
+enum nosepass_status lanes_derive_key(char const* const master_password, size_t const master_password_length, char const* const site_name, size_t const site_name_length, struct nosepass_schema const* const schema, struct nosepass_profile* const profile, uint8_t key[const NOSEPASS_KEY_SIZE]) {
+	unsigned int const count = schema->lanes;
+
+	if (count < 2 || count > NOSEPASS_MAX_LANES) {
+		return NOSEPASS_INVALID_ARGUMENT;
+	}
+
+	struct secure_arena* const arena = secure_arena_create(sizeof(struct lanes), 1);
+
+	if (arena == NULL) {
+		return NOSEPASS_KDF_FAILED;
+	}
+
+	/* the arena’s only slot, which can’t be taken already */
+	struct lanes* const lanes = secure_alloc(arena);
+
+	for (unsigned int i = 0; i < count; i++) {
+		struct lane* const lane = &lanes->lanes[i];
+		enum nosepass_status const status = start_lane(lane, master_password, master_password_length, site_name, site_name_length, schema, i, lanes->keys[i]);
+
+		if (status != NOSEPASS_OK) {
+			secure_arena_destroy(arena);
+			return status;
+		}
+
+		if (profile != NULL) {
+			nosepass_derivation_set_profile(&lane->derivation, &lane->profile);
+		}
+	}
+
+	/* the calling thread runs the first lane, and any whose thread couldn’t be started */
+	for (unsigned int i = 1; i < count; i++) {
+		lanes->lanes[i].started = pthread_create(&lanes->lanes[i].thread, NULL, run_lane, &lanes->lanes[i]) == 0;
+	}
+
+	run_lane(&lanes->lanes[0]);
+
+	enum nosepass_status status = lanes->lanes[0].status;
+
+	for (unsigned int i = 1; i < count; i++) {
+		struct lane* const lane = &lanes->lanes[i];
+
+		if (lane->started) {
+			pthread_join(lane->thread, NULL);
+		} else {
+			run_lane(lane);
+		}
+
+		if (status == NOSEPASS_OK) {
+			status = lane->status;
+		}
+	}
+
+	if (status == NOSEPASS_OK) {
+		status = nosepass_combine_lanes((uint8_t const (*)[NOSEPASS_KEY_SIZE])lanes->keys, count, key);
+	}
+
+	if (profile != NULL) {
+		for (int phase = 0; phase < NOSEPASS_PHASE_COUNT; phase++) {
+			uint64_t slowest = 0;
+
+			for (unsigned int i = 0; i < count; i++) {
+				struct nosepass_profile const* const lane_profile = &lanes->lanes[i].profile;
+
+				if (lane_profile->wall_ns[phase] > slowest) {
+					slowest = lane_profile->wall_ns[phase];
+				}
+
+				profile->cpu_ns[phase] += lane_profile->cpu_ns[phase];
+			}
+
+			profile->wall_ns[phase] += slowest;
+		}
+	}
+
+	secure_arena_destroy(arena);
+	return status;
+}
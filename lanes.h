@@ -0,0 +1,13 @@
+#include <stddef.h>
+#include <stdint.h>
+
+#include "nosepass.h"
+
+/*
+ * Derives the key of a schema with several lanes, as nosepass_derivation_set_lanes does, but runs each lane on a
+ * thread of its own, so that it takes about as long as one lane. For a site in a group, this is the group key, which
+ * still has to be expanded for the site. The lanes’ states are kept in a secure arena. If `profile` isn’t NULL, every
+ * lane’s CPU time is added to it, with the wall-clock time of the slowest.
+ */
+__attribute__ ((nonnull (1, 3, 5, 7), warn_unused_result))
+enum nosepass_status lanes_derive_key(char const* master_password, size_t master_password_length, char const* site_name, size_t site_name_length, struct nosepass_schema const* schema, struct nosepass_profile* profile, uint8_t key[NOSEPASS_KEY_SIZE]);
@@ -1,333 +1,349 @@
+#include <errno.h>
+#include <fcntl.h>
 #include <inttypes.h>
 #include <limits.h>
-#include <math.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/resource.h>
 #include <termios.h>
+#include <time.h>
 #include <unistd.h>
 
-#include "bcrypt/bcrypt_pbkdf.h"
+#include "agent.h"
+#include "audit.h"
+#include "batch.h"
 #include "bcrypt/explicit_bzero.h"
-#include "chacha/ecrypt-sync.h"
+#include "checkpoint.h"
+#include "histogram.h"
+#include "journal.h"
+#include "lanes.h"
+#include "manifest.h"
+#include "nosepass.h"
+#include "placement.h"
+#include "probes.h"
+#include "resolve.h"
+#include "secure.h"
+#include "stream.h"
+#include "trace.h"
+#include "workers.h"
 
 #define S_(x) #x
 #define S(x) S_(x)
 
 #define CONFIG_NAME "/.nosepass"
 
-#define DEFAULT_SET "!\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_`abcdefghijklmnopqrstuvwxyz{|}~"
-#define DEFAULT_COUNT 20
-#define DEFAULT_ROUNDS 200
+#define MAX_INCLUDE_DEPTH 8
 
-#define MAX_COUNT_GENERATED 1024
+#define MASTER_PASSWORD_SIZE 1024
+#define MASTER_PASSWORD_LIMIT 1022
 
-#define PREFIX_COUNT "count="
-#define PREFIX_SET "set="
-#define PREFIX_ROUNDS "rounds="
-#define PREFIX_INCREMENT "increment="
+#define CONFIG_LINE_SIZE 1024
+#define CONFIG_LINE_LIMIT 1022
 
-_Static_assert(' ' == 32 && '~' == 126, "character set is normal");
-_Static_assert(DEFAULT_COUNT > 0 && DEFAULT_COUNT <= MAX_COUNT_GENERATED, "default count is within bounds");
-_Static_assert(MAX_COUNT_GENERATED <= UINT_MAX, "maximum count is within bounds");
+#define DIRECTIVE_INCLUDE "include "
+#define DIRECTIVE_SHARD "shard "
+#define DIRECTIVE_ALIAS "alias "
 
-struct schema {
-	uint64_t increment;
-	unsigned int count;
-	unsigned int rounds;
-	uint8_t set_size;
-	char set[95];
+#define MAX_ROUNDS_TARGETS 16
+
+#define MAX_WORKER_COMMANDS 64
+
+enum lookup_result {
+	LOOKUP_ERROR,
+	LOOKUP_NOT_FOUND,
+	LOOKUP_FOUND,
 };
 
-/*
- * Gets the next highest power of two, minus one.
- */
-__attribute__ ((const, warn_unused_result))
-static uint8_t get_mask(uint8_t n) {
-	n |= n >> 1;
-	n |= n >> 2;
-	n |= n >> 4;
-	return n;
-}
+__attribute__ ((nonnull, warn_unused_result))
+static enum lookup_result lookup_schema_path(char const* name, char const* path, unsigned int depth, int follow_shards, struct nosepass_schema* restrict result);
 
 __attribute__ ((nonnull, warn_unused_result))
-static char const* parse_count(char const* const line, size_t* const out) {
-	char const* p = line;
-	size_t n = 0;
+static int parse_entry(char const* const parameters, struct nosepass_schema* const restrict result) {
+	char const* error_position;
+	enum nosepass_status const status = nosepass_parse_schema(parameters, result, &error_position);
 
-	for (;; p++) {
-		char const c = *p;
+	if (status != NOSEPASS_OK) {
+		fprintf(stderr, "%s (at '%s')\n", nosepass_strerror(status), error_position);
+		return 0;
+	}
 
-		if (c == ' ' || c == '\0') {
-			if (p == line) {
-				return NULL;
-			}
+	return 1;
+}
 
-			*out = n;
-			return p;
-		}
+/*
+ * Resolves a path named in a configuration file relative to the directory containing that file.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static char* resolve_config_path(char const* const base, char const* const path) {
+	size_t directory_length = 0;
 
-		if (c < '0' || c > '9') {
-			return NULL;
+	if (path[0] != '/') {
+		char const* const last_slash = strrchr(base, '/');
+
+		if (last_slash != NULL) {
+			directory_length = (size_t)(last_slash - base) + 1;
 		}
+	}
 
-		size_t const digit_value = (size_t)(c - '0');
+	size_t const path_length = strlen(path);
+	char* const resolved = malloc(directory_length + path_length + 1);
 
-		if (n > SIZE_MAX / 10 || 10 * n > SIZE_MAX - digit_value) {
-			return NULL;
-		}
+	if (resolved == NULL) {
+		fputs("failed to allocate memory\n", stderr);
+		return NULL;
+	}
 
-		n = 10 * n + digit_value;
+	memcpy(resolved, base, directory_length);
+	memcpy(resolved + directory_length, path, path_length + 1);
+	return resolved;
+}
+
+/*
+ * Checks a site name against a shard pattern, which is either an exact name or a prefix followed by “*”.
+ */
+__attribute__ ((nonnull, pure, warn_unused_result))
+static int shard_matches(char const* const pattern, size_t const pattern_length, char const* const name) {
+	if (pattern[pattern_length - 1] == '*') {
+		return strncmp(name, pattern, pattern_length - 1) == 0;
 	}
+
+	return strlen(name) == pattern_length && strncmp(name, pattern, pattern_length) == 0;
 }
 
+/*
+ * Follows an include or shard directive by looking the name up in the file it refers to; an included file’s shards
+ * are followed only if the including file’s are. A shard’s own default entry, if any, applies on top of the inherited
+ * defaults only when the site is found there.
+ */
 __attribute__ ((nonnull, warn_unused_result))
-static char const* parse_set(char const* line, struct schema* const result) {
-	unsigned char in_set[95];
-	memset(in_set, 0, sizeof in_set);
-	char last = '\0';
+static enum lookup_result lookup_schema_directive(char const* const name, char const* const base, char const* const target, unsigned int const depth, int const is_shard, int const follow_shards, struct nosepass_schema* restrict result) {
+	if (depth >= MAX_INCLUDE_DEPTH) {
+		fputs("configuration includes are nested too deeply; limit is " S(MAX_INCLUDE_DEPTH) "\n", stderr);
+		return LOOKUP_ERROR;
+	}
 
-	for (;; line++) {
-		char const c = *line;
+	char* const path = resolve_config_path(base, target);
 
-		if (c == ' ' || c == '\0') {
-			break;
-		}
+	if (path == NULL) {
+		return LOOKUP_ERROR;
+	}
 
-		if (c == '\\') {
-			last = *++line;
+	enum lookup_result found;
 
-			if (last == '\0') {
-				fputs("expected escaped character, but found end of line\n", stderr);
-				return NULL;
-			}
+	if (is_shard) {
+		struct nosepass_schema shard_schema = *result;
+		found = lookup_schema_path("default", path, depth + 1, 0, &shard_schema);
 
-			in_set[last - ' '] = 1;
-			continue;
+		if (found != LOOKUP_ERROR) {
+			found = lookup_schema_path(name, path, depth + 1, 1, &shard_schema);
 		}
 
-		if (c < ' ' || c >= '\x7f') {
-			fprintf(stderr, "expected printable ASCII but found '\\x%02x' instead\n", (unsigned int)(unsigned char)c);
-			return NULL;
+		if (found == LOOKUP_FOUND) {
+			*result = shard_schema;
 		}
+	} else {
+		found = lookup_schema_path(name, path, depth + 1, follow_shards, result);
+	}
 
-		if (c == '-') {
-			if (last == '\0') {
-				fputs("found hyphen range with no starting character\n", stderr);
-				return NULL;
-			}
-
-			char end = *++line;
-
-			if (end == '\\') {
-				end = *++line;
-			} else if (end == ' ') {
-				end = '\0';
-			}
+	free(path);
+	return found;
+}
 
-			if (end == '\0') {
-				fputs("found hyphen range with no ending character\n", stderr);
-				return NULL;
-			}
+/*
+ * Reads the next non-comment line of a configuration file, without its line ending.
+ * Returns LOOKUP_NOT_FOUND at the end of the file.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static enum lookup_result read_config_line(FILE* const input, char line[CONFIG_LINE_SIZE]) {
+	line[CONFIG_LINE_SIZE - 1] = '\0';
 
-			if (end < ' ' || end >= '\x7f') {
-				fprintf(stderr, "expected printable ASCII but found '\\x%02x' instead\n", (unsigned int)(unsigned char)end);
-				return NULL;
+	for (;;) {
+		if (fgets(line, CONFIG_LINE_SIZE, input) == NULL) {
+			if (!feof(input)) {
+				fputs("failed to read configuration file\n", stderr);
+				return LOOKUP_ERROR;
 			}
 
-			if (end < last) {
-				fprintf(stderr, "empty range %c-%c\n", last, end);
-				return NULL;
-			}
+			return LOOKUP_NOT_FOUND;
+		}
 
-			for (char add = last; add <= end; add++) {
-				in_set[add - ' '] = 1;
-			}
+		if (line[CONFIG_LINE_SIZE - 1] != '\0') {
+			fputs("configuration line too long; limit is " S(CONFIG_LINE_LIMIT) " characters.\n", stderr);
+			return LOOKUP_ERROR;
+		}
 
-			last = '\0';
-		} else {
-			in_set[c - ' '] = 1;
-			last = c;
+		if (line[0] == '#' || line[0] == '\0') {
+			continue;
 		}
-	}
 
-	result->set_size = 0;
+		size_t const line_length = strlen(line);
 
-	for (char i = 0; (unsigned char)i < sizeof in_set; i++) {
-		if (in_set[(unsigned char)i]) {
-			result->set[result->set_size++] = i + ' ';
+		if (line[line_length - 1] == '\n') {
+			line[line_length - 1] = '\0';
 		}
-	}
 
-	if (result->set_size < 2) {
-		fputs("character set must contain at least two characters\n", stderr);
-		return NULL;
+		return LOOKUP_FOUND;
 	}
-
-	return line;
 }
 
+/*
+ * Scans a configuration file for the entry with the given name, following include directives and, if requested,
+ * any shard directive whose pattern matches the name. Shards that can’t contain the name are never opened.
+ */
 __attribute__ ((nonnull, warn_unused_result))
-static int parse_schema_line(char const* line, struct schema* const restrict result) {
-	int has_count = 0;
-	int has_set = 0;
-	int has_rounds = 0;
-	int has_increment = 0;
+static enum lookup_result lookup_schema(char const* const name, FILE* const input, char const* const path, unsigned int const depth, int const follow_shards, struct nosepass_schema* restrict result) {
+	size_t const name_length = strlen(name);
 
-	while (*line != '\0') {
-		if (*line != ' ') {
-			fprintf(stderr, "expected space, but found '%s' instead\n", line);
-			return 0;
+	char line[CONFIG_LINE_SIZE];
+
+	for (;;) {
+		enum lookup_result const read = read_config_line(input, line);
+
+		if (read != LOOKUP_FOUND) {
+			return read;
 		}
 
-		line++;
+		if (strncmp(line, DIRECTIVE_INCLUDE, sizeof DIRECTIVE_INCLUDE - 1) == 0) {
+			char const* const target = line + (sizeof DIRECTIVE_INCLUDE - 1);
 
-		if (strncmp(line, PREFIX_COUNT, sizeof PREFIX_COUNT - 1) == 0) {
-			if (has_count) {
-				fputs("multiple settings for character count\n", stderr);
-				return 0;
+			if (*target == '\0') {
+				fputs("expected path after " DIRECTIVE_INCLUDE "\n", stderr);
+				return LOOKUP_ERROR;
 			}
 
-			has_count = 1;
+			enum lookup_result const found = lookup_schema_directive(name, path, target, depth, 0, follow_shards, result);
 
-			size_t count;
-			char const* const parse_end = parse_count(line + (sizeof PREFIX_COUNT - 1), &count);
-
-			if (parse_end == NULL) {
-				fprintf(stderr, "expected count, but found '%s' instead\n", line);
-				return 0;
+			if (found != LOOKUP_NOT_FOUND) {
+				return found;
 			}
+		} else if (strncmp(line, DIRECTIVE_SHARD, sizeof DIRECTIVE_SHARD - 1) == 0) {
+			char const* const pattern = line + (sizeof DIRECTIVE_SHARD - 1);
+			char const* const pattern_end = strchr(pattern, ' ');
 
-			if (count == 0) {
-				fputs("character count must be greater than 0\n", stderr);
-				return 0;
+			if (pattern_end == NULL || pattern_end == pattern || pattern_end[1] == '\0') {
+				fprintf(stderr, "expected " DIRECTIVE_SHARD "<pattern> <path>, but found '%s' instead\n", line);
+				return LOOKUP_ERROR;
 			}
 
-			if (count > MAX_COUNT_GENERATED) {
-				fputs("character count must be at most " S(MAX_COUNT_GENERATED) "\n", stderr);
-				return 0;
-			}
+			size_t const pattern_length = (size_t)(pattern_end - pattern);
+			char const* const star = memchr(pattern, '*', pattern_length);
 
-			result->count = (unsigned int)count;
-			line = parse_end;
-		} else if (strncmp(line, PREFIX_SET, sizeof PREFIX_SET - 1) == 0) {
-			if (has_set) {
-				fputs("multiple settings for character set\n", stderr);
-				return 0;
+			if (star != NULL && star != pattern_end - 1) {
+				fprintf(stderr, "shard pattern may only end with '*', but found '%.*s'\n", (int)pattern_length, pattern);
+				return LOOKUP_ERROR;
 			}
 
-			has_set = 1;
+			if (follow_shards && shard_matches(pattern, pattern_length, name)) {
+				enum lookup_result const found = lookup_schema_directive(name, path, pattern_end + 1, depth, 1, 1, result);
 
-			if ((line = parse_set(line + (sizeof PREFIX_SET - 1), result)) == NULL) {
-				return 0;
+				if (found != LOOKUP_NOT_FOUND) {
+					return found;
+				}
 			}
-		} else if (strncmp(line, PREFIX_ROUNDS, sizeof PREFIX_ROUNDS - 1) == 0) {
-			if (has_rounds) {
-				fputs("multiple settings for rounds\n", stderr);
-				return 0;
+		} else if (strncmp(line, DIRECTIVE_ALIAS, sizeof DIRECTIVE_ALIAS - 1) == 0) {
+			continue;
+		} else if (strncmp(line, name, name_length) == 0) {
+			char const c = line[name_length];
+
+			if (c == ' ') {
+				return parse_entry(line + name_length + 1, result) ? LOOKUP_FOUND : LOOKUP_ERROR;
+			} else if (c == '\0') {
+				return LOOKUP_FOUND;
 			}
+		}
+	}
+}
+
+/*
+ * Scans a configuration file and its includes for the first alias directive whose domain contains the host,
+ * copying the aliased site name into `site`.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static enum lookup_result lookup_alias(char const* const host, size_t const host_length, FILE* const input, char const* const path, unsigned int const depth, char site[CONFIG_LINE_SIZE]) {
+	char line[CONFIG_LINE_SIZE];
 
-			has_rounds = 1;
+	for (;;) {
+		enum lookup_result const read = read_config_line(input, line);
 
-			size_t rounds;
-			char const* const parse_end = parse_count(line + (sizeof PREFIX_ROUNDS - 1), &rounds);
+		if (read != LOOKUP_FOUND) {
+			return read;
+		}
 
-			if (parse_end == NULL) {
-				fprintf(stderr, "expected number of rounds, but found '%s' instead\n", line);
-				return 0;
+		if (strncmp(line, DIRECTIVE_INCLUDE, sizeof DIRECTIVE_INCLUDE - 1) == 0) {
+			if (depth >= MAX_INCLUDE_DEPTH) {
+				fputs("configuration includes are nested too deeply; limit is " S(MAX_INCLUDE_DEPTH) "\n", stderr);
+				return LOOKUP_ERROR;
 			}
 
-			if (rounds < 1) {
-				fputs("number of rounds must be at least 1\n", stderr);
-				return 0;
+			char* const include_path = resolve_config_path(path, line + (sizeof DIRECTIVE_INCLUDE - 1));
+
+			if (include_path == NULL) {
+				return LOOKUP_ERROR;
 			}
 
-			if (rounds > UINT_MAX) {
-				fprintf(stderr, "number of rounds must be at most %u\n", UINT_MAX);
-				return 0;
+			FILE* const include = fopen(include_path, "r");
+
+			if (include == NULL) {
+				fprintf(stderr, "failed to open configuration file %s: %s\n", include_path, strerror(errno));
+				free(include_path);
+				return LOOKUP_ERROR;
 			}
 
-			result->rounds = (unsigned int)rounds;
-			line = parse_end;
-		} else if (strncmp(line, PREFIX_INCREMENT, sizeof PREFIX_INCREMENT - 1) == 0) {
-			if (has_increment) {
-				fputs("multiple settings for increment\n", stderr);
-				return 0;
+			enum lookup_result const found = lookup_alias(host, host_length, include, include_path, depth + 1, site);
+			fclose(include);
+			free(include_path);
+
+			if (found != LOOKUP_NOT_FOUND) {
+				return found;
 			}
+		} else if (strncmp(line, DIRECTIVE_ALIAS, sizeof DIRECTIVE_ALIAS - 1) == 0) {
+			char* const domain = line + (sizeof DIRECTIVE_ALIAS - 1);
+			char const* const domain_end = strchr(domain, ' ');
 
-			has_increment = 1;
+			if (domain_end == NULL || domain_end == domain || domain_end[1] == '\0' || strchr(domain_end + 1, ' ') != NULL) {
+				fprintf(stderr, "expected " DIRECTIVE_ALIAS "<domain> <site-name>, but found '%s' instead\n", line);
+				return LOOKUP_ERROR;
+			}
 
-			size_t increment;
-			char const* const parse_end = parse_count(line + (sizeof PREFIX_INCREMENT - 1), &increment);
+			/* compared the way extract_host normalizes hosts: lowercased, without a trailing dot */
+			size_t domain_length = (size_t)(domain_end - domain);
 
-			if (parse_end == NULL) {
-				fprintf(stderr, "expected increment, but found '%s' instead\n", line);
-				return 0;
+			if (domain_length > 1 && domain[domain_length - 1] == '.') {
+				domain_length--;
 			}
 
-			if (increment > UINT64_MAX) {
-				fprintf(stderr, "increment must be at most %" PRIu64 "\n", UINT64_MAX);
-				return 0;
+			for (size_t i = 0; i < domain_length; i++) {
+				if (domain[i] >= 'A' && domain[i] <= 'Z') {
+					domain[i] = (char)(domain[i] - 'A' + 'a');
+				}
 			}
 
-			result->increment = (uint64_t)increment;
-			line = parse_end;
-		} else {
-			fprintf(stderr, "expected one of " PREFIX_COUNT ", " PREFIX_SET ", " PREFIX_ROUNDS ", or " PREFIX_INCREMENT ", but found '%s' instead\n", line);
-			return 0;
+			if (host_in_domain(host, host_length, domain, domain_length)) {
+				strcpy(site, domain_end + 1);
+				return LOOKUP_FOUND;
+			}
 		}
 	}
-
-	return 1;
 }
 
 __attribute__ ((nonnull, warn_unused_result))
-static int parse_schema(char const* const name, FILE* const input, struct schema* restrict result) {
-	size_t const name_length = strlen(name);
-
-	char line[1024];
-	line[1023] = '\0';
-
-	for (;;) {
-		if (fgets(line, sizeof line, input) == NULL) {
-			if (!feof(input)) {
-				fputs("failed to read configuration file\n", stderr);
-				return 0;
-			}
-
-			return 1;
-		}
-
-		if (line[1023] != '\0') {
-			fputs("configuration line too long; limit is 1022 characters.\n", stderr);
-			return 0;
-		}
-
-		if (line[0] == '#' || line[0] == '\0') {
-			continue;
-		}
-
-		size_t const line_length = strlen(line);
-
-		if (line[line_length - 1] == '\n') {
-			line[line_length - 1] = '\0';
-		}
-
-		if (strncmp(line, name, name_length) == 0) {
-			char const c = line[name_length];
+static enum lookup_result lookup_schema_path(char const* const name, char const* const path, unsigned int const depth, int const follow_shards, struct nosepass_schema* restrict result) {
+	FILE* const config = fopen(path, "r");
 
-			if (c == ' ') {
-				return parse_schema_line(line + name_length, result);
-			} else if (c == '\0') {
-				return 1;
-			}
-		}
+	if (config == NULL) {
+		fprintf(stderr, "failed to open configuration file %s: %s\n", path, strerror(errno));
+		return LOOKUP_ERROR;
 	}
+
+	enum lookup_result const found = lookup_schema(name, config, path, depth, follow_shards, result);
+	fclose(config);
+	return found;
 }
 
 __attribute__ ((warn_unused_result))
-static FILE* open_config_file(void) {
+static char* get_config_path(void) {
 	char const* const home_path = getenv("HOME");
 
 	if (home_path == NULL) {
@@ -347,184 +363,2350 @@ static FILE* open_config_file(void) {
 	memcpy(config_path, home_path, home_path_length);
 	memcpy(config_path + home_path_length, CONFIG_NAME, sizeof CONFIG_NAME);
 
-	FILE* const config = fopen(config_path, "r");
-
-	free(config_path);
-
-	if (config == NULL) {
-		perror("failed to open configuration file");
-	}
-
-	return config;
+	return config_path;
 }
 
 __attribute__ ((nonnull, warn_unused_result))
-static char* password_read(char* const s, size_t const size) {
+static char* password_read(char* const s, size_t const size, FILE* const input) {
+	int const fd = fileno(input);
 	struct termios original_termios;
-	int termattr_result = tcgetattr(STDIN_FILENO, &original_termios);
+	int termattr_result = tcgetattr(fd, &original_termios);
 
 	if (termattr_result == 0) {
 		struct termios modified_termios = original_termios;
 		modified_termios.c_lflag &= ~(unsigned int)ECHO;
-		termattr_result = tcsetattr(STDIN_FILENO, TCSAFLUSH, &modified_termios);
+		termattr_result = tcsetattr(fd, TCSAFLUSH, &modified_termios);
 	}
 
 	fputs("Password: ", stderr);
 
-	char* const result = fgets(s, (int)size, stdin);
+	char* const result = fgets(s, (int)size, input);
 
 	if (termattr_result == 0) {
 		putc('\n', stderr);
-		tcsetattr(STDIN_FILENO, TCSAFLUSH, &original_termios);
+		tcsetattr(fd, TCSAFLUSH, &original_termios);
 	}
 
 	return result;
 }
 
 static void show_usage(void) {
-	fputs("Usage: nosepass <site-name>\n", stderr);
+	fputs(
+		"Usage: nosepass [--resolve] [--rounds <rounds>,...] [--checkpoint <file>] [--stats[=json]] [--] <site-name-or-url>\n"
+		"       nosepass --batch [<batch-options>] [<sites-file>]\n"
+		"       nosepass --worker\n"
+		"       nosepass --agent [--cache] [--timeout <seconds>]\n"
+		"       nosepass --histograms <snapshot>...\n"
+		"       nosepass --audit [--increments <highest>] [--threads <count> [--placement ...]] <candidates-file>\n"
+		"\n"
+		"Batch options:\n"
+		"  --threads <count> [--placement none|spread|compact] [--trace <file>]\n"
+		"  --workers <count>, --worker-command <command>...\n"
+		"  --stream\n"
+		"  --shard <index>/<count>\n"
+		"  --output <file> [--resume]\n"
+		"  --manifest <file> [--changed-only]\n",
+		stderr);
 }
 
-int main(int argc, char* argv[]) {
-	if (argc != 2) {
-		show_usage();
-		return EXIT_FAILURE;
+__attribute__ ((nonnull, warn_unused_result))
+static int parse_unsigned(char const* const s, unsigned int* const out) {
+	if (*s < '0' || *s > '9') {
+		return 0;
 	}
 
-	char const* const site_name = argv[1];
+	char* end;
+	errno = 0;
+	unsigned long const n = strtoul(s, &end, 10);
+
+	if (*end != '\0' || errno != 0 || n > UINT_MAX) {
+		return 0;
+	}
 
-	struct schema schema;
-	schema.count = DEFAULT_COUNT;
-	schema.rounds = DEFAULT_ROUNDS;
-	schema.increment = 0;
-	schema.set_size = sizeof DEFAULT_SET - 1;
-	_Static_assert(sizeof DEFAULT_SET - 1 > 0 && sizeof DEFAULT_SET - 1 <= sizeof schema.set, "default character set fits in schema");
-	memcpy(schema.set, DEFAULT_SET, sizeof DEFAULT_SET - 1);
+	*out = (unsigned int)n;
+	return 1;
+}
 
-	{
-		FILE* const config = open_config_file();
+/*
+ * Parses a comma-separated list of rounds values in ascending order.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int parse_rounds_list(char const* s, unsigned int rounds[MAX_ROUNDS_TARGETS], size_t* const rounds_count) {
+	size_t count = 0;
 
-		if (config == NULL) {
-			return EXIT_FAILURE;
+	for (;;) {
+		if (*s < '0' || *s > '9' || count == MAX_ROUNDS_TARGETS) {
+			return 0;
 		}
 
-		if (!parse_schema("default", config, &schema)) {
-			fclose(config);
-			return EXIT_FAILURE;
+		char* end;
+		errno = 0;
+		unsigned long const n = strtoul(s, &end, 10);
+
+		if (errno != 0 || n == 0 || n > UINT_MAX || (count != 0 && n <= rounds[count - 1])) {
+			return 0;
 		}
 
-		if (fseek(config, 0L, SEEK_SET) != 0) {
-			perror("failed to seek configuration file");
-			fclose(config);
-			return EXIT_FAILURE;
+		rounds[count++] = (unsigned int)n;
+
+		if (*end == '\0') {
+			break;
 		}
 
-		if (!parse_schema(site_name, config, &schema)) {
-			fclose(config);
-			return EXIT_FAILURE;
+		if (*end != ',') {
+			return 0;
 		}
 
-		fclose(config);
+		s = end + 1;
 	}
 
-	{
-		double const bits = schema.count * log2(schema.set_size);
-		char const* const color =
-			bits >= 128.0 ? "\x1b[32m" :
-			bits >= 92.0 ? "\x1b[33m" :
-			"\x1b[31m";
+	*rounds_count = count;
+	return 1;
+}
 
-		fprintf(stderr, "%s●\x1b[0m generating password equivalent to %.0f bits\n", color, bits);
+/*
+ * Parses a shard of a batch as `<index>/<count>`, counting from 0.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int parse_shard(char const* const s, unsigned int* const index, unsigned int* const count) {
+	if (*s < '0' || *s > '9') {
+		return 0;
 	}
 
-	uint8_t key[32];
+	char* end;
+	errno = 0;
+	unsigned long const i = strtoul(s, &end, 10);
 
-	{
-		char password[1024];
+	if (errno != 0 || *end != '/' || end[1] < '0' || end[1] > '9') {
+		return 0;
+	}
 
-		if (password_read(password, sizeof password) == NULL) {
-			fputs("failed to read password\n", stderr);
-			return EXIT_FAILURE;
-		}
+	unsigned long const n = strtoul(end + 1, &end, 10);
 
-		size_t password_length = strlen(password);
+	if (errno != 0 || *end != '\0' || n == 0 || n > UINT_MAX || i >= n) {
+		return 0;
+	}
 
-		if (password[password_length - 1] == '\n') {
-			password_length--;
-		} else if (password_length > 1022) {
-			/* avoid silent truncation at 1023 characters */
-			fputs("the maximum password length is 1022 characters\n", stderr);
-			return EXIT_FAILURE;
-		}
+	*index = (unsigned int)i;
+	*count = (unsigned int)n;
+	return 1;
+}
 
-		if (password_length == 0) {
-			fputs("a password is required\n", stderr);
-			return EXIT_FAILURE;
-		}
+enum stats_format {
+	STATS_NONE,
+	STATS_TEXT,
+	STATS_JSON,
+};
 
-		if (bcrypt_pbkdf(password, password_length, (unsigned char const*)site_name, strlen(site_name), key, sizeof key, schema.rounds) != 0) {
-			fputs("bcrypt_pbkdf failed\n", stderr);
-			return EXIT_FAILURE;
-		}
+struct options {
+	int resolve;
+	int agent;
+	int agent_cache;
+	unsigned int agent_timeout;
+
+	/* rounds values to derive in one pass instead of the configured one, or none */
+	unsigned int rounds[MAX_ROUNDS_TARGETS];
+	size_t rounds_count;
+
+	char const* checkpoint_path;
+
+	/* whether and how to report where a derivation’s time went */
+	enum stats_format stats;
+
+	int batch;
+
+	/* whether to stream the batch in input order instead of scheduling it */
+	int batch_stream;
 
-		explicit_bzero(password, sizeof password);
+	/* 0 to size the pool to the available CPUs */
+	unsigned int batch_threads;
+	enum placement_policy batch_placement;
+
+	/* a file to write the batch to, with a journal of its progress, instead of standard output */
+	char const* batch_output_path;
+	int batch_resume;
+
+	/* a file of the schemas each site was last derived with, and whether to derive only the sites whose schema changed */
+	char const* batch_manifest_path;
+	int batch_changed_only;
+
+	/* a file to write a Chrome trace of the threaded batch’s stages to */
+	char const* batch_trace_path;
+
+	/* the part of the list to derive, or a shard count of 0 for all of it */
+	unsigned int batch_shard_index;
+	unsigned int batch_shard_count;
+
+	/* worker processes to spread the batch over: local ones, and ones started by commands */
+	unsigned int batch_workers;
+	char const* batch_worker_commands[MAX_WORKER_COMMANDS];
+	size_t batch_worker_command_count;
+
+	int worker;
+
+	/* whether to check a file of candidate passwords against every configured site’s */
+	int audit;
+
+	/* how many increments, from 0, to audit every site at, or 0 for each one’s configured increment */
+	unsigned int audit_increment_count;
+
+	/* the agent’s histogram snapshots to merge and print */
+	char* const* histogram_paths;
+	size_t histogram_path_count;
+
+	/* the site name, the batch’s file of site names, or the audit’s file of candidates */
+	char const* site_name;
+};
+
+__attribute__ ((nonnull, pure, warn_unused_result))
+static int has_workers(struct options const* const options) {
+	return options->batch_workers != 0 || options->batch_worker_command_count != 0;
+}
+
+__attribute__ ((nonnull, warn_unused_result))
+static int parse_options(int const argc, char* argv[], struct options* const options) {
+	options->resolve = 0;
+	options->agent = 0;
+	options->agent_cache = 0;
+	options->agent_timeout = DEFAULT_AGENT_TIMEOUT;
+	options->rounds_count = 0;
+	options->checkpoint_path = NULL;
+	options->stats = STATS_NONE;
+	options->batch = 0;
+	options->batch_stream = 0;
+	options->batch_threads = 0;
+	options->batch_placement = PLACEMENT_NONE;
+	options->batch_output_path = NULL;
+	options->batch_resume = 0;
+	options->batch_manifest_path = NULL;
+	options->batch_changed_only = 0;
+	options->batch_trace_path = NULL;
+	options->batch_shard_index = 0;
+	options->batch_shard_count = 0;
+	options->batch_workers = 0;
+	options->batch_worker_command_count = 0;
+	options->worker = 0;
+	options->audit = 0;
+	options->audit_increment_count = 0;
+	options->histogram_paths = NULL;
+	options->histogram_path_count = 0;
+	options->site_name = NULL;
+
+	/* the rest of the arguments are snapshots */
+	if (argc > 1 && strcmp(argv[1], "--histograms") == 0) {
+		options->histogram_paths = argv + 2;
+		options->histogram_path_count = (size_t)(argc - 2);
+		return argc > 2;
 	}
 
-	uint8_t const nonce[8] = {
-		(uint8_t)schema.increment,
-		(uint8_t)(schema.increment >> 8),
-		(uint8_t)(schema.increment >> 16),
-		(uint8_t)(schema.increment >> 24),
-		(uint8_t)(schema.increment >> 32),
-		(uint8_t)(schema.increment >> 40),
-		(uint8_t)(schema.increment >> 48),
-		(uint8_t)(schema.increment >> 56),
-	};
+	/* set after `--`, past which every argument is a site name, even one that looks like an option */
+	int options_ended = 0;
 
-	ECRYPT_ctx ctx;
+	for (int i = 1; i < argc; i++) {
+		char const* const arg = argv[i];
 
-	ECRYPT_init();
-	ECRYPT_keysetup(&ctx, key, 8 * sizeof key, 8 * sizeof nonce);
-	ECRYPT_ivsetup(&ctx, nonce);
+		if (options_ended) {
+			if (options->site_name != NULL) {
+				return 0;
+			}
 
-	size_t i = 0;
-	uint8_t mask = get_mask(schema.set_size);
+			options->site_name = arg;
+		} else if (strcmp(arg, "--") == 0) {
+			options_ended = 1;
+		} else if (strcmp(arg, "--resolve") == 0) {
+			options->resolve = 1;
+		} else if (strcmp(arg, "--agent") == 0) {
+			options->agent = 1;
+		} else if (strcmp(arg, "--cache") == 0) {
+			options->agent_cache = 1;
+		} else if (strcmp(arg, "--timeout") == 0) {
+			if (++i == argc || !parse_unsigned(argv[i], &options->agent_timeout)) {
+				fputs("expected a number of seconds after --timeout\n", stderr);
+				return 0;
+			}
+		} else if (strcmp(arg, "--batch") == 0) {
+			options->batch = 1;
+		} else if (strcmp(arg, "--stream") == 0) {
+			options->batch_stream = 1;
+		} else if (strcmp(arg, "--threads") == 0) {
+			if (++i == argc || !parse_unsigned(argv[i], &options->batch_threads) || options->batch_threads == 0) {
+				fputs("expected a number of threads after --threads\n", stderr);
+				return 0;
+			}
+		} else if (strcmp(arg, "--placement") == 0) {
+			if (++i == argc || !placement_parse(argv[i], &options->batch_placement)) {
+				fputs("expected none, spread, or compact after --placement\n", stderr);
+				return 0;
+			}
+		} else if (strcmp(arg, "--output") == 0) {
+			if (++i == argc) {
+				fputs("expected a file name after --output\n", stderr);
+				return 0;
+			}
 
-	char generated_password[MAX_COUNT_GENERATED];
+			options->batch_output_path = argv[i];
+		} else if (strcmp(arg, "--resume") == 0) {
+			options->batch_resume = 1;
+		} else if (strcmp(arg, "--manifest") == 0) {
+			if (++i == argc) {
+				fputs("expected a file name after --manifest\n", stderr);
+				return 0;
+			}
 
-	{
-		uint8_t generated_bytes[ECRYPT_BLOCKLENGTH];
+			options->batch_manifest_path = argv[i];
+		} else if (strcmp(arg, "--changed-only") == 0) {
+			options->batch_changed_only = 1;
+		} else if (strcmp(arg, "--trace") == 0) {
+			if (++i == argc) {
+				fputs("expected a file name after --trace\n", stderr);
+				return 0;
+			}
 
-		while (i < schema.count) {
-			ECRYPT_keystream_blocks(&ctx, generated_bytes, 1);
+			options->batch_trace_path = argv[i];
+		} else if (strcmp(arg, "--shard") == 0) {
+			if (++i == argc || !parse_shard(argv[i], &options->batch_shard_index, &options->batch_shard_count)) {
+				fputs("expected a shard as <index>/<count> after --shard\n", stderr);
+				return 0;
+			}
+		} else if (strcmp(arg, "--workers") == 0) {
+			if (++i == argc || !parse_unsigned(argv[i], &options->batch_workers) || options->batch_workers == 0) {
+				fputs("expected a number of worker processes after --workers\n", stderr);
+				return 0;
+			}
+		} else if (strcmp(arg, "--worker-command") == 0) {
+			if (++i == argc || options->batch_worker_command_count == MAX_WORKER_COMMANDS) {
+				fputs("expected up to " S(MAX_WORKER_COMMANDS) " commands, each after --worker-command\n", stderr);
+				return 0;
+			}
 
-			for (size_t j = 0; j < ECRYPT_BLOCKLENGTH; j++) {
-				uint8_t const character_index = mask & generated_bytes[j];
+			options->batch_worker_commands[options->batch_worker_command_count++] = argv[i];
+		} else if (strcmp(arg, "--worker") == 0) {
+			options->worker = 1;
+		} else if (strcmp(arg, "--rounds") == 0) {
+			if (++i == argc || !parse_rounds_list(argv[i], options->rounds, &options->rounds_count)) {
+				fputs("expected up to " S(MAX_ROUNDS_TARGETS) " ascending numbers of rounds, separated by commas, after --rounds\n", stderr);
+				return 0;
+			}
+		} else if (strcmp(arg, "--checkpoint") == 0) {
+			if (++i == argc) {
+				fputs("expected a file name after --checkpoint\n", stderr);
+				return 0;
+			}
 
-				if (character_index < schema.set_size) {
-					generated_password[i] = schema.set[character_index];
-					i++;
+			options->checkpoint_path = argv[i];
+		} else if (strcmp(arg, "--audit") == 0) {
+			options->audit = 1;
+		} else if (strcmp(arg, "--increments") == 0) {
+			unsigned int highest;
 
-					if (i == schema.count) {
-						break;
-					}
-				}
+			if (++i == argc || !parse_unsigned(argv[i], &highest) || highest == UINT_MAX) {
+				fputs("expected the highest increment to audit after --increments\n", stderr);
+				return 0;
 			}
+
+			options->audit_increment_count = highest + 1;
+		} else if (strcmp(arg, "--stats") == 0) {
+			options->stats = STATS_TEXT;
+		} else if (strcmp(arg, "--stats=json") == 0) {
+			options->stats = STATS_JSON;
+		} else if (arg[0] == '-' && arg[1] == '-') {
+			fprintf(stderr, "unrecognized option '%s'\n", arg);
+			return 0;
+		} else if (options->site_name == NULL) {
+			options->site_name = arg;
+		} else {
+			return 0;
 		}
+	}
 
-		explicit_bzero(generated_bytes, ECRYPT_BLOCKLENGTH);
+	int const batch_options = options->batch_stream || options->batch_threads != 0 || options->batch_placement != PLACEMENT_NONE || options->batch_output_path != NULL || options->batch_resume
+		|| options->batch_manifest_path != NULL || options->batch_changed_only || options->batch_trace_path != NULL || options->batch_shard_count != 0 || has_workers(options);
+
+	if (options->worker) {
+		return argc == 2;
 	}
 
-	size_t const written = fwrite(generated_password, sizeof(char), schema.count, stdout);
+	if (options->audit) {
+		return options->site_name != NULL && !options->resolve && options->rounds_count == 0 && options->checkpoint_path == NULL && options->stats == STATS_NONE && !options->agent && !options->agent_cache
+			&& !options->batch && !options->batch_stream && options->batch_output_path == NULL && !options->batch_resume && options->batch_manifest_path == NULL && !options->batch_changed_only
+			&& options->batch_trace_path == NULL && options->batch_shard_count == 0 && !has_workers(options);
+	}
 
-	explicit_bzero(generated_password, MAX_COUNT_GENERATED);
+	if (options->audit_increment_count != 0) {
+		return 0;
+	}
 
-	if (written != schema.count) {
-		fputs("failed to write output\n", stderr);
-		return EXIT_FAILURE;
+	if (options->agent) {
+		return options->site_name == NULL && !options->resolve && options->rounds_count == 0 && options->checkpoint_path == NULL && options->stats == STATS_NONE && !options->batch && !batch_options;
+	}
+
+	if (options->batch) {
+		return !options->resolve && options->rounds_count == 0 && options->checkpoint_path == NULL && options->stats == STATS_NONE && !options->agent_cache
+			&& (options->batch_output_path == NULL || !options->batch_stream) && (!options->batch_resume || options->batch_output_path != NULL)
+			&& (options->batch_manifest_path == NULL || !options->batch_stream) && (!options->batch_changed_only || options->batch_manifest_path != NULL)
+			&& (!has_workers(options) || (!options->batch_stream && options->batch_threads == 0))
+			&& (options->batch_placement == PLACEMENT_NONE || (!options->batch_stream && !has_workers(options)))
+			&& (options->batch_trace_path == NULL || (!options->batch_stream && !has_workers(options)));
+	}
+
+	return options->site_name != NULL && !options->agent_cache && !batch_options;
+}
+
+/*
+ * Opens the configuration file, or returns NULL after reporting the problem.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static FILE* open_config_file(char** const config_path) {
+	if ((*config_path = get_config_path()) == NULL) {
+		return NULL;
+	}
+
+	FILE* const config = fopen(*config_path, "r");
+
+	if (config == NULL) {
+		perror("failed to open configuration file");
+		free(*config_path);
+	}
+
+	return config;
+}
+
+/*
+ * Maps a URL or hostname to a site name by the configured aliases, or its registrable domain otherwise.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int resolve_site(char const* const url, char site[CONFIG_LINE_SIZE]) {
+	char host[MAX_HOST_LENGTH + 1];
+	size_t const host_length = extract_host(url, host);
+
+	if (host_length == 0) {
+		fprintf(stderr, "expected a URL or hostname, but found '%s' instead\n", url);
+
+		for (char const* p = url; *p != '\0'; p++) {
+			if ((unsigned char)*p >= 0x80) {
+				fputs("internationalized hostnames have to be given in their ASCII form, with xn-- labels\n", stderr);
+				break;
+			}
+		}
+
+		return 0;
+	}
+
+	char* config_path;
+	FILE* const config = open_config_file(&config_path);
+
+	if (config == NULL) {
+		return 0;
+	}
+
+	enum lookup_result const alias = lookup_alias(host, host_length, config, config_path, 0, site);
+	fclose(config);
+	free(config_path);
+
+	if (alias == LOOKUP_ERROR) {
+		return 0;
+	}
+
+	if (alias == LOOKUP_NOT_FOUND) {
+		size_t const offset = get_registrable_domain(host, host_length);
+		memcpy(site, host + offset, host_length - offset + 1);
+	}
+
+	fprintf(stderr, "\x1b[36m●\x1b[0m using site %s\n", site);
+	return 1;
+}
+
+/*
+ * Applies the default entry and then the site’s entry, if any, from the configuration to a schema.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int load_schema(char const* const site_name, struct nosepass_schema* const schema) {
+	char* config_path;
+	FILE* const config = open_config_file(&config_path);
+
+	if (config == NULL) {
+		return 0;
+	}
+
+	if (lookup_schema("default", config, config_path, 0, 0, schema) == LOOKUP_ERROR) {
+		fclose(config);
+		free(config_path);
+		return 0;
+	}
+
+	if (fseek(config, 0L, SEEK_SET) != 0) {
+		perror("failed to seek configuration file");
+		fclose(config);
+		free(config_path);
+		return 0;
+	}
+
+	enum lookup_result const found = lookup_schema(site_name, config, config_path, 0, 1, schema);
+	fclose(config);
+	free(config_path);
+
+	if (found == LOOKUP_ERROR) {
+		return 0;
+	}
+
+	PROBE3(schema_resolved, schema->rounds, schema->count, schema->set_size);
+	return 1;
+}
+
+/* the shard of an entry that isn’t in one */
+#define NO_SHARD SIZE_MAX
+
+/*
+ * An entry of a configuration, as read into a config_index.
+ */
+struct config_entry {
+	/* the entry’s line, split into its name and parameters, which are NULL if it has none */
+	char* name;
+	char const* parameters;
+
+	/* the entry’s position in the configuration, and the shard it was found in, or NO_SHARD */
+	size_t order;
+	size_t shard;
+};
+
+/*
+ * A shard directive that was followed, and its file’s own default entry.
+ */
+struct config_shard {
+	char* pattern;
+	size_t pattern_length;
+	size_t parent;
+	int has_default;
+	char const* default_parameters;
+};
+
+/*
+ * Every entry of a configuration, read once with its includes and shards, so that many sites’ schemas can be looked
+ * up without rescanning it for each. A lookup gives the same schema as load_schema: the first entry for the site
+ * wins, and one in a shard whose pattern matches the site also gets the shard’s default.
+ */
+struct config_index {
+	/* sorted by name, and then by position */
+	struct config_entry* entries;
+	size_t entry_count;
+	size_t entry_capacity;
+
+	struct config_shard* shards;
+	size_t shard_count;
+	size_t shard_capacity;
+
+	int has_default;
+	char const* default_parameters;
+
+	/* the default entry applied to the library’s defaults */
+	struct nosepass_schema defaults;
+};
+
+__attribute__ ((nonnull))
+static void free_config_index(struct config_index* const index) {
+	for (size_t i = 0; i < index->entry_count; i++) {
+		free(index->entries[i].name);
+	}
+
+	for (size_t i = 0; i < index->shard_count; i++) {
+		free(index->shards[i].pattern);
+	}
+
+	free(index->entries);
+	free(index->shards);
+}
+
+__attribute__ ((nonnull, warn_unused_result))
+static int add_config_entry(struct config_index* const index, char const* const line, size_t const shard) {
+	if (index->entry_count == index->entry_capacity) {
+		size_t const capacity = index->entry_capacity == 0 ? 64 : 2 * index->entry_capacity;
+		struct config_entry* const entries = realloc(index->entries, capacity * sizeof *entries);
+
+		if (entries == NULL) {
+			fputs("failed to allocate memory\n", stderr);
+			return 0;
+		}
+
+		index->entries = entries;
+		index->entry_capacity = capacity;
+	}
+
+	char* const name = strdup(line);
+
+	if (name == NULL) {
+		fputs("failed to allocate memory\n", stderr);
+		return 0;
+	}
+
+	char* const space = strchr(name, ' ');
+	char const* parameters = NULL;
+
+	if (space != NULL) {
+		*space = '\0';
+		parameters = space + 1;
+	}
+
+	/* the first default entry of the configuration, or of a shard’s file, is the one lookups find */
+	if (strcmp(name, "default") == 0) {
+		if (shard == NO_SHARD) {
+			if (!index->has_default) {
+				index->has_default = 1;
+				index->default_parameters = parameters;
+			}
+		} else if (!index->shards[shard].has_default) {
+			index->shards[shard].has_default = 1;
+			index->shards[shard].default_parameters = parameters;
+		}
+	}
+
+	index->entries[index->entry_count] = (struct config_entry) {
+		.name = name,
+		.parameters = parameters,
+		.order = index->entry_count,
+		.shard = shard,
+	};
+
+	index->entry_count++;
+	return 1;
+}
+
+__attribute__ ((nonnull, warn_unused_result))
+static int add_config_shard(struct config_index* const index, char const* const pattern, size_t const pattern_length, size_t const parent) {
+	if (index->shard_count == index->shard_capacity) {
+		size_t const capacity = index->shard_capacity == 0 ? 8 : 2 * index->shard_capacity;
+		struct config_shard* const shards = realloc(index->shards, capacity * sizeof *shards);
+
+		if (shards == NULL) {
+			fputs("failed to allocate memory\n", stderr);
+			return 0;
+		}
+
+		index->shards = shards;
+		index->shard_capacity = capacity;
+	}
+
+	char* const pattern_copy = strndup(pattern, pattern_length);
+
+	if (pattern_copy == NULL) {
+		fputs("failed to allocate memory\n", stderr);
+		return 0;
+	}
+
+	index->shards[index->shard_count] = (struct config_shard) {
+		.pattern = pattern_copy,
+		.pattern_length = pattern_length,
+		.parent = parent,
+		.has_default = 0,
+		.default_parameters = NULL,
+	};
+
+	index->shard_count++;
+	return 1;
+}
+
+/*
+ * Reads a configuration file’s entries into an index, following its includes, and its shards as lookups of the given
+ * site names would; every shard is followed if `names` is NULL. Entries are added in the order lookups scan them,
+ * with the shard they’re in.
+ */
+__attribute__ ((nonnull (1, 2, 3), warn_unused_result))
+static int index_config_file(struct config_index* const index, FILE* const input, char const* const path, unsigned int const depth, size_t const shard, char* const* const names, size_t const name_count) {
+	char line[CONFIG_LINE_SIZE];
+
+	for (;;) {
+		enum lookup_result const read = read_config_line(input, line);
+
+		if (read != LOOKUP_FOUND) {
+			return read == LOOKUP_NOT_FOUND;
+		}
+
+		char const* target;
+		size_t target_shard = shard;
+		char** shard_names = NULL;
+		size_t shard_name_count = name_count;
+
+		if (strncmp(line, DIRECTIVE_INCLUDE, sizeof DIRECTIVE_INCLUDE - 1) == 0) {
+			target = line + (sizeof DIRECTIVE_INCLUDE - 1);
+
+			if (*target == '\0') {
+				fputs("expected path after " DIRECTIVE_INCLUDE "\n", stderr);
+				return 0;
+			}
+		} else if (strncmp(line, DIRECTIVE_SHARD, sizeof DIRECTIVE_SHARD - 1) == 0) {
+			char const* const pattern = line + (sizeof DIRECTIVE_SHARD - 1);
+			char const* const pattern_end = strchr(pattern, ' ');
+
+			if (pattern_end == NULL || pattern_end == pattern || pattern_end[1] == '\0') {
+				fprintf(stderr, "expected " DIRECTIVE_SHARD "<pattern> <path>, but found '%s' instead\n", line);
+				return 0;
+			}
+
+			size_t const pattern_length = (size_t)(pattern_end - pattern);
+			char const* const star = memchr(pattern, '*', pattern_length);
+
+			if (star != NULL && star != pattern_end - 1) {
+				fprintf(stderr, "shard pattern may only end with '*', but found '%.*s'\n", (int)pattern_length, pattern);
+				return 0;
+			}
+
+			/* like a lookup, never open a shard that can’t contain any of the names */
+			if (names != NULL) {
+				shard_names = malloc((name_count > 0 ? name_count : 1) * sizeof *shard_names);
+
+				if (shard_names == NULL) {
+					fputs("failed to allocate memory\n", stderr);
+					return 0;
+				}
+
+				shard_name_count = 0;
+
+				for (size_t i = 0; i < name_count; i++) {
+					if (shard_matches(pattern, pattern_length, names[i])) {
+						shard_names[shard_name_count++] = names[i];
+					}
+				}
+
+				if (shard_name_count == 0) {
+					free(shard_names);
+					continue;
+				}
+			}
+
+			if (!add_config_shard(index, pattern, pattern_length, shard)) {
+				free(shard_names);
+				return 0;
+			}
+
+			target = pattern_end + 1;
+			target_shard = index->shard_count - 1;
+		} else if (strncmp(line, DIRECTIVE_ALIAS, sizeof DIRECTIVE_ALIAS - 1) == 0) {
+			continue;
+		} else {
+			if (!add_config_entry(index, line, shard)) {
+				return 0;
+			}
+
+			continue;
+		}
+
+		int indexed = 0;
+
+		if (depth >= MAX_INCLUDE_DEPTH) {
+			fputs("configuration includes are nested too deeply; limit is " S(MAX_INCLUDE_DEPTH) "\n", stderr);
+		} else {
+			char* const target_path = resolve_config_path(path, target);
+
+			if (target_path != NULL) {
+				FILE* const target_file = fopen(target_path, "r");
+
+				if (target_file == NULL) {
+					fprintf(stderr, "failed to open configuration file %s: %s\n", target_path, strerror(errno));
+				} else {
+					indexed = index_config_file(index, target_file, target_path, depth + 1, target_shard, shard_names != NULL ? shard_names : names, shard_name_count);
+					fclose(target_file);
+				}
+
+				free(target_path);
+			}
+		}
+
+		free(shard_names);
+
+		if (!indexed) {
+			return 0;
+		}
+	}
+}
+
+static int compare_config_entries(void const* const a, void const* const b) {
+	struct config_entry const* const entry_a = a;
+	struct config_entry const* const entry_b = b;
+	int const names = strcmp(entry_a->name, entry_b->name);
+
+	if (names != 0) {
+		return names;
+	}
+
+	return (entry_a->order > entry_b->order) - (entry_a->order < entry_b->order);
+}
+
+/*
+ * Reads the configuration into an index for looking up the given sites, or every site if `names` is NULL.
+ */
+__attribute__ ((nonnull (1), warn_unused_result))
+static int read_config_index(struct config_index* const index, char* const* const names, size_t const name_count) {
+	*index = (struct config_index) {
+		.entries = NULL,
+		.shards = NULL,
+	};
+
+	char* config_path;
+	FILE* const config = open_config_file(&config_path);
+
+	if (config == NULL) {
+		return 0;
+	}
+
+	int const indexed = index_config_file(index, config, config_path, 0, NO_SHARD, names, name_count);
+	fclose(config);
+	free(config_path);
+
+	nosepass_schema_init(&index->defaults);
+
+	if (!indexed || (index->default_parameters != NULL && !parse_entry(index->default_parameters, &index->defaults))) {
+		free_config_index(index);
+		return 0;
+	}
+
+	if (index->entry_count != 0) {
+		qsort(index->entries, index->entry_count, sizeof *index->entries, compare_config_entries);
+	}
+
+	return 1;
+}
+
+/*
+ * Checks whether a lookup of the site would reach an entry in the shard: whether its pattern, and those of the shards
+ * it’s in, match the site.
+ */
+__attribute__ ((nonnull, pure, warn_unused_result))
+static int in_config_shard(struct config_index const* const index, size_t shard, char const* const site_name) {
+	for (; shard != NO_SHARD; shard = index->shards[shard].parent) {
+		if (!shard_matches(index->shards[shard].pattern, index->shards[shard].pattern_length, site_name)) {
+			return 0;
+		}
+	}
+
+	return 1;
+}
+
+/*
+ * Applies the default entries of a shard and the shards it’s in, outermost first, to a schema.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int apply_shard_defaults(struct config_index const* const index, size_t const shard, struct nosepass_schema* const schema) {
+	if (shard == NO_SHARD) {
+		return 1;
+	}
+
+	struct config_shard const* const s = &index->shards[shard];
+	return apply_shard_defaults(index, s->parent, schema) && (s->default_parameters == NULL || parse_entry(s->default_parameters, schema));
+}
+
+/*
+ * Looks up the site’s entry in an index, returning it, or NULL if there’s none.
+ */
+__attribute__ ((nonnull, pure, warn_unused_result))
+static struct config_entry const* find_config_entry(struct config_index const* const index, char const* const site_name) {
+	size_t low = 0;
+	size_t high = index->entry_count;
+
+	while (low < high) {
+		size_t const mid = low + (high - low) / 2;
+
+		if (strcmp(index->entries[mid].name, site_name) < 0) {
+			low = mid + 1;
+		} else {
+			high = mid;
+		}
+	}
+
+	for (size_t i = low; i < index->entry_count && strcmp(index->entries[i].name, site_name) == 0; i++) {
+		if (in_config_shard(index, index->entries[i].shard, site_name)) {
+			return &index->entries[i];
+		}
+	}
+
+	return NULL;
+}
+
+/*
+ * Looks up a site’s schema in an index, as load_schema does in the configuration.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int load_indexed_schema(struct config_index const* const index, char const* const site_name, struct nosepass_schema* const schema) {
+	*schema = index->defaults;
+
+	struct config_entry const* const entry = find_config_entry(index, site_name);
+
+	if (entry != NULL && (!apply_shard_defaults(index, entry->shard, schema) || (entry->parameters != NULL && !parse_entry(entry->parameters, schema)))) {
+		return 0;
+	}
+
+	PROBE3(schema_resolved, schema->rounds, schema->count, schema->set_size);
+	return 1;
+}
+
+static void show_entropy(double const bits) {
+	char const* const color =
+		bits >= 128.0 ? "\x1b[32m" :
+		bits >= 92.0 ? "\x1b[33m" :
+		"\x1b[31m";
+
+	fprintf(stderr, "%s●\x1b[0m generating password equivalent to %.0f bits\n", color, bits);
+}
+
+/*
+ * Prompts for the master password, read from `input`, without its line ending.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int read_master_password(char password[MASTER_PASSWORD_SIZE], size_t* const password_length, FILE* const input) {
+	if (password_read(password, MASTER_PASSWORD_SIZE, input) == NULL) {
+		fputs("failed to read password\n", stderr);
+		return 0;
+	}
+
+	size_t length = strlen(password);
+
+	if (password[length - 1] == '\n') {
+		length--;
+	} else if (length > MASTER_PASSWORD_SIZE - 2) {
+		/* avoid silent truncation at 1023 characters */
+		fputs("the maximum password length is " S(MASTER_PASSWORD_LIMIT) " characters\n", stderr);
+		return 0;
+	}
+
+	if (length == 0) {
+		fputs("a password is required\n", stderr);
+		return 0;
+	}
+
+	*password_length = length;
+	return 1;
+}
+
+__attribute__ ((nonnull, warn_unused_result))
+static int write_password(char const* const password, size_t const length) {
+	if (fwrite(password, sizeof(char), length, stdout) != length) {
+		fputs("failed to write output\n", stderr);
+		return 0;
+	}
+
+	fflush(stdout);
+	fputc('\n', stderr);
+	PROBE1(output_written, length);
+	return 1;
+}
+
+/*
+ * Everything secret that a derivation from the command line holds, in the only slot of a secure arena.
+ */
+struct secrets {
+	char password[MASTER_PASSWORD_SIZE];
+	size_t password_length;
+	uint8_t key[NOSEPASS_KEY_SIZE];
+	struct nosepass_derivation derivation;
+	struct nosepass_checkpoint checkpoint;
+
+	/* the check value read with a checkpoint, and the one the master password gives */
+	uint8_t stored_check[CHECKPOINT_CHECK_SIZE];
+	uint8_t check[CHECKPOINT_CHECK_SIZE];
+
+	char generated_password[NOSEPASS_MAX_COUNT];
+};
+
+/*
+ * Maps a secure arena for a command’s secrets, which secure_arena_destroy wipes along with it.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static struct secrets* create_secrets(struct secure_arena** const arena) {
+	if ((*arena = secure_arena_create(sizeof(struct secrets), 1)) == NULL) {
+		return NULL;
+	}
+
+	/* the arena’s only slot, which can’t be taken already */
+	return secure_alloc(*arena);
+}
+
+/* the phases the program times itself, around the library’s */
+enum stats_phase {
+	STATS_CONFIG,
+	STATS_PASSWORD,
+	STATS_OUTPUT,
+	STATS_PHASE_COUNT,
+};
+
+/*
+ * Where a derivation’s time went, for --stats.
+ */
+struct stats {
+	uint64_t wall_ns[STATS_PHASE_COUNT];
+	uint64_t cpu_ns[STATS_PHASE_COUNT];
+	struct nosepass_profile profile;
+};
+
+/*
+ * A reading of the wall-clock and process CPU clocks at the start of a phase.
+ */
+struct stats_mark {
+	struct timespec wall;
+	struct timespec cpu;
+};
+
+__attribute__ ((nonnull))
+static void stats_start(struct stats_mark* const mark) {
+	clock_gettime(CLOCK_MONOTONIC, &mark->wall);
+	clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &mark->cpu);
+}
+
+__attribute__ ((nonnull, pure, warn_unused_result))
+static uint64_t elapsed_ns(struct timespec const* const start, struct timespec const* const end) {
+	return (uint64_t)(end->tv_sec - start->tv_sec) * UINT64_C(1000000000) + (uint64_t)end->tv_nsec - (uint64_t)start->tv_nsec;
+}
+
+/*
+ * Adds the time since a phase started to it.
+ */
+__attribute__ ((nonnull))
+static void stats_stop(struct stats* const stats, enum stats_phase const phase, struct stats_mark const* const start) {
+	struct stats_mark end;
+	stats_start(&end);
+
+	stats->wall_ns[phase] += elapsed_ns(&start->wall, &end.wall);
+	stats->cpu_ns[phase] += elapsed_ns(&start->cpu, &end.cpu);
+}
+
+/*
+ * Reports each phase’s wall-clock and CPU time, the keystream consumed, and peak memory use, as text or as one line of
+ * JSON. The password phase includes the time spent typing it.
+ */
+__attribute__ ((nonnull))
+static void show_stats(enum stats_format const format, struct stats const* const stats, struct nosepass_schema const* const schema) {
+	struct {
+		char const* name;
+		uint64_t wall_ns;
+		uint64_t cpu_ns;
+	} const phases[] = {
+		{"config", stats->wall_ns[STATS_CONFIG], stats->cpu_ns[STATS_CONFIG]},
+		{"password", stats->wall_ns[STATS_PASSWORD], stats->cpu_ns[STATS_PASSWORD]},
+		{"sha512", stats->profile.wall_ns[NOSEPASS_PHASE_SHA512], stats->profile.cpu_ns[NOSEPASS_PHASE_SHA512]},
+		{"blowfish", stats->profile.wall_ns[NOSEPASS_PHASE_BLOWFISH], stats->profile.cpu_ns[NOSEPASS_PHASE_BLOWFISH]},
+		{"keystream", stats->profile.wall_ns[NOSEPASS_PHASE_KEYSTREAM], stats->profile.cpu_ns[NOSEPASS_PHASE_KEYSTREAM]},
+		{"sampling", stats->profile.wall_ns[NOSEPASS_PHASE_SAMPLING], stats->profile.cpu_ns[NOSEPASS_PHASE_SAMPLING]},
+		{"output", stats->wall_ns[STATS_OUTPUT], stats->cpu_ns[STATS_OUTPUT]},
+	};
+	size_t const phase_count = sizeof phases / sizeof phases[0];
+
+	struct rusage usage;
+	long long const peak_rss = getrusage(RUSAGE_SELF, &usage) == 0 ? (long long)usage.ru_maxrss * 1024 : 0;
+
+	uint64_t const sampled = stats->profile.bytes_sampled;
+	uint64_t const rejected = stats->profile.bytes_rejected;
+	double const rejection_rate = sampled != 0 ? (double)rejected / (double)sampled : 0.0;
+	double const expected_rejection_rate = nosepass_rejection_rate(schema);
+
+	if (format == STATS_JSON) {
+		fputs("{\"phases\":{", stderr);
+
+		for (size_t i = 0; i < phase_count; i++) {
+			fprintf(stderr, "%s\"%s\":{\"wall_ns\":%" PRIu64 ",\"cpu_ns\":%" PRIu64 "}", i == 0 ? "" : ",", phases[i].name, phases[i].wall_ns, phases[i].cpu_ns);
+		}
+
+		fprintf(stderr, "},\"keystream_blocks\":%" PRIu64 ",\"bytes_sampled\":%" PRIu64 ",\"bytes_rejected\":%" PRIu64 ",\"rejection_rate\":%.4f,\"expected_rejection_rate\":%.4f,\"set_size\":%u,\"peak_rss_bytes\":%lld}\n",
+			stats->profile.keystream_blocks, sampled, rejected, rejection_rate, expected_rejection_rate, (unsigned int)schema->set_size, peak_rss);
+		return;
+	}
+
+	fputs("\x1b[36m●\x1b[0m time by phase, wall and CPU:\n", stderr);
+
+	for (size_t i = 0; i < phase_count; i++) {
+		fprintf(stderr, "  %-9s %12.3f ms %12.3f ms\n", phases[i].name, (double)phases[i].wall_ns / 1e6, (double)phases[i].cpu_ns / 1e6);
+	}
+
+	fprintf(stderr, "\x1b[36m●\x1b[0m %" PRIu64 " keystream block%s; %" PRIu64 " of %" PRIu64 " bytes rejected (%.1f%%, %.1f%% expected for %u characters)\n",
+		stats->profile.keystream_blocks, stats->profile.keystream_blocks == 1 ? "" : "s", rejected, sampled, 100.0 * rejection_rate, 100.0 * expected_rejection_rate, (unsigned int)schema->set_size);
+	fprintf(stderr, "\x1b[36m●\x1b[0m peak RSS %.1f MiB\n", (double)peak_rss / (1024.0 * 1024.0));
+}
+
+_Static_assert(NOSEPASS_MAX_COUNT <= AGENT_OUTPUT_SIZE, "generated passwords fit in agent output");
+_Static_assert(NOSEPASS_KEY_SIZE == AGENT_KEY_SIZE, "agent keys are site keys");
+_Static_assert(MASTER_PASSWORD_SIZE == AGENT_PASSWORD_SIZE, "agent holds a master password");
+
+__attribute__ ((nonnull, warn_unused_result))
+static size_t handle_agent_request(struct agent* const agent, char const* const site_name, char* const output, double* const bits, unsigned int* const rounds) {
+	struct nosepass_schema schema;
+	nosepass_schema_init(&schema);
+
+	if (!load_schema(site_name, &schema)) {
+		return 0;
+	}
+
+	uint8_t key[NOSEPASS_KEY_SIZE];
+
+	if (!agent_get_key(agent, site_name, &schema, key)) {
+		return 0;
+	}
+
+	enum nosepass_status const status = nosepass_generate(key, &schema, output, AGENT_OUTPUT_SIZE);
+	explicit_bzero(key, sizeof key);
+
+	if (status != NOSEPASS_OK) {
+		fprintf(stderr, "%s\n", nosepass_strerror(status));
+		return 0;
+	}
+
+	*bits = nosepass_entropy_bits(&schema);
+	*rounds = schema.rounds;
+	return schema.count;
+}
+
+__attribute__ ((nonnull, warn_unused_result))
+static int run_agent(struct options const* const options) {
+	char const* socket_path = getenv(AGENT_SOCKET_VARIABLE);
+	char* default_socket_path = NULL;
+
+	if (socket_path == NULL || socket_path[0] == '\0') {
+		char const* const runtime_path = getenv("XDG_RUNTIME_DIR");
+
+		if (runtime_path == NULL || runtime_path[0] == '\0') {
+			fputs(AGENT_SOCKET_VARIABLE " or XDG_RUNTIME_DIR must be set to choose the agent socket\n", stderr);
+			return 0;
+		}
+
+		size_t const runtime_path_length = strlen(runtime_path);
+
+		if ((default_socket_path = malloc(runtime_path_length + sizeof AGENT_SOCKET_NAME)) == NULL) {
+			fputs("failed to allocate memory\n", stderr);
+			return 0;
+		}
+
+		memcpy(default_socket_path, runtime_path, runtime_path_length);
+		memcpy(default_socket_path + runtime_path_length, AGENT_SOCKET_NAME, sizeof AGENT_SOCKET_NAME);
+		socket_path = default_socket_path;
+	}
+
+	struct agent_options const agent_options = {
+		.socket_path = socket_path,
+		.timeout = options->agent_timeout,
+		.cache_keys = options->agent_cache,
+	};
+
+	struct agent* const agent = agent_create(&agent_options);
+	int result = 0;
+
+	if (agent != NULL) {
+		size_t password_length;
+
+		if (read_master_password(agent_password(agent), &password_length, stdin)) {
+			agent_set_password_length(agent, password_length);
+			result = agent_serve(agent, handle_agent_request);
+		}
+
+		agent_destroy(agent);
+	}
+
+	free(default_socket_path);
+	return result;
+}
+
+/*
+ * Merges histogram snapshots from agents and prints their percentiles.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int show_histogram_snapshots(struct options const* const options) {
+	struct histograms* const histograms = histograms_create();
+
+	if (histograms == NULL) {
+		return 0;
+	}
+
+	int result = 1;
+
+	for (size_t i = 0; result && i < options->histogram_path_count; i++) {
+		result = histograms_merge(histograms, options->histogram_paths[i]);
+	}
+
+	if (result) {
+		histograms_print(histograms, stdout);
+	}
+
+	histograms_destroy(histograms);
+	return result;
+}
+
+__attribute__ ((nonnull, warn_unused_result))
+static int write_tagged_password(unsigned int const rounds, char const* const password, size_t const length) {
+	if (printf("rounds=%u ", rounds) < 0 || fwrite(password, sizeof(char), length, stdout) != length || putchar('\n') == EOF) {
+		fputs("failed to write output\n", stderr);
+		return 0;
+	}
+
+	fflush(stdout);
+	PROBE1(output_written, length);
+	return 1;
+}
+
+/*
+ * Derives a site’s passwords for each of several rounds values in a single pass, starting from and then updating a
+ * checkpoint file if one was given.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int derive_rounds(struct options const* const options, char const* const site_name, struct nosepass_schema const* const schema, struct secrets* const secrets, struct stats* const stats) {
+	unsigned int const* targets = options->rounds;
+	size_t target_count = options->rounds_count;
+
+	if (target_count == 0) {
+		targets = &schema->rounds;
+		target_count = 1;
+	}
+
+	enum checkpoint_result loaded = CHECKPOINT_NOT_FOUND;
+
+	if (options->checkpoint_path != NULL) {
+		loaded = checkpoint_load(options->checkpoint_path, site_name, schema, &secrets->checkpoint, secrets->stored_check);
+
+		if (loaded == CHECKPOINT_ERROR) {
+			return 0;
+		}
+
+		if (loaded == CHECKPOINT_FOUND && secrets->checkpoint.rounds > targets[0]) {
+			fprintf(stderr, "checkpoint is at %u rounds, past rounds=%u\n", secrets->checkpoint.rounds, targets[0]);
+			return 0;
+		}
+	}
+
+	struct stats_mark mark;
+	stats_start(&mark);
+
+	if (!read_master_password(secrets->password, &secrets->password_length, stdin)) {
+		return 0;
+	}
+
+	stats_stop(stats, STATS_PASSWORD, &mark);
+
+	struct nosepass_schema first_schema = *schema;
+	first_schema.rounds = targets[0];
+
+	enum nosepass_status started = nosepass_derivation_init_site(&secrets->derivation, secrets->password, secrets->password_length, site_name, strlen(site_name), &first_schema, secrets->key);
+
+	if (started == NOSEPASS_OK && loaded == CHECKPOINT_FOUND) {
+		started = nosepass_derivation_restore(&secrets->derivation, &secrets->checkpoint);
+
+		if (started == NOSEPASS_OK) {
+			started = checkpoint_check(&secrets->derivation, secrets->key, secrets->check);
+		}
+
+		/* a mistyped master password would go on from the checkpoint to wrong passwords, and replace it */
+		if (started == NOSEPASS_OK && !checkpoint_check_matches(secrets->stored_check, secrets->check)) {
+			fputs("the master password doesn’t match the checkpoint\n", stderr);
+			return 0;
+		}
+
+		/* the check ran the round after the checkpoint, which is past the first rounds value if it’s the checkpoint’s */
+		if (started == NOSEPASS_OK && nosepass_derivation_completed(&secrets->derivation) > targets[0]) {
+			started = nosepass_derivation_finish(&secrets->derivation);
+
+			if (started == NOSEPASS_OK) {
+				started = nosepass_derivation_init_site(&secrets->derivation, secrets->password, secrets->password_length, site_name, strlen(site_name), &first_schema, secrets->key);
+			}
+
+			if (started == NOSEPASS_OK) {
+				started = nosepass_derivation_restore(&secrets->derivation, &secrets->checkpoint);
+			}
+		}
+	}
+
+	if (started != NOSEPASS_OK) {
+		fprintf(stderr, "%s\n", nosepass_strerror(started));
+		return 0;
+	}
+
+	if (options->stats != STATS_NONE) {
+		nosepass_derivation_set_profile(&secrets->derivation, &stats->profile);
+	}
+
+	int result = 1;
+
+	for (size_t i = 0; result && i < target_count; i++) {
+		enum nosepass_status status = nosepass_derivation_extend(&secrets->derivation, targets[i]);
+
+		if (status == NOSEPASS_OK) {
+			while (nosepass_derivation_step(&secrets->derivation, UINT_MAX)) {}
+
+			status =
+				options->stats != STATS_NONE
+					? nosepass_generate_profiled(secrets->key, schema, secrets->generated_password, sizeof secrets->generated_password, &stats->profile)
+					: nosepass_generate(secrets->key, schema, secrets->generated_password, sizeof secrets->generated_password);
+		}
+
+		stats_start(&mark);
+
+		if (status != NOSEPASS_OK) {
+			fprintf(stderr, "%s\n", nosepass_strerror(status));
+			result = 0;
+		} else if (options->rounds_count == 0) {
+			result = write_password(secrets->generated_password, schema->count);
+		} else {
+			result = write_tagged_password(targets[i], secrets->generated_password, schema->count);
+		}
+
+		stats_stop(stats, STATS_OUTPUT, &mark);
+	}
+
+	if (result && options->checkpoint_path != NULL) {
+		/* the check runs the round after the checkpoint, so it’s saved first */
+		result =
+			nosepass_derivation_save(&secrets->derivation, &secrets->checkpoint) == NOSEPASS_OK
+			&& checkpoint_check(&secrets->derivation, secrets->key, secrets->check) == NOSEPASS_OK
+			&& checkpoint_store(options->checkpoint_path, site_name, schema, &secrets->checkpoint, secrets->check);
+	}
+
+	enum nosepass_status const finished = nosepass_derivation_finish(&secrets->derivation);
+
+	if (result && finished != NOSEPASS_OK) {
+		fprintf(stderr, "%s\n", nosepass_strerror(finished));
+		result = 0;
+	}
+
+	return result;
+}
+
+/*
+ * Derives a site’s password, or its passwords for several rounds values.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int derive_site(struct options const* const options, char const* const site_name, struct nosepass_schema const* const schema, struct stats* const stats) {
+	struct secure_arena* arena;
+	struct secrets* const secrets = create_secrets(&arena);
+
+	if (secrets == NULL) {
+		return 0;
+	}
+
+	if (options->rounds_count != 0 || options->checkpoint_path != NULL) {
+		/* lanes run in turn can’t be extended or checkpointed */
+		if (schema->lanes > 1) {
+			fputs("--rounds and --checkpoint can’t be used with lanes=\n", stderr);
+			secure_arena_destroy(arena);
+			return 0;
+		}
+
+		int const result = derive_rounds(options, site_name, schema, secrets, stats);
+		secure_arena_destroy(arena);
+		return result;
+	}
+
+	struct stats_mark mark;
+	stats_start(&mark);
+
+	if (!read_master_password(secrets->password, &secrets->password_length, stdin)) {
+		secure_arena_destroy(arena);
+		return 0;
+	}
+
+	stats_stop(stats, STATS_PASSWORD, &mark);
+
+	struct nosepass_profile* const profile = options->stats != STATS_NONE ? &stats->profile : NULL;
+	enum nosepass_status status;
+
+	if (schema->lanes > 1) {
+		/* each lane on a thread of its own, so that they take about as long as one */
+		status = lanes_derive_key(secrets->password, secrets->password_length, site_name, strlen(site_name), schema, profile, secrets->key);
+
+		if (status == NOSEPASS_OK && schema->group_length != 0) {
+			status = nosepass_expand_key(secrets->key, site_name, strlen(site_name), secrets->key);
+		}
+	} else if ((status = nosepass_derivation_init_site(&secrets->derivation, secrets->password, secrets->password_length, site_name, strlen(site_name), schema, secrets->key)) == NOSEPASS_OK) {
+		/* run as a derivation, so that the KDF’s state between rounds is in the arena too */
+		if (profile != NULL) {
+			nosepass_derivation_set_profile(&secrets->derivation, profile);
+		}
+
+		while (nosepass_derivation_step(&secrets->derivation, UINT_MAX)) {}
+
+		status = nosepass_derivation_finish(&secrets->derivation);
+	}
+
+	if (status == NOSEPASS_OK) {
+		status =
+			options->stats != STATS_NONE
+				? nosepass_generate_profiled(secrets->key, schema, secrets->generated_password, sizeof secrets->generated_password, &stats->profile)
+				: nosepass_generate(secrets->key, schema, secrets->generated_password, sizeof secrets->generated_password);
+	}
+
+	int result = 0;
+
+	if (status != NOSEPASS_OK) {
+		fprintf(stderr, "%s\n", nosepass_strerror(status));
+	} else {
+		stats_start(&mark);
+		result = write_password(secrets->generated_password, schema->count);
+		stats_stop(stats, STATS_OUTPUT, &mark);
+	}
+
+	secure_arena_destroy(arena);
+	return result;
+}
+
+struct site_list {
+	struct batch_job* jobs;
+
+	/* the jobs’ site names, owned by the list */
+	char** names;
+
+	size_t count;
+	size_t capacity;
+};
+
+__attribute__ ((nonnull))
+static void free_site_list(struct site_list* const sites) {
+	for (size_t i = 0; i < sites->count; i++) {
+		free(sites->names[i]);
+	}
+
+	free(sites->jobs);
+	free(sites->names);
+}
+
+/*
+ * Drops the sites outside a shard of the list.
+ */
+__attribute__ ((nonnull))
+static void keep_shard(struct site_list* const sites, unsigned int const shard_index, unsigned int const shard_count) {
+	size_t kept = 0;
+
+	for (size_t i = 0; i < sites->count; i++) {
+		if (batch_shard(sites->names[i], shard_count) == shard_index) {
+			sites->jobs[kept] = sites->jobs[i];
+			sites->names[kept] = sites->names[i];
+			kept++;
+		} else {
+			free(sites->names[i]);
+		}
+	}
+
+	sites->count = kept;
+}
+
+__attribute__ ((nonnull))
+static void init_site_list(struct site_list* const sites) {
+	sites->jobs = NULL;
+	sites->names = NULL;
+	sites->count = 0;
+	sites->capacity = 0;
+}
+
+/*
+ * Adds a site to a list, without its schema.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int append_site(struct site_list* const sites, char const* const site_name, size_t const site_name_length) {
+	if (sites->count == sites->capacity) {
+		size_t const capacity = sites->capacity == 0 ? 64 : 2 * sites->capacity;
+		struct batch_job* const jobs = realloc(sites->jobs, capacity * sizeof *jobs);
+
+		if (jobs != NULL) {
+			sites->jobs = jobs;
+		}
+
+		char** const names = realloc(sites->names, capacity * sizeof *names);
+
+		if (names != NULL) {
+			sites->names = names;
+		}
+
+		if (jobs == NULL || names == NULL) {
+			fputs("failed to allocate memory\n", stderr);
+			return 0;
+		}
+
+		sites->capacity = capacity;
+	}
+
+	char* const name = strndup(site_name, site_name_length);
+
+	if (name == NULL) {
+		fputs("failed to allocate memory\n", stderr);
+		return 0;
+	}
+
+	sites->names[sites->count] = name;
+	sites->jobs[sites->count].site_name = name;
+	sites->count++;
+	return 1;
+}
+
+/*
+ * Looks up the schema of every site in a list, reading the configuration once.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int load_site_schemas(struct site_list* const sites, int const every_shard) {
+	struct config_index index;
+
+	if (!read_config_index(&index, every_shard ? NULL : sites->names, sites->count)) {
+		return 0;
+	}
+
+	for (size_t i = 0; i < sites->count; i++) {
+		if (!load_indexed_schema(&index, sites->jobs[i].site_name, &sites->jobs[i].schema)) {
+			fprintf(stderr, "(for site '%s')\n", sites->jobs[i].site_name);
+			free_config_index(&index);
+			return 0;
+		}
+	}
+
+	free_config_index(&index);
+	return 1;
+}
+
+/*
+ * Reads site names, one per line, and looks up each one’s schema.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int read_site_list(FILE* const input, struct site_list* const sites) {
+	char* line = NULL;
+	size_t line_size = 0;
+	ssize_t line_length;
+
+	init_site_list(sites);
+
+	while ((line_length = getline(&line, &line_size, input)) != -1) {
+		if (line_length > 0 && line[line_length - 1] == '\n') {
+			line[--line_length] = '\0';
+		}
+
+		if (line_length == 0) {
+			continue;
+		}
+
+		if (!append_site(sites, line, (size_t)line_length)) {
+			free(line);
+			return 0;
+		}
+	}
+
+	free(line);
+
+	if (ferror(input)) {
+		fputs("failed to read site names\n", stderr);
+		return 0;
+	}
+
+	return sites->count == 0 || load_site_schemas(sites, 0);
+}
+
+/*
+ * Where a batch’s passwords go: standard output, or an output file kept with a journal.
+ */
+struct batch_writer {
+	struct journal* journal;
+
+	/* the jobs being run, and each one’s index in the site list */
+	struct batch_job* jobs;
+	size_t* indices;
+
+	/* room for the longest line */
+	char* line;
+
+	/* which sites’ passwords are written, by index in the site list */
+	uint8_t* done;
+};
+
+static int write_batch_password(void* const context, struct batch_job const* const job, char const* const password, enum nosepass_status const status) {
+	struct batch_writer const* const writer = context;
+
+	size_t const index = writer->indices[job - writer->jobs];
+
+	if (password == NULL) {
+		fprintf(stderr, "%s: %s\n", job->site_name, nosepass_strerror(status));
+		return 1;
+	}
+
+	if (writer->journal != NULL) {
+		size_t const site_name_length = strlen(job->site_name);
+		size_t const length = site_name_length + job->schema.count + 2;
+
+		memcpy(writer->line, job->site_name, site_name_length);
+		writer->line[site_name_length] = ' ';
+		memcpy(writer->line + site_name_length + 1, password, job->schema.count);
+		writer->line[length - 1] = '\n';
+
+		int const appended = journal_append(writer->journal, index, writer->line, length);
+		explicit_bzero(writer->line, length);
+		writer->done[index] = (uint8_t)appended;
+		PROBE1(output_written, job->schema.count);
+		return appended;
+	}
+
+	if (fputs(job->site_name, stdout) == EOF || putchar(' ') == EOF || fwrite(password, sizeof(char), job->schema.count, stdout) != job->schema.count || putchar('\n') == EOF) {
+		fputs("failed to write output\n", stderr);
+		return 0;
+	}
+
+	writer->done[index] = 1;
+	PROBE1(output_written, job->schema.count);
+	return 1;
+}
+
+/*
+ * Prompts for the master password of a batch, from the terminal if the site names are coming from standard input.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int read_batch_password(int const from_stdin, char password[MASTER_PASSWORD_SIZE], size_t* const password_length) {
+	FILE* const terminal = from_stdin ? fopen("/dev/tty", "r") : stdin;
+
+	if (terminal == NULL) {
+		perror("failed to open terminal to read password");
+		return 0;
+	}
+
+	int const read = read_master_password(password, password_length, terminal);
+
+	if (from_stdin) {
+		fclose(terminal);
+	}
+
+	return read;
+}
+
+struct site_reader {
+	FILE* input;
+	char* line;
+	size_t line_size;
+
+	/* the shard of sites to read, or a count of 0 for all of them */
+	unsigned int shard_index;
+	unsigned int shard_count;
+};
+
+static int read_stream_site(void* const context, char site_name[STREAM_SITE_SIZE], struct nosepass_schema* const schema) {
+	struct site_reader* const reader = context;
+	ssize_t line_length;
+
+	do {
+		if ((line_length = getline(&reader->line, &reader->line_size, reader->input)) == -1) {
+			if (ferror(reader->input)) {
+				fputs("failed to read site names\n", stderr);
+				return -1;
+			}
+
+			return 0;
+		}
+
+		if (line_length > 0 && reader->line[line_length - 1] == '\n') {
+			reader->line[--line_length] = '\0';
+		}
+	} while (line_length == 0 || (reader->shard_count != 0 && batch_shard(reader->line, reader->shard_count) != reader->shard_index));
+
+	if ((size_t)line_length >= STREAM_SITE_SIZE) {
+		fprintf(stderr, "the maximum site name length is %d characters\n", STREAM_SITE_SIZE - 1);
+		return -1;
+	}
+
+	memcpy(site_name, reader->line, (size_t)line_length + 1);
+	nosepass_schema_init(schema);
+
+	if (!load_schema(site_name, schema)) {
+		fprintf(stderr, "(for site '%s')\n", site_name);
+		return -1;
+	}
+
+	return 1;
+}
+
+/*
+ * Streams a batch through a fixed amount of memory, writing its passwords in input order.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int run_stream(struct options const* const options, FILE* const input, int const from_stdin) {
+	struct secure_arena* arena;
+	struct secrets* const secrets = create_secrets(&arena);
+
+	if (secrets == NULL) {
+		return 0;
+	}
+
+	if (!read_batch_password(from_stdin, secrets->password, &secrets->password_length)) {
+		secure_arena_destroy(arena);
+		return 0;
+	}
+
+	unsigned int const thread_count = options->batch_threads != 0 ? options->batch_threads : batch_default_thread_count();
+	fprintf(stderr, "\x1b[36m●\x1b[0m streaming passwords in input order on %u thread%s\n", thread_count, thread_count == 1 ? "" : "s");
+
+	struct site_reader reader = {
+		.input = input,
+		.line = NULL,
+		.line_size = 0,
+		.shard_index = options->batch_shard_index,
+		.shard_count = options->batch_shard_count,
+	};
+
+	int const result = stream_run(read_stream_site, &reader, secrets->password, secrets->password_length, thread_count, STDOUT_FILENO);
+	secure_arena_destroy(arena);
+	free(reader.line);
+	return result;
+}
+
+__attribute__ ((nonnull))
+static void format_duration(double const seconds, char out[32]) {
+	if (seconds < 60.0) {
+		snprintf(out, 32, "%.1fs", seconds);
+		return;
+	}
+
+	unsigned long long const whole = (unsigned long long)(seconds + 0.5);
+
+	if (whole < 3600) {
+		snprintf(out, 32, "%llum%02llus", whole / 60, whole % 60);
+	} else {
+		snprintf(out, 32, "%lluh%02llum%02llus", whole / 3600, whole / 60 % 60, whole % 60);
+	}
+}
+
+/*
+ * Reports how long a batch is expected to take, before it starts.
+ */
+static void show_batch_prediction(size_t const site_count, unsigned int const thread_count, double const seconds) {
+	char duration[32];
+	char finish[16] = "";
+	time_t const finish_time = time(NULL) + (time_t)seconds;
+	struct tm finish_local;
+
+	format_duration(seconds, duration);
+
+	if (localtime_r(&finish_time, &finish_local) != NULL) {
+		strftime(finish, sizeof finish, " (%H:%M:%S)", &finish_local);
+	}
+
+	fprintf(stderr, "\x1b[36m●\x1b[0m deriving %zu passwords on %u thread%s, longest first; expected to finish in %s%s\n", site_count, thread_count, thread_count == 1 ? "" : "s", duration, finish);
+}
+
+/*
+ * Frees the writer’s jobs, indices, line and record of done sites, but not the writer itself.
+ */
+__attribute__ ((nonnull))
+static void free_batch_writer(struct batch_writer* const writer) {
+	free(writer->jobs);
+	free(writer->indices);
+	free(writer->line);
+	free(writer->done);
+}
+
+/*
+ * Collects the jobs not yet marked as done, with their indices in the site list, and makes room for the longest output
+ * line. The writer owns what it’s given even on failure.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int select_remaining_jobs(struct site_list const* const sites, struct batch_writer* const writer, size_t* const job_count) {
+	size_t const count = sites->count != 0 ? sites->count : 1;
+	struct batch_job* const jobs = malloc(count * sizeof *jobs);
+	size_t* const indices = malloc(count * sizeof *indices);
+	size_t longest_site_name = 0;
+
+	writer->jobs = jobs;
+	writer->indices = indices;
+
+	if (jobs == NULL || indices == NULL) {
+		fputs("failed to allocate memory\n", stderr);
+		return 0;
+	}
+
+	*job_count = 0;
+
+	for (size_t i = 0; i < sites->count; i++) {
+		if (!writer->done[i]) {
+			size_t const site_name_length = strlen(sites->names[i]);
+
+			if (site_name_length > longest_site_name) {
+				longest_site_name = site_name_length;
+			}
+
+			jobs[*job_count] = sites->jobs[i];
+			indices[*job_count] = i;
+			++*job_count;
+		}
+	}
+
+	if ((writer->line = malloc(longest_site_name + NOSEPASS_MAX_COUNT + 2)) == NULL) {
+		fputs("failed to allocate memory\n", stderr);
+		return 0;
+	}
+
+	return 1;
+}
+
+/*
+ * Derives a batch’s jobs on worker processes, outputting them in order.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int derive_on_workers(struct options const* const options, struct batch_writer* const writer, size_t const job_count, char const* const password, size_t const password_length) {
+	unsigned int const worker_count = options->batch_workers + (unsigned int)options->batch_worker_command_count;
+	char const** const commands = malloc(worker_count * sizeof *commands);
+
+	if (commands == NULL) {
+		fputs("failed to allocate memory\n", stderr);
+		return 0;
+	}
+
+	for (unsigned int i = 0; i < options->batch_workers; i++) {
+		commands[i] = NULL;
+	}
+
+	memcpy(commands + options->batch_workers, options->batch_worker_commands, options->batch_worker_command_count * sizeof *commands);
+	fprintf(stderr, "\x1b[36m●\x1b[0m deriving %zu passwords on %u worker process%s\n", job_count, worker_count, worker_count == 1 ? "" : "es");
+
+	struct timespec start;
+	struct timespec end;
+	clock_gettime(CLOCK_MONOTONIC, &start);
+
+	int const result = workers_run(commands, worker_count, writer->jobs, job_count, password, password_length, write_batch_password, writer);
+	free(commands);
+
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	char duration[32];
+	format_duration((double)(end.tv_sec - start.tv_sec) + (double)(end.tv_nsec - start.tv_nsec) / 1e9, duration);
+	fprintf(stderr, "\x1b[36m●\x1b[0m finished in %s\n", duration);
+
+	return result;
+}
+
+/*
+ * Maps a batch’s secrets and prompts for the master password, reporting any problem.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static struct secrets* read_batch_secrets(int const from_stdin, struct secure_arena** const arena) {
+	struct secrets* const secrets = create_secrets(arena);
+
+	if (secrets == NULL) {
+		return NULL;
+	}
+
+	if (!read_batch_password(from_stdin, secrets->password, &secrets->password_length)) {
+		secure_arena_destroy(*arena);
+		return NULL;
+	}
+
+	return secrets;
+}
+
+/*
+ * Gets the cost, in rounds, of the cheapest site in a list to derive, which its journal’s verifier is derived with.
+ */
+__attribute__ ((nonnull, pure, warn_unused_result))
+static unsigned int fewest_rounds(struct site_list const* const sites) {
+	unsigned int fewest = sites->count != 0 ? UINT_MAX : 1;
+
+	for (size_t i = 0; i < sites->count; i++) {
+		struct nosepass_schema const* const schema = &sites->jobs[i].schema;
+		unsigned int const rounds = schema->rounds <= UINT_MAX / schema->lanes ? schema->rounds * schema->lanes : UINT_MAX;
+
+		if (rounds < fewest) {
+			fewest = rounds;
+		}
+	}
+
+	return fewest;
+}
+
+/*
+ * Derives a batch’s jobs longest-first.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int derive_batch(struct options const* const options, struct batch_writer* const writer, size_t const job_count, char const* const master_password, size_t const master_password_length) {
+	if (has_workers(options)) {
+		return derive_on_workers(options, writer, job_count, master_password, master_password_length);
+	}
+
+	unsigned int const cpu_count = batch_default_thread_count();
+	struct batch_schedule schedule;
+
+	if (!batch_schedule(writer->jobs, job_count, options->batch_threads != 0 ? options->batch_threads : cpu_count, &schedule)) {
+		return 0;
+	}
+
+	if (!placement_choose(options->batch_placement, schedule.thread_count, &schedule.cpus)) {
+		batch_schedule_free(&schedule);
+		return 0;
+	}
+
+	/* threads beyond the available CPUs share them */
+	double const slowdown = schedule.thread_count > cpu_count ? (double)schedule.thread_count / cpu_count : 1.0;
+	show_batch_prediction(job_count, schedule.thread_count, (double)schedule.makespan * batch_calibrate() * slowdown);
+
+	/* started last, so that it times the batch alone */
+	if (options->batch_trace_path != NULL && (schedule.trace = trace_create(schedule.thread_count)) == NULL) {
+		batch_schedule_free(&schedule);
+		return 0;
+	}
+
+	struct timespec start;
+	struct timespec end;
+	clock_gettime(CLOCK_MONOTONIC, &start);
+
+	int result = batch_run(&schedule, writer->jobs, master_password, master_password_length, write_batch_password, writer);
+
+	clock_gettime(CLOCK_MONOTONIC, &end);
+
+	char duration[32];
+	format_duration((double)(end.tv_sec - start.tv_sec) + (double)(end.tv_nsec - start.tv_nsec) / 1e9, duration);
+	fprintf(stderr, "\x1b[36m●\x1b[0m finished in %s\n", duration);
+
+	if (schedule.trace != NULL) {
+		if (trace_write(schedule.trace, writer->jobs, schedule.cpus, options->batch_trace_path)) {
+			fprintf(stderr, "\x1b[36m●\x1b[0m trace written to %s\n", options->batch_trace_path);
+		} else {
+			result = 0;
+		}
+
+		trace_destroy(schedule.trace);
+	}
+
+	batch_schedule_free(&schedule);
+
+	return result;
+}
+
+/*
+ * Hashes each site’s resolved schema for the manifest and, for --changed-only, marks the sites whose schema hasn’t
+ * changed since their password was last derived as done.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int hash_schemas(struct options const* const options, struct site_list const* const sites, uint8_t* const done, uint64_t** const hashes) {
+	if ((*hashes = malloc((sites->count != 0 ? sites->count : 1) * sizeof **hashes)) == NULL) {
+		fputs("failed to allocate memory\n", stderr);
+		return 0;
+	}
+
+	for (size_t i = 0; i < sites->count; i++) {
+		(*hashes)[i] = manifest_hash(sites->names[i], &sites->jobs[i].schema);
+	}
+
+	if (!options->batch_changed_only) {
+		return 1;
+	}
+
+	struct manifest manifest;
+
+	if (!manifest_load(options->batch_manifest_path, &manifest)) {
+		return 0;
+	}
+
+	size_t unchanged = 0;
+
+	for (size_t i = 0; i < sites->count; i++) {
+		if (!done[i] && manifest_contains(&manifest, sites->names[i], (*hashes)[i])) {
+			done[i] = 1;
+			unchanged++;
+		}
+	}
+
+	manifest_free(&manifest);
+	fprintf(stderr, "\x1b[36m●\x1b[0m %zu of %zu sites unchanged since they were last derived\n", unchanged, sites->count);
+	return 1;
+}
+
+/*
+ * Derives the password of every site listed in a file, or on standard input, in which case the master password is
+ * read from the terminal.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int run_batch(struct options const* const options) {
+	int const from_stdin = options->site_name == NULL || strcmp(options->site_name, "-") == 0;
+	FILE* const input = from_stdin ? stdin : fopen(options->site_name, "r");
+
+	if (input == NULL) {
+		perror("failed to open site list");
+		return 0;
+	}
+
+	if (options->batch_stream) {
+		int const result = run_stream(options, input, from_stdin);
+
+		if (!from_stdin) {
+			fclose(input);
+		}
+
+		return result;
+	}
+
+	struct site_list sites;
+	int const read = read_site_list(input, &sites);
+
+	if (!from_stdin) {
+		fclose(input);
+	}
+
+	if (!read) {
+		free_site_list(&sites);
+		return 0;
+	}
+
+	if (options->batch_shard_count != 0) {
+		keep_shard(&sites, options->batch_shard_index, options->batch_shard_count);
+	}
+
+	struct journal journal;
+	struct batch_writer writer = {
+		.journal = NULL,
+		.jobs = NULL,
+		.indices = NULL,
+		.line = NULL,
+		.done = calloc(sites.count != 0 ? sites.count : 1, sizeof *writer.done),
+	};
+	uint64_t* hashes = NULL;
+	size_t job_count = 0;
+
+	/* the master password, read before the journal is opened, to check it against the journal’s, or else before deriving */
+	struct secure_arena* arena = NULL;
+	struct secrets* secrets = NULL;
+
+	if (writer.done == NULL) {
+		fputs("failed to allocate memory\n", stderr);
+		free_site_list(&sites);
+		return 0;
+	}
+
+	if (options->batch_output_path != NULL) {
+		if ((secrets = read_batch_secrets(from_stdin, &arena)) == NULL) {
+			free_batch_writer(&writer);
+			free_site_list(&sites);
+			return 0;
+		}
+
+		if (!journal_open(&journal, options->batch_output_path, (char const* const*)sites.names, sites.count, secrets->password, secrets->password_length, fewest_rounds(&sites), options->batch_resume)) {
+			secure_arena_destroy(arena);
+			free_batch_writer(&writer);
+			free_site_list(&sites);
+			return 0;
+		}
+
+		writer.journal = &journal;
+
+		for (size_t i = 0; i < sites.count; i++) {
+			writer.done[i] = (uint8_t)journal_is_completed(&journal, i);
+		}
+
+		if (options->batch_resume) {
+			fprintf(stderr, "\x1b[36m●\x1b[0m resuming; %zu of %zu passwords already written\n", journal.completed_count, sites.count);
+		}
+	}
+
+	int const hashed = options->batch_manifest_path != NULL && hash_schemas(options, &sites, writer.done, &hashes);
+	int result = (options->batch_manifest_path == NULL || hashed) && select_remaining_jobs(&sites, &writer, &job_count);
+
+	if (result && job_count != 0 && secrets == NULL) {
+		result = (secrets = read_batch_secrets(from_stdin, &arena)) != NULL;
+	}
+
+	if (result && job_count != 0) {
+		result = derive_batch(options, &writer, job_count, secrets->password, secrets->password_length);
+	}
+
+	if (secrets != NULL) {
+		secure_arena_destroy(arena);
+	}
+
+	/* whether every line marked as done is really in the output */
+	int written;
+
+	if (writer.journal != NULL) {
+		written = journal_close(&journal, result);
+	} else if (!(written = fflush(stdout) != EOF)) {
+		fputs("failed to write output\n", stderr);
+	}
+
+	if (hashed && written) {
+		written = manifest_store(options->batch_manifest_path, sites.names, hashes, writer.done, sites.count);
+	}
+
+	free(hashes);
+	free_batch_writer(&writer);
+	free_site_list(&sites);
+	return result && written;
+}
+
+/*
+ * Lists every site with an entry in the configuration, once each and in order, with its schema. An entry in a shard
+ * whose pattern can’t match it is skipped, since lookups never reach it.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int read_config_sites(struct site_list* const sites) {
+	init_site_list(sites);
+
+	struct config_index index;
+
+	if (!read_config_index(&index, NULL, 0)) {
+		return 0;
+	}
+
+	/* the index is sorted by name, so an entry repeated, or overridden, is only listed once */
+	for (size_t i = 0; i < index.entry_count; i++) {
+		char const* const name = index.entries[i].name;
+
+		if ((i != 0 && strcmp(name, index.entries[i - 1].name) == 0) || strcmp(name, "default") == 0 || find_config_entry(&index, name) == NULL) {
+			continue;
+		}
+
+		if (!append_site(sites, name, strlen(name))) {
+			free_config_index(&index);
+			return 0;
+		}
+
+		if (!load_indexed_schema(&index, name, &sites->jobs[sites->count - 1].schema)) {
+			fprintf(stderr, "(for site '%s')\n", name);
+			free_config_index(&index);
+			return 0;
+		}
+	}
+
+	free_config_index(&index);
+	return 1;
+}
+
+static int add_audit_password(void* const context, struct batch_job const* const job, char const* const password, enum nosepass_status const status) {
+	struct audit_table* const table = context;
+
+	if (password == NULL) {
+		fprintf(stderr, "%s: %s\n", job->site_name, nosepass_strerror(status));
+		return 1;
+	}
+
+	return audit_table_add(table, password, job->schema.count, job->site_name, job->schema.increment);
+}
+
+/*
+ * What confirming an audit’s likely matches takes: the master password, somewhere to regenerate a password, and the
+ * sites’ schemas.
+ */
+struct audit_check {
+	struct secrets* secrets;
+	struct site_list const* sites;
+	size_t match_count;
+};
+
+static int compare_job_names(void const* const key, void const* const job) {
+	return strcmp(key, ((struct batch_job const*)job)->site_name);
+}
+
+/*
+ * Regenerates the password whose digest a candidate matched, and reports the match if the candidate is that password.
+ */
+static int confirm_audit_match(void* const context, char const* const candidate, size_t const length, char const* const site_name, uint64_t const increment, size_t const line_number) {
+	struct audit_check* const check = context;
+	struct secrets* const secrets = check->secrets;
+
+	/* the sites are listed in order of name */
+	struct batch_job const* const job = bsearch(site_name, check->sites->jobs, check->sites->count, sizeof *check->sites->jobs, compare_job_names);
+	struct nosepass_schema schema = job->schema;
+	schema.increment = increment;
+
+	enum nosepass_status status = nosepass_derive_site_key(secrets->password, secrets->password_length, site_name, strlen(site_name), &schema, secrets->key);
+
+	if (status == NOSEPASS_OK) {
+		status = nosepass_generate(secrets->key, &schema, secrets->generated_password, sizeof secrets->generated_password);
+	}
+
+	int const matched = status == NOSEPASS_OK && length == schema.count && memcmp(secrets->generated_password, candidate, length) == 0;
+
+	explicit_bzero(secrets->key, sizeof secrets->key);
+	explicit_bzero(secrets->generated_password, sizeof secrets->generated_password);
+
+	if (status != NOSEPASS_OK) {
+		fprintf(stderr, "%s: %s\n", site_name, nosepass_strerror(status));
+		return 0;
+	}
+
+	if (matched) {
+		check->match_count++;
+		printf("%zu %s %" PRIu64 "\n", line_number, site_name, increment);
+	}
+
+	return 1;
+}
+
+/*
+ * Derives the password of every configured site, at each increment to audit, in parallel, into a table of their
+ * digests, and checks a file of candidate passwords against it, so that each candidate costs a hash lookup rather than
+ * a key derivation; only a candidate whose digest matches costs one, to confirm it. Matches are reported by line
+ * number, site, and increment, never by the password itself.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int run_audit(struct options const* const options) {
+	int const candidates = open(options->site_name, O_RDONLY | O_CLOEXEC);
+
+	if (candidates == -1) {
+		perror("failed to open candidate list");
+		return 0;
+	}
+
+	struct site_list sites;
+
+	if (!read_config_sites(&sites)) {
+		free_site_list(&sites);
+		close(candidates);
+		return 0;
+	}
+
+	unsigned int const increment_count = options->audit_increment_count != 0 ? options->audit_increment_count : 1;
+	size_t past_highest = 0;
+
+	for (size_t i = 0; i < sites.count; i++) {
+		struct nosepass_schema* const schema = &sites.jobs[i].schema;
+
+		if (options->audit_increment_count != 0) {
+			if (schema->increment >= options->audit_increment_count) {
+				past_highest++;
+			}
+
+			schema->increment = 0;
+		}
+	}
+
+	if (past_highest != 0) {
+		fprintf(stderr, "\x1b[33m●\x1b[0m %zu site%s configured past increment %u, so not at the current one\n", past_highest, past_highest == 1 ? " is" : "s are", options->audit_increment_count - 1);
+	}
+
+	struct audit_table* const table = sites.count <= SIZE_MAX / increment_count ? audit_table_create(sites.count * increment_count) : NULL;
+	struct secure_arena* arena;
+	struct secrets* const secrets = table != NULL ? create_secrets(&arena) : NULL;
+
+	if (secrets == NULL || !read_batch_password(0, secrets->password, &secrets->password_length)) {
+		if (secrets != NULL) {
+			secure_arena_destroy(arena);
+		}
+
+		if (table != NULL) {
+			audit_table_destroy(table);
+		}
+
+		free_site_list(&sites);
+		close(candidates);
+		return 0;
+	}
+
+	unsigned int const cpu_count = batch_default_thread_count();
+	struct batch_schedule schedule;
+	int result = 0;
+
+	if (batch_schedule(sites.jobs, sites.count, options->batch_threads != 0 ? options->batch_threads : cpu_count, &schedule)) {
+		schedule.increments = increment_count;
+
+		if (placement_choose(options->batch_placement, schedule.thread_count, &schedule.cpus)) {
+			double const slowdown = schedule.thread_count > cpu_count ? (double)schedule.thread_count / cpu_count : 1.0;
+			show_batch_prediction(sites.count, schedule.thread_count, (double)schedule.makespan * batch_calibrate() * slowdown);
+			result = batch_run(&schedule, sites.jobs, secrets->password, secrets->password_length, add_audit_password, table);
+		}
+
+		batch_schedule_free(&schedule);
+	}
+
+	if (result) {
+		struct timespec start;
+		struct timespec end;
+		size_t line_count;
+		struct audit_check check = {
+			.secrets = secrets,
+			.sites = &sites,
+			.match_count = 0,
+		};
+
+		fprintf(stderr, "\x1b[36m●\x1b[0m checking candidates against %zu passwords of %zu sites\n", sites.count * increment_count, sites.count);
+		clock_gettime(CLOCK_MONOTONIC, &start);
+		result = audit_scan(table, candidates, confirm_audit_match, &check, &line_count);
+		clock_gettime(CLOCK_MONOTONIC, &end);
+
+		if (fflush(stdout) == EOF) {
+			fputs("failed to write output\n", stderr);
+			result = 0;
+		}
+
+		if (result) {
+			char duration[32];
+			format_duration((double)(end.tv_sec - start.tv_sec) + (double)(end.tv_nsec - start.tv_nsec) / 1e9, duration);
+			fprintf(stderr, "%s●\x1b[0m checked %zu candidates in %s; %zu matched\n", check.match_count != 0 ? "\x1b[31m" : "\x1b[32m", line_count, duration, check.match_count);
+		}
+	}
+
+	secure_arena_destroy(arena);
+	audit_table_destroy(table);
+	free_site_list(&sites);
+	close(candidates);
+	return result;
+}
+
+int main(int argc, char* argv[]) {
+	struct options options;
+
+	if (!parse_options(argc, argv, &options)) {
+		show_usage();
+		return EXIT_FAILURE;
+	}
+
+	if (options.agent) {
+		return run_agent(&options) ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+
+	if (options.batch) {
+		return run_batch(&options) ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+
+	if (options.audit) {
+		return run_audit(&options) ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+
+	if (options.worker) {
+		return workers_serve(stdin, stdout) ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+
+	if (options.histogram_path_count != 0) {
+		return show_histogram_snapshots(&options) ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+
+	/* resolving the site and loading its schema */
+	struct stats stats;
+	struct stats_mark config_start;
+	memset(&stats, 0, sizeof stats);
+	stats_start(&config_start);
+
+	char const* site_name = options.site_name;
+	char resolved_site[CONFIG_LINE_SIZE];
+
+	if (options.resolve) {
+		if (!resolve_site(site_name, resolved_site)) {
+			return EXIT_FAILURE;
+		}
+
+		site_name = resolved_site;
+	}
+
+	char const* const agent_socket = getenv(AGENT_SOCKET_VARIABLE);
+	int const single_pass = options.rounds_count != 0 || options.checkpoint_path != NULL;
+
+	/* the agent’s derivation can’t be profiled from here */
+	if (!single_pass && options.stats == STATS_NONE && agent_socket != NULL && agent_socket[0] != '\0') {
+		char output[AGENT_OUTPUT_SIZE];
+		size_t output_length;
+		double bits;
+
+		if (!agent_request(agent_socket, site_name, output, &output_length, &bits)) {
+			return EXIT_FAILURE;
+		}
+
+		show_entropy(bits);
+		int const written = write_password(output, output_length);
+		explicit_bzero(output, sizeof output);
+		return written ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+
+	struct nosepass_schema schema;
+	nosepass_schema_init(&schema);
+
+	if (!load_schema(site_name, &schema)) {
+		return EXIT_FAILURE;
+	}
+
+	stats_stop(&stats, STATS_CONFIG, &config_start);
+	show_entropy(nosepass_entropy_bits(&schema));
+
+	if (!derive_site(&options, site_name, &schema, &stats)) {
+		return EXIT_FAILURE;
+	}
+
+	if (options.stats != STATS_NONE) {
+		show_stats(options.stats, &stats, &schema);
 	}
 
-	fflush(stdout);
-	fputc('\n', stderr);
 	return EXIT_SUCCESS;
 }
@@ -0,0 +1,282 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "manifest.h"
+
+#define MANIFEST_HEADER "nosepass-manifest 1\n"
+#define TEMPORARY_SUFFIX ".new"
+
+/* the hash in hex and the space after it */
+#define HASH_FIELD_SIZE 17
+
+struct manifest_entry {
+	char const* site_name;
+	uint64_t hash;
+};
+
+/*
+ * Continues a 64-bit FNV-1a hash.
+ */
+__attribute__ ((nonnull, pure, warn_unused_result))
+static uint64_t hash_bytes(uint64_t hash, void const* const data, size_t const length) {
+	unsigned char const* const bytes = data;
+
+	for (size_t i = 0; i < length; i++) {
+		hash = (hash ^ bytes[i]) * UINT64_C(0x100000001b3);
+	}
+
+	return hash;
+}
+
+__attribute__ ((const, warn_unused_result))
+static uint64_t hash_number(uint64_t const hash, uint64_t const n) {
+	uint8_t bytes[8];
+
+	for (int i = 0; i < 8; i++) {
+		bytes[i] = (uint8_t)(n >> 8 * i);
+	}
+
+	return hash_bytes(hash, bytes, sizeof bytes);
+}
+
+uint64_t manifest_hash(char const* const site_name, struct nosepass_schema const* const schema) {
+	size_t const site_name_length = strlen(site_name);
+	uint64_t hash = UINT64_C(0xcbf29ce484222325);
+
+	hash = hash_number(hash, site_name_length);
+	hash = hash_bytes(hash, site_name, site_name_length);
+	hash = hash_number(hash, schema->rounds);
+	hash = hash_number(hash, schema->count);
+	hash = hash_number(hash, schema->increment);
+
+	/* in the set’s own order, which nosepass_set_characters can change */
+	hash = hash_number(hash, schema->set_size);
+	hash = hash_bytes(hash, schema->set, schema->set_size);
+
+	/* only for a site in a group, so that other sites’ hashes are what they were before groups */
+	if (schema->group_length != 0) {
+		hash = hash_number(hash, schema->group_length);
+		hash = hash_bytes(hash, schema->group, schema->group_length);
+	}
+
+	/* and likewise only for a key of several lanes */
+	if (schema->lanes > 1) {
+		hash = hash_number(hash, schema->lanes);
+	}
+
+	return hash;
+}
+
+__attribute__ ((nonnull, pure, warn_unused_result))
+static int compare_entries(void const* const a, void const* const b) {
+	struct manifest_entry const* const entry_a = a;
+	struct manifest_entry const* const entry_b = b;
+	return strcmp(entry_a->site_name, entry_b->site_name);
+}
+
+__attribute__ ((const, warn_unused_result))
+static int hex_value(char const c) {
+	if (c >= '0' && c <= '9') {
+		return c - '0';
+	}
+
+	if (c >= 'a' && c <= 'f') {
+		return c - 'a' + 10;
+	}
+
+	return -1;
+}
+
+/*
+ * Parses a manifest’s lines in place, making each site name a string.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int parse_manifest(struct manifest* const manifest, char* const contents, size_t const length) {
+	if (length < sizeof MANIFEST_HEADER - 1 || memcmp(contents, MANIFEST_HEADER, sizeof MANIFEST_HEADER - 1) != 0 || memchr(contents, '\0', length) != NULL) {
+		return 0;
+	}
+
+	char* p = contents + sizeof MANIFEST_HEADER - 1;
+	char* const end = contents + length;
+	size_t capacity = 0;
+
+	for (char const* q = p; q != end; q++) {
+		capacity += *q == '\n';
+	}
+
+	if ((manifest->entries = malloc((capacity != 0 ? capacity : 1) * sizeof *manifest->entries)) == NULL) {
+		return 0;
+	}
+
+	while (p != end) {
+		char* const newline = memchr(p, '\n', (size_t)(end - p));
+
+		if (newline == NULL || newline - p < HASH_FIELD_SIZE + 1 || p[HASH_FIELD_SIZE - 1] != ' ') {
+			return 0;
+		}
+
+		uint64_t hash = 0;
+
+		for (int i = 0; i < HASH_FIELD_SIZE - 1; i++) {
+			int const digit = hex_value(p[i]);
+
+			if (digit == -1) {
+				return 0;
+			}
+
+			hash = hash << 4 | (uint64_t)digit;
+		}
+
+		*newline = '\0';
+		manifest->entries[manifest->count].site_name = p + HASH_FIELD_SIZE;
+		manifest->entries[manifest->count].hash = hash;
+		manifest->count++;
+		p = newline + 1;
+	}
+
+	qsort(manifest->entries, manifest->count, sizeof *manifest->entries, compare_entries);
+	return 1;
+}
+
+int manifest_load(char const* const path, struct manifest* const manifest) {
+	manifest->entries = NULL;
+	manifest->count = 0;
+	manifest->contents = NULL;
+
+	int const fd = open(path, O_RDONLY | O_CLOEXEC);
+
+	if (fd == -1) {
+		if (errno == ENOENT) {
+			return 1;
+		}
+
+		perror("failed to open manifest");
+		return 0;
+	}
+
+	struct stat status;
+
+	if (fstat(fd, &status) != 0) {
+		perror("failed to read manifest");
+		close(fd);
+		return 0;
+	}
+
+	size_t const length = (size_t)status.st_size;
+
+	if ((manifest->contents = malloc(length + 1)) == NULL) {
+		fputs("failed to allocate memory\n", stderr);
+		close(fd);
+		return 0;
+	}
+
+	size_t read_length = 0;
+
+	while (read_length < length) {
+		ssize_t const n = read(fd, manifest->contents + read_length, length - read_length);
+
+		if (n == -1 && errno == EINTR) {
+			continue;
+		}
+
+		if (n <= 0) {
+			perror("failed to read manifest");
+			close(fd);
+			manifest_free(manifest);
+			return 0;
+		}
+
+		read_length += (size_t)n;
+	}
+
+	close(fd);
+
+	if (!parse_manifest(manifest, manifest->contents, length)) {
+		fprintf(stderr, "malformed manifest file '%s'\n", path);
+		manifest_free(manifest);
+		return 0;
+	}
+
+	return 1;
+}
+
+int manifest_contains(struct manifest const* const manifest, char const* const site_name, uint64_t const hash) {
+	struct manifest_entry const key = {
+		.site_name = site_name,
+		.hash = 0,
+	};
+	struct manifest_entry const* const entry = bsearch(&key, manifest->entries, manifest->count, sizeof *manifest->entries, compare_entries);
+
+	return entry != NULL && entry->hash == hash;
+}
+
+void manifest_free(struct manifest* const manifest) {
+	free(manifest->entries);
+	free(manifest->contents);
+	manifest->entries = NULL;
+	manifest->contents = NULL;
+	manifest->count = 0;
+}
+
+int manifest_store(char const* const path, char* const* const site_names, uint64_t const* const hashes, uint8_t const* const current, size_t const site_count) {
+	size_t const path_length = strlen(path);
+	char* const temporary_path = malloc(path_length + sizeof TEMPORARY_SUFFIX);
+
+	if (temporary_path == NULL) {
+		fputs("failed to allocate memory\n", stderr);
+		return 0;
+	}
+
+	memcpy(temporary_path, path, path_length);
+	memcpy(temporary_path + path_length, TEMPORARY_SUFFIX, sizeof TEMPORARY_SUFFIX);
+
+	if (unlink(temporary_path) == -1 && errno != ENOENT) {
+		perror("failed to remove old temporary manifest");
+		free(temporary_path);
+		return 0;
+	}
+
+	int const fd = open(temporary_path, O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0600);
+	FILE* const file = fd == -1 ? NULL : fdopen(fd, "w");
+
+	if (file == NULL) {
+		perror("failed to create manifest");
+
+		if (fd != -1) {
+			close(fd);
+			unlink(temporary_path);
+		}
+
+		free(temporary_path);
+		return 0;
+	}
+
+	int stored = fputs(MANIFEST_HEADER, file) != EOF;
+
+	for (size_t i = 0; stored && i < site_count; i++) {
+		if (current[i]) {
+			stored = fprintf(file, "%016" PRIx64 " %s\n", hashes[i], site_names[i]) > 0;
+		}
+	}
+
+	stored = stored && fflush(file) == 0 && fsync(fd) == 0;
+
+	if (fclose(file) != 0) {
+		stored = 0;
+	}
+
+	if (!stored || rename(temporary_path, path) != 0) {
+		perror("failed to write manifest");
+		unlink(temporary_path);
+		stored = 0;
+	}
+
+	free(temporary_path);
+	return stored;
+}
@@ -0,0 +1,42 @@
+#include <stddef.h>
+#include <stdint.h>
+
+#include "nosepass.h"
+
+/*
+ * The sites a batch derived last time, each with a hash of the schema it was derived with.
+ */
+struct manifest {
+	struct manifest_entry* entries;
+	size_t count;
+
+	/* the file’s contents, which the entries’ site names point into */
+	char* contents;
+};
+
+/*
+ * Hashes a site’s resolved schema: everything that determines its password other than the master password.
+ */
+__attribute__ ((nonnull, pure, warn_unused_result))
+uint64_t manifest_hash(char const* site_name, struct nosepass_schema const* schema);
+
+/*
+ * Reads a manifest written by manifest_store. A missing file is an empty manifest.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+int manifest_load(char const* path, struct manifest* manifest);
+
+/*
+ * Whether a manifest records a site with the given schema hash.
+ */
+__attribute__ ((nonnull, pure, warn_unused_result))
+int manifest_contains(struct manifest const* manifest, char const* site_name, uint64_t hash);
+
+__attribute__ ((nonnull))
+void manifest_free(struct manifest* manifest);
+
+/*
+ * Replaces a manifest file atomically with the sites whose `current` flag is set.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+int manifest_store(char const* path, char* const* site_names, uint64_t const* hashes, uint8_t const* current, size_t site_count);
@@ -0,0 +1,984 @@
+#include <limits.h>
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/types.h>
+#include <time.h>
+
+#include "bcrypt/bcrypt_pbkdf.h"
+#include "bcrypt/blf.h"
+#include "bcrypt/explicit_bzero.h"
+#include "bcrypt/sha2.h"
+#include "chacha/ecrypt-sync.h"
+#include "nosepass.h"
+#include "probes.h"
+#include "sample.h"
+
+#define S_(x) #x
+#define S(x) S_(x)
+
+#define DEFAULT_SET "!\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_`abcdefghijklmnopqrstuvwxyz{|}~"
+
+#define PREFIX_COUNT "count="
+#define PREFIX_SET "set="
+#define PREFIX_ROUNDS "rounds="
+#define PREFIX_INCREMENT "increment="
+#define PREFIX_GROUP "group="
+#define PREFIX_LANES "lanes="
+
+/* a group’s salt is this, a null byte, which no site name from a configuration has, and the group’s name */
+#define GROUP_SALT_PREFIX "nosepass group"
+
+/* a lane’s salt is the SHA-512 of this, a null byte, the number of lanes, the lane, and the salt of the key */
+#define LANE_SALT_PREFIX "nosepass lane"
+
+/* a key of several lanes is the start of the SHA-512 of this, a null byte, the number of lanes, and their outputs */
+#define LANES_PREFIX "nosepass lanes"
+
+_Static_assert(' ' == 32 && '~' == 126, "character set is normal");
+_Static_assert(NOSEPASS_DEFAULT_COUNT > 0 && NOSEPASS_DEFAULT_COUNT <= NOSEPASS_MAX_COUNT, "default count is within bounds");
+_Static_assert(NOSEPASS_MAX_COUNT <= UINT_MAX, "maximum count is within bounds");
+_Static_assert(ECRYPT_BLOCKLENGTH == SAMPLE_BLOCK_LENGTH, "keystream blocks can be sampled");
+_Static_assert(sizeof(blf_ctx) == NOSEPASS_WORKSPACE_SIZE, "a workspace holds a Blowfish state");
+_Static_assert(sizeof GROUP_SALT_PREFIX + NOSEPASS_MAX_GROUP_LENGTH <= sizeof ((struct nosepass_derivation_state*)NULL)->salt, "a derivation holds a group’s salt");
+_Static_assert(NOSEPASS_MAX_GROUP_LENGTH <= UINT8_MAX, "group length fits in schema");
+_Static_assert(sizeof ((struct nosepass_derivation_state*)NULL)->lane_salt == SHA512_DIGEST_LENGTH, "a derivation holds a lane’s salt");
+_Static_assert(NOSEPASS_MAX_LANES <= UINT8_MAX, "lanes fit in schema");
+_Static_assert(sizeof(struct nosepass_schema) == NOSEPASS_SCHEMA_SIZE, "schemas keep their size");
+_Static_assert(sizeof(struct nosepass_sampler) == NOSEPASS_SAMPLER_SIZE, "samplers keep their size");
+_Static_assert(sizeof(struct nosepass_derivation) == NOSEPASS_DERIVATION_SIZE, "derivations keep their size");
+_Static_assert(NOSEPASS_KEY_SIZE <= SHA512_BLOCK_LENGTH && NOSEPASS_KEY_SIZE <= SHA512_DIGEST_LENGTH, "group keys are HMAC-SHA-512 keys, and site keys fit in its output");
+
+__attribute__ ((nonnull, warn_unused_result))
+static char const* parse_count(char const* const line, size_t* const out) {
+	char const* p = line;
+	size_t n = 0;
+
+	for (;; p++) {
+		char const c = *p;
+
+		if (c == ' ' || c == '\0') {
+			if (p == line) {
+				return NULL;
+			}
+
+			*out = n;
+			return p;
+		}
+
+		if (c < '0' || c > '9') {
+			return NULL;
+		}
+
+		size_t const digit_value = (size_t)(c - '0');
+
+		if (n > SIZE_MAX / 10 || 10 * n > SIZE_MAX - digit_value) {
+			return NULL;
+		}
+
+		n = 10 * n + digit_value;
+	}
+}
+
+__attribute__ ((nonnull, warn_unused_result))
+static char const* parse_set(char const* line, struct nosepass_schema* const result, enum nosepass_status* const status) {
+	unsigned char in_set[95];
+	memset(in_set, 0, sizeof in_set);
+	char last = '\0';
+
+	for (;; line++) {
+		char const c = *line;
+
+		if (c == ' ' || c == '\0') {
+			break;
+		}
+
+		if (c == '\\') {
+			last = *++line;
+
+			if (last == '\0') {
+				*status = NOSEPASS_SET_UNTERMINATED_ESCAPE;
+				return NULL;
+			}
+
+			if (last < ' ' || last >= '\x7f') {
+				*status = NOSEPASS_SET_NOT_PRINTABLE;
+				return NULL;
+			}
+
+			in_set[last - ' '] = 1;
+			continue;
+		}
+
+		if (c < ' ' || c >= '\x7f') {
+			*status = NOSEPASS_SET_NOT_PRINTABLE;
+			return NULL;
+		}
+
+		if (c == '-') {
+			if (last == '\0') {
+				*status = NOSEPASS_SET_RANGE_WITHOUT_START;
+				return NULL;
+			}
+
+			char end = *++line;
+
+			if (end == '\\') {
+				end = *++line;
+			} else if (end == ' ') {
+				end = '\0';
+			}
+
+			if (end == '\0') {
+				*status = NOSEPASS_SET_RANGE_WITHOUT_END;
+				return NULL;
+			}
+
+			if (end < ' ' || end >= '\x7f') {
+				*status = NOSEPASS_SET_NOT_PRINTABLE;
+				return NULL;
+			}
+
+			if (end < last) {
+				*status = NOSEPASS_SET_EMPTY_RANGE;
+				return NULL;
+			}
+
+			for (char add = last; add <= end; add++) {
+				in_set[add - ' '] = 1;
+			}
+
+			last = '\0';
+		} else {
+			in_set[c - ' '] = 1;
+			last = c;
+		}
+	}
+
+	result->set_size = 0;
+
+	for (char i = 0; (unsigned char)i < sizeof in_set; i++) {
+		if (in_set[(unsigned char)i]) {
+			result->set[result->set_size++] = i + ' ';
+		}
+	}
+
+	if (result->set_size < 2) {
+		*status = NOSEPASS_SET_TOO_SMALL;
+		return NULL;
+	}
+
+	sampler_init(&result->sampler, result->set, result->set_size);
+	return line;
+}
+
+/*
+ * Parses a group name: one or more printable characters other than spaces.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static char const* parse_group(char const* const line, struct nosepass_schema* const result, enum nosepass_status* const status) {
+	char const* p = line;
+
+	for (; *p != ' ' && *p != '\0'; p++) {
+		if (*p < ' ' || *p >= '\x7f') {
+			*status = NOSEPASS_INVALID_GROUP;
+			return NULL;
+		}
+	}
+
+	size_t const length = (size_t)(p - line);
+
+	if (length == 0) {
+		*status = NOSEPASS_INVALID_GROUP;
+		return NULL;
+	}
+
+	if (length > NOSEPASS_MAX_GROUP_LENGTH) {
+		*status = NOSEPASS_GROUP_TOO_LONG;
+		return NULL;
+	}
+
+	result->group_length = (uint8_t)length;
+	memcpy(result->group, line, length);
+	return p;
+}
+
+/*
+ * Parses parameters into a schema, leaving it partially updated on failure.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static enum nosepass_status parse_schema_line(char const* line, struct nosepass_schema* const restrict result, char const** const error_position) {
+	int has_count = 0;
+	int has_set = 0;
+	int has_rounds = 0;
+	int has_increment = 0;
+	int has_group = 0;
+	int has_lanes = 0;
+
+	for (int first = 1; *line != '\0'; first = 0) {
+		*error_position = line;
+
+		if (!first) {
+			if (*line != ' ') {
+				return NOSEPASS_EXPECTED_SPACE;
+			}
+
+			line++;
+		}
+
+		*error_position = line;
+
+		if (strncmp(line, PREFIX_COUNT, sizeof PREFIX_COUNT - 1) == 0) {
+			if (has_count) {
+				return NOSEPASS_DUPLICATE_COUNT;
+			}
+
+			has_count = 1;
+
+			size_t count;
+			char const* const parse_end = parse_count(line + (sizeof PREFIX_COUNT - 1), &count);
+
+			if (parse_end == NULL) {
+				return NOSEPASS_INVALID_COUNT;
+			}
+
+			if (count == 0) {
+				return NOSEPASS_COUNT_ZERO;
+			}
+
+			if (count > NOSEPASS_MAX_COUNT) {
+				return NOSEPASS_COUNT_TOO_LARGE;
+			}
+
+			result->count = (unsigned int)count;
+			line = parse_end;
+		} else if (strncmp(line, PREFIX_SET, sizeof PREFIX_SET - 1) == 0) {
+			if (has_set) {
+				return NOSEPASS_DUPLICATE_SET;
+			}
+
+			has_set = 1;
+
+			enum nosepass_status status;
+
+			if ((line = parse_set(line + (sizeof PREFIX_SET - 1), result, &status)) == NULL) {
+				return status;
+			}
+		} else if (strncmp(line, PREFIX_ROUNDS, sizeof PREFIX_ROUNDS - 1) == 0) {
+			if (has_rounds) {
+				return NOSEPASS_DUPLICATE_ROUNDS;
+			}
+
+			has_rounds = 1;
+
+			size_t rounds;
+			char const* const parse_end = parse_count(line + (sizeof PREFIX_ROUNDS - 1), &rounds);
+
+			if (parse_end == NULL) {
+				return NOSEPASS_INVALID_ROUNDS;
+			}
+
+			if (rounds < 1) {
+				return NOSEPASS_ROUNDS_ZERO;
+			}
+
+			if (rounds > UINT_MAX) {
+				return NOSEPASS_ROUNDS_TOO_LARGE;
+			}
+
+			result->rounds = (unsigned int)rounds;
+			line = parse_end;
+		} else if (strncmp(line, PREFIX_INCREMENT, sizeof PREFIX_INCREMENT - 1) == 0) {
+			if (has_increment) {
+				return NOSEPASS_DUPLICATE_INCREMENT;
+			}
+
+			has_increment = 1;
+
+			size_t increment;
+			char const* const parse_end = parse_count(line + (sizeof PREFIX_INCREMENT - 1), &increment);
+
+			if (parse_end == NULL) {
+				return NOSEPASS_INVALID_INCREMENT;
+			}
+
+			if (increment > UINT64_MAX) {
+				return NOSEPASS_INCREMENT_TOO_LARGE;
+			}
+
+			result->increment = (uint64_t)increment;
+			line = parse_end;
+		} else if (strncmp(line, PREFIX_GROUP, sizeof PREFIX_GROUP - 1) == 0) {
+			if (has_group) {
+				return NOSEPASS_DUPLICATE_GROUP;
+			}
+
+			has_group = 1;
+
+			enum nosepass_status status;
+
+			if ((line = parse_group(line + (sizeof PREFIX_GROUP - 1), result, &status)) == NULL) {
+				return status;
+			}
+		} else if (strncmp(line, PREFIX_LANES, sizeof PREFIX_LANES - 1) == 0) {
+			if (has_lanes) {
+				return NOSEPASS_DUPLICATE_LANES;
+			}
+
+			has_lanes = 1;
+
+			size_t lanes;
+			char const* const parse_end = parse_count(line + (sizeof PREFIX_LANES - 1), &lanes);
+
+			if (parse_end == NULL || lanes == 0) {
+				return NOSEPASS_INVALID_LANES;
+			}
+
+			if (lanes > NOSEPASS_MAX_LANES) {
+				return NOSEPASS_LANES_TOO_LARGE;
+			}
+
+			result->lanes = (uint8_t)lanes;
+			line = parse_end;
+		} else {
+			return NOSEPASS_UNKNOWN_PARAMETER;
+		}
+	}
+
+	return NOSEPASS_OK;
+}
+
+void nosepass_schema_init(struct nosepass_schema* const schema) {
+	schema->count = NOSEPASS_DEFAULT_COUNT;
+	schema->rounds = NOSEPASS_DEFAULT_ROUNDS;
+	schema->increment = 0;
+	schema->group_length = 0;
+	schema->lanes = 1;
+	memset(schema->reserved, 0, sizeof schema->reserved);
+	schema->set_size = sizeof DEFAULT_SET - 1;
+	_Static_assert(sizeof DEFAULT_SET - 1 > 0 && sizeof DEFAULT_SET - 1 <= sizeof schema->set, "default character set fits in schema");
+	memcpy(schema->set, DEFAULT_SET, sizeof DEFAULT_SET - 1);
+	sampler_init(&schema->sampler, schema->set, schema->set_size);
+}
+
+enum nosepass_status nosepass_parse_schema(char const* const parameters, struct nosepass_schema* const schema, char const** const error_position) {
+	struct nosepass_schema parsed = *schema;
+	char const* position = parameters;
+	enum nosepass_status const status = parse_schema_line(parameters, &parsed, &position);
+
+	if (status != NOSEPASS_OK) {
+		if (error_position != NULL) {
+			*error_position = position;
+		}
+
+		return status;
+	}
+
+	*schema = parsed;
+	return NOSEPASS_OK;
+}
+
+enum nosepass_status nosepass_set_characters(struct nosepass_schema* const schema, char const* const characters, size_t const length) {
+	if (length < 2) {
+		return NOSEPASS_SET_TOO_SMALL;
+	}
+
+	unsigned char in_set[95];
+	memset(in_set, 0, sizeof in_set);
+
+	for (size_t i = 0; i < length; i++) {
+		char const c = characters[i];
+
+		if (c < ' ' || c >= '\x7f') {
+			return NOSEPASS_SET_NOT_PRINTABLE;
+		}
+
+		if (in_set[c - ' ']) {
+			return NOSEPASS_SET_DUPLICATE_CHARACTER;
+		}
+
+		in_set[c - ' '] = 1;
+	}
+
+	schema->set_size = (uint8_t)length;
+	memcpy(schema->set, characters, length);
+	sampler_init(&schema->sampler, schema->set, schema->set_size);
+	return NOSEPASS_OK;
+}
+
+enum nosepass_status nosepass_derive_key(char const* const master_password, size_t const master_password_length, char const* const site_name, size_t const site_name_length, unsigned int const rounds, uint8_t key[const NOSEPASS_KEY_SIZE]) {
+	if (master_password_length == 0 || site_name_length == 0 || rounds == 0) {
+		return NOSEPASS_INVALID_ARGUMENT;
+	}
+
+	if (bcrypt_pbkdf(master_password, master_password_length, (uint8_t const*)site_name, site_name_length, key, NOSEPASS_KEY_SIZE, rounds) != 0) {
+		return NOSEPASS_KDF_FAILED;
+	}
+
+	return NOSEPASS_OK;
+}
+
+/*
+ * Writes a group’s salt, returning its length.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static size_t group_salt(char const* const group, size_t const group_length, uint8_t salt[const sizeof GROUP_SALT_PREFIX + NOSEPASS_MAX_GROUP_LENGTH]) {
+	memcpy(salt, GROUP_SALT_PREFIX, sizeof GROUP_SALT_PREFIX);
+	memcpy(salt + sizeof GROUP_SALT_PREFIX, group, group_length);
+	return sizeof GROUP_SALT_PREFIX + group_length;
+}
+
+enum nosepass_status nosepass_derive_group_key(char const* const master_password, size_t const master_password_length, char const* const group, size_t const group_length, unsigned int const rounds, uint8_t key[const NOSEPASS_KEY_SIZE]) {
+	if (master_password_length == 0 || group_length == 0 || group_length > NOSEPASS_MAX_GROUP_LENGTH || rounds == 0) {
+		return NOSEPASS_INVALID_ARGUMENT;
+	}
+
+	uint8_t salt[sizeof GROUP_SALT_PREFIX + NOSEPASS_MAX_GROUP_LENGTH];
+	size_t const salt_length = group_salt(group, group_length, salt);
+
+	if (bcrypt_pbkdf(master_password, master_password_length, salt, salt_length, key, NOSEPASS_KEY_SIZE, rounds) != 0) {
+		return NOSEPASS_KDF_FAILED;
+	}
+
+	return NOSEPASS_OK;
+}
+
+/*
+ * HMAC-SHA-512, with a key shorter than a block, truncated to a key.
+ */
+__attribute__ ((nonnull))
+static void expand_key(uint8_t const group_key[const NOSEPASS_KEY_SIZE], char const* const site_name, size_t const site_name_length, uint8_t key[const NOSEPASS_KEY_SIZE]) {
+	uint8_t pad[SHA512_BLOCK_LENGTH];
+	uint8_t digest[SHA512_DIGEST_LENGTH];
+	SHA2_CTX ctx;
+
+	memset(pad, 0x36, sizeof pad);
+
+	for (size_t i = 0; i < NOSEPASS_KEY_SIZE; i++) {
+		pad[i] ^= group_key[i];
+	}
+
+	SHA512Init(&ctx);
+	SHA512Update(&ctx, pad, sizeof pad);
+	SHA512Update(&ctx, site_name, site_name_length);
+	SHA512Final(digest, &ctx);
+
+	for (size_t i = 0; i < sizeof pad; i++) {
+		pad[i] ^= 0x36 ^ 0x5c;
+	}
+
+	SHA512Init(&ctx);
+	SHA512Update(&ctx, pad, sizeof pad);
+	SHA512Update(&ctx, digest, sizeof digest);
+	SHA512Final(digest, &ctx);
+
+	memcpy(key, digest, NOSEPASS_KEY_SIZE);
+	explicit_bzero(pad, sizeof pad);
+	explicit_bzero(digest, sizeof digest);
+	explicit_bzero(&ctx, sizeof ctx);
+}
+
+enum nosepass_status nosepass_expand_key(uint8_t const group_key[const NOSEPASS_KEY_SIZE], char const* const site_name, size_t const site_name_length, uint8_t key[const NOSEPASS_KEY_SIZE]) {
+	if (site_name_length == 0) {
+		return NOSEPASS_INVALID_ARGUMENT;
+	}
+
+	expand_key(group_key, site_name, site_name_length, key);
+	return NOSEPASS_OK;
+}
+
+enum nosepass_status nosepass_derive_site_key(char const* const master_password, size_t const master_password_length, char const* const site_name, size_t const site_name_length, struct nosepass_schema const* const schema, uint8_t key[const NOSEPASS_KEY_SIZE]) {
+	if (schema->lanes > 1) {
+		struct nosepass_derivation derivation;
+		enum nosepass_status const status = nosepass_derivation_init_site(&derivation, master_password, master_password_length, site_name, site_name_length, schema, key);
+
+		if (status != NOSEPASS_OK) {
+			return status;
+		}
+
+		while (nosepass_derivation_step(&derivation, UINT_MAX)) {}
+
+		return nosepass_derivation_finish(&derivation);
+	}
+
+	if (schema->group_length == 0) {
+		return nosepass_derive_key(master_password, master_password_length, site_name, site_name_length, schema->rounds, key);
+	}
+
+	if (site_name_length == 0) {
+		return NOSEPASS_INVALID_ARGUMENT;
+	}
+
+	enum nosepass_status const status = nosepass_derive_group_key(master_password, master_password_length, schema->group, schema->group_length, schema->rounds, key);
+	return status != NOSEPASS_OK ? status : nosepass_expand_key(key, site_name, site_name_length, key);
+}
+
+enum nosepass_status nosepass_derivation_init(struct nosepass_derivation* const derivation, char const* const master_password, size_t const master_password_length, char const* const site_name, size_t const site_name_length, unsigned int const rounds, uint8_t key[const NOSEPASS_KEY_SIZE]) {
+	if (master_password_length == 0 || site_name_length == 0 || rounds == 0) {
+		return NOSEPASS_INVALID_ARGUMENT;
+	}
+
+	if (bcrypt_pbkdf_init(&derivation->state.kdf, master_password, master_password_length, (uint8_t const*)site_name, site_name_length, key, NOSEPASS_KEY_SIZE, rounds) != 0) {
+		return NOSEPASS_KDF_FAILED;
+	}
+
+	derivation->state.site_name = NULL;
+	derivation->state.lanes = 1;
+	derivation->state.profile = NULL;
+	return NOSEPASS_OK;
+}
+
+enum nosepass_status nosepass_derivation_init_group(struct nosepass_derivation* const derivation, char const* const master_password, size_t const master_password_length, char const* const group, size_t const group_length, unsigned int const rounds, uint8_t key[const NOSEPASS_KEY_SIZE]) {
+	if (master_password_length == 0 || group_length == 0 || group_length > NOSEPASS_MAX_GROUP_LENGTH || rounds == 0) {
+		return NOSEPASS_INVALID_ARGUMENT;
+	}
+
+	size_t const salt_length = group_salt(group, group_length, derivation->state.salt);
+
+	if (bcrypt_pbkdf_init(&derivation->state.kdf, master_password, master_password_length, derivation->state.salt, salt_length, key, NOSEPASS_KEY_SIZE, rounds) != 0) {
+		explicit_bzero(derivation->state.salt, sizeof derivation->state.salt);
+		return NOSEPASS_KDF_FAILED;
+	}
+
+	derivation->state.site_name = NULL;
+	derivation->state.lanes = 1;
+	derivation->state.profile = NULL;
+	return NOSEPASS_OK;
+}
+
+enum nosepass_status nosepass_derivation_init_site(struct nosepass_derivation* const derivation, char const* const master_password, size_t const master_password_length, char const* const site_name, size_t const site_name_length, struct nosepass_schema const* const schema, uint8_t key[const NOSEPASS_KEY_SIZE]) {
+	enum nosepass_status status;
+
+	if (schema->group_length == 0) {
+		status = nosepass_derivation_init(derivation, master_password, master_password_length, site_name, site_name_length, schema->rounds, key);
+	} else if (site_name_length == 0) {
+		return NOSEPASS_INVALID_ARGUMENT;
+	} else if ((status = nosepass_derivation_init_group(derivation, master_password, master_password_length, schema->group, schema->group_length, schema->rounds, key)) == NOSEPASS_OK) {
+		derivation->state.site_name = site_name;
+		derivation->state.site_name_length = site_name_length;
+	}
+
+	return status != NOSEPASS_OK || schema->lanes <= 1 ? status : nosepass_derivation_set_lanes(derivation, master_password, master_password_length, schema->lanes);
+}
+
+/*
+ * Starts a derivation over as lane `lane` of a key of `lanes` lanes, writing its output to `out`, keeping its
+ * workspace and timing. The derivation’s password and base salt must already be set.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static enum nosepass_status start_lane(struct nosepass_derivation* const derivation, unsigned int const lanes, unsigned int const lane, uint8_t out[const NOSEPASS_KEY_SIZE]) {
+	struct bcrypt_pbkdf_state* const kdf = &derivation->state.kdf;
+	struct BlowfishContext* const workspace = kdf->workspace;
+	struct BlowfishContext const* const initial = kdf->initial;
+	struct bcrypt_pbkdf_timing* const timing = kdf->timing;
+	unsigned int const rounds = kdf->rounds;
+	SHA2_CTX ctx;
+
+	SHA512Init(&ctx);
+	SHA512Update(&ctx, LANE_SALT_PREFIX, sizeof LANE_SALT_PREFIX);
+	SHA512Update(&ctx, (uint8_t const[]){(uint8_t)lanes, (uint8_t)lane}, 2);
+	SHA512Update(&ctx, derivation->state.base_salt, derivation->state.base_salt_length);
+	SHA512Final(derivation->state.lane_salt, &ctx);
+	explicit_bzero(&ctx, sizeof ctx);
+
+	/* a lane that hasn’t run wipes a key that hasn’t been written, and one that has is done */
+	bcrypt_pbkdf_finish(kdf);
+
+	if (bcrypt_pbkdf_init(kdf, derivation->state.master_password, derivation->state.master_password_length, derivation->state.lane_salt, sizeof derivation->state.lane_salt, out, NOSEPASS_KEY_SIZE, rounds) != 0) {
+		return NOSEPASS_KDF_FAILED;
+	}
+
+	bcrypt_pbkdf_set_workspace(kdf, workspace, initial);
+	bcrypt_pbkdf_set_timing(kdf, timing);
+	return NOSEPASS_OK;
+}
+
+/*
+ * Remembers what a newly started derivation’s lanes start from: its password, salt, and where its key goes.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int prepare_lanes(struct nosepass_derivation* const derivation, char const* const master_password, size_t const master_password_length) {
+	if (derivation->state.kdf.completed != 0 || derivation->state.kdf.key_length == 0 || derivation->state.lanes != 1) {
+		return 0;
+	}
+
+	derivation->state.master_password = master_password;
+	derivation->state.master_password_length = master_password_length;
+	derivation->state.base_salt = derivation->state.kdf.salt;
+	derivation->state.base_salt_length = derivation->state.kdf.salt_length;
+	derivation->state.key = derivation->state.kdf.key;
+	return 1;
+}
+
+enum nosepass_status nosepass_derivation_set_lanes(struct nosepass_derivation* const derivation, char const* const master_password, size_t const master_password_length, unsigned int const lanes) {
+	if (lanes == 0 || lanes > NOSEPASS_MAX_LANES || !prepare_lanes(derivation, master_password, master_password_length)) {
+		return NOSEPASS_INVALID_ARGUMENT;
+	}
+
+	if (lanes == 1) {
+		return NOSEPASS_OK;
+	}
+
+	derivation->state.lanes = lanes;
+	derivation->state.lane = 0;
+	return start_lane(derivation, lanes, 0, derivation->state.lane_keys[0]);
+}
+
+enum nosepass_status nosepass_derivation_set_lane(struct nosepass_derivation* const derivation, char const* const master_password, size_t const master_password_length, unsigned int const lanes, unsigned int const lane) {
+	if (lanes < 2 || lanes > NOSEPASS_MAX_LANES || lane >= lanes || !prepare_lanes(derivation, master_password, master_password_length)) {
+		return NOSEPASS_INVALID_ARGUMENT;
+	}
+
+	/* a lane on its own, which the caller combines and expands */
+	derivation->state.site_name = NULL;
+	return start_lane(derivation, lanes, lane, derivation->state.key);
+}
+
+/*
+ * Combines lane outputs into a key.
+ */
+__attribute__ ((nonnull))
+static void combine_lanes(uint8_t const lane_keys[const][NOSEPASS_KEY_SIZE], unsigned int const lanes, uint8_t key[const NOSEPASS_KEY_SIZE]) {
+	uint8_t digest[SHA512_DIGEST_LENGTH];
+	SHA2_CTX ctx;
+
+	SHA512Init(&ctx);
+	SHA512Update(&ctx, LANES_PREFIX, sizeof LANES_PREFIX);
+	SHA512Update(&ctx, (uint8_t const[]){(uint8_t)lanes}, 1);
+	SHA512Update(&ctx, lane_keys[0], lanes * NOSEPASS_KEY_SIZE);
+	SHA512Final(digest, &ctx);
+
+	memcpy(key, digest, NOSEPASS_KEY_SIZE);
+	explicit_bzero(digest, sizeof digest);
+	explicit_bzero(&ctx, sizeof ctx);
+}
+
+enum nosepass_status nosepass_combine_lanes(uint8_t const lane_keys[const][NOSEPASS_KEY_SIZE], unsigned int const lanes, uint8_t key[const NOSEPASS_KEY_SIZE]) {
+	if (lanes < 2 || lanes > NOSEPASS_MAX_LANES) {
+		return NOSEPASS_INVALID_ARGUMENT;
+	}
+
+	combine_lanes(lane_keys, lanes, key);
+	return NOSEPASS_OK;
+}
+
+int nosepass_derivation_step(struct nosepass_derivation* const derivation, unsigned int const rounds) {
+	unsigned int left = rounds;
+	int remaining;
+
+	for (;;) {
+		/* whether this step can be the one that writes the key */
+		int const running = derivation->state.kdf.key_length > 0;
+		uint64_t const completed = derivation->state.kdf.completed;
+
+		remaining = bcrypt_pbkdf_step(&derivation->state.kdf, left);
+		left -= (unsigned int)(derivation->state.kdf.completed - completed);
+
+		if (!running || remaining) {
+			break;
+		}
+
+		uint8_t* key = derivation->state.kdf.key;
+
+		if (derivation->state.lanes > 1) {
+			if (++derivation->state.lane < derivation->state.lanes) {
+				remaining = start_lane(derivation, derivation->state.lanes, derivation->state.lane, derivation->state.lane_keys[derivation->state.lane]) == NOSEPASS_OK;
+
+				if (remaining && left != 0) {
+					continue;
+				}
+
+				break;
+			}
+
+			key = derivation->state.key;
+			combine_lanes((uint8_t const (*)[NOSEPASS_KEY_SIZE])derivation->state.lane_keys, derivation->state.lanes, key);
+		}
+
+		if (derivation->state.site_name != NULL) {
+			expand_key(key, derivation->state.site_name, derivation->state.site_name_length, key);
+		}
+
+		break;
+	}
+
+	struct nosepass_profile* const profile = derivation->state.profile;
+
+	if (profile != NULL) {
+		profile->wall_ns[NOSEPASS_PHASE_SHA512] += derivation->state.timing.sha512_wall;
+		profile->cpu_ns[NOSEPASS_PHASE_SHA512] += derivation->state.timing.sha512_cpu;
+		profile->wall_ns[NOSEPASS_PHASE_BLOWFISH] += derivation->state.timing.blowfish_wall;
+		profile->cpu_ns[NOSEPASS_PHASE_BLOWFISH] += derivation->state.timing.blowfish_cpu;
+		memset(&derivation->state.timing, 0, sizeof derivation->state.timing);
+	}
+
+	return remaining;
+}
+
+void nosepass_derivation_set_profile(struct nosepass_derivation* const derivation, struct nosepass_profile* const profile) {
+	derivation->state.profile = profile;
+	memset(&derivation->state.timing, 0, sizeof derivation->state.timing);
+	bcrypt_pbkdf_set_timing(&derivation->state.kdf, profile != NULL ? &derivation->state.timing : NULL);
+}
+
+unsigned int nosepass_derivation_completed(struct nosepass_derivation const* const derivation) {
+	/* a site key is a single block, so a lane never exceeds the requested rounds */
+	if (derivation->state.lanes <= 1) {
+		return (unsigned int)derivation->state.kdf.completed;
+	}
+
+	uint64_t const completed = derivation->state.lane < derivation->state.lanes
+		? (uint64_t)derivation->state.lane * derivation->state.kdf.rounds + derivation->state.kdf.completed
+		: (uint64_t)derivation->state.lanes * derivation->state.kdf.rounds;
+
+	return completed < UINT_MAX ? (unsigned int)completed : UINT_MAX;
+}
+
+enum nosepass_status nosepass_derivation_extend(struct nosepass_derivation* const derivation, unsigned int const rounds) {
+	if (derivation->state.lanes > 1 || bcrypt_pbkdf_extend(&derivation->state.kdf, rounds) != 0) {
+		return NOSEPASS_INVALID_ARGUMENT;
+	}
+
+	return NOSEPASS_OK;
+}
+
+_Static_assert(sizeof ((struct nosepass_checkpoint*)NULL)->out == sizeof ((struct bcrypt_pbkdf_state*)NULL)->out, "checkpoints hold a bcrypt_pbkdf block");
+_Static_assert(sizeof ((struct nosepass_checkpoint*)NULL)->tmpout == sizeof ((struct bcrypt_pbkdf_state*)NULL)->tmpout, "checkpoints hold a bcrypt_pbkdf block");
+
+enum nosepass_status nosepass_derivation_save(struct nosepass_derivation const* const derivation, struct nosepass_checkpoint* const checkpoint) {
+	if (derivation->state.kdf.completed == 0 || derivation->state.lanes > 1) {
+		return NOSEPASS_INVALID_ARGUMENT;
+	}
+
+	checkpoint->rounds = (unsigned int)derivation->state.kdf.completed;
+	memcpy(checkpoint->out, derivation->state.kdf.out, sizeof checkpoint->out);
+	memcpy(checkpoint->tmpout, derivation->state.kdf.tmpout, sizeof checkpoint->tmpout);
+	return NOSEPASS_OK;
+}
+
+enum nosepass_status nosepass_derivation_resume(struct nosepass_derivation* const derivation, char const* const master_password, size_t const master_password_length, char const* const site_name, size_t const site_name_length, unsigned int const rounds, uint8_t key[const NOSEPASS_KEY_SIZE], struct nosepass_checkpoint const* const checkpoint) {
+	enum nosepass_status const status = nosepass_derivation_init(derivation, master_password, master_password_length, site_name, site_name_length, rounds, key);
+	return status != NOSEPASS_OK ? status : nosepass_derivation_restore(derivation, checkpoint);
+}
+
+enum nosepass_status nosepass_derivation_restore(struct nosepass_derivation* const derivation, struct nosepass_checkpoint const* const checkpoint) {
+	if (derivation->state.lanes > 1 || bcrypt_pbkdf_restore(&derivation->state.kdf, checkpoint->out, checkpoint->tmpout, checkpoint->rounds) != 0) {
+		explicit_bzero(derivation, sizeof *derivation);
+		return NOSEPASS_INVALID_ARGUMENT;
+	}
+
+	return NOSEPASS_OK;
+}
+
+void nosepass_workspace_init(void* const initial) {
+	Blowfish_initstate(initial);
+}
+
+void nosepass_derivation_set_workspace(struct nosepass_derivation* const derivation, void* const workspace, void const* const initial) {
+	bcrypt_pbkdf_set_workspace(&derivation->state.kdf, workspace, initial);
+}
+
+enum nosepass_status nosepass_derivation_finish(struct nosepass_derivation* const derivation) {
+	int const complete = bcrypt_pbkdf_finish(&derivation->state.kdf) == 0 && (derivation->state.lanes <= 1 || derivation->state.lane == derivation->state.lanes);
+
+	/* the lane that was running wiped its own output, but not the key */
+	if (derivation->state.lanes > 1) {
+		if (!complete) {
+			explicit_bzero(derivation->state.key, NOSEPASS_KEY_SIZE);
+		}
+
+		explicit_bzero(derivation->state.lane_keys, sizeof derivation->state.lane_keys);
+	}
+
+	explicit_bzero(derivation->state.salt, sizeof derivation->state.salt);
+	explicit_bzero(derivation->state.lane_salt, sizeof derivation->state.lane_salt);
+	return complete ? NOSEPASS_OK : NOSEPASS_INCOMPLETE;
+}
+
+/*
+ * Reads the wall-clock and thread CPU clocks, for a profile.
+ */
+__attribute__ ((nonnull))
+static void read_clocks(struct timespec clocks[const 2]) {
+	clock_gettime(CLOCK_MONOTONIC, &clocks[0]);
+	clock_gettime(CLOCK_THREAD_CPUTIME_ID, &clocks[1]);
+}
+
+/*
+ * Adds the time between two readings of the clocks to a phase of a profile.
+ */
+__attribute__ ((nonnull))
+static void add_time(struct nosepass_profile* const profile, enum nosepass_phase const phase, struct timespec const start[const 2], struct timespec const end[const 2]) {
+	profile->wall_ns[phase] += (uint64_t)(end[0].tv_sec - start[0].tv_sec) * UINT64_C(1000000000) + (uint64_t)end[0].tv_nsec - (uint64_t)start[0].tv_nsec;
+	profile->cpu_ns[phase] += (uint64_t)(end[1].tv_sec - start[1].tv_sec) * UINT64_C(1000000000) + (uint64_t)end[1].tv_nsec - (uint64_t)start[1].tv_nsec;
+}
+
+/*
+ * Generates a keystream block and samples it, timing both if there’s a profile. Returns the number of characters
+ * accepted.
+ */
+__attribute__ ((nonnull (1, 2, 3, 4), warn_unused_result))
+static size_t generate_block(ECRYPT_ctx* const ctx, struct nosepass_sampler const* const sampler, uint8_t generated_bytes[const ECRYPT_BLOCKLENGTH], char* const out, struct nosepass_profile* const profile) {
+	PROBE0(keystream_block);
+
+	if (profile == NULL) {
+		ECRYPT_keystream_blocks(ctx, generated_bytes, 1);
+		return sampler_sample(sampler, generated_bytes, out);
+	}
+
+	struct timespec clocks[3][2];
+
+	read_clocks(clocks[0]);
+	ECRYPT_keystream_blocks(ctx, generated_bytes, 1);
+	read_clocks(clocks[1]);
+	size_t const accepted = sampler_sample(sampler, generated_bytes, out);
+	read_clocks(clocks[2]);
+
+	add_time(profile, NOSEPASS_PHASE_KEYSTREAM, clocks[0], clocks[1]);
+	add_time(profile, NOSEPASS_PHASE_SAMPLING, clocks[1], clocks[2]);
+	profile->keystream_blocks++;
+	profile->bytes_sampled += SAMPLE_BLOCK_LENGTH;
+	profile->bytes_rejected += SAMPLE_BLOCK_LENGTH - accepted;
+	return accepted;
+}
+
+__attribute__ ((nonnull (1, 2, 3), warn_unused_result))
+static enum nosepass_status generate(uint8_t const key[const NOSEPASS_KEY_SIZE], struct nosepass_schema const* const schema, char* const out, size_t const out_size, struct nosepass_profile* const profile) {
+	if (schema->count == 0 || schema->count > NOSEPASS_MAX_COUNT) {
+		return NOSEPASS_INVALID_ARGUMENT;
+	}
+
+	if (out_size < schema->count) {
+		return NOSEPASS_BUFFER_TOO_SMALL;
+	}
+
+	uint8_t const nonce[8] = {
+		(uint8_t)schema->increment,
+		(uint8_t)(schema->increment >> 8),
+		(uint8_t)(schema->increment >> 16),
+		(uint8_t)(schema->increment >> 24),
+		(uint8_t)(schema->increment >> 32),
+		(uint8_t)(schema->increment >> 40),
+		(uint8_t)(schema->increment >> 48),
+		(uint8_t)(schema->increment >> 56),
+	};
+
+	ECRYPT_ctx ctx;
+
+	ECRYPT_init();
+	ECRYPT_keysetup(&ctx, key, 8 * NOSEPASS_KEY_SIZE, 8 * sizeof nonce);
+	ECRYPT_ivsetup(&ctx, nonce);
+
+	uint8_t generated_bytes[ECRYPT_BLOCKLENGTH];
+
+	/* blocks are sampled straight into the output while it has room for every character they could yield */
+	char excess[SAMPLE_BLOCK_LENGTH];
+	size_t i = 0;
+
+	while (schema->count - i >= SAMPLE_BLOCK_LENGTH) {
+		i += generate_block(&ctx, &schema->sampler, generated_bytes, out + i, profile);
+	}
+
+	while (i < schema->count) {
+		size_t const accepted = generate_block(&ctx, &schema->sampler, generated_bytes, excess, profile);
+		size_t const used = accepted < schema->count - i ? accepted : schema->count - i;
+		memcpy(out + i, excess, used);
+		i += used;
+	}
+
+	if (out_size > schema->count) {
+		out[schema->count] = '\0';
+	}
+
+	explicit_bzero(excess, sizeof excess);
+	explicit_bzero(generated_bytes, sizeof generated_bytes);
+	explicit_bzero(&ctx, sizeof ctx);
+	return NOSEPASS_OK;
+}
+
+enum nosepass_status nosepass_generate(uint8_t const key[const NOSEPASS_KEY_SIZE], struct nosepass_schema const* const schema, char* const out, size_t const out_size) {
+	return generate(key, schema, out, out_size, NULL);
+}
+
+enum nosepass_status nosepass_generate_profiled(uint8_t const key[const NOSEPASS_KEY_SIZE], struct nosepass_schema const* const schema, char* const out, size_t const out_size, struct nosepass_profile* const profile) {
+	return generate(key, schema, out, out_size, profile);
+}
+
+double nosepass_entropy_bits(struct nosepass_schema const* const schema) {
+	return schema->count * log2(schema->set_size);
+}
+
+double nosepass_rejection_rate(struct nosepass_schema const* const schema) {
+	return 1.0 - (double)schema->set_size / (double)sampler_range(schema->set_size);
+}
+
+char const* nosepass_strerror(enum nosepass_status const status) {
+	switch (status) {
+	case NOSEPASS_OK:
+		return "success";
+	case NOSEPASS_EXPECTED_SPACE:
+		return "expected space";
+	case NOSEPASS_UNKNOWN_PARAMETER:
+		return "expected one of " PREFIX_COUNT ", " PREFIX_SET ", " PREFIX_ROUNDS ", " PREFIX_INCREMENT ", " PREFIX_GROUP ", or " PREFIX_LANES;
+	case NOSEPASS_DUPLICATE_COUNT:
+		return "multiple settings for character count";
+	case NOSEPASS_DUPLICATE_SET:
+		return "multiple settings for character set";
+	case NOSEPASS_DUPLICATE_ROUNDS:
+		return "multiple settings for rounds";
+	case NOSEPASS_DUPLICATE_INCREMENT:
+		return "multiple settings for increment";
+	case NOSEPASS_INVALID_COUNT:
+		return "expected count";
+	case NOSEPASS_COUNT_ZERO:
+		return "character count must be greater than 0";
+	case NOSEPASS_COUNT_TOO_LARGE:
+		return "character count must be at most " S(NOSEPASS_MAX_COUNT);
+	case NOSEPASS_INVALID_ROUNDS:
+		return "expected number of rounds";
+	case NOSEPASS_ROUNDS_ZERO:
+		return "number of rounds must be at least 1";
+	case NOSEPASS_ROUNDS_TOO_LARGE:
+		return "number of rounds is too large";
+	case NOSEPASS_INVALID_INCREMENT:
+		return "expected increment";
+	case NOSEPASS_INCREMENT_TOO_LARGE:
+		return "increment is too large";
+	case NOSEPASS_SET_UNTERMINATED_ESCAPE:
+		return "expected escaped character, but found end of line";
+	case NOSEPASS_SET_NOT_PRINTABLE:
+		return "expected printable ASCII in character set";
+	case NOSEPASS_SET_RANGE_WITHOUT_START:
+		return "found hyphen range with no starting character";
+	case NOSEPASS_SET_RANGE_WITHOUT_END:
+		return "found hyphen range with no ending character";
+	case NOSEPASS_SET_EMPTY_RANGE:
+		return "empty range in character set";
+	case NOSEPASS_SET_TOO_SMALL:
+		return "character set must contain at least two characters";
+	case NOSEPASS_INVALID_ARGUMENT:
+		return "invalid argument";
+	case NOSEPASS_BUFFER_TOO_SMALL:
+		return "buffer too small";
+	case NOSEPASS_KDF_FAILED:
+		return "bcrypt_pbkdf failed";
+	case NOSEPASS_SET_DUPLICATE_CHARACTER:
+		return "character set contains a character more than once";
+	case NOSEPASS_INCOMPLETE:
+		return "derivation was finished before all of its rounds ran";
+	case NOSEPASS_DUPLICATE_GROUP:
+		return "multiple settings for group";
+	case NOSEPASS_INVALID_GROUP:
+		return "expected group name of printable characters";
+	case NOSEPASS_GROUP_TOO_LONG:
+		return "group name must be at most " S(NOSEPASS_MAX_GROUP_LENGTH) " characters";
+	case NOSEPASS_DUPLICATE_LANES:
+		return "multiple settings for lanes";
+	case NOSEPASS_INVALID_LANES:
+		return "expected number of lanes";
+	case NOSEPASS_LANES_TOO_LARGE:
+		return "number of lanes must be at most " S(NOSEPASS_MAX_LANES);
+	}
+
+	return "unknown error";
+}
@@ -0,0 +1,400 @@
+#ifndef NOSEPASS_H
+#define NOSEPASS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "bcrypt/bcrypt_pbkdf.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * libnosepass: the password derivation at the core of nosepass, as a reentrant API that never allocates and reports
+ * errors only through its return values.
+ *
+ * A password is derived in two steps: nosepass_derive_key stretches the master password into a site key with
+ * bcrypt_pbkdf, using the site name as salt, and nosepass_generate expands that key into a password according to a
+ * schema, which nosepass_parse_schema reads from configuration syntax.
+ *
+ * A schema can instead put its site in a group, whose key is stretched from the master password once, and expanded
+ * into the key of each site in it with HMAC-SHA-512, which takes about a microsecond.
+ *
+ * A schema with more than one lane derives its key, or its group’s, from that many independent bcrypt_pbkdf chains,
+ * each with a salt of its own, and combines them with SHA-512. The library runs the lanes one after another; a caller
+ * with threads to spare can run them at once, with nosepass_derivation_set_lane and nosepass_combine_lanes.
+ */
+
+#define NOSEPASS_API_VERSION 2
+
+/*
+ * The sizes of the structures callers allocate, which stay the same for as long as NOSEPASS_API_VERSION and the
+ * library’s soname do. The sampler’s and derivation’s layouts are private, and any release may change them within
+ * their reserved bytes; a new schema parameter takes the place of some of the schema’s reserved bytes, which
+ * nosepass_schema_init zeroes, so that zero has to keep the old meaning. A change that doesn’t fit bumps both.
+ */
+#define NOSEPASS_SCHEMA_SIZE 1024
+#define NOSEPASS_SAMPLER_SIZE 512
+#define NOSEPASS_DERIVATION_SIZE 2048
+
+#define NOSEPASS_KEY_SIZE 32
+#define NOSEPASS_MAX_COUNT 1024
+#define NOSEPASS_MAX_GROUP_LENGTH 64
+#define NOSEPASS_MAX_LANES 16
+
+/* the size of a derivation’s Blowfish state, for callers that place it themselves */
+#define NOSEPASS_WORKSPACE_SIZE 4168
+
+#define NOSEPASS_DEFAULT_COUNT 20
+#define NOSEPASS_DEFAULT_ROUNDS 200
+
+enum nosepass_status {
+	NOSEPASS_OK = 0,
+	NOSEPASS_EXPECTED_SPACE,
+	NOSEPASS_UNKNOWN_PARAMETER,
+	NOSEPASS_DUPLICATE_COUNT,
+	NOSEPASS_DUPLICATE_SET,
+	NOSEPASS_DUPLICATE_ROUNDS,
+	NOSEPASS_DUPLICATE_INCREMENT,
+	NOSEPASS_INVALID_COUNT,
+	NOSEPASS_COUNT_ZERO,
+	NOSEPASS_COUNT_TOO_LARGE,
+	NOSEPASS_INVALID_ROUNDS,
+	NOSEPASS_ROUNDS_ZERO,
+	NOSEPASS_ROUNDS_TOO_LARGE,
+	NOSEPASS_INVALID_INCREMENT,
+	NOSEPASS_INCREMENT_TOO_LARGE,
+	NOSEPASS_SET_UNTERMINATED_ESCAPE,
+	NOSEPASS_SET_NOT_PRINTABLE,
+	NOSEPASS_SET_RANGE_WITHOUT_START,
+	NOSEPASS_SET_RANGE_WITHOUT_END,
+	NOSEPASS_SET_EMPTY_RANGE,
+	NOSEPASS_SET_TOO_SMALL,
+	NOSEPASS_INVALID_ARGUMENT,
+	NOSEPASS_BUFFER_TOO_SMALL,
+	NOSEPASS_KDF_FAILED,
+	NOSEPASS_SET_DUPLICATE_CHARACTER,
+	NOSEPASS_INCOMPLETE,
+	NOSEPASS_DUPLICATE_GROUP,
+	NOSEPASS_INVALID_GROUP,
+	NOSEPASS_GROUP_TOO_LONG,
+	NOSEPASS_DUPLICATE_LANES,
+	NOSEPASS_INVALID_LANES,
+	NOSEPASS_LANES_TOO_LARGE,
+};
+
+/*
+ * How a character set is sampled; private to the library.
+ */
+struct nosepass_sampler {
+	uint8_t kind;
+
+	/* the character for each byte value, or '\0' if the byte is rejected; only used for arbitrary sets */
+	char table[256];
+
+	uint8_t reserved[NOSEPASS_SAMPLER_SIZE - 257];
+};
+
+struct nosepass_schema {
+	uint64_t increment;
+	unsigned int count;
+	unsigned int rounds;
+
+	/* the characters of the set, in ascending order from nosepass_parse_schema or in the order given to nosepass_set_characters */
+	uint8_t set_size;
+	char set[95];
+
+	/* the group whose key the site key is expanded from, or a length of 0 for none */
+	uint8_t group_length;
+	char group[NOSEPASS_MAX_GROUP_LENGTH];
+
+	/* the bcrypt_pbkdf chains the key is combined from; 1 for the original derivation */
+	uint8_t lanes;
+
+	struct nosepass_sampler sampler;
+
+	/* zeroed by nosepass_schema_init; parameters added later take their place */
+	uint8_t reserved[334];
+};
+
+/*
+ * Sets a schema to the defaults: 20 printable non-space characters, 200 rounds, increment 0, no group, and one lane.
+ */
+__attribute__ ((nonnull))
+void nosepass_schema_init(struct nosepass_schema* schema);
+
+/*
+ * Applies space-separated parameters (count=, set=, rounds=, increment=, group=, lanes=) to a schema, as in a configuration
+ * entry after the site name. On failure, the schema is unchanged, and `error_position`, if not NULL, is set to the
+ * part of `parameters` where the problem was found.
+ */
+__attribute__ ((nonnull (1, 2), warn_unused_result))
+enum nosepass_status nosepass_parse_schema(char const* parameters, struct nosepass_schema* schema, char const** error_position);
+
+/*
+ * Sets a schema’s character set to the given characters in the given order, rather than the ascending order that
+ * nosepass_parse_schema produces. The characters must be distinct and printable ASCII.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+enum nosepass_status nosepass_set_characters(struct nosepass_schema* schema, char const* characters, size_t length);
+
+/*
+ * Derives a site key from the master password.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+enum nosepass_status nosepass_derive_key(char const* master_password, size_t master_password_length, char const* site_name, size_t site_name_length, unsigned int rounds, uint8_t key[NOSEPASS_KEY_SIZE]);
+
+/*
+ * Derives a group key from the master password, with a salt that no site name from a configuration can be.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+enum nosepass_status nosepass_derive_group_key(char const* master_password, size_t master_password_length, char const* group, size_t group_length, unsigned int rounds, uint8_t key[NOSEPASS_KEY_SIZE]);
+
+/*
+ * Expands a group key into the key of a site in the group: the first half of HMAC-SHA-512 of the site name, keyed
+ * with the group key. `key` may be `group_key`.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+enum nosepass_status nosepass_expand_key(uint8_t const group_key[NOSEPASS_KEY_SIZE], char const* site_name, size_t site_name_length, uint8_t key[NOSEPASS_KEY_SIZE]);
+
+/*
+ * Derives a site key as its schema says: as nosepass_derive_key does, or from its group’s key, from as many lanes as it
+ * has.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+enum nosepass_status nosepass_derive_site_key(char const* master_password, size_t master_password_length, char const* site_name, size_t site_name_length, struct nosepass_schema const* schema, uint8_t key[NOSEPASS_KEY_SIZE]);
+
+/*
+ * The parts of a derivation that a profile times.
+ */
+enum nosepass_phase {
+	/* hashing each round’s salt */
+	NOSEPASS_PHASE_SHA512,
+
+	/* the Blowfish key expansion and encryption of each round */
+	NOSEPASS_PHASE_BLOWFISH,
+
+	/* generating the ChaCha20 keystream a password is sampled from */
+	NOSEPASS_PHASE_KEYSTREAM,
+
+	/* mapping keystream bytes to characters of the set */
+	NOSEPASS_PHASE_SAMPLING,
+
+	NOSEPASS_PHASE_COUNT,
+};
+
+/*
+ * Where the time of profiled derivations went, and what they consumed, added up over every derivation and password
+ * profiled with it. Timing reads the clocks around every part it measures, so it slows them slightly; unprofiled
+ * derivations don’t read the clocks at all.
+ */
+struct nosepass_profile {
+	/* nanoseconds of wall-clock and thread CPU time in each phase */
+	uint64_t wall_ns[NOSEPASS_PHASE_COUNT];
+	uint64_t cpu_ns[NOSEPASS_PHASE_COUNT];
+
+	uint64_t keystream_blocks;
+
+	/* keystream bytes sampled, and those of them that fell outside the set and were rejected */
+	uint64_t bytes_sampled;
+	uint64_t bytes_rejected;
+};
+
+/*
+ * The state of a derivation; private to the library.
+ */
+struct nosepass_derivation_state {
+	struct bcrypt_pbkdf_state kdf;
+
+	/* a group key’s salt, and the site to expand it for once it’s derived, or NULL */
+	uint8_t salt[16 + NOSEPASS_MAX_GROUP_LENGTH];
+	char const* site_name;
+	size_t site_name_length;
+
+	/* for a key of several lanes, run in turn: what each lane’s salt and password are, each lane’s output, and the key */
+	char const* master_password;
+	size_t master_password_length;
+	uint8_t const* base_salt;
+	size_t base_salt_length;
+	uint8_t lane_salt[64];
+	uint8_t lane_keys[NOSEPASS_MAX_LANES][NOSEPASS_KEY_SIZE];
+	uint8_t* key;
+	unsigned int lanes;
+	unsigned int lane;
+
+	/* the profile its rounds are added to, if any, and their time since the last step */
+	struct nosepass_profile* profile;
+	struct bcrypt_pbkdf_timing timing;
+};
+
+/*
+ * A site key derivation that runs a given number of rounds at a time, so that it can be interleaved with others,
+ * report its progress, or be abandoned.
+ */
+struct nosepass_derivation {
+	struct nosepass_derivation_state state;
+	uint8_t reserved[NOSEPASS_DERIVATION_SIZE - sizeof(struct nosepass_derivation_state)];
+};
+
+/*
+ * Starts deriving a site key, as nosepass_derive_key does. `site_name` and `key` must stay valid until the derivation
+ * is finished.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+enum nosepass_status nosepass_derivation_init(struct nosepass_derivation* derivation, char const* master_password, size_t master_password_length, char const* site_name, size_t site_name_length, unsigned int rounds, uint8_t key[NOSEPASS_KEY_SIZE]);
+
+/*
+ * Starts deriving a group key, as nosepass_derive_group_key does. `key` must stay valid until the derivation is
+ * finished.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+enum nosepass_status nosepass_derivation_init_group(struct nosepass_derivation* derivation, char const* master_password, size_t master_password_length, char const* group, size_t group_length, unsigned int rounds, uint8_t key[NOSEPASS_KEY_SIZE]);
+
+/*
+ * Starts deriving a site key as its schema says, as nosepass_derive_site_key does; for a site in a group, the group
+ * key is expanded into the site key whenever its last round has run. `site_name` and `key` must stay valid until the
+ * derivation is finished.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+enum nosepass_status nosepass_derivation_init_site(struct nosepass_derivation* derivation, char const* master_password, size_t master_password_length, char const* site_name, size_t site_name_length, struct nosepass_schema const* schema, uint8_t key[NOSEPASS_KEY_SIZE]);
+
+/*
+ * Makes a newly started derivation run `lanes` lanes in turn, combining them into its key once the last is done.
+ * `master_password` must stay valid until the derivation is finished. nosepass_derivation_init_site calls this for a
+ * schema with more than one lane.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+enum nosepass_status nosepass_derivation_set_lanes(struct nosepass_derivation* derivation, char const* master_password, size_t master_password_length, unsigned int lanes);
+
+/*
+ * Makes a newly started derivation derive only lane `lane` of a key of `lanes` lanes, into its key, for
+ * nosepass_combine_lanes to combine with the others. A site in a group isn’t expanded, so this gives a lane of the
+ * group key.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+enum nosepass_status nosepass_derivation_set_lane(struct nosepass_derivation* derivation, char const* master_password, size_t master_password_length, unsigned int lanes, unsigned int lane);
+
+/*
+ * Combines the outputs of every lane of a key, in order, into the key. It still has to be expanded for a site in a
+ * group.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+enum nosepass_status nosepass_combine_lanes(uint8_t const lane_keys[][NOSEPASS_KEY_SIZE], unsigned int lanes, uint8_t key[NOSEPASS_KEY_SIZE]);
+
+/*
+ * Runs up to `rounds` more rounds of a derivation. Returns 1 if it has rounds left, or 0 if the key is ready.
+ */
+__attribute__ ((nonnull))
+int nosepass_derivation_step(struct nosepass_derivation* derivation, unsigned int rounds);
+
+/*
+ * Gets the number of rounds a derivation has run, in all its lanes.
+ */
+__attribute__ ((nonnull, pure, warn_unused_result))
+unsigned int nosepass_derivation_completed(struct nosepass_derivation const* derivation);
+
+/*
+ * Raises the rounds of a derivation, which may already be done, to derive the key for more rounds without repeating
+ * the rounds already run. The key is rewritten when the derivation is stepped to completion again. Derivations running
+ * several lanes in turn can’t be extended.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+enum nosepass_status nosepass_derivation_extend(struct nosepass_derivation* derivation, unsigned int rounds);
+
+/*
+ * The state of a derivation after some number of rounds, from which a derivation of the same site with the same
+ * master password can continue to more rounds. It can reproduce the site key for those rounds, so it must be
+ * protected like one. Resuming from a checkpoint for a different site or master password gives wrong keys.
+ */
+struct nosepass_checkpoint {
+	unsigned int rounds;
+	uint8_t out[NOSEPASS_KEY_SIZE];
+	uint8_t tmpout[NOSEPASS_KEY_SIZE];
+};
+
+/*
+ * Saves a checkpoint of a derivation that has run at least one round, and isn’t running several lanes in turn.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+enum nosepass_status nosepass_derivation_save(struct nosepass_derivation const* derivation, struct nosepass_checkpoint* checkpoint);
+
+/*
+ * Starts deriving a site key, as nosepass_derivation_init does, but from a checkpoint of at most `rounds` rounds.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+enum nosepass_status nosepass_derivation_resume(struct nosepass_derivation* derivation, char const* master_password, size_t master_password_length, char const* site_name, size_t site_name_length, unsigned int rounds, uint8_t key[NOSEPASS_KEY_SIZE], struct nosepass_checkpoint const* checkpoint);
+
+/*
+ * Continues a newly started derivation of any kind, but one running several lanes in turn, from a checkpoint of at
+ * most its rounds. On failure, the derivation is wiped.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+enum nosepass_status nosepass_derivation_restore(struct nosepass_derivation* derivation, struct nosepass_checkpoint const* checkpoint);
+
+/*
+ * Fills NOSEPASS_WORKSPACE_SIZE bytes, aligned like a uint32_t, with the Blowfish state that every round of a
+ * derivation starts from.
+ */
+__attribute__ ((nonnull))
+void nosepass_workspace_init(void* initial);
+
+/*
+ * Makes a started derivation run its rounds in a workspace of NOSEPASS_WORKSPACE_SIZE bytes instead of on the stack,
+ * starting each from `initial`, from nosepass_workspace_init, instead of the library’s copy; either may be NULL. Both
+ * must be aligned like a uint32_t and stay valid until the derivation is finished. The workspace is wiped after every
+ * round.
+ */
+__attribute__ ((nonnull (1)))
+void nosepass_derivation_set_workspace(struct nosepass_derivation* derivation, void* workspace, void const* initial);
+
+/*
+ * Adds the time of a started derivation’s rounds from now on to a profile, or stops if it’s NULL.
+ */
+__attribute__ ((nonnull (1)))
+void nosepass_derivation_set_profile(struct nosepass_derivation* derivation, struct nosepass_profile* profile);
+
+/*
+ * Wipes a derivation’s state. If it wasn’t run to completion, the key is wiped too and NOSEPASS_INCOMPLETE is
+ * returned.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+enum nosepass_status nosepass_derivation_finish(struct nosepass_derivation* derivation);
+
+/*
+ * Generates a schema’s password from a site key into a buffer of at least schema->count bytes. The password is
+ * null-terminated if there’s room.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+enum nosepass_status nosepass_generate(uint8_t const key[NOSEPASS_KEY_SIZE], struct nosepass_schema const* schema, char* out, size_t out_size);
+
+/*
+ * Generates a password as nosepass_generate does, adding the time it takes and the keystream it consumes to a profile.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+enum nosepass_status nosepass_generate_profiled(uint8_t const key[NOSEPASS_KEY_SIZE], struct nosepass_schema const* schema, char* out, size_t out_size, struct nosepass_profile* profile);
+
+/*
+ * Gets the strength of a schema’s passwords, in bits.
+ */
+__attribute__ ((nonnull, pure, warn_unused_result))
+double nosepass_entropy_bits(struct nosepass_schema const* schema);
+
+/*
+ * Gets the fraction of keystream bytes that a schema’s passwords are expected to reject: those that, masked to the next
+ * power of two above the set size, fall outside the set.
+ */
+__attribute__ ((nonnull, pure, warn_unused_result))
+double nosepass_rejection_rate(struct nosepass_schema const* schema);
+
+/*
+ * Describes a status.
+ */
+__attribute__ ((const, returns_nonnull, warn_unused_result))
+char const* nosepass_strerror(enum nosepass_status status);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
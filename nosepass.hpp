@@ -0,0 +1,405 @@
+#ifndef NOSEPASS_HPP
+#define NOSEPASS_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <stop_token>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "nosepass.h"
+
+/*
+ * Asynchronous derivation for C++20 coroutines: `co_await nosepass::derive(pool, executor, ...)` runs the KDF on one
+ * of a worker_pool’s threads and resumes the awaiting coroutine through `executor`, so an event loop never blocks on
+ * bcrypt_pbkdf and needs no thread per request in flight.
+ */
+
+namespace nosepass {
+
+class error : public std::runtime_error {
+public:
+	explicit error(nosepass_status const status) :
+		std::runtime_error(nosepass_strerror(status)),
+		status_(status) {}
+
+	nosepass_status status() const noexcept {
+		return status_;
+	}
+
+private:
+	nosepass_status status_;
+};
+
+/*
+ * Thrown from a derivation whose stop token was triggered. A derivation that has already started stops within a few
+ * KDF rounds, and its worker moves on to the next.
+ */
+class cancelled : public std::runtime_error {
+public:
+	cancelled() :
+		std::runtime_error("derivation cancelled") {}
+};
+
+/*
+ * A generated password, wiped when destroyed.
+ */
+class password {
+public:
+	password() noexcept = default;
+
+	password(password const& other) noexcept :
+		length_(other.length_),
+		bits_(other.bits_) {
+		std::copy_n(other.value_, sizeof value_, value_);
+	}
+
+	password& operator=(password const& other) noexcept {
+		if (this != &other) {
+			std::copy_n(other.value_, sizeof value_, value_);
+			length_ = other.length_;
+			bits_ = other.bits_;
+		}
+
+		return *this;
+	}
+
+	~password() {
+		wipe();
+	}
+
+	std::string_view view() const noexcept {
+		return {value_, length_};
+	}
+
+	/* the strength of the schema the password was generated from, in bits */
+	double bits() const noexcept {
+		return bits_;
+	}
+
+	void wipe() noexcept {
+		char volatile* const p = value_;
+
+		for (std::size_t i = 0; i < sizeof value_; i++) {
+			p[i] = '\0';
+		}
+
+		length_ = 0;
+	}
+
+private:
+	char value_[NOSEPASS_MAX_COUNT] {};
+	std::size_t length_ = 0;
+	double bits_ = 0.0;
+
+	template <typename Executor>
+	friend class derivation;
+};
+
+/*
+ * Anything a derivation can be completed on: `executor.execute(f)` must arrange for `f()` to be called exactly once,
+ * typically by posting it to an event loop.
+ */
+template <typename Executor>
+concept executor = std::copy_constructible<Executor> && requires (Executor const& e, void (*f)()) {
+	e.execute(f);
+};
+
+/*
+ * Resumes coroutines on whichever thread completes their derivation, which is a worker thread unless the derivation
+ * is cancelled.
+ */
+struct inline_executor {
+	template <typename F>
+	void execute(F&& f) const {
+		std::forward<F>(f)();
+	}
+};
+
+namespace detail {
+
+class operation {
+public:
+	virtual void run() noexcept = 0;
+	virtual void cancel() noexcept = 0;
+
+protected:
+	~operation() = default;
+};
+
+}
+
+/*
+ * A fixed set of threads that run derivations in submission order. Destroying the pool cancels derivations that
+ * haven’t started and waits for the rest.
+ */
+class worker_pool {
+public:
+	explicit worker_pool(unsigned int thread_count = std::thread::hardware_concurrency()) {
+		if (thread_count == 0) {
+			thread_count = 1;
+		}
+
+		threads_.reserve(thread_count);
+
+		for (unsigned int i = 0; i < thread_count; i++) {
+			threads_.emplace_back([this] { work(); });
+		}
+	}
+
+	worker_pool(worker_pool const&) = delete;
+	worker_pool& operator=(worker_pool const&) = delete;
+
+	~worker_pool() {
+		std::deque<detail::operation*> pending;
+
+		{
+			std::lock_guard lock(mutex_);
+			stopping_ = true;
+			pending.swap(queue_);
+		}
+
+		ready_.notify_all();
+
+		for (std::thread& thread : threads_) {
+			thread.join();
+		}
+
+		for (detail::operation* const operation : pending) {
+			operation->cancel();
+		}
+	}
+
+	void submit(detail::operation* operation) {
+		{
+			std::lock_guard lock(mutex_);
+
+			if (!stopping_) {
+				queue_.push_back(operation);
+				operation = nullptr;
+			}
+		}
+
+		if (operation == nullptr) {
+			ready_.notify_one();
+		} else {
+			operation->cancel();
+		}
+	}
+
+	/*
+	 * Takes an operation out of the queue, if no worker has taken it yet. Returns whether it was there; if it was,
+	 * the pool will neither run nor cancel it.
+	 */
+	bool remove(detail::operation* const operation) {
+		std::lock_guard lock(mutex_);
+		auto const queued = std::find(queue_.begin(), queue_.end(), operation);
+
+		if (queued == queue_.end()) {
+			return false;
+		}
+
+		queue_.erase(queued);
+		return true;
+	}
+
+private:
+	void work() {
+		for (;;) {
+			detail::operation* operation;
+
+			{
+				std::unique_lock lock(mutex_);
+				ready_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+
+				if (queue_.empty()) {
+					return;
+				}
+
+				operation = queue_.front();
+				queue_.pop_front();
+			}
+
+			operation->run();
+		}
+	}
+
+	std::mutex mutex_;
+	std::condition_variable ready_;
+	std::deque<detail::operation*> queue_;
+	bool stopping_ = false;
+	std::vector<std::thread> threads_;
+};
+
+/*
+ * The awaitable returned by derive. Its arguments are referenced, not copied, and must outlive the co_await.
+ */
+template <typename Executor>
+class derivation final : private detail::operation {
+public:
+	derivation(worker_pool& pool, Executor executor, std::string_view const master_password, std::string_view const site_name, nosepass_schema const& schema, std::stop_token stop) :
+		pool_(pool),
+		executor_(std::move(executor)),
+		master_password_(master_password),
+		site_name_(site_name),
+		schema_(schema),
+		stop_(std::move(stop)) {}
+
+	derivation(derivation const&) = delete;
+	derivation& operator=(derivation const&) = delete;
+
+	bool await_ready() const noexcept {
+		return false;
+	}
+
+	bool await_suspend(std::coroutine_handle<> const continuation) {
+		continuation_ = continuation;
+
+		/* a stop requested before the derivation is queued resumes the coroutine immediately */
+		stop_callback_.emplace(stop_, cancel_callback {this});
+
+		state expected = state::initial;
+
+		if (!state_.compare_exchange_strong(expected, state::queued, std::memory_order_acq_rel)) {
+			return false;
+		}
+
+		pool_.submit(this);
+		return true;
+	}
+
+	password await_resume() {
+		stop_callback_.reset();
+
+		if (state_.load(std::memory_order_acquire) == state::cancelled || stop_.stop_requested()) {
+			result_.wipe();
+			throw cancelled();
+		}
+
+		if (status_ != NOSEPASS_OK) {
+			throw error(status_);
+		}
+
+		return result_;
+	}
+
+	~derivation() {
+		result_.wipe();
+	}
+
+private:
+	/* how many KDF rounds run between checks of the stop token */
+	static constexpr unsigned int step_rounds = 8;
+
+	enum class state {
+		initial,
+		queued,
+		running,
+		cancelled,
+	};
+
+	void run() noexcept override {
+		state expected = state::queued;
+
+		if (!state_.compare_exchange_strong(expected, state::running, std::memory_order_acq_rel)) {
+			return;
+		}
+
+		std::uint8_t key[NOSEPASS_KEY_SIZE];
+		nosepass_derivation kdf;
+
+		status_ = nosepass_derivation_init_site(&kdf, master_password_.data(), master_password_.size(), site_name_.data(), site_name_.size(), &schema_, key);
+
+		if (status_ == NOSEPASS_OK) {
+			while (!stop_.stop_requested() && nosepass_derivation_step(&kdf, step_rounds)) {}
+
+			status_ = nosepass_derivation_finish(&kdf);
+		}
+
+		if (status_ == NOSEPASS_OK) {
+			status_ = nosepass_generate(key, &schema_, result_.value_, sizeof result_.value_);
+		}
+
+		std::uint8_t volatile* const p = key;
+
+		for (std::size_t i = 0; i < sizeof key; i++) {
+			p[i] = 0;
+		}
+
+		if (status_ == NOSEPASS_OK) {
+			result_.length_ = schema_.count;
+			result_.bits_ = nosepass_entropy_bits(&schema_);
+		}
+
+		complete();
+	}
+
+	/* the pool is dropping the derivation without running it, and it’s no longer in the queue */
+	void cancel() noexcept override {
+		state_.store(state::cancelled, std::memory_order_release);
+		complete();
+	}
+
+	/*
+	 * Stops the derivation when its stop token is triggered. One still in the pool’s queue is taken out and completed
+	 * here; otherwise a worker has it, or is about to, and run() completes it once it notices the stop.
+	 */
+	void stop() noexcept {
+		state expected = state::initial;
+
+		if (state_.compare_exchange_strong(expected, state::cancelled, std::memory_order_acq_rel)) {
+			return;
+		}
+
+		if (expected == state::queued && pool_.remove(this)) {
+			cancel();
+		}
+	}
+
+	struct cancel_callback {
+		derivation* self;
+
+		void operator()() const noexcept {
+			self->stop();
+		}
+	};
+
+	void complete() noexcept {
+		executor_.execute([continuation = continuation_] { continuation.resume(); });
+	}
+
+	worker_pool& pool_;
+	Executor executor_;
+	std::string_view master_password_;
+	std::string_view site_name_;
+	nosepass_schema schema_;
+	std::stop_token stop_;
+	std::optional<std::stop_callback<cancel_callback>> stop_callback_;
+	std::coroutine_handle<> continuation_;
+	std::atomic<state> state_ {state::initial};
+	nosepass_status status_ = NOSEPASS_OK;
+	password result_;
+};
+
+/*
+ * Derives a site’s password on `pool`, resuming the awaiting coroutine through `executor`. Throws nosepass::error on
+ * failure and nosepass::cancelled if `stop` is triggered first.
+ */
+template <executor Executor>
+[[nodiscard]] derivation<Executor> derive(worker_pool& pool, Executor executor, std::string_view const master_password, std::string_view const site_name, nosepass_schema const& schema, std::stop_token stop = {}) {
+	return derivation<Executor>(pool, std::move(executor), master_password, site_name, schema, std::move(stop));
+}
+
+}
+
+#endif
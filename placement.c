@@ -0,0 +1,186 @@
+#define _GNU_SOURCE
+
+#include <dirent.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "placement.h"
+
+#define CPU_ROOT "/sys/devices/system/cpu"
+
+struct cpu {
+	int cpu;
+	int node;
+	int package;
+	int core;
+
+	/* which of its core’s hardware threads this is, and which of its node’s cores, counting from 0 */
+	int sibling;
+	int core_rank;
+};
+
+int placement_parse(char const* const name, enum placement_policy* const policy) {
+	if (strcmp(name, "none") == 0) {
+		*policy = PLACEMENT_NONE;
+	} else if (strcmp(name, "spread") == 0) {
+		*policy = PLACEMENT_SPREAD;
+	} else if (strcmp(name, "compact") == 0) {
+		*policy = PLACEMENT_COMPACT;
+	} else {
+		return 0;
+	}
+
+	return 1;
+}
+
+/*
+ * Reads a number from a topology file, or returns -1.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int read_topology(int const cpu, char const* const name) {
+	char path[64];
+	snprintf(path, sizeof path, CPU_ROOT "/cpu%d/topology/%s", cpu, name);
+
+	FILE* const f = fopen(path, "r");
+	int value;
+
+	if (f == NULL) {
+		return -1;
+	}
+
+	if (fscanf(f, "%d", &value) != 1) {
+		value = -1;
+	}
+
+	fclose(f);
+	return value;
+}
+
+int placement_node(int const cpu) {
+	char path[64];
+	snprintf(path, sizeof path, CPU_ROOT "/cpu%d", cpu);
+
+	DIR* const directory = opendir(path);
+	struct dirent const* entry;
+	int node = 0;
+
+	if (directory == NULL) {
+		return 0;
+	}
+
+	while ((entry = readdir(directory)) != NULL) {
+		if (strncmp(entry->d_name, "node", 4) == 0 && entry->d_name[4] >= '0' && entry->d_name[4] <= '9') {
+			node = atoi(entry->d_name + 4);
+			break;
+		}
+	}
+
+	closedir(directory);
+	return node;
+}
+
+__attribute__ ((nonnull, pure, warn_unused_result))
+static int compare_by_core(void const* const a, void const* const b) {
+	struct cpu const* const x = a;
+	struct cpu const* const y = b;
+
+	return
+		x->node != y->node ? (x->node > y->node) - (x->node < y->node) :
+		x->package != y->package ? (x->package > y->package) - (x->package < y->package) :
+		x->core != y->core ? (x->core > y->core) - (x->core < y->core) :
+		(x->cpu > y->cpu) - (x->cpu < y->cpu);
+}
+
+/*
+ * Orders CPUs by sibling first, so that every core’s first hardware thread comes before any second one, and then by
+ * core rank, so that consecutive threads take turns between nodes.
+ */
+__attribute__ ((nonnull, pure, warn_unused_result))
+static int compare_spread(void const* const a, void const* const b) {
+	struct cpu const* const x = a;
+	struct cpu const* const y = b;
+
+	return
+		x->sibling != y->sibling ? (x->sibling > y->sibling) - (x->sibling < y->sibling) :
+		x->core_rank != y->core_rank ? (x->core_rank > y->core_rank) - (x->core_rank < y->core_rank) :
+		compare_by_core(a, b);
+}
+
+int placement_choose(enum placement_policy const policy, unsigned int const thread_count, int** const cpus) {
+	*cpus = NULL;
+
+	if (policy == PLACEMENT_NONE) {
+		return 1;
+	}
+
+	cpu_set_t allowed;
+
+	if (sched_getaffinity(0, sizeof allowed, &allowed) != 0) {
+		perror("failed to get CPU affinity");
+		return 0;
+	}
+
+	int const cpu_count = CPU_COUNT(&allowed);
+	struct cpu* const topology = malloc((size_t)cpu_count * sizeof *topology);
+
+	if (topology == NULL || (*cpus = malloc(thread_count * sizeof **cpus)) == NULL) {
+		fputs("failed to allocate memory\n", stderr);
+		free(topology);
+		return 0;
+	}
+
+	int found = 0;
+
+	for (int cpu = 0; cpu < CPU_SETSIZE && found < cpu_count; cpu++) {
+		if (CPU_ISSET((size_t)cpu, &allowed)) {
+			int const core = read_topology(cpu, "core_id");
+
+			topology[found].cpu = cpu;
+			topology[found].node = placement_node(cpu);
+			topology[found].package = read_topology(cpu, "physical_package_id");
+
+			/* a CPU that doesn’t say which core it is has one of its own */
+			topology[found].core = core == -1 ? -1 - cpu : core;
+			found++;
+		}
+	}
+
+	if (found == 0) {
+		free(topology);
+		free(*cpus);
+		*cpus = NULL;
+		return 1;
+	}
+
+	qsort(topology, (size_t)found, sizeof *topology, compare_by_core);
+
+	for (int i = 0; i < found; i++) {
+		int const same_node = i != 0 && topology[i].node == topology[i - 1].node;
+		int const same_core = same_node && topology[i].package == topology[i - 1].package && topology[i].core == topology[i - 1].core;
+
+		topology[i].sibling = same_core ? topology[i - 1].sibling + 1 : 0;
+		topology[i].core_rank = !same_node ? 0 : same_core ? topology[i - 1].core_rank : topology[i - 1].core_rank + 1;
+	}
+
+	if (policy == PLACEMENT_SPREAD) {
+		qsort(topology, (size_t)found, sizeof *topology, compare_spread);
+	}
+
+	/* threads beyond the CPUs share them, in the same order */
+	for (unsigned int i = 0; i < thread_count; i++) {
+		(*cpus)[i] = topology[i % (unsigned int)found].cpu;
+	}
+
+	free(topology);
+	return 1;
+}
+
+int placement_pin(int const cpu) {
+	cpu_set_t set;
+	CPU_ZERO(&set);
+	CPU_SET((size_t)cpu, &set);
+	return pthread_setaffinity_np(pthread_self(), sizeof set, &set) == 0;
+}
@@ -0,0 +1,35 @@
+enum placement_policy {
+	PLACEMENT_NONE,
+
+	/* one thread on each core, spread over NUMA nodes, before any core’s second hardware thread */
+	PLACEMENT_SPREAD,
+
+	/* every hardware thread of a core, then the next core on the same node */
+	PLACEMENT_COMPACT,
+};
+
+/*
+ * Parses a placement policy’s name: none, spread, or compact.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+int placement_parse(char const* name, enum placement_policy* policy);
+
+/*
+ * Chooses a CPU for each of `thread_count` threads from the CPUs this process may run on, by their cores and NUMA
+ * nodes as sysfs describes them. With PLACEMENT_NONE, `*cpus` is set to NULL; otherwise it’s an array to free.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+int placement_choose(enum placement_policy policy, unsigned int thread_count, int** cpus);
+
+/*
+ * Finds a CPU’s NUMA node from the `nodeN` link in its sysfs directory. Without NUMA, everything is node 0.
+ */
+__attribute__ ((warn_unused_result))
+int placement_node(int cpu);
+
+/*
+ * Pins the calling thread to a CPU. A thread that allocates and first touches its own memory afterwards gets it from
+ * that CPU’s NUMA node.
+ */
+__attribute__ ((warn_unused_result))
+int placement_pin(int cpu);
@@ -0,0 +1,40 @@
+#ifndef NOSEPASS_PROBES_H
+#define NOSEPASS_PROBES_H
+
+/*
+ * USDT probes, under the provider `nosepass`, for tracing derivations from outside the process with bpftrace or perf.
+ * Each compiles to a single nop and a note section entry, so it costs next to nothing until a tracer attaches, and to
+ * nothing at all where <sys/sdt.h> isn’t installed or NOSEPASS_NO_PROBES is defined. No probe takes anything secret,
+ * or anything computed from a secret, as an argument:
+ *
+ *   schema_resolved(rounds, count, set_size)   a site’s schema was loaded from the configuration
+ *   kdf_start(rounds, key_length)              a key derivation started
+ *   kdf_round(completed, rounds)               every PROBE_ROUND_INTERVAL rounds of a key derivation
+ *   kdf_end(completed, rounds)                 a key derivation’s last round finished
+ *   keystream_block()                          a keystream block was generated for sampling
+ *   output_written(length)                     a password was written out
+ */
+
+/* a power of two; rounds take milliseconds, so this is about a probe every fraction of a second */
+#define PROBE_ROUND_INTERVAL 64
+
+#if !defined(NOSEPASS_NO_PROBES) && defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#include <sys/sdt.h>
+#define NOSEPASS_HAVE_PROBES
+#endif
+#endif
+
+#ifdef NOSEPASS_HAVE_PROBES
+#define PROBE0(name) DTRACE_PROBE(nosepass, name)
+#define PROBE1(name, a) DTRACE_PROBE1(nosepass, name, a)
+#define PROBE2(name, a, b) DTRACE_PROBE2(nosepass, name, a, b)
+#define PROBE3(name, a, b, c) DTRACE_PROBE3(nosepass, name, a, b, c)
+#else
+#define PROBE0(name) ((void)0)
+#define PROBE1(name, a) ((void)0)
+#define PROBE2(name, a, b) ((void)0)
+#define PROBE3(name, a, b, c) ((void)0)
+#endif
+
+#endif
@@ -0,0 +1,12575 @@
+/* Generated by psl.py from the Public Suffix List (https://publicsuffix.org/); do not edit. */
+
+#define PSL_NODE_COUNT 9701
+
+static char const psl_labels[] = {
+	'a', 'a', 'a', 'a', 'a', 'r', 'p', 'a', 'b', 'a', 'r', 't', 'h', 'a', 'b', 'b',
+	'a', 'b', 'b', 'o', 't', 't', 'a', 'b', 'b', 'v', 'i', 'e', 'a', 'b', 'c', 'a',
+	'b', 'l', 'e', 'a', 'b', 'o', 'g', 'a', 'd', 'o', 'a', 'b', 'u', 'd', 'h', 'a',
+	'b', 'i', 'a', 'c', 'a', 'c', 'a', 'd', 'e', 'm', 'y', 'a', 'c', 'c', 'e', 'n',
+	't', 'u', 'r', 'e', 'a', 'c', 'c', 'o', 'u', 'n', 't', 'a', 'n', 't', 'a', 'c',
+	'c', 'o', 'u', 'n', 't', 'a', 'n', 't', 's', 'a', 'c', 'o', 'a', 'c', 't', 'o',
+	'r', 'a', 'd', 's', 'a', 'd', 'u', 'l', 't', 'a', 'e', 'a', 'e', 'g', 'a', 'e',
+	'r', 'o', 'a', 'e', 't', 'n', 'a', 'a', 'f', 'a', 'f', 'l', 'a', 'f', 'r', 'i',
+	'c', 'a', 'a', 'g', 'a', 'g', 'a', 'k', 'h', 'a', 'n', 'a', 'g', 'e', 'n', 'c',
+	'y', 'a', 'i', 'a', 'i', 'g', 'a', 'i', 'r', 'b', 'u', 's', 'a', 'i', 'r', 'f',
+	'o', 'r', 'c', 'e', 'a', 'i', 'r', 't', 'e', 'l', 'a', 'k', 'd', 'n', 'a', 'l',
+	'a', 'l', 'f', 'a', 'r', 'o', 'm', 'e', 'o', 'a', 'l', 'i', 'b', 'a', 'b', 'a',
+	'a', 'l', 'i', 'p', 'a', 'y', 'a', 'l', 'l', 'f', 'i', 'n', 'a', 'n', 'z', 'a',
+	'l', 'l', 's', 't', 'a', 't', 'e', 'a', 'l', 'l', 'y', 'a', 'l', 's', 'a', 'c',
+	'e', 'a', 'l', 's', 't', 'o', 'm', 'a', 'm', 'a', 'm', 'a', 'z', 'o', 'n', 'a',
+	'm', 'e', 'r', 'i', 'c', 'a', 'n', 'e', 'x', 'p', 'r', 'e', 's', 's', 'a', 'm',
+	'e', 'r', 'i', 'c', 'a', 'n', 'f', 'a', 'm', 'i', 'l', 'y', 'a', 'm', 'e', 'x',
+	'a', 'm', 'f', 'a', 'm', 'a', 'm', 'i', 'c', 'a', 'a', 'm', 's', 't', 'e', 'r',
+	'd', 'a', 'm', 'a', 'n', 'a', 'l', 'y', 't', 'i', 'c', 's', 'a', 'n', 'd', 'r',
+	'o', 'i', 'd', 'a', 'n', 'q', 'u', 'a', 'n', 'a', 'o', 'a', 'o', 'l', 'a', 'p',
+	'a', 'r', 't', 'm', 'e', 'n', 't', 's', 'a', 'p', 'p', 'a', 'p', 'p', 'l', 'e',
+	'a', 'q', 'a', 'q', 'u', 'a', 'r', 'e', 'l', 'l', 'e', 'a', 'r', 'a', 'b', 'a',
+	'r', 'a', 'm', 'c', 'o', 'a', 'r', 'c', 'h', 'i', 'a', 'r', 'm', 'y', 'a', 'r',
+	't', 'e', 'a', 's', 'a', 's', 'd', 'a', 'a', 's', 'i', 'a', 'a', 's', 's', 'o',
+	'c', 'i', 'a', 't', 'e', 's', 'a', 't', 'h', 'l', 'e', 't', 'a', 'a', 't', 't',
+	'o', 'r', 'n', 'e', 'y', 'a', 'u', 'a', 'u', 'c', 't', 'i', 'o', 'n', 'a', 'u',
+	'd', 'i', 'a', 'u', 'd', 'i', 'b', 'l', 'e', 'a', 'u', 'd', 'i', 'o', 'a', 'u',
+	's', 'p', 'o', 's', 't', 'a', 'u', 't', 'h', 'o', 'r', 'a', 'u', 't', 'o', 'a',
+	'u', 't', 'o', 's', 'a', 'v', 'i', 'a', 'n', 'c', 'a', 'a', 'w', 'a', 'w', 's',
+	'a', 'x', 'a', 'x', 'a', 'a', 'z', 'u', 'r', 'e', 'b', 'a', 'b', 'y', 'b', 'a',
+	'i', 'd', 'u', 'b', 'a', 'n', 'a', 'm', 'e', 'x', 'b', 'a', 'n', 'a', 'n', 'a',
+	'r', 'e', 'p', 'u', 'b', 'l', 'i', 'c', 'b', 'a', 'n', 'd', 'b', 'a', 'n', 'k',
+	'b', 'a', 'r', 'c', 'e', 'l', 'o', 'n', 'a', 'b', 'a', 'r', 'c', 'l', 'a', 'y',
+	'c', 'a', 'r', 'd', 'b', 'a', 'r', 'c', 'l', 'a', 'y', 's', 'b', 'a', 'r', 'e',
+	'f', 'o', 'o', 't', 'b', 'a', 'r', 'g', 'a', 'i', 'n', 's', 'b', 'a', 's', 'e',
+	'b', 'a', 'l', 'l', 'b', 'a', 's', 'k', 'e', 't', 'b', 'a', 'l', 'l', 'b', 'a',
+	'u', 'h', 'a', 'u', 's', 'b', 'a', 'y', 'e', 'r', 'n', 'b', 'b', 'c', 'b', 'b',
+	't', 'b', 'b', 'v', 'a', 'b', 'c', 'g', 'b', 'c', 'n', 'b', 'd', 'b', 'e', 'b',
+	'e', 'a', 't', 's', 'b', 'e', 'a', 'u', 't', 'y', 'b', 'e', 'e', 'r', 'b', 'e',
+	'n', 't', 'l', 'e', 'y', 'b', 'e', 'r', 'l', 'i', 'n', 'b', 'e', 's', 't', 'b',
+	'e', 's', 't', 'b', 'u', 'y', 'b', 'e', 't', 'b', 'f', 'b', 'g', 'b', 'h', 'b',
+	'h', 'a', 'r', 't', 'i', 'b', 'i', 'b', 'l', 'e', 'b', 'i', 'd', 'b', 'i', 'k',
+	'e', 'b', 'i', 'n', 'g', 'b', 'i', 'n', 'g', 'o', 'b', 'i', 'o', 'b', 'i', 'z',
+	'b', 'j', 'b', 'l', 'a', 'c', 'k', 'b', 'l', 'a', 'c', 'k', 'f', 'r', 'i', 'd',
+	'a', 'y', 'b', 'l', 'o', 'c', 'k', 'b', 'u', 's', 't', 'e', 'r', 'b', 'l', 'o',
+	'g', 'b', 'l', 'o', 'o', 'm', 'b', 'e', 'r', 'g', 'b', 'l', 'u', 'e', 'b', 'm',
+	'b', 'm', 's', 'b', 'm', 'w', 'b', 'n', 'b', 'n', 'p', 'p', 'a', 'r', 'i', 'b',
+	'a', 's', 'b', 'o', 'a', 't', 's', 'b', 'o', 'e', 'h', 'r', 'i', 'n', 'g', 'e',
+	'r', 'b', 'o', 'f', 'a', 'b', 'o', 'm', 'b', 'o', 'n', 'd', 'b', 'o', 'o', 'b',
+	'o', 'o', 'k', 'b', 'o', 'o', 'k', 'i', 'n', 'g', 'b', 'o', 's', 'c', 'h', 'b',
+	'o', 's', 't', 'i', 'k', 'b', 'o', 's', 't', 'o', 'n', 'b', 'o', 'u', 't', 'i',
+	'q', 'u', 'e', 'b', 'o', 'x', 'b', 'r', 'b', 'r', 'a', 'd', 'e', 's', 'c', 'o',
+	'b', 'r', 'i', 'd', 'g', 'e', 's', 't', 'o', 'n', 'e', 'b', 'r', 'o', 'a', 'd',
+	'w', 'a', 'y', 'b', 'r', 'o', 'k', 'e', 'r', 'b', 'r', 'o', 't', 'h', 'e', 'r',
+	'b', 'r', 'u', 's', 's', 'e', 'l', 's', 'b', 's', 'b', 'u', 'i', 'l', 'd', 'b',
+	'u', 'i', 'l', 'd', 'e', 'r', 's', 'b', 'u', 's', 'i', 'n', 'e', 's', 's', 'b',
+	'u', 'z', 'z', 'b', 'w', 'b', 'z', 'b', 'z', 'h', 'c', 'a', 'f', 'e', 'c', 'a',
+	'l', 'c', 'a', 'l', 'l', 'c', 'a', 'l', 'v', 'i', 'n', 'k', 'l', 'e', 'i', 'n',
+	'c', 'a', 'm', 'c', 'a', 'm', 'e', 'r', 'a', 'c', 'a', 'm', 'p', 'c', 'a', 'n',
+	'o', 'n', 'c', 'a', 'p', 'e', 't', 'o', 'w', 'n', 'c', 'a', 'p', 'i', 't', 'a',
+	'l', 'c', 'a', 'p', 'i', 't', 'a', 'l', 'o', 'n', 'e', 'c', 'a', 'r', 'a', 'v',
+	'a', 'n', 'c', 'a', 'r', 'd', 's', 'c', 'a', 'r', 'e', 'c', 'a', 'r', 'e', 'e',
+	'r', 'c', 'a', 'r', 'e', 'e', 'r', 's', 'c', 'a', 'r', 's', 'c', 'a', 's', 'a',
+	'c', 'a', 's', 'e', 'c', 'a', 's', 'h', 'c', 'a', 's', 'i', 'n', 'o', 'c', 'a',
+	't', 'c', 'a', 't', 'e', 'r', 'i', 'n', 'g', 'c', 'a', 't', 'h', 'o', 'l', 'i',
+	'c', 'c', 'b', 'n', 'c', 'b', 'r', 'e', 'c', 'b', 's', 'c', 'd', 'c', 'e', 'n',
+	't', 'e', 'r', 'c', 'e', 'o', 'c', 'e', 'r', 'n', 'c', 'f', 'c', 'f', 'a', 'c',
+	'f', 'd', 'c', 'h', 'a', 'n', 'e', 'l', 'c', 'h', 'a', 'n', 'n', 'e', 'l', 'c',
+	'h', 'a', 'r', 'i', 't', 'y', 'c', 'h', 'a', 's', 'e', 'c', 'h', 'a', 't', 'c',
+	'h', 'e', 'a', 'p', 'c', 'h', 'i', 'n', 't', 'a', 'i', 'c', 'h', 'r', 'i', 's',
+	't', 'm', 'a', 's', 'c', 'h', 'r', 'o', 'm', 'e', 'c', 'h', 'u', 'r', 'c', 'h',
+	'c', 'i', 'p', 'r', 'i', 'a', 'n', 'i', 'c', 'i', 'r', 'c', 'l', 'e', 'c', 'i',
+	's', 'c', 'o', 'c', 'i', 't', 'a', 'd', 'e', 'l', 'c', 'i', 't', 'i', 'c', 'i',
+	't', 'i', 'c', 'c', 'i', 't', 'y', 'c', 'i', 't', 'y', 'e', 'a', 't', 's', 'c',
+	'l', 'a', 'i', 'm', 's', 'c', 'l', 'e', 'a', 'n', 'i', 'n', 'g', 'c', 'l', 'i',
+	'c', 'k', 'c', 'l', 'i', 'n', 'i', 'c', 'c', 'l', 'i', 'n', 'i', 'q', 'u', 'e',
+	'c', 'l', 'o', 't', 'h', 'i', 'n', 'g', 'c', 'l', 'o', 'u', 'd', 'c', 'l', 'u',
+	'b', 'c', 'l', 'u', 'b', 'm', 'e', 'd', 'c', 'm', 'c', 'o', 'a', 'c', 'h', 'c',
+	'o', 'd', 'e', 's', 'c', 'o', 'f', 'f', 'e', 'e', 'c', 'o', 'l', 'l', 'e', 'g',
+	'e', 'c', 'o', 'l', 'o', 'g', 'n', 'e', 'c', 'o', 'm', 'c', 'o', 'm', 'c', 'a',
+	's', 't', 'c', 'o', 'm', 'm', 'b', 'a', 'n', 'k', 'c', 'o', 'm', 'm', 'u', 'n',
+	'i', 't', 'y', 'c', 'o', 'm', 'p', 'a', 'n', 'y', 'c', 'o', 'm', 'p', 'a', 'r',
+	'e', 'c', 'o', 'm', 'p', 'u', 't', 'e', 'r', 'c', 'o', 'm', 's', 'e', 'c', 'c',
+	'o', 'n', 'd', 'o', 's', 'c', 'o', 'n', 's', 't', 'r', 'u', 'c', 't', 'i', 'o',
+	'n', 'c', 'o', 'n', 's', 'u', 'l', 't', 'i', 'n', 'g', 'c', 'o', 'n', 't', 'a',
+	'c', 't', 'c', 'o', 'n', 't', 'r', 'a', 'c', 't', 'o', 'r', 's', 'c', 'o', 'o',
+	'k', 'i', 'n', 'g', 'c', 'o', 'o', 'k', 'i', 'n', 'g', 'c', 'h', 'a', 'n', 'n',
+	'e', 'l', 'c', 'o', 'o', 'l', 'c', 'o', 'o', 'p', 'c', 'o', 'r', 's', 'i', 'c',
+	'a', 'c', 'o', 'u', 'n', 't', 'r', 'y', 'c', 'o', 'u', 'p', 'o', 'n', 'c', 'o',
+	'u', 'p', 'o', 'n', 's', 'c', 'o', 'u', 'r', 's', 'e', 's', 'c', 'p', 'a', 'c',
+	'r', 'c', 'r', 'e', 'd', 'i', 't', 'c', 'r', 'e', 'd', 'i', 't', 'c', 'a', 'r',
+	'd', 'c', 'r', 'e', 'd', 'i', 't', 'u', 'n', 'i', 'o', 'n', 'c', 'r', 'i', 'c',
+	'k', 'e', 't', 'c', 'r', 'o', 'w', 'n', 'c', 'r', 's', 'c', 'r', 'u', 'i', 's',
+	'e', 'c', 'r', 'u', 'i', 's', 'e', 's', 'c', 'u', 'c', 'u', 'i', 's', 'i', 'n',
+	'e', 'l', 'l', 'a', 'c', 'v', 'c', 'w', 'c', 'x', 'c', 'y', 'm', 'r', 'u', 'c',
+	'y', 'o', 'u', 'c', 'z', 'd', 'a', 'b', 'u', 'r', 'd', 'a', 'd', 'd', 'a', 'n',
+	'c', 'e', 'd', 'a', 't', 'a', 'd', 'a', 't', 'e', 'd', 'a', 't', 'i', 'n', 'g',
+	'd', 'a', 't', 's', 'u', 'n', 'd', 'c', 'l', 'k', 'd', 'd', 's', 'd', 'e', 'a',
+	'l', 'd', 'e', 'a', 'l', 'e', 'r', 'd', 'e', 'a', 'l', 's', 'd', 'e', 'g', 'r',
+	'e', 'e', 'd', 'e', 'l', 'i', 'v', 'e', 'r', 'y', 'd', 'e', 'l', 'l', 'd', 'e',
+	'l', 'o', 'i', 't', 't', 'e', 'd', 'e', 'l', 't', 'a', 'd', 'e', 'm', 'o', 'c',
+	'r', 'a', 't', 'd', 'e', 'n', 't', 'a', 'l', 'd', 'e', 'n', 't', 'i', 's', 't',
+	'd', 'e', 's', 'i', 'd', 'e', 's', 'i', 'g', 'n', 'd', 'e', 'v', 'd', 'h', 'l',
+	'd', 'i', 'a', 'm', 'o', 'n', 'd', 's', 'd', 'i', 'e', 't', 'd', 'i', 'g', 'i',
+	't', 'a', 'l', 'd', 'i', 'r', 'e', 'c', 't', 'd', 'i', 'r', 'e', 'c', 't', 'o',
+	'r', 'y', 'd', 'i', 's', 'c', 'o', 'u', 'n', 't', 'd', 'i', 's', 'c', 'o', 'v',
+	'e', 'r', 'd', 'i', 's', 'h', 'd', 'i', 'y', 'd', 'j', 'd', 'k', 'd', 'm', 'd',
+	'n', 'p', 'd', 'o', 'c', 's', 'd', 'o', 'c', 't', 'o', 'r', 'd', 'o', 'g', 'd',
+	'o', 'm', 'a', 'i', 'n', 's', 'd', 'o', 't', 'd', 'o', 'w', 'n', 'l', 'o', 'a',
+	'd', 'd', 'r', 'i', 'v', 'e', 'd', 't', 'v', 'd', 'u', 'b', 'a', 'i', 'd', 'u',
+	'n', 'l', 'o', 'p', 'd', 'u', 'p', 'o', 'n', 't', 'd', 'u', 'r', 'b', 'a', 'n',
+	'd', 'v', 'a', 'g', 'd', 'v', 'r', 'd', 'z', 'e', 'a', 'r', 't', 'h', 'e', 'd',
+	'e', 'k', 'a', 'e', 'd', 'u', 'e', 'd', 'u', 'c', 'a', 't', 'i', 'o', 'n', 'e',
+	'm', 'a', 'i', 'l', 'e', 'm', 'e', 'r', 'c', 'k', 'e', 'n', 'e', 'r', 'g', 'y',
+	'e', 'n', 'g', 'i', 'n', 'e', 'e', 'r', 'e', 'n', 'g', 'i', 'n', 'e', 'e', 'r',
+	'i', 'n', 'g', 'e', 'n', 't', 'e', 'r', 'p', 'r', 'i', 's', 'e', 's', 'e', 'p',
+	's', 'o', 'n', 'e', 'q', 'u', 'i', 'p', 'm', 'e', 'n', 't', 'e', 'r', 'i', 'c',
+	's', 's', 'o', 'n', 'e', 'r', 'n', 'i', 'e', 's', 'q', 'e', 's', 't', 'a', 't',
+	'e', 'e', 't', 'i', 's', 'a', 'l', 'a', 't', 'e', 'u', 'e', 'u', 'r', 'o', 'v',
+	'i', 's', 'i', 'o', 'n', 'e', 'u', 's', 'e', 'v', 'e', 'n', 't', 's', 'e', 'x',
+	'c', 'h', 'a', 'n', 'g', 'e', 'e', 'x', 'p', 'e', 'r', 't', 'e', 'x', 'p', 'o',
+	's', 'e', 'd', 'e', 'x', 't', 'r', 'a', 's', 'p', 'a', 'c', 'e', 'f', 'a', 'g',
+	'e', 'f', 'a', 'i', 'l', 'f', 'a', 'i', 'r', 'w', 'i', 'n', 'd', 's', 'f', 'a',
+	'i', 't', 'h', 'f', 'a', 'n', 'f', 'a', 'n', 's', 'f', 'a', 'r', 'm', 'f', 'a',
+	'r', 'm', 'e', 'r', 's', 'f', 'a', 's', 'h', 'i', 'o', 'n', 'f', 'a', 's', 't',
+	'f', 'e', 'd', 'e', 'x', 'f', 'e', 'e', 'd', 'b', 'a', 'c', 'k', 'f', 'e', 'r',
+	'r', 'a', 'r', 'i', 'f', 'e', 'r', 'r', 'e', 'r', 'o', 'f', 'i', 'a', 't', 'f',
+	'i', 'd', 'e', 'l', 'i', 't', 'y', 'f', 'i', 'd', 'o', 'f', 'i', 'l', 'm', 'f',
+	'i', 'n', 'a', 'l', 'f', 'i', 'n', 'a', 'n', 'c', 'e', 'f', 'i', 'n', 'a', 'n',
+	'c', 'i', 'a', 'l', 'f', 'i', 'r', 'e', 'f', 'i', 'r', 'e', 's', 't', 'o', 'n',
+	'e', 'f', 'i', 'r', 'm', 'd', 'a', 'l', 'e', 'f', 'i', 's', 'h', 'f', 'i', 's',
+	'h', 'i', 'n', 'g', 'f', 'i', 't', 'f', 'i', 't', 'n', 'e', 's', 's', 'f', 'j',
+	'f', 'k', 'f', 'l', 'i', 'c', 'k', 'r', 'f', 'l', 'i', 'g', 'h', 't', 's', 'f',
+	'l', 'i', 'r', 'f', 'l', 'o', 'r', 'i', 's', 't', 'f', 'l', 'o', 'w', 'e', 'r',
+	's', 'f', 'l', 'y', 'f', 'm', 'f', 'o', 'o', 'd', 'f', 'o', 'o', 'd', 'n', 'e',
+	't', 'w', 'o', 'r', 'k', 'f', 'o', 'o', 't', 'b', 'a', 'l', 'l', 'f', 'o', 'r',
+	'd', 'f', 'o', 'r', 'e', 'x', 'f', 'o', 'r', 's', 'a', 'l', 'e', 'f', 'o', 'r',
+	'u', 'm', 'f', 'o', 'u', 'n', 'd', 'a', 't', 'i', 'o', 'n', 'f', 'o', 'x', 'f',
+	'r', 'e', 'e', 'f', 'r', 'e', 's', 'e', 'n', 'i', 'u', 's', 'f', 'r', 'l', 'f',
+	'r', 'o', 'g', 'a', 'n', 's', 'f', 'r', 'o', 'n', 't', 'd', 'o', 'o', 'r', 'f',
+	'r', 'o', 'n', 't', 'i', 'e', 'r', 'f', 't', 'r', 'f', 'u', 'j', 'i', 't', 's',
+	'u', 'f', 'u', 'n', 'f', 'u', 'n', 'd', 'f', 'u', 'r', 'n', 'i', 't', 'u', 'r',
+	'e', 'f', 'u', 't', 'b', 'o', 'l', 'f', 'y', 'i', 'g', 'a', 'l', 'g', 'a', 'l',
+	'l', 'e', 'r', 'y', 'g', 'a', 'l', 'l', 'o', 'g', 'a', 'l', 'l', 'u', 'p', 'g',
+	'a', 'm', 'e', 'g', 'a', 'm', 'e', 's', 'g', 'a', 'p', 'g', 'a', 'r', 'd', 'e',
+	'n', 'g', 'a', 'y', 'g', 'b', 'i', 'z', 'g', 'd', 'n', 'g', 'e', 'a', 'g', 'e',
+	'n', 't', 'i', 'n', 'g', 'g', 'e', 'o', 'r', 'g', 'e', 'g', 'g', 'e', 'e', 'g',
+	'i', 'f', 't', 'g', 'i', 'f', 't', 's', 'g', 'i', 'v', 'e', 's', 'g', 'i', 'v',
+	'i', 'n', 'g', 'g', 'l', 'g', 'l', 'a', 's', 's', 'g', 'l', 'e', 'g', 'l', 'o',
+	'b', 'a', 'l', 'g', 'l', 'o', 'b', 'o', 'g', 'm', 'g', 'm', 'a', 'i', 'l', 'g',
+	'm', 'b', 'h', 'g', 'm', 'o', 'g', 'm', 'x', 'g', 'o', 'd', 'a', 'd', 'd', 'y',
+	'g', 'o', 'l', 'd', 'g', 'o', 'l', 'd', 'p', 'o', 'i', 'n', 't', 'g', 'o', 'l',
+	'f', 'g', 'o', 'o', 'g', 'o', 'o', 'd', 'y', 'e', 'a', 'r', 'g', 'o', 'o', 'g',
+	'l', 'e', 'g', 'o', 'p', 'g', 'o', 't', 'g', 'o', 'v', 'g', 'p', 'g', 'q', 'g',
+	'r', 'a', 'i', 'n', 'g', 'e', 'r', 'g', 'r', 'a', 'p', 'h', 'i', 'c', 's', 'g',
+	'r', 'a', 't', 'i', 's', 'g', 'r', 'e', 'e', 'n', 'g', 'r', 'i', 'p', 'e', 'g',
+	'r', 'o', 'c', 'e', 'r', 'y', 'g', 'r', 'o', 'u', 'p', 'g', 's', 'g', 't', 'g',
+	'u', 'g', 'u', 'a', 'r', 'd', 'i', 'a', 'n', 'g', 'u', 'c', 'c', 'i', 'g', 'u',
+	'g', 'e', 'g', 'u', 'i', 'd', 'e', 'g', 'u', 'i', 't', 'a', 'r', 's', 'g', 'u',
+	'r', 'u', 'g', 'w', 'h', 'a', 'i', 'r', 'h', 'a', 'm', 'b', 'u', 'r', 'g', 'h',
+	'a', 'n', 'g', 'o', 'u', 't', 'h', 'd', 'f', 'c', 'h', 'd', 'f', 'c', 'b', 'a',
+	'n', 'k', 'h', 'e', 'a', 'l', 't', 'h', 'h', 'e', 'a', 'l', 't', 'h', 'c', 'a',
+	'r', 'e', 'h', 'e', 'l', 'p', 'h', 'e', 'l', 's', 'i', 'n', 'k', 'i', 'h', 'e',
+	'r', 'e', 'h', 'e', 'r', 'm', 'e', 's', 'h', 'g', 't', 'v', 'h', 'i', 'p', 'h',
+	'o', 'p', 'h', 'i', 's', 'a', 'm', 'i', 't', 's', 'u', 'h', 'i', 't', 'a', 'c',
+	'h', 'i', 'h', 'i', 'v', 'h', 'k', 'h', 'k', 't', 'h', 'm', 'h', 'n', 'h', 'o',
+	'c', 'k', 'e', 'y', 'h', 'o', 'l', 'd', 'i', 'n', 'g', 's', 'h', 'o', 'l', 'i',
+	'd', 'a', 'y', 'h', 'o', 'm', 'e', 'd', 'e', 'p', 'o', 't', 'h', 'o', 'm', 'e',
+	'g', 'o', 'o', 'd', 's', 'h', 'o', 'm', 'e', 's', 'h', 'o', 'm', 'e', 's', 'e',
+	'n', 's', 'e', 'h', 'o', 'n', 'd', 'a', 'h', 'o', 'r', 's', 'e', 'h', 'o', 's',
+	'p', 'i', 't', 'a', 'l', 'h', 'o', 's', 't', 'h', 'o', 's', 't', 'i', 'n', 'g',
+	'h', 'o', 't', 'h', 'o', 't', 'e', 'l', 'e', 's', 'h', 'o', 't', 'e', 'l', 's',
+	'h', 'o', 't', 'm', 'a', 'i', 'l', 'h', 'o', 'u', 's', 'e', 'h', 'o', 'w', 'h',
+	's', 'b', 'c', 'h', 'u', 'g', 'h', 'e', 's', 'h', 'y', 'a', 't', 't', 'h', 'y',
+	'u', 'n', 'd', 'a', 'i', 'i', 'b', 'm', 'i', 'c', 'b', 'c', 'i', 'c', 'e', 'i',
+	'c', 'u', 'i', 'e', 'e', 'e', 'i', 'f', 'm', 'i', 'k', 'a', 'n', 'o', 'i', 'm',
+	'a', 'm', 'a', 't', 'i', 'm', 'd', 'b', 'i', 'm', 'm', 'o', 'i', 'm', 'm', 'o',
+	'b', 'i', 'l', 'i', 'e', 'n', 'i', 'n', 'd', 'u', 's', 't', 'r', 'i', 'e', 's',
+	'i', 'n', 'f', 'i', 'n', 'i', 't', 'i', 'i', 'n', 'f', 'o', 'i', 'n', 's', 't',
+	'i', 't', 'u', 't', 'e', 'i', 'n', 's', 'u', 'r', 'a', 'n', 'c', 'e', 'i', 'n',
+	's', 'u', 'r', 'e', 'i', 'n', 't', 'e', 'r', 'n', 'a', 't', 'i', 'o', 'n', 'a',
+	'l', 'i', 'n', 't', 'u', 'i', 't', 'i', 'n', 'v', 'e', 's', 't', 'm', 'e', 'n',
+	't', 's', 'i', 'p', 'i', 'r', 'a', 'n', 'g', 'a', 'i', 'r', 'i', 's', 'h', 'i',
+	's', 'm', 'a', 'i', 'l', 'i', 'i', 's', 't', 'a', 'n', 'b', 'u', 'l', 'i', 't',
+	'a', 'u', 'i', 't', 'v', 'j', 'a', 'g', 'u', 'a', 'r', 'j', 'a', 'v', 'a', 'j',
+	'c', 'b', 'j', 'e', 'j', 'e', 'e', 'p', 'j', 'e', 't', 'z', 't', 'j', 'e', 'w',
+	'e', 'l', 'r', 'y', 'j', 'i', 'o', 'j', 'l', 'l', 'j', 'm', 'j', 'm', 'p', 'j',
+	'n', 'j', 'j', 'o', 'j', 'o', 'b', 's', 'j', 'o', 'b', 'u', 'r', 'g', 'j', 'o',
+	't', 'j', 'o', 'y', 'j', 'p', 'j', 'p', 'm', 'o', 'r', 'g', 'a', 'n', 'j', 'p',
+	'r', 's', 'j', 'u', 'e', 'g', 'o', 's', 'j', 'u', 'n', 'i', 'p', 'e', 'r', 'k',
+	'a', 'u', 'f', 'e', 'n', 'k', 'd', 'd', 'i', 'k', 'e', 'r', 'r', 'y', 'h', 'o',
+	't', 'e', 'l', 's', 'k', 'e', 'r', 'r', 'y', 'l', 'o', 'g', 'i', 's', 't', 'i',
+	'c', 's', 'k', 'e', 'r', 'r', 'y', 'p', 'r', 'o', 'p', 'e', 'r', 't', 'i', 'e',
+	's', 'k', 'f', 'h', 'k', 'g', 'k', 'i', 'a', 'k', 'i', 'd', 's', 'k', 'i', 'm',
+	'k', 'i', 'n', 'd', 'e', 'r', 'k', 'i', 'n', 'd', 'l', 'e', 'k', 'i', 't', 'c',
+	'h', 'e', 'n', 'k', 'i', 'w', 'i', 'k', 'm', 'k', 'n', 'k', 'o', 'e', 'l', 'n',
+	'k', 'o', 'm', 'a', 't', 's', 'u', 'k', 'o', 's', 'h', 'e', 'r', 'k', 'p', 'k',
+	'p', 'm', 'g', 'k', 'p', 'n', 'k', 'r', 'd', 'k', 'r', 'e', 'd', 'k', 'u', 'o',
+	'k', 'g', 'r', 'o', 'u', 'p', 'k', 'w', 'k', 'y', 'k', 'y', 'o', 't', 'o', 'k',
+	'z', 'l', 'a', 'c', 'a', 'i', 'x', 'a', 'l', 'a', 'm', 'b', 'o', 'r', 'g', 'h',
+	'i', 'n', 'i', 'l', 'a', 'm', 'e', 'r', 'l', 'a', 'n', 'c', 'a', 's', 't', 'e',
+	'r', 'l', 'a', 'n', 'c', 'i', 'a', 'l', 'a', 'n', 'd', 'l', 'a', 'n', 'd', 'r',
+	'o', 'v', 'e', 'r', 'l', 'a', 'n', 'x', 'e', 's', 's', 'l', 'a', 's', 'a', 'l',
+	'l', 'e', 'l', 'a', 't', 'i', 'n', 'o', 'l', 'a', 't', 'r', 'o', 'b', 'e', 'l',
+	'a', 'w', 'l', 'a', 'w', 'y', 'e', 'r', 'l', 'd', 's', 'l', 'e', 'a', 's', 'e',
+	'l', 'e', 'c', 'l', 'e', 'r', 'c', 'l', 'e', 'f', 'r', 'a', 'k', 'l', 'e', 'g',
+	'a', 'l', 'l', 'e', 'x', 'u', 's', 'l', 'g', 'b', 't', 'l', 'i', 'd', 'l', 'l',
+	'i', 'f', 'e', 'l', 'i', 'f', 'e', 'i', 'n', 's', 'u', 'r', 'a', 'n', 'c', 'e',
+	'l', 'i', 'f', 'e', 's', 't', 'y', 'l', 'e', 'l', 'i', 'g', 'h', 't', 'i', 'n',
+	'g', 'l', 'i', 'k', 'e', 'l', 'i', 'l', 'l', 'y', 'l', 'i', 'm', 'i', 't', 'e',
+	'd', 'l', 'i', 'm', 'o', 'l', 'i', 'n', 'c', 'o', 'l', 'n', 'l', 'i', 'n', 'd',
+	'e', 'l', 'i', 'n', 'k', 'l', 'i', 'p', 's', 'y', 'l', 'i', 'v', 'i', 'n', 'g',
+	'l', 'l', 'p', 'l', 'o', 'a', 'n', 'l', 'o', 'a', 'n', 's', 'l', 'o', 'c', 'k',
+	'e', 'r', 'l', 'o', 'c', 'u', 's', 'l', 'o', 'l', 'l', 'o', 'n', 'd', 'o', 'n',
+	'l', 'o', 't', 't', 'e', 'l', 'o', 't', 't', 'o', 'l', 'o', 'v', 'e', 'l', 'p',
+	'l', 'f', 'i', 'n', 'a', 'n', 'c', 'i', 'a', 'l', 'l', 't', 'd', 'l', 't', 'd',
+	'a', 'l', 'u', 'n', 'd', 'b', 'e', 'c', 'k', 'l', 'u', 'x', 'e', 'l', 'u', 'x',
+	'u', 'r', 'y', 'm', 'a', 'c', 'y', 's', 'm', 'a', 'd', 'r', 'i', 'd', 'm', 'a',
+	'i', 'f', 'm', 'a', 'i', 's', 'o', 'n', 'm', 'a', 'k', 'e', 'u', 'p', 'm', 'a',
+	'n', 'a', 'g', 'e', 'm', 'e', 'n', 't', 'm', 'a', 'n', 'g', 'o', 'm', 'a', 'p',
+	'm', 'a', 'r', 'k', 'e', 't', 'm', 'a', 'r', 'k', 'e', 't', 'i', 'n', 'g', 'm',
+	'a', 'r', 'k', 'e', 't', 's', 'm', 'a', 'r', 'r', 'i', 'o', 't', 't', 'm', 'a',
+	'r', 's', 'h', 'a', 'l', 'l', 's', 'm', 'a', 's', 'e', 'r', 'a', 't', 'i', 'm',
+	'a', 't', 't', 'e', 'l', 'm', 'c', 'k', 'i', 'n', 's', 'e', 'y', 'm', 'e', 'd',
+	'i', 'a', 'm', 'e', 'e', 't', 'm', 'e', 'l', 'b', 'o', 'u', 'r', 'n', 'e', 'm',
+	'e', 'm', 'e', 'm', 'e', 'm', 'o', 'r', 'i', 'a', 'l', 'm', 'e', 'n', 'u', 'm',
+	'e', 'r', 'c', 'k', 'm', 's', 'd', 'm', 'i', 'a', 'm', 'i', 'm', 'i', 'c', 'r',
+	'o', 's', 'o', 'f', 't', 'm', 'i', 'n', 'i', 'm', 'i', 'n', 't', 'm', 'i', 't',
+	's', 'u', 'b', 'i', 's', 'h', 'i', 'm', 'l', 'm', 'l', 'b', 'm', 'l', 's', 'm',
+	'm', 'a', 'm', 'n', 'm', 'o', 'b', 'i', 'l', 'e', 'm', 'o', 'd', 'a', 'm', 'o',
+	'e', 'm', 'o', 'm', 'm', 'o', 'n', 'a', 's', 'h', 'm', 'o', 'n', 'e', 'y', 'm',
+	'o', 'n', 's', 't', 'e', 'r', 'm', 'o', 'r', 'm', 'o', 'n', 'm', 'o', 'r', 't',
+	'g', 'a', 'g', 'e', 'm', 'o', 's', 'c', 'o', 'w', 'm', 'o', 't', 'o', 'm', 'o',
+	't', 'o', 'r', 'c', 'y', 'c', 'l', 'e', 's', 'm', 'o', 'v', 'm', 'o', 'v', 'i',
+	'e', 'm', 'q', 'm', 't', 'm', 't', 'n', 'm', 't', 'r', 'm', 'u', 's', 'e', 'u',
+	'm', 'm', 'u', 's', 'i', 'c', 'm', 'u', 't', 'u', 'a', 'l', 'm', 'v', 'm', 'z',
+	'n', 'a', 'g', 'o', 'y', 'a', 'n', 'a', 't', 'u', 'r', 'a', 'n', 'a', 'v', 'y',
+	'n', 'b', 'a', 'n', 'e', 't', 'b', 'a', 'n', 'k', 'n', 'e', 't', 'f', 'l', 'i',
+	'x', 'n', 'e', 'u', 's', 't', 'a', 'r', 'n', 'e', 'w', 'n', 'e', 'w', 's', 'n',
+	'e', 'x', 't', 'n', 'e', 'x', 't', 'd', 'i', 'r', 'e', 'c', 't', 'n', 'e', 'x',
+	'u', 's', 'n', 'f', 'l', 'n', 'h', 'k', 'n', 'i', 'c', 'o', 'n', 'i', 'k', 'e',
+	'n', 'i', 'k', 'o', 'n', 'n', 'i', 'n', 'j', 'a', 'n', 'i', 's', 's', 'a', 'n',
+	'n', 'i', 's', 's', 'a', 'y', 'n', 'o', 'k', 'i', 'a', 'n', 'o', 'r', 't', 'h',
+	'w', 'e', 's', 't', 'e', 'r', 'n', 'm', 'u', 't', 'u', 'a', 'l', 'n', 'o', 'r',
+	't', 'o', 'n', 'n', 'o', 'w', 'n', 'o', 'w', 'r', 'u', 'z', 'n', 'o', 'w', 't',
+	'v', 'n', 'r', 'n', 'r', 'a', 'n', 'r', 'w', 'n', 't', 't', 'o', 'b', 's', 'e',
+	'r', 'v', 'e', 'r', 'o', 'f', 'f', 'i', 'c', 'e', 'o', 'k', 'i', 'n', 'a', 'w',
+	'a', 'o', 'l', 'a', 'y', 'a', 'n', 'o', 'l', 'a', 'y', 'a', 'n', 'g', 'r', 'o',
+	'u', 'p', 'o', 'l', 'd', 'n', 'a', 'v', 'y', 'o', 'm', 'e', 'g', 'a', 'o', 'n',
+	'g', 'o', 'n', 'i', 'o', 'n', 'o', 'n', 'l', 'i', 'n', 'e', 'o', 'o', 'o', 'o',
+	'p', 'e', 'n', 'o', 'r', 'a', 'c', 'l', 'e', 'o', 'r', 'a', 'n', 'g', 'e', 'o',
+	'r', 'g', 'a', 'n', 'i', 'c', 'o', 'r', 'i', 'g', 'i', 'n', 's', 'o', 's', 'a',
+	'k', 'a', 'o', 't', 's', 'u', 'k', 'a', 'o', 'v', 'h', 'p', 'a', 'g', 'e', 'p',
+	'a', 'n', 'a', 's', 'o', 'n', 'i', 'c', 'p', 'a', 'r', 'i', 's', 'p', 'a', 'r',
+	's', 'p', 'a', 'r', 't', 'n', 'e', 'r', 's', 'p', 'a', 'r', 't', 's', 'p', 'a',
+	'r', 't', 'y', 'p', 'a', 's', 's', 'a', 'g', 'e', 'n', 's', 'p', 'c', 'c', 'w',
+	'p', 'f', 'p', 'f', 'i', 'z', 'e', 'r', 'p', 'h', 'a', 'r', 'm', 'a', 'c', 'y',
+	'p', 'h', 'd', 'p', 'h', 'i', 'l', 'i', 'p', 's', 'p', 'h', 'o', 'n', 'e', 'p',
+	'h', 'o', 't', 'o', 'p', 'h', 'o', 't', 'o', 'g', 'r', 'a', 'p', 'h', 'y', 'p',
+	'h', 'o', 't', 'o', 's', 'p', 'h', 'y', 's', 'i', 'o', 'p', 'i', 'c', 's', 'p',
+	'i', 'c', 't', 'e', 't', 'p', 'i', 'c', 't', 'u', 'r', 'e', 's', 'p', 'i', 'd',
+	'p', 'i', 'n', 'p', 'i', 'n', 'g', 'p', 'i', 'n', 'k', 'p', 'i', 'o', 'n', 'e',
+	'e', 'r', 'p', 'i', 'z', 'z', 'a', 'p', 'l', 'a', 'c', 'e', 'p', 'l', 'a', 'y',
+	'p', 'l', 'a', 'y', 's', 't', 'a', 't', 'i', 'o', 'n', 'p', 'l', 'u', 'm', 'b',
+	'i', 'n', 'g', 'p', 'l', 'u', 's', 'p', 'n', 'c', 'p', 'o', 'h', 'l', 'p', 'o',
+	'k', 'e', 'r', 'p', 'o', 'l', 'i', 't', 'i', 'e', 'p', 'o', 'r', 'n', 'p', 'r',
+	'a', 'm', 'e', 'r', 'i', 'c', 'a', 'p', 'r', 'a', 'x', 'i', 'p', 'r', 'i', 'm',
+	'e', 'p', 'r', 'o', 'd', 'p', 'r', 'o', 'd', 'u', 'c', 't', 'i', 'o', 'n', 's',
+	'p', 'r', 'o', 'f', 'p', 'r', 'o', 'g', 'r', 'e', 's', 's', 'i', 'v', 'e', 'p',
+	'r', 'o', 'm', 'o', 'p', 'r', 'o', 'p', 'e', 'r', 't', 'y', 'p', 'r', 'o', 't',
+	'e', 'c', 't', 'i', 'o', 'n', 'p', 'r', 'u', 'p', 'r', 'u', 'd', 'e', 'n', 't',
+	'i', 'a', 'l', 'p', 't', 'p', 'w', 'p', 'w', 'c', 'p', 'y', 'q', 'p', 'o', 'n',
+	'q', 'u', 'e', 'b', 'e', 'c', 'q', 'u', 'e', 's', 't', 'r', 'a', 'c', 'i', 'n',
+	'g', 'r', 'a', 'd', 'i', 'o', 'r', 'e', 'a', 'd', 'r', 'e', 'a', 'l', 'e', 's',
+	't', 'a', 't', 'e', 'r', 'e', 'a', 'l', 't', 'o', 'r', 'r', 'e', 'a', 'l', 't',
+	'y', 'r', 'e', 'c', 'i', 'p', 'e', 's', 'r', 'e', 'd', 's', 't', 'o', 'n', 'e',
+	'r', 'e', 'd', 'u', 'm', 'b', 'r', 'e', 'l', 'l', 'a', 'r', 'e', 'h', 'a', 'b',
+	'r', 'e', 'i', 's', 'e', 'r', 'e', 'i', 's', 'e', 'n', 'r', 'e', 'i', 't', 'r',
+	'e', 'l', 'i', 'a', 'n', 'c', 'e', 'r', 'e', 'n', 't', 'r', 'e', 'n', 't', 'a',
+	'l', 's', 'r', 'e', 'p', 'a', 'i', 'r', 'r', 'e', 'p', 'o', 'r', 't', 'r', 'e',
+	'p', 'u', 'b', 'l', 'i', 'c', 'a', 'n', 'r', 'e', 's', 't', 'a', 'u', 'r', 'a',
+	'n', 't', 'r', 'e', 'v', 'i', 'e', 'w', 'r', 'e', 'v', 'i', 'e', 'w', 's', 'r',
+	'e', 'x', 'r', 'o', 't', 'h', 'r', 'i', 'c', 'h', 'r', 'i', 'c', 'h', 'a', 'r',
+	'd', 'l', 'i', 'r', 'i', 'c', 'o', 'h', 'r', 'i', 'l', 'r', 'o', 'c', 'h', 'e',
+	'r', 'r', 'o', 'c', 'k', 's', 'r', 'o', 'd', 'e', 'o', 'r', 'o', 'g', 'e', 'r',
+	's', 'r', 'o', 'o', 'm', 'r', 's', 'v', 'p', 'r', 'u', 'g', 'b', 'y', 'r', 'u',
+	'h', 'r', 'r', 'u', 'n', 'r', 'w', 'e', 'r', 'y', 'u', 'k', 'y', 'u', 's', 'a',
+	'a', 'r', 'l', 'a', 'n', 'd', 's', 'a', 'f', 'e', 's', 'a', 'f', 'e', 't', 'y',
+	's', 'a', 'k', 'u', 'r', 'a', 's', 'a', 'l', 'o', 'n', 's', 'a', 'm', 's', 'c',
+	'l', 'u', 'b', 's', 'a', 'm', 's', 'u', 'n', 'g', 's', 'a', 'n', 'd', 'v', 'i',
+	'k', 's', 'a', 'n', 'd', 'v', 'i', 'k', 'c', 'o', 'r', 'o', 'm', 'a', 'n', 't',
+	's', 'a', 'n', 'o', 'f', 'i', 's', 'a', 'r', 'l', 's', 'a', 'v', 'e', 's', 'a',
+	'x', 'o', 's', 'b', 'i', 's', 'c', 'b', 's', 'c', 'h', 'a', 'e', 'f', 'f', 'l',
+	'e', 'r', 's', 'c', 'h', 'm', 'i', 'd', 't', 's', 'c', 'h', 'o', 'l', 'a', 'r',
+	's', 'h', 'i', 'p', 's', 's', 'c', 'h', 'o', 'o', 'l', 's', 'c', 'h', 'u', 'l',
+	'e', 's', 'c', 'h', 'w', 'a', 'r', 'z', 's', 'c', 'i', 'e', 'n', 'c', 'e', 's',
+	'c', 'o', 't', 's', 'e', 'a', 'r', 'c', 'h', 's', 'e', 'a', 't', 's', 'e', 'c',
+	'u', 'r', 'e', 's', 'e', 'c', 'u', 'r', 'i', 't', 'y', 's', 'e', 'e', 'k', 's',
+	'e', 'l', 'e', 'c', 't', 's', 'e', 'n', 'e', 'r', 's', 'e', 'r', 'v', 'i', 'c',
+	'e', 's', 's', 'e', 'w', 's', 'e', 'x', 'y', 's', 'h', 'a', 'n', 'g', 'r', 'i',
+	'l', 'a', 's', 'h', 'a', 'r', 'p', 's', 'h', 'a', 'w', 's', 'h', 'e', 'l', 'l',
+	's', 'h', 'i', 'a', 's', 'h', 'i', 'k', 's', 'h', 'a', 's', 'h', 'o', 'e', 's',
+	's', 'h', 'o', 'p', 's', 'h', 'o', 'p', 'p', 'i', 'n', 'g', 's', 'h', 'o', 'u',
+	'j', 'i', 's', 'h', 'o', 'w', 's', 'h', 'o', 'w', 't', 'i', 'm', 'e', 's', 'i',
+	'l', 'k', 's', 'i', 'n', 'a', 's', 'i', 'n', 'g', 'l', 'e', 's', 's', 'i', 't',
+	'e', 's', 'k', 'i', 'n', 's', 'k', 'y', 's', 'k', 'y', 'p', 'e', 's', 'l', 'i',
+	'n', 'g', 's', 'm', 'a', 'r', 't', 's', 'm', 'i', 'l', 'e', 's', 'n', 'c', 'f',
+	's', 'o', 'c', 'c', 'e', 'r', 's', 'o', 'c', 'i', 'a', 'l', 's', 'o', 'f', 't',
+	'b', 'a', 'n', 'k', 's', 'o', 'f', 't', 'w', 'a', 'r', 'e', 's', 'o', 'h', 'u',
+	's', 'o', 'l', 'a', 'r', 's', 'o', 'l', 'u', 't', 'i', 'o', 'n', 's', 's', 'o',
+	'n', 'g', 's', 'o', 'n', 'y', 's', 'o', 'y', 's', 'p', 'o', 'r', 't', 's', 'p',
+	'o', 't', 's', 'r', 'l', 's', 't', 'a', 'd', 'a', 's', 't', 'a', 'p', 'l', 'e',
+	's', 's', 't', 'a', 't', 'e', 'b', 'a', 'n', 'k', 's', 't', 'a', 't', 'e', 'f',
+	'a', 'r', 'm', 's', 't', 'c', 'g', 'r', 'o', 'u', 'p', 's', 't', 'o', 'c', 'k',
+	'h', 'o', 'l', 'm', 's', 't', 'o', 'r', 'a', 'g', 'e', 's', 't', 'o', 'r', 'e',
+	's', 't', 'r', 'e', 'a', 'm', 's', 't', 'u', 'd', 'i', 'o', 's', 't', 'u', 'd',
+	'y', 's', 'u', 'c', 'k', 's', 's', 'u', 'p', 'p', 'l', 'i', 'e', 's', 's', 'u',
+	'p', 'p', 'l', 'y', 's', 'u', 'p', 'p', 'o', 'r', 't', 's', 'u', 'r', 'f', 's',
+	'u', 'r', 'g', 'e', 'r', 'y', 's', 'u', 'z', 'u', 'k', 'i', 's', 'w', 'a', 't',
+	'c', 'h', 's', 'w', 'i', 's', 's', 's', 'x', 's', 'y', 'd', 'n', 'e', 'y', 's',
+	'y', 's', 't', 'e', 'm', 's', 's', 'z', 't', 'a', 'i', 'p', 'e', 'i', 't', 'a',
+	'l', 'k', 't', 'a', 'o', 'b', 'a', 'o', 't', 'a', 'r', 'g', 'e', 't', 't', 'a',
+	't', 'a', 'm', 'o', 't', 'o', 'r', 's', 't', 'a', 't', 'a', 'r', 't', 'a', 't',
+	't', 'o', 'o', 't', 'a', 'x', 't', 'a', 'x', 'i', 't', 'c', 'i', 't', 'd', 'k',
+	't', 'e', 'a', 'm', 't', 'e', 'c', 'h', 't', 'e', 'c', 'h', 'n', 'o', 'l', 'o',
+	'g', 'y', 't', 'e', 'm', 'a', 's', 'e', 'k', 't', 'e', 'n', 'n', 'i', 's', 't',
+	'e', 'v', 'a', 't', 'h', 'e', 'a', 't', 'e', 'r', 't', 'h', 'e', 'a', 't', 'r',
+	'e', 't', 'i', 'a', 'a', 't', 'i', 'c', 'k', 'e', 't', 's', 't', 'i', 'e', 'n',
+	'd', 'a', 't', 'i', 'f', 'f', 'a', 'n', 'y', 't', 'i', 'p', 's', 't', 'i', 'r',
+	'e', 's', 't', 'i', 'r', 'o', 'l', 't', 'j', 'm', 'a', 'x', 'x', 't', 'j', 'x',
+	't', 'k', 't', 'k', 'm', 'a', 'x', 'x', 't', 'm', 'a', 'l', 'l', 't', 'o', 'd',
+	'a', 'y', 't', 'o', 'k', 'y', 'o', 't', 'o', 'o', 'l', 's', 't', 'o', 'r', 'a',
+	'y', 't', 'o', 's', 'h', 'i', 'b', 'a', 't', 'o', 't', 'a', 'l', 't', 'o', 'u',
+	'r', 's', 't', 'o', 'y', 'o', 't', 'a', 't', 'o', 'y', 's', 't', 'r', 'a', 'd',
+	'e', 't', 'r', 'a', 'd', 'i', 'n', 'g', 't', 'r', 'a', 'i', 'n', 'i', 'n', 'g',
+	't', 'r', 'a', 'v', 'e', 'l', 't', 'r', 'a', 'v', 'e', 'l', 'c', 'h', 'a', 'n',
+	'n', 'e', 'l', 't', 'r', 'a', 'v', 'e', 'l', 'e', 'r', 's', 't', 'r', 'a', 'v',
+	'e', 'l', 'e', 'r', 's', 'i', 'n', 's', 'u', 'r', 'a', 'n', 'c', 'e', 't', 'r',
+	'u', 's', 't', 't', 'r', 'v', 't', 'u', 'b', 'e', 't', 'u', 'n', 'e', 's', 't',
+	'u', 's', 'h', 'u', 't', 'v', 's', 'u', 'b', 'a', 'n', 'k', 'u', 'n', 'i', 'c',
+	'o', 'm', 'u', 'n', 'i', 'v', 'e', 'r', 's', 'i', 't', 'y', 'u', 'n', 'o', 'u',
+	'o', 'l', 'v', 'a', 'c', 'a', 't', 'i', 'o', 'n', 's', 'v', 'a', 'n', 'a', 'v',
+	'a', 'n', 'g', 'u', 'a', 'r', 'd', 'v', 'e', 'g', 'a', 's', 'v', 'e', 'n', 't',
+	'u', 'r', 'e', 's', 'v', 'e', 'r', 'i', 's', 'i', 'g', 'n', 'v', 'e', 'r', 's',
+	'i', 'c', 'h', 'e', 'r', 'u', 'n', 'g', 'v', 'e', 't', 'v', 'i', 'a', 'j', 'e',
+	's', 'v', 'i', 'd', 'e', 'o', 'v', 'i', 'g', 'v', 'i', 'k', 'i', 'n', 'g', 'v',
+	'i', 'l', 'l', 'a', 's', 'v', 'i', 'p', 'v', 'i', 'r', 'g', 'i', 'n', 'v', 'i',
+	's', 'a', 'v', 'i', 'v', 'a', 'v', 'i', 'v', 'o', 'v', 'l', 'a', 'a', 'n', 'd',
+	'e', 'r', 'e', 'n', 'v', 'o', 'd', 'k', 'a', 'v', 'o', 'l', 'k', 's', 'w', 'a',
+	'g', 'e', 'n', 'v', 'o', 'l', 'v', 'o', 'v', 'o', 't', 'e', 'v', 'o', 't', 'i',
+	'n', 'g', 'v', 'o', 't', 'o', 'v', 'o', 'y', 'a', 'g', 'e', 'v', 'u', 'v', 'u',
+	'e', 'l', 'o', 's', 'w', 'a', 'l', 'e', 's', 'w', 'a', 'l', 'm', 'a', 'r', 't',
+	'w', 'a', 'l', 't', 'e', 'r', 'w', 'a', 'n', 'g', 'w', 'a', 'n', 'g', 'g', 'o',
+	'u', 'w', 'a', 't', 'c', 'h', 'e', 's', 'w', 'e', 'a', 't', 'h', 'e', 'r', 'w',
+	'e', 'a', 't', 'h', 'e', 'r', 'c', 'h', 'a', 'n', 'n', 'e', 'l', 'w', 'e', 'b',
+	'c', 'a', 'm', 'w', 'e', 'b', 'e', 'r', 'w', 'e', 'b', 's', 'i', 't', 'e', 'w',
+	'e', 'd', 'd', 'i', 'n', 'g', 'w', 'e', 'i', 'b', 'o', 'w', 'e', 'i', 'r', 'w',
+	'f', 'w', 'h', 'o', 's', 'w', 'h', 'o', 'w', 'i', 'e', 'n', 'w', 'i', 'k', 'i',
+	'w', 'i', 'l', 'l', 'i', 'a', 'm', 'h', 'i', 'l', 'l', 'w', 'i', 'n', 'd', 'o',
+	'w', 's', 'w', 'i', 'n', 'e', 'w', 'i', 'n', 'n', 'e', 'r', 's', 'w', 'm', 'e',
+	'w', 'o', 'l', 't', 'e', 'r', 's', 'k', 'l', 'u', 'w', 'e', 'r', 'w', 'o', 'o',
+	'd', 's', 'i', 'd', 'e', 'w', 'o', 'r', 'k', 's', 'w', 'o', 'r', 'l', 'd', 'w',
+	'o', 'w', 'w', 't', 'c', 'w', 't', 'f', 'x', 'b', 'o', 'x', 'x', 'e', 'r', 'o',
+	'x', 'x', 'f', 'i', 'n', 'i', 't', 'y', 'x', 'i', 'h', 'u', 'a', 'n', 'x', 'i',
+	'n', 'x', 'n', '-', '-', '1', '1', 'b', '4', 'c', '3', 'd', 'x', 'n', '-', '-',
+	'1', 'c', 'k', '2', 'e', '1', 'b', 'x', 'n', '-', '-', '1', 'q', 'q', 'w', '2',
+	'3', 'a', 'x', 'n', '-', '-', '2', 's', 'c', 'r', 'j', '9', 'c', 'x', 'n', '-',
+	'-', '3', '0', 'r', 'r', '7', 'y', 'x', 'n', '-', '-', '3', 'b', 's', 't', '0',
+	'0', 'm', 'x', 'n', '-', '-', '3', 'd', 's', '4', '4', '3', 'g', 'x', 'n', '-',
+	'-', '3', 'e', '0', 'b', '7', '0', '7', 'e', 'x', 'n', '-', '-', '3', 'h', 'c',
+	'r', 'j', '9', 'c', 'x', 'n', '-', '-', '3', 'p', 'x', 'u', '8', 'k', 'x', 'n',
+	'-', '-', '4', '2', 'c', '2', 'd', '9', 'a', 'x', 'n', '-', '-', '4', '5', 'b',
+	'r', '5', 'c', 'y', 'l', 'x', 'n', '-', '-', '4', '5', 'b', 'r', 'j', '9', 'c',
+	'x', 'n', '-', '-', '4', '5', 'q', '1', '1', 'c', 'x', 'n', '-', '-', '4', 'd',
+	'b', 'r', 'k', '0', 'c', 'e', 'x', 'n', '-', '-', '4', 'g', 'b', 'r', 'i', 'm',
+	'x', 'n', '-', '-', '5', '4', 'b', '7', 'f', 't', 'a', '0', 'c', 'c', 'x', 'n',
+	'-', '-', '5', '5', 'q', 'w', '4', '2', 'g', 'x', 'n', '-', '-', '5', '5', 'q',
+	'x', '5', 'd', 'x', 'n', '-', '-', '5', 's', 'u', '3', '4', 'j', '9', '3', '6',
+	'b', 'g', 's', 'g', 'x', 'n', '-', '-', '5', 't', 'z', 'm', '5', 'g', 'x', 'n',
+	'-', '-', '6', 'f', 'r', 'z', '8', '2', 'g', 'x', 'n', '-', '-', '6', 'q', 'q',
+	'9', '8', '6', 'b', '3', 'x', 'l', 'x', 'n', '-', '-', '8', '0', 'a', 'd', 'x',
+	'h', 'k', 's', 'x', 'n', '-', '-', '8', '0', 'a', 'o', '2', '1', 'a', 'x', 'n',
+	'-', '-', '8', '0', 'a', 'q', 'e', 'c', 'd', 'r', '1', 'a', 'x', 'n', '-', '-',
+	'8', '0', 'a', 's', 'e', 'h', 'd', 'b', 'x', 'n', '-', '-', '8', '0', 'a', 's',
+	'w', 'g', 'x', 'n', '-', '-', '8', 'y', '0', 'a', '0', '6', '3', 'a', 'x', 'n',
+	'-', '-', '9', '0', 'a', '3', 'a', 'c', 'x', 'n', '-', '-', '9', '0', 'a', 'e',
+	'x', 'n', '-', '-', '9', '0', 'a', 'i', 's', 'x', 'n', '-', '-', '9', 'd', 'b',
+	'q', '2', 'a', 'x', 'n', '-', '-', '9', 'e', 't', '5', '2', 'u', 'x', 'n', '-',
+	'-', '9', 'k', 'r', 't', '0', '0', 'a', 'x', 'n', '-', '-', 'b', '4', 'w', '6',
+	'0', '5', 'f', 'e', 'r', 'd', 'x', 'n', '-', '-', 'b', 'c', 'k', '1', 'b', '9',
+	'a', '5', 'd', 'r', 'e', '4', 'c', 'x', 'n', '-', '-', 'c', '1', 'a', 'v', 'g',
+	'x', 'n', '-', '-', 'c', '2', 'b', 'r', '7', 'g', 'x', 'n', '-', '-', 'c', 'c',
+	'k', '2', 'b', '3', 'b', 'x', 'n', '-', '-', 'c', 'c', 'k', 'w', 'c', 'x', 'e',
+	't', 'd', 'x', 'n', '-', '-', 'c', 'g', '4', 'b', 'k', 'i', 'x', 'n', '-', '-',
+	'c', 'l', 'c', 'h', 'c', '0', 'e', 'a', '0', 'b', '2', 'g', '2', 'a', '9', 'g',
+	'c', 'd', 'x', 'n', '-', '-', 'c', 'z', 'r', '6', '9', '4', 'b', 'x', 'n', '-',
+	'-', 'c', 'z', 'r', 's', '0', 't', 'x', 'n', '-', '-', 'c', 'z', 'r', 'u', '2',
+	'd', 'x', 'n', '-', '-', 'd', '1', 'a', 'c', 'j', '3', 'b', 'x', 'n', '-', '-',
+	'd', '1', 'a', 'l', 'f', 'x', 'n', '-', '-', 'e', '1', 'a', '4', 'c', 'x', 'n',
+	'-', '-', 'e', 'c', 'k', 'v', 'd', 't', 'c', '9', 'd', 'x', 'n', '-', '-', 'e',
+	'f', 'v', 'y', '8', '8', 'h', 'x', 'n', '-', '-', 'f', 'c', 't', '4', '2', '9',
+	'k', 'x', 'n', '-', '-', 'f', 'h', 'b', 'e', 'i', 'x', 'n', '-', '-', 'f', 'i',
+	'q', '2', '2', '8', 'c', '5', 'h', 's', 'x', 'n', '-', '-', 'f', 'i', 'q', '6',
+	'4', 'b', 'x', 'n', '-', '-', 'f', 'i', 'q', 's', '8', 's', 'x', 'n', '-', '-',
+	'f', 'i', 'q', 'z', '9', 's', 'x', 'n', '-', '-', 'f', 'j', 'q', '7', '2', '0',
+	'a', 'x', 'n', '-', '-', 'f', 'l', 'w', '3', '5', '1', 'e', 'x', 'n', '-', '-',
+	'f', 'p', 'c', 'r', 'j', '9', 'c', '3', 'd', 'x', 'n', '-', '-', 'f', 'z', 'c',
+	'2', 'c', '9', 'e', '2', 'c', 'x', 'n', '-', '-', 'f', 'z', 'y', 's', '8', 'd',
+	'6', '9', 'u', 'v', 'g', 'm', 'x', 'n', '-', '-', 'g', '2', 'x', 'x', '4', '8',
+	'c', 'x', 'n', '-', '-', 'g', 'c', 'k', 'r', '3', 'f', '0', 'f', 'x', 'n', '-',
+	'-', 'g', 'e', 'c', 'r', 'j', '9', 'c', 'x', 'n', '-', '-', 'g', 'k', '3', 'a',
+	't', '1', 'e', 'x', 'n', '-', '-', 'h', '2', 'b', 'r', 'e', 'g', '3', 'e', 'v',
+	'e', 'x', 'n', '-', '-', 'h', '2', 'b', 'r', 'j', '9', 'c', 'x', 'n', '-', '-',
+	'h', '2', 'b', 'r', 'j', '9', 'c', '8', 'c', 'x', 'n', '-', '-', 'h', 'x', 't',
+	'8', '1', '4', 'e', 'x', 'n', '-', '-', 'i', '1', 'b', '6', 'b', '1', 'a', '6',
+	'a', '2', 'e', 'x', 'n', '-', '-', 'i', 'm', 'r', '5', '1', '3', 'n', 'x', 'n',
+	'-', '-', 'i', 'o', '0', 'a', '7', 'i', 'x', 'n', '-', '-', 'j', '1', 'a', 'e',
+	'f', 'x', 'n', '-', '-', 'j', '1', 'a', 'm', 'h', 'x', 'n', '-', '-', 'j', '6',
+	'w', '1', '9', '3', 'g', 'x', 'n', '-', '-', 'j', 'l', 'q', '4', '8', '0', 'n',
+	'2', 'r', 'g', 'x', 'n', '-', '-', 'j', 'v', 'r', '1', '8', '9', 'm', 'x', 'n',
+	'-', '-', 'k', 'c', 'r', 'x', '7', '7', 'd', '1', 'x', '4', 'a', 'x', 'n', '-',
+	'-', 'k', 'p', 'r', 'w', '1', '3', 'd', 'x', 'n', '-', '-', 'k', 'p', 'r', 'y',
+	'5', '7', 'd', 'x', 'n', '-', '-', 'k', 'p', 'u', 't', '3', 'i', 'x', 'n', '-',
+	'-', 'l', '1', 'a', 'c', 'c', 'x', 'n', '-', '-', 'l', 'g', 'b', 'b', 'a', 't',
+	'1', 'a', 'd', '8', 'j', 'x', 'n', '-', '-', 'm', 'g', 'b', '2', 'd', 'd', 'e',
+	's', 'x', 'n', '-', '-', 'm', 'g', 'b', '9', 'a', 'w', 'b', 'f', 'x', 'n', '-',
+	'-', 'm', 'g', 'b', 'a', '3', 'a', '3', 'e', 'j', 't', 'x', 'n', '-', '-', 'm',
+	'g', 'b', 'a', '3', 'a', '4', 'f', '1', '6', 'a', 'x', 'n', '-', '-', 'm', 'g',
+	'b', 'a', '3', 'a', '4', 'f', 'r', 'a', 'x', 'n', '-', '-', 'm', 'g', 'b', 'a',
+	'7', 'c', '0', 'b', 'b', 'n', '0', 'a', 'x', 'n', '-', '-', 'm', 'g', 'b', 'a',
+	'a', 'k', 'c', '7', 'd', 'v', 'f', 'x', 'n', '-', '-', 'm', 'g', 'b', 'a', 'a',
+	'm', '7', 'a', '8', 'h', 'x', 'n', '-', '-', 'm', 'g', 'b', 'a', 'b', '2', 'b',
+	'd', 'x', 'n', '-', '-', 'm', 'g', 'b', 'a', 'h', '1', 'a', '3', 'h', 'j', 'k',
+	'r', 'd', 'x', 'n', '-', '-', 'm', 'g', 'b', 'a', 'i', '9', 'a', '5', 'e', 'v',
+	'a', '0', '0', 'b', 'x', 'n', '-', '-', 'm', 'g', 'b', 'a', 'i', '9', 'a', 'z',
+	'g', 'q', 'p', '6', 'j', 'x', 'n', '-', '-', 'm', 'g', 'b', 'a', 'y', 'h', '7',
+	'g', 'p', 'a', 'x', 'n', '-', '-', 'm', 'g', 'b', 'b', 'h', '1', 'a', 'x', 'n',
+	'-', '-', 'm', 'g', 'b', 'b', 'h', '1', 'a', '7', '1', 'e', 'x', 'n', '-', '-',
+	'm', 'g', 'b', 'c', '0', 'a', '9', 'a', 'z', 'c', 'g', 'x', 'n', '-', '-', 'm',
+	'g', 'b', 'c', 'a', '7', 'd', 'z', 'd', 'o', 'x', 'n', '-', '-', 'm', 'g', 'b',
+	'c', 'p', 'q', '6', 'g', 'p', 'a', '1', 'a', 'x', 'n', '-', '-', 'm', 'g', 'b',
+	'e', 'r', 'p', '4', 'a', '5', 'd', '4', 'a', '8', '7', 'g', 'x', 'n', '-', '-',
+	'm', 'g', 'b', 'e', 'r', 'p', '4', 'a', '5', 'd', '4', 'a', 'r', 'x', 'n', '-',
+	'-', 'm', 'g', 'b', 'g', 'u', '8', '2', 'a', 'x', 'n', '-', '-', 'm', 'g', 'b',
+	'i', '4', 'e', 'c', 'e', 'x', 'p', 'x', 'n', '-', '-', 'm', 'g', 'b', 'p', 'l',
+	'2', 'f', 'h', 'x', 'n', '-', '-', 'm', 'g', 'b', 'q', 'l', 'y', '7', 'c', '0',
+	'a', '6', '7', 'f', 'b', 'c', 'x', 'n', '-', '-', 'm', 'g', 'b', 'q', 'l', 'y',
+	'7', 'c', 'v', 'a', 'f', 'r', 'x', 'n', '-', '-', 'm', 'g', 'b', 't', '3', 'd',
+	'h', 'd', 'x', 'n', '-', '-', 'm', 'g', 'b', 't', 'f', '8', 'f', 'l', 'x', 'n',
+	'-', '-', 'm', 'g', 'b', 't', 'x', '2', 'b', 'x', 'n', '-', '-', 'm', 'g', 'b',
+	'x', '4', 'c', 'd', '0', 'a', 'b', 'x', 'n', '-', '-', 'm', 'i', 'x', '0', '8',
+	'2', 'f', 'x', 'n', '-', '-', 'm', 'i', 'x', '8', '9', '1', 'f', 'x', 'n', '-',
+	'-', 'm', 'k', '1', 'b', 'u', '4', '4', 'c', 'x', 'n', '-', '-', 'm', 'x', 't',
+	'q', '1', 'm', 'x', 'n', '-', '-', 'n', 'g', 'b', 'c', '5', 'a', 'z', 'd', 'x',
+	'n', '-', '-', 'n', 'g', 'b', 'e', '9', 'e', '0', 'a', 'x', 'n', '-', '-', 'n',
+	'g', 'b', 'r', 'x', 'x', 'n', '-', '-', 'n', 'n', 'x', '3', '8', '8', 'a', 'x',
+	'n', '-', '-', 'n', 'o', 'd', 'e', 'x', 'n', '-', '-', 'n', 'q', 'v', '7', 'f',
+	'x', 'n', '-', '-', 'n', 'q', 'v', '7', 'f', 's', '0', '0', 'e', 'm', 'a', 'x',
+	'n', '-', '-', 'n', 'y', 'q', 'y', '2', '6', 'a', 'x', 'n', '-', '-', 'o', '3',
+	'c', 'w', '4', 'h', 'x', 'n', '-', '-', 'o', 'g', 'b', 'p', 'f', '8', 'f', 'l',
+	'x', 'n', '-', '-', 'o', 't', 'u', '7', '9', '6', 'd', 'x', 'n', '-', '-', 'p',
+	'1', 'a', 'c', 'f', 'x', 'n', '-', '-', 'p', '1', 'a', 'i', 'x', 'n', '-', '-',
+	'p', 'g', 'b', 's', '0', 'd', 'h', 'x', 'n', '-', '-', 'p', 's', 's', 'y', '2',
+	'u', 'x', 'n', '-', '-', 'q', '7', 'c', 'e', '6', 'a', 'x', 'n', '-', '-', 'q',
+	'9', 'j', 'y', 'b', '4', 'c', 'x', 'n', '-', '-', 'q', 'c', 'k', 'a', '1', 'p',
+	'm', 'c', 'x', 'n', '-', '-', 'q', 'x', 'a', '6', 'a', 'x', 'n', '-', '-', 'q',
+	'x', 'a', 'm', 'x', 'n', '-', '-', 'r', 'h', 'q', 'v', '9', '6', 'g', 'x', 'n',
+	'-', '-', 'r', 'o', 'v', 'u', '8', '8', 'b', 'x', 'n', '-', '-', 'r', 'v', 'c',
+	'1', 'e', '0', 'a', 'm', '3', 'e', 'x', 'n', '-', '-', 's', '9', 'b', 'r', 'j',
+	'9', 'c', 'x', 'n', '-', '-', 's', 'e', 's', '5', '5', '4', 'g', 'x', 'n', '-',
+	'-', 't', '6', '0', 'b', '5', '6', 'a', 'x', 'n', '-', '-', 't', 'c', 'k', 'w',
+	'e', 'x', 'n', '-', '-', 't', 'i', 'q', '4', '9', 'x', 'q', 'y', 'j', 'x', 'n',
+	'-', '-', 'u', 'n', 'u', 'p', '4', 'y', 'x', 'n', '-', '-', 'v', 'e', 'r', 'm',
+	'g', 'e', 'n', 's', 'b', 'e', 'r', 'a', 't', 'e', 'r', '-', 'c', 't', 'b', 'x',
+	'n', '-', '-', 'v', 'e', 'r', 'm', 'g', 'e', 'n', 's', 'b', 'e', 'r', 'a', 't',
+	'u', 'n', 'g', '-', 'p', 'w', 'b', 'x', 'n', '-', '-', 'v', 'h', 'q', 'u', 'v',
+	'x', 'n', '-', '-', 'v', 'u', 'q', '8', '6', '1', 'b', 'x', 'n', '-', '-', 'w',
+	'4', 'r', '8', '5', 'e', 'l', '8', 'f', 'h', 'u', '5', 'd', 'n', 'r', 'a', 'x',
+	'n', '-', '-', 'w', '4', 'r', 's', '4', '0', 'l', 'x', 'n', '-', '-', 'w', 'g',
+	'b', 'h', '1', 'c', 'x', 'n', '-', '-', 'w', 'g', 'b', 'l', '6', 'a', 'x', 'n',
+	'-', '-', 'x', 'h', 'q', '5', '2', '1', 'b', 'x', 'n', '-', '-', 'x', 'k', 'c',
+	'2', 'a', 'l', '3', 'h', 'y', 'e', '2', 'a', 'x', 'n', '-', '-', 'x', 'k', 'c',
+	'2', 'd', 'l', '3', 'a', '5', 'e', 'e', '0', 'h', 'x', 'n', '-', '-', 'y', '9',
+	'a', '3', 'a', 'q', 'x', 'n', '-', '-', 'y', 'f', 'r', 'o', '4', 'i', '6', '7',
+	'o', 'x', 'n', '-', '-', 'y', 'g', 'b', 'i', '2', 'a', 'm', 'm', 'x', 'x', 'n',
+	'-', '-', 'z', 'f', 'r', '1', '6', '4', 'b', 'x', 'x', 'x', 'x', 'y', 'z', 'y',
+	'a', 'c', 'h', 't', 's', 'y', 'a', 'h', 'o', 'o', 'y', 'a', 'm', 'a', 'x', 'u',
+	'n', 'y', 'a', 'n', 'd', 'e', 'x', 'y', 'o', 'd', 'o', 'b', 'a', 's', 'h', 'i',
+	'y', 'o', 'g', 'a', 'y', 'o', 'k', 'o', 'h', 'a', 'm', 'a', 'y', 'o', 'u', 't',
+	'u', 'b', 'e', 'z', 'a', 'p', 'p', 'o', 's', 'z', 'a', 'r', 'a', 'z', 'e', 'r',
+	'o', 'z', 'i', 'p', 'z', 'o', 'n', 'e', 'z', 'u', 'e', 'r', 'i', 'c', 'h', 'z',
+	'w', 'd', 'r', 'r', 'o', 'f', 'f', 'i', 'c', 'i', 'a', 'l', 'n', 'o', 'm', 'b',
+	'l', 'o', 'g', 's', 'p', 'o', 't', 'a', 'c', 'c', 'i', 'd', 'e', 'n', 't', '-',
+	'i', 'n', 'v', 'e', 's', 't', 'i', 'g', 'a', 't', 'i', 'o', 'n', 'a', 'c', 'c',
+	'i', 'd', 'e', 'n', 't', '-', 'p', 'r', 'e', 'v', 'e', 'n', 't', 'i', 'o', 'n',
+	'a', 'e', 'r', 'o', 'b', 'a', 't', 'i', 'c', 'a', 'e', 'r', 'o', 'c', 'l', 'u',
+	'b', 'a', 'e', 'r', 'o', 'd', 'r', 'o', 'm', 'e', 'a', 'g', 'e', 'n', 't', 's',
+	'a', 'i', 'r', '-', 's', 'u', 'r', 'v', 'e', 'i', 'l', 'l', 'a', 'n', 'c', 'e',
+	'a', 'i', 'r', '-', 't', 'r', 'a', 'f', 'f', 'i', 'c', '-', 'c', 'o', 'n', 't',
+	'r', 'o', 'l', 'a', 'i', 'r', 'c', 'r', 'a', 'f', 't', 'a', 'i', 'r', 'l', 'i',
+	'n', 'e', 'a', 'i', 'r', 'p', 'o', 'r', 't', 'a', 'i', 'r', 't', 'r', 'a', 'f',
+	'f', 'i', 'c', 'a', 'm', 'b', 'u', 'l', 'a', 'n', 'c', 'e', 'a', 'm', 'u', 's',
+	'e', 'm', 'e', 'n', 't', 'a', 's', 's', 'o', 'c', 'i', 'a', 't', 'i', 'o', 'n',
+	'b', 'a', 'l', 'l', 'o', 'o', 'n', 'i', 'n', 'g', 'c', 'a', 'r', 'g', 'o', 'c',
+	'e', 'r', 't', 'i', 'f', 'i', 'c', 'a', 't', 'i', 'o', 'n', 'c', 'h', 'a', 'm',
+	'p', 'i', 'o', 'n', 's', 'h', 'i', 'p', 'c', 'h', 'a', 'r', 't', 'e', 'r', 'c',
+	'i', 'v', 'i', 'l', 'a', 'v', 'i', 'a', 't', 'i', 'o', 'n', 'c', 'o', 'n', 'f',
+	'e', 'r', 'e', 'n', 'c', 'e', 'c', 'o', 'n', 's', 'u', 'l', 't', 'a', 'n', 't',
+	'c', 'o', 'u', 'n', 'c', 'i', 'l', 'c', 'r', 'e', 'w', 'd', 'g', 'c', 'a', 'e',
+	'd', 'u', 'c', 'a', 't', 'o', 'r', 'e', 'm', 'e', 'r', 'g', 'e', 'n', 'c', 'y',
+	'e', 'n', 't', 'e', 'r', 't', 'a', 'i', 'n', 'm', 'e', 'n', 't', 'f', 'e', 'd',
+	'e', 'r', 'a', 't', 'i', 'o', 'n', 'f', 'u', 'e', 'l', 'g', 'l', 'i', 'd', 'i',
+	'n', 'g', 'g', 'o', 'v', 'e', 'r', 'n', 'm', 'e', 'n', 't', 'g', 'r', 'o', 'u',
+	'n', 'd', 'h', 'a', 'n', 'd', 'l', 'i', 'n', 'g', 'h', 'a', 'n', 'g', 'g', 'l',
+	'i', 'd', 'i', 'n', 'g', 'h', 'o', 'm', 'e', 'b', 'u', 'i', 'l', 't', 'j', 'o',
+	'u', 'r', 'n', 'a', 'l', 'j', 'o', 'u', 'r', 'n', 'a', 'l', 'i', 's', 't', 'l',
+	'e', 'a', 's', 'i', 'n', 'g', 'm', 'a', 'g', 'a', 'z', 'i', 'n', 'e', 'm', 'a',
+	'i', 'n', 't', 'e', 'n', 'a', 'n', 'c', 'e', 'm', 'i', 'c', 'r', 'o', 'l', 'i',
+	'g', 'h', 't', 'm', 'o', 'd', 'e', 'l', 'l', 'i', 'n', 'g', 'n', 'a', 'v', 'i',
+	'g', 'a', 't', 'i', 'o', 'n', 'p', 'a', 'r', 'a', 'c', 'h', 'u', 't', 'i', 'n',
+	'g', 'p', 'a', 'r', 'a', 'g', 'l', 'i', 'd', 'i', 'n', 'g', 'p', 'a', 's', 's',
+	'e', 'n', 'g', 'e', 'r', '-', 'a', 's', 's', 'o', 'c', 'i', 'a', 't', 'i', 'o',
+	'n', 'p', 'i', 'l', 'o', 't', 'r', 'e', 'c', 'r', 'e', 'a', 't', 'i', 'o', 'n',
+	'r', 'e', 'p', 'b', 'o', 'd', 'y', 'r', 'e', 's', 'e', 'a', 'r', 'c', 'h', 'r',
+	'o', 't', 'o', 'r', 'c', 'r', 'a', 'f', 't', 's', 'c', 'i', 'e', 'n', 't', 'i',
+	's', 't', 's', 'k', 'y', 'd', 'i', 'v', 'i', 'n', 'g', 's', 't', 'u', 'd', 'e',
+	'n', 't', 't', 'r', 'a', 'd', 'e', 'r', 't', 'r', 'a', 'i', 'n', 'e', 'r', 'w',
+	'o', 'r', 'k', 'i', 'n', 'g', 'g', 'r', 'o', 'u', 'p', 'u', 'w', 'u', 'c', 'o',
+	'm', 'm', 'u', 'n', 'e', 'n', 'e', 'k', 'o', 'n', 'y', 'a', 'a', 'b', 'e', 'g',
+	'e', 't', 'b', 'o', 'o', 'k', 'o', 'n', 'l', 'i', 'n', 'e', 'c', 'l', 'e', 'r',
+	'k', 'c', 'l', 'e', 'r', 'k', 's', 't', 'a', 'g', 'e', 'd', 'e', 't', 'a', 'd',
+	'e', 'v', 'e', 'l', 'o', 'p', 'e', 'r', 'e', 'a', 's', 'y', 'p', 'a', 'n', 'e',
+	'l', 'e', 'd', 'g', 'e', 'c', 'o', 'm', 'p', 'u', 't', 'e', 'e', 'n', 'c', 'r',
+	'f', 'i', 'r', 'e', 'w', 'e', 'b', 'f', 'r', 'a', 'm', 'e', 'r', 'h', 'a', 's',
+	'u', 'r', 'a', 'l', 'o', 'g', 'i', 'n', 'l', 'i', 'n', 'e', 'm', 'e', 's', 's',
+	'e', 'r', 'l', 'i', 'n', 'e', 't', 'l', 'i', 'f', 'y', 'n', 'o', 'o', 'p', 'n',
+	'o', 'r', 't', 'h', 'f', 'l', 'a', 'n', 'k', 'o', 'n', 'd', 'i', 'g', 'i', 't',
+	'a', 'l', 'o', 'c', 'e', 'a', 'n', 'o', 'n', 'f', 'l', 'a', 's', 'h', 'd', 'r',
+	'i', 'v', 'e', 'p', 'l', 'a', 't', 'f', 'o', 'r', 'm', '0', 's', 'n', 'o', 'w',
+	'f', 'l', 'a', 'k', 'e', 's', 't', 'r', 'e', 'a', 'm', 'l', 'i', 't', 't', 'e',
+	'l', 'e', 'b', 'i', 't', 't', 'y', 'p', 'e', 'd', 'r', 'e', 'a', 'm', 'v', 'e',
+	'r', 'c', 'e', 'l', 'w', 'n', 'e', 'x', 't', 'm', 'u', 's', 'i', 'c', 'a', 's',
+	'e', 'n', 'a', 's', 'a', 'e', '1', '6', '4', 'i', 'n', '-', 'a', 'd', 'd', 'r',
+	'i', 'p', '6', 'c', 'l', 'o', 'u', 'd', 'n', 's', '1', '2', '3', 'w', 'e', 'b',
+	's', 'e', 'i', 't', 'e', '1', '2', 'h', 'p', '2', 'i', 'x', '4', 'l', 'i', 'm',
+	'a', 'f', 'u', 'n', 'k', 'f', 'e', 'u', 'e', 'r', 'f', 'u', 't', 'u', 'r', 'e',
+	'c', 'm', 's', 'f', 'u', 't', 'u', 'r', 'e', 'h', 'o', 's', 't', 'i', 'n', 'g',
+	'f', 'u', 't', 'u', 'r', 'e', 'm', 'a', 'i', 'l', 'i', 'n', 'g', 'l', 'i', 'm',
+	'a', '-', 'c', 'i', 't', 'y', 'm', 'y', 's', 'p', 'r', 'e', 'a', 'd', 's', 'h',
+	'o', 'p', 'o', 'r', 't', 's', 'i', 'n', 'f', 'o', 'p', 'r', 'i', 'v', 'a', 's',
+	'n', 'n', 's', 'w', 'q', 'l', 'd', '1', '2', '3', 'w', 'e', 'b', 's', 'i', 't',
+	'e', 'i', 'n', 't', 'e', 'r', 'h', 'o', 's', 't', 's', 'o', 'l', 'u', 't', 'i',
+	'o', 'n', 's', 'k', 'u', 'l', 'e', 'u', 'v', 'e', 'n', 't', 'r', 'a', 'n', 's',
+	'u', 'r', 'l', 'w', 'e', 'b', 'h', 'o', 's', 't', 'i', 'n', 'g', 'b', 'a', 'r',
+	's', 'y', 'a', 'c', 't', 'i', 'v', 'e', 't', 'r', 'a', 'i', 'l', 'd', 's', 'c',
+	'l', 'o', 'u', 'd', 'd', 'y', 'n', 'd', 'n', 's', 'f', 'o', 'r', '-', 'b', 'e',
+	't', 't', 'e', 'r', 'f', 'o', 'r', '-', 'm', 'o', 'r', 'e', 'f', 'o', 'r', '-',
+	's', 'o', 'm', 'e', 'f', 'o', 'r', '-', 't', 'h', 'e', 'j', 'o', 'z', 'i', 'm',
+	'm', 'a', 'f', 'a', 'n', 'm', 'y', 'f', 't', 'p', 'n', 'o', '-', 'i', 'p', 'o',
+	'r', 'x', 's', 'e', 'l', 'f', 'i', 'p', 'w', 'e', 'b', 'h', 'o', 'p', 'a', 'g',
+	'r', 'o', 'a', 'r', 'c', 'h', 'i', 't', 'e', 'c', 't', 'e', 's', 'a', 's', 's',
+	'u', 'r', 'a', 'v', 'o', 'c', 'a', 't', 's', 'e', 'c', 'o', 'n', 'o', 'l', 'o',
+	'i', 's', 'i', 'r', 's', 't', 'o', 'u', 'r', 'i', 's', 'm', 'a', 'c', 'a', 'd',
+	'e', 'm', 'i', 'a', 'b', 'o', 'l', 'i', 'v', 'i', 'a', 'c', 'i', 'e', 'n', 'c',
+	'i', 'a', 'c', 'o', 'o', 'p', 'e', 'r', 'a', 't', 'i', 'v', 'a', 'd', 'e', 'm',
+	'o', 'c', 'r', 'a', 'c', 'i', 'a', 'd', 'e', 'p', 'o', 'r', 't', 'e', 'e', 'c',
+	'o', 'l', 'o', 'g', 'i', 'a', 'e', 'c', 'o', 'n', 'o', 'm', 'i', 'a', 'e', 'm',
+	'p', 'r', 'e', 's', 'a', 'i', 'n', 'd', 'i', 'g', 'e', 'n', 'a', 'i', 'n', 'd',
+	'u', 's', 't', 'r', 'i', 'a', 'm', 'e', 'd', 'i', 'c', 'i', 'n', 'a', 'm', 'o',
+	'v', 'i', 'm', 'i', 'e', 'n', 't', 'o', 'n', 'a', 't', 'u', 'r', 'a', 'l', 'n',
+	'o', 'm', 'b', 'r', 'e', 'n', 'o', 't', 'i', 'c', 'i', 'a', 's', 'p', 'a', 't',
+	'r', 'i', 'a', 'p', 'l', 'u', 'r', 'i', 'n', 'a', 'c', 'i', 'o', 'n', 'a', 'l',
+	'p', 'o', 'l', 'i', 't', 'i', 'c', 'a', 'p', 'r', 'o', 'f', 'e', 's', 'i', 'o',
+	'n', 'a', 'l', 'p', 'u', 'e', 'b', 'l', 'o', 'r', 'e', 'v', 'i', 's', 't', 'a',
+	's', 'a', 'l', 'u', 'd', 't', 'e', 'c', 'n', 'o', 'l', 'o', 'g', 'i', 'a', 't',
+	'k', 's', 'a', 't', 't', 'r', 'a', 'n', 's', 'p', 'o', 'r', 't', 'e', '9', 'g',
+	'u', 'a', 'c', 'u', 'a', 'd', 'm', 'a', 'd', 'v', 'a', 'j', 'u', 'a', 'n', 'a',
+	'n', 'i', 'a', 'p', 'a', 'r', 'e', 'c', 'i', 'd', 'a', 'a', 'r', 'q', 'b', 'a',
+	'r', 'u', 'e', 'r', 'i', 'b', 'e', 'l', 'e', 'm', 'b', 'h', 'z', 'b', 'm', 'd',
+	'b', 'o', 'a', 'v', 'i', 's', 't', 'a', 'c', 'a', 'm', 'p', 'i', 'n', 'a', 'g',
+	'r', 'a', 'n', 'd', 'e', 'c', 'a', 'm', 'p', 'i', 'n', 'a', 's', 'c', 'a', 'x',
+	'i', 'a', 's', 'c', 'i', 'm', 'c', 'n', 'g', 'c', 'n', 't', 'c', 'o', 'n', 't',
+	'a', 'g', 'e', 'm', 'c', 'o', 'z', 'c', 'u', 'i', 'a', 'b', 'a', 'c', 'u', 'r',
+	'i', 't', 'i', 'b', 'a', 'd', 'e', 'f', 'e', 'n', 'f', 'f', 'e', 'i', 'r', 'a',
+	'f', 'l', 'o', 'g', 'f', 'l', 'o', 'r', 'i', 'p', 'a', 'f', 'n', 'd', 'f', 'o',
+	'r', 't', 'a', 'l', 'f', 'o', 't', 'f', 'o', 'z', 'f', 's', 't', 'g', '1', '2',
+	'g', 'g', 'f', 'g', 'o', 'i', 'a', 'n', 'i', 'a', 'g', 'r', 'u', 'i', 'm', 'b',
+	'j', 'a', 'b', 'j', 'a', 'm', 'p', 'a', 'j', 'd', 'f', 'j', 'o', 'i', 'n', 'v',
+	'i', 'l', 'l', 'e', 'j', 'o', 'r', 'j', 'u', 's', 'l', 'o', 'n', 'd', 'r', 'i',
+	'n', 'a', 'm', 'a', 'c', 'a', 'p', 'a', 'm', 'a', 'c', 'e', 'i', 'o', 'm', 'a',
+	'n', 'a', 'u', 's', 'm', 'a', 'r', 'i', 'n', 'g', 'a', 'm', 'o', 'r', 'e', 'n',
+	'a', 'n', 'a', 't', 'a', 'l', 'n', 'i', 't', 'e', 'r', 'o', 'i', 'o', 's', 'a',
+	's', 'c', 'o', 'p', 'a', 'l', 'm', 'a', 's', 'p', 'o', 'a', 'p', 'p', 'g', 'p',
+	's', 'c', 'p', 's', 'i', 'p', 'v', 'h', 'q', 's', 'l', 'r', 'e', 'c', 'i', 'f',
+	'e', 'r', 'i', 'b', 'e', 'i', 'r', 'a', 'o', 'r', 'i', 'o', 'b', 'r', 'a', 'n',
+	'c', 'o', 'r', 'i', 'o', 'p', 'r', 'e', 't', 'o', 's', 'a', 'l', 'v', 'a', 'd',
+	'o', 'r', 's', 'a', 'm', 'p', 'a', 's', 'a', 'n', 't', 'a', 'm', 'a', 'r', 'i',
+	'a', 's', 'a', 'n', 't', 'o', 'a', 'n', 'd', 'r', 'e', 's', 'a', 'o', 'b', 'e',
+	'r', 'n', 'a', 'r', 'd', 'o', 's', 'a', 'o', 'g', 'o', 'n', 'c', 'a', 's', 'e',
+	'g', 's', 'j', 'c', 's', 'l', 'z', 's', 'o', 'r', 'o', 'c', 'a', 'b', 'a', 's',
+	'r', 'v', 't', 'e', 'o', 't', 'm', 'p', 't', 'r', 'd', 'v', 'i', 'x', 'v', 'l',
+	'o', 'g', 'z', 'l', 'g', 'c', 'l', 'o', 'u', 'd', 's', 'i', 't', 'e', 'm', 'e',
+	'd', 'i', 'a', 't', 'e', 'c', 'h', 'm', 'y', 'c', 'l', 'o', 'u', 'd', 'a', 'w',
+	'd', 'e', 'v', 'n', 'a', 'b', 'u', 'c', 's', 'x', 'f', 'a', 'n', 't', 'a', 's',
+	'y', 'l', 'e', 'a', 'g', 'u', 'e', 'f', 't', 'p', 'a', 'c', 'c', 'e', 's', 's',
+	'g', 'a', 'm', 'e', '-', 's', 'e', 'r', 'v', 'e', 'r', 'm', 'y', 'p', 'h', 'o',
+	't', 'o', 's', 's', 'c', 'r', 'a', 'p', 'p', 'i', 'n', 'g', 's', 'p', 'a', 'w',
+	'n', 't', 'w', 'm', 'a', 'i', 'l', 'd', 'n', 's', 'k', 'i', 'n', 'g', 'f', 'i',
+	'r', 'e', 'n', 'e', 't', 'g', 'o', 't', 'd', 'n', 's', 'l', 'i', 'n', 'k', 'y',
+	'a', 'r', 'd', '-', 'c', 'l', 'o', 'u', 'd', 's', 'q', 'u', 'a', 'r', 'e', '7',
+	'g', 'o', 'u', 'v', 'p', 'r', 'e', 's', 's', 'e', 'x', 'n', '-', '-', 'a', 'r',
+	'o', 'p', 'o', 'r', 't', '-', 'b', 'y', 'a', 'w', 'w', 'w', 'a', 'x', 'a', 'r',
+	'n', 'e', 't', 'b', 'a', 'n', 'z', 'a', 'i', 'd', 'i', 'a', 'd', 'e', 'm', 'e',
+	'l', 'e', 'm', 'e', 'n', 't', 'o', 'r', 'e', 'n', 'c', 'o', 'w', 'a', 'y', 'j',
+	'e', 'l', 'a', 's', 't', 'i', 'c', 'j', 'e', 'l', 'e', 'j', 'e', 'n', 'v', '-',
+	'a', 'r', 'u', 'b', 'a', 'j', 'o', 't', 'e', 'l', 'u', 'l', 'u', 'k', 'e', 'l',
+	'i', 'w', 'e', 'b', 'm', 'a', 'g', 'e', 'n', 't', 'o', 's', 'i', 't', 'e', 'o',
+	'n', '-', 'r', 'a', 'n', 'c', 'h', 'e', 'r', 'o', 'x', 'a', 'p', 'e', 'r', 's',
+	'p', 'e', 'c', 't', 'a', 'p', 'r', 'i', 'm', 'e', 't', 'e', 'l', 'r', 'a', 'v',
+	'e', 'n', 'd', 'b', 'r', 'e', 'c', 'l', 'a', 'i', 'm', 's', 'c', 'w', 's', 'e',
+	'n', 's', 'i', 'o', 's', 'i', 't', 'e', 's', 't', 'a', 't', 'i', 'c', 's', 't',
+	'r', 'a', 'f', 'f', 'i', 'c', 'p', 'l', 'e', 'x', 't', 'r', 'e', 'n', 'd', 'h',
+	'o', 's', 't', 'i', 'n', 'g', 'u', 'r', 'o', 'w', 'n', 'v', 'a', 'p', 'o', 'r',
+	'v', 'o', 'o', 'r', 'l', 'o', 'p', 'e', 'r', 'c', 'a', 'n', 'v', 'a', '-', 'a',
+	'p', 'p', 's', 'i', 'n', 's', 't', 'a', 'n', 't', 'c', 'l', 'o', 'u', 'd', 'j',
+	's', 'q', 'h', 'q', 'u', 'i', 'c', 'k', 'c', 'o', 'n', 'n', 'e', 'c', 't', 'x',
+	'j', 'x', 'n', '-', '-', 'o', 'd', '0', 'a', 'l', 'g', 'x', 'z', 'z', 'j', 'c',
+	'a', 'r', 'r', 'd', 'c', 'r', 'd', 'f', 'i', 'r', 'e', 'w', 'a', 'l', 'l', 'e',
+	'd', 'r', 'e', 'p', 'l', 'i', 't', 'l', 'e', 'a', 'd', 'p', 'a', 'g', 'e', 's',
+	'l', 'p', 'a', 'g', 'e', 's', 'm', 'y', 'p', 'i', 'n', '4', 't', 'o', 't', 'a',
+	'p', 's', 'u', 'p', 'a', 'b', 'a', 's', 'e', 'o', 'w', 'o', '0', '0', '1', 'w',
+	'w', 'w', '0', 'e', 'm', 'm', '1', 'k', 'a', 'p', 'p', '3', 'u', 't', 'i', 'l',
+	'i', 't', 'i', 'e', 's', '4', 'u', 'a', 'd', 'o', 'b', 'e', 'a', 'e', 'm', 'c',
+	'l', 'o', 'u', 'd', 'a', 'i', 'r', 'k', 'i', 't', 'a', 'p', 'p', 's', 'a', 'i',
+	'r', 'k', 'i', 't', 'a', 'p', 'p', 's', '-', 'a', 'u', 'a', 'i', 'v', 'e', 'n',
+	'c', 'l', 'o', 'u', 'd', 'a', 'l', 'p', 'h', 'a', '-', 'm', 'y', 'q', 'n', 'a',
+	'p', 'c', 'l', 'o', 'u', 'd', 'a', 'm', 'a', 'z', 'o', 'n', 'a', 'w', 's', 'a',
+	'm', 's', 'c', 'o', 'm', 'p', 'u', 't', 'e', 'a', 'p', 'p', 'c', 'h', 'i', 'z',
+	'i', 'a', 'p', 'p', 'l', 'i', 'n', 'z', 'i', 'a', 'p', 'p', 's', 'p', 'a', 'c',
+	'e', 'h', 'o', 's', 't', 'e', 'd', 'a', 'p', 'p', 's', 'p', 'a', 'c', 'e', 'u',
+	's', 'e', 'r', 'c', 'o', 'n', 't', 'e', 'n', 't', 'a', 'p', 'p', 's', 'p', 'o',
+	't', 'a', 'u', 't', 'h', 'g', 'e', 'a', 'r', '-', 's', 't', 'a', 'g', 'i', 'n',
+	'g', 'a', 'u', 't', 'h', 'g', 'e', 'a', 'r', 'a', 'p', 'p', 's', 'a', 'w', 's',
+	'g', 'l', 'o', 'b', 'a', 'l', 'a', 'c', 'c', 'e', 'l', 'e', 'r', 'a', 't', 'o',
+	'r', 'a', 'w', 's', 'm', 'p', 'p', 'l', 'b', 'a', 'l', 'e', 'n', 'a', '-', 'd',
+	'e', 'v', 'i', 'c', 'e', 's', 'b', 'a', 'r', 's', 'y', 'c', 'e', 'n', 't', 'e',
+	'r', 'b', 'a', 'r', 's', 'y', 'o', 'n', 'l', 'i', 'n', 'e', 'b', 'e', 't', 'a',
+	'i', 'n', 'a', 'b', 'o', 'x', 'b', 'l', 'o', 'g', 'd', 'n', 's', 'b', 'l', 'o',
+	'g', 's', 'y', 't', 'e', 'b', 'l', 'o', 'x', 'c', 'm', 's', 'b', 'o', 'u', 'n',
+	't', 'y', '-', 'f', 'u', 'l', 'l', 'b', 'o', 'u', 't', 'i', 'r', 'b', 'p', 'l',
+	'a', 'c', 'e', 'd', 'b', 'u', 'i', 'l', 't', 'w', 'i', 't', 'h', 'd', 'a', 'r',
+	'k', 'c', 'a', 'f', 'j', 's', 'c', 'e', 'c', 'h', 'i', 'r', 'e', 'c', 'f', '-',
+	'i', 'p', 'f', 's', 'c', 'i', 's', 'c', 'o', 'f', 'r', 'e', 'a', 'k', 'c', 'l',
+	'i', 'c', 'k', 'e', 't', 'c', 'l', 'o', 'u', 'd', 'c', 'l', 'o', 'u', 'd', 'c',
+	'o', 'n', 't', 'r', 'o', 'l', 'a', 'p', 'p', 'c', 'l', 'o', 'u', 'd', 'c', 'o',
+	'n', 't', 'r', 'o', 'l', 'l', 'e', 'd', 'c', 'l', 'o', 'u', 'd', 'f', 'l', 'a',
+	'r', 'e', '-', 'i', 'p', 'f', 's', 'c', 'o', 'd', 'e', 's', 'p', 'o', 't', 'c',
+	'u', 's', 't', 'o', 'm', 'e', 'r', '-', 'o', 'c', 'i', 'd', 'a', 'm', 'n', 's',
+	'e', 'r', 'v', 'e', 'r', 'd', 'a', 't', 'a', 'd', 'e', 't', 'e', 'c', 't', 'd',
+	'a', 't', 't', 'o', 'l', 'o', 'c', 'a', 'l', 'd', 'a', 't', 't', 'o', 'r', 'e',
+	'l', 'a', 'y', 'd', 'a', 't', 't', 'o', 'w', 'e', 'b', 'd', 'd', 'n', 's', '5',
+	'd', 'd', 'n', 's', 'f', 'r', 'e', 'e', 'd', 'd', 'n', 's', 'g', 'e', 'e', 'k',
+	'd', 'd', 'n', 's', 'k', 'i', 'n', 'g', 'd', 'd', 'n', 's', 'l', 'i', 'v', 'e',
+	'd', 'e', 'v', '-', 'm', 'y', 'q', 'n', 'a', 'p', 'c', 'l', 'o', 'u', 'd', 'd',
+	'e', 'v', 'c', 'd', 'n', 'a', 'c', 'c', 'e', 's', 's', 'o', 'd', 'i', 'g', 'i',
+	't', 'a', 'l', 'o', 'c', 'e', 'a', 'n', 's', 'p', 'a', 'c', 'e', 's', 'd', 'i',
+	's', 'c', 'o', 'r', 'd', 's', 'a', 'y', 's', 'd', 'i', 's', 'c', 'o', 'r', 'd',
+	's', 'e', 'z', 'd', 'i', 't', 'c', 'h', 'y', 'o', 'u', 'r', 'i', 'p', 'd', 'n',
+	's', 'a', 'l', 'i', 'a', 's', 'd', 'n', 's', 'd', 'o', 'j', 'o', 'd', 'n', 's',
+	'i', 's', 'k', 'i', 'n', 'k', 'y', 'd', 'o', 'e', 's', 'n', 't', 'e', 'x', 'i',
+	's', 't', 'd', 'o', 'n', 't', 'e', 'x', 'i', 's', 't', 'd', 'o', 'o', 'm', 'd',
+	'n', 's', 'd', 'o', 'p', 'a', 'a', 's', 'd', 'r', 'a', 'y', 'd', 'd', 'n', 's',
+	'd', 'r', 'e', 'a', 'm', 'h', 'o', 's', 't', 'e', 'r', 's', 'd', 's', 'm', 'y',
+	'n', 'a', 's', 'd', 'y', 'n', '-', 'o', '-', 's', 'a', 'u', 'r', 'd', 'y', 'n',
+	'a', 'l', 'i', 'a', 's', 'd', 'y', 'n', 'd', 'n', 's', '-', 'a', 't', '-', 'h',
+	'o', 'm', 'e', 'd', 'y', 'n', 'd', 'n', 's', '-', 'a', 't', '-', 'w', 'o', 'r',
+	'k', 'd', 'y', 'n', 'd', 'n', 's', '-', 'b', 'l', 'o', 'g', 'd', 'y', 'n', 'd',
+	'n', 's', '-', 'f', 'r', 'e', 'e', 'd', 'y', 'n', 'd', 'n', 's', '-', 'h', 'o',
+	'm', 'e', 'd', 'y', 'n', 'd', 'n', 's', '-', 'i', 'p', 'd', 'y', 'n', 'd', 'n',
+	's', '-', 'm', 'a', 'i', 'l', 'd', 'y', 'n', 'd', 'n', 's', '-', 'o', 'f', 'f',
+	'i', 'c', 'e', 'd', 'y', 'n', 'd', 'n', 's', '-', 'p', 'i', 'c', 's', 'd', 'y',
+	'n', 'd', 'n', 's', '-', 'r', 'e', 'm', 'o', 't', 'e', 'd', 'y', 'n', 'd', 'n',
+	's', '-', 's', 'e', 'r', 'v', 'e', 'r', 'd', 'y', 'n', 'd', 'n', 's', '-', 'w',
+	'e', 'b', 'd', 'y', 'n', 'd', 'n', 's', '-', 'w', 'i', 'k', 'i', 'd', 'y', 'n',
+	'd', 'n', 's', '-', 'w', 'o', 'r', 'k', 'd', 'y', 'n', 'n', 's', 'e', 'l', 'a',
+	's', 't', 'i', 'c', 'b', 'e', 'a', 'n', 's', 't', 'a', 'l', 'k', 'e', 'n', 'c',
+	'o', 'r', 'e', 'a', 'p', 'i', 'e', 's', 't', '-', 'a', '-', 'l', 'a', '-', 'm',
+	'a', 'i', 's', 'o', 'n', 'e', 's', 't', '-', 'a', '-', 'l', 'a', '-', 'm', 'a',
+	's', 'i', 'o', 'n', 'e', 's', 't', '-', 'l', 'e', '-', 'p', 'a', 't', 'r', 'o',
+	'n', 'e', 's', 't', '-', 'm', 'o', 'n', '-', 'b', 'l', 'o', 'g', 'u', 'e', 'u',
+	'r', 'e', 'v', 'e', 'n', 'n', 'o', 'd', 'e', 'f', 'a', 'm', 'i', 'l', 'y', 'd',
+	's', 'f', 'a', 's', 't', 'l', 'y', '-', 'e', 'd', 'g', 'e', 'f', 'a', 's', 't',
+	'l', 'y', '-', 't', 'e', 'r', 'r', 'a', 'r', 'i', 'u', 'm', 'f', 'a', 's', 't',
+	'v', 'p', 's', '-', 's', 'e', 'r', 'v', 'e', 'r', 'f', 'b', 's', 'b', 'x', 'f',
+	'i', 'r', 'e', 'b', 'a', 's', 'e', 'a', 'p', 'p', 'f', 'i', 'r', 'e', 'w', 'a',
+	'l', 'l', '-', 'g', 'a', 't', 'e', 'w', 'a', 'y', 'f', 'l', 'd', 'r', 'v', 'f',
+	'o', 'r', 'g', 'e', 'b', 'l', 'o', 'c', 'k', 's', 'f', 'r', 'a', 'm', 'e', 'r',
+	'c', 'a', 'n', 'v', 'a', 's', 'f', 'r', 'e', 'e', 'b', 'o', 'x', '-', 'o', 's',
+	'f', 'r', 'e', 'e', 'b', 'o', 'x', 'o', 's', 'f', 'r', 'e', 'e', 'm', 'y', 'i',
+	'p', 'f', 'r', 'o', 'm', '-', 'a', 'k', 'f', 'r', 'o', 'm', '-', 'a', 'l', 'f',
+	'r', 'o', 'm', '-', 'a', 'r', 'f', 'r', 'o', 'm', '-', 'c', 'a', 'f', 'r', 'o',
+	'm', '-', 'c', 't', 'f', 'r', 'o', 'm', '-', 'd', 'c', 'f', 'r', 'o', 'm', '-',
+	'd', 'e', 'f', 'r', 'o', 'm', '-', 'f', 'l', 'f', 'r', 'o', 'm', '-', 'g', 'a',
+	'f', 'r', 'o', 'm', '-', 'h', 'i', 'f', 'r', 'o', 'm', '-', 'i', 'a', 'f', 'r',
+	'o', 'm', '-', 'i', 'd', 'f', 'r', 'o', 'm', '-', 'i', 'l', 'f', 'r', 'o', 'm',
+	'-', 'i', 'n', 'f', 'r', 'o', 'm', '-', 'k', 's', 'f', 'r', 'o', 'm', '-', 'k',
+	'y', 'f', 'r', 'o', 'm', '-', 'm', 'a', 'f', 'r', 'o', 'm', '-', 'm', 'd', 'f',
+	'r', 'o', 'm', '-', 'm', 'i', 'f', 'r', 'o', 'm', '-', 'm', 'n', 'f', 'r', 'o',
+	'm', '-', 'm', 'o', 'f', 'r', 'o', 'm', '-', 'm', 's', 'f', 'r', 'o', 'm', '-',
+	'm', 't', 'f', 'r', 'o', 'm', '-', 'n', 'c', 'f', 'r', 'o', 'm', '-', 'n', 'd',
+	'f', 'r', 'o', 'm', '-', 'n', 'e', 'f', 'r', 'o', 'm', '-', 'n', 'h', 'f', 'r',
+	'o', 'm', '-', 'n', 'j', 'f', 'r', 'o', 'm', '-', 'n', 'm', 'f', 'r', 'o', 'm',
+	'-', 'n', 'v', 'f', 'r', 'o', 'm', '-', 'o', 'h', 'f', 'r', 'o', 'm', '-', 'o',
+	'k', 'f', 'r', 'o', 'm', '-', 'o', 'r', 'f', 'r', 'o', 'm', '-', 'p', 'a', 'f',
+	'r', 'o', 'm', '-', 'p', 'r', 'f', 'r', 'o', 'm', '-', 'r', 'i', 'f', 'r', 'o',
+	'm', '-', 's', 'c', 'f', 'r', 'o', 'm', '-', 's', 'd', 'f', 'r', 'o', 'm', '-',
+	't', 'n', 'f', 'r', 'o', 'm', '-', 't', 'x', 'f', 'r', 'o', 'm', '-', 'u', 't',
+	'f', 'r', 'o', 'm', '-', 'v', 'a', 'f', 'r', 'o', 'm', '-', 'v', 't', 'f', 'r',
+	'o', 'm', '-', 'w', 'a', 'f', 'r', 'o', 'm', '-', 'w', 'i', 'f', 'r', 'o', 'm',
+	'-', 'w', 'v', 'f', 'r', 'o', 'm', '-', 'w', 'y', 'g', 'e', 'e', 'k', 'g', 'a',
+	'l', 'a', 'x', 'y', 'g', 'e', 'n', 't', 'a', 'p', 'p', 's', 'g', 'e', 'n', 't',
+	'l', 'e', 'n', 't', 'a', 'p', 'i', 's', 'g', 'e', 't', 'm', 'y', 'i', 'p', 'g',
+	'i', 'i', 'z', 'e', 'g', 'i', 't', 'h', 'u', 'b', 'u', 's', 'e', 'r', 'c', 'o',
+	'n', 't', 'e', 'n', 't', 'g', 'l', 'e', 'e', 'z', 'e', 'g', 'o', 'o', 'g', 'l',
+	'e', 'a', 'p', 'i', 's', 'g', 'o', 'o', 'g', 'l', 'e', 'c', 'o', 'd', 'e', 'g',
+	'o', 't', 'p', 'a', 'n', 't', 'h', 'e', 'o', 'n', 'h', 'e', 'a', 'l', 't', 'h',
+	'-', 'c', 'a', 'r', 'e', 'r', 'e', 'f', 'o', 'r', 'm', 'h', 'e', 'r', 'o', 'k',
+	'u', 'a', 'p', 'p', 'h', 'e', 'r', 'o', 'k', 'u', 's', 's', 'l', 'h', 'i', 'd',
+	'o', 'r', 'a', 'h', 'o', 'b', 'b', 'y', '-', 's', 'i', 't', 'e', 'h', 'o', 'm',
+	'e', 'l', 'i', 'n', 'u', 'x', 'h', 'o', 'm', 'e', 's', 'e', 'c', 'u', 'r', 'i',
+	't', 'y', 'm', 'a', 'c', 'h', 'o', 'm', 'e', 's', 'e', 'c', 'u', 'r', 'i', 't',
+	'y', 'p', 'c', 'h', 'o', 'm', 'e', 'u', 'n', 'i', 'x', 'h', 'o', 's', 't', 'e',
+	'd', '-', 'b', 'y', '-', 'p', 'r', 'e', 'v', 'i', 'd', 'e', 'r', 'h', 'o', 's',
+	't', 'e', 'd', 'p', 'i', 'h', 'o', 's', 't', 'e', 'u', 'r', 'h', 'o', 't', 'e',
+	'l', 'w', 'i', 't', 'h', 'f', 'l', 'i', 'g', 'h', 't', 'i', 'a', 'm', 'a', 'l',
+	'l', 'a', 'm', 'a', 'i', 'k', '-', 's', 'e', 'r', 'v', 'e', 'r', 'i', 'm', 'p',
+	'e', 'r', 't', 'r', 'i', 'x', 'i', 'm', 'p', 'e', 'r', 't', 'r', 'i', 'x', 'c',
+	'd', 'n', 'i', 's', '-', 'a', '-', 'a', 'n', 'a', 'r', 'c', 'h', 'i', 's', 't',
+	'i', 's', '-', 'a', '-', 'b', 'l', 'o', 'g', 'g', 'e', 'r', 'i', 's', '-', 'a',
+	'-', 'b', 'o', 'o', 'k', 'k', 'e', 'e', 'p', 'e', 'r', 'i', 's', '-', 'a', '-',
+	'b', 'u', 'l', 'l', 's', '-', 'f', 'a', 'n', 'i', 's', '-', 'a', '-', 'c', 'a',
+	't', 'e', 'r', 'e', 'r', 'i', 's', '-', 'a', '-', 'c', 'h', 'e', 'f', 'i', 's',
+	'-', 'a', '-', 'c', 'o', 'n', 's', 'e', 'r', 'v', 'a', 't', 'i', 'v', 'e', 'i',
+	's', '-', 'a', '-', 'c', 'p', 'a', 'i', 's', '-', 'a', '-', 'c', 'u', 'b', 'i',
+	'c', 'l', 'e', '-', 's', 'l', 'a', 'v', 'e', 'i', 's', '-', 'a', '-', 'd', 'e',
+	'm', 'o', 'c', 'r', 'a', 't', 'i', 's', '-', 'a', '-', 'd', 'e', 's', 'i', 'g',
+	'n', 'e', 'r', 'i', 's', '-', 'a', '-', 'd', 'o', 'c', 't', 'o', 'r', 'i', 's',
+	'-', 'a', '-', 'f', 'i', 'n', 'a', 'n', 'c', 'i', 'a', 'l', 'a', 'd', 'v', 'i',
+	's', 'o', 'r', 'i', 's', '-', 'a', '-', 'g', 'e', 'e', 'k', 'i', 's', '-', 'a',
+	'-', 'g', 'r', 'e', 'e', 'n', 'i', 's', '-', 'a', '-', 'g', 'u', 'r', 'u', 'i',
+	's', '-', 'a', '-', 'h', 'a', 'r', 'd', '-', 'w', 'o', 'r', 'k', 'e', 'r', 'i',
+	's', '-', 'a', '-', 'h', 'u', 'n', 't', 'e', 'r', 'i', 's', '-', 'a', '-', 'l',
+	'a', 'n', 'd', 's', 'c', 'a', 'p', 'e', 'r', 'i', 's', '-', 'a', '-', 'l', 'a',
+	'w', 'y', 'e', 'r', 'i', 's', '-', 'a', '-', 'l', 'i', 'b', 'e', 'r', 'a', 'l',
+	'i', 's', '-', 'a', '-', 'l', 'i', 'b', 'e', 'r', 't', 'a', 'r', 'i', 'a', 'n',
+	'i', 's', '-', 'a', '-', 'l', 'l', 'a', 'm', 'a', 'i', 's', '-', 'a', '-', 'm',
+	'u', 's', 'i', 'c', 'i', 'a', 'n', 'i', 's', '-', 'a', '-', 'n', 'a', 's', 'c',
+	'a', 'r', 'f', 'a', 'n', 'i', 's', '-', 'a', '-', 'n', 'u', 'r', 's', 'e', 'i',
+	's', '-', 'a', '-', 'p', 'a', 'i', 'n', 't', 'e', 'r', 'i', 's', '-', 'a', '-',
+	'p', 'e', 'r', 's', 'o', 'n', 'a', 'l', 't', 'r', 'a', 'i', 'n', 'e', 'r', 'i',
+	's', '-', 'a', '-', 'p', 'h', 'o', 't', 'o', 'g', 'r', 'a', 'p', 'h', 'e', 'r',
+	'i', 's', '-', 'a', '-', 'p', 'l', 'a', 'y', 'e', 'r', 'i', 's', '-', 'a', '-',
+	'r', 'e', 'p', 'u', 'b', 'l', 'i', 'c', 'a', 'n', 'i', 's', '-', 'a', '-', 'r',
+	'o', 'c', 'k', 's', 't', 'a', 'r', 'i', 's', '-', 'a', '-', 's', 'o', 'c', 'i',
+	'a', 'l', 'i', 's', 't', 'i', 's', '-', 'a', '-', 's', 't', 'u', 'd', 'e', 'n',
+	't', 'i', 's', '-', 'a', '-', 't', 'e', 'a', 'c', 'h', 'e', 'r', 'i', 's', '-',
+	'a', '-', 't', 'e', 'c', 'h', 'i', 'e', 'i', 's', '-', 'a', '-', 't', 'h', 'e',
+	'r', 'a', 'p', 'i', 's', 't', 'i', 's', '-', 'a', 'n', '-', 'a', 'c', 'c', 'o',
+	'u', 'n', 't', 'a', 'n', 't', 'i', 's', '-', 'a', 'n', '-', 'a', 'c', 't', 'o',
+	'r', 'i', 's', '-', 'a', 'n', '-', 'a', 'c', 't', 'r', 'e', 's', 's', 'i', 's',
+	'-', 'a', 'n', '-', 'a', 'n', 'a', 'r', 'c', 'h', 'i', 's', 't', 'i', 's', '-',
+	'a', 'n', '-', 'a', 'r', 't', 'i', 's', 't', 'i', 's', '-', 'a', 'n', '-', 'e',
+	'n', 'g', 'i', 'n', 'e', 'e', 'r', 'i', 's', '-', 'a', 'n', '-', 'e', 'n', 't',
+	'e', 'r', 't', 'a', 'i', 'n', 'e', 'r', 'i', 's', '-', 'c', 'e', 'r', 't', 'i',
+	'f', 'i', 'e', 'd', 'i', 's', '-', 'g', 'o', 'n', 'e', 'i', 's', '-', 'i', 'n',
+	't', 'o', '-', 'a', 'n', 'i', 'm', 'e', 'i', 's', '-', 'i', 'n', 't', 'o', '-',
+	'c', 'a', 'r', 's', 'i', 's', '-', 'i', 'n', 't', 'o', '-', 'c', 'a', 'r', 't',
+	'o', 'o', 'n', 's', 'i', 's', '-', 'i', 'n', 't', 'o', '-', 'g', 'a', 'm', 'e',
+	's', 'i', 's', '-', 'l', 'e', 'e', 't', 'i', 's', '-', 'n', 'o', 't', '-', 'c',
+	'e', 'r', 't', 'i', 'f', 'i', 'e', 'd', 'i', 's', '-', 's', 'l', 'i', 'c', 'k',
+	'i', 's', '-', 'u', 'b', 'e', 'r', 'l', 'e', 'e', 't', 'i', 's', '-', 'w', 'i',
+	't', 'h', '-', 't', 'h', 'e', 'b', 'a', 'n', 'd', 'i', 's', 'a', '-', 'g', 'e',
+	'e', 'k', 'i', 's', 'a', '-', 'h', 'o', 'c', 'k', 'e', 'y', 'n', 'u', 't', 'i',
+	's', 's', 'm', 'a', 'r', 't', 'e', 'r', 't', 'h', 'a', 'n', 'y', 'o', 'u', 'j',
+	'd', 'e', 'v', 'c', 'l', 'o', 'u', 'd', 'j', 'o', 'y', 'e', 'n', 't', 'j', 'p',
+	'n', 'k', 'a', 's', 's', 'e', 'r', 'v', 'e', 'r', 'k', 'i', 'l', 'a', 't', 'i',
+	'r', 'o', 'n', 'k', 'o', 'z', 'o', 'w', 'k', 't', 'i', 's', 't', 'o', 'r', 'y',
+	'l', 'i', 'k', 'e', 's', '-', 'p', 'i', 'e', 'l', 'i', 'k', 'e', 's', 'c', 'a',
+	'n', 'd', 'y', 'l', 'i', 'n', 'o', 'd', 'e', 'l', 'i', 'n', 'o', 'd', 'e', 'o',
+	'b', 'j', 'e', 'c', 't', 's', 'l', 'i', 'n', 'o', 'd', 'e', 'u', 's', 'e', 'r',
+	'c', 'o', 'n', 't', 'e', 'n', 't', 'l', 'm', 'p', 'm', 'l', 'o', 'g', 'o', 'i',
+	'p', 'l', 'o', 's', 'e', 'y', 'o', 'u', 'r', 'i', 'p', 'l', 'p', 'u', 's', 'e',
+	'r', 'c', 'o', 'n', 't', 'e', 'n', 't', 'm', 'a', 's', 's', 'i', 'v', 'e', 'g',
+	'r', 'i', 'd', 'm', 'a', 'z', 'e', 'p', 'l', 'a', 'y', 'm', 'e', 's', 's', 'w',
+	'i', 't', 'h', 'd', 'n', 's', 'm', 'e', 't', 'e', 'o', 'r', 'a', 'p', 'p', 'm',
+	'i', 'n', 'i', 's', 'e', 'r', 'v', 'e', 'r', 'm', 'y', 'a', 'c', 't', 'i', 'v',
+	'e', 'd', 'i', 'r', 'e', 'c', 't', 'o', 'r', 'y', 'm', 'y', 'a', 's', 'u', 's',
+	't', 'o', 'r', 'm', 'y', 'd', 'a', 't', 't', 'o', 'm', 'y', 'd', 'o', 'b', 'i',
+	's', 's', 'm', 'y', 'd', 'r', 'o', 'b', 'o', 'm', 'y', 'i', 'p', 'h', 'o', 's',
+	't', 'm', 'y', 's', 'e', 'c', 'u', 'r', 'i', 't', 'y', 'c', 'a', 'm', 'e', 'r',
+	'a', 'm', 'y', 's', 'h', 'o', 'p', 'b', 'l', 'o', 'c', 'k', 's', 'm', 'y', 's',
+	'h', 'o', 'p', 'i', 'f', 'y', 'm', 'y', 't', 'a', 'b', 'i', 't', 'm', 'y', 't',
+	'h', 'i', 'c', '-', 'b', 'e', 'a', 's', 't', 's', 'm', 'y', 't', 'u', 'l', 'e',
+	'a', 'p', 'm', 'y', 'v', 'n', 'c', 'n', 'e', 'a', 't', '-', 'u', 'r', 'l', 'n',
+	'e', 't', '-', 'f', 'r', 'e', 'a', 'k', 's', 'n', 'f', 's', 'h', 'o', 's', 't',
+	'n', 'o', 's', 'p', 'a', 'm', 'p', 'r', 'o', 'x', 'y', 'o', 'b', 's', 'e', 'r',
+	'v', 'a', 'b', 'l', 'e', 'u', 's', 'e', 'r', 'c', 'o', 'n', 't', 'e', 'n', 't',
+	'o', 'n', '-', 'a', 'p', 't', 'i', 'b', 'l', 'e', 'o', 'n', 'f', 'a', 'b', 'r',
+	'i', 'c', 'a', 'o', 'n', 'r', 'e', 'n', 'd', 'e', 'r', 'o', 'n', 't', 'h', 'e',
+	'w', 'i', 'f', 'i', 'o', 'o', 'g', 'u', 'y', 'o', 'p', 'e', 'r', 'a', 'u', 'n',
+	'i', 't', 'e', 'o', 'r', 's', 'i', 't', 'e', 's', 'o', 'u', 't', 's', 'y', 's',
+	't', 'e', 'm', 's', 'c', 'l', 'o', 'u', 'd', 'o', 'w', 'n', 'p', 'r', 'o', 'v',
+	'i', 'd', 'e', 'r', 'p', 'a', 'g', 'e', 'f', 'r', 'o', 'n', 't', 'a', 'p', 'p',
+	'p', 'a', 'g', 'e', 's', 'p', 'e', 'e', 'd', 'm', 'o', 'b', 'i', 'l', 'i', 'z',
+	'e', 'r', 'p', 'a', 'g', 'e', 'x', 'l', 'p', 'a', 'y', 'w', 'h', 'i', 'r', 'l',
+	'p', 'g', 'f', 'o', 'g', 'p', 'i', 'x', 'o', 'l', 'i', 'n', 'o', 'p', 'l', 'a',
+	't', 't', 'e', 'r', '-', 'a', 'p', 'p', 'p', 'l', 'a', 'y', 's', 't', 'a', 't',
+	'i', 'o', 'n', '-', 'c', 'l', 'o', 'u', 'd', 'p', 'l', 'e', 's', 'k', 'n', 's',
+	'p', 'o', 'i', 'n', 't', '2', 't', 'h', 'i', 's', 'p', 'o', 's', 't', 'm', 'a',
+	'n', '-', 'e', 'c', 'h', 'o', 'p', 'r', 'g', 'm', 'r', 'p', 'u', 'b', 'l', 'i',
+	's', 'h', 'p', 'r', 'o', 'x', 'y', 'p', 'y', 't', 'h', 'o', 'n', 'a', 'n', 'y',
+	'w', 'h', 'e', 'r', 'e', 'q', 'a', '2', 'q', 'b', 'u', 's', 'e', 'r', 'q', 'u',
+	'a', 'l', 'i', 'f', 'i', 'o', 'a', 'p', 'p', 'q', 'u', 'i', 'c', 'k', 's', 'y',
+	't', 'e', 's', 'q', 'u', 'i', 'p', 'e', 'l', 'e', 'm', 'e', 'n', 't', 's', 'r',
+	'a', 'c', 'k', 'm', 'a', 'z', 'e', 'r', 'e', 'm', 'o', 't', 'e', 'w', 'd', 'r',
+	'e', 's', 'e', 'r', 'v', 'd', 'r', 'e', 's', 'e', 'r', 'v', 'e', '-', 'o', 'n',
+	'l', 'i', 'n', 'e', 'r', 'h', 'c', 'l', 'o', 'u', 'd', 's', 'a', 'v', 'e', 's',
+	'-', 't', 'h', 'e', '-', 'w', 'h', 'a', 'l', 'e', 's', 's', 'c', 'r', 'y', 's',
+	'e', 'c', 's', 'e', 'c', 'u', 'r', 'i', 't', 'y', 't', 'a', 'c', 't', 'i', 'c',
+	's', 's', 'e', 'l', 'l', 's', '-', 'f', 'o', 'r', '-', 'l', 'e', 's', 's', 's',
+	'e', 'l', 'l', 's', '-', 'f', 'o', 'r', '-', 'u', 's', 'e', 'r', 'v', 'e', 'b',
+	'b', 's', 's', 'e', 'r', 'v', 'e', 'b', 'e', 'e', 'r', 's', 'e', 'r', 'v', 'e',
+	'c', 'o', 'u', 'n', 't', 'e', 'r', 's', 't', 'r', 'i', 'k', 'e', 's', 'e', 'r',
+	'v', 'e', 'e', 'x', 'c', 'h', 'a', 'n', 'g', 'e', 's', 'e', 'r', 'v', 'e', 'f',
+	't', 'p', 's', 'e', 'r', 'v', 'e', 'g', 'a', 'm', 'e', 's', 'e', 'r', 'v', 'e',
+	'h', 'a', 'l', 'f', 'l', 'i', 'f', 'e', 's', 'e', 'r', 'v', 'e', 'h', 't', 't',
+	'p', 's', 'e', 'r', 'v', 'e', 'h', 'u', 'm', 'o', 'u', 'r', 's', 'e', 'r', 'v',
+	'e', 'i', 'r', 'c', 's', 'e', 'r', 'v', 'e', 'm', 'p', '3', 's', 'e', 'r', 'v',
+	'e', 'p', '2', 'p', 's', 'e', 'r', 'v', 'e', 'p', 'i', 'c', 's', 's', 'e', 'r',
+	'v', 'e', 'q', 'u', 'a', 'k', 'e', 's', 'e', 'r', 'v', 'e', 's', 'a', 'r', 'c',
+	'a', 's', 'm', 's', 'h', 'o', 'p', 'i', 't', 's', 'i', 't', 'e', 's', 'i', 'i',
+	'i', 't', 'e', 's', 's', 'i', 'm', 'p', 'l', 'e', '-', 'u', 'r', 'l', 's', 'i',
+	'm', 'p', 'l', 'e', 's', 'i', 't', 'e', 's', 'i', 'n', 'a', 'a', 'p', 'p', 's',
+	'k', 'y', 'g', 'e', 'a', 'r', 'a', 'p', 'p', 's', 'm', 'u', 's', 'h', 'c', 'd',
+	'n', 's', 'p', 'a', 'c', 'e', '-', 't', 'o', '-', 'r', 'e', 'n', 't', 's', 't',
+	'a', 'c', 'k', 'h', 'e', 'r', 'o', '-', 'n', 'e', 't', 'w', 'o', 'r', 'k', 's',
+	't', 'd', 'l', 'i', 'b', 's', 't', 'r', 'e', 'a', 'm', 'l', 'i', 't', 'a', 'p',
+	'p', 's', 't', 'u', 'f', 'f', 't', 'o', 'r', 'e', 'a', 'd', 't', 'b', '-', 'h',
+	'o', 's', 't', 'i', 'n', 'g', 't', 'e', 'a', 'c', 'h', 'e', 's', '-', 'y', 'o',
+	'g', 'a', 't', 'e', 'm', 'p', '-', 'd', 'n', 's', 't', 'h', 'e', 'w', 'o', 'r',
+	'k', 'p', 'c', 't', 'h', 'i', 'n', 'g', 'd', 'u', 's', 't', 'd', 'a', 't', 'a',
+	't', 'o', 'w', 'n', 'n', 'e', 'w', 's', '-', 's', 't', 'a', 'g', 'i', 'n', 'g',
+	't', 'r', 'y', '-', 's', 'n', 'o', 'w', 'p', 'l', 'o', 'w', 't', 'r', 'y', 'c',
+	'l', 'o', 'u', 'd', 'f', 'l', 'a', 'r', 'e', 't', 'u', 'l', 'e', 'a', 'p', '-',
+	'p', 'a', 'r', 't', 'n', 'e', 'r', 's', 't', 'y', 'p', 'e', 'f', 'o', 'r', 'm',
+	'u', 'n', 'u', 's', 'u', 'a', 'l', 'p', 'e', 'r', 's', 'o', 'n', 'v', 'i', 'p',
+	's', 'i', 'n', 'a', 'a', 'p', 'p', 'v', 'u', 'l', 't', 'r', 'o', 'b', 'j', 'e',
+	'c', 't', 's', 'w', 'a', 'f', 'a', 'i', 'c', 'l', 'o', 'u', 'd', 'w', 'a', 'f',
+	'f', 'l', 'e', 'c', 'e', 'l', 'l', 'w', 'i', 'a', 'r', 'd', 'w', 'e', 'b', 'w',
+	'i', 't', 'h', 'g', 'o', 'o', 'g', 'l', 'e', 'w', 'i', 't', 'h', 'y', 'o', 'u',
+	't', 'u', 'b', 'e', 'w', 'i', 'x', 's', 'i', 't', 'e', 'w', 'o', 'l', 't', 'l',
+	'a', 'b', '-', 'd', 'e', 'm', 'o', 'w', 'o', 'r', 'k', 'i', 's', 'b', 'o', 'r',
+	'i', 'n', 'g', 'w', 'p', 'd', 'e', 'v', 'c', 'l', 'o', 'u', 'd', 'w', 'p', 'e',
+	'n', 'g', 'i', 'n', 'e', 'p', 'o', 'w', 'e', 'r', 'e', 'd', 'w', 'p', 'h', 'o',
+	's', 't', 'e', 'd', 'm', 'a', 'i', 'l', 'w', 'p', 'm', 'u', 'c', 'd', 'n', 'w',
+	'r', 'i', 't', 'e', 's', 't', 'h', 'i', 's', 'b', 'l', 'o', 'g', 'x', 'n', 'b',
+	'a', 'y', 'y', 'o', 'l', 'a', 's', 'i', 't', 'e', 'm', 'y', 'f', 'o', 'r', 'u',
+	'm', 'n', 'o', 'g', 'n', 'o', 'm', 'e', 'e', 'k', 'l', 'o', 'g', 'e', 's', 'm',
+	'e', 't', 'a', 'c', 'e', 'n', 't', 'r', 'u', 'm', 'r', 'e', 'a', 'l', 'm', 'c',
+	'o', 'm', 'm', 'u', 'n', 'i', 't', 'y', '-', 'p', 'r', 'o', 'c', 'o', 's', 'i',
+	'd', 'n', 's', 'd', 'd', '-', 'd', 'n', 's', 'd', 'd', 'n', 's', 's', 'd', 'i',
+	's', 'k', 'u', 's', 's', 'i', 'o', 'n', 's', 'b', 'e', 'r', 'e', 'i', 'c', 'h',
+	'd', 'n', 's', 'h', 'o', 'm', 'e', 'd', 'n', 's', 'u', 'p', 'd', 'a', 't', 'e',
+	'r', 'd', 'r', 'a', 'y', '-', 'd', 'n', 's', 'd', 'r', 'a', 'y', 'd', 'n', 's',
+	'd', 'y', 'n', '-', 'b', 'e', 'r', 'l', 'i', 'n', 'd', 'y', 'n', '-', 'i', 'p',
+	'2', '4', 'd', 'y', 'n', '-', 'v', 'p', 'n', 'd', 'y', 'n', 'a', 'm', 'i', 's',
+	'c', 'h', 'e', 's', '-', 'd', 'n', 's', 'd', 'y', 'n', 'd', 'n', 's', '1', 'd',
+	'y', 'n', 'v', 'p', 'n', 'f', 'r', 'u', 's', 'k', 'y', 'f', 'u', 'e', 't', 't',
+	'e', 'r', 't', 'd', 'a', 's', 'n', 'e', 't', 'z', 'g', 'i', 't', '-', 'r', 'e',
+	'p', 'o', 's', 'h', 'o', 'm', 'e', '-', 'w', 'e', 'b', 's', 'e', 'r', 'v', 'e',
+	'r', 'h', 's', '-', 'h', 'e', 'i', 'l', 'b', 'r', 'o', 'n', 'n', 'i', 'n', '-',
+	'b', 'e', 'r', 'l', 'i', 'n', 'i', 'n', '-', 'b', 'r', 'b', 'i', 'n', '-', 'b',
+	'u', 't', 't', 'e', 'r', 'i', 'n', '-', 'd', 's', 'l', 'i', 'n', '-', 'v', 'p',
+	'n', 'i', 'n', 't', 'e', 'r', 'n', 'e', 't', '-', 'd', 'n', 's', 'i', 's', 'e',
+	'r', 'v', 's', 'c', 'h', 'u', 'l', 'e', 'i', 's', 't', 'e', 'i', 'n', 'g', 'e',
+	'e', 'k', 'i', 's', 't', 'm', 'e', 'i', 'n', 'k', 'e', 'y', 'm', 'a', 'c', 'h',
+	'i', 'n', 'e', 'l', '-', 'o', '-', 'g', '-', 'i', '-', 'n', 'l', 'c', 'u', 'b',
+	'e', '-', 's', 'e', 'r', 'v', 'e', 'r', 'l', 'e', 'b', 't', 'i', 'm', 'n', 'e',
+	't', 'z', 'l', 'e', 'i', 't', 'u', 'n', 'g', 's', 'e', 'n', 'm', 'e', 'i', 'n',
+	'-', 'i', 's', 'e', 'r', 'v', 'm', 'e', 'i', 'n', '-', 'v', 'i', 'g', 'o', 'r',
+	'm', 'y', '-', 'g', 'a', 't', 'e', 'w', 'a', 'y', 'm', 'y', '-', 'r', 'o', 'u',
+	't', 'e', 'r', 'm', 'y', '-', 'v', 'i', 'g', 'o', 'r', 'm', 'y', '-', 'w', 'a',
+	'n', 'm', 'y', 'h', 'o', 'm', 'e', '-', 's', 'e', 'r', 'v', 'e', 'r', 's', 'c',
+	'h', 'u', 'l', 'p', 'l', 'a', 't', 't', 'f', 'o', 'r', 'm', 's', 'c', 'h', 'u',
+	'l', 's', 'e', 'r', 'v', 'e', 'r', 's', 'p', 'd', 'n', 's', 's', 'p', 'e', 'e',
+	'd', 'p', 'a', 'r', 't', 'n', 'e', 'r', 's', 'v', 'n', '-', 'r', 'e', 'p', 'o',
+	's', 's', 'y', 'n', 'o', '-', 'd', 's', 's', 'y', 'n', 'o', 'l', 'o', 'g', 'y',
+	'-', 'd', 'i', 's', 'k', 's', 't', 'a', 't', 'i', 'o', 'n', 's', 'y', 'n', 'o',
+	'l', 'o', 'g', 'y', '-', 'd', 's', 't', 'a', 'i', 'f', 'u', 'n', '-', 'd', 'n',
+	's', 't', 'e', 's', 't', '-', 'i', 's', 'e', 'r', 'v', 't', 'r', 'a', 'e', 'u',
+	'm', 't', 'g', 'e', 'r', 'a', 'd', 'e', 'u', 'b', 'e', 'r', 's', 'p', 'a', 'c',
+	'e', 'v', 'i', 'r', 't', 'u', 'a', 'l', '-', 'u', 's', 'e', 'r', 'v', 'i', 'r',
+	't', 'u', 'a', 'l', 'u', 's', 'e', 'r', 'x', 'n', '-', '-', 'g', 'n', 's', 't',
+	'i', 'g', 'b', 'e', 's', 't', 'e', 'l', 'l', 'e', 'n', '-', 'z', 'v', 'b', 'x',
+	'n', '-', '-', 'g', 'n', 's', 't', 'i', 'g', 'l', 'i', 'e', 'f', 'e', 'r', 'n',
+	'-', 'w', 'o', 'b', 'a', 'u', 't', 'o', 'c', 'o', 'd', 'e', 'c', 'u', 'r', 'v',
+	'd', 'e', 'n', 'o', 'd', 'e', 'n', 'o', '-', 's', 't', 'a', 'g', 'i', 'n', 'g',
+	'g', 'i', 't', 'h', 'u', 'b', 'p', 'r', 'e', 'v', 'i', 'e', 'w', 'l', 'c', 'l',
+	'l', 'c', 'l', 's', 't', 'a', 'g', 'e', 'l', 'o', 'c', 'a', 'l', 'c', 'e', 'r',
+	't', 'r', '2', 's', 'h', 'i', 'f', 't', 'c', 'r', 'y', 'p', 't', 'o', 's', 't',
+	'g', 's', 't', 'a', 'g', 'e', 'w', 'e', 'b', 'h', 'a', 'r', 'e', 'w', 'o', 'r',
+	'k', 'e', 'r', 's', 'c', 'l', 'o', 'u', 'd', 'a', 'p', 'p', 's', '1', '2', '3',
+	'h', 'j', 'e', 'm', 'm', 'e', 's', 'i', 'd', 'e', 's', 'l', 'd', 'k', '1', '2',
+	'r', 'i', 'i', 'k', '1', '2', '3', 'm', 'i', 'w', 'e', 'b', 'd', 'o', 'g', 'a',
+	'd', 'o', 'm', 'y', 'c', 'd', 'w', 'e', 'l', 'l', 'b', 'e', 'i', 'n', 'g', 'z',
+	'o', 'n', 'e', 'k', 'o', 'o', 'b', 'i', 'n', 'y', 'b', 'o', 's', 't', 'o', 'r',
+	'j', '1', '2', '3', 'k', 'o', 't', 'i', 's', 'i', 'v', 'u', 'c', 'l', 'o', 'u',
+	'd', 'p', 'l', 'a', 't', 'f', 'o', 'r', 'm', 'd', 'a', 't', 'a', 'c', 'e', 'n',
+	't', 'e', 'r', 'k', 'a', 'p', 's', 'i', 'x', 'n', '-', '-', 'h', 'k', 'k', 'i',
+	'n', 'e', 'n', '-', '5', 'w', 'a', '1', '2', '3', 's', 'i', 't', 'e', 'w', 'e',
+	'b', 'a', 'e', 'r', 'o', 'p', 'o', 'r', 't', 'a', 'v', 'o', 'u', 'e', 's', 'c',
+	'h', 'a', 'm', 'b', 'a', 'g', 'r', 'i', 'c', 'h', 'i', 'r', 'u', 'r', 'g', 'i',
+	'e', 'n', 's', '-', 'd', 'e', 'n', 't', 'i', 's', 't', 'e', 's', 'c', 'h', 'i',
+	'r', 'u', 'r', 'g', 'i', 'e', 'n', 's', '-', 'd', 'e', 'n', 't', 'i', 's', 't',
+	'e', 's', '-', 'e', 'n', '-', 'f', 'r', 'a', 'n', 'c', 'e', 'd', 'e', 'd', 'i',
+	'b', 'o', 'x', 'e', 'n', '-', 'r', 'o', 'o', 't', 'e', 'x', 'p', 'e', 'r', 't',
+	's', '-', 'c', 'o', 'm', 'p', 't', 'a', 'b', 'l', 'e', 's', 'f', 'b', 'x', '-',
+	'o', 's', 'f', 'b', 'x', 'o', 's', 'g', 'e', 'o', 'm', 'e', 't', 'r', 'e', '-',
+	'e', 'x', 'p', 'e', 'r', 't', 'g', 'o', 'u', 'p', 'i', 'l', 'e', 'g', 'r', 'e',
+	't', 'a', 'h', 'u', 'i', 's', 's', 'i', 'e', 'r', '-', 'j', 'u', 's', 't', 'i',
+	'c', 'e', 'm', 'e', 'd', 'e', 'c', 'i', 'n', 'n', 'o', 't', 'a', 'i', 'r', 'e',
+	's', 'o', 'n', '-', 'w', 'e', 'b', 'p', 'h', 'a', 'r', 'm', 'a', 'c', 'i', 'e',
+	'n', 'p', 'r', 'd', 'v', 'e', 't', 'e', 'r', 'i', 'n', 'a', 'i', 'r', 'e', 'y',
+	'n', 'h', 'c', 'n', 'p', 'y', 'p', 'v', 't', 'k', 'a', 'a', 's', 't', 'r', 'a',
+	'n', 's', 'l', 'a', 't', 'e', 'd', 'i', 's', 'c', 'o', 'u', 'r', 's', 'e', 'g',
+	'u', 'a', 'm', 'h', 'r', 'a', 'i', 'd', 'v', 's', 'e', 'c', 'a', 'a', 's', 'x',
+	'n', '-', '-', 'c', 'i', 'q', 'p', 'n', 'x', 'n', '-', '-', 'g', 'm', 'q', '0',
+	'5', '0', 'i', 'x', 'n', '-', '-', 'g', 'm', 'q', 'w', '5', 'a', 'x', 'n', '-',
+	'-', 'l', 'c', 'v', 'r', '3', '2', 'd', 'x', 'n', '-', '-', 'm', 'k', '0', 'a',
+	'x', 'i', 'x', 'n', '-', '-', 'o', 'd', '0', 'a', 'q', '3', 'b', 'x', 'n', '-',
+	'-', 't', 'n', '0', 'a', 'g', 'x', 'n', '-', '-', 'u', 'c', '0', 'a', 't', 'v',
+	'x', 'n', '-', '-', 'u', 'c', '0', 'a', 'y', '4', 'a', 'x', 'n', '-', '-', 'w',
+	'c', 'v', 's', '2', '2', 'd', 'x', 'n', '-', '-', 'z', 'f', '0', 'a', 'v', 'x',
+	'c', 'l', 'o', 'u', 'd', 'a', 'c', 'c', 'e', 's', 's', 'f', 'r', 'e', 'e', 's',
+	'i', 't', 'e', 'm', 'i', 'r', 'c', 'l', 'o', 'u', 'd', 'm', 'y', 'f', 'a', 's',
+	't', 't', 'e', 'm', 'p', 'u', 'r', 'l', 'w', 'p', 'm', 'u', 'd', 'e', 'v', 'o',
+	'p', 'e', 'n', 'c', 'r', 'a', 'f', 't', '2', '0', '0', '0', 'a', 'g', 'r', 'a',
+	'r', 'b', 'o', 'l', 't', 'e', 'r', 'o', 't', 'i', 'c', 'a', 'e', 'r', 'o', 't',
+	'i', 'k', 'a', 'i', 'n', 'g', 'a', 't', 'l', 'a', 'n', 'j', 'o', 'g', 'a', 's',
+	'z', 'k', 'o', 'n', 'y', 'v', 'e', 'l', 'o', 'l', 'a', 'k', 'a', 's', 'r', 'e',
+	'k', 'l', 'a', 'm', 's', 'u', 'l', 'i', 's', 'z', 'e', 'x', 't', 'o', 'z', 's',
+	'd', 'e', 'u', 't', 'a', 'z', 'a', 's', 'd', 'e', 's', 'a', 'f', 'l', 'a', 'p',
+	'f', 'o', 'r', 't', 'e', 'p', 'o', 'n', 'p', 'e', 's', 'b', 'i', 'h', 'a', 'r',
+	'd', 'e', 'l', 'h', 'i', 'g', 'u', 'j', 'a', 'r', 'a', 't', 'b', 'a', 'r', 'r',
+	'e', 'l', '-', 'o', 'f', '-', 'k', 'n', 'o', 'w', 'l', 'e', 'd', 'g', 'e', 'b',
+	'a', 'r', 'r', 'e', 'l', 'l', '-', 'o', 'f', '-', 'k', 'n', 'o', 'w', 'l', 'e',
+	'd', 'g', 'e', 'd', 'v', 'r', 'c', 'a', 'm', 'd', 'y', 'n', 'a', 'm', 'i', 'c',
+	'-', 'd', 'n', 's', 'f', 'o', 'r', '-', 'o', 'u', 'r', 'f', 'o', 'r', 'u', 'm',
+	'z', 'g', 'r', 'o', 'k', 's', '-', 't', 'h', 'e', 'g', 'r', 'o', 'k', 's', '-',
+	't', 'h', 'i', 's', 'h', 'e', 'r', 'e', '-', 'f', 'o', 'r', '-', 'm', 'o', 'r',
+	'e', 'i', 'l', 'o', 'v', 'e', 'c', 'o', 'l', 'l', 'e', 'g', 'e', 'k', 'n', 'o',
+	'w', 's', 'i', 't', 'a', 'l', 'l', 'm', 'a', 'y', 'f', 'i', 'r', 's', 't', 'v',
+	'-', 'i', 'n', 'f', 'o', '2', '0', '3', '8', 'a', 'p', 'i', 'g', 'e', 'e', 'a',
+	'z', 'u', 'r', 'e', 'c', 'o', 'n', 't', 'a', 'i', 'n', 'e', 'r', 'b', '-', 'd',
+	'a', 't', 'a', 'b', 'a', 'c', 'k', 'p', 'l', 'a', 'n', 'e', 'a', 'p', 'p', 'b',
+	'a', 'n', 'z', 'a', 'i', 'c', 'l', 'o', 'u', 'd', 'b', 'a', 's', 'i', 'c', 's',
+	'e', 'r', 'v', 'e', 'r', 'b', 'e', 'a', 'g', 'l', 'e', 'b', 'o', 'a', 'r', 'd',
+	'b', 'e', 'e', 'b', 'y', 't', 'e', 'b', 'e', 'e', 'b', 'y', 't', 'e', 'a', 'p',
+	'p', 'b', 'i', 'g', 'v', 'b', 'i', 't', 'b', 'u', 'c', 'k', 'e', 't', 'b', 'l',
+	'u', 'e', 'b', 'i', 't', 'e', 'b', 'o', 'x', 'f', 'u', 's', 'e', 'b', 'r', 'o',
+	'w', 's', 'e', 'r', 's', 'a', 'f', 'e', 't', 'y', 'm', 'a', 'r', 'k', 'c', 'l',
+	'e', 'v', 'e', 'r', 'a', 'p', 'p', 's', 'd', 'a', 'p', 'p', 'n', 'o', 'd', 'e',
+	'd', 'e', 'd', 'y', 'n', 'd', 'e', 'f', 'i', 'n', 'i', 'm', 'a', 'd', 'r', 'u',
+	'd', 'd', 'y', 'n', '5', '3', 'e', 'd', 'i', 't', 'o', 'r', 'x', 'e', 'd', 'u',
+	'g', 'i', 't', 'f', 'h', '-', 'm', 'u', 'e', 'n', 's', 't', 'e', 'r', 'f', 'o',
+	'r', 'g', 'e', 'r', 'o', 'c', 'k', 'g', 'h', 'o', 's', 't', 'g', 'i', 't', 'l',
+	'a', 'b', 'h', 'a', 's', 'u', 'r', 'a', '-', 'a', 'p', 'p', 'h', 'o', 's', 't',
+	'y', 'h', 'o', 's', 't', 'i', 'n', 'g', 'h', 'z', 'c', 'l', 'o', 'l', 'i', 'p',
+	'o', 'p', 'm', 'o', '-', 's', 'i', 'e', 'm', 'e', 'n', 's', 'm', 'o', 'o', 'n',
+	's', 'c', 'a', 'l', 'e', 'n', 'g', 'r', 'o', 'k', 'n', 'i', 'd', 'n', 'o', 'd',
+	'e', 'a', 'r', 't', 'o', 'n', '-', 'a', 'c', 'o', 'r', 'n', 'o', 'n', '-', 'k',
+	'3', 's', 'o', 'n', '-', 'r', 'i', 'o', 'p', 'a', 'n', 't', 'h', 'e', 'o', 'n',
+	's', 'i', 't', 'e', 'p', 'r', 'o', 't', 'o', 'n', 'e', 't', 'p', 's', 't', 'm',
+	'n', 'q', 'c', 'x', 'q', 'o', 't', 'o', 'r', 'e', 'a', 'd', 't', 'h', 'e', 'd',
+	'o', 'c', 's', 'r', 'e', 's', 'i', 'n', 'd', 'e', 'v', 'i', 'c', 'e', 'r', 'e',
+	's', 'i', 'n', 's', 't', 'a', 'g', 'i', 'n', 'g', 's', '5', 'y', 's', 'a', 'n',
+	'd', 'c', 'a', 't', 's', 's', 'h', 'i', 'f', 't', 'e', 'd', 'i', 't', 's', 'h',
+	'w', 's', 'p', 'a', 'c', 'e', 'k', 'i', 't', 's', 't', 'o', 'l', 'o', 's', 'u',
+	'n', 'i', 's', 'p', 'a', 'c', 'e', 'u', 'p', 'l', 'i', 'u', 't', 'w', 'e', 'n',
+	't', 'e', 'v', 'a', 'p', 'o', 'r', 'c', 'l', 'o', 'u', 'd', 'v', 'b', 'r', 'p',
+	'l', 's', 'b', 'x', 'v', 'i', 'r', 't', 'u', 'a', 'l', 's', 'e', 'r', 'v', 'e',
+	'r', 'w', 'e', 'b', 't', 'h', 'i', 'n', 'g', 's', 'w', 'e', 'd', 'e', 'p', 'l',
+	'o', 'y', 'c', 'u', 'p', 'c', 'a', 'k', 'e', '1', '2', '3', 'h', 'o', 'm', 'e',
+	'p', 'a', 'g', 'e', '1', '6', '-', 'b', '3', '2', '-', 'b', '6', '4', '-', 'b',
+	'a', 'b', 'r', 'u', 'z', 'z', 'o', 'a', 'g', 'r', 'i', 'g', 'e', 'n', 't', 'o',
+	'a', 'l', 'e', 's', 's', 'a', 'n', 'd', 'r', 'i', 'a', 'a', 'l', 't', 'o', '-',
+	'a', 'd', 'i', 'g', 'e', 'a', 'l', 't', 'o', 'a', 'd', 'i', 'g', 'e', 'a', 'n',
+	'c', 'o', 'n', 'a', 'a', 'n', 'd', 'r', 'i', 'a', '-', 'b', 'a', 'r', 'l', 'e',
+	't', 't', 'a', '-', 't', 'r', 'a', 'n', 'i', 'a', 'n', 'd', 'r', 'i', 'a', '-',
+	't', 'r', 'a', 'n', 'i', '-', 'b', 'a', 'r', 'l', 'e', 't', 't', 'a', 'a', 'n',
+	'd', 'r', 'i', 'a', 'b', 'a', 'r', 'l', 'e', 't', 't', 'a', 't', 'r', 'a', 'n',
+	'i', 'a', 'n', 'd', 'r', 'i', 'a', 't', 'r', 'a', 'n', 'i', 'b', 'a', 'r', 'l',
+	'e', 't', 't', 'a', 'a', 'o', 's', 't', 'a', 'a', 'o', 's', 't', 'a', '-', 'v',
+	'a', 'l', 'l', 'e', 'y', 'a', 'o', 's', 't', 'a', 'v', 'a', 'l', 'l', 'e', 'y',
+	'a', 'o', 's', 't', 'e', 'a', 'q', 'u', 'i', 'l', 'a', 'a', 'r', 'e', 'z', 'z',
+	'o', 'a', 's', 'c', 'o', 'l', 'i', '-', 'p', 'i', 'c', 'e', 'n', 'o', 'a', 's',
+	'c', 'o', 'l', 'i', 'p', 'i', 'c', 'e', 'n', 'o', 'a', 'v', 'e', 'l', 'l', 'i',
+	'n', 'o', 'b', 'a', 'l', 's', 'a', 'n', 'b', 'a', 'l', 's', 'a', 'n', '-', 's',
+	'u', 'd', 't', 'i', 'r', 'o', 'l', 'b', 'a', 'l', 's', 'a', 'n', '-', 's', 'u',
+	'e', 'd', 't', 'i', 'r', 'o', 'l', 'b', 'a', 'r', 'i', 'b', 'a', 'r', 'l', 'e',
+	't', 't', 'a', '-', 't', 'r', 'a', 'n', 'i', '-', 'a', 'n', 'd', 'r', 'i', 'a',
+	'b', 'a', 's', 'i', 'l', 'i', 'c', 'a', 't', 'a', 'b', 'e', 'l', 'l', 'u', 'n',
+	'o', 'b', 'e', 'n', 'e', 'v', 'e', 'n', 't', 'o', 'b', 'e', 'r', 'g', 'a', 'm',
+	'o', 'b', 'i', 'e', 'l', 'l', 'a', 'b', 'o', 'l', 'o', 'g', 'n', 'a', 'b', 'o',
+	'l', 'z', 'a', 'n', 'o', 'b', 'o', 'l', 'z', 'a', 'n', 'o', '-', 'a', 'l', 't',
+	'o', 'a', 'd', 'i', 'g', 'e', 'b', 'o', 'z', 'e', 'n', 'b', 'o', 'z', 'e', 'n',
+	'-', 's', 'u', 'd', 't', 'i', 'r', 'o', 'l', 'b', 'o', 'z', 'e', 'n', '-', 's',
+	'u', 'e', 'd', 't', 'i', 'r', 'o', 'l', 'b', 'r', 'e', 's', 'c', 'i', 'a', 'b',
+	'r', 'i', 'n', 'd', 'i', 's', 'i', 'b', 'u', 'l', 's', 'a', 'n', 'b', 'u', 'l',
+	's', 'a', 'n', '-', 's', 'u', 'd', 't', 'i', 'r', 'o', 'l', 'b', 'u', 'l', 's',
+	'a', 'n', '-', 's', 'u', 'e', 'd', 't', 'i', 'r', 'o', 'l', 'c', 'a', 'g', 'l',
+	'i', 'a', 'r', 'i', 'c', 'a', 'l', 'a', 'b', 'r', 'i', 'a', 'c', 'a', 'l', 't',
+	'a', 'n', 'i', 's', 's', 'e', 't', 't', 'a', 'c', 'a', 'm', 'p', 'a', 'n', 'i',
+	'a', 'c', 'a', 'm', 'p', 'i', 'd', 'a', 'n', 'o', '-', 'm', 'e', 'd', 'i', 'o',
+	'c', 'a', 'm', 'p', 'i', 'd', 'a', 'n', 'o', 'm', 'e', 'd', 'i', 'o', 'c', 'a',
+	'm', 'p', 'o', 'b', 'a', 's', 's', 'o', 'c', 'a', 'r', 'b', 'o', 'n', 'i', 'a',
+	'-', 'i', 'g', 'l', 'e', 's', 'i', 'a', 's', 'c', 'a', 'r', 'b', 'o', 'n', 'i',
+	'a', 'i', 'g', 'l', 'e', 's', 'i', 'a', 's', 'c', 'a', 'r', 'r', 'a', 'r', 'a',
+	'-', 'm', 'a', 's', 's', 'a', 'c', 'a', 'r', 'r', 'a', 'r', 'a', 'm', 'a', 's',
+	's', 'a', 'c', 'a', 's', 'e', 'r', 't', 'a', 'c', 'a', 't', 'a', 'n', 'i', 'a',
+	'c', 'a', 't', 'a', 'n', 'z', 'a', 'r', 'o', 'c', 'e', 's', 'e', 'n', 'a', '-',
+	'f', 'o', 'r', 'l', 'i', 'c', 'e', 's', 'e', 'n', 'a', 'f', 'o', 'r', 'l', 'i',
+	'c', 'h', 'i', 'e', 't', 'i', 'c', 'o', 'm', 'o', 'c', 'o', 's', 'e', 'n', 'z',
+	'a', 'c', 'r', 'e', 'm', 'o', 'n', 'a', 'c', 'r', 'o', 't', 'o', 'n', 'e', 'c',
+	'u', 'n', 'e', 'o', 'd', 'e', 'l', 'l', '-', 'o', 'g', 'l', 'i', 'a', 's', 't',
+	'r', 'a', 'd', 'e', 'l', 'l', 'o', 'g', 'l', 'i', 'a', 's', 't', 'r', 'a', 'e',
+	'm', 'i', 'l', 'i', 'a', '-', 'r', 'o', 'm', 'a', 'g', 'n', 'a', 'e', 'm', 'i',
+	'l', 'i', 'a', 'r', 'o', 'm', 'a', 'g', 'n', 'a', 'e', 'm', 'r', 'e', 'n', 'n',
+	'a', 'f', 'e', 'r', 'm', 'o', 'f', 'e', 'r', 'r', 'a', 'r', 'a', 'f', 'i', 'r',
+	'e', 'n', 'z', 'e', 'f', 'l', 'o', 'r', 'e', 'n', 'c', 'e', 'f', 'o', 'g', 'g',
+	'i', 'a', 'f', 'o', 'r', 'l', 'i', '-', 'c', 'e', 's', 'e', 'n', 'a', 'f', 'r',
+	'i', 'u', 'l', 'i', '-', 'v', '-', 'g', 'i', 'u', 'l', 'i', 'a', 'f', 'r', 'i',
+	'u', 'l', 'i', '-', 'v', 'e', '-', 'g', 'i', 'u', 'l', 'i', 'a', 'f', 'r', 'i',
+	'u', 'l', 'i', '-', 'v', 'e', 'g', 'i', 'u', 'l', 'i', 'a', 'f', 'r', 'i', 'u',
+	'l', 'i', '-', 'v', 'e', 'n', 'e', 'z', 'i', 'a', '-', 'g', 'i', 'u', 'l', 'i',
+	'a', 'f', 'r', 'i', 'u', 'l', 'i', '-', 'v', 'e', 'n', 'e', 'z', 'i', 'a', 'g',
+	'i', 'u', 'l', 'i', 'a', 'f', 'r', 'i', 'u', 'l', 'i', '-', 'v', 'g', 'i', 'u',
+	'l', 'i', 'a', 'f', 'r', 'i', 'u', 'l', 'i', 'v', '-', 'g', 'i', 'u', 'l', 'i',
+	'a', 'f', 'r', 'i', 'u', 'l', 'i', 'v', 'e', '-', 'g', 'i', 'u', 'l', 'i', 'a',
+	'f', 'r', 'i', 'u', 'l', 'i', 'v', 'e', 'g', 'i', 'u', 'l', 'i', 'a', 'f', 'r',
+	'i', 'u', 'l', 'i', 'v', 'e', 'n', 'e', 'z', 'i', 'a', '-', 'g', 'i', 'u', 'l',
+	'i', 'a', 'f', 'r', 'i', 'u', 'l', 'i', 'v', 'e', 'n', 'e', 'z', 'i', 'a', 'g',
+	'i', 'u', 'l', 'i', 'a', 'f', 'r', 'i', 'u', 'l', 'i', 'v', 'g', 'i', 'u', 'l',
+	'i', 'a', 'f', 'r', 'o', 's', 'i', 'n', 'o', 'n', 'e', 'f', 'v', 'g', 'g', 'e',
+	'n', 'o', 'a', 'g', 'e', 'n', 'o', 'v', 'a', 'g', 'o', 'r', 'i', 'z', 'i', 'a',
+	'g', 'r', 'o', 's', 's', 'e', 't', 'o', 'i', 'b', 'x', 'o', 's', 'i', 'g', 'l',
+	'e', 's', 'i', 'a', 's', '-', 'c', 'a', 'r', 'b', 'o', 'n', 'i', 'a', 'i', 'l',
+	'i', 'a', 'd', 'b', 'o', 'x', 'o', 's', 'i', 'm', 'p', 'e', 'r', 'i', 'a', 'i',
+	's', 'e', 'r', 'n', 'i', 'a', 'l', 'a', '-', 's', 'p', 'e', 'z', 'i', 'a', 'l',
+	'a', 'q', 'u', 'i', 'l', 'a', 'l', 'a', 's', 'p', 'e', 'z', 'i', 'a', 'l', 'a',
+	't', 'i', 'n', 'a', 'l', 'a', 'z', 'l', 'a', 'z', 'i', 'o', 'l', 'e', 'c', 'c',
+	'e', 'l', 'e', 'c', 'c', 'o', 'l', 'i', 'g', 'u', 'r', 'i', 'a', 'l', 'i', 'v',
+	'o', 'r', 'n', 'o', 'l', 'o', 'd', 'i', 'l', 'o', 'm', 'l', 'o', 'm', 'b', 'a',
+	'r', 'd', 'i', 'a', 'l', 'o', 'm', 'b', 'a', 'r', 'd', 'y', 'l', 'u', 'c', 'a',
+	'n', 'i', 'a', 'l', 'u', 'c', 'c', 'a', 'm', 'a', 'c', 'e', 'r', 'a', 't', 'a',
+	'm', 'a', 'n', 't', 'o', 'v', 'a', 'm', 'a', 'r', 'c', 'h', 'e', 'm', 'a', 's',
+	's', 'a', '-', 'c', 'a', 'r', 'r', 'a', 'r', 'a', 'm', 'a', 't', 'e', 'r', 'a',
+	'm', 'e', 'd', 'i', 'o', '-', 'c', 'a', 'm', 'p', 'i', 'd', 'a', 'n', 'o', 'm',
+	'e', 's', 's', 'i', 'n', 'a', 'm', 'i', 'l', 'a', 'n', 'm', 'i', 'l', 'a', 'n',
+	'o', 'm', 'o', 'd', 'e', 'n', 'a', 'm', 'o', 'l', 'i', 's', 'e', 'm', 'o', 'n',
+	'z', 'a', 'm', 'o', 'n', 'z', 'a', '-', 'b', 'r', 'i', 'a', 'n', 'z', 'a', 'm',
+	'o', 'n', 'z', 'a', '-', 'e', '-', 'd', 'e', 'l', 'l', 'a', '-', 'b', 'r', 'i',
+	'a', 'n', 'z', 'a', 'm', 'o', 'n', 'z', 'a', 'b', 'r', 'i', 'a', 'n', 'z', 'a',
+	'm', 'o', 'n', 'z', 'a', 'e', 'b', 'r', 'i', 'a', 'n', 'z', 'a', 'm', 'o', 'n',
+	'z', 'a', 'e', 'd', 'e', 'l', 'l', 'a', 'b', 'r', 'i', 'a', 'n', 'z', 'a', 'n',
+	'a', 'p', 'l', 'e', 's', 'n', 'a', 'p', 'o', 'l', 'i', 'n', 'e', 'e', 'n', 'n',
+	'o', 'v', 'a', 'r', 'a', 'n', 'u', 'o', 'r', 'o', 'o', 'l', 'b', 'i', 'a', '-',
+	't', 'e', 'm', 'p', 'i', 'o', 'o', 'l', 'b', 'i', 'a', 't', 'e', 'm', 'p', 'i',
+	'o', 'o', 'r', 'i', 's', 't', 'a', 'n', 'o', 'p', 'a', 'd', 'o', 'v', 'a', 'p',
+	'a', 'd', 'u', 'a', 'p', 'a', 'l', 'e', 'r', 'm', 'o', 'p', 'a', 'r', 'm', 'a',
+	'p', 'a', 'v', 'i', 'a', 'p', 'e', 'r', 'u', 'g', 'i', 'a', 'p', 'e', 's', 'a',
+	'r', 'o', '-', 'u', 'r', 'b', 'i', 'n', 'o', 'p', 'e', 's', 'a', 'r', 'o', 'u',
+	'r', 'b', 'i', 'n', 'o', 'p', 'e', 's', 'c', 'a', 'r', 'a', 'p', 'i', 'a', 'c',
+	'e', 'n', 'z', 'a', 'p', 'i', 'e', 'd', 'm', 'o', 'n', 't', 'p', 'i', 'e', 'm',
+	'o', 'n', 't', 'e', 'p', 'i', 's', 'a', 'p', 'i', 's', 't', 'o', 'i', 'a', 'p',
+	'm', 'n', 'p', 'o', 'r', 'd', 'e', 'n', 'o', 'n', 'e', 'p', 'o', 't', 'e', 'n',
+	'z', 'a', 'p', 'r', 'a', 't', 'o', 'p', 'u', 'g', 'p', 'u', 'g', 'l', 'i', 'a',
+	'r', 'a', 'g', 'u', 's', 'a', 'r', 'a', 'v', 'e', 'n', 'n', 'a', 'r', 'e', 'g',
+	'g', 'i', 'o', '-', 'c', 'a', 'l', 'a', 'b', 'r', 'i', 'a', 'r', 'e', 'g', 'g',
+	'i', 'o', '-', 'e', 'm', 'i', 'l', 'i', 'a', 'r', 'e', 'g', 'g', 'i', 'o', 'c',
+	'a', 'l', 'a', 'b', 'r', 'i', 'a', 'r', 'e', 'g', 'g', 'i', 'o', 'e', 'm', 'i',
+	'l', 'i', 'a', 'r', 'i', 'e', 't', 'i', 'r', 'i', 'm', 'i', 'n', 'i', 'r', 'o',
+	'v', 'i', 'g', 'o', 's', 'a', 'l', 'e', 'r', 'n', 'o', 's', 'a', 'r', 'd', 'e',
+	'g', 'n', 'a', 's', 'a', 'r', 'd', 'i', 'n', 'i', 'a', 's', 'a', 's', 's', 'a',
+	'r', 'i', 's', 'a', 'v', 'o', 'n', 'a', 's', 'i', 'c', 'i', 'l', 'i', 'a', 's',
+	'i', 'c', 'i', 'l', 'y', 's', 'i', 'e', 'n', 'a', 's', 'i', 'r', 'a', 'c', 'u',
+	's', 'a', 's', 'o', 'n', 'd', 'r', 'i', 'o', 's', 'y', 'n', 'c', 'l', 'o', 'u',
+	'd', 't', 'a', 'r', 'a', 'n', 't', 'o', 't', 'e', 'm', 'p', 'i', 'o', '-', 'o',
+	'l', 'b', 'i', 'a', 't', 'e', 'r', 'a', 'm', 'o', 't', 'e', 'r', 'n', 'i', 't',
+	'o', 'r', 'i', 'n', 'o', 't', 'o', 's', 'c', 'a', 'n', 'a', 't', 'r', 'a', 'n',
+	'i', '-', 'a', 'n', 'd', 'r', 'i', 'a', '-', 'b', 'a', 'r', 'l', 'e', 't', 't',
+	'a', 't', 'r', 'a', 'n', 'i', '-', 'b', 'a', 'r', 'l', 'e', 't', 't', 'a', '-',
+	'a', 'n', 'd', 'r', 'i', 'a', 't', 'r', 'a', 'n', 'i', 'a', 'n', 'd', 'r', 'i',
+	'a', 'b', 'a', 'r', 'l', 'e', 't', 't', 'a', 't', 'r', 'a', 'n', 'i', 'b', 'a',
+	'r', 'l', 'e', 't', 't', 'a', 'a', 'n', 'd', 'r', 'i', 'a', 't', 'r', 'a', 'p',
+	'a', 'n', 'i', 't', 'r', 'e', 'n', 't', 'i', 'n', '-', 's', 'u', 'd', '-', 't',
+	'i', 'r', 'o', 'l', 't', 'r', 'e', 'n', 't', 'i', 'n', '-', 's', 'u', 'd', 't',
+	'i', 'r', 'o', 'l', 't', 'r', 'e', 'n', 't', 'i', 'n', '-', 's', 'u', 'e', 'd',
+	'-', 't', 'i', 'r', 'o', 'l', 't', 'r', 'e', 'n', 't', 'i', 'n', '-', 's', 'u',
+	'e', 'd', 't', 'i', 'r', 'o', 'l', 't', 'r', 'e', 'n', 't', 'i', 'n', 'o', 't',
+	'r', 'e', 'n', 't', 'i', 'n', 'o', '-', 'a', '-', 'a', 'd', 'i', 'g', 'e', 't',
+	'r', 'e', 'n', 't', 'i', 'n', 'o', '-', 'a', 'a', 'd', 'i', 'g', 'e', 't', 'r',
+	'e', 'n', 't', 'i', 'n', 'o', '-', 'a', 'l', 't', 'o', '-', 'a', 'd', 'i', 'g',
+	'e', 't', 'r', 'e', 'n', 't', 'i', 'n', 'o', '-', 'a', 'l', 't', 'o', 'a', 'd',
+	'i', 'g', 'e', 't', 'r', 'e', 'n', 't', 'i', 'n', 'o', '-', 's', '-', 't', 'i',
+	'r', 'o', 'l', 't', 'r', 'e', 'n', 't', 'i', 'n', 'o', '-', 's', 't', 'i', 'r',
+	'o', 'l', 't', 'r', 'e', 'n', 't', 'i', 'n', 'o', '-', 's', 'u', 'd', '-', 't',
+	'i', 'r', 'o', 'l', 't', 'r', 'e', 'n', 't', 'i', 'n', 'o', '-', 's', 'u', 'd',
+	't', 'i', 'r', 'o', 'l', 't', 'r', 'e', 'n', 't', 'i', 'n', 'o', '-', 's', 'u',
+	'e', 'd', '-', 't', 'i', 'r', 'o', 'l', 't', 'r', 'e', 'n', 't', 'i', 'n', 'o',
+	'-', 's', 'u', 'e', 'd', 't', 'i', 'r', 'o', 'l', 't', 'r', 'e', 'n', 't', 'i',
+	'n', 'o', 'a', '-', 'a', 'd', 'i', 'g', 'e', 't', 'r', 'e', 'n', 't', 'i', 'n',
+	'o', 'a', 'a', 'd', 'i', 'g', 'e', 't', 'r', 'e', 'n', 't', 'i', 'n', 'o', 'a',
+	'l', 't', 'o', '-', 'a', 'd', 'i', 'g', 'e', 't', 'r', 'e', 'n', 't', 'i', 'n',
+	'o', 'a', 'l', 't', 'o', 'a', 'd', 'i', 'g', 'e', 't', 'r', 'e', 'n', 't', 'i',
+	'n', 'o', 's', '-', 't', 'i', 'r', 'o', 'l', 't', 'r', 'e', 'n', 't', 'i', 'n',
+	'o', 's', 't', 'i', 'r', 'o', 'l', 't', 'r', 'e', 'n', 't', 'i', 'n', 'o', 's',
+	'u', 'd', '-', 't', 'i', 'r', 'o', 'l', 't', 'r', 'e', 'n', 't', 'i', 'n', 'o',
+	's', 'u', 'd', 't', 'i', 'r', 'o', 'l', 't', 'r', 'e', 'n', 't', 'i', 'n', 'o',
+	's', 'u', 'e', 'd', '-', 't', 'i', 'r', 'o', 'l', 't', 'r', 'e', 'n', 't', 'i',
+	'n', 'o', 's', 'u', 'e', 'd', 't', 'i', 'r', 'o', 'l', 't', 'r', 'e', 'n', 't',
+	'i', 'n', 's', 'u', 'd', '-', 't', 'i', 'r', 'o', 'l', 't', 'r', 'e', 'n', 't',
+	'i', 'n', 's', 'u', 'd', 't', 'i', 'r', 'o', 'l', 't', 'r', 'e', 'n', 't', 'i',
+	'n', 's', 'u', 'e', 'd', '-', 't', 'i', 'r', 'o', 'l', 't', 'r', 'e', 'n', 't',
+	'i', 'n', 's', 'u', 'e', 'd', 't', 'i', 'r', 'o', 'l', 't', 'r', 'e', 'n', 't',
+	'o', 't', 'r', 'e', 'v', 'i', 's', 'o', 't', 'r', 'i', 'e', 's', 't', 'e', 't',
+	'u', 'r', 'i', 'n', 't', 'u', 's', 'c', 'a', 'n', 'y', 'u', 'd', 'i', 'n', 'e',
+	'u', 'm', 'b', 'r', 'i', 'a', 'u', 'r', 'b', 'i', 'n', 'o', '-', 'p', 'e', 's',
+	'a', 'r', 'o', 'v', 'a', 'l', '-', 'd', '-', 'a', 'o', 's', 't', 'a', 'v', 'a',
+	'l', '-', 'd', 'a', 'o', 's', 't', 'a', 'v', 'a', 'l', 'd', '-', 'a', 'o', 's',
+	't', 'a', 'v', 'a', 'l', 'd', 'a', 'o', 's', 't', 'a', 'v', 'a', 'l', 'l', 'e',
+	'-', 'a', 'o', 's', 't', 'a', 'v', 'a', 'l', 'l', 'e', '-', 'd', '-', 'a', 'o',
+	's', 't', 'a', 'v', 'a', 'l', 'l', 'e', '-', 'd', 'a', 'o', 's', 't', 'a', 'v',
+	'a', 'l', 'l', 'e', 'a', 'o', 's', 't', 'a', 'v', 'a', 'l', 'l', 'e', 'd', '-',
+	'a', 'o', 's', 't', 'a', 'v', 'a', 'l', 'l', 'e', 'd', 'a', 'o', 's', 't', 'a',
+	'v', 'a', 'l', 'l', 'e', 'e', '-', 'a', 'o', 's', 't', 'e', 'v', 'a', 'l', 'l',
+	'e', 'e', '-', 'd', '-', 'a', 'o', 's', 't', 'e', 'v', 'a', 'l', 'l', 'e', 'e',
+	'a', 'o', 's', 't', 'e', 'v', 'a', 'l', 'l', 'e', 'e', 'd', 'a', 'o', 's', 't',
+	'e', 'v', 'a', 'o', 'v', 'a', 'r', 'e', 's', 'e', 'v', 'd', 'a', 'v', 'e', 'n',
+	'e', 't', 'o', 'v', 'e', 'n', 'i', 'c', 'e', 'v', 'e', 'r', 'b', 'a', 'n', 'i',
+	'a', 'v', 'e', 'r', 'c', 'e', 'l', 'l', 'i', 'v', 'e', 'r', 'o', 'n', 'a', 'v',
+	'i', 'b', 'o', '-', 'v', 'a', 'l', 'e', 'n', 't', 'i', 'a', 'v', 'i', 'b', 'o',
+	'v', 'a', 'l', 'e', 'n', 't', 'i', 'a', 'v', 'i', 'c', 'e', 'n', 'z', 'a', 'v',
+	'i', 't', 'e', 'r', 'b', 'o', 'v', 'v', 'x', 'n', '-', '-', 'b', 'a', 'l', 's',
+	'a', 'n', '-', 's', 'd', 't', 'i', 'r', 'o', 'l', '-', 'n', 's', 'b', 'x', 'n',
+	'-', '-', 'b', 'o', 'z', 'e', 'n', '-', 's', 'd', 't', 'i', 'r', 'o', 'l', '-',
+	'2', 'o', 'b', 'x', 'n', '-', '-', 'b', 'u', 'l', 's', 'a', 'n', '-', 's', 'd',
+	't', 'i', 'r', 'o', 'l', '-', 'n', 's', 'b', 'x', 'n', '-', '-', 'c', 'e', 's',
+	'e', 'n', 'a', '-', 'f', 'o', 'r', 'l', '-', 'm', 'c', 'b', 'x', 'n', '-', '-',
+	'c', 'e', 's', 'e', 'n', 'a', 'f', 'o', 'r', 'l', '-', 'i', '8', 'a', 'x', 'n',
+	'-', '-', 'f', 'o', 'r', 'l', '-', 'c', 'e', 's', 'e', 'n', 'a', '-', 'f', 'c',
+	'b', 'x', 'n', '-', '-', 'f', 'o', 'r', 'l', 'c', 'e', 's', 'e', 'n', 'a', '-',
+	'c', '8', 'a', 'x', 'n', '-', '-', 's', 'd', 't', 'i', 'r', 'o', 'l', '-', 'n',
+	'2', 'a', 'x', 'n', '-', '-', 't', 'r', 'e', 'n', 't', 'i', 'n', '-', 's', 'd',
+	'-', 't', 'i', 'r', 'o', 'l', '-', 'r', 'z', 'b', 'x', 'n', '-', '-', 't', 'r',
+	'e', 'n', 't', 'i', 'n', '-', 's', 'd', 't', 'i', 'r', 'o', 'l', '-', '7', 'v',
+	'b', 'x', 'n', '-', '-', 't', 'r', 'e', 'n', 't', 'i', 'n', 'o', '-', 's', 'd',
+	'-', 't', 'i', 'r', 'o', 'l', '-', 'c', '3', 'b', 'x', 'n', '-', '-', 't', 'r',
+	'e', 'n', 't', 'i', 'n', 'o', '-', 's', 'd', 't', 'i', 'r', 'o', 'l', '-', 's',
+	'z', 'b', 'x', 'n', '-', '-', 't', 'r', 'e', 'n', 't', 'i', 'n', 'o', 's', 'd',
+	'-', 't', 'i', 'r', 'o', 'l', '-', 'r', 'z', 'b', 'x', 'n', '-', '-', 't', 'r',
+	'e', 'n', 't', 'i', 'n', 'o', 's', 'd', 't', 'i', 'r', 'o', 'l', '-', '7', 'v',
+	'b', 'x', 'n', '-', '-', 't', 'r', 'e', 'n', 't', 'i', 'n', 's', 'd', '-', 't',
+	'i', 'r', 'o', 'l', '-', '6', 'v', 'b', 'x', 'n', '-', '-', 't', 'r', 'e', 'n',
+	't', 'i', 'n', 's', 'd', 't', 'i', 'r', 'o', 'l', '-', 'n', 's', 'b', 'x', 'n',
+	'-', '-', 'v', 'a', 'l', 'l', 'e', '-', 'a', 'o', 's', 't', 'e', '-', 'e', 'b',
+	'b', 'x', 'n', '-', '-', 'v', 'a', 'l', 'l', 'e', '-', 'd', '-', 'a', 'o', 's',
+	't', 'e', '-', 'e', 'h', 'b', 'x', 'n', '-', '-', 'v', 'a', 'l', 'l', 'e', 'a',
+	'o', 's', 't', 'e', '-', 'e', '7', 'a', 'x', 'n', '-', '-', 'v', 'a', 'l', 'l',
+	'e', 'd', 'a', 'o', 's', 't', 'e', '-', 'e', 'b', 'b', 'a', 'i', 'c', 'h', 'i',
+	'a', 'k', 'i', 't', 'a', 'a', 'n', 'g', 'r', 'y', 'a', 'o', 'm', 'o', 'r', 'i',
+	'b', 'a', 'b', 'y', 'b', 'l', 'u', 'e', 'b', 'a', 'b', 'y', 'm', 'i', 'l', 'k',
+	'b', 'a', 'c', 'k', 'd', 'r', 'o', 'p', 'b', 'a', 'm', 'b', 'i', 'n', 'a', 'b',
+	'i', 't', 't', 'e', 'r', 'b', 'l', 'u', 's', 'h', 'b', 'o', 'y', 'b', 'o', 'y',
+	'f', 'r', 'i', 'e', 'n', 'd', 'b', 'u', 'y', 's', 'h', 'o', 'p', 'c', 'a', 'n',
+	'd', 'y', 'p', 'o', 'p', 'c', 'a', 'p', 'o', 'o', 'c', 'a', 't', 'f', 'o', 'o',
+	'd', 'c', 'h', 'i', 'b', 'a', 'c', 'h', 'i', 'c', 'a', 'p', 'p', 'a', 'c', 'h',
+	'i', 'l', 'l', 'o', 'u', 't', 'c', 'h', 'i', 'p', 's', 'c', 'h', 'o', 'w', 'd',
+	'e', 'r', 'c', 'i', 'a', 'o', 'c', 'o', 'c', 'o', 't', 't', 'e', 'c', 'o', 'o',
+	'l', 'b', 'l', 'o', 'g', 'c', 'r', 'a', 'n', 'k', 'y', 'c', 'u', 't', 'e', 'g',
+	'i', 'r', 'l', 'd', 'i', 'g', 'i', 'c', 'k', 'e', 'g', 'o', 'i', 's', 'm', 'e',
+	'h', 'i', 'm', 'e', 'f', 'a', 'k', 'e', 'f', 'u', 'r', 'f', 'a', 's', 'h', 'i',
+	'o', 'n', 's', 't', 'o', 'r', 'e', 'f', 'e', 'm', 'f', 'l', 'i', 'e', 'r', 'f',
+	'l', 'o', 'p', 'p', 'y', 'f', 'o', 'o', 'l', 'f', 'r', 'e', 'n', 'c', 'h', 'k',
+	'i', 's', 's', 'f', 'u', 'k', 'u', 'i', 'f', 'u', 'k', 'u', 'o', 'k', 'a', 'f',
+	'u', 'k', 'u', 's', 'h', 'i', 'm', 'a', 'g', 'i', 'f', 'u', 'g', 'i', 'r', 'l',
+	'f', 'r', 'i', 'e', 'n', 'd', 'g', 'i', 'r', 'l', 'y', 'g', 'l', 'o', 'o', 'm',
+	'y', 'g', 'o', 'n', 'n', 'a', 'g', 'r', 'e', 'a', 't', 'e', 'r', 'g', 'u', 'n',
+	'm', 'a', 'h', 'a', 'c', 'c', 'a', 'h', 'a', 'n', 'd', 'c', 'r', 'a', 'f', 't',
+	'e', 'd', 'h', 'e', 'a', 'v', 'y', 'h', 'i', 'h', 'o', 'h', 'i', 'p', 'p', 'y',
+	'h', 'i', 'r', 'o', 's', 'h', 'i', 'm', 'a', 'h', 'o', 'k', 'k', 'a', 'i', 'd',
+	'o', 'h', 'o', 'l', 'y', 'h', 'u', 'n', 'g', 'r', 'y', 'h', 'y', 'o', 'g', 'o',
+	'i', 'b', 'a', 'r', 'a', 'k', 'i', 'i', 'c', 'u', 'r', 'u', 's', 'i', 's', 'h',
+	'i', 'k', 'a', 'w', 'a', 'i', 't', 'i', 'g', 'o', 'i', 'w', 'a', 't', 'e', 'j',
+	'e', 'l', 'l', 'y', 'b', 'e', 'a', 'n', 'k', 'a', 'g', 'a', 'w', 'a', 'k', 'a',
+	'g', 'o', 's', 'h', 'i', 'm', 'a', 'k', 'a', 'n', 'a', 'g', 'a', 'w', 'a', 'k',
+	'a', 'w', 'a', 'i', 'i', 's', 'h', 'o', 'p', 'k', 'a', 'w', 'a', 's', 'a', 'k',
+	'i', 'k', 'i', 'k', 'i', 'r', 'a', 'r', 'a', 'k', 'i', 'l', 'l', 'k', 'i', 'l',
+	'o', 'k', 'i', 't', 'a', 'k', 'y', 'u', 's', 'h', 'u', 'k', 'o', 'b', 'e', 'k',
+	'o', 'c', 'h', 'i', 'k', 'u', 'm', 'a', 'm', 'o', 't', 'o', 'k', 'u', 'r', 'o',
+	'n', 'l', 'i', 't', 't', 'l', 'e', 's', 't', 'a', 'r', 'l', 'o', 'l', 'i', 'p',
+	'o', 'p', 'm', 'c', 'l', 'o', 'l', 'i', 't', 'a', 'p', 'u', 'n', 'k', 'l', 'o',
+	'm', 'o', 'l', 'o', 'v', 'e', 'p', 'o', 'p', 'l', 'o', 'v', 'e', 's', 'i', 'c',
+	'k', 'm', 'i', 'y', 'a', 'g', 'i', 'm', 'i', 'y', 'a', 'z', 'a', 'k', 'i', 'm',
+	'o', 'd', 's', 'm', 'o', 'n', 'g', 'o', 'l', 'i', 'a', 'n', 'n', 'a', 'g', 'a',
+	'n', 'o', 'n', 'a', 'g', 'a', 's', 'a', 'k', 'i', 'n', 'a', 'm', 'a', 's', 't',
+	'e', 'n', 'a', 'r', 'a', 'n', 'i', 'i', 'g', 'a', 't', 'a', 'n', 'i', 'k', 'i',
+	't', 'a', 'n', 'o', 'b', 'u', 's', 'h', 'i', 'n', 'o', 'o', 'r', 'o', 'i', 't',
+	'a', 'o', 'k', 'a', 'y', 'a', 'm', 'a', 'o', 'o', 'p', 's', 'p', 'a', 'r', 'a',
+	'l', 'l', 'e', 'l', 'p', 'a', 'r', 'a', 's', 'i', 't', 'e', 'p', 'e', 'c', 'o',
+	'r', 'i', 'p', 'e', 'e', 'w', 'e', 'e', 'p', 'e', 'n', 'n', 'e', 'p', 'e', 'p',
+	'p', 'e', 'r', 'p', 'e', 'r', 'm', 'a', 'p', 'i', 'g', 'b', 'o', 'a', 't', 'p',
+	'i', 'n', 'o', 'k', 'o', 'p', 'u', 'n', 'y', 'u', 'p', 'u', 'p', 'u', 'p', 'u',
+	's', 's', 'y', 'c', 'a', 't', 'p', 'y', 'a', 'r', 'a', 'i', 'n', 'd', 'r', 'o',
+	'p', 'r', 'e', 'a', 'd', 'y', 'm', 'a', 'd', 'e', 's', 'a', 'd', 'i', 's', 't',
+	's', 'a', 'g', 'a', 's', 'a', 'i', 't', 'a', 'm', 'a', 's', 'a', 'p', 'p', 'o',
+	'r', 'o', 's', 'c', 'h', 'o', 'o', 'l', 'b', 'u', 's', 's', 'e', 'c', 'r', 'e',
+	't', 's', 'e', 'n', 'd', 'a', 'i', 's', 'h', 'i', 'g', 'a', 's', 'h', 'i', 'm',
+	'a', 'n', 'e', 's', 'h', 'i', 'z', 'u', 'o', 'k', 'a', 's', 't', 'a', 'b', 'a',
+	's', 't', 'r', 'i', 'p', 'p', 'e', 'r', 's', 'u', 'n', 'n', 'y', 'd', 'a', 'y',
+	's', 'u', 'p', 'e', 'r', 's', 'a', 'l', 'e', 't', 'h', 'e', 's', 'h', 'o', 'p',
+	't', 'h', 'i', 'c', 'k', 't', 'o', 'c', 'h', 'i', 'g', 'i', 't', 'o', 'k', 'u',
+	's', 'h', 'i', 'm', 'a', 't', 'o', 'n', 'k', 'o', 't', 's', 'u', 't', 'o', 't',
+	't', 'o', 'r', 'i', 't', 'o', 'y', 'a', 'm', 'a', 'u', 'n', 'd', 'e', 'r', 'u',
+	'p', 'p', 'e', 'r', 'v', 'e', 'l', 'v', 'e', 't', 'v', 'e', 'r', 's', 'e', 'v',
+	'e', 'r', 's', 'u', 's', 'v', 'i', 'v', 'i', 'a', 'n', 'w', 'a', 'k', 'a', 'y',
+	'a', 'm', 'a', 'w', 'a', 't', 's', 'o', 'n', 'w', 'e', 'b', 'l', 'i', 'k', 'e',
+	'w', 'h', 'i', 't', 'e', 's', 'n', 'o', 'w', 'x', 'n', '-', '-', '0', 't', 'r',
+	'q', '7', 'p', '7', 'n', 'n', 'x', 'n', '-', '-', '1', 'c', 't', 'w', 'o', 'x',
+	'n', '-', '-', '1', 'l', 'q', 's', '0', '3', 'n', 'x', 'n', '-', '-', '1', 'l',
+	'q', 's', '7', '1', 'd', 'x', 'n', '-', '-', '2', 'm', '4', 'a', '1', '5', 'e',
+	'x', 'n', '-', '-', '3', '2', 'v', 'p', '3', '0', 'h', 'x', 'n', '-', '-', '4',
+	'i', 't', '1', '6', '8', 'd', 'x', 'n', '-', '-', '4', 'i', 't', '7', '9', '7',
+	'k', 'x', 'n', '-', '-', '4', 'p', 'v', 'x', 's', 'x', 'n', '-', '-', '5', 'j',
+	's', '0', '4', '5', 'd', 'x', 'n', '-', '-', '5', 'r', 't', 'p', '4', '9', 'c',
+	'x', 'n', '-', '-', '5', 'r', 't', 'q', '3', '4', 'k', 'x', 'n', '-', '-', '6',
+	'b', 't', 'w', '5', 'a', 'x', 'n', '-', '-', '6', 'o', 'r', 'x', '2', 'r', 'x',
+	'n', '-', '-', '7', 't', '0', 'a', '2', '6', '4', 'c', 'x', 'n', '-', '-', '8',
+	'l', 't', 'r', '6', '2', 'k', 'x', 'n', '-', '-', '8', 'p', 'v', 'r', '4', 'u',
+	'x', 'n', '-', '-', 'c', '3', 's', '1', '4', 'm', 'x', 'n', '-', '-', 'd', '5',
+	'q', 'v', '7', 'z', '8', '7', '6', 'c', 'x', 'n', '-', '-', 'd', 'j', 'r', 's',
+	'7', '2', 'd', '6', 'u', 'y', 'x', 'n', '-', '-', 'd', 'j', 't', 'y', '4', 'k',
+	'x', 'n', '-', '-', 'e', 'f', 'v', 'n', '9', 's', 'x', 'n', '-', '-', 'e', 'h',
+	'q', 'z', '5', '6', 'n', 'x', 'n', '-', '-', 'e', 'l', 'q', 'q', '1', '6', 'h',
+	'x', 'n', '-', '-', 'f', '6', 'q', 'x', '5', '3', 'a', 'x', 'n', '-', '-', 'k',
+	'7', 'y', 'n', '9', '5', 'e', 'x', 'n', '-', '-', 'k', 'b', 'r', 'q', '7', 'o',
+	'x', 'n', '-', '-', 'k', 'l', 't', '7', '8', '7', 'd', 'x', 'n', '-', '-', 'k',
+	'l', 't', 'p', '7', 'd', 'x', 'n', '-', '-', 'k', 'l', 't', 'x', '9', 'a', 'x',
+	'n', '-', '-', 'k', 'l', 't', 'y', '5', 'x', 'x', 'n', '-', '-', 'm', 'k', 'r',
+	'u', '4', '5', 'i', 'x', 'n', '-', '-', 'n', 'i', 't', '2', '2', '5', 'k', 'x',
+	'n', '-', '-', 'n', 't', 's', 'o', '0', 'i', 'q', 'x', '3', 'a', 'x', 'n', '-',
+	'-', 'n', 't', 's', 'q', '1', '7', 'g', 'x', 'n', '-', '-', 'p', 's', 's', 'u',
+	'3', '3', 'l', 'x', 'n', '-', '-', 'q', 'q', 'q', 't', '1', '1', 'm', 'x', 'n',
+	'-', '-', 'r', 'h', 't', '2', '7', 'z', 'x', 'n', '-', '-', 'r', 'h', 't', '3',
+	'd', 'x', 'n', '-', '-', 'r', 'h', 't', '6', '1', 'e', 'x', 'n', '-', '-', 'r',
+	'n', 'y', '3', '1', 'h', 'x', 'n', '-', '-', 't', 'o', 'r', '1', '3', '1', 'o',
+	'x', 'n', '-', '-', 'u', 'i', 's', 't', '2', '2', 'h', 'x', 'n', '-', '-', 'u',
+	'i', 's', 'z', '3', 'g', 'x', 'n', '-', '-', 'u', 'u', 'w', 'u', '5', '8', 'a',
+	'x', 'n', '-', '-', 'v', 'g', 'u', '4', '0', '2', 'c', 'x', 'n', '-', '-', 'z',
+	'b', 'x', '0', '2', '5', 'd', 'y', 'a', 'm', 'a', 'g', 'a', 't', 'a', 'y', 'a',
+	'm', 'a', 'g', 'u', 'c', 'h', 'i', 'y', 'a', 'm', 'a', 'n', 'a', 's', 'h', 'i',
+	'z', 'o', 'm', 'b', 'i', 'e', 'p', 'h', 'a', 'r', 'm', 'a', 'c', 'i', 'e', 'n',
+	's', 'b', 'u', 's', 'a', 'n', 'c', 'h', 'u', 'n', 'g', 'b', 'u', 'k', 'c', 'h',
+	'u', 'n', 'g', 'n', 'a', 'm', 'd', 'a', 'e', 'g', 'u', 'd', 'a', 'e', 'j', 'e',
+	'o', 'n', 'g', 'a', 'n', 'g', 'w', 'o', 'n', 'g', 'w', 'a', 'n', 'g', 'j', 'u',
+	'g', 'y', 'e', 'o', 'n', 'g', 'b', 'u', 'k', 'g', 'y', 'e', 'o', 'n', 'g', 'g',
+	'i', 'g', 'y', 'e', 'o', 'n', 'g', 'n', 'a', 'm', 'i', 'n', 'c', 'h', 'e', 'o',
+	'n', 'j', 'e', 'j', 'u', 'j', 'e', 'o', 'n', 'b', 'u', 'k', 'j', 'e', 'o', 'n',
+	'n', 'a', 'm', 's', 'e', 'o', 'u', 'l', 'j', 'c', 'l', 'o', 'u', 'd', 'k', 'a',
+	'z', 't', 'e', 'l', 'e', 'p', 'o', 'r', 't', 'b', 'n', 'r', 'c', 'y', 'o', 'n',
+	'm', 'y', 'p', 'e', 'p', 'h', 'l', 'x', 'a', 's', 's', 'n', 'g', 'r', 'p', 'o',
+	'm', 'g', 'p', 'l', 'c', 'b', 'r', 'a', 's', 'i', 'l', 'i', 'a', 'c', '6', '6',
+	'd', 'a', 'p', 'l', 'i', 'e', 'e', 'd', 'g', 'e', 's', 't', 'a', 'c', 'k', 'f',
+	'i', 'l', 'e', 'g', 'e', 'a', 'r', 'f', 'i', 'l', 'e', 'g', 'e', 'a', 'r', '-',
+	'a', 'u', 'f', 'i', 'l', 'e', 'g', 'e', 'a', 'r', '-', 'd', 'e', 'f', 'i', 'l',
+	'e', 'g', 'e', 'a', 'r', '-', 'g', 'b', 'f', 'i', 'l', 'e', 'g', 'e', 'a', 'r',
+	'-', 'i', 'e', 'f', 'i', 'l', 'e', 'g', 'e', 'a', 'r', '-', 'j', 'p', 'f', 'i',
+	'l', 'e', 'g', 'e', 'a', 'r', '-', 's', 'g', 'g', 'l', 'i', 't', 'c', 'h', 'h',
+	'o', 'p', 't', 'o', 'i', '2', '3', '4', 'l', 'o', 'g', 'i', 'n', 't', 'o', 'l',
+	'o', 'h', 'm', 'u', 's', 'm', 'c', 'd', 'i', 'r', 'm', 'c', 'p', 'e', 'm', 'y',
+	'd', 's', 'n', 'o', 'h', 'o', 's', 't', 'n', 'o', 'i', 'p', 's', 'o', 'u', 'n',
+	'd', 'c', 'a', 's', 't', 't', 'c', 'p', '4', 't', 'r', 'a', 'n', 's', 'i', 'p',
+	'v', 'p', '4', 'y', 'o', 'm', 'b', 'o', 'm', 'i', 'n', 'i', 's', 'i', 't', 'e',
+	'a', 'g', 'r', 'i', 'c', 'u', 'l', 't', 'u', 'r', 'e', 'a', 'i', 'r', 'g', 'u',
+	'a', 'r', 'd', 'a', 'l', 'a', 'b', 'a', 'm', 'a', 'a', 'l', 'a', 's', 'k', 'a',
+	'a', 'm', 'b', 'e', 'r', 'a', 'm', 'e', 'r', 'i', 'c', 'a', 'n', 'a', 'a', 'm',
+	'e', 'r', 'i', 'c', 'a', 'n', 'a', 'n', 't', 'i', 'q', 'u', 'e', 's', 'a', 'm',
+	'e', 'r', 'i', 'c', 'a', 'n', 'a', 'r', 't', 'a', 'n', 'n', 'e', 'f', 'r', 'a',
+	'n', 'k', 'a', 'n', 't', 'h', 'r', 'o', 'a', 'n', 't', 'h', 'r', 'o', 'p', 'o',
+	'l', 'o', 'g', 'y', 'a', 'q', 'u', 'a', 'r', 'i', 'u', 'm', 'a', 'r', 'b', 'o',
+	'r', 'e', 't', 'u', 'm', 'a', 'r', 'c', 'h', 'a', 'e', 'o', 'l', 'o', 'g', 'i',
+	'c', 'a', 'l', 'a', 'r', 'c', 'h', 'a', 'e', 'o', 'l', 'o', 'g', 'y', 'a', 'r',
+	'c', 'h', 'i', 't', 'e', 'c', 't', 'u', 'r', 'e', 'a', 'r', 't', 'a', 'n', 'd',
+	'd', 'e', 's', 'i', 'g', 'n', 'a', 'r', 't', 'c', 'e', 'n', 't', 'e', 'r', 'a',
+	'r', 't', 'd', 'e', 'c', 'o', 'a', 'r', 't', 'e', 'd', 'u', 'c', 'a', 't', 'i',
+	'o', 'n', 'a', 'r', 't', 'g', 'a', 'l', 'l', 'e', 'r', 'y', 'a', 'r', 't', 's',
+	'a', 'n', 'd', 'c', 'r', 'a', 'f', 't', 's', 'a', 's', 'm', 'a', 't', 'a', 'r',
+	't', 'a', 's', 's', 'a', 's', 's', 'i', 'n', 'a', 't', 'i', 'o', 'n', 'a', 's',
+	's', 'i', 's', 'i', 'a', 's', 't', 'r', 'o', 'n', 'o', 'm', 'y', 'a', 't', 'l',
+	'a', 'n', 't', 'a', 'a', 'u', 's', 't', 'i', 'n', 'a', 'u', 's', 't', 'r', 'a',
+	'l', 'i', 'a', 'a', 'u', 't', 'o', 'm', 'o', 't', 'i', 'v', 'e', 'a', 'x', 'i',
+	's', 'b', 'a', 'd', 'a', 'j', 'o', 'z', 'b', 'a', 'g', 'h', 'd', 'a', 'd', 'b',
+	'a', 'h', 'n', 'b', 'a', 'l', 't', 'i', 'm', 'o', 'r', 'e', 'b', 'a', 's', 'e',
+	'l', 'b', 'a', 't', 'h', 's', 'b', 'a', 'u', 'e', 'r', 'n', 'b', 'e', 'a', 'u',
+	'x', 'a', 'r', 't', 's', 'b', 'e', 'e', 'l', 'd', 'e', 'n', 'g', 'e', 'l', 'u',
+	'i', 'd', 'b', 'e', 'l', 'l', 'e', 'v', 'u', 'e', 'b', 'e', 'r', 'g', 'b', 'a',
+	'u', 'b', 'e', 'r', 'k', 'e', 'l', 'e', 'y', 'b', 'i', 'l', 'b', 'a', 'o', 'b',
+	'i', 'l', 'l', 'b', 'i', 'r', 'd', 'a', 'r', 't', 'b', 'i', 'r', 't', 'h', 'p',
+	'l', 'a', 'c', 'e', 'b', 'o', 'n', 'n', 'b', 'o', 't', 'a', 'n', 'i', 'c', 'a',
+	'l', 'b', 'o', 't', 'a', 'n', 'i', 'c', 'a', 'l', 'g', 'a', 'r', 'd', 'e', 'n',
+	'b', 'o', 't', 'a', 'n', 'i', 'c', 'g', 'a', 'r', 'd', 'e', 'n', 'b', 'o', 't',
+	'a', 'n', 'y', 'b', 'r', 'a', 'n', 'd', 'y', 'w', 'i', 'n', 'e', 'v', 'a', 'l',
+	'l', 'e', 'y', 'b', 'r', 'i', 's', 't', 'o', 'l', 'b', 'r', 'i', 't', 'i', 's',
+	'h', 'b', 'r', 'i', 't', 'i', 's', 'h', 'c', 'o', 'l', 'u', 'm', 'b', 'i', 'a',
+	'b', 'r', 'o', 'a', 'd', 'c', 'a', 's', 't', 'b', 'r', 'u', 'n', 'e', 'l', 'b',
+	'r', 'u', 'x', 'e', 'l', 'l', 'e', 's', 'b', 'u', 'i', 'l', 'd', 'i', 'n', 'g',
+	'b', 'u', 'r', 'g', 'h', 'o', 'f', 'b', 'u', 's', 'h', 'e', 'y', 'c', 'a', 'd',
+	'a', 'q', 'u', 'e', 's', 'c', 'a', 'l', 'i', 'f', 'o', 'r', 'n', 'i', 'a', 'c',
+	'a', 'm', 'b', 'r', 'i', 'd', 'g', 'e', 'c', 'a', 'n', 'a', 'd', 'a', 'c', 'a',
+	'p', 'e', 'b', 'r', 'e', 't', 'o', 'n', 'c', 'a', 'r', 'r', 'i', 'e', 'r', 'c',
+	'a', 'r', 't', 'o', 'o', 'n', 'a', 'r', 't', 'c', 'a', 's', 'a', 'd', 'e', 'l',
+	'a', 'm', 'o', 'n', 'e', 'd', 'a', 'c', 'a', 's', 't', 'l', 'e', 'c', 'a', 's',
+	't', 'r', 'e', 's', 'c', 'e', 'l', 't', 'i', 'c', 'c', 'h', 'a', 't', 't', 'a',
+	'n', 'o', 'o', 'g', 'a', 'c', 'h', 'e', 'l', 't', 'e', 'n', 'h', 'a', 'm', 'c',
+	'h', 'e', 's', 'a', 'p', 'e', 'a', 'k', 'e', 'b', 'a', 'y', 'c', 'h', 'i', 'c',
+	'a', 'g', 'o', 'c', 'h', 'i', 'l', 'd', 'r', 'e', 'n', 'c', 'h', 'i', 'l', 'd',
+	'r', 'e', 'n', 's', 'c', 'h', 'i', 'l', 'd', 'r', 'e', 'n', 's', 'g', 'a', 'r',
+	'd', 'e', 'n', 'c', 'h', 'i', 'r', 'o', 'p', 'r', 'a', 'c', 't', 'i', 'c', 'c',
+	'h', 'o', 'c', 'o', 'l', 'a', 't', 'e', 'c', 'h', 'r', 'i', 's', 't', 'i', 'a',
+	'n', 's', 'b', 'u', 'r', 'g', 'c', 'i', 'n', 'c', 'i', 'n', 'n', 'a', 't', 'i',
+	'c', 'i', 'n', 'e', 'm', 'a', 'c', 'i', 'r', 'c', 'u', 's', 'c', 'i', 'v', 'i',
+	'l', 'i', 's', 'a', 't', 'i', 'o', 'n', 'c', 'i', 'v', 'i', 'l', 'i', 'z', 'a',
+	't', 'i', 'o', 'n', 'c', 'i', 'v', 'i', 'l', 'w', 'a', 'r', 'c', 'l', 'i', 'n',
+	't', 'o', 'n', 'c', 'l', 'o', 'c', 'k', 'c', 'o', 'a', 'l', 'c', 'o', 'a', 's',
+	't', 'a', 'l', 'd', 'e', 'f', 'e', 'n', 'c', 'e', 'c', 'o', 'd', 'y', 'c', 'o',
+	'l', 'd', 'w', 'a', 'r', 'c', 'o', 'l', 'l', 'e', 'c', 't', 'i', 'o', 'n', 'c',
+	'o', 'l', 'o', 'n', 'i', 'a', 'l', 'w', 'i', 'l', 'l', 'i', 'a', 'm', 's', 'b',
+	'u', 'r', 'g', 'c', 'o', 'l', 'o', 'r', 'a', 'd', 'o', 'p', 'l', 'a', 't', 'e',
+	'a', 'u', 'c', 'o', 'l', 'u', 'm', 'b', 'u', 's', 'c', 'o', 'm', 'm', 'u', 'n',
+	'i', 'c', 'a', 't', 'i', 'o', 'n', 'c', 'o', 'm', 'm', 'u', 'n', 'i', 'c', 'a',
+	't', 'i', 'o', 'n', 's', 'c', 'o', 'm', 'p', 'u', 't', 'e', 'r', 'h', 'i', 's',
+	't', 'o', 'r', 'y', 'c', 'o', 'n', 't', 'e', 'm', 'p', 'o', 'r', 'a', 'r', 'y',
+	'c', 'o', 'n', 't', 'e', 'm', 'p', 'o', 'r', 'a', 'r', 'y', 'a', 'r', 't', 'c',
+	'o', 'n', 'v', 'e', 'n', 't', 'c', 'o', 'p', 'e', 'n', 'h', 'a', 'g', 'e', 'n',
+	'c', 'o', 'r', 'p', 'o', 'r', 'a', 't', 'i', 'o', 'n', 'c', 'o', 'r', 'v', 'e',
+	't', 't', 'e', 'c', 'o', 's', 't', 'u', 'm', 'e', 'c', 'o', 'u', 'n', 't', 'r',
+	'y', 'e', 's', 't', 'a', 't', 'e', 'c', 'o', 'u', 'n', 't', 'y', 'c', 'r', 'a',
+	'n', 'b', 'r', 'o', 'o', 'k', 'c', 'u', 'l', 't', 'u', 'r', 'a', 'l', 'c', 'u',
+	'l', 't', 'u', 'r', 'a', 'l', 'c', 'e', 'n', 't', 'e', 'r', 'c', 'y', 'b', 'e',
+	'r', 'd', 'a', 'l', 'i', 'd', 'a', 'l', 'l', 'a', 's', 'd', 'a', 't', 'a', 'b',
+	'a', 's', 'e', 'd', 'e', 'c', 'o', 'r', 'a', 't', 'i', 'v', 'e', 'a', 'r', 't',
+	's', 'd', 'e', 'l', 'a', 'w', 'a', 'r', 'e', 'd', 'e', 'l', 'm', 'e', 'n', 'h',
+	'o', 'r', 's', 't', 'd', 'e', 'n', 'm', 'a', 'r', 'k', 'd', 'e', 't', 'r', 'o',
+	'i', 't', 'd', 'i', 'n', 'o', 's', 'a', 'u', 'r', 'd', 'i', 's', 'c', 'o', 'v',
+	'e', 'r', 'y', 'd', 'o', 'l', 'l', 's', 'd', 'o', 'n', 'o', 's', 't', 'i', 'a',
+	'd', 'u', 'r', 'h', 'a', 'm', 'e', 'a', 's', 't', 'a', 'f', 'r', 'i', 'c', 'a',
+	'e', 'a', 's', 't', 'c', 'o', 'a', 's', 't', 'e', 'd', 'u', 'c', 'a', 't', 'i',
+	'o', 'n', 'a', 'l', 'e', 'g', 'y', 'p', 't', 'i', 'a', 'n', 'e', 'i', 's', 'e',
+	'n', 'b', 'a', 'h', 'n', 'e', 'l', 'b', 'u', 'r', 'g', 'e', 'l', 'v', 'e', 'n',
+	'd', 'r', 'e', 'l', 'l', 'e', 'm', 'b', 'r', 'o', 'i', 'd', 'e', 'r', 'y', 'e',
+	'n', 'c', 'y', 'c', 'l', 'o', 'p', 'e', 'd', 'i', 'c', 'e', 'n', 'g', 'l', 'a',
+	'n', 'd', 'e', 'n', 't', 'o', 'm', 'o', 'l', 'o', 'g', 'y', 'e', 'n', 'v', 'i',
+	'r', 'o', 'n', 'm', 'e', 'n', 't', 'e', 'n', 'v', 'i', 'r', 'o', 'n', 'm', 'e',
+	'n', 't', 'a', 'l', 'c', 'o', 'n', 's', 'e', 'r', 'v', 'a', 't', 'i', 'o', 'n',
+	'e', 'p', 'i', 'l', 'e', 'p', 's', 'y', 'e', 't', 'h', 'n', 'o', 'l', 'o', 'g',
+	'y', 'e', 'x', 'e', 't', 'e', 'r', 'e', 'x', 'h', 'i', 'b', 'i', 't', 'i', 'o',
+	'n', 'f', 'a', 'r', 'm', 'e', 'q', 'u', 'i', 'p', 'm', 'e', 'n', 't', 'f', 'a',
+	'r', 'm', 's', 't', 'e', 'a', 'd', 'f', 'i', 'e', 'l', 'd', 'f', 'i', 'g', 'u',
+	'e', 'r', 'e', 's', 'f', 'i', 'l', 'a', 't', 'e', 'l', 'i', 'a', 'f', 'i', 'n',
+	'e', 'a', 'r', 't', 'f', 'i', 'n', 'e', 'a', 'r', 't', 's', 'f', 'i', 'n', 'l',
+	'a', 'n', 'd', 'f', 'l', 'a', 'n', 'd', 'e', 'r', 's', 'f', 'l', 'o', 'r', 'i',
+	'd', 'a', 'f', 'o', 'r', 't', 'm', 'i', 's', 's', 'o', 'u', 'l', 'a', 'f', 'o',
+	'r', 't', 'w', 'o', 'r', 't', 'h', 'f', 'r', 'a', 'n', 'c', 'a', 'i', 's', 'e',
+	'f', 'r', 'a', 'n', 'k', 'f', 'u', 'r', 't', 'f', 'r', 'a', 'n', 'z', 'i', 's',
+	'k', 'a', 'n', 'e', 'r', 'f', 'r', 'e', 'e', 'm', 'a', 's', 'o', 'n', 'r', 'y',
+	'f', 'r', 'e', 'i', 'b', 'u', 'r', 'g', 'f', 'r', 'i', 'b', 'o', 'u', 'r', 'g',
+	'f', 'u', 'n', 'd', 'a', 'c', 'i', 'o', 'g', 'e', 'e', 'l', 'v', 'i', 'n', 'c',
+	'k', 'g', 'e', 'm', 'o', 'l', 'o', 'g', 'i', 'c', 'a', 'l', 'g', 'e', 'o', 'l',
+	'o', 'g', 'y', 'g', 'e', 'o', 'r', 'g', 'i', 'a', 'g', 'i', 'e', 's', 's', 'e',
+	'n', 'g', 'o', 'r', 'g', 'e', 'g', 'r', 'a', 'n', 'd', 'r', 'a', 'p', 'i', 'd',
+	's', 'g', 'r', 'a', 'z', 'g', 'u', 'e', 'r', 'n', 's', 'e', 'y', 'h', 'a', 'l',
+	'l', 'o', 'f', 'f', 'a', 'm', 'e', 'h', 'a', 'n', 'd', 's', 'o', 'n', 'h', 'a',
+	'r', 'v', 'e', 's', 't', 'c', 'e', 'l', 'e', 'b', 'r', 'a', 't', 'i', 'o', 'n',
+	'h', 'a', 'w', 'a', 'i', 'i', 'h', 'e', 'i', 'm', 'a', 't', 'u', 'n', 'd', 'u',
+	'h', 'r', 'e', 'n', 'h', 'e', 'l', 'l', 'a', 's', 'h', 'e', 'm', 'b', 'y', 'g',
+	'd', 's', 'f', 'o', 'r', 'b', 'u', 'n', 'd', 'h', 'e', 'r', 'i', 't', 'a', 'g',
+	'e', 'h', 'i', 's', 't', 'o', 'i', 'r', 'e', 'h', 'i', 's', 't', 'o', 'r', 'i',
+	'c', 'a', 'l', 'h', 'i', 's', 't', 'o', 'r', 'i', 'c', 'a', 'l', 's', 'o', 'c',
+	'i', 'e', 't', 'y', 'h', 'i', 's', 't', 'o', 'r', 'i', 'c', 'h', 'o', 'u', 's',
+	'e', 's', 'h', 'i', 's', 't', 'o', 'r', 'i', 's', 'c', 'h', 'h', 'i', 's', 't',
+	'o', 'r', 'i', 's', 'c', 'h', 'e', 's', 'h', 'i', 's', 't', 'o', 'r', 'y', 'o',
+	'f', 's', 'c', 'i', 'e', 'n', 'c', 'e', 'h', 'o', 'r', 'o', 'l', 'o', 'g', 'y',
+	'h', 'u', 'm', 'a', 'n', 'i', 't', 'i', 'e', 's', 'i', 'l', 'l', 'u', 's', 't',
+	'r', 'a', 't', 'i', 'o', 'n', 'i', 'm', 'a', 'g', 'e', 'a', 'n', 'd', 's', 'o',
+	'u', 'n', 'd', 'i', 'n', 'd', 'i', 'a', 'n', 'i', 'n', 'd', 'i', 'a', 'n', 'a',
+	'i', 'n', 'd', 'i', 'a', 'n', 'a', 'p', 'o', 'l', 'i', 's', 'i', 'n', 'd', 'i',
+	'a', 'n', 'm', 'a', 'r', 'k', 'e', 't', 'i', 'n', 't', 'e', 'l', 'l', 'i', 'g',
+	'e', 'n', 'c', 'e', 'i', 'n', 't', 'e', 'r', 'a', 'c', 't', 'i', 'v', 'e', 'i',
+	'r', 'a', 'q', 'i', 's', 'l', 'e', 'o', 'f', 'm', 'a', 'n', 'j', 'a', 'm', 'i',
+	's', 'o', 'n', 'j', 'e', 'f', 'f', 'e', 'r', 's', 'o', 'n', 'j', 'e', 'r', 'u',
+	's', 'a', 'l', 'e', 'm', 'j', 'e', 'w', 'i', 's', 'h', 'j', 'e', 'w', 'i', 's',
+	'h', 'a', 'r', 't', 'j', 'o', 'u', 'r', 'n', 'a', 'l', 'i', 's', 'm', 'j', 'u',
+	'd', 'a', 'i', 'c', 'a', 'j', 'u', 'd', 'y', 'g', 'a', 'r', 'l', 'a', 'n', 'd',
+	'j', 'u', 'e', 'd', 'i', 's', 'c', 'h', 'e', 's', 'j', 'u', 'i', 'f', 'k', 'a',
+	'r', 'a', 't', 'e', 'k', 'a', 'r', 'i', 'k', 'a', 't', 'u', 'r', 'k', 'o', 'e',
+	'b', 'e', 'n', 'h', 'a', 'v', 'n', 'k', 'u', 'n', 's', 't', 'k', 'u', 'n', 's',
+	't', 's', 'a', 'm', 'm', 'l', 'u', 'n', 'g', 'k', 'u', 'n', 's', 't', 'u', 'n',
+	'd', 'd', 'e', 's', 'i', 'g', 'n', 'l', 'a', 'b', 'o', 'r', 'l', 'a', 'b', 'o',
+	'u', 'r', 'l', 'a', 'j', 'o', 'l', 'l', 'a', 'l', 'a', 'n', 'c', 'a', 's', 'h',
+	'i', 'r', 'e', 'l', 'a', 'n', 'd', 'e', 's', 'l', 'a', 'n', 's', 'l', 'a', 'r',
+	's', 's', 'o', 'n', 'l', 'e', 'w', 'i', 's', 'm', 'i', 'l', 'l', 'e', 'r', 'l',
+	'i', 'v', 'i', 'n', 'g', 'h', 'i', 's', 't', 'o', 'r', 'y', 'l', 'o', 'c', 'a',
+	'l', 'h', 'i', 's', 't', 'o', 'r', 'y', 'l', 'o', 's', 'a', 'n', 'g', 'e', 'l',
+	'e', 's', 'l', 'o', 'u', 'v', 'r', 'e', 'l', 'o', 'y', 'a', 'l', 'i', 's', 't',
+	'l', 'u', 'c', 'e', 'r', 'n', 'e', 'l', 'u', 'x', 'e', 'm', 'b', 'o', 'u', 'r',
+	'g', 'l', 'u', 'z', 'e', 'r', 'n', 'm', 'a', 'l', 'l', 'o', 'r', 'c', 'a', 'm',
+	'a', 'n', 'c', 'h', 'e', 's', 't', 'e', 'r', 'm', 'a', 'n', 's', 'i', 'o', 'n',
+	'm', 'a', 'n', 's', 'i', 'o', 'n', 's', 'm', 'a', 'n', 'x', 'm', 'a', 'r', 'b',
+	'u', 'r', 'g', 'm', 'a', 'r', 'i', 't', 'i', 'm', 'e', 'm', 'a', 'r', 'i', 't',
+	'i', 'm', 'o', 'm', 'a', 'r', 'y', 'l', 'a', 'n', 'd', 'm', 'a', 'r', 'y', 'l',
+	'h', 'u', 'r', 's', 't', 'm', 'e', 'd', 'i', 'c', 'a', 'l', 'm', 'e', 'd', 'i',
+	'z', 'i', 'n', 'h', 'i', 's', 't', 'o', 'r', 'i', 's', 'c', 'h', 'e', 's', 'm',
+	'e', 'e', 'r', 'e', 's', 'm', 'e', 's', 'a', 'v', 'e', 'r', 'd', 'e', 'm', 'i',
+	'c', 'h', 'i', 'g', 'a', 'n', 'm', 'i', 'd', 'a', 't', 'l', 'a', 'n', 't', 'i',
+	'c', 'm', 'i', 'l', 'i', 't', 'a', 'r', 'y', 'm', 'i', 'n', 'e', 'r', 's', 'm',
+	'i', 'n', 'i', 'n', 'g', 'm', 'i', 'n', 'n', 'e', 's', 'o', 't', 'a', 'm', 'i',
+	's', 's', 'i', 'l', 'e', 'm', 'o', 'd', 'e', 'r', 'n', 'm', 'o', 'n', 'm', 'o',
+	'u', 't', 'h', 'm', 'o', 'n', 't', 'i', 'c', 'e', 'l', 'l', 'o', 'm', 'o', 'n',
+	't', 'r', 'e', 'a', 'l', 'm', 'u', 'e', 'n', 'c', 'h', 'e', 'n', 'm', 'u', 'l',
+	'h', 'o', 'u', 's', 'e', 'm', 'u', 'n', 'c', 'i', 'e', 'm', 'u', 's', 'e', 'e',
+	't', 'm', 'u', 's', 'e', 'u', 'm', 'c', 'e', 'n', 't', 'e', 'r', 'm', 'u', 's',
+	'e', 'u', 'm', 'v', 'e', 'r', 'e', 'n', 'i', 'g', 'i', 'n', 'g', 'n', 'a', 't',
+	'i', 'o', 'n', 'a', 'l', 'f', 'i', 'r', 'e', 'a', 'r', 'm', 's', 'n', 'a', 't',
+	'i', 'o', 'n', 'a', 'l', 'h', 'e', 'r', 'i', 't', 'a', 'g', 'e', 'n', 'a', 't',
+	'i', 'v', 'e', 'a', 'm', 'e', 'r', 'i', 'c', 'a', 'n', 'n', 'a', 't', 'u', 'r',
+	'a', 'l', 'h', 'i', 's', 't', 'o', 'r', 'y', 'n', 'a', 't', 'u', 'r', 'a', 'l',
+	'h', 'i', 's', 't', 'o', 'r', 'y', 'm', 'u', 's', 'e', 'u', 'm', 'n', 'a', 't',
+	'u', 'r', 'a', 'l', 's', 'c', 'i', 'e', 'n', 'c', 'e', 's', 'n', 'a', 't', 'u',
+	'r', 'e', 'n', 'a', 't', 'u', 'r', 'h', 'i', 's', 't', 'o', 'r', 'i', 's', 'c',
+	'h', 'e', 's', 'n', 'a', 't', 'u', 'u', 'r', 'w', 'e', 't', 'e', 'n', 's', 'c',
+	'h', 'a', 'p', 'p', 'e', 'n', 'n', 'a', 'u', 'm', 'b', 'u', 'r', 'g', 'n', 'a',
+	'v', 'a', 'l', 'n', 'e', 'b', 'r', 'a', 's', 'k', 'a', 'n', 'e', 'u', 'e', 's',
+	'n', 'e', 'w', 'h', 'a', 'm', 'p', 's', 'h', 'i', 'r', 'e', 'n', 'e', 'w', 'j',
+	'e', 'r', 's', 'e', 'y', 'n', 'e', 'w', 'm', 'e', 'x', 'i', 'c', 'o', 'n', 'e',
+	'w', 'p', 'o', 'r', 't', 'n', 'e', 'w', 's', 'p', 'a', 'p', 'e', 'r', 'n', 'e',
+	'w', 'y', 'o', 'r', 'k', 'n', 'i', 'e', 'p', 'c', 'e', 'n', 'o', 'r', 'f', 'o',
+	'l', 'k', 'n', 'y', 'n', 'y', 'o', 'c', 'e', 'a', 'n', 'o', 'g', 'r', 'a', 'p',
+	'h', 'i', 'c', 'o', 'c', 'e', 'a', 'n', 'o', 'g', 'r', 'a', 'p', 'h', 'i', 'q',
+	'u', 'e', 'o', 'm', 'a', 'h', 'a', 'o', 'n', 't', 'a', 'r', 'i', 'o', 'o', 'p',
+	'e', 'n', 'a', 'i', 'r', 'o', 'r', 'e', 'g', 'o', 'n', 'o', 'r', 'e', 'g', 'o',
+	'n', 't', 'r', 'a', 'i', 'l', 'o', 't', 'a', 'g', 'o', 'o', 'x', 'f', 'o', 'r',
+	'd', 'p', 'a', 'c', 'i', 'f', 'i', 'c', 'p', 'a', 'd', 'e', 'r', 'b', 'o', 'r',
+	'n', 'p', 'a', 'l', 'a', 'c', 'e', 'p', 'a', 'l', 'e', 'o', 'p', 'a', 'l', 'm',
+	's', 'p', 'r', 'i', 'n', 'g', 's', 'p', 'a', 'n', 'a', 'm', 'a', 'p', 'a', 's',
+	'a', 'd', 'e', 'n', 'a', 'p', 'h', 'i', 'l', 'a', 'd', 'e', 'l', 'p', 'h', 'i',
+	'a', 'p', 'h', 'i', 'l', 'a', 'd', 'e', 'l', 'p', 'h', 'i', 'a', 'a', 'r', 'e',
+	'a', 'p', 'h', 'i', 'l', 'a', 't', 'e', 'l', 'y', 'p', 'h', 'o', 'e', 'n', 'i',
+	'x', 'p', 'i', 'l', 'o', 't', 's', 'p', 'i', 't', 't', 's', 'b', 'u', 'r', 'g',
+	'h', 'p', 'l', 'a', 'n', 'e', 't', 'a', 'r', 'i', 'u', 'm', 'p', 'l', 'a', 'n',
+	't', 'a', 't', 'i', 'o', 'n', 'p', 'l', 'a', 'n', 't', 's', 'p', 'l', 'a', 'z',
+	'a', 'p', 'o', 'r', 't', 'a', 'l', 'p', 'o', 'r', 't', 'l', 'a', 'n', 'd', 'p',
+	'o', 'r', 't', 'l', 'l', 'i', 'g', 'a', 't', 'p', 'o', 's', 't', 's', '-', 'a',
+	'n', 'd', '-', 't', 'e', 'l', 'e', 'c', 'o', 'm', 'm', 'u', 'n', 'i', 'c', 'a',
+	't', 'i', 'o', 'n', 's', 'p', 'r', 'e', 's', 'e', 'r', 'v', 'a', 't', 'i', 'o',
+	'n', 'p', 'r', 'e', 's', 'i', 'd', 'i', 'o', 'p', 'r', 'o', 'j', 'e', 'c', 't',
+	'p', 'u', 'b', 'o', 'l', 'r', 'a', 'i', 'l', 'r', 'o', 'a', 'd', 'r', 'a', 'i',
+	'l', 'w', 'a', 'y', 'r', 'e', 's', 'i', 's', 't', 'a', 'n', 'c', 'e', 'r', 'i',
+	'o', 'd', 'e', 'j', 'a', 'n', 'e', 'i', 'r', 'o', 'r', 'o', 'c', 'h', 'e', 's',
+	't', 'e', 'r', 'r', 'o', 'c', 'k', 'a', 'r', 't', 'r', 'u', 's', 's', 'i', 'a',
+	's', 'a', 'i', 'n', 't', 'l', 'o', 'u', 'i', 's', 's', 'a', 'l', 'v', 'a', 'd',
+	'o', 'r', 'd', 'a', 'l', 'i', 's', 'a', 'l', 'z', 'b', 'u', 'r', 'g', 's', 'a',
+	'n', 'd', 'i', 'e', 'g', 'o', 's', 'a', 'n', 'f', 'r', 'a', 'n', 'c', 'i', 's',
+	'c', 'o', 's', 'a', 'n', 't', 'a', 'b', 'a', 'r', 'b', 'a', 'r', 'a', 's', 'a',
+	'n', 't', 'a', 'c', 'r', 'u', 'z', 's', 'a', 'n', 't', 'a', 'f', 'e', 's', 'a',
+	's', 'k', 'a', 't', 'c', 'h', 'e', 'w', 'a', 'n', 's', 'a', 't', 'x', 's', 'a',
+	'v', 'a', 'n', 'n', 'a', 'h', 'g', 'a', 's', 'c', 'h', 'l', 'e', 's', 'i', 's',
+	'c', 'h', 'e', 's', 's', 'c', 'h', 'o', 'e', 'n', 'b', 'r', 'u', 'n', 'n', 's',
+	'c', 'h', 'o', 'k', 'o', 'l', 'a', 'd', 'e', 'n', 's', 'c', 'h', 'w', 'e', 'i',
+	'z', 's', 'c', 'i', 'e', 'n', 'c', 'e', '-', 'f', 'i', 'c', 't', 'i', 'o', 'n',
+	's', 'c', 'i', 'e', 'n', 'c', 'e', 'a', 'n', 'd', 'h', 'i', 's', 't', 'o', 'r',
+	'y', 's', 'c', 'i', 'e', 'n', 'c', 'e', 'a', 'n', 'd', 'i', 'n', 'd', 'u', 's',
+	't', 'r', 'y', 's', 'c', 'i', 'e', 'n', 'c', 'e', 'c', 'e', 'n', 't', 'e', 'r',
+	's', 'c', 'i', 'e', 'n', 'c', 'e', 'c', 'e', 'n', 't', 'e', 'r', 's', 's', 'c',
+	'i', 'e', 'n', 'c', 'e', 'h', 'i', 's', 't', 'o', 'r', 'y', 's', 'c', 'i', 'e',
+	'n', 'c', 'e', 's', 'n', 'a', 't', 'u', 'r', 'e', 'l', 'l', 'e', 's', 's', 'c',
+	'o', 't', 'l', 'a', 'n', 'd', 's', 'e', 'a', 'p', 'o', 'r', 't', 's', 'e', 't',
+	't', 'l', 'e', 'm', 'e', 'n', 't', 's', 'e', 't', 't', 'l', 'e', 'r', 's', 's',
+	'h', 'e', 'r', 'b', 'r', 'o', 'o', 'k', 'e', 's', 'i', 'b', 'e', 'n', 'i', 'k',
+	's', 'k', 'o', 'l', 'e', 's', 'o', 'l', 'o', 'g', 'n', 'e', 's', 'o', 'u', 'n',
+	'd', 'a', 'n', 'd', 'v', 'i', 's', 'i', 'o', 'n', 's', 'o', 'u', 't', 'h', 'c',
+	'a', 'r', 'o', 'l', 'i', 'n', 'a', 's', 'o', 'u', 't', 'h', 'w', 'e', 's', 't',
+	's', 'p', 'y', 's', 't', 'a', 'd', 't', 's', 't', 'a', 'l', 'b', 'a', 'n', 's',
+	's', 't', 'a', 'r', 'n', 'b', 'e', 'r', 'g', 's', 't', 'a', 't', 'e', 'o', 'f',
+	'd', 'e', 'l', 'a', 'w', 'a', 'r', 'e', 's', 't', 'e', 'a', 'm', 's', 't', 'e',
+	'i', 'e', 'r', 'm', 'a', 'r', 'k', 's', 't', 'j', 'o', 'h', 'n', 's', 't', 'p',
+	'e', 't', 'e', 'r', 's', 'b', 'u', 'r', 'g', 's', 't', 'u', 't', 't', 'g', 'a',
+	'r', 't', 's', 'u', 'i', 's', 's', 'e', 's', 'u', 'r', 'g', 'e', 'o', 'n', 's',
+	'h', 'a', 'l', 'l', 's', 'u', 'r', 'r', 'e', 'y', 's', 'v', 'i', 'z', 'z', 'e',
+	'r', 'a', 's', 'w', 'e', 'd', 'e', 'n', 't', 'a', 'n', 'k', 't', 'c', 'm', 't',
+	'e', 'l', 'e', 'k', 'o', 'm', 'm', 'u', 'n', 'i', 'k', 'a', 't', 'i', 'o', 'n',
+	't', 'e', 'l', 'e', 'v', 'i', 's', 'i', 'o', 'n', 't', 'e', 'x', 'a', 's', 't',
+	'e', 'x', 't', 'i', 'l', 'e', 't', 'i', 'm', 'e', 'k', 'e', 'e', 'p', 'i', 'n',
+	'g', 't', 'o', 'p', 'o', 'l', 'o', 'g', 'y', 't', 'o', 'u', 'c', 'h', 't', 'r',
+	'e', 'e', 't', 'r', 'o', 'l', 'l', 'e', 'y', 't', 'r', 'u', 's', 't', 'e', 'e',
+	'u', 'l', 'm', 'u', 'n', 'd', 'e', 'r', 's', 'e', 'a', 'u', 's', 'a', 'n', 't',
+	'i', 'q', 'u', 'e', 's', 'u', 's', 'a', 'r', 't', 's', 'u', 's', 'c', 'o', 'u',
+	'n', 't', 'r', 'y', 'e', 's', 't', 'a', 't', 'e', 'u', 's', 'c', 'u', 'l', 't',
+	'u', 'r', 'e', 'u', 's', 'd', 'e', 'c', 'o', 'r', 'a', 't', 'i', 'v', 'e', 'a',
+	'r', 't', 's', 'u', 's', 'g', 'a', 'r', 'd', 'e', 'n', 'u', 's', 'h', 'i', 's',
+	't', 'o', 'r', 'y', 'u', 's', 'h', 'u', 'a', 'i', 'a', 'u', 's', 'l', 'i', 'v',
+	'i', 'n', 'g', 'h', 'i', 's', 't', 'o', 'r', 'y', 'u', 't', 'a', 'h', 'u', 'v',
+	'i', 'c', 'v', 'a', 'n', 't', 'a', 'a', 'v', 'e', 'r', 's', 'a', 'i', 'l', 'l',
+	'e', 's', 'v', 'i', 'l', 'l', 'a', 'g', 'e', 'v', 'i', 'r', 'g', 'i', 'n', 'i',
+	'a', 'v', 'i', 'r', 't', 'u', 'e', 'l', 'v', 'o', 'l', 'k', 'e', 'n', 'k', 'u',
+	'n', 'd', 'e', 'w', 'a', 'l', 'l', 'o', 'n', 'i', 'e', 'w', 'a', 's', 'h', 'i',
+	'n', 'g', 't', 'o', 'n', 'd', 'c', 'w', 'a', 't', 'c', 'h', '-', 'a', 'n', 'd',
+	'-', 'c', 'l', 'o', 'c', 'k', 'w', 'a', 't', 'c', 'h', 'a', 'n', 'd', 'c', 'l',
+	'o', 'c', 'k', 'w', 'e', 's', 't', 'f', 'a', 'l', 'e', 'n', 'w', 'h', 'a', 'l',
+	'i', 'n', 'g', 'w', 'i', 'l', 'd', 'l', 'i', 'f', 'e', 'w', 'i', 'n', 'd', 'm',
+	'i', 'l', 'l', 'w', 'o', 'r', 'k', 's', 'h', 'o', 'p', 'x', 'n', '-', '-', '9',
+	'd', 'b', 'h', 'b', 'l', 'g', '6', 'd', 'i', 'x', 'n', '-', '-', 'c', 'o', 'm',
+	'u', 'n', 'i', 'c', 'a', 'e', 's', '-', 'v', '6', 'a', '2', 'o', 'x', 'n', '-',
+	'-', 'c', 'o', 'r', 'r', 'e', 'i', 'o', 's', '-', 'e', '-', 't', 'e', 'l', 'e',
+	'c', 'o', 'm', 'u', 'n', 'i', 'c', 'a', 'e', 's', '-', 'g', 'h', 'c', '2', '9',
+	'a', 'x', 'n', '-', '-', 'h', '1', 'a', 'e', 'g', 'h', 'x', 'n', '-', '-', 'l',
+	'n', 's', '-', 'q', 'l', 'a', 'y', 'o', 'r', 'k', 's', 'h', 'i', 'r', 'e', 'y',
+	'o', 's', 'e', 'm', 'i', 't', 'e', 'y', 'o', 'u', 't', 'h', 'z', 'o', 'o', 'l',
+	'o', 'g', 'i', 'c', 'a', 'l', 'z', 'o', 'o', 'l', 'o', 'g', 'y', 'a', 'd', 'o',
+	'b', 'e', 'i', 'o', '-', 's', 't', 'a', 't', 'i', 'c', 'a', 'd', 'o', 'b', 'e',
+	'i', 'o', 'r', 'u', 'n', 't', 'i', 'm', 'e', 'a', 'k', 'a', 'd', 'n', 's', 'a',
+	'k', 'a', 'm', 'a', 'i', 'a', 'k', 'a', 'm', 'a', 'i', '-', 's', 't', 'a', 'g',
+	'i', 'n', 'g', 'a', 'k', 'a', 'm', 'a', 'i', 'e', 'd', 'g', 'e', 'a', 'k', 'a',
+	'm', 'a', 'i', 'e', 'd', 'g', 'e', '-', 's', 't', 'a', 'g', 'i', 'n', 'g', 'a',
+	'k', 'a', 'm', 'a', 'i', 'h', 'd', 'a', 'k', 'a', 'm', 'a', 'i', 'h', 'd', '-',
+	's', 't', 'a', 'g', 'i', 'n', 'g', 'a', 'k', 'a', 'm', 'a', 'i', 'o', 'r', 'i',
+	'g', 'i', 'n', 'a', 'k', 'a', 'm', 'a', 'i', 'o', 'r', 'i', 'g', 'i', 'n', '-',
+	's', 't', 'a', 'g', 'i', 'n', 'g', 'a', 'k', 'a', 'm', 'a', 'i', 'z', 'e', 'd',
+	'a', 'k', 'a', 'm', 'a', 'i', 'z', 'e', 'd', '-', 's', 't', 'a', 'g', 'i', 'n',
+	'g', 'a', 'l', 'w', 'a', 'y', 's', 'd', 'a', 't', 'a', 'a', 'p', 'p', 'u', 'd',
+	'o', 'a', 't', '-', 'b', 'a', 'n', 'd', '-', 'c', 'a', 'm', 'p', 'a', 't', 'l',
+	'a', 's', 's', 'i', 'a', 'n', '-', 'd', 'e', 'v', 'a', 'z', 'u', 'r', 'e', '-',
+	'm', 'o', 'b', 'i', 'l', 'e', 'a', 'z', 'u', 'r', 'e', 's', 't', 'a', 't', 'i',
+	'c', 'a', 'p', 'p', 's', 'a', 'z', 'u', 'r', 'e', 'w', 'e', 'b', 's', 'i', 't',
+	'e', 's', 'b', 'a', 'r', '0', 'b', 'a', 'r', '1', 'b', 'a', 'r', '2', 'b', 'i',
+	't', 'b', 'r', 'i', 'd', 'g', 'e', 'b', 'l', 'a', 'c', 'k', 'b', 'a', 'u', 'd',
+	'c', 'd', 'n', 'b', 'o', 'o', 'm', 'l', 'a', 'b', 'o', 'u', 'n', 'c', 'e', 'm',
+	'e', 'b', 'r', 'o', 'k', 'e', '-', 'i', 't', 'b', 'u', 'y', 's', 'h', 'o', 'u',
+	's', 'e', 's', 'c', 'a', 's', 'a', 'c', 'a', 'm', 'c', 'd', 'n', '-', 'e', 'd',
+	'g', 'e', 's', 'c', 'd', 'n', '7', '7', 'c', 'd', 'n', '7', '7', '-', 's', 's',
+	'l', 'c', 'h', 'a', 'n', 'n', 'e', 'l', 's', 'd', 'v', 'r', 'c', 'l', 'i', 'c',
+	'k', 'r', 'i', 's', 'i', 'n', 'g', 'c', 'l', 'o', 'u', 'd', 'f', 'r', 'o', 'n',
+	't', 'c', 'l', 'o', 'u', 'd', 'f', 'u', 'n', 'c', 't', 'i', 'o', 'n', 's', 'c',
+	'l', 'o', 'u', 'd', 'j', 'i', 'f', 'f', 'y', 'c', 'l', 'o', 'u', 'd', 'y', 'c',
+	'l', 'u', 's', 't', 'e', 'r', 'c', 'r', 'y', 'p', 't', 'o', 'n', 'o', 'm', 'i',
+	'c', 'd', 'e', 'b', 'i', 'a', 'n', 'd', 'o', 'e', 's', '-', 'i', 't', 'd', 'y',
+	'n', 'a', 't', 'h', 'o', 'm', 'e', 'd', 'y', 'n', 'u', 'd', 'y', 'n', 'v', '6',
+	'e', 'a', 't', 'i', 'n', 'g', '-', 'o', 'r', 'g', 'a', 'n', 'i', 'c', 'e', 'd',
+	'g', 'e', 'a', 'p', 'p', 'e', 'd', 'g', 'e', 'k', 'e', 'y', 'e', 'd', 'g', 'e',
+	'k', 'e', 'y', '-', 's', 't', 'a', 'g', 'i', 'n', 'g', 'e', 'd', 'g', 'e', 's',
+	'u', 'i', 't', 'e', 'e', 'd', 'g', 'e', 's', 'u', 'i', 't', 'e', '-', 's', 't',
+	'a', 'g', 'i', 'n', 'g', 'e', 'l', 'a', 's', 't', 'x', 'e', 'n', 'd', 'o', 'f',
+	'i', 'n', 't', 'e', 'r', 'n', 'e', 't', 'f', 'a', 's', 't', 'l', 'y', 'l', 'b',
+	'f', 'a', 's', 't', 's', 't', 'a', 'c', 'k', 's', 'f', 'e', 's', 't', 'e', '-',
+	'i', 'p', 'f', 'l', 'y', 'n', 'n', 'h', 'o', 's', 't', 'i', 'n', 'g', 'f', 'r',
+	'o', 'm', '-', 'a', 'z', 'f', 'r', 'o', 'm', '-', 'c', 'o', 'f', 'r', 'o', 'm',
+	'-', 'l', 'a', 'f', 'r', 'o', 'm', '-', 'n', 'y', 'g', 'e', 't', 's', '-', 'i',
+	't', 'h', 'a', 'm', '-', 'r', 'a', 'd', 'i', 'o', '-', 'o', 'p', 'h', 'e', 't',
+	'e', 'm', 'l', 'h', 'i', 'c', 'a', 'm', 'h', 'o', 'm', 'e', 'f', 't', 'p', 'h',
+	'o', 'm', 'e', 'i', 'p', 'i', 'n', '-', 't', 'h', 'e', '-', 'b', 'a', 'n', 'd',
+	'i', 'o', 'b', 'b', 'i', 'p', 'i', 'f', 'o', 'n', 'y', 'k', 'i', 'c', 'k', 's',
+	'-', 'a', 's', 's', 'k', 'i', 'n', 'g', 'h', 'o', 's', 't', 'k', 'n', 'x', '-',
+	's', 'e', 'r', 'v', 'e', 'r', 'k', 'r', 'e', 'l', 'l', 'i', 'a', 'n', 'm', 'e',
+	'i', 'n', 'f', 'o', 'r', 'u', 'm', 'm', 'e', 'm', 's', 'e', 't', 'm', 'y', 'a',
+	'm', 'a', 'z', 'e', 'm', 'y', 'd', 'i', 's', 's', 'e', 'n', 't', 'm', 'y', 'e',
+	'f', 'f', 'e', 'c', 't', 'm', 'y', 'f', 'r', 'i', 't', 'z', 'm', 'y', 'm', 'e',
+	'd', 'i', 'a', 'p', 'c', 'm', 'y', 'p', 's', 'x', 'n', 'h', 'l', 'f', 'a', 'n',
+	'n', 'o', 'w', '-', 'd', 'n', 's', 'o', 'f', 'f', 'i', 'c', 'e', '-', 'o', 'n',
+	'-', 't', 'h', 'e', 'o', 'n', 'a', 'v', 's', 't', 'a', 'c', 'k', 'o', 'w', 'n',
+	'i', 'p', 'p', 'g', 'a', 'f', 'a', 'n', 'p', 'o', 'd', 'z', 'o', 'n', 'e', 'p',
+	'r', 'i', 'v', 'a', 't', 'i', 'z', 'e', 'h', 'e', 'a', 'l', 't', 'h', 'i', 'n',
+	's', 'u', 'r', 'a', 'n', 'c', 'e', 'r', 'e', 'd', 'i', 'r', 'e', 'c', 't', 'm',
+	'e', 's', 'a', 'v', 'e', 'i', 'n', 'c', 'l', 'o', 'u', 'd', 's', 'c', 'a', 'l',
+	'e', 'f', 'o', 'r', 'c', 'e', 's', 'c', 'h', 'o', 'k', 'o', 'k', 'e', 'k', 's',
+	's', 'c', 'r', 'a', 'p', 'p', 'e', 'r', '-', 's', 'i', 't', 'e', 's', 'e', 'i',
+	'd', 'a', 't', 's', 'e', 'l', 'l', 's', '-', 'i', 't', 's', 'e', 'n', 's', 'e',
+	'e', 'r', 'i', 'n', 'g', 's', 'e', 'r', 'v', 'e', 'b', 'l', 'o', 'g', 's', 'e',
+	'r', 'v', 'e', 'm', 'i', 'n', 'e', 'c', 'r', 'a', 'f', 't', 's', 'h', 'o', 'p',
+	's', 'e', 'l', 'e', 'c', 't', 's', 'i', 't', 'e', 'l', 'e', 'a', 'f', 's', 'r',
+	'c', 'f', 's', 't', 'a', 't', 'i', 'c', '-', 'a', 'c', 'c', 'e', 's', 's', 't',
+	'3', 'l', '3', 'p', '0', 'r', 't', 't', 'a', 'i', 'l', 's', 'c', 'a', 'l', 'e',
+	't', 'h', 'r', 'u', 'h', 'e', 'r', 'e', 't', 'o', 'r', 'p', 'r', 'o', 'j', 'e',
+	'c', 't', 't', 's', 'u', 'k', 'a', 'e', 'r', 'u', 'u', 'n', 'i', '5', 'v', 'p',
+	'n', 'd', 'n', 's', 'v', 'p', 's', '-', 'h', 'o', 's', 't', 'y', 'a', 'n', 'd',
+	'e', 'x', 'c', 'l', 'o', 'u', 'd', 'a', 'l', 'c', 'e', 's', 'a', 'r', 'v', 'o',
+	'a', 'z', 'i', 'm', 'u', 't', 'h', 't', 'l', 'o', 'n', 'n', 'o', 't', 'i', 'c',
+	'e', 'a', 'b', 'l', 'e', 'c', 'i', 's', 't', 'r', 'o', 'n', 'd', 'e', 'm', 'o',
+	'n', 'h', 'o', 's', 't', 'i', 'n', 'g', '-', 'c', 'l', 'u', 's', 't', 'e', 'r',
+	'k', 'h', 'p', 'l', 'a', 'y', 'a', 'a', 'r', 'b', 'o', 'r', 't', 'e', 'a', 'e',
+	'j', 'r', 'i', 'e', 'a', 'f', 'j', 'o', 'r', 'd', 'a', 'g', 'd', 'e', 'n', 'e',
+	's', 'a', 'k', 'e', 'r', 's', 'h', 'u', 's', 'a', 'k', 'n', 'o', 'l', 'u', 'o',
+	'k', 't', 'a', 'a', 'k', 'r', 'e', 'h', 'a', 'm', 'n', 'a', 'l', 'a', 'h', 'e',
+	'a', 'd', 'j', 'u', 'a', 'l', 'e', 's', 'u', 'n', 'd', 'a', 'l', 's', 't', 'a',
+	'h', 'a', 'u', 'g', 'a', 'l', 'v', 'd', 'a', 'l', 'a', 'n', 'd', 'a', 's', 'u',
+	'o', 'l', 'o', 'a', 'n', 'd', 'e', 'b', 'u', 'a', 'n', 'd', 'o', 'y', 'a', 'r',
+	'e', 'm', 'a', 'r', 'k', 'a', 'r', 'e', 'n', 'd', 'a', 'l', 'a', 'r', 'n', 'a',
+	'a', 's', 'e', 'r', 'a', 'l', 'a', 's', 'k', 'e', 'r', 'a', 's', 'k', 'i', 'm',
+	'a', 's', 'k', 'o', 'y', 'a', 's', 'k', 'v', 'o', 'l', 'l', 'a', 's', 'n', 'e',
+	's', 'a', 'u', 'd', 'n', 'e', 'd', 'a', 'l', 'n', 'a', 'u', 'k', 'r', 'a', 'a',
+	'u', 'r', 'e', 'a', 'u', 'r', 'l', 'a', 'n', 'd', 'a', 'u', 'r', 's', 'k', 'o',
+	'g', '-', 'h', 'o', 'l', 'a', 'n', 'd', 'a', 'u', 's', 't', 'e', 'v', 'o', 'l',
+	'l', 'a', 'u', 's', 't', 'r', 'h', 'e', 'i', 'm', 'a', 'v', 'e', 'r', 'o', 'y',
+	'b', 'a', 'd', 'a', 'd', 'd', 'j', 'a', 'b', 'a', 'h', 'c', 'a', 'v', 'u', 'o',
+	't', 'n', 'a', 'b', 'a', 'h', 'c', 'c', 'a', 'v', 'u', 'o', 't', 'n', 'a', 'b',
+	'a', 'i', 'd', 'a', 'r', 'b', 'a', 'j', 'd', 'd', 'a', 'r', 'b', 'a', 'l', 'a',
+	't', 'b', 'a', 'l', 'e', 's', 't', 'r', 'a', 'n', 'd', 'b', 'a', 'l', 'l', 'a',
+	'n', 'g', 'e', 'n', 'b', 'a', 'l', 's', 'f', 'j', 'o', 'r', 'd', 'b', 'a', 'm',
+	'b', 'l', 'e', 'b', 'a', 'r', 'd', 'u', 'b', 'a', 'r', 'u', 'm', 'b', 'a', 't',
+	's', 'f', 'j', 'o', 'r', 'd', 'b', 'e', 'a', 'r', 'a', 'l', 'v', 'a', 'h', 'k',
+	'i', 'b', 'e', 'a', 'r', 'd', 'u', 'b', 'e', 'i', 'a', 'r', 'n', 'b', 'e', 'r',
+	'g', 'e', 'n', 'b', 'e', 'r', 'l', 'e', 'v', 'a', 'g', 'b', 'i', 'e', 'v', 'a',
+	't', 'b', 'i', 'n', 'd', 'a', 'l', 'b', 'i', 'r', 'k', 'e', 'n', 'e', 's', 'b',
+	'j', 'a', 'r', 'k', 'o', 'y', 'b', 'j', 'e', 'r', 'k', 'r', 'e', 'i', 'm', 'b',
+	'j', 'u', 'g', 'n', 'b', 'o', 'd', 'o', 'b', 'o', 'k', 'n', 'b', 'o', 'm', 'l',
+	'o', 'b', 'r', 'e', 'm', 'a', 'n', 'g', 'e', 'r', 'b', 'r', 'o', 'n', 'n', 'o',
+	'y', 'b', 'r', 'o', 'n', 'n', 'o', 'y', 's', 'u', 'n', 'd', 'b', 'r', 'u', 'm',
+	'u', 'n', 'd', 'd', 'a', 'l', 'b', 'r', 'y', 'n', 'e', 'b', 'u', 'd', 'e', 'j',
+	'j', 'u', 'b', 'u', 's', 'k', 'e', 'r', 'u', 'd', 'b', 'y', 'g', 'l', 'a', 'n',
+	'd', 'b', 'y', 'k', 'l', 'e', 'c', 'a', 'h', 'c', 'e', 's', 'u', 'o', 'l', 'o',
+	'd', 'a', 'v', 'v', 'e', 'n', 'j', 'a', 'r', 'g', 'a', 'd', 'a', 'v', 'v', 'e',
+	's', 'i', 'i', 'd', 'a', 'd', 'e', 'a', 't', 'n', 'u', 'd', 'i', 'e', 'l', 'd',
+	'd', 'a', 'n', 'u', 'o', 'r', 'r', 'i', 'd', 'i', 'v', 't', 'a', 's', 'v', 'u',
+	'o', 'd', 'n', 'a', 'd', 'i', 'v', 't', 't', 'a', 's', 'v', 'u', 'o', 't', 'n',
+	'a', 'd', 'o', 'n', 'n', 'a', 'd', 'o', 'v', 'r', 'e', 'd', 'r', 'a', 'm', 'm',
+	'e', 'n', 'd', 'r', 'a', 'n', 'g', 'e', 'd', 'a', 'l', 'd', 'r', 'o', 'b', 'a',
+	'k', 'd', 'y', 'r', 'o', 'y', 'e', 'g', 'e', 'r', 's', 'u', 'n', 'd', 'e', 'i',
+	'd', 'f', 'j', 'o', 'r', 'd', 'e', 'i', 'd', 's', 'b', 'e', 'r', 'g', 'e', 'i',
+	'd', 's', 'k', 'o', 'g', 'e', 'i', 'd', 's', 'v', 'o', 'l', 'l', 'e', 'i', 'g',
+	'e', 'r', 's', 'u', 'n', 'd', 'e', 'l', 'v', 'e', 'r', 'u', 'm', 'e', 'n', 'e',
+	'b', 'a', 'k', 'k', 'e', 'n', 'g', 'e', 'r', 'd', 'a', 'l', 'e', 't', 'n', 'e',
+	'e', 't', 'n', 'e', 'd', 'a', 'l', 'e', 'v', 'e', 'n', 'a', 's', 's', 'i', 'e',
+	'v', 'e', 'n', 'e', 's', 'e', 'v', 'j', 'e', '-', 'o', 'g', '-', 'h', 'o', 'r',
+	'n', 'n', 'e', 's', 'f', 'a', 'r', 's', 'u', 'n', 'd', 'f', 'a', 'u', 's', 'k',
+	'e', 'f', 'e', 'd', 'j', 'e', 'f', 'e', 't', 's', 'u', 'n', 'd', 'f', 'h', 's',
+	'f', 'i', 'n', 'n', 'o', 'y', 'f', 'i', 't', 'j', 'a', 'r', 'f', 'j', 'a', 'l',
+	'e', 'r', 'f', 'j', 'e', 'l', 'l', 'f', 'l', 'a', 'k', 's', 't', 'a', 'd', 'f',
+	'l', 'a', 't', 'a', 'n', 'g', 'e', 'r', 'f', 'l', 'e', 'k', 'k', 'e', 'f', 'j',
+	'o', 'r', 'd', 'f', 'l', 'e', 's', 'b', 'e', 'r', 'g', 'f', 'l', 'o', 'r', 'a',
+	'f', 'l', 'o', 'r', 'o', 'f', 'o', 'l', 'k', 'e', 'b', 'i', 'b', 'l', 'f', 'o',
+	'l', 'l', 'd', 'a', 'l', 'f', 'o', 'r', 'd', 'e', 'f', 'o', 'r', 's', 'a', 'n',
+	'd', 'f', 'o', 's', 'n', 'e', 's', 'f', 'r', 'a', 'n', 'a', 'f', 'r', 'e', 'd',
+	'r', 'i', 'k', 's', 't', 'a', 'd', 'f', 'r', 'o', 'g', 'n', 'f', 'r', 'o', 'l',
+	'a', 'n', 'd', 'f', 'r', 'o', 's', 't', 'a', 'f', 'r', 'o', 'y', 'a', 'f', 'u',
+	'o', 'i', 's', 'k', 'u', 'f', 'u', 'o', 's', 's', 'k', 'o', 'f', 'u', 's', 'a',
+	'f', 'y', 'l', 'k', 'e', 's', 'b', 'i', 'b', 'l', 'f', 'y', 'r', 'e', 's', 'd',
+	'a', 'l', 'g', 'a', 'i', 'v', 'u', 'o', 't', 'n', 'a', 'g', 'a', 'l', 's', 'a',
+	'g', 'a', 'm', 'v', 'i', 'k', 'g', 'a', 'n', 'g', 'a', 'v', 'i', 'i', 'k', 'a',
+	'g', 'a', 'u', 'l', 'a', 'r', 'g', 'a', 'u', 's', 'd', 'a', 'l', 'g', 'i', 'e',
+	'h', 't', 'a', 'v', 'u', 'o', 'a', 't', 'n', 'a', 'g', 'i', 'l', 'd', 'e', 's',
+	'k', 'a', 'l', 'g', 'i', 's', 'k', 'e', 'g', 'j', 'e', 'm', 'n', 'e', 's', 'g',
+	'j', 'e', 'r', 'd', 'r', 'u', 'm', 'g', 'j', 'e', 'r', 's', 't', 'a', 'd', 'g',
+	'j', 'e', 's', 'd', 'a', 'l', 'g', 'j', 'o', 'v', 'i', 'k', 'g', 'l', 'o', 'p',
+	'p', 'e', 'n', 'g', 'r', 'a', 'n', 'e', 'g', 'r', 'a', 'n', 'v', 'i', 'n', 'g',
+	'r', 'a', 't', 'a', 'n', 'g', 'e', 'n', 'g', 'r', 'i', 'm', 's', 't', 'a', 'd',
+	'g', 'r', 'o', 'n', 'g', 'g', 'r', 'u', 'e', 'g', 'u', 'l', 'e', 'n', 'g', 'u',
+	'o', 'v', 'd', 'a', 'g', 'e', 'a', 'i', 'd', 'n', 'u', 'h', 'a', 'b', 'm', 'e',
+	'r', 'h', 'a', 'd', 's', 'e', 'l', 'h', 'a', 'g', 'e', 'b', 'o', 's', 't', 'a',
+	'd', 'h', 'a', 'l', 'd', 'e', 'n', 'h', 'a', 'l', 's', 'a', 'h', 'a', 'm', 'a',
+	'r', 'h', 'a', 'm', 'a', 'r', 'o', 'y', 'h', 'a', 'm', 'm', 'a', 'r', 'f', 'e',
+	'a', 's', 't', 'a', 'h', 'a', 'm', 'm', 'e', 'r', 'f', 'e', 's', 't', 'h', 'a',
+	'p', 'm', 'i', 'r', 'h', 'a', 'r', 'a', 'm', 'h', 'a', 'r', 'e', 'i', 'd', 'h',
+	'a', 'r', 's', 't', 'a', 'd', 'h', 'a', 's', 'v', 'i', 'k', 'h', 'a', 't', 't',
+	'f', 'j', 'e', 'l', 'l', 'd', 'a', 'l', 'h', 'a', 'u', 'g', 'e', 's', 'u', 'n',
+	'd', 'h', 'e', 'd', 'm', 'a', 'r', 'k', 'h', 'e', 'm', 'n', 'e', 'h', 'e', 'm',
+	'n', 'e', 's', 'h', 'e', 'm', 's', 'e', 'd', 'a', 'l', 'h', 'e', 'r', 'a', 'd',
+	'h', 'i', 't', 'r', 'a', 'h', 'j', 'a', 'r', 't', 'd', 'a', 'l', 'h', 'j', 'e',
+	'l', 'm', 'e', 'l', 'a', 'n', 'd', 'h', 'o', 'b', 'o', 'l', 'h', 'o', 'k', 'k',
+	's', 'u', 'n', 'd', 'h', 'o', 'l', 'e', 'h', 'o', 'l', 'm', 'e', 's', 't', 'r',
+	'a', 'n', 'd', 'h', 'o', 'l', 't', 'a', 'l', 'e', 'n', 'h', 'o', 'n', 'e', 'f',
+	'o', 's', 's', 'h', 'o', 'r', 'd', 'a', 'l', 'a', 'n', 'd', 'h', 'o', 'r', 'n',
+	'i', 'n', 'd', 'a', 'l', 'h', 'o', 'r', 't', 'e', 'n', 'h', 'o', 'y', 'a', 'n',
+	'g', 'e', 'r', 'h', 'o', 'y', 'l', 'a', 'n', 'd', 'e', 't', 'h', 'u', 'r', 'd',
+	'a', 'l', 'h', 'u', 'r', 'u', 'm', 'h', 'v', 'a', 'l', 'e', 'r', 'h', 'y', 'l',
+	'l', 'e', 's', 't', 'a', 'd', 'i', 'b', 'e', 's', 't', 'a', 'd', 'i', 'd', 'r',
+	'e', 't', 't', 'i', 'n', 'd', 'e', 'r', 'o', 'y', 'i', 'v', 'e', 'l', 'a', 'n',
+	'd', 'i', 'v', 'g', 'u', 'j', 'a', 'n', '-', 'm', 'a', 'y', 'e', 'n', 'j', 'e',
+	's', 's', 'h', 'e', 'i', 'm', 'j', 'e', 'v', 'n', 'a', 'k', 'e', 'r', 'j', 'o',
+	'l', 's', 't', 'e', 'r', 'j', 'o', 'n', 'd', 'a', 'l', 'j', 'o', 'r', 'p', 'e',
+	'l', 'a', 'n', 'd', 'k', 'a', 'f', 'j', 'o', 'r', 'd', 'k', 'a', 'r', 'a', 's',
+	'j', 'o', 'h', 'k', 'a', 'k', 'a', 'r', 'a', 's', 'j', 'o', 'k', 'k', 'a', 'r',
+	'l', 's', 'o', 'y', 'k', 'a', 'r', 'm', 'o', 'y', 'k', 'a', 'u', 't', 'o', 'k',
+	'e', 'i', 'n', 'o', 'k', 'i', 'r', 'k', 'e', 'n', 'e', 's', 'k', 'l', 'a', 'b',
+	'u', 'k', 'l', 'e', 'p', 'p', 'k', 'o', 'm', 'm', 'u', 'n', 'e', 'k', 'o', 'n',
+	'g', 's', 'b', 'e', 'r', 'g', 'k', 'o', 'n', 'g', 's', 'v', 'i', 'n', 'g', 'e',
+	'r', 'k', 'o', 'p', 'e', 'r', 'v', 'i', 'k', 'k', 'r', 'a', 'a', 'n', 'g', 'h',
+	'k', 'e', 'k', 'r', 'a', 'g', 'e', 'r', 'o', 'k', 'r', 'i', 's', 't', 'i', 'a',
+	'n', 's', 'a', 'n', 'd', 'k', 'r', 'i', 's', 't', 'i', 'a', 'n', 's', 'u', 'n',
+	'd', 'k', 'r', 'o', 'd', 's', 'h', 'e', 'r', 'a', 'd', 'k', 'r', 'o', 'k', 's',
+	't', 'a', 'd', 'e', 'l', 'v', 'a', 'k', 'v', 'a', 'f', 'j', 'o', 'r', 'd', 'k',
+	'v', 'a', 'l', 's', 'u', 'n', 'd', 'k', 'v', 'a', 'm', 'k', 'v', 'a', 'n', 'a',
+	'n', 'g', 'e', 'n', 'k', 'v', 'i', 'n', 'e', 's', 'd', 'a', 'l', 'k', 'v', 'i',
+	'n', 'n', 'h', 'e', 'r', 'a', 'd', 'k', 'v', 'i', 't', 'e', 's', 'e', 'i', 'd',
+	'k', 'v', 'i', 't', 's', 'o', 'y', 'l', 'a', 'a', 'k', 'e', 's', 'v', 'u', 'e',
+	'm', 'i', 'e', 'l', 'a', 'h', 'p', 'p', 'i', 'l', 'a', 'n', 'g', 'e', 'v', 'a',
+	'g', 'l', 'a', 'r', 'd', 'a', 'l', 'l', 'a', 'r', 'v', 'i', 'k', 'l', 'a', 'v',
+	'a', 'g', 'i', 's', 'l', 'a', 'v', 'a', 'n', 'g', 'e', 'n', 'l', 'e', 'a', 'n',
+	'g', 'a', 'v', 'i', 'i', 'k', 'a', 'l', 'e', 'b', 'e', 's', 'b', 'y', 'l', 'e',
+	'i', 'k', 'a', 'n', 'g', 'e', 'r', 'l', 'e', 'i', 'r', 'f', 'j', 'o', 'r', 'd',
+	'l', 'e', 'i', 'r', 'v', 'i', 'k', 'l', 'e', 'k', 'a', 'l', 'e', 'k', 's', 'v',
+	'i', 'k', 'l', 'e', 'n', 'v', 'i', 'k', 'l', 'e', 'r', 'd', 'a', 'l', 'l', 'e',
+	's', 'j', 'a', 'l', 'e', 'v', 'a', 'n', 'g', 'e', 'r', 'l', 'i', 'e', 'r', 'n',
+	'e', 'l', 'i', 'l', 'l', 'e', 'h', 'a', 'm', 'm', 'e', 'r', 'l', 'i', 'l', 'l',
+	'e', 's', 'a', 'n', 'd', 'l', 'i', 'n', 'd', 'a', 's', 'l', 'i', 'n', 'd', 'e',
+	's', 'n', 'e', 's', 'l', 'o', 'a', 'b', 'a', 't', 'l', 'o', 'd', 'i', 'n', 'g',
+	'e', 'n', 'l', 'o', 'p', 'p', 'a', 'l', 'o', 'r', 'e', 'n', 's', 'k', 'o', 'g',
+	'l', 'o', 't', 'e', 'n', 'l', 'u', 'n', 'n', 'e', 'r', 'l', 'u', 'r', 'o', 'y',
+	'l', 'y', 'n', 'g', 'd', 'a', 'l', 'l', 'y', 'n', 'g', 'e', 'n', 'm', 'a', 'l',
+	'a', 't', 'v', 'u', 'o', 'p', 'm', 'i', 'm', 'a', 'l', 's', 'e', 'l', 'v', 'm',
+	'a', 'l', 'v', 'i', 'k', 'm', 'a', 'n', 'd', 'a', 'l', 'm', 'a', 'r', 'k', 'e',
+	'r', 'm', 'a', 'r', 'n', 'a', 'r', 'd', 'a', 'l', 'm', 'a', 's', 'f', 'j', 'o',
+	'r', 'd', 'e', 'n', 'm', 'a', 's', 'o', 'y', 'm', 'a', 't', 't', 'a', '-', 'v',
+	'a', 'r', 'j', 'j', 'a', 't', 'm', 'e', 'l', 'd', 'a', 'l', 'm', 'e', 'l', 'h',
+	'u', 's', 'm', 'e', 'l', 'o', 'y', 'm', 'e', 'r', 'a', 'k', 'e', 'r', 'm', 'i',
+	'd', 's', 'u', 'n', 'd', 'm', 'i', 'd', 't', 'r', 'e', '-', 'g', 'a', 'u', 'l',
+	'd', 'a', 'l', 'm', 'j', 'o', 'n', 'd', 'a', 'l', 'e', 'n', 'm', 'o', '-', 'i',
+	'-', 'r', 'a', 'n', 'a', 'm', 'o', 'a', 'r', 'e', 'k', 'e', 'm', 'o', 'd', 'a',
+	'l', 'e', 'n', 'm', 'o', 'd', 'u', 'm', 'm', 'o', 'l', 'd', 'e', 'm', 'o', 'r',
+	'e', '-', 'o', 'g', '-', 'r', 'o', 'm', 's', 'd', 'a', 'l', 'm', 'o', 's', 'j',
+	'o', 'e', 'n', 'm', 'o', 's', 'k', 'e', 'n', 'e', 's', 'm', 'o', 's', 's', 'm',
+	'o', 's', 'v', 'i', 'k', 'm', 'u', 'o', 's', 'a', 't', 'n', 'a', 'a', 'm', 'e',
+	's', 'j', 'e', 'v', 'u', 'e', 'm', 'i', 'e', 'n', 'a', 'm', 'd', 'a', 'l', 's',
+	'e', 'i', 'd', 'n', 'a', 'm', 's', 'o', 's', 'n', 'a', 'm', 's', 's', 'k', 'o',
+	'g', 'a', 'n', 'n', 'a', 'n', 'n', 'e', 's', 't', 'a', 'd', 'n', 'a', 'r', 'o',
+	'y', 'n', 'a', 'r', 'v', 'i', 'i', 'k', 'a', 'n', 'a', 'r', 'v', 'i', 'k', 'n',
+	'a', 'u', 's', 't', 'd', 'a', 'l', 'n', 'a', 'v', 'u', 'o', 't', 'n', 'a', 'n',
+	'e', 'd', 'r', 'e', '-', 'e', 'i', 'k', 'e', 'r', 'n', 'e', 's', 'n', 'a', 'n',
+	'e', 's', 'o', 'd', 'd', 'e', 'n', 'n', 'e', 's', 'o', 'd', 'd', 't', 'a', 'n',
+	'g', 'e', 'n', 'n', 'e', 's', 's', 'e', 'b', 'y', 'n', 'e', 's', 's', 'e', 't',
+	'n', 'i', 's', 's', 'e', 'd', 'a', 'l', 'n', 'i', 't', 't', 'e', 'd', 'a', 'l',
+	'n', 'o', 'r', 'd', '-', 'a', 'u', 'r', 'd', 'a', 'l', 'n', 'o', 'r', 'd', '-',
+	'f', 'r', 'o', 'n', 'n', 'o', 'r', 'd', '-', 'o', 'd', 'a', 'l', 'n', 'o', 'r',
+	'd', 'd', 'a', 'l', 'n', 'o', 'r', 'd', 'k', 'a', 'p', 'p', 'n', 'o', 'r', 'd',
+	'l', 'a', 'n', 'd', 'n', 'o', 'r', 'd', 'r', 'e', '-', 'l', 'a', 'n', 'd', 'n',
+	'o', 'r', 'd', 'r', 'e', 'i', 's', 'a', 'n', 'o', 'r', 'e', '-', 'o', 'g', '-',
+	'u', 'v', 'd', 'a', 'l', 'n', 'o', 't', 'o', 'd', 'd', 'e', 'n', 'n', 'o', 't',
+	't', 'e', 'r', 'o', 'y', 'o', 'd', 'd', 'a', 'o', 'k', 's', 'n', 'e', 's', 'o',
+	'm', 'a', 's', 'v', 'u', 'o', 't', 'n', 'a', 'o', 'p', 'p', 'd', 'a', 'l', 'o',
+	'p', 'p', 'e', 'g', 'a', 'r', 'd', 'o', 'r', 'k', 'a', 'n', 'g', 'e', 'r', 'o',
+	'r', 'k', 'd', 'a', 'l', 'o', 'r', 'l', 'a', 'n', 'd', 'o', 'r', 's', 'k', 'o',
+	'g', 'o', 's', 'l', 'o', 'o', 's', 'o', 'y', 'r', 'o', 'o', 's', 't', 'e', 'r',
+	'o', 'y', 'o', 's', 't', 'f', 'o', 'l', 'd', 'o', 's', 't', 'r', 'e', '-', 't',
+	'o', 't', 'e', 'n', 'o', 'v', 'e', 'r', 'h', 'a', 'l', 'l', 'a', 'o', 'v', 'r',
+	'e', '-', 'e', 'i', 'k', 'e', 'r', 'o', 'y', 'e', 'r', 'o', 'y', 'g', 'a', 'r',
+	'd', 'e', 'n', 'o', 'y', 's', 't', 'r', 'e', '-', 's', 'l', 'i', 'd', 'r', 'e',
+	'p', 'o', 'r', 's', 'a', 'n', 'g', 'e', 'r', 'p', 'o', 'r', 's', 'a', 'n', 'g',
+	'u', 'p', 'o', 'r', 's', 'g', 'r', 'u', 'n', 'n', 'r', 'a', 'd', 'o', 'y', 'r',
+	'a', 'h', 'k', 'k', 'e', 'r', 'a', 'v', 'j', 'u', 'r', 'a', 'h', 'o', 'l', 't',
+	'r', 'a', 'i', 's', 'a', 'r', 'a', 'k', 'k', 'e', 's', 't', 'a', 'd', 'r', 'a',
+	'l', 'i', 'n', 'g', 'e', 'n', 'r', 'a', 'n', 'd', 'a', 'b', 'e', 'r', 'g', 'r',
+	'a', 'u', 'm', 'a', 'r', 'e', 'n', 'd', 'a', 'l', 'e', 'n', 'r', 'e', 'n', 'n',
+	'e', 'b', 'u', 'r', 'e', 'n', 'n', 'e', 's', 'o', 'y', 'r', 'i', 'n', 'd', 'a',
+	'l', 'r', 'i', 'n', 'g', 'e', 'b', 'u', 'r', 'i', 'n', 'g', 'e', 'r', 'i', 'k',
+	'e', 'r', 'i', 'n', 'g', 's', 'a', 'k', 'e', 'r', 'r', 'i', 's', 'o', 'r', 'r',
+	'i', 's', 's', 'a', 'r', 'o', 'd', 'o', 'y', 'r', 'o', 'l', 'l', 'a', 'g', 'r',
+	'o', 'm', 's', 'a', 'r', 'o', 'm', 's', 'k', 'o', 'g', 'r', 'o', 'r', 'o', 's',
+	'r', 'o', 'y', 'k', 'e', 'n', 'r', 'o', 'y', 'r', 'v', 'i', 'k', 'r', 'u', 'o',
+	'v', 'a', 't', 'r', 'y', 'g', 'g', 'e', 's', 'a', 'l', 'a', 'n', 'g', 'e', 'n',
+	's', 'a', 'l', 't', 'd', 'a', 'l', 's', 'a', 'm', 'n', 'a', 'n', 'g', 'e', 'r',
+	's', 'a', 'n', 'd', 'e', 'f', 'j', 'o', 'r', 'd', 's', 'a', 'n', 'd', 'n', 'e',
+	's', 's', 'a', 'n', 'd', 'n', 'e', 's', 's', 'j', 'o', 'e', 'n', 's', 'a', 'n',
+	'd', 'o', 'y', 's', 'a', 'r', 'p', 's', 'b', 'o', 'r', 'g', 's', 'a', 'u', 'd',
+	'a', 's', 'a', 'u', 'h', 'e', 'r', 'a', 'd', 's', 'e', 'l', 'b', 'u', 's', 'e',
+	'l', 'j', 'e', 's', 'e', 'l', 'j', 'o', 'r', 'd', 's', 'i', 'e', 'l', 'l', 'a',
+	'k', 's', 'i', 'g', 'd', 'a', 'l', 's', 'i', 'l', 'j', 'a', 'n', 's', 'i', 'r',
+	'd', 'a', 'l', 's', 'k', 'a', 'n', 'i', 't', 's', 'k', 'a', 'n', 'l', 'a', 'n',
+	'd', 's', 'k', 'a', 'u', 'n', 's', 'k', 'e', 'd', 's', 'm', 'o', 's', 'k', 'e',
+	'd', 's', 'm', 'o', 'k', 'o', 'r', 's', 'e', 't', 's', 'k', 'i', 'e', 'n', 's',
+	'k', 'i', 'e', 'r', 'v', 'a', 's', 'k', 'i', 'p', 't', 'v', 'e', 't', 's', 'k',
+	'j', 'a', 'k', 's', 'k', 'j', 'e', 'r', 'v', 'o', 'y', 's', 'k', 'o', 'd', 'j',
+	'e', 's', 'l', 'a', 't', 't', 'u', 'm', 's', 'm', 'o', 'l', 'a', 's', 'n', 'a',
+	'a', 's', 'e', 's', 'n', 'a', 's', 'a', 's', 'n', 'i', 'l', 'l', 'f', 'j', 'o',
+	'r', 'd', 's', 'n', 'o', 'a', 's', 'a', 's', 'o', 'g', 'n', 'd', 'a', 'l', 's',
+	'o', 'g', 'n', 'e', 's', 'o', 'k', 'n', 'd', 'a', 'l', 's', 'o', 'l', 'u', 'n',
+	'd', 's', 'o', 'm', 'n', 'a', 's', 'o', 'n', 'd', 'r', 'e', '-', 'l', 'a', 'n',
+	'd', 's', 'o', 'n', 'g', 'd', 'a', 'l', 'e', 'n', 's', 'o', 'r', '-', 'a', 'u',
+	'r', 'd', 'a', 'l', 's', 'o', 'r', '-', 'f', 'r', 'o', 'n', 's', 'o', 'r', '-',
+	'o', 'd', 'a', 'l', 's', 'o', 'r', '-', 'v', 'a', 'r', 'a', 'n', 'g', 'e', 'r',
+	's', 'o', 'r', 'f', 'o', 'l', 'd', 's', 'o', 'r', 'r', 'e', 'i', 's', 'a', 's',
+	'o', 'r', 't', 'l', 'a', 'n', 'd', 's', 'o', 'r', 'u', 'm', 's', 'p', 'j', 'e',
+	'l', 'k', 'a', 'v', 'i', 'k', 's', 'p', 'y', 'd', 'e', 'b', 'e', 'r', 'g', 's',
+	't', 'a', 'n', 'g', 'e', 's', 't', 'a', 't', 'h', 'e', 'l', 'l', 'e', 's', 't',
+	'a', 'v', 'a', 'n', 'g', 'e', 'r', 's', 't', 'a', 'v', 'e', 'r', 'n', 's', 't',
+	'e', 'i', 'g', 'e', 'n', 's', 't', 'e', 'i', 'n', 'k', 'j', 'e', 'r', 's', 't',
+	'j', 'o', 'r', 'd', 'a', 'l', 's', 't', 'j', 'o', 'r', 'd', 'a', 'l', 's', 'h',
+	'a', 'l', 's', 'e', 'n', 's', 't', 'o', 'k', 'k', 'e', 's', 't', 'o', 'r', '-',
+	'e', 'l', 'v', 'd', 'a', 'l', 's', 't', 'o', 'r', 'd', 's', 't', 'o', 'r', 'd',
+	'a', 'l', 's', 't', 'o', 'r', 'f', 'j', 'o', 'r', 'd', 's', 't', 'r', 'a', 'n',
+	'd', 'a', 's', 't', 'r', 'y', 'n', 's', 'u', 'l', 'a', 's', 'u', 'l', 'd', 'a',
+	'l', 's', 'u', 'n', 'n', 'd', 'a', 'l', 's', 'u', 'r', 'n', 'a', 'd', 'a', 'l',
+	's', 'v', 'a', 'l', 'b', 'a', 'r', 'd', 's', 'v', 'e', 'i', 'o', 's', 'v', 'e',
+	'l', 'v', 'i', 'k', 's', 'y', 'k', 'k', 'y', 'l', 'v', 'e', 'n', 't', 'a', 'n',
+	'a', 't', 'a', 'n', 'a', 'n', 'g', 'e', 'r', 't', 'e', 'l', 'e', 'm', 'a', 'r',
+	'k', 't', 'i', 'n', 'g', 'v', 'o', 'l', 'l', 't', 'i', 'n', 'n', 't', 'j', 'e',
+	'l', 'd', 's', 'u', 'n', 'd', 't', 'j', 'o', 'm', 'e', 't', 'o', 'l', 'g', 'a',
+	't', 'o', 'n', 's', 'b', 'e', 'r', 'g', 't', 'o', 'r', 's', 'k', 'e', 'n', 't',
+	'r', 'a', 'n', 'a', 't', 'r', 'a', 'n', 'b', 'y', 't', 'r', 'a', 'n', 'o', 'y',
+	't', 'r', 'o', 'a', 'n', 'd', 'i', 'n', 't', 'r', 'o', 'g', 's', 't', 'a', 'd',
+	't', 'r', 'o', 'm', 's', 'a', 't', 'r', 'o', 'm', 's', 'o', 't', 'r', 'o', 'n',
+	'd', 'h', 'e', 'i', 'm', 't', 'r', 'y', 's', 'i', 'l', 't', 'v', 'e', 'd', 'e',
+	's', 't', 'r', 'a', 'n', 'd', 't', 'y', 'd', 'a', 'l', 't', 'y', 'n', 's', 'e',
+	't', 't', 'y', 's', 'f', 'j', 'o', 'r', 'd', 't', 'y', 's', 'n', 'e', 's', 't',
+	'y', 's', 'v', 'a', 'r', 'u', 'l', 'l', 'e', 'n', 's', 'a', 'k', 'e', 'r', 'u',
+	'l', 'l', 'e', 'n', 's', 'v', 'a', 'n', 'g', 'u', 'l', 'v', 'i', 'k', 'u', 'n',
+	'j', 'a', 'r', 'g', 'a', 'u', 't', 's', 'i', 'r', 'a', 'v', 'a', 'a', 'p', 's',
+	't', 'e', 'v', 'a', 'd', 's', 'o', 'v', 'a', 'g', 'a', 'v', 'a', 'g', 'a', 'n',
+	'v', 'a', 'g', 's', 'o', 'y', 'v', 'a', 'k', 's', 'd', 'a', 'l', 'v', 'a', 'n',
+	'y', 'l', 'v', 'e', 'n', 'v', 'a', 'r', 'd', 'o', 'v', 'a', 'r', 'g', 'g', 'a',
+	't', 'v', 'a', 'r', 'o', 'y', 'v', 'e', 'f', 's', 'n', 'v', 'e', 'g', 'a', 'r',
+	's', 'h', 'e', 'i', 'v', 'e', 'n', 'n', 'e', 's', 'l', 'a', 'v', 'e', 'r', 'd',
+	'a', 'l', 'v', 'e', 'r', 'r', 'a', 'n', 'v', 'e', 's', 't', 'b', 'y', 'v', 'e',
+	's', 't', 'f', 'o', 'l', 'd', 'v', 'e', 's', 't', 'n', 'e', 's', 'v', 'e', 's',
+	't', 'r', 'e', '-', 's', 'l', 'i', 'd', 'r', 'e', 'v', 'e', 's', 't', 'r', 'e',
+	'-', 't', 'o', 't', 'e', 'n', 'v', 'e', 's', 't', 'v', 'a', 'g', 'o', 'y', 'v',
+	'e', 'v', 'e', 'l', 's', 't', 'a', 'd', 'v', 'g', 's', 'v', 'i', 'n', 'd', 'a',
+	'f', 'j', 'o', 'r', 'd', 'v', 'o', 'a', 'g', 'a', 't', 'v', 'o', 'l', 'd', 'a',
+	'v', 'o', 's', 's', 'v', 'o', 's', 's', 'e', 'v', 'a', 'n', 'g', 'e', 'n', 'x',
+	'n', '-', '-', 'a', 'n', 'd', 'y', '-', 'i', 'r', 'a', 'x', 'n', '-', '-', 'a',
+	's', 'k', 'y', '-', 'i', 'r', 'a', 'x', 'n', '-', '-', 'a', 'u', 'r', 's', 'k',
+	'o', 'g', '-', 'h', 'l', 'a', 'n', 'd', '-', 'j', 'n', 'b', 'x', 'n', '-', '-',
+	'a', 'v', 'e', 'r', 'y', '-', 'y', 'u', 'a', 'x', 'n', '-', '-', 'b', 'd', 'd',
+	'd', 'j', '-', 'm', 'r', 'a', 'b', 'd', 'x', 'n', '-', '-', 'b', 'e', 'a', 'r',
+	'a', 'l', 'v', 'h', 'k', 'i', '-', 'y', '4', 'a', 'x', 'n', '-', '-', 'b', 'e',
+	'r', 'l', 'e', 'v', 'g', '-', 'j', 'x', 'a', 'x', 'n', '-', '-', 'b', 'h', 'c',
+	'a', 'v', 'u', 'o', 't', 'n', 'a', '-', 's', '4', 'a', 'x', 'n', '-', '-', 'b',
+	'h', 'c', 'c', 'a', 'v', 'u', 'o', 't', 'n', 'a', '-', 'k', '7', 'a', 'x', 'n',
+	'-', '-', 'b', 'i', 'd', 'r', '-', '5', 'n', 'a', 'c', 'x', 'n', '-', '-', 'b',
+	'i', 'e', 'v', 't', '-', '0', 'q', 'a', 'x', 'n', '-', '-', 'b', 'j', 'a', 'r',
+	'k', 'y', '-', 'f', 'y', 'a', 'x', 'n', '-', '-', 'b', 'j', 'd', 'd', 'a', 'r',
+	'-', 'p', 't', 'a', 'x', 'n', '-', '-', 'b', 'l', 't', '-', 'e', 'l', 'a', 'b',
+	'x', 'n', '-', '-', 'b', 'm', 'l', 'o', '-', 'g', 'r', 'a', 'x', 'n', '-', '-',
+	'b', 'o', 'd', '-', '2', 'n', 'a', 'x', 'n', '-', '-', 'b', 'r', 'n', 'n', 'y',
+	'-', 'w', 'u', 'a', 'c', 'x', 'n', '-', '-', 'b', 'r', 'n', 'n', 'y', 's', 'u',
+	'n', 'd', '-', 'm', '8', 'a', 'c', 'x', 'n', '-', '-', 'b', 'r', 'u', 'm', '-',
+	'v', 'o', 'a', 'x', 'n', '-', '-', 'b', 't', 's', 'f', 'j', 'o', 'r', 'd', '-',
+	'9', 'z', 'a', 'x', 'n', '-', '-', 'd', 'a', 'v', 'v', 'e', 'n', 'j', 'r', 'g',
+	'a', '-', 'y', '4', 'a', 'x', 'n', '-', '-', 'd', 'n', 'n', 'a', '-', 'g', 'r',
+	'a', 'x', 'n', '-', '-', 'd', 'r', 'b', 'a', 'k', '-', 'w', 'u', 'a', 'x', 'n',
+	'-', '-', 'd', 'y', 'r', 'y', '-', 'i', 'r', 'a', 'x', 'n', '-', '-', 'e', 'v',
+	'e', 'n', 'i', '-', '0', 'q', 'a', '0', '1', 'g', 'a', 'x', 'n', '-', '-', 'f',
+	'i', 'n', 'n', 'y', '-', 'y', 'u', 'a', 'x', 'n', '-', '-', 'f', 'j', 'o', 'r',
+	'd', '-', 'l', 'r', 'a', 'x', 'n', '-', '-', 'f', 'l', '-', 'z', 'i', 'a', 'x',
+	'n', '-', '-', 'f', 'l', 'o', 'r', '-', 'j', 'r', 'a', 'x', 'n', '-', '-', 'f',
+	'r', 'd', 'e', '-', 'g', 'r', 'a', 'x', 'n', '-', '-', 'f', 'r', 'n', 'a', '-',
+	'w', 'o', 'a', 'x', 'n', '-', '-', 'f', 'r', 'y', 'a', '-', 'h', 'r', 'a', 'x',
+	'n', '-', '-', 'g', 'g', 'a', 'v', 'i', 'i', 'k', 'a', '-', '8', 'y', 'a', '4',
+	'7', 'h', 'x', 'n', '-', '-', 'g', 'i', 'l', 'd', 'e', 's', 'k', 'l', '-', 'g',
+	'0', 'a', 'x', 'n', '-', '-', 'g', 'i', 'v', 'u', 'o', 't', 'n', 'a', '-', '8',
+	'y', 'a', 'x', 'n', '-', '-', 'g', 'j', 'v', 'i', 'k', '-', 'w', 'u', 'a', 'x',
+	'n', '-', '-', 'g', 'l', 's', '-', 'e', 'l', 'a', 'c', 'x', 'n', '-', '-', 'h',
+	'-', '2', 'f', 'a', 'x', 'n', '-', '-', 'h', 'b', 'm', 'e', 'r', '-', 'x', 'q',
+	'a', 'x', 'n', '-', '-', 'h', 'c', 'e', 's', 'u', 'o', 'l', 'o', '-', '7', 'y',
+	'a', '3', '5', 'b', 'x', 'n', '-', '-', 'h', 'g', 'e', 'b', 'o', 's', 't', 'a',
+	'd', '-', 'g', '3', 'a', 'x', 'n', '-', '-', 'h', 'm', 'm', 'r', 'f', 'e', 'a',
+	's', 't', 'a', '-', 's', '4', 'a', 'c', 'x', 'n', '-', '-', 'h', 'n', 'e', 'f',
+	'o', 's', 's', '-', 'q', '1', 'a', 'x', 'n', '-', '-', 'h', 'o', 'b', 'l', '-',
+	'i', 'r', 'a', 'x', 'n', '-', '-', 'h', 'o', 'l', 't', 'l', 'e', 'n', '-', 'h',
+	'x', 'a', 'x', 'n', '-', '-', 'h', 'p', 'm', 'i', 'r', '-', 'x', 'q', 'a', 'x',
+	'n', '-', '-', 'h', 'y', 'a', 'n', 'g', 'e', 'r', '-', 'q', '1', 'a', 'x', 'n',
+	'-', '-', 'h', 'y', 'l', 'a', 'n', 'd', 'e', 't', '-', '5', '4', 'a', 'x', 'n',
+	'-', '-', 'i', 'n', 'd', 'e', 'r', 'y', '-', 'f', 'y', 'a', 'x', 'n', '-', '-',
+	'j', 'l', 's', 't', 'e', 'r', '-', 'b', 'y', 'a', 'x', 'n', '-', '-', 'j', 'r',
+	'p', 'e', 'l', 'a', 'n', 'd', '-', '5', '4', 'a', 'x', 'n', '-', '-', 'k', 'a',
+	'r', 'm', 'y', '-', 'y', 'u', 'a', 'x', 'n', '-', '-', 'k', 'f', 'j', 'o', 'r',
+	'd', '-', 'i', 'u', 'a', 'x', 'n', '-', '-', 'k', 'l', 'b', 'u', '-', 'w', 'o',
+	'a', 'x', 'n', '-', '-', 'k', 'o', 'l', 'u', 'o', 'k', 't', 'a', '-', '7', 'y',
+	'a', '5', '7', 'h', 'x', 'n', '-', '-', 'k', 'r', 'a', 'g', 'e', 'r', '-', 'g',
+	'y', 'a', 'x', 'n', '-', '-', 'k', 'r', 'a', 'n', 'g', 'h', 'k', 'e', '-', 'b',
+	'0', 'a', 'x', 'n', '-', '-', 'k', 'r', 'd', 's', 'h', 'e', 'r', 'a', 'd', '-',
+	'm', '8', 'a', 'x', 'n', '-', '-', 'k', 'r', 'e', 'h', 'a', 'm', 'n', '-', 'd',
+	'x', 'a', 'x', 'n', '-', '-', 'k', 'r', 'j', 'o', 'h', 'k', 'a', '-', 'h', 'w',
+	'a', 'b', '4', '9', 'j', 'x', 'n', '-', '-', 'k', 's', 'n', 'e', 's', '-', 'u',
+	'u', 'a', 'x', 'n', '-', '-', 'k', 'v', 'f', 'j', 'o', 'r', 'd', '-', 'n', 'x',
+	'a', 'x', 'n', '-', '-', 'k', 'v', 'i', 't', 's', 'y', '-', 'f', 'y', 'a', 'x',
+	'n', '-', '-', 'k', 'v', 'n', 'a', 'n', 'g', 'e', 'n', '-', 'k', '0', 'a', 'x',
+	'n', '-', '-', 'l', '-', '1', 'f', 'a', 'x', 'n', '-', '-', 'l', 'a', 'h', 'e',
+	'a', 'd', 'j', 'u', '-', '7', 'y', 'a', 'x', 'n', '-', '-', 'l', 'a', 'n', 'g',
+	'e', 'v', 'g', '-', 'j', 'x', 'a', 'x', 'n', '-', '-', 'l', 'd', 'i', 'n', 'g',
+	'e', 'n', '-', 'q', '1', 'a', 'x', 'n', '-', '-', 'l', 'e', 'a', 'g', 'a', 'v',
+	'i', 'i', 'k', 'a', '-', '5', '2', 'b', 'x', 'n', '-', '-', 'l', 'e', 's', 'u',
+	'n', 'd', '-', 'h', 'u', 'a', 'x', 'n', '-', '-', 'l', 'g', 'r', 'd', '-', 'p',
+	'o', 'a', 'c', 'x', 'n', '-', '-', 'l', 'h', 'p', 'p', 'i', '-', 'x', 'q', 'a',
+	'x', 'n', '-', '-', 'l', 'i', 'n', 'd', 's', '-', 'p', 'r', 'a', 'x', 'n', '-',
+	'-', 'l', 'o', 'a', 'b', 't', '-', '0', 'q', 'a', 'x', 'n', '-', '-', 'l', 'r',
+	'd', 'a', 'l', '-', 's', 'r', 'a', 'x', 'n', '-', '-', 'l', 'r', 'e', 'n', 's',
+	'k', 'o', 'g', '-', '5', '4', 'a', 'x', 'n', '-', '-', 'l', 't', '-', 'l', 'i',
+	'a', 'c', 'x', 'n', '-', '-', 'l', 't', 'e', 'n', '-', 'g', 'r', 'a', 'x', 'n',
+	'-', '-', 'l', 'u', 'r', 'y', '-', 'i', 'r', 'a', 'x', 'n', '-', '-', 'm', 'e',
+	'l', 'y', '-', 'i', 'r', 'a', 'x', 'n', '-', '-', 'm', 'e', 'r', 'k', 'e', 'r',
+	'-', 'k', 'u', 'a', 'x', 'n', '-', '-', 'm', 'j', 'n', 'd', 'a', 'l', 'e', 'n',
+	'-', '6', '4', 'a', 'x', 'n', '-', '-', 'm', 'l', 'a', 't', 'v', 'u', 'o', 'p',
+	'm', 'i', '-', 's', '4', 'a', 'x', 'n', '-', '-', 'm', 'l', 'i', '-', 't', 'l',
+	'a', 'x', 'n', '-', '-', 'm', 'l', 's', 'e', 'l', 'v', '-', 'i', 'u', 'a', 'x',
+	'n', '-', '-', 'm', 'o', 'r', 'e', 'k', 'e', '-', 'j', 'u', 'a', 'x', 'n', '-',
+	'-', 'm', 'o', 's', 'j', 'e', 'n', '-', 'e', 'y', 'a', 'x', 'n', '-', '-', 'm',
+	'o', 't', '-', 't', 'l', 'a', 'x', 'n', '-', '-', 'm', 'r', 'e', '-', 'o', 'g',
+	'-', 'r', 'o', 'm', 's', 'd', 'a', 'l', '-', 'q', 'q', 'b', 'x', 'n', '-', '-',
+	'm', 's', 'y', '-', 'u', 'l', 'a', '0', 'h', 'x', 'n', '-', '-', 'm', 't', 't',
+	'a', '-', 'v', 'r', 'j', 'j', 'a', 't', '-', 'k', '7', 'a', 'f', 'x', 'n', '-',
+	'-', 'm', 'u', 'o', 's', 't', '-', '0', 'q', 'a', 'x', 'n', '-', '-', 'n', 'm',
+	'e', 's', 'j', 'e', 'v', 'u', 'e', 'm', 'i', 'e', '-', 't', 'c', 'b', 'a', 'x',
+	'n', '-', '-', 'n', 'r', 'y', '-', 'y', 'l', 'a', '5', 'g', 'x', 'n', '-', '-',
+	'n', 't', 't', 'e', 'r', 'y', '-', 'b', 'y', 'a', 'e', 'x', 'n', '-', '-', 'n',
+	'v', 'u', 'o', 't', 'n', 'a', '-', 'h', 'w', 'a', 'x', 'n', '-', '-', 'o', 'p',
+	'p', 'e', 'g', 'r', 'd', '-', 'i', 'x', 'a', 'x', 'n', '-', '-', 'o', 's', 't',
+	'e', 'r', 'y', '-', 'f', 'y', 'a', 'x', 'n', '-', '-', 'o', 's', 'y', 'r', 'o',
+	'-', 'w', 'u', 'a', 'x', 'n', '-', '-', 'p', 'o', 'r', 's', 'g', 'u', '-', 's',
+	't', 'a', '2', '6', 'f', 'x', 'n', '-', '-', 'r', 'a', 'd', 'y', '-', 'i', 'r',
+	'a', 'x', 'n', '-', '-', 'r', 'd', 'a', 'l', '-', 'p', 'o', 'a', 'x', 'n', '-',
+	'-', 'r', 'd', 'e', '-', 'u', 'l', 'a', 'x', 'n', '-', '-', 'r', 'd', 'y', '-',
+	'0', 'n', 'a', 'b', 'x', 'n', '-', '-', 'r', 'e', 'n', 'n', 'e', 's', 'y', '-',
+	'v', '1', 'a', 'x', 'n', '-', '-', 'r', 'h', 'k', 'k', 'e', 'r', 'v', 'j', 'u',
+	'-', '0', '1', 'a', 'f', 'x', 'n', '-', '-', 'r', 'h', 'o', 'l', 't', '-', 'm',
+	'r', 'a', 'x', 'n', '-', '-', 'r', 'i', 's', 'a', '-', '5', 'n', 'a', 'x', 'n',
+	'-', '-', 'r', 'i', 's', 'r', '-', 'i', 'r', 'a', 'x', 'n', '-', '-', 'r', 'l',
+	'a', 'n', 'd', '-', 'u', 'u', 'a', 'x', 'n', '-', '-', 'r', 'l', 'i', 'n', 'g',
+	'e', 'n', '-', 'm', 'x', 'a', 'x', 'n', '-', '-', 'r', 'm', 's', 'k', 'o', 'g',
+	'-', 'b', 'y', 'a', 'x', 'n', '-', '-', 'r', 'r', 'o', 's', '-', 'g', 'r', 'a',
+	'x', 'n', '-', '-', 'r', 's', 'k', 'o', 'g', '-', 'u', 'u', 'a', 'x', 'n', '-',
+	'-', 'r', 's', 't', '-', '0', 'n', 'a', 'x', 'n', '-', '-', 'r', 's', 't', 'a',
+	'-', 'f', 'r', 'a', 'x', 'n', '-', '-', 'r', 'y', 'k', 'e', 'n', '-', 'v', 'u',
+	'a', 'x', 'n', '-', '-', 'r', 'y', 'r', 'v', 'i', 'k', '-', 'b', 'y', 'a', 'x',
+	'n', '-', '-', 's', '-', '1', 'f', 'a', 'x', 'n', '-', '-', 's', 'a', 'n', 'd',
+	'n', 'e', 's', 's', 'j', 'e', 'n', '-', 'o', 'g', 'b', 'x', 'n', '-', '-', 's',
+	'a', 'n', 'd', 'y', '-', 'y', 'u', 'a', 'x', 'n', '-', '-', 's', 'e', 'r', 'a',
+	'l', '-', 'l', 'r', 'a', 'x', 'n', '-', '-', 's', 'g', 'n', 'e', '-', 'g', 'r',
+	'a', 'x', 'n', '-', '-', 's', 'k', 'i', 'e', 'r', 'v', '-', 'u', 't', 'a', 'x',
+	'n', '-', '-', 's', 'k', 'j', 'e', 'r', 'v', 'y', '-', 'v', '1', 'a', 'x', 'n',
+	'-', '-', 's', 'k', 'j', 'k', '-', 's', 'o', 'a', 'x', 'n', '-', '-', 's', 'k',
+	'n', 'i', 't', '-', 'y', 'q', 'a', 'x', 'n', '-', '-', 's', 'k', 'n', 'l', 'a',
+	'n', 'd', '-', 'f', 'x', 'a', 'x', 'n', '-', '-', 's', 'l', 'a', 't', '-', '5',
+	'n', 'a', 'x', 'n', '-', '-', 's', 'l', 't', '-', 'e', 'l', 'a', 'b', 'x', 'n',
+	'-', '-', 's', 'm', 'l', 'a', '-', 'h', 'r', 'a', 'x', 'n', '-', '-', 's', 'm',
+	'n', 'a', '-', 'g', 'r', 'a', 'x', 'n', '-', '-', 's', 'n', 'a', 's', 'e', '-',
+	'n', 'r', 'a', 'x', 'n', '-', '-', 's', 'n', 'd', 'r', 'e', '-', 'l', 'a', 'n',
+	'd', '-', '0', 'c', 'b', 'x', 'n', '-', '-', 's', 'n', 'e', 's', '-', 'p', 'o',
+	'a', 'x', 'n', '-', '-', 's', 'n', 's', 'a', '-', 'r', 'o', 'a', 'x', 'n', '-',
+	'-', 's', 'r', '-', 'a', 'u', 'r', 'd', 'a', 'l', '-', 'l', '8', 'a', 'x', 'n',
+	'-', '-', 's', 'r', '-', 'f', 'r', 'o', 'n', '-', 'q', '1', 'a', 'x', 'n', '-',
+	'-', 's', 'r', '-', 'o', 'd', 'a', 'l', '-', 'q', '1', 'a', 'x', 'n', '-', '-',
+	's', 'r', '-', 'v', 'a', 'r', 'a', 'n', 'g', 'e', 'r', '-', 'g', 'g', 'b', 'x',
+	'n', '-', '-', 's', 'r', 'f', 'o', 'l', 'd', '-', 'b', 'y', 'a', 'x', 'n', '-',
+	'-', 's', 'r', 'r', 'e', 'i', 's', 'a', '-', 'q', '1', 'a', 'x', 'n', '-', '-',
+	's', 'r', 'u', 'm', '-', 'g', 'r', 'a', 'x', 'n', '-', '-', 's', 't', 'f', 'o',
+	'l', 'd', '-', '9', 'x', 'a', 'x', 'n', '-', '-', 's', 't', 'j', 'r', 'd', 'a',
+	'l', '-', 's', '1', 'a', 'x', 'n', '-', '-', 's', 't', 'j', 'r', 'd', 'a', 'l',
+	's', 'h', 'a', 'l', 's', 'e', 'n', '-', 's', 'q', 'b', 'x', 'n', '-', '-', 's',
+	't', 'r', 'e', '-', 't', 'o', 't', 'e', 'n', '-', 'z', 'c', 'b', 'x', 'n', '-',
+	'-', 't', 'j', 'm', 'e', '-', 'h', 'r', 'a', 'x', 'n', '-', '-', 't', 'n', 's',
+	'b', 'e', 'r', 'g', '-', 'q', '1', 'a', 'x', 'n', '-', '-', 't', 'r', 'a', 'n',
+	'y', '-', 'y', 'u', 'a', 'x', 'n', '-', '-', 't', 'r', 'g', 's', 't', 'a', 'd',
+	'-', 'r', '1', 'a', 'x', 'n', '-', '-', 't', 'r', 'n', 'a', '-', 'w', 'o', 'a',
+	'x', 'n', '-', '-', 't', 'r', 'o', 'm', 's', '-', 'z', 'u', 'a', 'x', 'n', '-',
+	'-', 't', 'y', 's', 'v', 'r', '-', 'v', 'r', 'a', 'x', 'n', '-', '-', 'u', 'n',
+	'j', 'r', 'g', 'a', '-', 'r', 't', 'a', 'x', 'n', '-', '-', 'v', 'a', 'd', 's',
+	'-', 'j', 'r', 'a', 'x', 'n', '-', '-', 'v', 'a', 'r', 'd', '-', 'j', 'r', 'a',
+	'x', 'n', '-', '-', 'v', 'e', 'g', 'r', 's', 'h', 'e', 'i', '-', 'c', '0', 'a',
+	'x', 'n', '-', '-', 'v', 'e', 's', 't', 'v', 'g', 'y', '-', 'i', 'x', 'a', '6',
+	'o', 'x', 'n', '-', '-', 'v', 'g', '-', 'y', 'i', 'a', 'b', 'x', 'n', '-', '-',
+	'v', 'g', 'a', 'n', '-', 'q', 'o', 'a', 'x', 'n', '-', '-', 'v', 'g', 's', 'y',
+	'-', 'q', 'o', 'a', '0', 'j', 'x', 'n', '-', '-', 'v', 'r', 'e', '-', 'e', 'i',
+	'k', 'e', 'r', '-', 'k', '8', 'a', 'x', 'n', '-', '-', 'v', 'r', 'g', 'g', 't',
+	'-', 'x', 'q', 'a', 'd', 'x', 'n', '-', '-', 'v', 'r', 'y', '-', 'y', 'l', 'a',
+	'5', 'g', 'x', 'n', '-', '-', 'y', 'e', 'r', '-', 'z', 'n', 'a', 'x', 'n', '-',
+	'-', 'y', 'g', 'a', 'r', 'd', 'e', 'n', '-', 'p', '1', 'a', 'x', 'n', '-', '-',
+	'y', 's', 't', 'r', 'e', '-', 's', 'l', 'i', 'd', 'r', 'e', '-', 'u', 'j', 'b',
+	'e', 'n', 't', 'e', 'r', 'p', 'r', 'i', 's', 'e', 'c', 'l', 'o', 'u', 'd', 'm',
+	'e', 'r', 's', 'e', 'i', 'n', 'e', 's', 'h', 'a', 'c', 'k', 'n', 'e', 't', 'g',
+	'o', 'v', 't', 'm', 'a', 'o', 'r', 'i', 'p', 'a', 'r', 'l', 'i', 'a', 'm', 'e',
+	'n', 't', 'x', 'n', '-', '-', 'm', 'o', 'r', 'i', '-', 'q', 's', 'a', 'h', 'o',
+	'm', 'e', 'l', 'i', 'n', 'k', 'o', 'n', 'r', 'e', 'd', 'e', 'e', 'r', 'o', 'e',
+	'e', 'r', 'o', '-', 's', 't', 'a', 'g', 'e', 'a', 'c', 'c', 'e', 's', 's', 'c',
+	'a', 'm', 'a', 'l', 't', 'e', 'r', 'v', 'i', 's', 't', 'a', 'a', 'm', 'u', 'n',
+	'e', 'b', 'l', 'o', 'g', 's', 'i', 't', 'e', 'b', 'm', 'o', 'a', 't', 't', 'a',
+	'c', 'h', 'm', 'e', 'n', 't', 's', 'b', 'o', 'l', 'd', 'l', 'y', 'g', 'o', 'i',
+	'n', 'g', 'n', 'o', 'w', 'h', 'e', 'r', 'e', 'c', 'a', 'b', 'l', 'e', '-', 'm',
+	'o', 'd', 'e', 'm', 'c', 'a', 'm', 'd', 'v', 'r', 'c', 'd', 'n', '7', '7', '-',
+	's', 'e', 'c', 'u', 'r', 'e', 'c', 'e', 'r', 't', 'm', 'g', 'r', 'c', 'o', 'l',
+	'l', 'e', 'g', 'e', 'f', 'a', 'n', 'c', 'o', 'u', 'c', 'h', 'p', 'o', 't', 'a',
+	't', 'o', 'f', 'r', 'i', 'e', 's', 'd', 'u', 'c', 'k', 'd', 'n', 's', 'd', 'v',
+	'r', 'd', 'n', 's', 'd', 'y', 'n', 's', 'e', 'r', 'v', 'e', 'n', 'd', 'o', 'f',
+	't', 'h', 'e', 'i', 'n', 't', 'e', 'r', 'n', 'e', 't', 'f', 'e', 'd', 'o', 'r',
+	'a', 'i', 'n', 'f', 'r', 'a', 'c', 'l', 'o', 'u', 'd', 'f', 'e', 'd', 'o', 'r',
+	'a', 'p', 'e', 'o', 'p', 'l', 'e', 'f', 'e', 'd', 'o', 'r', 'a', 'p', 'r', 'o',
+	'j', 'e', 'c', 't', 'f', 'r', 'e', 'e', 'd', 'e', 's', 'k', 't', 'o', 'p', 'f',
+	'r', 'o', 'm', '-', 'm', 'e', 'g', 'a', 'm', 'e', '-', 'h', 'o', 's', 't', 'h',
+	'e', 'p', 'f', 'o', 'r', 'g', 'e', 'h', 't', 't', 'p', 'b', 'i', 'n', 'i', 's',
+	'-', 'a', '-', 'b', 'r', 'u', 'i', 'n', 's', 'f', 'a', 'n', 'i', 's', '-', 'a',
+	'-', 'c', 'a', 'n', 'd', 'i', 'd', 'a', 't', 'e', 'i', 's', '-', 'a', '-', 'c',
+	'e', 'l', 't', 'i', 'c', 's', 'f', 'a', 'n', 'i', 's', '-', 'a', '-', 'k', 'n',
+	'i', 'g', 'h', 't', 'i', 's', '-', 'a', '-', 'l', 'i', 'n', 'u', 'x', '-', 'u',
+	's', 'e', 'r', 'i', 's', '-', 'a', '-', 'p', 'a', 't', 's', 'f', 'a', 'n', 'i',
+	's', '-', 'a', '-', 's', 'o', 'x', 'f', 'a', 'n', 'i', 's', '-', 'f', 'o', 'u',
+	'n', 'd', 'i', 's', '-', 'l', 'o', 's', 't', 'i', 's', '-', 's', 'a', 'v', 'e',
+	'd', 'i', 's', '-', 'v', 'e', 'r', 'y', '-', 'b', 'a', 'd', 'i', 's', '-', 'v',
+	'e', 'r', 'y', '-', 'e', 'v', 'i', 'l', 'i', 's', '-', 'v', 'e', 'r', 'y', '-',
+	'g', 'o', 'o', 'd', 'i', 's', '-', 'v', 'e', 'r', 'y', '-', 'n', 'i', 'c', 'e',
+	'i', 's', '-', 'v', 'e', 'r', 'y', '-', 's', 'w', 'e', 'e', 't', 'm', 'i', 's',
+	'c', 'o', 'n', 'f', 'u', 's', 'e', 'd', 'm', 'l', 'b', 'f', 'a', 'n', 'm', 'o',
+	'z', 'i', 'l', 'l', 'a', '-', 'i', 'o', 't', 'm', 'y', '-', 'f', 'i', 'r', 'e',
+	'w', 'a', 'l', 'l', 'm', 'y', 'f', 'i', 'r', 'e', 'w', 'a', 'l', 'l', 'm', 'y',
+	'w', 'i', 'r', 'e', 'n', 'f', 'l', 'f', 'a', 'n', 'p', 'i', 'm', 'i', 'e', 'n',
+	't', 'a', 'p', 'o', 'i', 'v', 'r', 'o', 'n', 'p', 'o', 't', 'a', 'g', 'e', 'r',
+	'p', 'u', 'b', 't', 'l', 's', 'r', 'e', 'a', 'd', '-', 'b', 'o', 'o', 'k', 's',
+	'r', 'e', 'a', 'd', 'm', 'y', 'b', 'l', 'o', 'g', 's', 'e', 'l', 'l', 's', 'y',
+	'o', 'u', 'r', 'h', 'o', 'm', 'e', 's', 'm', 'a', 'l', 'l', '-', 'w', 'e', 'b',
+	's', 't', 'u', 'f', 'f', '-', '4', '-', 's', 'a', 'l', 'e', 's', 'w', 'e', 'e',
+	't', 'p', 'e', 'p', 'p', 'e', 'r', 't', 'e', 'c', 'k', 'i', 'd', 's', 't', 'o',
+	'o', 'l', 'f', 'o', 'r', 'g', 'e', 't', 'u', 'n', 'k', 't', 'u', 'x', 'f', 'a',
+	'm', 'i', 'l', 'y', 'u', 'f', 'c', 'f', 'a', 'n', 'w', 'e', 'b', 'r', 'e', 'd',
+	'i', 'r', 'e', 'c', 't', 'w', 'm', 'c', 'l', 'o', 'u', 'd', 'w', 'm', 'f', 'l',
+	'a', 'b', 's', 'z', 'a', 'p', 't', 'o', 'n', 'e', 'r', 'd', 'p', 'o', 'l', 'c',
+	'o', 'd', 'e', 'b', 'e', 'r', 'g', 'h', 'l', 'x', '3', 'm', 'a', 'g', 'n', 'e',
+	't', 'p', 'r', 'v', 'c', 'y', 'r', 'o', 'c', 'k', 'y', '1', '3', '3', '7', 'g',
+	'o', 'k', 'a', 'u', 'g', 'u', 's', 't', 'o', 'w', 'b', 'a', 'b', 'i', 'a', '-',
+	'g', 'o', 'r', 'a', 'b', 'e', 'd', 'z', 'i', 'n', 'b', 'e', 'e', 'p', 'b', 'e',
+	's', 'k', 'i', 'd', 'y', 'b', 'i', 'a', 'l', 'o', 'w', 'i', 'e', 'z', 'a', 'b',
+	'i', 'a', 'l', 'y', 's', 't', 'o', 'k', 'b', 'i', 'e', 'l', 'a', 'w', 'a', 'b',
+	'i', 'e', 's', 'z', 'c', 'z', 'a', 'd', 'y', 'b', 'o', 'l', 'e', 's', 'l', 'a',
+	'w', 'i', 'e', 'c', 'b', 'y', 'd', 'g', 'o', 's', 'z', 'c', 'z', 'b', 'y', 't',
+	'o', 'm', 'c', 'i', 'e', 's', 'z', 'y', 'n', 'c', 'z', 'e', 'l', 'a', 'd', 'z',
+	'c', 'z', 'e', 's', 't', 'd', 'l', 'u', 'g', 'o', 'l', 'e', 'k', 'a', 'e', 'c',
+	'o', 'm', 'm', 'e', 'r', 'c', 'e', '-', 's', 'h', 'o', 'p', 'e', 'l', 'b', 'l',
+	'a', 'g', 'g', 'd', 'a', 'n', 's', 'k', 'g', 'd', 'y', 'n', 'i', 'a', 'g', 'l',
+	'i', 'w', 'i', 'c', 'e', 'g', 'l', 'o', 'g', 'o', 'w', 'g', 'm', 'i', 'n', 'a',
+	'g', 'n', 'i', 'e', 'z', 'n', 'o', 'g', 'o', 'r', 'l', 'i', 'c', 'e', 'g', 'r',
+	'a', 'j', 'e', 'w', 'o', 'h', 'o', 'm', 'e', 's', 'k', 'l', 'e', 'p', 'i', 'l',
+	'a', 'w', 'a', 'j', 'a', 'w', 'o', 'r', 'z', 'n', 'o', 'j', 'e', 'l', 'e', 'n',
+	'i', 'a', '-', 'g', 'o', 'r', 'a', 'j', 'g', 'o', 'r', 'a', 'k', 'a', 'l', 'i',
+	's', 'z', 'k', 'a', 'r', 'p', 'a', 'c', 'z', 'k', 'a', 'r', 't', 'u', 'z', 'y',
+	'k', 'a', 's', 'z', 'u', 'b', 'y', 'k', 'a', 't', 'o', 'w', 'i', 'c', 'e', 'k',
+	'a', 'z', 'i', 'm', 'i', 'e', 'r', 'z', '-', 'd', 'o', 'l', 'n', 'y', 'k', 'e',
+	'p', 'n', 'o', 'k', 'e', 't', 'r', 'z', 'y', 'n', 'k', 'l', 'o', 'd', 'z', 'k',
+	'o', 'k', 'o', 'b', 'i', 'e', 'r', 'z', 'y', 'c', 'e', 'k', 'o', 'l', 'o', 'b',
+	'r', 'z', 'e', 'g', 'k', 'o', 'n', 'i', 'n', 'k', 'o', 'n', 's', 'k', 'o', 'w',
+	'o', 'l', 'a', 'k', 'r', 'a', 'k', 'o', 'w', 'k', 'r', 'a', 's', 'n', 'i', 'k',
+	'k', 'u', 't', 'n', 'o', 'l', 'a', 'p', 'y', 'l', 'e', 'b', 'o', 'r', 'k', 'l',
+	'e', 'c', 'z', 'n', 'a', 'l', 'e', 'g', 'n', 'i', 'c', 'a', 'l', 'e', 'z', 'a',
+	'j', 's', 'k', 'l', 'i', 'm', 'a', 'n', 'o', 'w', 'a', 'l', 'o', 'm', 'z', 'a',
+	'l', 'o', 'w', 'i', 'c', 'z', 'l', 'u', 'b', 'a', 'r', 't', 'o', 'w', 'l', 'u',
+	'b', 'i', 'n', 'l', 'u', 'b', 'l', 'i', 'n', 'l', 'u', 'k', 'o', 'w', 'm', 'a',
+	'l', 'b', 'o', 'r', 'k', 'm', 'a', 'l', 'o', 'p', 'o', 'l', 's', 'k', 'a', 'm',
+	'a', 'z', 'o', 'w', 's', 'z', 'e', 'm', 'a', 'z', 'u', 'r', 'y', 'm', 'i', 'a',
+	's', 't', 'a', 'm', 'i', 'e', 'l', 'e', 'c', 'm', 'i', 'e', 'l', 'n', 'o', 'm',
+	'r', 'a', 'g', 'o', 'w', 'o', 'n', 'a', 'k', 'l', 'o', 'n', 'i', 'e', 'r', 'u',
+	'c', 'h', 'o', 'm', 'o', 's', 'c', 'i', 'n', 'o', 'w', 'a', 'r', 'u', 'd', 'a',
+	'n', 'y', 's', 'a', 'o', 'l', 'a', 'w', 'a', 'o', 'l', 'e', 'c', 'k', 'o', 'o',
+	'l', 'k', 'u', 's', 'z', 'o', 'l', 's', 'z', 't', 'y', 'n', 'o', 'p', 'o', 'c',
+	'z', 'n', 'o', 'o', 'p', 'o', 'l', 'e', 'o', 's', 't', 'r', 'o', 'd', 'a', 'o',
+	's', 't', 'r', 'o', 'l', 'e', 'k', 'a', 'o', 's', 't', 'r', 'o', 'w', 'i', 'e',
+	'c', 'o', 's', 't', 'r', 'o', 'w', 'w', 'l', 'k', 'p', 'p', 'i', 's', 'z', 'p',
+	'o', 'd', 'h', 'a', 'l', 'e', 'p', 'o', 'd', 'l', 'a', 's', 'i', 'e', 'p', 'o',
+	'l', 'k', 'o', 'w', 'i', 'c', 'e', 'p', 'o', 'm', 'o', 'r', 's', 'k', 'i', 'e',
+	'p', 'o', 'm', 'o', 'r', 'z', 'e', 'p', 'o', 'n', 'i', 'a', 't', 'o', 'w', 'a',
+	'p', 'o', 'w', 'i', 'a', 't', 'p', 'o', 'z', 'n', 'a', 'n', 'p', 'r', 'o', 'c',
+	'h', 'o', 'w', 'i', 'c', 'e', 'p', 'r', 'u', 's', 'z', 'k', 'o', 'w', 'p', 'r',
+	'z', 'e', 'w', 'o', 'r', 's', 'k', 'p', 'u', 'l', 'a', 'w', 'y', 'r', 'a', 'd',
+	'o', 'm', 'r', 'a', 'w', 'a', '-', 'm', 'a', 'z', 'r', 'y', 'b', 'n', 'i', 'k',
+	'r', 'z', 'e', 's', 'z', 'o', 'w', 's', 'a', 'n', 'o', 'k', 's', 'd', 's', 'c',
+	'l', 'o', 'u', 'd', 's', 'e', 'j', 'n', 'y', 's', 'h', 'o', 'p', 'a', 'r', 'e',
+	'n', 'a', 's', 'k', 'o', 'c', 'z', 'o', 'w', 's', 'l', 'a', 's', 'k', 's', 'l',
+	'u', 'p', 's', 'k', 's', 'o', 'p', 'o', 't', 's', 'o', 's', 'n', 'o', 'w', 'i',
+	'e', 'c', 's', 't', 'a', 'l', 'o', 'w', 'a', '-', 'w', 'o', 'l', 'a', 's', 't',
+	'a', 'r', 'a', 'c', 'h', 'o', 'w', 'i', 'c', 'e', 's', 't', 'a', 'r', 'g', 'a',
+	'r', 'd', 's', 'u', 'w', 'a', 'l', 'k', 'i', 's', 'w', 'i', 'd', 'n', 'i', 'c',
+	'a', 's', 'w', 'i', 'd', 'n', 'i', 'k', 's', 'w', 'i', 'e', 'b', 'o', 'd', 'z',
+	'i', 'n', 's', 'w', 'i', 'n', 'o', 'u', 'j', 's', 'c', 'i', 'e', 's', 'z', 'c',
+	'z', 'e', 'c', 'i', 'n', 's', 'z', 'c', 'z', 'y', 't', 'n', 'o', 's', 'z', 'k',
+	'o', 'l', 'a', 't', 'a', 'r', 'g', 'i', 't', 'a', 'r', 'n', 'o', 'b', 'r', 'z',
+	'e', 'g', 't', 'g', 'o', 'r', 'y', 't', 'u', 'r', 'e', 'k', 't', 'u', 'r', 'y',
+	's', 't', 'y', 'k', 'a', 't', 'y', 'c', 'h', 'y', 'u', 'n', 'i', 'c', 'l', 'o',
+	'u', 'd', 'u', 's', 't', 'k', 'a', 'w', 'a', 'l', 'b', 'r', 'z', 'y', 'c', 'h',
+	'w', 'a', 'r', 'm', 'i', 'a', 'w', 'a', 'r', 's', 'z', 'a', 'w', 'a', 'w', 'e',
+	'g', 'r', 'o', 'w', 'w', 'i', 'e', 'l', 'u', 'n', 'w', 'l', 'o', 'c', 'l', 'w',
+	'l', 'o', 'c', 'l', 'a', 'w', 'e', 'k', 'w', 'o', 'd', 'z', 'i', 's', 'l', 'a',
+	'w', 'w', 'o', 'l', 'o', 'm', 'i', 'n', 'w', 'r', 'o', 'c', 'w', 'r', 'o', 'c',
+	'l', 'a', 'w', 'z', 'a', 'c', 'h', 'p', 'o', 'm', 'o', 'r', 'z', 'a', 'g', 'a',
+	'n', 'z', 'a', 'k', 'o', 'p', 'a', 'n', 'e', 'z', 'a', 'r', 'o', 'w', 'z', 'g',
+	'o', 'r', 'a', 'z', 'g', 'o', 'r', 'z', 'e', 'l', 'e', 'c', 'i', 'n', 'd', 'i',
+	'e', 'a', 'c', 'c', 't', 'd', 'n', 's', 't', 'r', 'a', 'c', 'e', 'r', 'e', 'c',
+	'h', 't', '1', '2', '3', 'p', 'a', 'g', 'i', 'n', 'a', 'w', 'e', 'b', 'b', 'e',
+	'l', 'a', 'u', 'x', '4', '4', '3', 'c', 'l', 'a', 'n', 'm', 'y', 'd', 'd', 'n',
+	's', 'w', 'e', 'b', 's', 'p', 'a', 'c', 'e', 'b', 'r', 'e', 'n', 'd', 'l', 'y',
+	'1', '2', '3', 's', 'a', 'i', 't', 'a', 'd', 'y', 'g', 'e', 'y', 'a', 'b', 'a',
+	's', 'h', 'k', 'i', 'r', 'i', 'a', 'c', 'b', 'g', 'c', 'l', 'd', 'm', 'a', 'i',
+	'l', 'd', 'a', 'g', 'e', 's', 't', 'a', 'n', 'e', 'u', 'r', 'o', 'd', 'i', 'r',
+	'g', 'r', 'o', 'z', 'n', 'y', 'k', 'a', 'l', 'm', 'y', 'k', 'i', 'a', 'k', 'u',
+	's', 't', 'a', 'n', 'a', 'i', 'l', 'k', '3', 'm', 'a', 'r', 'i', 'n', 'e', 'm',
+	'c', 'p', 'r', 'e', 'm', 'o', 'r', 'd', 'o', 'v', 'i', 'a', 'm', 'y', 'j', 'i',
+	'n', 'o', 'm', 'y', 't', 'i', 's', 'n', 'a', '4', 'u', 'n', 'a', 'l', 'c', 'h',
+	'i', 'k', 'p', 'y', 'a', 't', 'i', 'g', 'o', 'r', 's', 'k', 'r', 'e', 'g', 'r',
+	'u', 'h', 'o', 's', 't', 'i', 'n', 'g', 's', 'p', 'b', 'v', 'l', 'a', 'd', 'i',
+	'k', 'a', 'v', 'k', 'a', 'z', 'v', 'l', 'a', 'd', 'i', 'm', 'i', 'r', 'd', 'e',
+	'v', 'e', 'l', 'o', 'p', 'm', 'e', 'n', 't', 'm', 'i', 'g', 'r', 'a', 't', 'i',
+	'o', 'n', 'o', 'n', 'p', 'o', 'r', 't', 'e', 'r', '1', '2', '3', 'm', 'i', 'n',
+	's', 'i', 'd', 'a', 'f', 'h', 's', 'k', 'f', 'h', 'v', 'i', 'o', 'p', 's', 'y',
+	's', 'i', 't', 'c', 'o', 'u', 'l', 'd', 'b', 'e', 'w', 'o', 'r', 'k', 'o', 'm',
+	'f', 'o', 'r', 'b', 'k', 'o', 'm', 'm', 'u', 'n', 'a', 'l', 'f', 'o', 'r', 'b',
+	'u', 'n', 'd', 'k', 'o', 'm', 'v', 'u', 'x', 'l', 'a', 'n', 'b', 'i', 'b', 'n',
+	'a', 't', 'u', 'r', 'b', 'r', 'u', 'k', 's', 'g', 'y', 'm', 'n', 'p', 'a', 'r',
+	't', 'i', 'e', 'n', 's', 'c', 'a', 'l', 'e', 'd', 'h', 'a', 's', 'h', 'b', 'a',
+	'n', 'g', 'v', 'x', 'l', 'h', 'o', 'p', 'l', 'i', 'x', 'g', 'i', 't', 'a', 'p',
+	'p', 'g', 'i', 't', 'p', 'a', 'g', 'e', 'b', 'y', 'e', 'n', 'c', 'l', 'o', 'u',
+	'd', 'e', 'r', 'a', 'f', 'n', 'w', 'k', 'f', 'o', 'l', 'i', 'o', 'n', 'e', 't',
+	'w', 'o', 'r', 'k', 'l', 'e', 'l', 'u', 'x', 'm', 'i', 'n', 't', 'e', 'r', 'e',
+	'n', 'o', 'v', 'e', 'c', 'o', 'r', 'e', 'o', 'm', 'n', 'i', 'w', 'e', 'o', 'p',
+	'e', 'n', 's', 'o', 'c', 'i', 'a', 'l', 'p', 'l', 'a', 't', 'f', 'o', 'r', 'm',
+	's', 'h', 's', 'r', 'h', 't', 'd', 'i', 'h', 'e', 'r', 'x', 's', '4', 'a', 'l',
+	'l', 'c', 'o', 'n', 's', 'u', 'l', 'a', 'd', 'o', 'e', 'm', 'b', 'a', 'i', 'x',
+	'a', 'd', 'a', 'p', 'r', 'i', 'n', 'c', 'i', 'p', 'e', 's', 'a', 'o', 't', 'o',
+	'm', 'e', 's', 'e', 'l', 'l', 'f', 'y', 's', 'h', 'o', 'p', 'w', 'a', 'r', 'e',
+	's', 't', 'o', 'r', 'e', 'b', 'a', 's', 'e', 'a', 'b', 'k', 'h', 'a', 'z', 'i',
+	'a', 'a', 'k', 't', 'y', 'u', 'b', 'i', 'n', 's', 'k', 'a', 'r', 'k', 'h', 'a',
+	'n', 'g', 'e', 'l', 's', 'k', 'a', 'r', 'm', 'e', 'n', 'i', 'a', 'a', 's', 'h',
+	'g', 'a', 'b', 'a', 'd', 'a', 'z', 'e', 'r', 'b', 'a', 'i', 'j', 'a', 'n', 'b',
+	'a', 'l', 'a', 's', 'h', 'o', 'v', 'b', 'r', 'y', 'a', 'n', 's', 'k', 'b', 'u',
+	'k', 'h', 'a', 'r', 'a', 'c', 'h', 'i', 'm', 'k', 'e', 'n', 't', 'e', 'a', 's',
+	't', '-', 'k', 'a', 'z', 'a', 'k', 'h', 's', 't', 'a', 'n', 'e', 'x', 'n', 'e',
+	't', 'i', 'v', 'a', 'n', 'o', 'v', 'o', 'j', 'a', 'm', 'b', 'y', 'l', 'k', 'a',
+	'l', 'u', 'g', 'a', 'k', 'a', 'r', 'a', 'c', 'o', 'l', 'k', 'a', 'r', 'a', 'g',
+	'a', 'n', 'd', 'a', 'k', 'a', 'r', 'e', 'l', 'i', 'a', 'k', 'h', 'a', 'k', 'a',
+	's', 's', 'i', 'a', 'k', 'r', 'a', 's', 'n', 'o', 'd', 'a', 'r', 'k', 'u', 'r',
+	'g', 'a', 'n', 'l', 'e', 'n', 'u', 'g', 'm', 'a', 'n', 'g', 'y', 's', 'h', 'l',
+	'a', 'k', 'm', 'u', 'r', 'm', 'a', 'n', 's', 'k', 'n', 'a', 'v', 'o', 'i', 'n',
+	'o', 'r', 't', 'h', '-', 'k', 'a', 'z', 'a', 'k', 'h', 's', 't', 'a', 'n', 'o',
+	'b', 'n', 'i', 'n', 's', 'k', 'p', 'e', 'n', 'z', 'a', 'p', 'o', 'k', 'r', 'o',
+	'v', 's', 'k', 's', 'o', 'c', 'h', 'i', 't', 'a', 's', 'h', 'k', 'e', 'n', 't',
+	't', 'e', 'r', 'm', 'e', 'z', 't', 'o', 'g', 'l', 'i', 'a', 't', 't', 'i', 't',
+	'r', 'o', 'i', 't', 's', 'k', 't', 's', 'e', 'l', 'i', 'n', 'o', 'g', 'r', 'a',
+	'd', 't', 'u', 'l', 'a', 't', 'u', 'v', 'a', 'v', 'o', 'l', 'o', 'g', 'd', 'a',
+	'k', 'n', 'i', 'g', 'h', 't', 'p', 'o', 'i', 'n', 't', 'm', 'i', 'n', 'c', 'o',
+	'm', 'o', 'r', 'a', 'n', 'g', 'e', 'c', 'l', 'o', 'u', 'd', '6', '1', '1', 'v',
+	'p', 'n', 'p', 'l', 'u', 's', 'p', 'r', 'e', 'q', 'u', 'a', 'l', 'i', 'f', 'y',
+	'm', 'e', 'n', 't', 'd', 'l', 'l', 'b', 'e', 't', 't', 'e', 'r', '-', 't', 'h',
+	'a', 'n', 'o', 'n', '-', 't', 'h', 'e', '-', 'w', 'e', 'b', 'w', 'o', 'r', 's',
+	'e', '-', 't', 'h', 'a', 'n', 'e', 'b', 'i', 'z', 'x', 'n', '-', '-', 'c', 'z',
+	'r', 'w', '2', '8', 'b', 'x', 'n', '-', '-', 'z', 'f', '0', 'a', 'o', '6', '4',
+	'a', 'c', 'h', 'e', 'r', 'k', 'a', 's', 's', 'y', 'c', 'h', 'e', 'r', 'k', 'a',
+	's', 'y', 'c', 'h', 'e', 'r', 'n', 'i', 'g', 'o', 'v', 'c', 'h', 'e', 'r', 'n',
+	'i', 'h', 'i', 'v', 'c', 'h', 'e', 'r', 'n', 'i', 'v', 't', 's', 'i', 'c', 'h',
+	'e', 'r', 'n', 'o', 'v', 't', 's', 'y', 'c', 'r', 'i', 'm', 'e', 'a', 'd', 'n',
+	'e', 'p', 'r', 'o', 'p', 'e', 't', 'r', 'o', 'v', 's', 'k', 'd', 'n', 'i', 'p',
+	'r', 'o', 'p', 'e', 't', 'r', 'o', 'v', 's', 'k', 'd', 'o', 'n', 'e', 't', 's',
+	'k', 'i', 'v', 'a', 'n', 'o', '-', 'f', 'r', 'a', 'n', 'k', 'i', 'v', 's', 'k',
+	'k', 'h', 'a', 'r', 'k', 'i', 'v', 'k', 'h', 'a', 'r', 'k', 'o', 'v', 'k', 'h',
+	'e', 'r', 's', 'o', 'n', 'k', 'h', 'm', 'e', 'l', 'n', 'i', 't', 's', 'k', 'i',
+	'y', 'k', 'h', 'm', 'e', 'l', 'n', 'y', 't', 's', 'k', 'y', 'i', 'k', 'i', 'e',
+	'v', 'k', 'i', 'r', 'o', 'v', 'o', 'g', 'r', 'a', 'd', 'k', 'r', 'y', 'm', 'k',
+	'y', 'i', 'v', 'l', 'u', 'g', 'a', 'n', 's', 'k', 'l', 'u', 't', 's', 'k', 'l',
+	'v', 'i', 'v', 'm', 'y', 'k', 'o', 'l', 'a', 'i', 'v', 'n', 'i', 'k', 'o', 'l',
+	'a', 'e', 'v', 'o', 'd', 'e', 's', 'a', 'o', 'd', 'e', 's', 's', 'a', 'p', 'o',
+	'l', 't', 'a', 'v', 'a', 'r', 'i', 'v', 'n', 'e', 'r', 'o', 'v', 'n', 'o', 's',
+	'e', 'b', 'a', 's', 't', 'o', 'p', 'o', 'l', 's', 'e', 'v', 'a', 's', 't', 'o',
+	'p', 'o', 'l', 's', 'u', 'm', 'y', 't', 'e', 'r', 'n', 'o', 'p', 'i', 'l', 'u',
+	'z', 'h', 'g', 'o', 'r', 'o', 'd', 'v', 'i', 'n', 'n', 'i', 'c', 'a', 'v', 'i',
+	'n', 'n', 'y', 't', 's', 'i', 'a', 'v', 'o', 'l', 'y', 'n', 'y', 'a', 'l', 't',
+	'a', 'z', 'a', 'p', 'o', 'r', 'i', 'z', 'h', 'z', 'h', 'e', 'z', 'a', 'p', 'o',
+	'r', 'i', 'z', 'h', 'z', 'h', 'i', 'a', 'z', 'h', 'i', 't', 'o', 'm', 'i', 'r',
+	'z', 'h', 'y', 't', 'o', 'm', 'y', 'r', 'c', 'o', 'p', 'r', 'o', 'i', 'n', 'd',
+	'e', 'p', 'e', 'n', 'd', 'e', 'n', 't', '-', 'c', 'o', 'm', 'm', 'i', 's', 's',
+	'i', 'o', 'n', 'i', 'n', 'd', 'e', 'p', 'e', 'n', 'd', 'e', 'n', 't', '-', 'i',
+	'n', 'q', 'u', 'e', 's', 't', 'i', 'n', 'd', 'e', 'p', 'e', 'n', 'd', 'e', 'n',
+	't', '-', 'i', 'n', 'q', 'u', 'i', 'r', 'y', 'i', 'n', 'd', 'e', 'p', 'e', 'n',
+	'd', 'e', 'n', 't', '-', 'p', 'a', 'n', 'e', 'l', 'i', 'n', 'd', 'e', 'p', 'e',
+	'n', 'd', 'e', 'n', 't', '-', 'r', 'e', 'v', 'i', 'e', 'w', 'n', 'h', 's', 'p',
+	'o', 'l', 'i', 'c', 'e', 'p', 'u', 'b', 'l', 'i', 'c', '-', 'i', 'n', 'q', 'u',
+	'i', 'r', 'y', 'p', 'y', 'm', 'n', 't', 'r', 'o', 'y', 'a', 'l', '-', 'c', 'o',
+	'm', 'm', 'i', 's', 's', 'i', 'o', 'n', 'g', 'o', 'l', 'f', 'f', 'a', 'n', 'g',
+	'r', 'a', 'p', 'h', 'o', 'x', 'i', 's', '-', 'b', 'y', 'l', 'a', 'n', 'd', '-',
+	'4', '-', 's', 'a', 'l', 'e', 'n', 's', 'n', 'p', 'l', 'a', 't', 't', 'e', 'r',
+	'p', 'p', 'o', 'i', 'n', 't', 't', 'o', 'g', 'u', 'b', 'c', 'l', 'o', 'u', 'd',
+	'6', '6', 'm', 'y', 'p', 'e', 't', 's', 'x', 'n', '-', '-', '4', 'd', 'b', 'g',
+	'd', 't', 'y', '6', 'c', 'x', 'n', '-', '-', '5', 'd', 'b', 'h', 'l', '8', 'd',
+	'x', 'n', '-', '-', '8', 'd', 'b', 'q', '2', 'a', 'x', 'n', '-', '-', 'h', 'e',
+	'b', 'd', 'a', '8', 'b', 'x', 'n', '-', '-', '8', '0', 'a', 'u', 'x', 'n', '-',
+	'-', '9', '0', 'a', 'z', 'h', 'x', 'n', '-', '-', 'd', '1', 'a', 't', 'x', 'n',
+	'-', '-', 'o', '1', 'a', 'c', 'x', 'n', '-', '-', 'o', '1', 'a', 'c', 'h', 'x',
+	'n', '-', '-', '1', '2', 'c', '1', 'f', 'e', '0', 'b', 'r', 'x', 'n', '-', '-',
+	'1', '2', 'c', 'f', 'i', '8', 'i', 'x', 'b', '8', 'l', 'x', 'n', '-', '-', '1',
+	'2', 'c', 'o', '0', 'c', '3', 'b', '4', 'e', 'v', 'a', 'x', 'n', '-', '-', 'h',
+	'3', 'c', 'u', 'z', 'k', '1', 'd', 'i', 'x', 'n', '-', '-', 'm', '3', 'c', 'h',
+	'0', 'j', '3', 'a', 'x', 'n', '-', '-', 'o', '3', 'c', 'y', 'x', '2', 'a', 'x',
+	'n', '-', '-', '4', '1', 'a', 'x', 'n', '-', '-', '8', '0', 'a', 'a', 'a', '0',
+	'c', 'v', 'a', 'c', 'x', 'n', '-', '-', '9', '0', 'a', '1', 'a', 'f', 'x', 'n',
+	'-', '-', '9', '0', 'a', 'm', 'c', 'x', 'n', '-', '-', 'h', '1', 'a', 'h', 'n',
+	'x', 'n', '-', '-', 'h', '1', 'a', 'l', 'i', 'z', 'x', 'n', '-', '-', 'j', '1',
+	'a', 'd', 'p', 'x', 'n', '-', '-', 'j', '1', 'a', 'e', 'l', '8', 'b', 'c', 'r',
+	'a', 'f', 't', 'i', 'n', 'g', 'l', 'o', 'c', 'a', 'l', 'z', 'o', 'n', 'e', 'g',
+	'r', 'o', 'n', 'd', 'a', 'r', 't', 'r', 'i', 't', 'o', 'n', 'p', 'r', 'i', 'v',
+	'a', 't', 'e', 'l', 'i', 'n', 'k', 'k', 'u', 'n', 'd', 'e', 'n', 'c', 'l', 'o',
+	'u', 'd', 'l', 'e', 't', 's', 'e', 'z', 'p', 'r', 'o', 'x', 'y', 'v', 'i', 'r',
+	't', 'u', 'a', 'l', 'c', 'l', 'o', 'u', 'd', 'i', 'n', 's', 't', 'a', 'n', 'c',
+	'e', 's', 's', 'v', 'c', 'a', 'p', 'p', 'e', 'n', 'g', 'i', 'n', 'e', 'e', 's',
+	'-', '1', 'b', 'a', 'r', 'e', 'm', 'e', 't', 'a', 'l', 'f', 'r', '-', 'p', 'a',
+	'r', 'k', '8', 's', 'n', 'l', '-', 'a', 'm', 's', 'p', 'l', '-', 'w', 'a', 'w',
+	's', 'c', 'a', 'l', 'e', 'b', 'o', 'o', 'k', 's', 'm', 'a', 'r', 't', 'l', 'a',
+	'b', 'e', 'l', 'i', 'n', 'g', 'a', 'f', '-', 's', 'o', 'u', 't', 'h', '-', '1',
+	'a', 'p', '-', 'e', 'a', 's', 't', '-', '1', 'a', 'p', '-', 'n', 'o', 'r', 't',
+	'h', 'e', 'a', 's', 't', '-', '1', 'a', 'p', '-', 'n', 'o', 'r', 't', 'h', 'e',
+	'a', 's', 't', '-', '2', 'a', 'p', '-', 'n', 'o', 'r', 't', 'h', 'e', 'a', 's',
+	't', '-', '3', 'a', 'p', '-', 's', 'o', 'u', 't', 'h', '-', '1', 'a', 'p', '-',
+	's', 'o', 'u', 't', 'h', 'e', 'a', 's', 't', '-', '1', 'a', 'p', '-', 's', 'o',
+	'u', 't', 'h', 'e', 'a', 's', 't', '-', '2', 'c', 'a', '-', 'c', 'e', 'n', 't',
+	'r', 'a', 'l', '-', '1', 'c', 'o', 'm', 'p', 'u', 't', 'e', '-', '1', 'e', 'u',
+	'-', 'c', 'e', 'n', 't', 'r', 'a', 'l', '-', '1', 'e', 'u', '-', 'n', 'o', 'r',
+	't', 'h', '-', '1', 'e', 'u', '-', 's', 'o', 'u', 't', 'h', '-', '1', 'e', 'u',
+	'-', 'w', 'e', 's', 't', '-', '1', 'e', 'u', '-', 'w', 'e', 's', 't', '-', '2',
+	'e', 'u', '-', 'w', 'e', 's', 't', '-', '3', 'm', 'e', '-', 's', 'o', 'u', 't',
+	'h', '-', '1', 's', '3', 's', '3', '-', 'a', 'p', '-', 'n', 'o', 'r', 't', 'h',
+	'e', 'a', 's', 't', '-', '1', 's', '3', '-', 'a', 'p', '-', 'n', 'o', 'r', 't',
+	'h', 'e', 'a', 's', 't', '-', '2', 's', '3', '-', 'a', 'p', '-', 's', 'o', 'u',
+	't', 'h', '-', '1', 's', '3', '-', 'a', 'p', '-', 's', 'o', 'u', 't', 'h', 'e',
+	'a', 's', 't', '-', '1', 's', '3', '-', 'a', 'p', '-', 's', 'o', 'u', 't', 'h',
+	'e', 'a', 's', 't', '-', '2', 's', '3', '-', 'c', 'a', '-', 'c', 'e', 'n', 't',
+	'r', 'a', 'l', '-', '1', 's', '3', '-', 'e', 'u', '-', 'c', 'e', 'n', 't', 'r',
+	'a', 'l', '-', '1', 's', '3', '-', 'e', 'u', '-', 'w', 'e', 's', 't', '-', '1',
+	's', '3', '-', 'e', 'u', '-', 'w', 'e', 's', 't', '-', '2', 's', '3', '-', 'e',
+	'u', '-', 'w', 'e', 's', 't', '-', '3', 's', '3', '-', 'e', 'x', 't', 'e', 'r',
+	'n', 'a', 'l', '-', '1', 's', '3', '-', 'f', 'i', 'p', 's', '-', 'u', 's', '-',
+	'g', 'o', 'v', '-', 'w', 'e', 's', 't', '-', '1', 's', '3', '-', 's', 'a', '-',
+	'e', 'a', 's', 't', '-', '1', 's', '3', '-', 'u', 's', '-', 'e', 'a', 's', 't',
+	'-', '2', 's', '3', '-', 'u', 's', '-', 'g', 'o', 'v', '-', 'w', 'e', 's', 't',
+	'-', '1', 's', '3', '-', 'u', 's', '-', 'w', 'e', 's', 't', '-', '1', 's', '3',
+	'-', 'u', 's', '-', 'w', 'e', 's', 't', '-', '2', 's', '3', '-', 'w', 'e', 'b',
+	's', 'i', 't', 'e', '-', 'a', 'p', '-', 'n', 'o', 'r', 't', 'h', 'e', 'a', 's',
+	't', '-', '1', 's', '3', '-', 'w', 'e', 'b', 's', 'i', 't', 'e', '-', 'a', 'p',
+	'-', 's', 'o', 'u', 't', 'h', 'e', 'a', 's', 't', '-', '1', 's', '3', '-', 'w',
+	'e', 'b', 's', 'i', 't', 'e', '-', 'a', 'p', '-', 's', 'o', 'u', 't', 'h', 'e',
+	'a', 's', 't', '-', '2', 's', '3', '-', 'w', 'e', 'b', 's', 'i', 't', 'e', '-',
+	'e', 'u', '-', 'w', 'e', 's', 't', '-', '1', 's', '3', '-', 'w', 'e', 'b', 's',
+	'i', 't', 'e', '-', 's', 'a', '-', 'e', 'a', 's', 't', '-', '1', 's', '3', '-',
+	'w', 'e', 'b', 's', 'i', 't', 'e', '-', 'u', 's', '-', 'e', 'a', 's', 't', '-',
+	'1', 's', '3', '-', 'w', 'e', 'b', 's', 'i', 't', 'e', '-', 'u', 's', '-', 'w',
+	'e', 's', 't', '-', '1', 's', '3', '-', 'w', 'e', 'b', 's', 'i', 't', 'e', '-',
+	'u', 's', '-', 'w', 'e', 's', 't', '-', '2', 'd', 'e', 'v', '-', 'b', 'u', 'i',
+	'l', 'd', 'e', 'r', 's', 't', 'g', '-', 'b', 'u', 'i', 'l', 'd', 'e', 'r', 'o',
+	'c', 'p', 'e', 'u', '-', '1', 'e', 'u', '-', '2', 'e', 'u', '-', '3', 'e', 'u',
+	'-', '4', 'u', 's', '-', '1', 'u', 's', '-', '2', 'u', 's', '-', '3', 'u', 's',
+	'-', '4', 'r', 'a', 'g', '-', 'c', 'l', 'o', 'u', 'd', 'r', 'a', 'g', '-', 'c',
+	'l', 'o', 'u', 'd', '-', 'c', 'h', 'j', 'c', 'l', 'o', 'u', 'd', '-', 'v', 'e',
+	'r', '-', 'j', 'p', 'c', 'c', 'n', 's', 'm', 'e', 'm', 'b', 'e', 'r', 's', 'n',
+	'o', 'd', 'e', 'b', 'a', 'l', 'a', 'n', 'c', 'e', 'r', 'c', 'a', 'r', 'a', 'c',
+	'a', 'l', 'f', 'e', 'n', 't', 'i', 'g', 'e', 'r', 'l', 'y', 'n', 'x', 'o', 'c',
+	'e', 'l', 'o', 't', 'o', 'n', 'c', 'i', 'l', 'l', 'a', 's', 'p', 'h', 'i', 'n',
+	'x', 'j', 'e', 'd', 'u', '2', '-', 'l', 'o', 'c', 'a', 'l', 'b', 'z', 'z', 'g',
+	'i', 't', '-', 'p', 'a', 'g', 'e', 's', 'd', 'a', 'e', 'm', 'o', 'n', 'r', 'a',
+	'v', 'p', 'a', 'g', 'e', 't', 'a', 'b', 'i', 't', 'o', 'r', 'd', 'e', 'r', 'b',
+	'a', 'c', 'k', 'y', 'a', 'r', 'd', 's', 's', 'e', 'k', 'd', '1', 'u', 'k', '0',
+	'm', 'o', 'c', 'k', 'd', 'i', 's', 'r', 'e', 'c', 't', 'e', 's', 't', 'i', 'n',
+	'g', 'c', 'l', 'o', 'u', 'd', '-', 'f', 'r', '1', 'a', 'i', 's', 'a', 'i', 'a',
+	's', 'u', 'k', 'e', 'c', 'h', 'i', 'r', 'y', 'u', 'f', 'u', 's', 'o', 'g', 'a',
+	'm', 'a', 'g', 'o', 'r', 'i', 'h', 'a', 'n', 'd', 'a', 'h', 'a', 'z', 'u', 'h',
+	'e', 'k', 'i', 'n', 'a', 'n', 'h', 'i', 'g', 'a', 's', 'h', 'i', 'u', 'r', 'a',
+	'i', 'c', 'h', 'i', 'n', 'o', 'm', 'i', 'y', 'a', 'i', 'n', 'a', 'z', 'a', 'w',
+	'a', 'i', 'n', 'u', 'y', 'a', 'm', 'a', 'i', 's', 's', 'h', 'i', 'k', 'i', 'i',
+	'w', 'a', 'k', 'u', 'r', 'a', 'k', 'a', 'n', 'i', 'e', 'k', 'a', 'r', 'i', 'y',
+	'a', 'k', 'a', 's', 'u', 'g', 'a', 'i', 'k', 'i', 'y', 'o', 's', 'u', 'k', 'o',
+	'm', 'a', 'k', 'i', 'k', 'o', 'n', 'a', 'n', 'k', 'o', 't', 'a', 'm', 'i', 'h',
+	'a', 'm', 'a', 'm', 'i', 'y', 'o', 's', 'h', 'i', 'n', 'i', 's', 'h', 'i', 'o',
+	'n', 'i', 's', 's', 'h', 'i', 'n', 'o', 'g', 'u', 'c', 'h', 'i', 'o', 'h', 'a',
+	'r', 'u', 'o', 'k', 'a', 'z', 'a', 'k', 'i', 'o', 'w', 'a', 'r', 'i', 'a', 's',
+	'a', 'h', 'i', 's', 'h', 'i', 'k', 'a', 't', 's', 'u', 's', 'h', 'i', 'n', 's',
+	'h', 'i', 'r', 'o', 's', 'h', 'i', 't', 'a', 'r', 'a', 't', 'a', 'h', 'a', 'r',
+	'a', 't', 'a', 'k', 'a', 'h', 'a', 'm', 'a', 't', 'o', 'b', 'i', 's', 'h', 'i',
+	'm', 'a', 't', 'o', 'e', 'i', 't', 'o', 'g', 'o', 't', 'o', 'k', 'a', 'i', 't',
+	'o', 'k', 'o', 'n', 'a', 'm', 'e', 't', 'o', 'y', 'o', 'a', 'k', 'e', 't', 'o',
+	'y', 'o', 'h', 'a', 's', 'h', 'i', 't', 'o', 'y', 'o', 'k', 'a', 'w', 'a', 't',
+	'o', 'y', 'o', 'n', 'e', 't', 's', 'u', 's', 'h', 'i', 'm', 'a', 'y', 'a', 't',
+	'o', 'm', 'i', 'd', 'a', 'i', 's', 'e', 'n', 'f', 'u', 'j', 'i', 's', 'a', 't',
+	'o', 'g', 'o', 'j', 'o', 'm', 'e', 'h', 'a', 'c', 'h', 'i', 'r', 'o', 'g', 'a',
+	't', 'a', 'h', 'a', 'p', 'p', 'o', 'u', 'h', 'i', 'g', 'a', 's', 'h', 'i', 'n',
+	'a', 'r', 'u', 's', 'e', 'h', 'o', 'n', 'j', 'o', 'h', 'o', 'n', 'j', 'y', 'o',
+	'k', 'a', 'm', 'i', 'k', 'o', 'a', 'n', 'i', 'k', 'a', 'm', 'i', 'o', 'k', 'a',
+	'k', 'a', 't', 'a', 'g', 'a', 'm', 'i', 'k', 'a', 'z', 'u', 'n', 'o', 'k', 'i',
+	't', 'a', 'a', 'k', 'i', 't', 'a', 'k', 'o', 's', 'a', 'k', 'a', 'k', 'y', 'o',
+	'w', 'a', 'm', 'i', 's', 'a', 't', 'o', 'm', 'i', 't', 'a', 'n', 'e', 'm', 'o',
+	'r', 'i', 'y', 'o', 's', 'h', 'i', 'n', 'i', 'k', 'a', 'h', 'o', 'n', 'o', 's',
+	'h', 'i', 'r', 'o', 'o', 'd', 'a', 't', 'e', 's', 'e', 'm', 'b', 'o', 'k', 'u',
+	'y', 'o', 'k', 'o', 't', 'e', 'y', 'u', 'r', 'i', 'h', 'o', 'n', 'j', 'o', 'g',
+	'o', 'n', 'o', 'h', 'e', 'h', 'a', 'c', 'h', 'i', 'n', 'o', 'h', 'e', 'h', 'a',
+	's', 'h', 'i', 'k', 'a', 'm', 'i', 'h', 'i', 'r', 'a', 'n', 'a', 'i', 'h', 'i',
+	'r', 'o', 's', 'a', 'k', 'i', 'i', 't', 'a', 'y', 'a', 'n', 'a', 'g', 'i', 'k',
+	'u', 'r', 'o', 'i', 's', 'h', 'i', 'm', 'i', 's', 'a', 'w', 'a', 'm', 'u', 't',
+	's', 'u', 'n', 'a', 'k', 'a', 'd', 'o', 'm', 'a', 'r', 'i', 'n', 'o', 'h', 'e',
+	'j', 'i', 'o', 'i', 'r', 'a', 's', 'e', 'o', 'w', 'a', 'n', 'i', 'r', 'o', 'k',
+	'u', 'n', 'o', 'h', 'e', 's', 'a', 'n', 'n', 'o', 'h', 'e', 's', 'h', 'i', 'c',
+	'h', 'i', 'n', 'o', 'h', 'e', 's', 'h', 'i', 'n', 'g', 'o', 't', 'a', 'k', 'k',
+	'o', 't', 'o', 'w', 'a', 'd', 'a', 't', 's', 'u', 'g', 'a', 'r', 'u', 't', 's',
+	'u', 'r', 'u', 't', 'a', 'a', 'b', 'i', 'k', 'o', 'c', 'h', 'o', 'n', 'a', 'n',
+	'c', 'h', 'o', 's', 'e', 'i', 'c', 'h', 'o', 's', 'h', 'i', 'c', 'h', 'u', 'o',
+	'f', 'u', 'n', 'a', 'b', 'a', 's', 'h', 'i', 'f', 'u', 't', 't', 's', 'u', 'h',
+	'a', 'n', 'a', 'm', 'i', 'g', 'a', 'w', 'a', 'i', 'c', 'h', 'i', 'h', 'a', 'r',
+	'a', 'i', 'c', 'h', 'i', 'k', 'a', 'w', 'a', 'i', 'n', 'z', 'a', 'i', 'i', 's',
+	'u', 'm', 'i', 'k', 'a', 'm', 'a', 'g', 'a', 'y', 'a', 'k', 'a', 'm', 'o', 'g',
+	'a', 'w', 'a', 'k', 'a', 's', 'h', 'i', 'w', 'a', 'k', 'a', 't', 'o', 'r', 'i',
+	'k', 'a', 't', 's', 'u', 'u', 'r', 'a', 'k', 'i', 'm', 'i', 't', 's', 'u', 'k',
+	'i', 's', 'a', 'r', 'a', 'z', 'u', 'k', 'o', 'z', 'a', 'k', 'i', 'k', 'u', 'j',
+	'u', 'k', 'u', 'r', 'i', 'k', 'y', 'o', 'n', 'a', 'n', 'm', 'a', 't', 's', 'u',
+	'd', 'o', 'm', 'i', 'd', 'o', 'r', 'i', 'm', 'i', 'n', 'a', 'm', 'i', 'b', 'o',
+	's', 'o', 'm', 'o', 'b', 'a', 'r', 'a', 'm', 'u', 't', 's', 'u', 'z', 'a', 'w',
+	'a', 'n', 'a', 'g', 'a', 'r', 'a', 'n', 'a', 'g', 'a', 'r', 'e', 'y', 'a', 'm',
+	'a', 'n', 'a', 'r', 'a', 's', 'h', 'i', 'n', 'o', 'n', 'a', 'r', 'i', 't', 'a',
+	'o', 'a', 'm', 'i', 's', 'h', 'i', 'r', 'a', 's', 'a', 't', 'o', 'o', 'm', 'i',
+	'g', 'a', 'w', 'a', 'o', 'n', 'j', 'u', 'k', 'u', 'o', 't', 'a', 'k', 'i', 's',
+	'a', 'k', 'a', 'e', 's', 'h', 'i', 'm', 'o', 'f', 'u', 's', 'a', 's', 'h', 'i',
+	'r', 'a', 'k', 'o', 's', 'h', 'i', 'r', 'o', 'i', 's', 'h', 'i', 's', 'u', 'i',
+	's', 'o', 'd', 'e', 'g', 'a', 'u', 'r', 'a', 't', 'a', 't', 'e', 'y', 'a', 'm',
+	'a', 't', 'o', 'g', 'a', 'n', 'e', 't', 'o', 'h', 'n', 'o', 's', 'h', 'o', 't',
+	'o', 'm', 'i', 's', 'a', 't', 'o', 'u', 'r', 'a', 'y', 'a', 's', 'u', 'y', 'a',
+	'c', 'h', 'i', 'm', 'a', 't', 'a', 'y', 'a', 'c', 'h', 'i', 'y', 'o', 'y', 'o',
+	'k', 'a', 'i', 'c', 'h', 'i', 'b', 'a', 'y', 'o', 'k', 'o', 's', 'h', 'i', 'b',
+	'a', 'h', 'i', 'k', 'a', 'r', 'i', 'y', 'o', 't', 's', 'u', 'k', 'a', 'i', 'd',
+	'o', 'a', 'i', 'n', 'a', 'n', 'h', 'o', 'n', 'a', 'i', 'i', 'k', 'a', 't', 'a',
+	'i', 'm', 'a', 'b', 'a', 'r', 'i', 'k', 'a', 'm', 'i', 'j', 'i', 'm', 'a', 'k',
+	'i', 'h', 'o', 'k', 'u', 'k', 'u', 'm', 'a', 'k', 'o', 'g', 'e', 'n', 'm', 'a',
+	's', 'a', 'k', 'i', 'm', 'a', 't', 's', 'u', 'n', 'o', 'm', 'a', 't', 's', 'u',
+	'y', 'a', 'm', 'a', 'n', 'a', 'm', 'i', 'k', 'a', 't', 'a', 'n', 'i', 'i', 'h',
+	'a', 'm', 'a', 'o', 'z', 'u', 's', 'a', 'i', 'j', 'o', 's', 'e', 'i', 'y', 'o',
+	's', 'h', 'i', 'k', 'o', 'k', 'u', 'c', 'h', 'u', 'o', 'u', 'c', 'h', 'i', 'k',
+	'o', 'u', 'w', 'a', 'j', 'i', 'm', 'a', 'y', 'a', 'w', 'a', 't', 'a', 'h', 'a',
+	'm', 'a', 'e', 'c', 'h', 'i', 'z', 'e', 'n', 'e', 'i', 'h', 'e', 'i', 'j', 'i',
+	'i', 'k', 'e', 'd', 'a', 'k', 'a', 't', 's', 'u', 'y', 'a', 'm', 'a', 'm', 'i',
+	'n', 'a', 'm', 'i', 'e', 'c', 'h', 'i', 'z', 'e', 'n', 'o', 'b', 'a', 'm', 'a',
+	's', 'a', 'b', 'a', 'e', 's', 'a', 'k', 'a', 'i', 't', 's', 'u', 'r', 'u', 'g',
+	'a', 'w', 'a', 'k', 'a', 's', 'a', 'a', 's', 'h', 'i', 'y', 'a', 'b', 'u', 'z',
+	'e', 'n', 'c', 'h', 'i', 'k', 'u', 'g', 'o', 'c', 'h', 'i', 'k', 'u', 'h', 'o',
+	'c', 'h', 'i', 'k', 'u', 'j', 'o', 'c', 'h', 'i', 'k', 'u', 's', 'h', 'i', 'n',
+	'o', 'c', 'h', 'i', 'k', 'u', 'z', 'e', 'n', 'd', 'a', 'z', 'a', 'i', 'f', 'u',
+	'f', 'u', 'k', 'u', 'c', 'h', 'i', 'h', 'a', 'k', 'a', 't', 'a', 'h', 'i', 'r',
+	'o', 'k', 'a', 'w', 'a', 'h', 'i', 's', 'a', 'y', 'a', 'm', 'a', 'i', 'i', 'z',
+	'u', 'k', 'a', 'i', 'n', 'a', 't', 's', 'u', 'k', 'i', 'k', 'a', 's', 'u', 'y',
+	'a', 'k', 'a', 'w', 'a', 'r', 'a', 'k', 'e', 'i', 's', 'e', 'n', 'k', 'u', 'r',
+	'a', 't', 'e', 'k', 'u', 'r', 'o', 'g', 'i', 'k', 'u', 'r', 'u', 'm', 'e', 'm',
+	'i', 'y', 'a', 'k', 'o', 'm', 'i', 'y', 'a', 'm', 'a', 'm', 'i', 'y', 'a', 'w',
+	'a', 'k', 'a', 'm', 'i', 'z', 'u', 'm', 'a', 'k', 'i', 'm', 'u', 'n', 'a', 'k',
+	'a', 't', 'a', 'n', 'a', 'k', 'a', 'g', 'a', 'w', 'a', 'n', 'o', 'g', 'a', 't',
+	'a', 'o', 'g', 'o', 'r', 'i', 'o', 'k', 'a', 'g', 'a', 'k', 'i', 'o', 'm', 'u',
+	't', 'a', 'o', 'n', 'o', 'j', 'o', 's', 'a', 'i', 'g', 'a', 'w', 'a', 's', 'a',
+	's', 'a', 'g', 'u', 'r', 'i', 's', 'h', 'i', 'n', 'g', 'u', 's', 'h', 'i', 'n',
+	'y', 'o', 's', 'h', 'i', 't', 'o', 'm', 'i', 's', 'h', 'o', 'n', 'a', 'i', 's',
+	'o', 'e', 'd', 'a', 't', 'a', 'c', 'h', 'i', 'a', 'r', 'a', 'i', 't', 'a', 'g',
+	'a', 'w', 'a', 't', 'a', 'k', 'a', 't', 'a', 't', 'o', 'h', 'o', 't', 'o', 'y',
+	'o', 't', 's', 'u', 't', 's', 'u', 'i', 'k', 'i', 'u', 'k', 'i', 'h', 'a', 'u',
+	's', 'u', 'i', 'y', 'a', 'm', 'a', 'd', 'a', 'y', 'a', 'n', 'a', 'g', 'a', 'w',
+	'a', 'y', 'u', 'k', 'u', 'h', 'a', 's', 'h', 'i', 'a', 'i', 'z', 'u', 'b', 'a',
+	'n', 'g', 'e', 'a', 'i', 'z', 'u', 'm', 'i', 's', 'a', 't', 'o', 'a', 'i', 'z',
+	'u', 'w', 'a', 'k', 'a', 'm', 'a', 't', 's', 'u', 'a', 's', 'a', 'k', 'a', 'w',
+	'a', 'b', 'a', 'n', 'd', 'a', 'i', 'f', 'u', 'r', 'u', 'd', 'o', 'n', 'o', 'f',
+	'u', 't', 'a', 'b', 'a', 'h', 'a', 'n', 'a', 'w', 'a', 'h', 'i', 'r', 'a', 't',
+	'a', 'h', 'i', 'r', 'o', 'n', 'o', 'i', 'i', 't', 'a', 't', 'e', 'i', 'n', 'a',
+	'w', 'a', 's', 'h', 'i', 'r', 'o', 'i', 'w', 'a', 'k', 'i', 'i', 'z', 'u', 'm',
+	'i', 'z', 'a', 'k', 'i', 'k', 'a', 'g', 'a', 'm', 'i', 'i', 's', 'h', 'i', 'k',
+	'a', 'n', 'e', 'y', 'a', 'm', 'a', 'k', 'a', 'w', 'a', 'm', 'a', 't', 'a', 'k',
+	'i', 't', 'a', 'k', 'a', 't', 'a', 'k', 'i', 't', 'a', 's', 'h', 'i', 'o', 'b',
+	'a', 'r', 'a', 'k', 'o', 'o', 'r', 'i', 'k', 'o', 'r', 'i', 'y', 'a', 'm', 'a',
+	'k', 'u', 'n', 'i', 'm', 'i', 'm', 'i', 'h', 'a', 'r', 'u', 'm', 'i', 's', 'h',
+	'i', 'm', 'a', 'n', 'a', 'n', 'g', 'o', 'n', 'i', 's', 'h', 'i', 'a', 'i', 'z',
+	'u', 'n', 'i', 's', 'h', 'i', 'g', 'o', 'o', 'k', 'u', 'm', 'a', 'o', 'm', 'o',
+	't', 'e', 'g', 'o', 'o', 't', 'a', 'm', 'a', 's', 'a', 'm', 'e', 'g', 'a', 'w',
+	'a', 's', 'h', 'i', 'm', 'o', 'g', 'o', 's', 'h', 'i', 'r', 'a', 'k', 'a', 'w',
+	'a', 's', 'h', 'o', 'w', 'a', 's', 'u', 'k', 'a', 'g', 'a', 'w', 'a', 't', 'a',
+	'i', 's', 'h', 'i', 'n', 't', 'a', 'm', 'a', 'k', 'a', 'w', 'a', 't', 'a', 'n',
+	'a', 'g', 'u', 'r', 'a', 't', 'e', 'n', 'e', 'i', 'y', 'a', 'b', 'u', 'k', 'i',
+	'y', 'a', 'm', 'a', 't', 's', 'u', 'r', 'i', 'y', 'a', 'n', 'a', 'i', 'z', 'u',
+	'y', 'u', 'g', 'a', 'w', 'a', 'a', 'n', 'p', 'a', 'c', 'h', 'i', 'g', 'i', 'n',
+	'a', 'n', 'g', 'o', 'd', 'o', 'g', 'u', 'j', 'o', 'h', 'a', 's', 'h', 'i', 'm',
+	'a', 'h', 'i', 'c', 'h', 'i', 's', 'o', 'h', 'i', 'd', 'a', 'h', 'i', 'g', 'a',
+	's', 'h', 'i', 's', 'h', 'i', 'r', 'a', 'k', 'a', 'w', 'a', 'i', 'b', 'i', 'g',
+	'a', 'w', 'a', 'k', 'a', 'k', 'a', 'm', 'i', 'g', 'a', 'h', 'a', 'r', 'a', 'k',
+	'a', 's', 'a', 'h', 'a', 'r', 'a', 'k', 'a', 's', 'a', 'm', 'a', 't', 's', 'u',
+	'k', 'a', 'w', 'a', 'u', 'e', 'k', 'i', 't', 'a', 'g', 'a', 't', 'a', 'm', 'i',
+	'n', 'o', 'm', 'i', 'n', 'o', 'k', 'a', 'm', 'o', 'm', 'i', 't', 'a', 'k', 'e',
+	'm', 'i', 'z', 'u', 'n', 'a', 'm', 'i', 'm', 'o', 't', 'o', 's', 'u', 'n', 'a',
+	'k', 'a', 't', 's', 'u', 'g', 'a', 'w', 'a', 'o', 'g', 'a', 'k', 'i', 's', 'a',
+	'k', 'a', 'h', 'o', 'g', 'i', 's', 'e', 'k', 'i', 's', 'e', 'k', 'i', 'g', 'a',
+	'h', 'a', 'r', 'a', 't', 'a', 'j', 'i', 'm', 'i', 't', 'a', 'k', 'a', 'y', 'a',
+	'm', 'a', 't', 'a', 'r', 'u', 'i', 't', 'o', 'k', 'i', 't', 'o', 'm', 'i', 'k',
+	'a', 'w', 'a', 'n', 'o', 'u', 'c', 'h', 'i', 'y', 'a', 'o', 't', 's', 'u', 'y',
+	'o', 'r', 'o', 'a', 'n', 'n', 'a', 'k', 'a', 'c', 'h', 'i', 'y', 'o', 'd', 'a',
+	'f', 'u', 'j', 'i', 'o', 'k', 'a', 'h', 'i', 'g', 'a', 's', 'h', 'i', 'a', 'g',
+	'a', 't', 's', 'u', 'm', 'a', 'i', 's', 'e', 's', 'a', 'k', 'i', 'i', 't', 'a',
+	'k', 'u', 'r', 'a', 'k', 'a', 'n', 'n', 'a', 'k', 'a', 'n', 'r', 'a', 'k', 'a',
+	't', 'a', 's', 'h', 'i', 'n', 'a', 'k', 'i', 'r', 'y', 'u', 'k', 'u', 's', 'a',
+	't', 's', 'u', 'm', 'a', 'e', 'b', 'a', 's', 'h', 'i', 'm', 'e', 'i', 'w', 'a',
+	'm', 'i', 'n', 'a', 'k', 'a', 'm', 'i', 'n', 'a', 'g', 'a', 'n', 'o', 'h', 'a',
+	'r', 'a', 'n', 'a', 'k', 'a', 'n', 'o', 'j', 'o', 'n', 'a', 'n', 'm', 'o', 'k',
+	'u', 'n', 'u', 'm', 'a', 't', 'a', 'o', 'i', 'z', 'u', 'm', 'i', 's', 'h', 'i',
+	'b', 'u', 'k', 'a', 'w', 'a', 's', 'h', 'i', 'm', 'o', 'n', 'i', 't', 'a', 's',
+	'h', 'i', 'n', 't', 'o', 't', 'a', 'k', 'a', 's', 'a', 'k', 'i', 't', 'a', 'm',
+	'a', 'm', 'u', 'r', 'a', 't', 'a', 't', 'e', 'b', 'a', 'y', 'a', 's', 'h', 'i',
+	't', 'o', 'm', 'i', 'o', 'k', 'a', 't', 's', 'u', 'k', 'i', 'y', 'o', 'n', 'o',
+	't', 's', 'u', 'm', 'a', 'g', 'o', 'i', 'u', 'e', 'n', 'o', 'y', 'o', 's', 'h',
+	'i', 'o', 'k', 'a', 'a', 's', 'a', 'm', 'i', 'n', 'a', 'm', 'i', 'd', 'a', 'i',
+	'w', 'a', 'e', 't', 'a', 'j', 'i', 'm', 'a', 'f', 'u', 'c', 'h', 'u', 'f', 'u',
+	'k', 'u', 'y', 'a', 'm', 'a', 'h', 'a', 't', 's', 'u', 'k', 'a', 'i', 'c', 'h',
+	'i', 'h', 'i', 'g', 'a', 's', 'h', 'i', 'h', 'i', 'r', 'o', 's', 'h', 'i', 'm',
+	'a', 'h', 'o', 'n', 'g', 'o', 'j', 'i', 'n', 's', 'e', 'k', 'i', 'k', 'o', 'g',
+	'e', 'n', 'k', 'a', 'i', 't', 'a', 'k', 'u', 'm', 'a', 'n', 'o', 'k', 'u', 'r',
+	'e', 'm', 'i', 'h', 'a', 'r', 'a', 'o', 'n', 'o', 'm', 'i', 'c', 'h', 'i', 'o',
+	's', 'a', 'k', 'i', 'k', 'a', 'm', 'i', 'j', 'i', 'm', 'a', 'o', 't', 'a', 'k',
+	'e', 's', 'e', 'r', 'a', 'n', 'i', 's', 'h', 'i', 's', 'h', 'i', 'n', 'i', 'c',
+	'h', 'i', 's', 'h', 'o', 'b', 'a', 'r', 'a', 't', 'a', 'k', 'e', 'h', 'a', 'r',
+	'a', 'a', 'b', 'a', 's', 'h', 'i', 'r', 'i', 'a', 'b', 'i', 'r', 'a', 'a', 'i',
+	'b', 'e', 't', 's', 'u', 'a', 'k', 'a', 'b', 'i', 'r', 'a', 'a', 'k', 'k', 'e',
+	's', 'h', 'i', 'a', 's', 'a', 'h', 'i', 'k', 'a', 'w', 'a', 'a', 's', 'h', 'i',
+	'b', 'e', 't', 's', 'u', 'a', 's', 'h', 'o', 'r', 'o', 'a', 's', 's', 'a', 'b',
+	'u', 'b', 'i', 'b', 'a', 'i', 'b', 'i', 'e', 'i', 'b', 'i', 'f', 'u', 'k', 'a',
+	'b', 'i', 'h', 'o', 'r', 'o', 'b', 'i', 'r', 'a', 't', 'o', 'r', 'i', 'c', 'h',
+	'i', 'p', 'p', 'u', 'b', 'e', 't', 's', 'u', 'c', 'h', 'i', 't', 'o', 's', 'e',
+	'e', 'b', 'e', 't', 's', 'u', 'e', 'm', 'b', 'e', 't', 's', 'u', 'e', 'n', 'i',
+	'w', 'a', 'e', 'r', 'i', 'm', 'o', 'e', 's', 'a', 's', 'h', 'i', 'f', 'u', 'k',
+	'a', 'g', 'a', 'w', 'a', 'f', 'u', 'r', 'a', 'n', 'o', 'f', 'u', 'r', 'u', 'b',
+	'i', 'r', 'a', 'h', 'a', 'b', 'o', 'r', 'o', 'h', 'a', 'k', 'o', 'd', 'a', 't',
+	'e', 'h', 'a', 'm', 'a', 't', 'o', 'n', 'b', 'e', 't', 's', 'u', 'h', 'i', 'd',
+	'a', 'k', 'a', 'h', 'i', 'g', 'a', 's', 'h', 'i', 'k', 'a', 'g', 'u', 'r', 'a',
+	'h', 'i', 'g', 'a', 's', 'h', 'i', 'k', 'a', 'w', 'a', 'h', 'o', 'k', 'u', 'r',
+	'y', 'u', 'h', 'o', 'k', 'u', 't', 'o', 'h', 'o', 'n', 'b', 'e', 't', 's', 'u',
+	'h', 'o', 'r', 'o', 'k', 'a', 'n', 'a', 'i', 'h', 'o', 'r', 'o', 'n', 'o', 'b',
+	'e', 'i', 'm', 'a', 'k', 'a', 'n', 'e', 'i', 's', 'h', 'i', 'k', 'a', 'r', 'i',
+	'i', 'w', 'a', 'm', 'i', 'z', 'a', 'w', 'a', 'i', 'w', 'a', 'n', 'a', 'i', 'k',
+	'a', 'm', 'i', 'f', 'u', 'r', 'a', 'n', 'o', 'k', 'a', 'm', 'i', 'k', 'a', 'w',
+	'a', 'k', 'a', 'm', 'i', 's', 'h', 'i', 'h', 'o', 'r', 'o', 'k', 'a', 'm', 'i',
+	's', 'u', 'n', 'a', 'g', 'a', 'w', 'a', 'k', 'a', 'm', 'o', 'e', 'n', 'a', 'i',
+	'k', 'a', 'y', 'a', 'b', 'e', 'k', 'e', 'm', 'b', 'u', 'c', 'h', 'i', 'k', 'i',
+	'k', 'o', 'n', 'a', 'i', 'k', 'i', 'm', 'o', 'b', 'e', 't', 's', 'u', 'k', 'i',
+	't', 'a', 'h', 'i', 'r', 'o', 's', 'h', 'i', 'm', 'a', 'k', 'i', 't', 'a', 'm',
+	'i', 'k', 'i', 'y', 'o', 's', 'a', 't', 'o', 'k', 'o', 's', 'h', 'i', 'm', 'i',
+	'z', 'u', 'k', 'u', 'n', 'n', 'e', 'p', 'p', 'u', 'k', 'u', 'r', 'i', 'y', 'a',
+	'm', 'a', 'k', 'u', 'r', 'o', 'm', 'a', 't', 's', 'u', 'n', 'a', 'i', 'k', 'u',
+	's', 'h', 'i', 'r', 'o', 'k', 'u', 't', 'c', 'h', 'a', 'n', 'm', 'a', 's', 'h',
+	'i', 'k', 'e', 'm', 'a', 't', 's', 'u', 'm', 'a', 'e', 'm', 'i', 'k', 'a', 's',
+	'a', 'm', 'i', 'n', 'a', 'm', 'i', 'f', 'u', 'r', 'a', 'n', 'o', 'm', 'o', 'm',
+	'b', 'e', 't', 's', 'u', 'm', 'o', 's', 'e', 'u', 's', 'h', 'i', 'm', 'u', 'k',
+	'a', 'w', 'a', 'm', 'u', 'r', 'o', 'r', 'a', 'n', 'n', 'a', 'i', 'e', 'n', 'a',
+	'k', 'a', 's', 'a', 't', 's', 'u', 'n', 'a', 'i', 'n', 'a', 'k', 'a', 't', 'o',
+	'm', 'b', 'e', 't', 's', 'u', 'n', 'a', 'n', 'a', 'e', 'n', 'a', 'n', 'p', 'o',
+	'r', 'o', 'n', 'a', 'y', 'o', 'r', 'o', 'n', 'e', 'm', 'u', 'r', 'o', 'n', 'i',
+	'i', 'k', 'a', 'p', 'p', 'u', 'n', 'i', 's', 'h', 'i', 'o', 'k', 'o', 'p', 'p',
+	'e', 'n', 'o', 'b', 'o', 'r', 'i', 'b', 'e', 't', 's', 'u', 'o', 'b', 'i', 'h',
+	'i', 'r', 'o', 'o', 'k', 'e', 't', 'o', 'o', 't', 'a', 'r', 'u', 'o', 't', 'o',
+	'b', 'e', 'o', 't', 'o', 'f', 'u', 'k', 'e', 'o', 't', 'o', 'i', 'n', 'e', 'p',
+	'p', 'u', 'o', 'u', 'm', 'u', 'o', 'z', 'o', 'r', 'a', 'p', 'i', 'p', 'p', 'u',
+	'r', 'a', 'n', 'k', 'o', 's', 'h', 'i', 'r', 'e', 'b', 'u', 'n', 'r', 'i', 'k',
+	'u', 'b', 'e', 't', 's', 'u', 'r', 'i', 's', 'h', 'i', 'r', 'i', 'r', 'i', 's',
+	'h', 'i', 'r', 'i', 'f', 'u', 'j', 'i', 's', 'a', 'r', 'o', 'm', 'a', 's', 'a',
+	'r', 'u', 'f', 'u', 't', 's', 'u', 's', 'h', 'a', 'k', 'o', 't', 'a', 'n', 's',
+	'h', 'a', 'r', 'i', 's', 'h', 'i', 'b', 'e', 'c', 'h', 'a', 's', 'h', 'i', 'k',
+	'a', 'b', 'e', 's', 'h', 'i', 'k', 'a', 'o', 'i', 's', 'h', 'i', 'm', 'a', 'm',
+	'a', 'k', 'i', 's', 'h', 'i', 'm', 'o', 'k', 'a', 'w', 'a', 's', 'h', 'i', 'n',
+	's', 'h', 'i', 'n', 'o', 't', 's', 'u', 's', 'h', 'i', 'n', 't', 'o', 'k', 'u',
+	's', 'h', 'i', 'r', 'a', 'n', 'u', 'k', 'a', 's', 'h', 'i', 'r', 'a', 'o', 'i',
+	's', 'h', 'i', 'r', 'i', 'u', 'c', 'h', 'i', 's', 'o', 'b', 'e', 't', 's', 'u',
+	't', 'a', 'i', 'k', 'i', 't', 'a', 'k', 'a', 's', 'u', 't', 'a', 'k', 'i', 'k',
+	'a', 'w', 'a', 't', 'a', 'k', 'i', 'n', 'o', 'u', 'e', 't', 'e', 's', 'h', 'i',
+	'k', 'a', 'g', 'a', 't', 'o', 'b', 'e', 't', 's', 'u', 't', 'o', 'h', 'm', 'a',
+	't', 'o', 'm', 'a', 'k', 'o', 'm', 'a', 'i', 't', 'o', 'm', 'a', 'r', 'i', 't',
+	'o', 'y', 'a', 'k', 'o', 't', 'o', 'y', 'o', 't', 'o', 'm', 'i', 't', 'o', 'y',
+	'o', 'u', 'r', 'a', 't', 's', 'u', 'b', 'e', 't', 's', 'u', 't', 's', 'u', 'k',
+	'i', 'g', 'a', 't', 'a', 'u', 'r', 'a', 'k', 'a', 'w', 'a', 'u', 'r', 'a', 'u',
+	's', 'u', 'u', 't', 'a', 's', 'h', 'i', 'n', 'a', 'i', 'w', 'a', 'k', 'k', 'a',
+	'n', 'a', 'i', 'w', 'a', 's', 's', 'a', 'm', 'u', 'y', 'a', 'k', 'u', 'm', 'o',
+	'y', 'o', 'i', 'c', 'h', 'i', 'a', 'i', 'o', 'i', 'a', 'm', 'a', 'g', 'a', 's',
+	'a', 'k', 'i', 'a', 's', 'a', 'g', 'o', 'a', 'w', 'a', 'j', 'i', 'f', 'u', 'k',
+	'u', 's', 'a', 'k', 'i', 'g', 'o', 's', 'h', 'i', 'k', 'i', 'h', 'a', 'r', 'i',
+	'm', 'a', 'h', 'i', 'm', 'e', 'j', 'i', 'i', 'n', 'a', 'g', 'a', 'w', 'a', 'k',
+	'a', 'k', 'o', 'g', 'a', 'w', 'a', 'k', 'a', 'm', 'i', 'g', 'o', 'r', 'i', 'k',
+	'a', 's', 'a', 'i', 'k', 'a', 'w', 'a', 'n', 'i', 's', 'h', 'i', 'm', 'i', 'n',
+	'a', 'm', 'i', 'a', 'w', 'a', 'j', 'i', 'n', 'i', 's', 'h', 'i', 'n', 'o', 'm',
+	'i', 'y', 'a', 'n', 'i', 's', 'h', 'i', 'w', 'a', 'k', 'i', 's', 'a', 'n', 'd',
+	'a', 's', 'a', 'n', 'n', 'a', 'n', 's', 'a', 's', 'a', 'y', 'a', 'm', 'a', 's',
+	'a', 'y', 'o', 's', 'h', 'i', 'n', 'o', 'n', 's', 'e', 'n', 's', 'h', 'i', 's',
+	'o', 's', 'u', 'm', 'o', 't', 'o', 't', 'a', 'k', 'a', 'r', 'a', 'z', 'u', 'k',
+	'a', 't', 'a', 'k', 'a', 's', 'a', 'g', 'o', 't', 'a', 'm', 'b', 'a', 't', 'a',
+	't', 's', 'u', 'n', 'o', 't', 'o', 'y', 'o', 'o', 'k', 'a', 'y', 'a', 's', 'h',
+	'i', 'r', 'o', 'b', 'a', 'n', 'd', 'o', 'c', 'h', 'i', 'k', 'u', 's', 'e', 'i',
+	'd', 'a', 'i', 'g', 'o', 'f', 'u', 'j', 'i', 's', 'h', 'i', 'r', 'o', 'h', 'i',
+	't', 'a', 'c', 'h', 'i', 'n', 'a', 'k', 'a', 'h', 'i', 't', 'a', 'c', 'h', 'i',
+	'o', 'm', 'i', 'y', 'a', 'h', 'i', 't', 'a', 'c', 'h', 'i', 'o', 't', 'a', 'i',
+	'n', 'a', 's', 'h', 'i', 'k', 'i', 'i', 'w', 'a', 'm', 'a', 'j', 'o', 's', 'o',
+	'k', 'a', 's', 'h', 'i', 'm', 'a', 'k', 'a', 's', 'u', 'm', 'i', 'g', 'a', 'u',
+	'r', 'a', 'm', 'i', 'h', 'o', 'm', 'o', 'r', 'i', 'y', 'a', 'n', 'a', 'm', 'e',
+	'g', 'a', 't', 'a', 'o', 'a', 'r', 'a', 'i', 'o', 'm', 'i', 't', 'a', 'm', 'a',
+	'r', 'y', 'u', 'g', 'a', 's', 'a', 'k', 'i', 's', 'a', 'k', 'u', 'r', 'a', 'g',
+	'a', 'w', 'a', 's', 'h', 'i', 'm', 'o', 'd', 'a', 't', 'e', 's', 'h', 'i', 'm',
+	'o', 't', 's', 'u', 'm', 'a', 's', 'h', 'i', 'r', 'o', 's', 'a', 't', 'o', 's',
+	'o', 'w', 'a', 's', 'u', 'i', 'f', 'u', 't', 'a', 'k', 'a', 'h', 'a', 'g', 'i',
+	't', 'a', 'm', 'a', 't', 's', 'u', 'k', 'u', 'r', 'i', 't', 'o', 'm', 'o', 'b',
+	'e', 't', 'o', 'r', 'i', 'd', 'e', 't', 's', 'u', 'c', 'h', 'i', 'u', 'r', 'a',
+	't', 's', 'u', 'k', 'u', 'b', 'a', 'u', 'c', 'h', 'i', 'h', 'a', 'r', 'a', 'u',
+	's', 'h', 'i', 'k', 'u', 'y', 'a', 'w', 'a', 'r', 'a', 'y', 'u', 'k', 'i', 'a',
+	'n', 'a', 'm', 'i', 'z', 'u', 'h', 'a', 'k', 'u', 'i', 'h', 'a', 'k', 'u', 's',
+	'a', 'n', 'k', 'a', 'h', 'o', 'k', 'u', 'k', 'a', 'n', 'a', 'z', 'a', 'w', 'a',
+	'k', 'a', 'w', 'a', 'k', 'i', 't', 'a', 'n', 'a', 'k', 'a', 'n', 'o', 't', 'o',
+	'n', 'a', 'n', 'a', 'o', 'n', 'o', 'n', 'o', 'i', 'c', 'h', 'i', 't', 's', 'u',
+	'b', 'a', 't', 'a', 't', 's', 'u', 'r', 'u', 'g', 'i', 'u', 'c', 'h', 'i', 'n',
+	'a', 'd', 'a', 'f', 'u', 'd', 'a', 'i', 'f', 'u', 'j', 'i', 's', 'a', 'w', 'a',
+	'h', 'a', 'n', 'a', 'm', 'a', 'k', 'i', 'h', 'i', 'r', 'a', 'i', 'z', 'u', 'm',
+	'i', 'i', 'c', 'h', 'i', 'n', 'o', 's', 'e', 'k', 'i', 'i', 'w', 'a', 'i', 'z',
+	'u', 'm', 'i', 'j', 'o', 'b', 'o', 'j', 'i', 'k', 'a', 'm', 'a', 'i', 's', 'h',
+	'i', 'k', 'a', 'n', 'e', 'g', 'a', 's', 'a', 'k', 'i', 'k', 'a', 'r', 'u', 'm',
+	'a', 'i', 'k', 'i', 't', 'a', 'k', 'a', 'm', 'i', 'k', 'u', 'j', 'i', 'k', 'u',
+	'z', 'u', 'm', 'a', 'k', 'i', 'm', 'i', 'z', 'u', 's', 'a', 'w', 'a', 'm', 'o',
+	'r', 'i', 'o', 'k', 'a', 'n', 'i', 'n', 'o', 'h', 'e', 'o', 'f', 'u', 'n', 'a',
+	't', 'o', 'o', 's', 'h', 'u', 'o', 't', 's', 'u', 'c', 'h', 'i', 'r', 'i', 'k',
+	'u', 'z', 'e', 'n', 't', 'a', 'k', 'a', 't', 'a', 's', 'h', 'i', 'z', 'u', 'k',
+	'u', 'i', 's', 'h', 'i', 's', 'u', 'm', 'i', 't', 'a', 't', 'a', 'n', 'o', 'h',
+	'a', 't', 'a', 'y', 'a', 'h', 'a', 'b', 'a', 'a', 'y', 'a', 'g', 'a', 'w', 'a',
+	'h', 'i', 'g', 'a', 's', 'h', 'i', 'k', 'a', 'g', 'a', 'w', 'a', 'k', 'a', 'n',
+	'o', 'n', 'j', 'i', 'k', 'o', 't', 'o', 'h', 'i', 'r', 'a', 'm', 'a', 'n', 'n',
+	'o', 'm', 'a', 'r', 'u', 'g', 'a', 'm', 'e', 'n', 'a', 'o', 's', 'h', 'i', 'm',
+	'a', 's', 'a', 'n', 'u', 'k', 'i', 't', 'a', 'd', 'o', 't', 's', 'u', 't', 'a',
+	'k', 'a', 'm', 'a', 't', 's', 'u', 't', 'o', 'n', 'o', 's', 'h', 'o', 'u', 'c',
+	'h', 'i', 'n', 'o', 'm', 'i', 'u', 't', 'a', 'z', 'u', 'z', 'e', 'n', 't', 's',
+	'u', 'j', 'i', 'a', 'k', 'u', 'n', 'e', 'h', 'i', 'o', 'k', 'i', 'k', 'a', 'n',
+	'o', 'y', 'a', 'k', 'a', 'w', 'a', 'n', 'a', 'b', 'e', 'k', 'i', 'n', 'k', 'o',
+	'k', 'o', 'u', 'y', 'a', 'm', 'a', 'm', 'a', 'k', 'u', 'r', 'a', 'z', 'a', 'k',
+	'i', 'm', 'a', 't', 's', 'u', 'm', 'o', 't', 'o', 'm', 'i', 'n', 'a', 'm', 'i',
+	't', 'a', 'n', 'e', 'n', 'a', 'k', 'a', 't', 'a', 'n', 'e', 'n', 'i', 's', 'h',
+	'i', 'n', 'o', 'o', 'm', 'o', 't', 'e', 's', 'a', 't', 's', 'u', 'm', 'a', 's',
+	'e', 'n', 'd', 'a', 'i', 's', 'o', 'o', 't', 'a', 'r', 'u', 'm', 'i', 'z', 'u',
+	'y', 'u', 's', 'u', 'i', 'a', 't', 's', 'u', 'g', 'i', 'a', 'y', 'a', 's', 'e',
+	'c', 'h', 'i', 'g', 'a', 's', 'a', 'k', 'i', 'e', 'b', 'i', 'n', 'a', 'h', 'a',
+	'd', 'a', 'n', 'o', 'h', 'a', 'k', 'o', 'n', 'e', 'h', 'i', 'r', 'a', 't', 's',
+	'u', 'k', 'a', 'i', 's', 'e', 'h', 'a', 'r', 'a', 'k', 'a', 'i', 's', 'e', 'i',
+	'k', 'a', 'm', 'a', 'k', 'u', 'r', 'a', 'k', 'i', 'y', 'o', 'k', 'a', 'w', 'a',
+	'm', 'a', 't', 's', 'u', 'd', 'a', 'm', 'i', 'n', 'a', 'm', 'i', 'a', 's', 'h',
+	'i', 'g', 'a', 'r', 'a', 'm', 'i', 'u', 'r', 'a', 'n', 'a', 'k', 'a', 'i', 'n',
+	'i', 'n', 'o', 'm', 'i', 'y', 'a', 'o', 'd', 'a', 'w', 'a', 'r', 'a', 'o', 'i',
+	's', 'o', 's', 'a', 'g', 'a', 'm', 'i', 'h', 'a', 'r', 'a', 's', 'a', 'm', 'u',
+	'k', 'a', 'w', 'a', 't', 's', 'u', 'k', 'u', 'i', 'y', 'a', 'm', 'a', 'k', 'i',
+	't', 'a', 'y', 'o', 'k', 'o', 's', 'u', 'k', 'a', 'y', 'u', 'g', 'a', 'w', 'a',
+	'r', 'a', 'z', 'a', 'm', 'a', 'z', 'u', 's', 'h', 'i', 'g', 'e', 'i', 's', 'e',
+	'i', 'h', 'i', 'g', 'a', 's', 'h', 'i', 't', 's', 'u', 'n', 'o', 'k', 'i', 't',
+	'a', 'g', 'a', 'w', 'a', 'm', 'o', 't', 'o', 'y', 'a', 'm', 'a', 'm', 'u', 'r',
+	'o', 't', 'o', 'n', 'a', 'h', 'a', 'r', 'i', 'n', 'a', 'k', 'a', 'm', 'u', 'r',
+	'a', 'n', 'a', 'n', 'k', 'o', 'k', 'u', 'n', 'i', 's', 'h', 'i', 't', 'o', 's',
+	'a', 'n', 'i', 'y', 'o', 'd', 'o', 'g', 'a', 'w', 'a', 'o', 't', 's', 'u', 'k',
+	'i', 's', 'u', 'k', 'u', 'm', 'o', 's', 'u', 's', 'a', 'k', 'i', 't', 'o', 's',
+	'a', 's', 'h', 'i', 'm', 'i', 'z', 'u', 'u', 'm', 'a', 'j', 'i', 'y', 'a', 's',
+	'u', 'd', 'a', 'y', 'u', 's', 'u', 'h', 'a', 'r', 'a', 'a', 'm', 'a', 'k', 'u',
+	's', 'a', 'c', 'h', 'o', 'y', 'o', 'g', 'y', 'o', 'k', 'u', 't', 'o', 'k', 'a',
+	'm', 'i', 'a', 'm', 'a', 'k', 'u', 's', 'a', 'k', 'i', 'k', 'u', 'c', 'h', 'i',
+	'm', 'a', 's', 'h', 'i', 'k', 'i', 'm', 'i', 'f', 'u', 'n', 'e', 'm', 'i', 'n',
+	'a', 'm', 'a', 't', 'a', 'm', 'i', 'n', 'a', 'm', 'i', 'o', 'g', 'u', 'n', 'i',
+	'n', 'a', 'g', 'a', 's', 'u', 'n', 'i', 's', 'h', 'i', 'h', 'a', 'r', 'a', 't',
+	'a', 'k', 'a', 'm', 'o', 'r', 'i', 'y', 'a', 't', 's', 'u', 's', 'h', 'i', 'r',
+	'o', 'f', 'u', 'k', 'u', 'c', 'h', 'i', 'y', 'a', 'm', 'a', 'h', 'i', 'g', 'a',
+	's', 'h', 'i', 'y', 'a', 'm', 'a', 'j', 'o', 'y', 'o', 'k', 'a', 'm', 'e', 'o',
+	'k', 'a', 'k', 'i', 'z', 'u', 'k', 'u', 'm', 'i', 'y', 'a', 'm', 'a', 'k', 'y',
+	'o', 't', 'a', 'm', 'b', 'a', 'k', 'y', 'o', 't', 'a', 'n', 'a', 'b', 'e', 'k',
+	'y', 'o', 't', 'a', 'n', 'g', 'o', 'm', 'a', 'i', 'z', 'u', 'r', 'u', 'm', 'i',
+	'n', 'a', 'm', 'i', 'y', 'a', 'm', 'a', 's', 'h', 'i', 'r', 'o', 'm', 'i', 'y',
+	'a', 'z', 'u', 'm', 'u', 'k', 'o', 'n', 'a', 'g', 'a', 'o', 'k', 'a', 'k', 'y',
+	'o', 'n', 'a', 'k', 'a', 'g', 'y', 'o', 'n', 'a', 'n', 't', 'a', 'n', 'o', 'y',
+	'a', 'm', 'a', 'z', 'a', 'k', 'i', 's', 'a', 'k', 'y', 'o', 'u', 'j', 'i', 't',
+	'a', 'w', 'a', 'r', 'a', 'w', 'a', 'z', 'u', 'k', 'a', 'y', 'a', 'm', 'a', 's',
+	'h', 'i', 'n', 'a', 'i', 'n', 'a', 'b', 'e', 'k', 'a', 'm', 'e', 'y', 'a', 'm',
+	'a', 'k', 'a', 'w', 'a', 'g', 'o', 'e', 'k', 'i', 's', 'o', 's', 'a', 'k', 'i',
+	'k', 'i', 'w', 'a', 'k', 'o', 'm', 'o', 'n', 'o', 'k', 'u', 'w', 'a', 'n', 'a',
+	'm', 'a', 't', 's', 'u', 's', 'a', 'k', 'a', 'm', 'i', 'n', 'a', 'm', 'i', 'i',
+	's', 'e', 'm', 'i', 's', 'u', 'g', 'i', 'n', 'a', 'b', 'a', 'r', 'i', 's', 'u',
+	'z', 'u', 'k', 'a', 't', 'a', 'm', 'a', 'k', 'i', 't', 'o', 'b', 'a', 'u', 'r',
+	'e', 's', 'h', 'i', 'n', 'o', 'w', 'a', 't', 'a', 'r', 'a', 'i', 'y', 'o', 'k',
+	'k', 'a', 'i', 'c', 'h', 'i', 'f', 'u', 'r', 'u', 'k', 'a', 'w', 'a', 'h', 'i',
+	'g', 'a', 's', 'h', 'i', 'm', 'a', 't', 's', 'u', 's', 'h', 'i', 'm', 'a', 'i',
+	's', 'h', 'i', 'n', 'o', 'm', 'a', 'k', 'i', 'i', 'w', 'a', 'n', 'u', 'm', 'a',
+	'k', 'a', 'k', 'u', 'd', 'a', 'm', 'a', 'r', 'u', 'm', 'o', 'r', 'i', 'm', 'i',
+	'n', 'a', 'm', 'i', 's', 'a', 'n', 'r', 'i', 'k', 'u', 'n', 'a', 't', 'o', 'r',
+	'i', 'o', 'g', 'a', 'w', 'a', 'r', 'a', 'o', 'n', 'a', 'g', 'a', 'w', 'a', 's',
+	'e', 'm', 'i', 'n', 'e', 's', 'h', 'i', 'b', 'a', 't', 'a', 's', 'h', 'i', 'c',
+	'h', 'i', 'k', 'a', 's', 'h', 'u', 'k', 'u', 's', 'h', 'i', 'k', 'a', 'm', 'a',
+	's', 'h', 'i', 'o', 'g', 'a', 'm', 'a', 't', 'a', 'g', 'a', 'j', 'o', 't', 'a',
+	'i', 'w', 'a', 't', 'o', 'm', 'i', 'y', 'a', 'w', 'a', 'k', 'u', 'y', 'a', 'w',
+	'a', 't', 'a', 'r', 'i', 'y', 'a', 'm', 'a', 'm', 'o', 't', 'o', 'z', 'a', 'o',
+	'e', 'b', 'i', 'n', 'o', 'g', 'o', 'k', 'a', 's', 'e', 'h', 'y', 'u', 'g', 'a',
+	'k', 'a', 'd', 'o', 'g', 'a', 'w', 'a', 'k', 'a', 'w', 'a', 'm', 'i', 'n', 'a',
+	'm', 'i', 'k', 'i', 'j', 'o', 'k', 'i', 't', 'a', 'u', 'r', 'a', 'k', 'o', 'b',
+	'a', 'y', 'a', 's', 'h', 'i', 'k', 'u', 'n', 'i', 't', 'o', 'm', 'i', 'm', 'i',
+	'm', 'a', 't', 'a', 'm', 'i', 'y', 'a', 'k', 'o', 'n', 'o', 'j', 'o', 'm', 'o',
+	'r', 'o', 't', 's', 'u', 'k', 'a', 'n', 'i', 'c', 'h', 'i', 'n', 'a', 'n', 'n',
+	'i', 's', 'h', 'i', 'm', 'e', 'r', 'a', 'n', 'o', 'b', 'e', 'o', 'k', 'a', 's',
+	'a', 'i', 't', 'o', 's', 'h', 'i', 'i', 'b', 'a', 's', 'h', 'i', 'n', 't', 'o',
+	'm', 'i', 't', 'a', 'k', 'a', 'h', 'a', 'r', 'u', 't', 'a', 'k', 'a', 'n', 'a',
+	'b', 'e', 't', 'a', 'k', 'a', 'z', 'a', 'k', 'i', 'a', 'g', 'e', 'm', 'a', 't',
+	's', 'u', 'a', 'o', 'k', 'i', 'a', 'z', 'u', 'm', 'i', 'n', 'o', 'c', 'h', 'i',
+	'k', 'u', 'h', 'o', 'k', 'u', 'f', 'u', 'j', 'i', 'm', 'i', 'h', 'a', 'k', 'u',
+	'b', 'a', 'h', 'i', 'r', 'a', 'y', 'a', 'i', 'i', 'j', 'i', 'm', 'a', 'i', 'i',
+	'y', 'a', 'm', 'a', 'i', 'i', 'z', 'u', 'n', 'a', 'i', 'k', 'u', 's', 'a', 'k',
+	'a', 'k', 'a', 'r', 'u', 'i', 'z', 'a', 'w', 'a', 'k', 'i', 's', 'o', 'f', 'u',
+	'k', 'u', 's', 'h', 'i', 'm', 'a', 'k', 'i', 't', 'a', 'a', 'i', 'k', 'i', 'k',
+	'o', 'm', 'a', 'g', 'a', 'n', 'e', 'k', 'o', 'm', 'o', 'r', 'o', 'm', 'i', 'a',
+	's', 'a', 'm', 'i', 'n', 'a', 'm', 'i', 'a', 'i', 'k', 'i', 'm', 'i', 'n', 'a',
+	'm', 'i', 'm', 'a', 'k', 'i', 'm', 'i', 'n', 'a', 'm', 'i', 'm', 'i', 'n', 'o',
+	'w', 'a', 'm', 'i', 'y', 'a', 'd', 'a', 'm', 'i', 'y', 'o', 't', 'a', 'm', 'o',
+	'c', 'h', 'i', 'z', 'u', 'k', 'i', 'n', 'a', 'g', 'i', 's', 'o', 'n', 'o', 'z',
+	'a', 'w', 'a', 'o', 'n', 's', 'e', 'n', 'o', 'b', 'u', 's', 'e', 'o', 'm', 'a',
+	'c', 'h', 'i', 'o', 'o', 'k', 'u', 'w', 'a', 'o', 'o', 's', 'h', 'i', 'k', 'a',
+	'o', 't', 'a', 'r', 'i', 's', 'a', 'k', 'a', 'k', 'i', 's', 'a', 'k', 'u', 'h',
+	'o', 's', 'h', 'i', 'm', 'o', 's', 'u', 'w', 'a', 's', 'h', 'i', 'n', 'a', 'n',
+	'o', 'm', 'a', 'c', 'h', 'i', 's', 'h', 'i', 'o', 'j', 'i', 'r', 'i', 's', 'u',
+	'z', 'a', 'k', 'a', 't', 'a', 'k', 'a', 'g', 'i', 't', 'a', 't', 'e', 's', 'h',
+	'i', 'n', 'a', 't', 'o', 'g', 'a', 'k', 'u', 's', 'h', 'i', 't', 'o', 'g', 'u',
+	'r', 'a', 'u', 'e', 'd', 'a', 'y', 'a', 'm', 'a', 'n', 'o', 'u', 'c', 'h', 'i',
+	'y', 'a', 's', 'a', 'k', 'a', 'y', 'a', 's', 'u', 'o', 'k', 'a', 'c', 'h', 'i',
+	'j', 'i', 'w', 'a', 'h', 'a', 's', 'a', 'm', 'i', 'h', 'i', 'r', 'a', 'd', 'o',
+	'i', 's', 'a', 'h', 'a', 'y', 'a', 'k', 'u', 'c', 'h', 'i', 'n', 'o', 't', 's',
+	'u', 'm', 'a', 't', 's', 'u', 'u', 'r', 'a', 'o', 'm', 'u', 'r', 'a', 'o', 's',
+	'e', 't', 'o', 's', 'a', 'i', 'k', 'a', 'i', 's', 'a', 's', 'e', 'b', 'o', 's',
+	'h', 'i', 'm', 'a', 'b', 'a', 'r', 'a', 's', 'h', 'i', 'n', 'k', 'a', 'm', 'i',
+	'g', 'o', 't', 'o', 't', 'o', 'g', 'i', 't', 's', 'u', 'u', 'n', 'z', 'e', 'n',
+	'g', 'o', 's', 'e', 'h', 'e', 'g', 'u', 'r', 'i', 'h', 'i', 'g', 'a', 's', 'h',
+	'i', 'y', 'o', 's', 'h', 'i', 'n', 'o', 'i', 'k', 'a', 'r', 'u', 'g', 'a', 'k',
+	'a', 'm', 'i', 'k', 'i', 't', 'a', 'y', 'a', 'm', 'a', 'k', 'a', 'n', 'm', 'a',
+	'k', 'i', 'k', 'a', 's', 'h', 'i', 'b', 'a', 'k', 'a', 's', 'h', 'i', 'h', 'a',
+	'r', 'a', 'k', 'a', 't', 's', 'u', 'r', 'a', 'g', 'i', 'k', 'o', 'r', 'y', 'o',
+	'k', 'u', 'r', 'o', 't', 'a', 'k', 'i', 'm', 'i', 't', 's', 'u', 'e', 'm', 'i',
+	'y', 'a', 'k', 'e', 'n', 'o', 's', 'e', 'g', 'a', 'w', 'a', 'o', 'y', 'o', 'd',
+	'o', 's', 'a', 'k', 'u', 'r', 'a', 'i', 's', 'a', 'n', 'g', 'o', 's', 'h', 'i',
+	'm', 'o', 'i', 'c', 'h', 'i', 's', 'h', 'i', 'm', 'o', 'k', 'i', 't', 'a', 'y',
+	'a', 'm', 'a', 's', 'h', 'i', 'n', 'j', 'o', 't', 'a', 'k', 'a', 't', 'o', 'r',
+	'i', 't', 'a', 'w', 'a', 'r', 'a', 'm', 'o', 't', 'o', 't', 'e', 'n', 'k', 'a',
+	'w', 'a', 't', 'e', 'n', 'r', 'i', 'y', 'a', 'm', 'a', 't', 'o', 'k', 'o', 'r',
+	'i', 'y', 'a', 'm', 'a', 'y', 'a', 'm', 'a', 't', 'o', 't', 'a', 'k', 'a', 'd',
+	'a', 'y', 'a', 'm', 'a', 'z', 'o', 'e', 'a', 's', 'e', 'i', 'n', 'e', 't', 'g',
+	'e', 'h', 'i', 'r', 'n', 'g', 'o', 's', 'e', 'n', 'i', 't', 'o', 'i', 'g', 'a',
+	'w', 'a', 'i', 'z', 'u', 'm', 'o', 'z', 'a', 'k', 'i', 'j', 'o', 'e', 't', 's',
+	'u', 'k', 'a', 'r', 'i', 'w', 'a', 'k', 'a', 's', 'h', 'i', 'w', 'a', 'z', 'a',
+	'k', 'i', 'm', 'i', 'n', 'a', 'm', 'i', 'u', 'o', 'n', 'u', 'm', 'a', 'm', 'i',
+	't', 's', 'u', 'k', 'e', 'm', 'u', 'i', 'k', 'a', 'm', 'u', 'r', 'a', 'k', 'a',
+	'm', 'i', 'm', 'y', 'o', 'k', 'o', 'o', 'j', 'i', 'y', 'a', 's', 'a', 'd', 'o',
+	's', 'a', 'n', 'j', 'o', 's', 'e', 'i', 'r', 'o', 's', 'e', 'i', 'r', 'o', 'u',
+	's', 'e', 'k', 'i', 'k', 'a', 'w', 'a', 't', 'a', 'i', 'n', 'a', 'i', 't', 'o',
+	'c', 'h', 'i', 'o', 't', 'o', 'k', 'a', 'm', 'a', 'c', 'h', 'i', 't', 's', 'u',
+	'b', 'a', 'm', 'e', 'y', 'a', 'h', 'i', 'k', 'o', 'y', 'o', 'i', 't', 'a', 'y',
+	'u', 'z', 'a', 'w', 'a', 'b', 'e', 'p', 'p', 'u', 'b', 'u', 'n', 'g', 'o', 'o',
+	'n', 'o', 'b', 'u', 'n', 'g', 'o', 't', 'a', 'k', 'a', 'd', 'a', 'h', 'a', 's',
+	'a', 'm', 'a', 'h', 'i', 'm', 'e', 's', 'h', 'i', 'm', 'a', 'k', 'a', 'm', 'i',
+	't', 's', 'u', 'e', 'k', 'o', 'k', 'o', 'n', 'o', 'e', 'k', 'u', 'n', 'i', 's',
+	'a', 'k', 'i', 'k', 'u', 's', 'u', 's', 'a', 'i', 'k', 'i', 't', 'a', 'k', 'e',
+	't', 'a', 't', 's', 'u', 'k', 'u', 'm', 'i', 'u', 's', 'u', 'k', 'i', 'a', 'k',
+	'a', 'i', 'w', 'a', 'a', 's', 'a', 'k', 'u', 'c', 'h', 'i', 'b', 'i', 'z', 'e',
+	'n', 'h', 'a', 'y', 'a', 's', 'h', 'i', 'm', 'a', 'k', 'a', 'g', 'a', 'm', 'i',
+	'n', 'o', 'k', 'a', 's', 'a', 'o', 'k', 'a', 'k', 'i', 'b', 'i', 'c', 'h', 'u',
+	'o', 'k', 'u', 'm', 'e', 'n', 'a', 'n', 'k', 'u', 'r', 'a', 's', 'h', 'i', 'k',
+	'i', 'm', 'a', 'n', 'i', 'w', 'a', 'm', 'i', 's', 'a', 'k', 'i', 'n', 'i', 'i',
+	'm', 'i', 'n', 'i', 's', 'h', 'i', 'a', 'w', 'a', 'k', 'u', 'r', 'a', 's', 'a',
+	't', 'o', 's', 'h', 'o', 's', 'e', 't', 'o', 'u', 'c', 'h', 'i', 's', 'h', 'o',
+	'o', 's', 'o', 'j', 'a', 't', 'a', 'k', 'a', 'h', 'a', 's', 'h', 'i', 't', 'a',
+	'm', 'a', 'n', 'o', 'w', 'a', 'k', 'e', 'y', 'a', 'k', 'a', 'g', 'e', 'a', 'g',
+	'u', 'n', 'i', 'g', 'i', 'n', 'o', 'w', 'a', 'n', 'g', 'i', 'n', 'o', 'z', 'a',
+	'g', 'u', 's', 'h', 'i', 'k', 'a', 'm', 'i', 'h', 'a', 'e', 'b', 'a', 'r', 'u',
+	'h', 'i', 'r', 'a', 'r', 'a', 'i', 'h', 'e', 'y', 'a', 'i', 's', 'h', 'i', 'g',
+	'a', 'k', 'i', 'i', 't', 'o', 'm', 'a', 'n', 'i', 'z', 'e', 'n', 'a', 'k', 'a',
+	'd', 'e', 'n', 'a', 'k', 'i', 't', 'a', 'd', 'a', 'i', 't', 'o', 'k', 'i', 't',
+	'a', 'n', 'a', 'k', 'a', 'g', 'u', 's', 'u', 'k', 'u', 'k', 'u', 'm', 'e', 'j',
+	'i', 'm', 'a', 'k', 'u', 'n', 'i', 'g', 'a', 'm', 'i', 'm', 'i', 'n', 'a', 'm',
+	'i', 'd', 'a', 'i', 't', 'o', 'm', 'o', 't', 'o', 'b', 'u', 'n', 'a', 'k', 'i',
+	'j', 'i', 'n', 'n', 'a', 'n', 'j', 'o', 'o', 'g', 'i', 'm', 'i', 's', 'h', 'i',
+	'm', 'o', 'j', 'i', 't', 'a', 'k', 'e', 't', 'o', 'm', 'i', 't', 'a', 'r', 'a',
+	'm', 'a', 't', 'o', 'k', 'a', 's', 'h', 'i', 'k', 'i', 't', 'o', 'm', 'i', 'g',
+	'u', 's', 'u', 'k', 'u', 't', 'o', 'n', 'a', 'k', 'i', 'u', 'r', 'a', 's', 'o',
+	'e', 'u', 'r', 'u', 'm', 'a', 'y', 'a', 'e', 's', 'e', 'y', 'o', 'm', 'i', 't',
+	'a', 'n', 'y', 'o', 'n', 'a', 'b', 'a', 'r', 'u', 'y', 'o', 'n', 'a', 'g', 'u',
+	'n', 'i', 'z', 'a', 'm', 'a', 'm', 'i', 'a', 'b', 'e', 'n', 'o', 'c', 'h', 'i',
+	'h', 'a', 'y', 'a', 'a', 'k', 'a', 's', 'a', 'k', 'a', 'f', 'u', 'j', 'i', 'i',
+	'd', 'e', 'r', 'a', 'h', 'a', 'b', 'i', 'k', 'i', 'n', 'o', 'h', 'a', 'n', 'n',
+	'a', 'n', 'h', 'i', 'g', 'a', 's', 'h', 'i', 'o', 's', 'a', 'k', 'a', 'h', 'i',
+	'g', 'a', 's', 'h', 'i', 's', 'u', 'm', 'i', 'y', 'o', 's', 'h', 'i', 'h', 'i',
+	'g', 'a', 's', 'h', 'i', 'y', 'o', 'd', 'o', 'g', 'a', 'w', 'a', 'h', 'i', 'r',
+	'a', 'k', 'a', 't', 'a', 'i', 'z', 'u', 'm', 'i', 'o', 't', 's', 'u', 'i', 'z',
+	'u', 'm', 'i', 's', 'a', 'n', 'o', 'k', 'a', 'i', 'z', 'u', 'k', 'a', 'k', 'a',
+	'n', 'a', 'n', 'k', 'a', 's', 'h', 'i', 'w', 'a', 'r', 'a', 'k', 'a', 't', 'a',
+	'n', 'o', 'k', 'a', 'w', 'a', 'c', 'h', 'i', 'n', 'a', 'g', 'a', 'n', 'o', 'k',
+	'i', 's', 'h', 'i', 'w', 'a', 'd', 'a', 'k', 'u', 'm', 'a', 't', 'o', 'r', 'i',
+	'm', 'a', 't', 's', 'u', 'b', 'a', 'r', 'a', 'm', 'i', 'n', 'a', 't', 'o', 'm',
+	'i', 'n', 'o', 'h', 'm', 'o', 'r', 'i', 'g', 'u', 'c', 'h', 'i', 'n', 'e', 'y',
+	'a', 'g', 'a', 'w', 'a', 'o', 's', 'a', 'k', 'a', 's', 'a', 'y', 'a', 'm', 'a',
+	's', 'e', 'n', 'n', 'a', 'n', 's', 'e', 't', 't', 's', 'u', 's', 'h', 'i', 'j',
+	'o', 'n', 'a', 'w', 'a', 't', 'e', 's', 'h', 'i', 'm', 'a', 'm', 'o', 't', 'o',
+	's', 'u', 'i', 't', 'a', 't', 'a', 'd', 'a', 'o', 'k', 'a', 't', 'a', 'j', 'i',
+	'r', 'i', 't', 'a', 'k', 'a', 'i', 's', 'h', 'i', 't', 'a', 'k', 'a', 't', 's',
+	'u', 'k', 'i', 't', 'o', 'n', 'd', 'a', 'b', 'a', 'y', 'a', 's', 'h', 'i', 't',
+	'o', 'y', 'o', 'n', 'a', 'k', 'a', 't', 'o', 'y', 'o', 'n', 'o', 'a', 'r', 'i',
+	'a', 'k', 'e', 'f', 'u', 'k', 'u', 'd', 'o', 'm', 'i', 'h', 'a', 'm', 'a', 't',
+	'a', 'm', 'a', 'i', 'm', 'a', 'r', 'i', 'k', 'a', 'm', 'i', 'm', 'i', 'n', 'e',
+	'k', 'a', 'n', 'z', 'a', 'k', 'i', 'k', 'a', 'r', 'a', 't', 's', 'u', 'k', 'i',
+	't', 'a', 'h', 'a', 't', 'a', 'k', 'o', 'u', 'h', 'o', 'k', 'u', 'k', 'y', 'u',
+	'r', 'a', 'g', 'i', 'n', 'i', 's', 'h', 'i', 'a', 'r', 'i', 't', 'a', 'y', 'o',
+	's', 'h', 'i', 'n', 'o', 'g', 'a', 'r', 'i', 'a', 'r', 'a', 'k', 'a', 'w', 'a',
+	'c', 'h', 'i', 'c', 'h', 'i', 'b', 'u', 'f', 'u', 'j', 'i', 'm', 'i', 'n', 'o',
+	'f', 'u', 'k', 'a', 'y', 'a', 'h', 'a', 'n', 'n', 'o', 'h', 'a', 'n', 'y', 'u',
+	'h', 'a', 's', 'u', 'd', 'a', 'h', 'a', 't', 'o', 'g', 'a', 'y', 'a', 'h', 'a',
+	't', 'o', 'y', 'a', 'm', 'a', 'h', 'i', 'g', 'a', 's', 'h', 'i', 'c', 'h', 'i',
+	'c', 'h', 'i', 'b', 'u', 'h', 'i', 'g', 'a', 's', 'h', 'i', 'm', 'a', 't', 's',
+	'u', 'y', 'a', 'm', 'a', 'i', 'r', 'u', 'm', 'a', 'i', 'w', 'a', 't', 's', 'u',
+	'k', 'i', 'k', 'a', 'm', 'i', 'i', 'z', 'u', 'm', 'i', 'k', 'a', 'm', 'i', 's',
+	'a', 't', 'o', 'k', 'a', 's', 'u', 'k', 'a', 'b', 'e', 'k', 'a', 'w', 'a', 'g',
+	'u', 'c', 'h', 'i', 'k', 'a', 'w', 'a', 'j', 'i', 'm', 'a', 'k', 'a', 'z', 'o',
+	'k', 'i', 't', 'a', 'm', 'o', 't', 'o', 'k', 'o', 's', 'h', 'i', 'g', 'a', 'y',
+	'a', 'k', 'o', 'u', 'n', 'o', 's', 'u', 'k', 'u', 'k', 'i', 'k', 'u', 'm', 'a',
+	'g', 'a', 'y', 'a', 'm', 'a', 't', 's', 'u', 'b', 'u', 's', 'h', 'i', 'm', 'i',
+	'n', 'a', 'n', 'o', 'm', 'i', 'y', 'a', 's', 'h', 'i', 'r', 'o', 'm', 'o', 'r',
+	'o', 'y', 'a', 'm', 'a', 'n', 'a', 'g', 'a', 't', 'o', 'r', 'o', 'n', 'a', 'm',
+	'e', 'g', 'a', 'w', 'a', 'n', 'i', 'i', 'z', 'a', 'o', 'g', 'a', 'n', 'o', 'o',
+	'g', 'o', 's', 'e', 'o', 'k', 'e', 'g', 'a', 'w', 'a', 'r', 'a', 'n', 'z', 'a',
+	'n', 'r', 'y', 'o', 'k', 'a', 'm', 'i', 's', 'a', 'k', 'a', 'd', 'o', 's', 'a',
+	't', 't', 'e', 's', 'h', 'i', 'r', 'a', 'o', 'k', 'a', 's', 'u', 'g', 'i', 't',
+	'o', 't', 'o', 'k', 'i', 'g', 'a', 'w', 'a', 't', 'o', 'k', 'o', 'r', 'o', 'z',
+	'a', 'w', 'a', 't', 's', 'u', 'r', 'u', 'g', 'a', 's', 'h', 'i', 'm', 'a', 'u',
+	'r', 'a', 'w', 'a', 'w', 'a', 'r', 'a', 'b', 'i', 'y', 'a', 's', 'h', 'i', 'o',
+	'y', 'o', 'k', 'o', 'z', 'e', 'y', 'o', 'r', 'i', 'i', 'y', 'o', 's', 'h', 'i',
+	'd', 'a', 'y', 'o', 's', 'h', 'i', 'k', 'a', 'w', 'a', 'y', 'o', 's', 'h', 'i',
+	'm', 'i', 'a', 'i', 's', 'h', 'o', 'h', 'i', 'g', 'a', 's', 'h', 'i', 'o', 'm',
+	'i', 'h', 'i', 'k', 'o', 'n', 'e', 'k', 'o', 'k', 'a', 'k', 'o', 's', 'e', 'i',
+	'm', 'a', 'i', 'b', 'a', 'r', 'a', 'm', 'o', 'r', 'i', 'y', 'a', 'm', 'a', 'n',
+	'a', 'g', 'a', 'h', 'a', 'm', 'a', 'n', 'i', 's', 'h', 'i', 'a', 'z', 'a', 'i',
+	'n', 'o', 't', 'o', 'g', 'a', 'w', 'a', 'o', 'm', 'i', 'h', 'a', 'c', 'h', 'i',
+	'm', 'a', 'n', 'r', 'i', 't', 't', 'o', 'r', 'y', 'u', 'o', 'h', 't', 'a', 'k',
+	'a', 's', 'h', 'i', 'm', 'a', 't', 'o', 'r', 'a', 'h', 'i', 'm', 'e', 't', 'o',
+	'y', 'o', 's', 'a', 't', 'o', 'g', 'o', 't', 's', 'u', 'h', 'a', 'm', 'a', 'd',
+	'a', 'h', 'i', 'g', 'a', 's', 'h', 'i', 'i', 'z', 'u', 'm', 'o', 'k', 'a', 'k',
+	'i', 'n', 'o', 'k', 'i', 'm', 'a', 's', 'u', 'd', 'a', 'm', 'a', 't', 's', 'u',
+	'e', 'n', 'i', 's', 'h', 'i', 'n', 'o', 's', 'h', 'i', 'm', 'a', 'o', 'h', 'd',
+	'a', 'o', 'k', 'i', 'n', 'o', 's', 'h', 'i', 'm', 'a', 'o', 'k', 'u', 'i', 'z',
+	'u', 'm', 'o', 't', 'a', 'm', 'a', 'y', 'u', 't', 's', 'u', 'w', 'a', 'n', 'o',
+	'u', 'n', 'n', 'a', 'n', 'y', 'a', 's', 'u', 'g', 'i', 'y', 'a', 't', 's', 'u',
+	'k', 'a', 'f', 'u', 'j', 'i', 'e', 'd', 'a', 'f', 'u', 'j', 'i', 'k', 'a', 'w',
+	'a', 'f', 'u', 'j', 'i', 'n', 'o', 'm', 'i', 'y', 'a', 'f', 'u', 'k', 'u', 'r',
+	'o', 'i', 'g', 'o', 't', 'e', 'm', 'b', 'a', 'h', 'a', 'i', 'b', 'a', 'r', 'a',
+	'h', 'a', 'm', 'a', 'm', 'a', 't', 's', 'u', 'i', 'w', 'a', 't', 'a', 'i', 'z',
+	'u', 'n', 'o', 'k', 'u', 'n', 'i', 'k', 'a', 'k', 'e', 'g', 'a', 'w', 'a', 'k',
+	'a', 'n', 'n', 'a', 'm', 'i', 'k', 'a', 'w', 'a', 'n', 'e', 'h', 'o', 'n', 'k',
+	'a', 'w', 'a', 'z', 'u', 'k', 'i', 'k', 'u', 'g', 'a', 'w', 'a', 'k', 'o', 's',
+	'a', 'i', 'm', 'a', 'k', 'i', 'n', 'o', 'h', 'a', 'r', 'a', 'm', 'a', 't', 's',
+	'u', 'z', 'a', 'k', 'i', 'm', 'i', 'n', 'a', 'm', 'i', 'i', 'z', 'u', 'm', 'o',
+	'r', 'i', 'm', 'a', 'c', 'h', 'i', 'n', 'i', 's', 'h', 'i', 'i', 'z', 'u', 'n',
+	'u', 'm', 'a', 'z', 'u', 'o', 'm', 'a', 'e', 'z', 'a', 'k', 'i', 's', 'h', 'i',
+	'm', 'a', 'd', 'a', 's', 'u', 's', 'o', 'n', 'o', 'y', 'a', 'i', 'z', 'u', 'h',
+	'a', 'g', 'a', 'i', 'c', 'h', 'i', 'k', 'a', 'i', 'i', 'w', 'a', 'f', 'u', 'n',
+	'e', 'k', 'a', 'm', 'i', 'n', 'o', 'k', 'a', 'w', 'a', 'k', 'a', 'n', 'u', 'm',
+	'a', 'k', 'a', 'r', 'a', 's', 'u', 'y', 'a', 'm', 'a', 'k', 'u', 'r', 'o', 'i',
+	's', 'o', 'm', 'a', 's', 'h', 'i', 'k', 'o', 'm', 'i', 'b', 'u', 'm', 'o', 't',
+	'e', 'g', 'i', 'n', 'a', 's', 'u', 'n', 'a', 's', 'u', 's', 'h', 'i', 'o', 'b',
+	'a', 'r', 'a', 'n', 'i', 'k', 'k', 'o', 'n', 'i', 's', 'h', 'i', 'k', 'a', 't',
+	'a', 'n', 'o', 'g', 'i', 'o', 'h', 't', 'a', 'w', 'a', 'r', 'a', 's', 'h', 'i',
+	'm', 'o', 't', 's', 'u', 'k', 'e', 's', 'h', 'i', 'o', 'y', 'a', 't', 'a', 'k',
+	'a', 'n', 'e', 'z', 'a', 'w', 'a', 'u', 'j', 'i', 'i', 'e', 'u', 't', 's', 'u',
+	'n', 'o', 'm', 'i', 'y', 'a', 'y', 'a', 'i', 't', 'a', 'k', 'a', 'i', 'n', 'a',
+	'n', 'k', 'o', 'm', 'a', 't', 's', 'u', 's', 'h', 'i', 'm', 'a', 'm', 'a', 't',
+	's', 'u', 's', 'h', 'i', 'g', 'e', 'm', 'u', 'g', 'i', 'n', 'a', 'r', 'u', 't',
+	'o', 's', 'a', 'n', 'a', 'g', 'o', 'c', 'h', 'i', 's', 'h', 'i', 's', 'h', 'i',
+	'k', 'u', 'i', 'w', 'a', 'j', 'i', 'k', 'i', 'a', 'd', 'a', 'c', 'h', 'i', 'a',
+	'k', 'i', 'r', 'u', 'n', 'o', 'a', 'o', 'g', 'a', 's', 'h', 'i', 'm', 'a', 'b',
+	'u', 'n', 'k', 'y', 'o', 'c', 'h', 'o', 'f', 'u', 'e', 'd', 'o', 'g', 'a', 'w',
+	'a', 'f', 'u', 's', 's', 'a', 'h', 'a', 'c', 'h', 'i', 'j', 'o', 'h', 'a', 'c',
+	'h', 'i', 'o', 'j', 'i', 'h', 'a', 'm', 'u', 'r', 'a', 'h', 'i', 'g', 'a', 's',
+	'h', 'i', 'k', 'u', 'r', 'u', 'm', 'e', 'h', 'i', 'g', 'a', 's', 'h', 'i', 'm',
+	'u', 'r', 'a', 'y', 'a', 'm', 'a', 'h', 'i', 'g', 'a', 's', 'h', 'i', 'y', 'a',
+	'm', 'a', 't', 'o', 'h', 'i', 'n', 'o', 'd', 'e', 'h', 'i', 'n', 'o', 'h', 'a',
+	'r', 'a', 'i', 't', 'a', 'b', 'a', 's', 'h', 'i', 'k', 'a', 't', 's', 'u', 's',
+	'h', 'i', 'k', 'a', 'k', 'i', 'y', 'o', 's', 'e', 'k', 'o', 'd', 'a', 'i', 'r',
+	'a', 'k', 'o', 'g', 'a', 'n', 'e', 'i', 'k', 'o', 'k', 'u', 'b', 'u', 'n', 'j',
+	'i', 'k', 'o', 'm', 'a', 'e', 'k', 'o', 'u', 'z', 'u', 's', 'h', 'i', 'm', 'a',
+	'k', 'u', 'n', 'i', 't', 'a', 'c', 'h', 'i', 'm', 'a', 'c', 'h', 'i', 'd', 'a',
+	'm', 'e', 'g', 'u', 'r', 'o', 'm', 'i', 'z', 'u', 'h', 'o', 'm', 'u', 's', 'a',
+	's', 'h', 'i', 'm', 'u', 'r', 'a', 'y', 'a', 'm', 'a', 'm', 'u', 's', 'a', 's',
+	'h', 'i', 'n', 'o', 'n', 'e', 'r', 'i', 'm', 'a', 'o', 'g', 'a', 's', 'a', 'w',
+	'a', 'r', 'a', 'o', 'k', 'u', 't', 'a', 'm', 'a', 's', 'e', 't', 'a', 'g', 'a',
+	'y', 'a', 's', 'h', 'i', 'b', 'u', 'y', 'a', 's', 'h', 'i', 'n', 'a', 'g', 'a',
+	'w', 'a', 's', 'h', 'i', 'n', 'j', 'u', 'k', 'u', 's', 'u', 'g', 'i', 'n', 'a',
+	'm', 'i', 's', 'u', 'm', 'i', 'd', 'a', 't', 'a', 'c', 'h', 'i', 'k', 'a', 'w',
+	'a', 't', 'a', 'i', 't', 'o', 't', 'o', 's', 'h', 'i', 'm', 'a', 'k', 'a', 'w',
+	'a', 'h', 'a', 'r', 'a', 'k', 'o', 't', 'o', 'u', 'r', 'a', 'm', 'i', 's', 'a',
+	's', 'a', 'n', 'a', 'n', 'b', 'u', 's', 'a', 'k', 'a', 'i', 'm', 'i', 'n', 'a',
+	't', 'o', 'y', 'o', 'n', 'a', 'g', 'o', 'f', 'u', 'k', 'u', 'm', 'i', 't', 's',
+	'u', 'f', 'u', 'n', 'a', 'h', 'a', 's', 'h', 'i', 'j', 'o', 'h', 'a', 'n', 'a',
+	'k', 'a', 'm', 'i', 'i', 'c', 'h', 'i', 'k', 'u', 'r', 'o', 'b', 'e', 'n', 'a',
+	'k', 'a', 'n', 'i', 'i', 'k', 'a', 'w', 'a', 'n', 'a', 'm', 'e', 'r', 'i', 'k',
+	'a', 'w', 'a', 'n', 'a', 'n', 't', 'o', 'n', 'y', 'u', 'z', 'e', 'n', 'o', 'y',
+	'a', 'b', 'e', 't', 'a', 'i', 'r', 'a', 't', 'a', 'k', 'a', 'o', 'k', 'a', 't',
+	'o', 'n', 'a', 'm', 'i', 'u', 'n', 'a', 'z', 'u', 'k', 'i', 'u', 'o', 'z', 'u',
+	'a', 'r', 'i', 'd', 'a', 'a', 'r', 'i', 'd', 'a', 'g', 'a', 'w', 'a', 'g', 'o',
+	'b', 'o', 'h', 'a', 's', 'h', 'i', 'm', 'o', 't', 'o', 'h', 'i', 'r', 'o', 'g',
+	'a', 'w', 'a', 'i', 'w', 'a', 'd', 'e', 'k', 'a', 'm', 'i', 't', 'o', 'n', 'd',
+	'a', 'k', 'i', 'm', 'i', 'n', 'o', 'k', 'i', 'n', 'o', 'k', 'a', 'w', 'a', 'k',
+	'o', 'z', 'a', 'g', 'a', 'w', 'a', 'k', 'u', 'd', 'o', 'y', 'a', 'm', 'a', 'k',
+	'u', 's', 'h', 'i', 'm', 'o', 't', 'o', 'n', 'a', 'c', 'h', 'i', 'k', 'a', 't',
+	's', 'u', 'u', 'r', 'a', 's', 'h', 'i', 'r', 'a', 'h', 'a', 'm', 'a', 't', 'a',
+	'i', 'j', 'i', 'y', 'u', 'a', 's', 'a', 'f', 'u', 'n', 'a', 'g', 'a', 't', 'a',
+	'h', 'i', 'g', 'a', 's', 'h', 'i', 'n', 'e', 'k', 'a', 'm', 'i', 'n', 'o', 'y',
+	'a', 'm', 'a', 'm', 'a', 'm', 'u', 'r', 'o', 'g', 'a', 'w', 'a', 'n', 'a', 'g',
+	'a', 'i', 'n', 'a', 'k', 'a', 'y', 'a', 'm', 'a', 'n', 'a', 'n', 'y', 'o', 'n',
+	'i', 's', 'h', 'i', 'k', 'a', 'w', 'a', 'o', 'b', 'a', 'n', 'a', 'z', 'a', 'w',
+	'a', 'o', 'h', 'k', 'u', 'r', 'a', 'o', 'i', 's', 'h', 'i', 'd', 'a', 's', 'a',
+	'g', 'a', 'e', 's', 'a', 'k', 'a', 't', 'a', 's', 'a', 'k', 'e', 'g', 'a', 'w',
+	'a', 's', 'h', 'i', 'r', 'a', 't', 'a', 'k', 'a', 't', 'a', 'k', 'a', 'h', 'a',
+	't', 'a', 't', 'e', 'n', 'd', 'o', 't', 'o', 'z', 'a', 'w', 'a', 't', 's', 'u',
+	'r', 'u', 'o', 'k', 'a', 'y', 'a', 'm', 'a', 'n', 'o', 'b', 'e', 'y', 'o', 'n',
+	'e', 'z', 'a', 'w', 'a', 'i', 'w', 'a', 'k', 'u', 'n', 'i', 'k', 'u', 'd', 'a',
+	'm', 'a', 't', 's', 'u', 'm', 'i', 't', 'o', 'u', 's', 'h', 'i', 'm', 'o', 'n',
+	'o', 's', 'e', 'k', 'i', 's', 'h', 'u', 'n', 'a', 'n', 't', 'a', 'b', 'u', 's',
+	'e', 't', 'o', 'k', 'u', 'y', 'a', 'm', 'a', 'y', 'u', 'u', 'd', 'o', 's', 'h',
+	'i', 'f', 'u', 'e', 'f', 'u', 'k', 'i', 'f', 'u', 'j', 'i', 'k', 'a', 'w', 'a',
+	'g', 'u', 'c', 'h', 'i', 'k', 'o', 'f', 'u', 'j', 'i', 'y', 'o', 's', 'h', 'i',
+	'd', 'a', 'h', 'a', 'y', 'a', 'k', 'a', 'w', 'a', 'i', 'c', 'h', 'i', 'k', 'a',
+	'w', 'a', 'm', 'i', 's', 'a', 't', 'o', 'k', 'o', 's', 'h', 'u', 'k', 'o', 's',
+	'u', 'g', 'e', 'm', 'i', 'n', 'a', 'm', 'i', '-', 'a', 'l', 'p', 's', 'm', 'i',
+	'n', 'o', 'b', 'u', 'n', 'a', 'k', 'a', 'm', 'i', 'c', 'h', 'i', 'n', 'a', 'r',
+	'u', 's', 'a', 'w', 'a', 'n', 'i', 'r', 'a', 's', 'a', 'k', 'i', 'n', 'i', 's',
+	'h', 'i', 'k', 'a', 't', 's', 'u', 'r', 'a', 't', 'a', 'b', 'a', 'y', 'a', 'm',
+	'a', 'u', 'e', 'n', 'o', 'h', 'a', 'r', 'a', 'y', 'a', 'm', 'a', 'n', 'a', 'k',
+	'a', 'k', 'o', 'u', 'p', 'a', 'a', 's', 'l', 'o', 'c', 'a', 'l', 'h', 'o', 's',
+	't', 'f', 'o', 'r', 'g', 'o', 't', 'c', 'e', 'n', 't', 'r', 'a', 'l', 'u', 's',
+	'e', 'a', 's', 't', 'a', 's', 'i', 'a', 'e', 'a', 's', 't', 'u', 's', '2', 'w',
+	'e', 's', 't', 'e', 'u', 'r', 'o', 'p', 'e', 'w', 'e', 's', 't', 'u', 's', '2',
+	'f', 'r', 'a', '1', '-', 'd', 'e', 'w', 'e', 's', 't', '1', '-', 'u', 's', 'j',
+	'l', 's', '-', 's', 't', 'o', '1', 'j', 'l', 's', '-', 's', 't', 'o', '2', 'j',
+	'l', 's', '-', 's', 't', 'o', '3', 'f', 'r', 'e', 'e', 't', 'l', 's', 'w', 'e',
+	'b', 'p', 'a', 'a', 's', 'n', 'o', 'r', 'd', 'e', 's', 't', 'e', '-', 'i', 'd',
+	'c', 'x', 'n', '-', '-', 'v', 'l', 'e', 'r', '-', 'q', 'o', 'a', 'h', 'e', 'r',
+	'o', 'y', 'x', 'n', '-', '-', 'b', '-', '5', 'g', 'a', 'x', 'n', '-', '-', 'h',
+	'e', 'r', 'y', '-', 'i', 'r', 'a', 'q', '-', 'a', 'g', 'r', 'i', 'w', 'k', 'm',
+	'p', 's', 'p', 'k', 'o', 'n', 's', 'u', 'l', 'a', 't', 'k', 'p', 'p', 's', 'p',
+	'k', 'w', 'p', 'k', 'w', 'p', 's', 'p', 'm', 'u', 'p', 'o', 'i', 'r', 'm', 'p',
+	'i', 'n', 'b', 'p', 'i', 'w', 'p', 's', 's', 'e', 'r', 'z', 'g', 'w', 's', 't',
+	'a', 'r', 'o', 's', 't', 'w', 'o', 'u', 'g', 'i', 'm', 'u', 'p', 'o', 'w', 'w',
+	'i', 'i', 'h', 'w', 'i', 'n', 'b', 'w', 'i', 'o', 's', 'w', 'i', 't', 'd', 'w',
+	'i', 'w', 'w', 's', 'k', 'r', 'w', 'u', 'o', 'z', 'w', 'z', 'm', 'i', 'u', 'w',
+	'l', 'a', 'n', 'd', 'i', 'n', 'g', 's', 'p', 'e', 'c', 't', 'r', 'u', 'm', 'm',
+	'y', 'm', 'a', 'i', 'l', 'e', 'r', 'a', 'd', 'i', 'm', 'o', 'b', 'y', 't', 'e',
+	'm', 'a', 'r', 'k', 'l', 'a', 'y', 'e', 'r', 's', 'h', 'i', 'f', 't', 'n', 'h',
+	'-', 's', 'e', 'r', 'v', 'r', 'e', 't', 'r', 'o', 's', 'n', 'u', 'b', 'c', 'a',
+	'm', 'p', 'a', 'i', 'g', 'n', 'h', 'o', 'm', 'e', 'o', 'f', 'f', 'i', 'c', 'e',
+	'a', 'f', 'f', 'i', 'n', 'i', 't', 'y', 'l', 'o', 't', 't', 'e', 'r', 'y', 'g',
+	'l', 'u', 'g', 'l', 'u', 'g', 's', 'r', 'a', 'f', 'f', 'l', 'e', 'e', 'n', 't',
+	'r', 'y', 'w', 'e', 'e', 'k', 'l', 'y', 'l', 'o', 't', 't', 'e', 'r', 'y', 'p',
+	'h', 'x', 'a', 'n', 'n', '-', 'a', 'r', 'b', 'o', 'r', 'c', 'o', 'g', 'e', 'a',
+	't', 'o', 'n', 'w', 'a', 's', 'h', 't', 'e', 'n', 'a', 'w', 'a', 'l', 'p', '1',
+	'f', 'r', '-', 'p', 'a', 'r', '-', '1', 'f', 'r', '-', 'p', 'a', 'r', '-', '2',
+	'n', 'l', '-', 'a', 'm', 's', '-', '1', 'f', 'n', 'c', 'w', 'h', 'm', 'c', 'n',
+	'-', 'n', 'o', 'r', 't', 'h', '-', '1', 'c', 'l', 'o', 'u', 'd', '9', 'd', 'u',
+	'a', 'l', 's', 't', 'a', 'c', 'k', 'f', 'l', 't', 'u', 's', 'r', 'f', 'r', '-',
+	'1', 'l', 'o', 'n', '-', '1', 'l', 'o', 'n', '-', '2', 'n', 'y', '-', '1', 'n',
+	'y', '-', '2', 's', 'g', '-', '1', 'n', 'j', 's', 'p', 'a', 'r', 'o', 'c', 'h',
+	'u', 's', 'e', 'r', 's', 'n', 'o', 'd', 'e', 's', 'c', 'n', '-', 'n', 'o', 'r',
+	't', 'h', 'w', 'e', 's', 't', '-', '1', 'v', 'f', 's', 'w', 'e', 'b', 'v', 'i',
+	'e', 'w', '-', 'a', 's', 's', 'e', 't', 's',
+};
+
+static struct psl_node const psl_nodes[PSL_NODE_COUNT] = {
+	{0, 1, 1490, 0, 0},
+	{0, 0, 0, 3, 1},
+	{3, 0, 0, 4, 1},
+	{7, 0, 0, 6, 1},
+	{13, 0, 0, 3, 1},
+	{16, 0, 0, 6, 1},
+	{22, 0, 0, 6, 1},
+	{28, 0, 0, 3, 1},
+	{31, 0, 0, 4, 1},
+	{35, 0, 0, 7, 1},
+	{42, 0, 0, 8, 1},
+	{50, 1491, 7, 2, 1},
+	{52, 1498, 1, 7, 1},
+	{59, 0, 0, 9, 1},
+	{68, 0, 0, 10, 1},
+	{78, 0, 0, 11, 1},
+	{89, 0, 0, 3, 1},
+	{92, 0, 0, 5, 1},
+	{39, 1499, 1, 2, 1},
+	{97, 0, 0, 3, 1},
+	{100, 0, 0, 5, 1},
+	{105, 1500, 8, 2, 1},
+	{107, 0, 0, 3, 1},
+	{110, 1508, 86, 4, 1},
+	{114, 0, 0, 5, 1},
+	{119, 1594, 5, 2, 1},
+	{121, 0, 0, 3, 1},
+	{124, 0, 0, 6, 1},
+	{130, 1599, 5, 2, 1},
+	{132, 0, 0, 7, 1},
+	{139, 0, 0, 6, 1},
+	{145, 1604, 5, 2, 1},
+	{147, 0, 0, 3, 1},
+	{150, 0, 0, 6, 1},
+	{156, 0, 0, 8, 1},
+	{164, 0, 0, 6, 1},
+	{170, 0, 0, 4, 1},
+	{174, 1609, 7, 2, 1},
+	{176, 0, 0, 9, 1},
+	{185, 0, 0, 7, 1},
+	{192, 0, 0, 6, 1},
+	{198, 0, 0, 9, 1},
+	{207, 0, 0, 8, 1},
+	{215, 0, 0, 4, 1},
+	{219, 0, 0, 6, 1},
+	{225, 0, 0, 6, 1},
+	{231, 1616, 9, 2, 1},
+	{233, 0, 0, 6, 1},
+	{239, 0, 0, 15, 1},
+	{254, 0, 0, 14, 1},
+	{268, 0, 0, 4, 1},
+	{272, 0, 0, 5, 1},
+	{277, 0, 0, 5, 1},
+	{282, 0, 0, 9, 1},
+	{291, 0, 0, 9, 1},
+	{300, 0, 0, 7, 1},
+	{307, 0, 0, 6, 1},
+	{204, 0, 0, 3, 1},
+	{313, 1625, 6, 2, 1},
+	{315, 0, 0, 3, 1},
+	{318, 0, 0, 10, 1},
+	{328, 1631, 28, 3, 1},
+	{331, 0, 0, 5, 1},
+	{336, 0, 0, 2, 1},
+	{338, 0, 0, 9, 1},
+	{4, 1659, 14, 2, 1},
+	{347, 0, 0, 4, 1},
+	{351, 0, 0, 6, 1},
+	{357, 0, 0, 5, 1},
+	{362, 0, 0, 4, 1},
+	{4, 1673, 6, 4, 1},
+	{9, 0, 0, 3, 1},
+	{366, 0, 0, 4, 1},
+	{370, 1679, 1, 2, 1},
+	{372, 0, 0, 4, 1},
+	{376, 1680, 1, 4, 1},
+	{380, 0, 0, 10, 1},
+	{212, 1681, 18, 2, 1},
+	{390, 0, 0, 7, 1},
+	{397, 0, 0, 8, 1},
+	{405, 1699, 18, 2, 1},
+	{407, 0, 0, 7, 1},
+	{414, 0, 0, 4, 1},
+	{418, 0, 0, 7, 1},
+	{425, 0, 0, 5, 1},
+	{430, 0, 0, 7, 1},
+	{437, 0, 0, 6, 1},
+	{443, 0, 0, 4, 1},
+	{447, 0, 0, 5, 1},
+	{452, 0, 0, 7, 1},
+	{459, 1717, 1, 2, 1},
+	{461, 0, 0, 3, 1},
+	{464, 1718, 8, 2, 1},
+	{466, 0, 0, 3, 1},
+	{235, 1726, 12, 2, 1},
+	{469, 0, 0, 5, 1},
+	{8, 1738, 8, 2, 1},
+	{474, 0, 0, 4, 1},
+	{478, 0, 0, 5, 1},
+	{483, 0, 0, 7, 1},
+	{490, 0, 0, 14, 1},
+	{504, 0, 0, 4, 1},
+	{508, 0, 0, 4, 1},
+	{8, 0, 0, 3, 1},
+	{512, 0, 0, 9, 1},
+	{521, 0, 0, 11, 1},
+	{532, 0, 0, 8, 1},
+	{540, 0, 0, 8, 1},
+	{548, 0, 0, 8, 1},
+	{556, 0, 0, 8, 1},
+	{564, 1746, 2, 10, 1},
+	{574, 0, 0, 7, 1},
+	{581, 0, 0, 6, 1},
+	{14, 1748, 10, 2, 1},
+	{587, 0, 0, 3, 1},
+	{590, 0, 0, 3, 1},
+	{593, 0, 0, 4, 1},
+	{597, 0, 0, 3, 1},
+	{600, 0, 0, 3, 1},
+	{603, 0, 0, 2, 2},
+	{605, 1758, 8, 2, 1},
+	{607, 0, 0, 5, 1},
+	{612, 0, 0, 6, 1},
+	{618, 0, 0, 4, 1},
+	{622, 0, 0, 7, 1},
+	{629, 0, 0, 6, 1},
+	{635, 0, 0, 4, 1},
+	{639, 0, 0, 7, 1},
+	{646, 0, 0, 3, 1},
+	{649, 1766, 1, 2, 1},
+	{651, 1767, 38, 2, 1},
+	{653, 1805, 5, 2, 1},
+	{655, 0, 0, 6, 1},
+	{48, 1810, 5, 2, 1},
+	{661, 0, 0, 5, 1},
+	{666, 0, 0, 3, 1},
+	{669, 0, 0, 4, 1},
+	{673, 0, 0, 4, 1},
+	{677, 0, 0, 5, 1},
+	{682, 0, 0, 3, 1},
+	{685, 1815, 15, 3, 1},
+	{688, 1830, 21, 2, 1},
+	{690, 0, 0, 5, 1},
+	{695, 0, 0, 11, 1},
+	{706, 0, 0, 11, 1},
+	{717, 0, 0, 4, 1},
+	{721, 0, 0, 9, 1},
+	{730, 0, 0, 4, 1},
+	{734, 1851, 5, 2, 1},
+	{736, 0, 0, 3, 1},
+	{739, 0, 0, 3, 1},
+	{742, 1856, 6, 2, 1},
+	{744, 0, 0, 10, 1},
+	{18, 1862, 41, 2, 1},
+	{754, 0, 0, 5, 1},
+	{759, 0, 0, 10, 1},
+	{769, 0, 0, 4, 1},
+	{773, 0, 0, 3, 1},
+	{776, 0, 0, 4, 1},
+	{780, 0, 0, 3, 1},
+	{783, 0, 0, 4, 1},
+	{787, 0, 0, 7, 1},
+	{794, 0, 0, 5, 1},
+	{799, 0, 0, 6, 1},
+	{805, 0, 0, 6, 1},
+	{18, 0, 0, 3, 1},
+	{811, 0, 0, 8, 1},
+	{819, 0, 0, 3, 1},
+	{822, 1903, 141, 2, 1},
+	{824, 0, 0, 8, 1},
+	{832, 0, 0, 11, 1},
+	{843, 0, 0, 8, 1},
+	{851, 0, 0, 6, 1},
+	{857, 0, 0, 7, 1},
+	{864, 0, 0, 8, 1},
+	{872, 2044, 6, 2, 1},
+	{591, 2050, 5, 2, 1},
+	{874, 0, 0, 5, 1},
+	{879, 2055, 1, 8, 1},
+	{887, 2056, 1, 8, 1},
+	{643, 0, 0, 3, 1},
+	{895, 0, 0, 4, 1},
+	{24, 0, 0, 2, 1},
+	{899, 2057, 2, 2, 1},
+	{476, 2059, 6, 2, 1},
+	{901, 2065, 7, 2, 1},
+	{903, 0, 0, 3, 1},
+	{30, 2072, 21, 2, 1},
+	{30, 0, 0, 3, 1},
+	{906, 0, 0, 4, 1},
+	{910, 0, 0, 3, 1},
+	{913, 0, 0, 4, 1},
+	{917, 0, 0, 11, 1},
+	{928, 0, 0, 3, 1},
+	{931, 0, 0, 6, 1},
+	{937, 0, 0, 4, 1},
+	{941, 0, 0, 5, 1},
+	{946, 0, 0, 8, 1},
+	{954, 0, 0, 7, 1},
+	{961, 0, 0, 10, 1},
+	{528, 0, 0, 3, 1},
+	{971, 0, 0, 7, 1},
+	{978, 0, 0, 5, 1},
+	{983, 0, 0, 4, 1},
+	{987, 0, 0, 6, 1},
+	{993, 0, 0, 7, 1},
+	{1000, 0, 0, 4, 1},
+	{1004, 2093, 1, 4, 1},
+	{1008, 0, 0, 4, 1},
+	{1012, 0, 0, 4, 1},
+	{1016, 0, 0, 6, 1},
+	{1022, 0, 0, 3, 1},
+	{1025, 0, 0, 8, 1},
+	{1033, 0, 0, 8, 1},
+	{503, 0, 0, 3, 1},
+	{1041, 0, 0, 3, 1},
+	{1044, 0, 0, 4, 1},
+	{1048, 0, 0, 3, 1},
+	{60, 2094, 9, 2, 1},
+	{1051, 2103, 1, 2, 1},
+	{1053, 0, 0, 6, 1},
+	{1059, 0, 0, 3, 1},
+	{1062, 0, 0, 4, 1},
+	{1066, 2104, 1, 2, 1},
+	{1068, 0, 0, 3, 1},
+	{1071, 0, 0, 3, 1},
+	{598, 0, 0, 2, 1},
+	{359, 2105, 13, 2, 1},
+	{1074, 0, 0, 6, 1},
+	{1080, 0, 0, 7, 1},
+	{1087, 0, 0, 7, 1},
+	{1094, 0, 0, 5, 1},
+	{1099, 0, 0, 4, 1},
+	{1103, 0, 0, 5, 1},
+	{1108, 0, 0, 7, 1},
+	{1115, 0, 0, 9, 1},
+	{1124, 0, 0, 6, 1},
+	{1130, 0, 0, 6, 1},
+	{384, 2118, 17, 2, 1},
+	{1136, 0, 0, 8, 1},
+	{1144, 0, 0, 6, 1},
+	{1150, 0, 0, 5, 1},
+	{1155, 0, 0, 7, 1},
+	{1162, 0, 0, 4, 1},
+	{1166, 0, 0, 5, 1},
+	{1171, 0, 0, 4, 1},
+	{1175, 0, 0, 8, 1},
+	{693, 2135, 1, 2, 2},
+	{524, 2136, 5, 2, 1},
+	{1183, 0, 0, 6, 1},
+	{1189, 0, 0, 8, 1},
+	{1197, 0, 0, 5, 1},
+	{1202, 0, 0, 6, 1},
+	{1208, 0, 0, 8, 1},
+	{1216, 0, 0, 8, 1},
+	{1224, 2141, 27, 5, 1},
+	{1229, 2168, 3, 4, 1},
+	{1233, 0, 0, 7, 1},
+	{1240, 2171, 4, 2, 1},
+	{601, 2175, 47, 2, 1},
+	{70, 2222, 23, 2, 1},
+	{1242, 0, 0, 5, 1},
+	{1247, 2245, 1, 5, 1},
+	{1252, 0, 0, 6, 1},
+	{1258, 0, 0, 7, 1},
+	{1265, 0, 0, 7, 1},
+	{1272, 2246, 399, 3, 1},
+	{1275, 0, 0, 7, 1},
+	{1282, 0, 0, 8, 1},
+	{1290, 2645, 3, 9, 1},
+	{1299, 0, 0, 7, 1},
+	{1306, 0, 0, 7, 1},
+	{1313, 0, 0, 8, 1},
+	{1321, 0, 0, 6, 1},
+	{1327, 0, 0, 6, 1},
+	{1333, 0, 0, 12, 1},
+	{1345, 0, 0, 10, 1},
+	{1355, 0, 0, 7, 1},
+	{1362, 0, 0, 11, 1},
+	{1373, 0, 0, 7, 1},
+	{1380, 0, 0, 14, 1},
+	{1394, 2648, 2, 4, 1},
+	{1398, 0, 0, 4, 1},
+	{1402, 0, 0, 7, 1},
+	{1409, 0, 0, 7, 1},
+	{1416, 0, 0, 6, 1},
+	{1422, 0, 0, 7, 1},
+	{1429, 0, 0, 7, 1},
+	{1436, 0, 0, 3, 1},
+	{1439, 2650, 7, 2, 1},
+	{1441, 0, 0, 6, 1},
+	{1447, 0, 0, 10, 1},
+	{1457, 0, 0, 11, 1},
+	{1468, 0, 0, 7, 1},
+	{1475, 0, 0, 5, 1},
+	{1480, 0, 0, 3, 1},
+	{1483, 0, 0, 6, 1},
+	{1489, 0, 0, 7, 1},
+	{1496, 2657, 6, 2, 1},
+	{1498, 0, 0, 10, 1},
+	{1508, 2663, 6, 2, 1},
+	{1510, 2669, 4, 2, 1},
+	{1512, 2673, 3, 2, 1},
+	{143, 2676, 12, 2, 1},
+	{1514, 0, 0, 5, 1},
+	{1519, 0, 0, 4, 1},
+	{1523, 2688, 6, 2, 1},
+	{1525, 0, 0, 5, 1},
+	{1530, 0, 0, 3, 1},
+	{1533, 0, 0, 5, 1},
+	{1538, 0, 0, 4, 1},
+	{1542, 0, 0, 4, 1},
+	{1546, 0, 0, 6, 1},
+	{1552, 0, 0, 6, 1},
+	{703, 0, 0, 3, 1},
+	{1558, 0, 0, 4, 1},
+	{1562, 0, 0, 3, 1},
+	{55, 2694, 71, 2, 1},
+	{1565, 0, 0, 4, 1},
+	{1569, 0, 0, 6, 1},
+	{1575, 0, 0, 5, 1},
+	{1580, 0, 0, 6, 1},
+	{1586, 0, 0, 8, 1},
+	{1594, 0, 0, 4, 1},
+	{1598, 0, 0, 8, 1},
+	{1606, 0, 0, 5, 1},
+	{1611, 0, 0, 8, 1},
+	{1619, 0, 0, 6, 1},
+	{1625, 0, 0, 7, 1},
+	{1632, 0, 0, 4, 1},
+	{1636, 2765, 1, 6, 1},
+	{1642, 2766, 23, 3, 1},
+	{1645, 0, 0, 3, 1},
+	{1648, 0, 0, 8, 1},
+	{1656, 0, 0, 4, 1},
+	{1660, 2789, 1, 7, 1},
+	{1667, 0, 0, 6, 1},
+	{1673, 0, 0, 9, 1},
+	{1682, 0, 0, 8, 1},
+	{1690, 0, 0, 8, 1},
+	{1698, 0, 0, 4, 1},
+	{1702, 0, 0, 3, 1},
+	{1705, 0, 0, 2, 1},
+	{1707, 2790, 8, 2, 1},
+	{1709, 2798, 5, 2, 1},
+	{1711, 0, 0, 3, 1},
+	{40, 2803, 10, 2, 1},
+	{1714, 0, 0, 4, 1},
+	{1718, 0, 0, 6, 1},
+	{1724, 0, 0, 3, 1},
+	{1727, 0, 0, 7, 1},
+	{1734, 0, 0, 3, 1},
+	{1737, 0, 0, 8, 1},
+	{1745, 0, 0, 5, 1},
+	{1750, 0, 0, 3, 1},
+	{1753, 0, 0, 5, 1},
+	{1758, 0, 0, 6, 1},
+	{1764, 0, 0, 6, 1},
+	{1770, 0, 0, 6, 1},
+	{1776, 0, 0, 4, 1},
+	{1780, 0, 0, 3, 1},
+	{1783, 2813, 10, 2, 1},
+	{1785, 2823, 1, 5, 1},
+	{608, 0, 0, 3, 1},
+	{909, 2824, 14, 2, 1},
+	{1257, 0, 0, 3, 1},
+	{1790, 0, 0, 5, 1},
+	{1795, 2838, 1, 3, 1},
+	{1798, 2839, 1, 9, 1},
+	{619, 2840, 10, 2, 1},
+	{108, 2850, 9, 2, 1},
+	{1807, 0, 0, 5, 1},
+	{1812, 0, 0, 6, 1},
+	{1818, 0, 0, 6, 1},
+	{1824, 0, 0, 8, 1},
+	{1832, 0, 0, 11, 1},
+	{1843, 0, 0, 11, 1},
+	{1854, 0, 0, 5, 1},
+	{1859, 0, 0, 9, 1},
+	{111, 0, 0, 2, 2},
+	{1868, 0, 0, 8, 1},
+	{1876, 0, 0, 4, 1},
+	{251, 2859, 7, 2, 1},
+	{1880, 0, 0, 3, 1},
+	{1883, 2866, 1, 6, 1},
+	{115, 2867, 8, 2, 1},
+	{1889, 0, 0, 8, 1},
+	{1897, 2875, 9, 2, 1},
+	{1899, 0, 0, 10, 1},
+	{1909, 2884, 1, 3, 1},
+	{1912, 2885, 2, 6, 1},
+	{1918, 0, 0, 8, 1},
+	{1926, 0, 0, 6, 1},
+	{1932, 0, 0, 7, 1},
+	{247, 0, 0, 7, 1},
+	{1939, 0, 0, 10, 1},
+	{1949, 0, 0, 4, 1},
+	{1953, 0, 0, 4, 1},
+	{1957, 0, 0, 9, 1},
+	{1966, 2887, 1, 5, 1},
+	{262, 0, 0, 6, 1},
+	{1971, 0, 0, 3, 1},
+	{1974, 0, 0, 4, 1},
+	{1978, 2888, 1, 4, 1},
+	{1982, 0, 0, 7, 1},
+	{1989, 0, 0, 7, 1},
+	{1996, 0, 0, 4, 1},
+	{2000, 0, 0, 5, 1},
+	{2005, 0, 0, 8, 1},
+	{2013, 0, 0, 7, 1},
+	{2020, 0, 0, 7, 1},
+	{201, 2889, 10, 2, 1},
+	{2027, 0, 0, 4, 1},
+	{2031, 0, 0, 8, 1},
+	{2039, 0, 0, 4, 1},
+	{2043, 0, 0, 4, 1},
+	{2047, 0, 0, 5, 1},
+	{2052, 0, 0, 7, 1},
+	{2059, 2899, 1, 9, 1},
+	{2068, 0, 0, 4, 1},
+	{2072, 0, 0, 9, 1},
+	{2081, 0, 0, 8, 1},
+	{2089, 0, 0, 4, 1},
+	{2093, 0, 0, 7, 1},
+	{2100, 0, 0, 3, 1},
+	{2103, 0, 0, 7, 1},
+	{2110, 2900, 10, 2, 1},
+	{2112, 0, 0, 2, 2},
+	{2114, 0, 0, 6, 1},
+	{2120, 0, 0, 7, 1},
+	{2127, 0, 0, 4, 1},
+	{2131, 0, 0, 7, 1},
+	{2138, 0, 0, 7, 1},
+	{2145, 0, 0, 3, 1},
+	{2148, 2910, 6, 2, 1},
+	{159, 0, 0, 2, 1},
+	{544, 0, 0, 3, 1},
+	{2150, 0, 0, 4, 1},
+	{2154, 0, 0, 11, 1},
+	{2165, 0, 0, 8, 1},
+	{2173, 0, 0, 4, 1},
+	{2177, 0, 0, 5, 1},
+	{2182, 0, 0, 7, 1},
+	{2189, 0, 0, 5, 1},
+	{2194, 0, 0, 10, 1},
+	{2204, 0, 0, 3, 1},
+	{125, 2916, 34, 2, 1},
+	{2207, 0, 0, 4, 1},
+	{2211, 0, 0, 9, 1},
+	{2220, 0, 0, 3, 1},
+	{2223, 0, 0, 7, 1},
+	{2230, 0, 0, 9, 1},
+	{2239, 0, 0, 8, 1},
+	{2247, 0, 0, 3, 1},
+	{2250, 0, 0, 7, 1},
+	{2257, 0, 0, 3, 1},
+	{2260, 0, 0, 4, 1},
+	{2264, 0, 0, 9, 1},
+	{2273, 0, 0, 6, 1},
+	{2279, 0, 0, 3, 1},
+	{38, 0, 0, 2, 1},
+	{2282, 0, 0, 3, 1},
+	{2285, 0, 0, 7, 1},
+	{2292, 0, 0, 5, 1},
+	{2297, 0, 0, 6, 1},
+	{2303, 0, 0, 4, 1},
+	{2307, 0, 0, 5, 1},
+	{2312, 0, 0, 3, 1},
+	{2315, 0, 0, 6, 1},
+	{2321, 0, 0, 3, 1},
+	{599, 0, 0, 2, 1},
+	{2324, 0, 0, 4, 1},
+	{1551, 2950, 2, 2, 1},
+	{2328, 2952, 1, 3, 1},
+	{140, 2953, 7, 2, 1},
+	{2331, 0, 0, 3, 1},
+	{1842, 0, 0, 4, 1},
+	{2334, 0, 0, 7, 1},
+	{2341, 0, 0, 6, 1},
+	{2099, 0, 0, 2, 1},
+	{2340, 2960, 6, 2, 1},
+	{2347, 0, 0, 4, 1},
+	{2123, 2966, 5, 2, 1},
+	{1662, 2971, 6, 2, 1},
+	{2351, 0, 0, 4, 1},
+	{2355, 0, 0, 5, 1},
+	{2360, 0, 0, 5, 1},
+	{2365, 0, 0, 6, 1},
+	{2371, 2977, 7, 2, 1},
+	{2373, 0, 0, 5, 1},
+	{2378, 0, 0, 3, 1},
+	{2381, 0, 0, 6, 1},
+	{2387, 0, 0, 5, 1},
+	{2392, 0, 0, 2, 1},
+	{2394, 0, 0, 5, 1},
+	{2399, 0, 0, 4, 1},
+	{2403, 0, 0, 3, 1},
+	{2406, 0, 0, 3, 1},
+	{1269, 2984, 6, 2, 1},
+	{2409, 0, 0, 7, 1},
+	{2416, 0, 0, 4, 1},
+	{2420, 0, 0, 9, 1},
+	{2429, 0, 0, 4, 1},
+	{2433, 0, 0, 3, 1},
+	{2436, 0, 0, 8, 1},
+	{2433, 2990, 3, 4, 1},
+	{2444, 0, 0, 6, 1},
+	{2450, 0, 0, 3, 1},
+	{2453, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2459, 2993, 7, 2, 1},
+	{2461, 0, 0, 2, 1},
+	{1582, 3000, 7, 2, 1},
+	{2463, 0, 0, 8, 1},
+	{2471, 0, 0, 8, 1},
+	{2479, 0, 0, 6, 1},
+	{2485, 0, 0, 5, 1},
+	{2490, 0, 0, 5, 1},
+	{2495, 0, 0, 7, 1},
+	{2502, 3007, 1, 5, 1},
+	{2507, 0, 0, 2, 1},
+	{2509, 3008, 10, 2, 1},
+	{2511, 3018, 8, 2, 1},
+	{2513, 0, 0, 8, 1},
+	{2521, 0, 0, 5, 1},
+	{2526, 0, 0, 4, 1},
+	{2530, 0, 0, 5, 1},
+	{2535, 0, 0, 7, 1},
+	{2542, 0, 0, 4, 1},
+	{2546, 0, 0, 2, 1},
+	{1822, 3026, 7, 2, 1},
+	{2548, 0, 0, 4, 1},
+	{2552, 0, 0, 7, 1},
+	{2559, 0, 0, 7, 1},
+	{577, 0, 0, 4, 1},
+	{798, 0, 0, 3, 1},
+	{2566, 0, 0, 4, 1},
+	{2570, 0, 0, 8, 1},
+	{2578, 3033, 1, 6, 1},
+	{2584, 0, 0, 10, 1},
+	{2594, 0, 0, 4, 1},
+	{2598, 0, 0, 8, 1},
+	{2606, 0, 0, 4, 1},
+	{2610, 0, 0, 6, 1},
+	{2616, 0, 0, 4, 1},
+	{2620, 0, 0, 6, 1},
+	{2626, 0, 0, 9, 1},
+	{2635, 0, 0, 7, 1},
+	{2642, 0, 0, 3, 1},
+	{2645, 3034, 25, 2, 1},
+	{2647, 0, 0, 3, 1},
+	{2650, 0, 0, 2, 1},
+	{2652, 3059, 7, 2, 1},
+	{2654, 0, 0, 6, 1},
+	{2660, 0, 0, 8, 1},
+	{2668, 0, 0, 7, 1},
+	{2675, 0, 0, 9, 1},
+	{2684, 0, 0, 9, 1},
+	{2693, 0, 0, 5, 1},
+	{2698, 0, 0, 9, 1},
+	{2707, 0, 0, 5, 1},
+	{2712, 0, 0, 5, 1},
+	{2717, 0, 0, 8, 1},
+	{2725, 3066, 11, 4, 1},
+	{2729, 3077, 1, 7, 1},
+	{2736, 0, 0, 3, 1},
+	{2739, 0, 0, 7, 1},
+	{2746, 0, 0, 6, 1},
+	{2752, 0, 0, 7, 1},
+	{2759, 0, 0, 5, 1},
+	{2764, 0, 0, 3, 1},
+	{762, 3078, 6, 2, 1},
+	{2767, 0, 0, 4, 1},
+	{2124, 3084, 17, 2, 1},
+	{1131, 3101, 32, 2, 1},
+	{2771, 0, 0, 6, 1},
+	{2777, 0, 0, 5, 1},
+	{2782, 0, 0, 7, 1},
+	{2789, 0, 0, 3, 1},
+	{2792, 0, 0, 4, 1},
+	{2796, 0, 0, 3, 1},
+	{2799, 0, 0, 3, 1},
+	{305, 3133, 14, 2, 1},
+	{26, 3147, 3, 2, 1},
+	{2802, 0, 0, 4, 1},
+	{2806, 0, 0, 3, 1},
+	{2809, 0, 0, 5, 1},
+	{265, 3150, 8, 2, 1},
+	{1186, 3158, 8, 2, 1},
+	{2814, 0, 0, 6, 1},
+	{2820, 0, 0, 4, 1},
+	{2824, 0, 0, 4, 1},
+	{2828, 0, 0, 10, 1},
+	{202, 3166, 46, 2, 1},
+	{926, 0, 0, 3, 1},
+	{2838, 0, 0, 10, 1},
+	{2848, 0, 0, 8, 1},
+	{2856, 3212, 21, 4, 1},
+	{674, 0, 0, 3, 1},
+	{921, 0, 0, 3, 1},
+	{2860, 0, 0, 9, 1},
+	{2869, 0, 0, 9, 1},
+	{2878, 0, 0, 6, 1},
+	{1110, 3233, 1, 3, 1},
+	{2884, 0, 0, 13, 1},
+	{2897, 0, 0, 6, 1},
+	{2903, 0, 0, 11, 1},
+	{411, 3234, 72, 2, 1},
+	{2914, 0, 0, 8, 1},
+	{815, 3306, 6, 2, 1},
+	{151, 3312, 9, 2, 1},
+	{2922, 0, 0, 5, 1},
+	{1118, 3321, 8, 2, 1},
+	{2927, 0, 0, 7, 1},
+	{1118, 0, 0, 3, 1},
+	{2934, 0, 0, 8, 1},
+	{957, 3329, 417, 2, 1},
+	{2942, 0, 0, 4, 1},
+	{2946, 0, 0, 3, 1},
+	{2949, 0, 0, 6, 1},
+	{2955, 0, 0, 4, 1},
+	{2959, 0, 0, 3, 1},
+	{2962, 3746, 4, 2, 1},
+	{2964, 0, 0, 4, 1},
+	{2968, 0, 0, 5, 1},
+	{2973, 0, 0, 7, 1},
+	{2980, 0, 0, 3, 1},
+	{2983, 0, 0, 3, 1},
+	{2986, 0, 0, 2, 2},
+	{2988, 0, 0, 3, 1},
+	{2991, 0, 0, 3, 1},
+	{2994, 3750, 8, 2, 1},
+	{2996, 0, 0, 4, 1},
+	{3000, 0, 0, 6, 1},
+	{3006, 0, 0, 3, 1},
+	{3009, 0, 0, 3, 1},
+	{3012, 3758, 223, 2, 1},
+	{3014, 0, 0, 8, 1},
+	{3022, 0, 0, 4, 1},
+	{3026, 0, 0, 6, 1},
+	{3032, 0, 0, 7, 1},
+	{3039, 0, 0, 6, 1},
+	{3045, 0, 0, 4, 1},
+	{567, 3981, 9, 2, 1},
+	{3049, 0, 0, 11, 1},
+	{3060, 0, 0, 14, 1},
+	{3074, 0, 0, 15, 1},
+	{3089, 0, 0, 3, 1},
+	{3092, 3990, 12, 2, 1},
+	{135, 0, 0, 2, 2},
+	{790, 4002, 7, 2, 1},
+	{3094, 0, 0, 3, 1},
+	{3097, 0, 0, 4, 1},
+	{3101, 0, 0, 3, 1},
+	{3104, 0, 0, 6, 1},
+	{3110, 0, 0, 6, 1},
+	{3116, 0, 0, 7, 1},
+	{3123, 0, 0, 4, 1},
+	{3127, 4009, 17, 2, 1},
+	{3129, 4026, 4, 2, 1},
+	{3131, 0, 0, 5, 1},
+	{3136, 0, 0, 7, 1},
+	{3143, 0, 0, 6, 1},
+	{3149, 4030, 6, 2, 1},
+	{3151, 0, 0, 4, 1},
+	{3155, 0, 0, 3, 1},
+	{2118, 4036, 30, 2, 1},
+	{3158, 4066, 2, 3, 1},
+	{3161, 0, 0, 4, 1},
+	{3165, 0, 0, 9, 1},
+	{3174, 4068, 7, 2, 1},
+	{3176, 4075, 4, 2, 1},
+	{3178, 0, 0, 5, 1},
+	{3183, 4079, 8, 2, 1},
+	{123, 4087, 10, 2, 1},
+	{3185, 0, 0, 7, 1},
+	{3192, 0, 0, 11, 1},
+	{3203, 0, 0, 5, 1},
+	{3208, 0, 0, 9, 1},
+	{3217, 0, 0, 6, 1},
+	{3223, 4097, 1, 4, 1},
+	{3227, 0, 0, 9, 1},
+	{3236, 0, 0, 7, 1},
+	{3243, 0, 0, 7, 1},
+	{1894, 0, 0, 3, 1},
+	{3250, 0, 0, 6, 1},
+	{3256, 0, 0, 7, 1},
+	{3263, 0, 0, 3, 1},
+	{3266, 0, 0, 6, 1},
+	{563, 4098, 5, 2, 1},
+	{912, 4103, 7, 2, 1},
+	{3272, 0, 0, 3, 1},
+	{3275, 0, 0, 5, 1},
+	{3280, 0, 0, 7, 1},
+	{3287, 0, 0, 6, 1},
+	{3293, 0, 0, 5, 1},
+	{2448, 0, 0, 4, 1},
+	{3298, 0, 0, 5, 1},
+	{3303, 0, 0, 4, 1},
+	{186, 4110, 2, 2, 1},
+	{3307, 0, 0, 4, 1},
+	{3311, 0, 0, 4, 1},
+	{3315, 0, 0, 13, 1},
+	{3328, 0, 0, 9, 1},
+	{3337, 0, 0, 8, 1},
+	{3345, 0, 0, 4, 1},
+	{3349, 0, 0, 5, 1},
+	{3354, 0, 0, 7, 1},
+	{3361, 0, 0, 4, 1},
+	{3365, 0, 0, 7, 1},
+	{3372, 0, 0, 5, 1},
+	{3377, 4112, 3, 4, 1},
+	{3381, 0, 0, 5, 1},
+	{1588, 4115, 1, 4, 1},
+	{3386, 0, 0, 6, 1},
+	{1560, 4116, 15, 2, 1},
+	{915, 0, 0, 3, 1},
+	{3392, 0, 0, 3, 1},
+	{3395, 0, 0, 4, 1},
+	{3399, 0, 0, 5, 1},
+	{3404, 0, 0, 6, 1},
+	{3410, 0, 0, 5, 1},
+	{3415, 4131, 1, 3, 1},
+	{3418, 0, 0, 6, 1},
+	{3424, 0, 0, 5, 1},
+	{3429, 0, 0, 5, 1},
+	{3434, 0, 0, 4, 1},
+	{3393, 0, 0, 3, 1},
+	{3438, 0, 0, 12, 1},
+	{2977, 4132, 5, 2, 1},
+	{209, 4137, 10, 2, 1},
+	{103, 4147, 2, 2, 1},
+	{3450, 0, 0, 3, 1},
+	{3453, 0, 0, 4, 1},
+	{731, 4149, 2, 2, 1},
+	{3457, 0, 0, 8, 1},
+	{3465, 0, 0, 4, 1},
+	{3469, 0, 0, 6, 1},
+	{919, 4151, 9, 2, 1},
+	{217, 4160, 9, 2, 1},
+	{230, 4169, 6, 2, 1},
+	{3475, 0, 0, 5, 1},
+	{3480, 0, 0, 6, 1},
+	{3486, 0, 0, 4, 1},
+	{3490, 0, 0, 6, 1},
+	{3496, 0, 0, 6, 1},
+	{290, 0, 0, 3, 1},
+	{3502, 4175, 1, 10, 1},
+	{3512, 0, 0, 5, 1},
+	{3517, 0, 0, 3, 1},
+	{3520, 0, 0, 6, 1},
+	{3526, 0, 0, 9, 1},
+	{3535, 0, 0, 7, 1},
+	{3542, 0, 0, 8, 1},
+	{3550, 0, 0, 9, 1},
+	{3559, 0, 0, 8, 1},
+	{3567, 0, 0, 6, 1},
+	{1285, 0, 0, 3, 1},
+	{354, 4176, 2, 2, 1},
+	{3573, 0, 0, 8, 1},
+	{1710, 4178, 5, 2, 1},
+	{182, 4183, 43, 2, 1},
+	{1237, 0, 0, 3, 1},
+	{3581, 4226, 1, 5, 1},
+	{3586, 0, 0, 4, 1},
+	{3590, 0, 0, 9, 1},
+	{3599, 0, 0, 4, 1},
+	{3603, 0, 0, 8, 1},
+	{323, 0, 0, 3, 1},
+	{3611, 4227, 1, 4, 1},
+	{3615, 0, 0, 8, 1},
+	{2393, 4228, 9, 2, 1},
+	{2651, 0, 0, 2, 1},
+	{3623, 0, 0, 5, 1},
+	{3628, 0, 0, 9, 1},
+	{264, 0, 0, 3, 1},
+	{3637, 0, 0, 4, 1},
+	{3641, 0, 0, 4, 1},
+	{2630, 0, 0, 3, 1},
+	{3645, 0, 0, 10, 1},
+	{3103, 4237, 8, 2, 1},
+	{3655, 4245, 7, 2, 1},
+	{3657, 0, 0, 3, 1},
+	{3660, 0, 0, 3, 1},
+	{1284, 0, 0, 2, 2},
+	{3663, 0, 0, 3, 1},
+	{3666, 4252, 4, 2, 1},
+	{1613, 4256, 5, 2, 1},
+	{2830, 4261, 2, 4, 1},
+	{3668, 0, 0, 6, 1},
+	{3674, 0, 0, 4, 1},
+	{3678, 0, 0, 3, 1},
+	{2826, 0, 0, 3, 1},
+	{3681, 0, 0, 3, 1},
+	{3684, 0, 0, 6, 1},
+	{3690, 0, 0, 5, 1},
+	{3695, 0, 0, 7, 1},
+	{3702, 0, 0, 6, 1},
+	{3708, 0, 0, 8, 1},
+	{3716, 0, 0, 6, 1},
+	{3722, 0, 0, 4, 1},
+	{3726, 0, 0, 11, 1},
+	{3737, 0, 0, 3, 1},
+	{3740, 0, 0, 5, 1},
+	{939, 4263, 1, 2, 1},
+	{3745, 0, 0, 2, 1},
+	{1516, 4264, 2, 2, 1},
+	{283, 4266, 7, 2, 1},
+	{3620, 0, 0, 3, 1},
+	{3747, 4273, 4, 2, 1},
+	{3749, 0, 0, 3, 1},
+	{3752, 0, 0, 3, 1},
+	{1293, 4277, 7, 2, 1},
+	{3755, 4284, 546, 6, 1},
+	{3761, 0, 0, 5, 1},
+	{3766, 0, 0, 6, 1},
+	{3772, 4830, 14, 2, 1},
+	{740, 4844, 11, 2, 1},
+	{2407, 4855, 6, 2, 1},
+	{57, 4861, 9, 2, 1},
+	{3774, 4870, 8, 2, 1},
+	{117, 4878, 17, 2, 1},
+	{519, 0, 0, 3, 1},
+	{3776, 0, 0, 6, 1},
+	{238, 4895, 2, 4, 1},
+	{3782, 0, 0, 6, 1},
+	{3788, 0, 0, 4, 1},
+	{3792, 0, 0, 3, 1},
+	{142, 4897, 2, 2, 1},
+	{246, 0, 0, 2, 1},
+	{969, 0, 0, 3, 1},
+	{2158, 4899, 165, 3, 1},
+	{3795, 0, 0, 7, 1},
+	{3802, 0, 0, 7, 1},
+	{2158, 5064, 5, 7, 1},
+	{3809, 0, 0, 7, 1},
+	{3816, 0, 0, 3, 1},
+	{3819, 5069, 1, 4, 1},
+	{3823, 0, 0, 4, 1},
+	{3827, 0, 0, 10, 1},
+	{3837, 0, 0, 5, 1},
+	{261, 5070, 10, 2, 1},
+	{3842, 0, 0, 3, 1},
+	{675, 5080, 15, 2, 1},
+	{679, 0, 0, 3, 1},
+	{3845, 0, 0, 3, 1},
+	{1142, 5095, 14, 2, 1},
+	{3848, 0, 0, 4, 1},
+	{3852, 0, 0, 4, 1},
+	{3856, 0, 0, 5, 1},
+	{3861, 0, 0, 5, 1},
+	{3866, 0, 0, 6, 1},
+	{3872, 0, 0, 6, 1},
+	{1740, 5109, 10, 2, 1},
+	{943, 5119, 728, 2, 1},
+	{3878, 0, 0, 5, 1},
+	{3883, 0, 0, 18, 1},
+	{3901, 0, 0, 6, 1},
+	{3907, 0, 0, 3, 1},
+	{3910, 0, 0, 6, 1},
+	{3916, 0, 0, 5, 1},
+	{745, 0, 0, 2, 2},
+	{3921, 5847, 7, 2, 1},
+	{3923, 0, 0, 3, 1},
+	{3926, 0, 0, 3, 1},
+	{3929, 0, 0, 3, 1},
+	{3613, 5854, 4, 2, 1},
+	{1304, 0, 0, 3, 1},
+	{205, 5858, 16, 2, 1},
+	{681, 0, 0, 3, 1},
+	{3932, 0, 0, 8, 1},
+	{3940, 0, 0, 6, 1},
+	{3946, 0, 0, 7, 1},
+	{3953, 0, 0, 6, 1},
+	{3959, 0, 0, 11, 1},
+	{3970, 0, 0, 7, 1},
+	{3416, 0, 0, 4, 1},
+	{181, 5874, 9, 2, 1},
+	{3977, 0, 0, 5, 1},
+	{840, 5883, 3, 3, 1},
+	{3982, 0, 0, 3, 1},
+	{3985, 0, 0, 5, 1},
+	{3422, 0, 0, 3, 1},
+	{3990, 5886, 3, 6, 1},
+	{3996, 0, 0, 3, 1},
+	{3999, 0, 0, 4, 1},
+	{4003, 0, 0, 6, 1},
+	{4009, 5889, 1, 6, 1},
+	{2343, 5890, 114, 3, 1},
+	{4015, 0, 0, 7, 1},
+	{4022, 0, 0, 7, 1},
+	{4029, 0, 0, 5, 1},
+	{4034, 0, 0, 6, 1},
+	{19, 0, 0, 3, 1},
+	{4040, 6004, 1, 3, 1},
+	{6, 6005, 11, 2, 1},
+	{4043, 6016, 9, 4, 1},
+	{4047, 0, 0, 9, 1},
+	{4056, 0, 0, 5, 1},
+	{4061, 0, 0, 4, 1},
+	{4065, 0, 0, 8, 1},
+	{4073, 0, 0, 5, 1},
+	{4078, 6025, 1, 5, 1},
+	{4083, 0, 0, 9, 1},
+	{195, 0, 0, 3, 1},
+	{4092, 0, 0, 4, 1},
+	{948, 6026, 8, 2, 1},
+	{948, 0, 0, 3, 1},
+	{4096, 6034, 3, 2, 1},
+	{4098, 0, 0, 6, 1},
+	{2302, 0, 0, 2, 2},
+	{2474, 6037, 8, 2, 1},
+	{4104, 0, 0, 8, 1},
+	{4112, 0, 0, 3, 1},
+	{4115, 0, 0, 7, 1},
+	{4122, 0, 0, 5, 1},
+	{4127, 0, 0, 5, 1},
+	{4132, 0, 0, 11, 1},
+	{4143, 6045, 1, 6, 1},
+	{4149, 0, 0, 6, 1},
+	{4155, 0, 0, 4, 1},
+	{4159, 0, 0, 6, 1},
+	{4165, 6046, 1, 8, 1},
+	{4173, 0, 0, 3, 1},
+	{4176, 0, 0, 3, 1},
+	{4179, 0, 0, 4, 1},
+	{4183, 0, 0, 4, 1},
+	{4187, 0, 0, 7, 1},
+	{4194, 0, 0, 5, 1},
+	{3150, 6047, 14, 2, 1},
+	{333, 6061, 179, 2, 1},
+	{4199, 6240, 1, 5, 1},
+	{4204, 0, 0, 4, 1},
+	{4208, 0, 0, 11, 1},
+	{4219, 0, 0, 8, 1},
+	{4227, 0, 0, 4, 1},
+	{1863, 6241, 2, 2, 1},
+	{3156, 6243, 5, 2, 1},
+	{4231, 0, 0, 3, 1},
+	{4234, 0, 0, 4, 1},
+	{4238, 0, 0, 5, 1},
+	{4243, 0, 0, 7, 1},
+	{4250, 6248, 1, 4, 1},
+	{433, 0, 0, 4, 1},
+	{249, 6249, 13, 2, 1},
+	{4254, 0, 0, 9, 1},
+	{4263, 0, 0, 5, 1},
+	{249, 0, 0, 5, 1},
+	{4268, 0, 0, 5, 1},
+	{3079, 6262, 14, 3, 1},
+	{4273, 0, 0, 4, 1},
+	{4277, 0, 0, 11, 1},
+	{4288, 0, 0, 4, 1},
+	{4292, 0, 0, 11, 1},
+	{4303, 0, 0, 5, 1},
+	{3079, 0, 0, 10, 1},
+	{4308, 0, 0, 8, 1},
+	{4316, 0, 0, 10, 1},
+	{4326, 0, 0, 3, 1},
+	{4329, 0, 0, 10, 1},
+	{1855, 6276, 7, 2, 1},
+	{4339, 6283, 10, 2, 1},
+	{498, 6293, 1, 3, 1},
+	{4341, 6294, 8, 2, 1},
+	{4343, 0, 0, 3, 1},
+	{4346, 6302, 7, 2, 1},
+	{337, 6309, 9, 2, 1},
+	{4348, 0, 0, 4, 1},
+	{4352, 0, 0, 6, 1},
+	{4358, 0, 0, 5, 1},
+	{4363, 0, 0, 6, 1},
+	{4369, 0, 0, 5, 1},
+	{66, 6318, 4, 2, 1},
+	{4374, 0, 0, 4, 1},
+	{4378, 0, 0, 10, 1},
+	{4388, 0, 0, 7, 1},
+	{4395, 0, 0, 6, 1},
+	{4401, 0, 0, 7, 1},
+	{1442, 0, 0, 3, 1},
+	{4408, 0, 0, 8, 1},
+	{4416, 0, 0, 11, 1},
+	{4427, 0, 0, 5, 1},
+	{4432, 0, 0, 5, 1},
+	{4437, 0, 0, 6, 1},
+	{4443, 0, 0, 4, 1},
+	{4447, 0, 0, 8, 1},
+	{1831, 0, 0, 3, 1},
+	{4455, 0, 0, 4, 1},
+	{4459, 0, 0, 7, 1},
+	{4466, 0, 0, 6, 1},
+	{4472, 0, 0, 6, 1},
+	{4478, 0, 0, 10, 1},
+	{2074, 0, 0, 4, 1},
+	{4488, 0, 0, 10, 1},
+	{4498, 6322, 1, 6, 1},
+	{4504, 0, 0, 7, 1},
+	{4511, 0, 0, 7, 1},
+	{4518, 0, 0, 4, 1},
+	{4522, 0, 0, 9, 1},
+	{4531, 0, 0, 5, 1},
+	{4536, 0, 0, 3, 1},
+	{3545, 0, 0, 3, 1},
+	{2491, 6323, 1, 3, 1},
+	{112, 6324, 15, 2, 1},
+	{4539, 0, 0, 6, 1},
+	{4545, 6339, 3, 5, 1},
+	{4550, 0, 0, 5, 1},
+	{4555, 0, 0, 6, 1},
+	{4561, 0, 0, 4, 1},
+	{885, 6342, 10, 2, 1},
+	{4565, 0, 0, 4, 1},
+	{865, 6352, 40, 2, 1},
+	{4569, 0, 0, 5, 1},
+	{4574, 0, 0, 4, 1},
+	{4578, 6392, 10, 3, 1},
+	{1960, 6402, 7, 2, 1},
+	{4581, 0, 0, 3, 1},
+	{4584, 0, 0, 6, 1},
+	{88, 6409, 8, 2, 1},
+	{4590, 0, 0, 8, 1},
+	{4598, 0, 0, 4, 1},
+	{4602, 0, 0, 6, 1},
+	{4608, 0, 0, 6, 1},
+	{2185, 0, 0, 4, 1},
+	{4614, 0, 0, 5, 1},
+	{4619, 0, 0, 8, 1},
+	{4627, 0, 0, 7, 1},
+	{4634, 0, 0, 7, 1},
+	{4641, 0, 0, 15, 1},
+	{4656, 0, 0, 6, 1},
+	{327, 0, 0, 3, 1},
+	{4662, 0, 0, 4, 1},
+	{371, 0, 0, 3, 1},
+	{4666, 0, 0, 4, 1},
+	{4670, 0, 0, 4, 1},
+	{539, 6417, 5, 2, 1},
+	{4674, 0, 0, 3, 1},
+	{871, 0, 0, 3, 1},
+	{796, 6422, 5, 2, 1},
+	{982, 0, 0, 3, 1},
+	{4677, 0, 0, 3, 1},
+	{4680, 0, 0, 10, 1},
+	{4690, 0, 0, 7, 1},
+	{4697, 0, 0, 12, 1},
+	{4709, 0, 0, 6, 1},
+	{4715, 0, 0, 6, 1},
+	{4721, 0, 0, 7, 1},
+	{4728, 6427, 1, 7, 1},
+	{4735, 6428, 2, 4, 1},
+	{373, 6430, 8, 2, 1},
+	{558, 6438, 47, 2, 1},
+	{4739, 0, 0, 6, 1},
+	{4745, 0, 0, 4, 1},
+	{4749, 0, 0, 6, 1},
+	{4755, 0, 0, 8, 1},
+	{4763, 0, 0, 4, 1},
+	{4767, 0, 0, 6, 1},
+	{4773, 0, 0, 5, 1},
+	{4778, 6485, 1, 8, 1},
+	{1911, 0, 0, 5, 1},
+	{4786, 0, 0, 3, 1},
+	{1917, 0, 0, 3, 1},
+	{4789, 0, 0, 4, 1},
+	{2219, 0, 0, 3, 1},
+	{2311, 6486, 8, 2, 1},
+	{1014, 6494, 11, 2, 1},
+	{4793, 0, 0, 9, 1},
+	{4802, 0, 0, 5, 1},
+	{4807, 0, 0, 4, 1},
+	{4811, 0, 0, 5, 1},
+	{4816, 0, 0, 4, 1},
+	{4820, 0, 0, 7, 1},
+	{4827, 0, 0, 5, 1},
+	{4832, 6505, 3, 4, 1},
+	{4836, 0, 0, 8, 1},
+	{4844, 0, 0, 6, 1},
+	{4850, 0, 0, 4, 1},
+	{4854, 0, 0, 8, 1},
+	{377, 6508, 3, 2, 1},
+	{4862, 0, 0, 4, 1},
+	{4866, 0, 0, 4, 1},
+	{4870, 0, 0, 7, 1},
+	{4877, 6511, 17, 4, 1},
+	{2999, 0, 0, 2, 1},
+	{566, 6528, 1, 2, 1},
+	{3100, 0, 0, 3, 1},
+	{4881, 0, 0, 4, 1},
+	{4885, 0, 0, 3, 1},
+	{4888, 0, 0, 5, 1},
+	{3242, 6529, 5, 2, 1},
+	{4893, 0, 0, 5, 1},
+	{2928, 0, 0, 2, 1},
+	{4898, 0, 0, 5, 1},
+	{4903, 0, 0, 5, 1},
+	{3822, 6534, 8, 2, 1},
+	{4908, 0, 0, 4, 1},
+	{382, 6542, 7, 2, 1},
+	{4912, 0, 0, 6, 1},
+	{4918, 0, 0, 6, 1},
+	{4924, 0, 0, 8, 1},
+	{4932, 0, 0, 8, 1},
+	{4940, 0, 0, 4, 1},
+	{4944, 0, 0, 5, 1},
+	{4949, 6549, 1, 9, 1},
+	{4958, 0, 0, 4, 1},
+	{4962, 0, 0, 4, 1},
+	{4966, 0, 0, 3, 1},
+	{1944, 0, 0, 3, 1},
+	{1944, 6550, 3, 5, 1},
+	{4969, 0, 0, 5, 1},
+	{4974, 0, 0, 4, 1},
+	{4407, 0, 0, 2, 1},
+	{4978, 0, 0, 3, 1},
+	{252, 6553, 8, 2, 1},
+	{210, 6561, 12, 2, 1},
+	{4981, 0, 0, 5, 1},
+	{4986, 0, 0, 7, 1},
+	{3812, 0, 0, 4, 1},
+	{4993, 0, 0, 9, 1},
+	{5002, 0, 0, 9, 1},
+	{1280, 0, 0, 3, 1},
+	{5011, 0, 0, 8, 1},
+	{5019, 0, 0, 9, 1},
+	{5028, 0, 0, 7, 1},
+	{5035, 6573, 3, 5, 1},
+	{5040, 0, 0, 6, 1},
+	{5046, 0, 0, 6, 1},
+	{5052, 0, 0, 5, 1},
+	{3332, 0, 0, 5, 1},
+	{1348, 6576, 52, 2, 1},
+	{5057, 0, 0, 5, 1},
+	{5062, 0, 0, 8, 1},
+	{5070, 0, 0, 6, 1},
+	{5076, 6628, 1, 7, 1},
+	{5083, 0, 0, 4, 1},
+	{5087, 0, 0, 7, 1},
+	{5094, 0, 0, 6, 1},
+	{4566, 6629, 5, 2, 1},
+	{5100, 0, 0, 6, 1},
+	{5106, 0, 0, 5, 1},
+	{5111, 6634, 1, 2, 1},
+	{3384, 6635, 6, 2, 1},
+	{5113, 0, 0, 6, 1},
+	{5119, 6641, 1, 7, 1},
+	{5126, 6642, 3, 2, 1},
+	{21, 0, 0, 3, 1},
+	{5128, 0, 0, 6, 1},
+	{5134, 0, 0, 4, 1},
+	{5138, 0, 0, 6, 1},
+	{5144, 0, 0, 6, 1},
+	{5150, 0, 0, 10, 1},
+	{5160, 0, 0, 5, 1},
+	{5165, 0, 0, 6, 1},
+	{5171, 0, 0, 3, 1},
+	{5174, 0, 0, 4, 1},
+	{1024, 6645, 3, 2, 1},
+	{5178, 0, 0, 3, 1},
+	{1618, 6648, 1, 2, 1},
+	{5181, 0, 0, 3, 1},
+	{5184, 6649, 2, 4, 1},
+	{5188, 0, 0, 4, 1},
+	{5192, 6651, 1, 10, 1},
+	{167, 0, 0, 3, 1},
+	{5202, 0, 0, 7, 1},
+	{5209, 0, 0, 6, 1},
+	{5215, 0, 0, 4, 1},
+	{1999, 6652, 1, 2, 1},
+	{2354, 0, 0, 2, 1},
+	{11, 6653, 9, 2, 1},
+	{2565, 0, 0, 3, 1},
+	{5219, 0, 0, 7, 1},
+	{5226, 0, 0, 7, 1},
+	{5233, 0, 0, 4, 1},
+	{5237, 0, 0, 7, 1},
+	{5244, 0, 0, 6, 1},
+	{5250, 0, 0, 7, 1},
+	{5257, 0, 0, 4, 1},
+	{5261, 0, 0, 5, 1},
+	{5266, 0, 0, 5, 1},
+	{2972, 6662, 15, 2, 1},
+	{5271, 0, 0, 6, 1},
+	{5277, 0, 0, 3, 1},
+	{5280, 0, 0, 2, 1},
+	{5282, 0, 0, 6, 1},
+	{625, 6677, 1, 2, 1},
+	{322, 6678, 8, 2, 1},
+	{5288, 0, 0, 5, 1},
+	{116, 6686, 14, 2, 1},
+	{94, 6700, 12, 2, 1},
+	{5293, 6712, 1, 5, 1},
+	{5298, 0, 0, 5, 1},
+	{5303, 0, 0, 5, 1},
+	{4130, 6713, 2, 3, 1},
+	{5308, 0, 0, 5, 1},
+	{5313, 0, 0, 7, 1},
+	{5320, 0, 0, 5, 1},
+	{5325, 0, 0, 5, 1},
+	{950, 0, 0, 4, 1},
+	{5330, 0, 0, 6, 1},
+	{5336, 0, 0, 4, 1},
+	{1337, 6715, 22, 2, 1},
+	{5340, 6737, 1, 5, 1},
+	{5345, 0, 0, 7, 1},
+	{5352, 0, 0, 8, 1},
+	{5360, 0, 0, 6, 1},
+	{5366, 0, 0, 13, 1},
+	{5379, 0, 0, 9, 1},
+	{5388, 0, 0, 18, 1},
+	{5406, 0, 0, 5, 1},
+	{5411, 0, 0, 3, 1},
+	{20, 6738, 17, 2, 1},
+	{5414, 0, 0, 4, 1},
+	{2899, 0, 0, 3, 1},
+	{5418, 0, 0, 5, 1},
+	{5423, 0, 0, 5, 1},
+	{1751, 6755, 4, 2, 1},
+	{5428, 0, 0, 3, 1},
+	{2160, 6759, 15, 2, 1},
+	{2970, 6774, 12, 2, 1},
+	{310, 6786, 83, 2, 1},
+	{5431, 0, 0, 5, 1},
+	{4625, 0, 0, 3, 1},
+	{2512, 6869, 9, 2, 1},
+	{3142, 6878, 23, 2, 1},
+	{5436, 0, 0, 6, 1},
+	{5442, 0, 0, 10, 1},
+	{5452, 0, 0, 3, 1},
+	{5455, 0, 0, 3, 1},
+	{5017, 0, 0, 3, 1},
+	{154, 6901, 73, 2, 1},
+	{644, 6974, 6, 2, 1},
+	{896, 6980, 4, 2, 1},
+	{595, 0, 0, 2, 1},
+	{5458, 0, 0, 9, 1},
+	{5467, 0, 0, 4, 1},
+	{5471, 0, 0, 8, 1},
+	{1509, 6984, 8, 2, 1},
+	{1590, 6992, 20, 2, 1},
+	{5479, 0, 0, 5, 1},
+	{5484, 0, 0, 8, 1},
+	{5492, 0, 0, 8, 1},
+	{5500, 0, 0, 12, 1},
+	{5512, 0, 0, 3, 1},
+	{2458, 7012, 1, 2, 1},
+	{25, 7013, 5, 2, 1},
+	{5515, 0, 0, 6, 1},
+	{5521, 0, 0, 5, 1},
+	{5526, 0, 0, 3, 1},
+	{5529, 0, 0, 6, 1},
+	{5535, 0, 0, 6, 1},
+	{920, 0, 0, 3, 1},
+	{5541, 0, 0, 3, 1},
+	{5544, 0, 0, 6, 1},
+	{5550, 0, 0, 4, 1},
+	{1903, 0, 0, 6, 1},
+	{5554, 0, 0, 4, 1},
+	{5558, 0, 0, 4, 1},
+	{5562, 0, 0, 10, 1},
+	{3920, 7018, 13, 2, 1},
+	{5572, 0, 0, 5, 1},
+	{5577, 0, 0, 10, 1},
+	{5587, 0, 0, 5, 1},
+	{5592, 0, 0, 4, 1},
+	{5596, 0, 0, 6, 1},
+	{5602, 0, 0, 4, 1},
+	{5606, 0, 0, 6, 1},
+	{5612, 7031, 8, 2, 1},
+	{5614, 0, 0, 6, 1},
+	{5620, 0, 0, 5, 1},
+	{5625, 0, 0, 7, 1},
+	{5632, 0, 0, 6, 1},
+	{5638, 0, 0, 4, 1},
+	{5642, 0, 0, 7, 1},
+	{5101, 0, 0, 5, 1},
+	{5649, 0, 0, 7, 1},
+	{5656, 0, 0, 7, 1},
+	{5663, 0, 0, 14, 1},
+	{5677, 0, 0, 6, 1},
+	{5683, 0, 0, 5, 1},
+	{5688, 7039, 1, 7, 1},
+	{5695, 0, 0, 7, 1},
+	{5702, 0, 0, 5, 1},
+	{5707, 0, 0, 4, 1},
+	{5711, 7040, 2, 2, 1},
+	{5713, 0, 0, 7, 1},
+	{5720, 0, 0, 4, 1},
+	{5724, 7042, 1, 4, 1},
+	{5728, 0, 0, 11, 1},
+	{1961, 0, 0, 3, 1},
+	{5739, 0, 0, 7, 1},
+	{5746, 0, 0, 4, 1},
+	{5750, 0, 0, 7, 1},
+	{5757, 0, 0, 3, 1},
+	{5760, 0, 0, 13, 1},
+	{5773, 0, 0, 8, 1},
+	{2161, 0, 0, 4, 1},
+	{5781, 0, 0, 5, 1},
+	{5786, 0, 0, 5, 1},
+	{5791, 0, 0, 3, 1},
+	{462, 7043, 9, 2, 1},
+	{5794, 0, 0, 3, 1},
+	{5797, 0, 0, 3, 1},
+	{5800, 0, 0, 4, 1},
+	{5804, 0, 0, 5, 1},
+	{5809, 0, 0, 7, 1},
+	{5816, 0, 0, 6, 1},
+	{5822, 0, 0, 3, 1},
+	{5825, 0, 0, 11, 1},
+	{5836, 0, 0, 11, 1},
+	{5847, 0, 0, 11, 1},
+	{5858, 0, 0, 11, 1},
+	{5869, 0, 0, 10, 1},
+	{5879, 0, 0, 11, 1},
+	{5890, 0, 0, 11, 1},
+	{5901, 0, 0, 12, 1},
+	{5913, 0, 0, 11, 1},
+	{5924, 0, 0, 10, 1},
+	{5934, 0, 0, 11, 1},
+	{5945, 0, 0, 12, 1},
+	{5957, 0, 0, 11, 1},
+	{5968, 0, 0, 10, 1},
+	{5978, 7052, 4, 12, 1},
+	{5990, 0, 0, 10, 1},
+	{6000, 0, 0, 14, 1},
+	{6014, 0, 0, 11, 1},
+	{6025, 0, 0, 10, 1},
+	{6035, 0, 0, 17, 1},
+	{6052, 0, 0, 10, 1},
+	{6062, 0, 0, 11, 1},
+	{6073, 0, 0, 14, 1},
+	{6087, 0, 0, 12, 1},
+	{6099, 0, 0, 11, 1},
+	{6110, 0, 0, 14, 1},
+	{6124, 0, 0, 12, 1},
+	{6136, 0, 0, 10, 1},
+	{6146, 0, 0, 12, 1},
+	{6158, 7056, 6, 10, 1},
+	{6168, 0, 0, 8, 1},
+	{6176, 0, 0, 9, 1},
+	{6185, 0, 0, 10, 1},
+	{6195, 0, 0, 10, 1},
+	{6205, 0, 0, 11, 1},
+	{6216, 0, 0, 14, 1},
+	{6230, 0, 0, 17, 1},
+	{6247, 0, 0, 9, 1},
+	{6256, 0, 0, 10, 1},
+	{6266, 0, 0, 11, 1},
+	{6277, 0, 0, 13, 1},
+	{6290, 0, 0, 10, 1},
+	{6300, 0, 0, 22, 1},
+	{6322, 0, 0, 11, 1},
+	{6333, 0, 0, 10, 1},
+	{6343, 0, 0, 10, 1},
+	{6353, 0, 0, 11, 1},
+	{6364, 0, 0, 9, 1},
+	{6373, 0, 0, 9, 1},
+	{6382, 0, 0, 13, 1},
+	{6395, 0, 0, 11, 1},
+	{6406, 0, 0, 11, 1},
+	{6417, 0, 0, 9, 1},
+	{6426, 0, 0, 14, 1},
+	{6440, 0, 0, 10, 1},
+	{6450, 0, 0, 10, 1},
+	{6460, 0, 0, 10, 1},
+	{6470, 0, 0, 11, 1},
+	{6481, 0, 0, 11, 1},
+	{6492, 0, 0, 13, 1},
+	{6505, 0, 0, 13, 1},
+	{6518, 0, 0, 16, 1},
+	{6534, 0, 0, 11, 1},
+	{6545, 0, 0, 12, 1},
+	{6557, 0, 0, 11, 1},
+	{6568, 0, 0, 11, 1},
+	{6579, 0, 0, 14, 1},
+	{6593, 0, 0, 11, 1},
+	{6604, 0, 0, 13, 1},
+	{6617, 0, 0, 11, 1},
+	{6628, 0, 0, 15, 1},
+	{6643, 0, 0, 11, 1},
+	{6654, 0, 0, 10, 1},
+	{6664, 0, 0, 9, 1},
+	{6673, 0, 0, 9, 1},
+	{6682, 7062, 6, 11, 1},
+	{6693, 0, 0, 14, 1},
+	{6707, 0, 0, 11, 1},
+	{6718, 0, 0, 15, 1},
+	{6733, 0, 0, 11, 1},
+	{6744, 0, 0, 11, 1},
+	{6755, 0, 0, 10, 1},
+	{6765, 0, 0, 9, 1},
+	{6774, 0, 0, 15, 1},
+	{6789, 0, 0, 12, 1},
+	{6801, 0, 0, 12, 1},
+	{6813, 0, 0, 14, 1},
+	{6827, 0, 0, 15, 1},
+	{6842, 0, 0, 14, 1},
+	{6856, 0, 0, 16, 1},
+	{6872, 0, 0, 15, 1},
+	{6887, 0, 0, 14, 1},
+	{6901, 0, 0, 12, 1},
+	{6913, 0, 0, 17, 1},
+	{6930, 0, 0, 18, 1},
+	{6948, 0, 0, 17, 1},
+	{6965, 0, 0, 14, 1},
+	{6979, 0, 0, 11, 1},
+	{6990, 0, 0, 14, 1},
+	{7004, 0, 0, 15, 1},
+	{7019, 0, 0, 14, 1},
+	{7033, 0, 0, 16, 1},
+	{7049, 0, 0, 19, 1},
+	{7068, 0, 0, 17, 1},
+	{7085, 0, 0, 12, 1},
+	{7097, 0, 0, 14, 1},
+	{7111, 0, 0, 12, 1},
+	{7123, 0, 0, 19, 1},
+	{7142, 0, 0, 16, 1},
+	{7158, 0, 0, 12, 1},
+	{7170, 0, 0, 12, 1},
+	{7182, 0, 0, 11, 1},
+	{7193, 0, 0, 14, 1},
+	{7207, 0, 0, 11, 1},
+	{7218, 0, 0, 11, 1},
+	{7229, 0, 0, 12, 1},
+	{7241, 0, 0, 10, 1},
+	{7251, 0, 0, 12, 1},
+	{7263, 0, 0, 12, 1},
+	{7275, 0, 0, 9, 1},
+	{7284, 0, 0, 11, 1},
+	{7295, 0, 0, 8, 1},
+	{7303, 0, 0, 9, 1},
+	{7312, 0, 0, 15, 1},
+	{7327, 0, 0, 11, 1},
+	{7338, 7068, 6, 10, 1},
+	{7348, 0, 0, 12, 1},
+	{7360, 0, 0, 11, 1},
+	{7371, 7074, 10, 9, 1},
+	{7380, 0, 0, 8, 1},
+	{7388, 0, 0, 11, 1},
+	{7399, 0, 0, 10, 1},
+	{7409, 0, 0, 10, 1},
+	{7419, 0, 0, 11, 1},
+	{7430, 0, 0, 12, 1},
+	{7442, 0, 0, 9, 1},
+	{7451, 0, 0, 8, 1},
+	{7459, 0, 0, 11, 1},
+	{7470, 0, 0, 11, 1},
+	{7481, 0, 0, 14, 1},
+	{7495, 0, 0, 11, 1},
+	{7506, 0, 0, 11, 1},
+	{7517, 0, 0, 11, 1},
+	{7528, 0, 0, 9, 1},
+	{7537, 0, 0, 13, 1},
+	{7550, 0, 0, 10, 1},
+	{7560, 0, 0, 23, 1},
+	{7583, 0, 0, 24, 1},
+	{7607, 0, 0, 9, 1},
+	{7616, 0, 0, 11, 1},
+	{7627, 0, 0, 20, 1},
+	{7647, 0, 0, 11, 1},
+	{7658, 0, 0, 10, 1},
+	{7668, 0, 0, 10, 1},
+	{7678, 0, 0, 11, 1},
+	{7689, 0, 0, 16, 1},
+	{7705, 0, 0, 17, 1},
+	{7722, 0, 0, 10, 1},
+	{7732, 0, 0, 13, 1},
+	{7745, 0, 0, 13, 1},
+	{7758, 0, 0, 11, 1},
+	{7769, 0, 0, 3, 1},
+	{7772, 7084, 5, 3, 1},
+	{7775, 0, 0, 6, 1},
+	{7781, 0, 0, 5, 1},
+	{7786, 0, 0, 7, 1},
+	{7793, 0, 0, 6, 1},
+	{583, 7089, 6, 2, 1},
+	{7799, 0, 0, 9, 1},
+	{7808, 0, 0, 4, 1},
+	{7812, 0, 0, 8, 1},
+	{1520, 0, 0, 3, 1},
+	{7820, 0, 0, 7, 1},
+	{295, 7095, 1, 2, 1},
+	{2783, 0, 0, 3, 1},
+	{206, 7096, 18, 2, 0},
+	{7827, 0, 0, 6, 1},
+	{7833, 0, 0, 4, 1},
+	{7837, 0, 0, 4, 1},
+	{7841, 0, 0, 3, 1},
+	{6058, 7114, 11, 2, 1},
+	{7844, 7125, 4, 4, 1},
+	{7848, 0, 0, 7, 1},
+	{7855, 7129, 5, 2, 1},
+	{1272, 0, 0, 3, 1},
+	{7857, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{264, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{7860, 0, 0, 8, 1},
+	{7868, 0, 0, 3, 1},
+	{50, 0, 0, 2, 1},
+	{7871, 0, 0, 8, 1},
+	{70, 0, 0, 2, 1},
+	{2456, 0, 0, 3, 1},
+	{264, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{796, 0, 0, 3, 1},
+	{7879, 0, 0, 22, 1},
+	{7901, 0, 0, 19, 1},
+	{7920, 0, 0, 9, 1},
+	{7929, 0, 0, 8, 1},
+	{7937, 0, 0, 9, 1},
+	{7946, 0, 0, 6, 1},
+	{7952, 0, 0, 16, 1},
+	{7968, 0, 0, 19, 1},
+	{7987, 0, 0, 8, 1},
+	{7995, 0, 0, 7, 1},
+	{8002, 0, 0, 7, 1},
+	{8009, 0, 0, 10, 1},
+	{8019, 0, 0, 9, 1},
+	{8028, 0, 0, 9, 1},
+	{8037, 0, 0, 11, 1},
+	{437, 0, 0, 6, 1},
+	{8048, 0, 0, 10, 1},
+	{851, 0, 0, 6, 1},
+	{128, 0, 0, 3, 1},
+	{8058, 0, 0, 5, 1},
+	{1025, 0, 0, 8, 1},
+	{8063, 0, 0, 13, 1},
+	{8076, 0, 0, 12, 1},
+	{8088, 0, 0, 7, 1},
+	{8095, 0, 0, 13, 1},
+	{1229, 0, 0, 4, 1},
+	{8108, 0, 0, 10, 1},
+	{8118, 0, 0, 10, 1},
+	{1345, 0, 0, 10, 1},
+	{7980, 0, 0, 7, 1},
+	{8128, 0, 0, 7, 1},
+	{8135, 0, 0, 4, 1},
+	{1636, 0, 0, 6, 1},
+	{8139, 0, 0, 4, 1},
+	{8143, 0, 0, 8, 1},
+	{8151, 0, 0, 9, 1},
+	{1824, 0, 0, 6, 1},
+	{1824, 0, 0, 8, 1},
+	{8160, 0, 0, 13, 1},
+	{1859, 0, 0, 9, 1},
+	{1918, 0, 0, 8, 1},
+	{247, 0, 0, 7, 1},
+	{8173, 0, 0, 10, 1},
+	{2120, 0, 0, 6, 1},
+	{8183, 0, 0, 4, 1},
+	{8187, 0, 0, 7, 1},
+	{8194, 0, 0, 10, 1},
+	{8204, 0, 0, 14, 1},
+	{2502, 0, 0, 5, 1},
+	{8218, 0, 0, 11, 1},
+	{8229, 0, 0, 9, 1},
+	{2869, 0, 0, 9, 1},
+	{8238, 0, 0, 7, 1},
+	{8245, 0, 0, 10, 1},
+	{8255, 0, 0, 7, 1},
+	{3065, 0, 0, 9, 1},
+	{8262, 0, 0, 8, 1},
+	{8270, 0, 0, 11, 1},
+	{3581, 0, 0, 5, 1},
+	{8281, 0, 0, 10, 1},
+	{8291, 0, 0, 9, 1},
+	{8300, 0, 0, 10, 1},
+	{8310, 0, 0, 11, 1},
+	{8321, 0, 0, 11, 1},
+	{8332, 0, 0, 21, 1},
+	{8353, 0, 0, 5, 1},
+	{249, 0, 0, 5, 1},
+	{4277, 0, 0, 10, 1},
+	{8358, 0, 0, 10, 1},
+	{8368, 0, 0, 7, 1},
+	{250, 0, 0, 3, 1},
+	{8375, 0, 0, 8, 1},
+	{8383, 0, 0, 10, 1},
+	{4602, 0, 0, 6, 1},
+	{8393, 0, 0, 9, 1},
+	{4778, 0, 0, 8, 1},
+	{4850, 0, 0, 4, 1},
+	{8402, 0, 0, 9, 1},
+	{4932, 0, 0, 8, 1},
+	{8411, 0, 0, 7, 1},
+	{8418, 0, 0, 6, 1},
+	{5345, 0, 0, 7, 1},
+	{8424, 0, 0, 7, 1},
+	{1463, 0, 0, 5, 1},
+	{8431, 0, 0, 12, 1},
+	{5781, 0, 0, 5, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{70, 0, 0, 2, 1},
+	{1272, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{7868, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{1272, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{1253, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{8443, 0, 0, 3, 1},
+	{7871, 0, 0, 8, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{264, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{7871, 0, 0, 8, 1},
+	{70, 0, 0, 2, 1},
+	{1272, 0, 0, 3, 1},
+	{8446, 0, 0, 7, 1},
+	{8453, 0, 0, 4, 1},
+	{2158, 0, 0, 3, 1},
+	{8457, 0, 0, 4, 1},
+	{2343, 0, 0, 3, 1},
+	{4369, 0, 0, 5, 1},
+	{70, 0, 0, 2, 1},
+	{1238, 0, 0, 2, 1},
+	{5511, 0, 0, 2, 1},
+	{957, 0, 0, 2, 1},
+	{37, 0, 0, 2, 1},
+	{8370, 0, 0, 2, 1},
+	{8461, 0, 0, 5, 2},
+	{8466, 0, 0, 10, 1},
+	{8476, 0, 0, 5, 1},
+	{8481, 0, 0, 10, 1},
+	{8491, 0, 0, 4, 1},
+	{8495, 0, 0, 9, 2},
+	{8504, 0, 0, 9, 1},
+	{8513, 0, 0, 11, 1},
+	{8524, 0, 0, 4, 1},
+	{8528, 0, 0, 7, 1},
+	{8535, 0, 0, 6, 1},
+	{8541, 0, 0, 6, 1},
+	{8547, 0, 0, 9, 1},
+	{8556, 0, 0, 8, 1},
+	{8564, 0, 0, 7, 1},
+	{8571, 0, 0, 4, 1},
+	{8575, 0, 0, 10, 2},
+	{8585, 0, 0, 14, 1},
+	{8599, 0, 0, 12, 1},
+	{8611, 0, 0, 9, 1},
+	{4578, 7134, 1, 3, 1},
+	{8620, 7135, 1, 9, 1},
+	{8629, 0, 0, 9, 1},
+	{8638, 0, 0, 7, 1},
+	{8645, 0, 0, 9, 1},
+	{8654, 0, 0, 6, 1},
+	{5677, 0, 0, 3, 1},
+	{8660, 0, 0, 5, 1},
+	{646, 0, 0, 3, 1},
+	{1272, 7136, 1, 3, 1},
+	{1398, 0, 0, 4, 1},
+	{1795, 0, 0, 3, 1},
+	{680, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{1110, 0, 0, 3, 1},
+	{264, 0, 0, 3, 1},
+	{8665, 0, 0, 6, 1},
+	{3766, 0, 0, 6, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{8671, 0, 0, 6, 1},
+	{64, 0, 0, 3, 1},
+	{8677, 0, 0, 4, 1},
+	{8681, 0, 0, 7, 1},
+	{8688, 0, 0, 3, 1},
+	{2922, 0, 0, 4, 1},
+	{4758, 0, 0, 3, 1},
+	{2265, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{8691, 0, 0, 7, 1},
+	{8698, 0, 0, 11, 1},
+	{8709, 0, 0, 4, 1},
+	{8713, 0, 0, 3, 1},
+	{8716, 0, 0, 5, 1},
+	{50, 7137, 1, 2, 1},
+	{685, 0, 0, 3, 1},
+	{70, 7138, 1, 2, 1},
+	{8721, 7139, 1, 9, 0},
+	{8730, 7140, 2, 9, 2},
+	{8739, 0, 0, 13, 1},
+	{8752, 0, 0, 13, 1},
+	{5511, 0, 0, 2, 1},
+	{2856, 0, 0, 4, 1},
+	{8765, 0, 0, 9, 1},
+	{8774, 0, 0, 12, 1},
+	{95, 0, 0, 2, 1},
+	{8786, 7142, 2, 8, 0},
+	{8794, 0, 0, 4, 1},
+	{92, 0, 0, 3, 1},
+	{8798, 0, 0, 3, 1},
+	{1272, 7144, 3, 3, 1},
+	{8108, 0, 0, 4, 1},
+	{1795, 7147, 9, 3, 1},
+	{2456, 7156, 5, 3, 1},
+	{305, 0, 0, 2, 1},
+	{2856, 0, 0, 4, 1},
+	{2158, 0, 0, 3, 1},
+	{8801, 0, 0, 3, 1},
+	{63, 0, 0, 2, 1},
+	{2343, 0, 0, 3, 1},
+	{7840, 0, 0, 2, 1},
+	{8804, 0, 0, 3, 1},
+	{88, 0, 0, 2, 1},
+	{8036, 0, 0, 3, 1},
+	{4781, 0, 0, 3, 1},
+	{460, 0, 0, 2, 1},
+	{1272, 0, 0, 3, 1},
+	{605, 0, 0, 2, 1},
+	{1022, 0, 0, 3, 1},
+	{251, 0, 0, 2, 1},
+	{1897, 0, 0, 2, 1},
+	{2340, 0, 0, 2, 1},
+	{354, 0, 0, 2, 1},
+	{154, 0, 0, 2, 1},
+	{4791, 0, 0, 2, 1},
+	{685, 0, 0, 3, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2856, 0, 0, 4, 1},
+	{1110, 0, 0, 3, 1},
+	{264, 0, 0, 3, 1},
+	{238, 0, 0, 4, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{329, 0, 0, 2, 1},
+	{3079, 0, 0, 3, 1},
+	{7871, 0, 0, 8, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{264, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{885, 0, 0, 2, 1},
+	{430, 0, 0, 3, 1},
+	{205, 0, 0, 2, 1},
+	{685, 0, 0, 3, 1},
+	{70, 0, 0, 2, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2856, 0, 0, 4, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{5035, 0, 0, 5, 1},
+	{1751, 0, 0, 2, 1},
+	{8807, 0, 0, 10, 1},
+	{50, 0, 0, 2, 1},
+	{7871, 0, 0, 8, 1},
+	{8817, 7161, 1, 18, 0},
+	{8835, 7162, 1, 8, 0},
+	{8774, 0, 0, 12, 1},
+	{8843, 0, 0, 8, 2},
+	{8851, 0, 0, 10, 1},
+	{2456, 0, 0, 3, 1},
+	{5874, 0, 0, 1, 1},
+	{5829, 0, 0, 1, 1},
+	{5843, 0, 0, 1, 1},
+	{5834, 0, 0, 1, 1},
+	{5832, 0, 0, 1, 1},
+	{5950, 0, 0, 1, 1},
+	{6047, 0, 0, 1, 1},
+	{5877, 0, 0, 1, 1},
+	{5932, 0, 0, 1, 1},
+	{5867, 0, 0, 1, 1},
+	{0, 0, 0, 1, 1},
+	{8, 0, 0, 1, 1},
+	{8861, 0, 0, 5, 1},
+	{7871, 0, 0, 8, 1},
+	{30, 0, 0, 1, 1},
+	{40, 0, 0, 1, 1},
+	{27, 0, 0, 1, 1},
+	{120, 0, 0, 1, 1},
+	{38, 0, 0, 1, 1},
+	{12, 0, 0, 1, 1},
+	{26, 0, 0, 1, 1},
+	{689, 0, 0, 1, 1},
+	{135, 0, 0, 1, 1},
+	{33, 0, 0, 1, 1},
+	{57, 0, 0, 1, 1},
+	{63, 0, 0, 1, 1},
+	{19, 0, 0, 1, 1},
+	{6, 0, 0, 1, 1},
+	{309, 0, 0, 1, 1},
+	{5, 0, 0, 1, 1},
+	{88, 0, 0, 1, 1},
+	{11, 0, 0, 1, 1},
+	{44, 0, 0, 1, 1},
+	{25, 0, 0, 1, 1},
+	{460, 0, 0, 1, 1},
+	{248, 0, 0, 1, 1},
+	{58, 0, 0, 1, 1},
+	{206, 0, 0, 1, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{70, 0, 0, 2, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{95, 0, 0, 2, 1},
+	{2343, 0, 0, 3, 1},
+	{8866, 0, 0, 11, 1},
+	{8691, 0, 0, 7, 1},
+	{8877, 0, 0, 7, 1},
+	{8884, 0, 0, 6, 1},
+	{8890, 0, 0, 10, 1},
+	{8900, 0, 0, 8, 1},
+	{8908, 0, 0, 8, 1},
+	{8916, 0, 0, 7, 1},
+	{8923, 0, 0, 4, 1},
+	{8927, 0, 0, 6, 1},
+	{8933, 0, 0, 5, 1},
+	{8938, 0, 0, 5, 1},
+	{8943, 0, 0, 3, 1},
+	{8946, 0, 0, 6, 1},
+	{8952, 0, 0, 6, 1},
+	{124, 0, 0, 6, 1},
+	{8958, 0, 0, 4, 1},
+	{8962, 0, 0, 11, 1},
+	{8973, 0, 0, 5, 1},
+	{8978, 0, 0, 7, 1},
+	{7871, 0, 0, 8, 1},
+	{70, 0, 0, 2, 1},
+	{1272, 0, 0, 3, 1},
+	{1257, 0, 0, 3, 1},
+	{8985, 0, 0, 5, 1},
+	{1795, 0, 0, 3, 1},
+	{2856, 0, 0, 4, 1},
+	{8990, 0, 0, 7, 1},
+	{3690, 0, 0, 5, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{2740, 0, 0, 3, 1},
+	{4488, 0, 0, 10, 1},
+	{2074, 0, 0, 5, 1},
+	{8997, 0, 0, 7, 1},
+	{5442, 0, 0, 4, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{70, 0, 0, 2, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{9004, 0, 0, 8, 1},
+	{8958, 0, 0, 4, 1},
+	{366, 0, 0, 4, 1},
+	{717, 0, 0, 4, 1},
+	{9012, 0, 0, 7, 1},
+	{9019, 0, 0, 7, 1},
+	{1272, 0, 0, 3, 1},
+	{9026, 0, 0, 11, 1},
+	{9037, 0, 0, 10, 1},
+	{9047, 0, 0, 7, 1},
+	{9054, 0, 0, 8, 1},
+	{9062, 0, 0, 8, 1},
+	{1795, 0, 0, 3, 1},
+	{9070, 0, 0, 7, 1},
+	{680, 0, 0, 3, 1},
+	{9077, 0, 0, 8, 1},
+	{9085, 0, 0, 9, 1},
+	{2856, 0, 0, 4, 1},
+	{1110, 0, 0, 3, 1},
+	{9094, 0, 0, 8, 1},
+	{264, 0, 0, 3, 1},
+	{9102, 0, 0, 10, 1},
+	{8665, 0, 0, 6, 1},
+	{9112, 0, 0, 7, 1},
+	{2158, 0, 0, 3, 1},
+	{9119, 0, 0, 6, 1},
+	{9125, 0, 0, 8, 1},
+	{2343, 0, 0, 3, 1},
+	{9133, 0, 0, 6, 1},
+	{9139, 0, 0, 13, 1},
+	{9152, 0, 0, 8, 1},
+	{9160, 0, 0, 11, 1},
+	{9171, 0, 0, 6, 1},
+	{9177, 0, 0, 7, 1},
+	{9184, 0, 0, 5, 1},
+	{9189, 0, 0, 10, 1},
+	{9199, 0, 0, 5, 1},
+	{9204, 0, 0, 10, 1},
+	{1751, 0, 0, 2, 1},
+	{5677, 0, 0, 3, 1},
+	{5724, 0, 0, 4, 1},
+	{9214, 0, 0, 6, 1},
+	{28, 0, 0, 3, 1},
+	{9220, 0, 0, 3, 1},
+	{9223, 0, 0, 3, 1},
+	{8958, 0, 0, 3, 1},
+	{9226, 0, 0, 3, 1},
+	{231, 0, 0, 2, 1},
+	{9229, 0, 0, 5, 1},
+	{9234, 0, 0, 9, 1},
+	{328, 0, 0, 3, 1},
+	{9243, 0, 0, 3, 1},
+	{9, 0, 0, 3, 1},
+	{5319, 0, 0, 3, 1},
+	{8, 0, 0, 1, 1},
+	{9246, 0, 0, 7, 1},
+	{9253, 0, 0, 5, 1},
+	{9258, 0, 0, 3, 1},
+	{661, 0, 0, 3, 1},
+	{682, 0, 0, 3, 1},
+	{717, 0, 0, 4, 1},
+	{9261, 0, 0, 3, 1},
+	{9264, 0, 0, 8, 1},
+	{872, 0, 0, 3, 1},
+	{9272, 0, 0, 13, 1},
+	{9285, 0, 0, 8, 1},
+	{9293, 0, 0, 6, 1},
+	{9299, 0, 0, 3, 1},
+	{9302, 0, 0, 3, 1},
+	{9305, 0, 0, 3, 1},
+	{1272, 7163, 3, 3, 1},
+	{9308, 0, 0, 8, 1},
+	{1398, 0, 0, 4, 1},
+	{9316, 0, 0, 3, 1},
+	{1468, 0, 0, 3, 1},
+	{9319, 0, 0, 6, 1},
+	{9325, 0, 0, 8, 1},
+	{9333, 0, 0, 3, 1},
+	{827, 0, 0, 3, 1},
+	{5343, 0, 0, 3, 1},
+	{1642, 0, 0, 3, 1},
+	{9190, 0, 0, 3, 1},
+	{1257, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{9070, 0, 0, 3, 1},
+	{9336, 0, 0, 3, 1},
+	{1824, 0, 0, 3, 1},
+	{4171, 0, 0, 3, 1},
+	{1473, 0, 0, 3, 1},
+	{1889, 0, 0, 3, 1},
+	{178, 0, 0, 3, 1},
+	{9339, 0, 0, 5, 1},
+	{9344, 0, 0, 4, 1},
+	{9348, 0, 0, 7, 1},
+	{2148, 0, 0, 2, 1},
+	{9355, 0, 0, 3, 1},
+	{9358, 0, 0, 6, 1},
+	{9364, 0, 0, 3, 1},
+	{9367, 0, 0, 3, 1},
+	{9370, 0, 0, 3, 1},
+	{9373, 0, 0, 3, 1},
+	{2341, 0, 0, 3, 1},
+	{9376, 0, 0, 3, 1},
+	{9379, 0, 0, 7, 1},
+	{2456, 7166, 27, 3, 1},
+	{9386, 0, 0, 3, 1},
+	{9389, 0, 0, 3, 1},
+	{1962, 0, 0, 3, 1},
+	{2848, 0, 0, 3, 1},
+	{9392, 0, 0, 3, 1},
+	{9395, 0, 0, 5, 1},
+	{9400, 0, 0, 3, 1},
+	{9403, 0, 0, 9, 1},
+	{9412, 0, 0, 3, 1},
+	{9415, 0, 0, 3, 1},
+	{1261, 7193, 27, 3, 1},
+	{3248, 0, 0, 3, 1},
+	{718, 0, 0, 3, 1},
+	{9418, 0, 0, 8, 1},
+	{9426, 0, 0, 6, 1},
+	{9432, 0, 0, 6, 1},
+	{9438, 0, 0, 6, 1},
+	{9444, 0, 0, 7, 1},
+	{2817, 0, 0, 3, 1},
+	{1237, 0, 0, 3, 1},
+	{264, 0, 0, 3, 1},
+	{9451, 0, 0, 6, 1},
+	{939, 0, 0, 2, 1},
+	{3755, 0, 0, 3, 1},
+	{9457, 0, 0, 5, 1},
+	{2158, 0, 0, 3, 1},
+	{9462, 0, 0, 7, 1},
+	{7868, 0, 0, 3, 2},
+	{9125, 0, 0, 3, 1},
+	{1364, 0, 0, 3, 1},
+	{7800, 0, 0, 3, 1},
+	{3982, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{9469, 0, 0, 6, 1},
+	{9475, 0, 0, 6, 1},
+	{9481, 0, 0, 3, 1},
+	{9484, 0, 0, 3, 1},
+	{3079, 0, 0, 3, 1},
+	{9487, 0, 0, 3, 1},
+	{9490, 0, 0, 3, 1},
+	{9493, 0, 0, 3, 1},
+	{9496, 0, 0, 3, 1},
+	{4369, 0, 0, 5, 1},
+	{985, 0, 0, 3, 1},
+	{9499, 0, 0, 6, 1},
+	{496, 0, 0, 3, 1},
+	{9505, 0, 0, 8, 1},
+	{3545, 0, 0, 3, 1},
+	{9513, 0, 0, 9, 1},
+	{9522, 0, 0, 8, 1},
+	{9530, 0, 0, 8, 1},
+	{9538, 0, 0, 5, 1},
+	{9543, 0, 0, 10, 1},
+	{9553, 0, 0, 10, 1},
+	{9563, 0, 0, 11, 1},
+	{9574, 0, 0, 8, 1},
+	{9582, 0, 0, 3, 1},
+	{9585, 0, 0, 3, 1},
+	{3302, 0, 0, 3, 1},
+	{9588, 0, 0, 3, 1},
+	{9591, 0, 0, 8, 1},
+	{9599, 0, 0, 3, 1},
+	{5174, 0, 0, 4, 1},
+	{1024, 0, 0, 2, 1},
+	{4319, 0, 0, 3, 1},
+	{9602, 0, 0, 3, 1},
+	{860, 0, 0, 3, 1},
+	{9605, 0, 0, 3, 1},
+	{9608, 0, 0, 3, 1},
+	{64, 0, 0, 3, 1},
+	{1751, 0, 0, 2, 1},
+	{415, 0, 0, 3, 1},
+	{5512, 0, 0, 3, 1},
+	{9611, 0, 0, 3, 1},
+	{9614, 0, 0, 4, 1},
+	{5724, 0, 0, 4, 1},
+	{9618, 0, 0, 3, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{2141, 0, 0, 2, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{9621, 0, 0, 9, 1},
+	{70, 0, 0, 2, 1},
+	{70, 0, 0, 2, 1},
+	{2343, 0, 0, 3, 1},
+	{1272, 7220, 1, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{9630, 0, 0, 9, 1},
+	{264, 0, 0, 3, 1},
+	{9639, 0, 0, 7, 1},
+	{770, 0, 0, 2, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{9584, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{206, 0, 0, 2, 1},
+	{7, 0, 0, 2, 1},
+	{9646, 0, 0, 5, 2},
+	{8861, 0, 0, 5, 1},
+	{29, 0, 0, 2, 1},
+	{7871, 0, 0, 8, 1},
+	{70, 0, 0, 2, 1},
+	{1032, 0, 0, 2, 1},
+	{725, 0, 0, 2, 1},
+	{8774, 0, 0, 12, 1},
+	{586, 0, 0, 2, 1},
+	{261, 0, 0, 2, 1},
+	{1740, 0, 0, 2, 1},
+	{8938, 0, 0, 5, 1},
+	{554, 0, 0, 2, 1},
+	{63, 0, 0, 2, 1},
+	{3613, 0, 0, 2, 1},
+	{237, 0, 0, 2, 1},
+	{948, 0, 0, 2, 1},
+	{7434, 0, 0, 2, 1},
+	{566, 0, 0, 2, 1},
+	{3177, 0, 0, 2, 1},
+	{9651, 7221, 1, 4, 0},
+	{8691, 0, 0, 7, 1},
+	{9655, 0, 0, 3, 1},
+	{9658, 0, 0, 13, 1},
+	{9671, 0, 0, 9, 1},
+	{9680, 0, 0, 11, 1},
+	{9691, 0, 0, 8, 1},
+	{9699, 0, 0, 9, 1},
+	{9708, 7222, 1, 5, 0},
+	{9713, 0, 0, 6, 1},
+	{2456, 0, 0, 3, 1},
+	{7871, 0, 0, 8, 1},
+	{8807, 0, 0, 10, 1},
+	{8709, 0, 0, 4, 1},
+	{8713, 0, 0, 3, 1},
+	{8716, 0, 0, 5, 1},
+	{7871, 0, 0, 8, 1},
+	{9719, 0, 0, 7, 1},
+	{9726, 7223, 1, 7, 2},
+	{2138, 7224, 2, 4, 0},
+	{9733, 0, 0, 6, 1},
+	{8765, 0, 0, 9, 1},
+	{9739, 0, 0, 14, 1},
+	{8774, 0, 0, 12, 1},
+	{9753, 0, 0, 7, 1},
+	{50, 0, 0, 2, 1},
+	{380, 0, 0, 4, 1},
+	{70, 0, 0, 2, 1},
+	{1272, 0, 0, 3, 1},
+	{1238, 0, 0, 2, 1},
+	{1795, 0, 0, 3, 1},
+	{201, 0, 0, 3, 1},
+	{680, 0, 0, 2, 1},
+	{9760, 0, 0, 4, 1},
+	{1110, 0, 0, 3, 1},
+	{1710, 0, 0, 2, 1},
+	{2158, 0, 0, 3, 1},
+	{1740, 0, 0, 2, 1},
+	{95, 0, 0, 2, 1},
+	{2343, 0, 0, 3, 1},
+	{9764, 0, 0, 6, 1},
+	{9770, 0, 0, 15, 1},
+	{9785, 0, 0, 3, 4},
+	{7871, 0, 0, 8, 1},
+	{70, 0, 0, 2, 1},
+	{680, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{264, 0, 0, 3, 1},
+	{9788, 7226, 1, 7, 0},
+	{9795, 0, 0, 6, 2},
+	{9801, 0, 0, 6, 1},
+	{9807, 0, 0, 9, 1},
+	{9816, 7227, 1, 7, 0},
+	{9823, 7228, 1, 8, 0},
+	{9831, 0, 0, 4, 1},
+	{9835, 7229, 2, 10, 0},
+	{9845, 0, 0, 8, 1},
+	{9853, 7231, 1, 7, 1},
+	{8835, 0, 0, 8, 1},
+	{9739, 0, 0, 8, 1},
+	{9860, 0, 0, 11, 2},
+	{9871, 0, 0, 10, 2},
+	{9881, 7232, 2, 3, 1},
+	{9884, 0, 0, 9, 1},
+	{9893, 7234, 1, 8, 1},
+	{9901, 0, 0, 7, 1},
+	{9908, 7235, 3, 7, 0},
+	{9915, 7238, 8, 3, 0},
+	{9918, 0, 0, 10, 2},
+	{9928, 0, 0, 7, 2},
+	{9935, 0, 0, 11, 1},
+	{9946, 7246, 2, 12, 0},
+	{9958, 0, 0, 5, 1},
+	{9963, 0, 0, 5, 1},
+	{9968, 0, 0, 9, 1},
+	{8861, 0, 0, 5, 1},
+	{8691, 0, 0, 7, 1},
+	{9831, 0, 0, 4, 1},
+	{70, 0, 0, 2, 1},
+	{1272, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{50, 0, 0, 2, 1},
+	{2711, 0, 0, 2, 1},
+	{688, 0, 0, 2, 1},
+	{9977, 0, 0, 10, 1},
+	{1272, 7248, 1, 3, 1},
+	{4357, 0, 0, 2, 1},
+	{1795, 0, 0, 3, 1},
+	{2110, 0, 0, 2, 1},
+	{1551, 0, 0, 2, 1},
+	{2456, 0, 0, 3, 1},
+	{2507, 0, 0, 2, 1},
+	{5900, 0, 0, 2, 1},
+	{9617, 0, 0, 2, 1},
+	{12, 0, 0, 2, 1},
+	{654, 0, 0, 2, 1},
+	{861, 0, 0, 2, 1},
+	{360, 0, 0, 2, 1},
+	{2645, 0, 0, 2, 1},
+	{392, 0, 0, 2, 1},
+	{2652, 0, 0, 2, 1},
+	{9987, 0, 0, 12, 1},
+	{2983, 0, 0, 2, 1},
+	{9999, 0, 0, 2, 1},
+	{5278, 0, 0, 2, 1},
+	{3134, 0, 0, 2, 1},
+	{264, 0, 0, 3, 1},
+	{1613, 0, 0, 2, 1},
+	{2158, 0, 0, 3, 1},
+	{3495, 0, 0, 2, 1},
+	{3238, 0, 0, 2, 1},
+	{2343, 0, 0, 3, 1},
+	{10001, 0, 0, 2, 1},
+	{10003, 7249, 1, 12, 0},
+	{796, 0, 0, 2, 1},
+	{373, 0, 0, 2, 1},
+	{1014, 0, 0, 2, 1},
+	{3822, 0, 0, 2, 1},
+	{5111, 0, 0, 2, 1},
+	{2972, 0, 0, 2, 1},
+	{2160, 0, 0, 2, 1},
+	{10015, 0, 0, 2, 1},
+	{6025, 0, 0, 10, 1},
+	{6654, 0, 0, 10, 1},
+	{10017, 0, 0, 10, 1},
+	{10027, 0, 0, 2, 1},
+	{3791, 0, 0, 2, 1},
+	{10029, 0, 0, 2, 1},
+	{4074, 0, 0, 4, 1},
+	{10031, 0, 0, 5, 1},
+	{1272, 7250, 1, 3, 1},
+	{10036, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{10039, 7251, 1, 16, 1},
+	{2081, 0, 0, 4, 1},
+	{2456, 0, 0, 3, 1},
+	{2856, 0, 0, 4, 1},
+	{1110, 0, 0, 3, 1},
+	{10055, 0, 0, 9, 1},
+	{10064, 0, 0, 6, 1},
+	{264, 0, 0, 3, 1},
+	{10070, 0, 0, 4, 1},
+	{10074, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{7868, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{10077, 0, 0, 4, 2},
+	{985, 0, 0, 3, 1},
+	{10049, 7252, 1, 4, 1},
+	{10081, 0, 0, 8, 1},
+	{5677, 0, 0, 3, 1},
+	{10089, 0, 0, 3, 2},
+	{10092, 0, 0, 6, 1},
+	{10098, 0, 0, 4, 2},
+	{10102, 0, 0, 5, 1},
+	{10107, 0, 0, 10, 1},
+	{10117, 0, 0, 2, 1},
+	{10119, 7253, 1, 13, 1},
+	{124, 0, 0, 6, 1},
+	{10132, 0, 0, 10, 1},
+	{10142, 0, 0, 13, 1},
+	{10155, 0, 0, 10, 1},
+	{10165, 0, 0, 17, 1},
+	{10182, 7254, 50, 9, 0},
+	{10191, 0, 0, 10, 1},
+	{10201, 0, 0, 8, 1},
+	{10209, 0, 0, 8, 1},
+	{10217, 0, 0, 14, 1},
+	{10231, 0, 0, 19, 1},
+	{10250, 7304, 1, 7, 1},
+	{4, 0, 0, 2, 1},
+	{10257, 0, 0, 16, 1},
+	{10273, 0, 0, 12, 1},
+	{10285, 0, 0, 20, 1},
+	{10305, 0, 0, 7, 1},
+	{10312, 0, 0, 14, 1},
+	{10326, 0, 0, 11, 1},
+	{10337, 0, 0, 11, 1},
+	{10348, 0, 0, 10, 1},
+	{10358, 0, 0, 7, 1},
+	{7871, 0, 0, 8, 1},
+	{10365, 0, 0, 8, 1},
+	{10373, 0, 0, 7, 1},
+	{10380, 7305, 2, 11, 1},
+	{10391, 0, 0, 6, 1},
+	{10397, 0, 0, 7, 1},
+	{822, 0, 0, 2, 1},
+	{10404, 0, 0, 13, 1},
+	{10417, 0, 0, 5, 1},
+	{9977, 0, 0, 10, 1},
+	{10422, 0, 0, 7, 1},
+	{10429, 0, 0, 7, 1},
+	{10436, 0, 0, 10, 1},
+	{10446, 0, 0, 12, 1},
+	{10458, 0, 0, 15, 1},
+	{10473, 0, 0, 15, 1},
+	{10488, 0, 0, 15, 1},
+	{601, 0, 0, 2, 1},
+	{70, 0, 0, 2, 1},
+	{1247, 7307, 3, 4, 0},
+	{10503, 0, 0, 8, 1},
+	{10511, 7310, 3, 12, 2},
+	{10523, 0, 0, 10, 1},
+	{10533, 7313, 2, 10, 0},
+	{10543, 0, 0, 10, 1},
+	{10553, 0, 0, 10, 1},
+	{10563, 0, 0, 8, 1},
+	{10571, 0, 0, 5, 1},
+	{10576, 0, 0, 8, 1},
+	{10584, 0, 0, 8, 1},
+	{10592, 0, 0, 8, 1},
+	{10600, 0, 0, 8, 1},
+	{55, 0, 0, 2, 1},
+	{10608, 0, 0, 15, 1},
+	{10623, 0, 0, 13, 2},
+	{10636, 0, 0, 18, 2},
+	{10654, 0, 0, 11, 1},
+	{10665, 0, 0, 10, 1},
+	{10675, 0, 0, 11, 1},
+	{10686, 0, 0, 8, 1},
+	{10694, 0, 0, 7, 1},
+	{10701, 0, 0, 10, 1},
+	{10711, 0, 0, 11, 1},
+	{10722, 0, 0, 9, 1},
+	{10731, 0, 0, 7, 1},
+	{10738, 0, 0, 6, 1},
+	{10744, 0, 0, 8, 1},
+	{10752, 0, 0, 12, 1},
+	{10764, 0, 0, 7, 1},
+	{10771, 0, 0, 10, 1},
+	{10781, 0, 0, 8, 1},
+	{10789, 0, 0, 14, 1},
+	{10803, 0, 0, 14, 1},
+	{10817, 0, 0, 11, 1},
+	{10828, 0, 0, 11, 1},
+	{10839, 0, 0, 11, 1},
+	{10850, 0, 0, 9, 1},
+	{10859, 0, 0, 11, 1},
+	{10870, 0, 0, 13, 1},
+	{10883, 0, 0, 11, 1},
+	{10894, 0, 0, 13, 1},
+	{10907, 0, 0, 13, 1},
+	{10920, 0, 0, 10, 1},
+	{10930, 0, 0, 11, 1},
+	{10941, 0, 0, 11, 1},
+	{10952, 0, 0, 5, 1},
+	{10957, 7315, 17, 16, 1},
+	{10973, 0, 0, 9, 1},
+	{10982, 0, 0, 15, 1},
+	{10997, 0, 0, 15, 1},
+	{11012, 0, 0, 13, 1},
+	{11025, 0, 0, 16, 1},
+	{1897, 0, 0, 2, 1},
+	{11041, 7332, 8, 8, 0},
+	{11049, 0, 0, 8, 1},
+	{11057, 0, 0, 11, 1},
+	{11068, 0, 0, 16, 1},
+	{11084, 0, 0, 14, 1},
+	{11098, 7340, 1, 5, 0},
+	{11103, 0, 0, 11, 1},
+	{11114, 0, 0, 16, 1},
+	{11130, 0, 0, 5, 1},
+	{11135, 0, 0, 11, 1},
+	{11146, 0, 0, 12, 1},
+	{11158, 0, 0, 10, 1},
+	{11168, 0, 0, 9, 1},
+	{11177, 0, 0, 8, 1},
+	{11185, 0, 0, 7, 1},
+	{11192, 0, 0, 7, 1},
+	{11199, 0, 0, 7, 1},
+	{11206, 0, 0, 7, 1},
+	{11213, 0, 0, 7, 1},
+	{11220, 0, 0, 7, 1},
+	{11227, 0, 0, 7, 1},
+	{11234, 0, 0, 7, 1},
+	{11241, 0, 0, 7, 1},
+	{11248, 0, 0, 7, 1},
+	{11255, 0, 0, 7, 1},
+	{11262, 0, 0, 7, 1},
+	{11269, 0, 0, 7, 1},
+	{11276, 0, 0, 7, 1},
+	{11283, 0, 0, 7, 1},
+	{11290, 0, 0, 7, 1},
+	{11297, 0, 0, 7, 1},
+	{11304, 0, 0, 7, 1},
+	{11311, 0, 0, 7, 1},
+	{11318, 0, 0, 7, 1},
+	{11325, 0, 0, 7, 1},
+	{11332, 0, 0, 7, 1},
+	{11339, 0, 0, 7, 1},
+	{11346, 0, 0, 7, 1},
+	{11353, 0, 0, 7, 1},
+	{11360, 0, 0, 7, 1},
+	{11367, 0, 0, 7, 1},
+	{11374, 0, 0, 7, 1},
+	{11381, 0, 0, 7, 1},
+	{11388, 0, 0, 7, 1},
+	{11395, 0, 0, 7, 1},
+	{11402, 0, 0, 7, 1},
+	{11409, 0, 0, 7, 1},
+	{11416, 0, 0, 7, 1},
+	{11423, 0, 0, 7, 1},
+	{11430, 0, 0, 7, 1},
+	{11437, 0, 0, 7, 1},
+	{11444, 0, 0, 7, 1},
+	{11451, 0, 0, 7, 1},
+	{11458, 0, 0, 7, 1},
+	{11465, 0, 0, 7, 1},
+	{11472, 0, 0, 7, 1},
+	{11479, 0, 0, 7, 1},
+	{11486, 0, 0, 7, 1},
+	{11493, 0, 0, 7, 1},
+	{11500, 0, 0, 7, 1},
+	{11507, 0, 0, 7, 1},
+	{11514, 0, 0, 10, 1},
+	{11524, 0, 0, 8, 1},
+	{11532, 0, 0, 12, 1},
+	{11544, 0, 0, 7, 1},
+	{11551, 0, 0, 5, 1},
+	{11556, 0, 0, 17, 1},
+	{11573, 0, 0, 6, 1},
+	{11579, 0, 0, 10, 1},
+	{11589, 0, 0, 10, 1},
+	{9733, 0, 0, 6, 1},
+	{11599, 0, 0, 11, 1},
+	{1582, 0, 0, 2, 1},
+	{11610, 0, 0, 17, 1},
+	{11627, 0, 0, 9, 1},
+	{11636, 0, 0, 9, 1},
+	{11645, 0, 0, 6, 1},
+	{2645, 0, 0, 2, 1},
+	{11651, 0, 0, 10, 1},
+	{11661, 0, 0, 9, 1},
+	{11670, 0, 0, 15, 1},
+	{11685, 0, 0, 14, 1},
+	{11699, 0, 0, 8, 1},
+	{11707, 7341, 1, 18, 0},
+	{11725, 0, 0, 8, 1},
+	{11733, 7342, 2, 7, 0},
+	{11740, 0, 0, 15, 1},
+	{1131, 0, 0, 2, 1},
+	{11755, 0, 0, 9, 1},
+	{11764, 7344, 2, 9, 0},
+	{11773, 0, 0, 9, 1},
+	{11782, 0, 0, 12, 1},
+	{11794, 0, 0, 14, 1},
+	{11808, 0, 0, 12, 1},
+	{11820, 0, 0, 15, 1},
+	{11835, 0, 0, 14, 1},
+	{11849, 0, 0, 12, 1},
+	{11861, 0, 0, 9, 1},
+	{11870, 0, 0, 17, 1},
+	{11887, 0, 0, 8, 1},
+	{11895, 0, 0, 18, 1},
+	{11913, 0, 0, 13, 1},
+	{11926, 0, 0, 13, 1},
+	{11939, 0, 0, 11, 1},
+	{11950, 0, 0, 21, 1},
+	{11971, 0, 0, 9, 1},
+	{11980, 0, 0, 10, 1},
+	{11990, 0, 0, 9, 1},
+	{11999, 0, 0, 16, 1},
+	{12015, 0, 0, 11, 1},
+	{12026, 0, 0, 15, 1},
+	{12041, 0, 0, 11, 1},
+	{12052, 0, 0, 12, 1},
+	{12064, 0, 0, 16, 1},
+	{12080, 0, 0, 10, 1},
+	{12090, 0, 0, 13, 1},
+	{12103, 0, 0, 14, 1},
+	{12117, 0, 0, 10, 1},
+	{12127, 0, 0, 12, 1},
+	{12139, 0, 0, 20, 1},
+	{12159, 0, 0, 17, 1},
+	{12176, 0, 0, 11, 1},
+	{12187, 0, 0, 15, 1},
+	{12202, 0, 0, 13, 1},
+	{12215, 0, 0, 14, 1},
+	{12229, 0, 0, 12, 1},
+	{12241, 0, 0, 12, 1},
+	{12253, 0, 0, 11, 1},
+	{12264, 0, 0, 14, 1},
+	{12278, 0, 0, 16, 1},
+	{12294, 0, 0, 11, 1},
+	{12305, 0, 0, 13, 1},
+	{12318, 0, 0, 15, 1},
+	{12333, 0, 0, 12, 1},
+	{12345, 0, 0, 14, 1},
+	{12359, 0, 0, 17, 1},
+	{12376, 0, 0, 12, 1},
+	{12388, 0, 0, 7, 1},
+	{12395, 0, 0, 13, 1},
+	{12408, 0, 0, 12, 1},
+	{12420, 0, 0, 16, 1},
+	{12436, 0, 0, 13, 1},
+	{12449, 0, 0, 7, 1},
+	{12456, 0, 0, 16, 1},
+	{12472, 0, 0, 8, 1},
+	{12480, 0, 0, 11, 1},
+	{12491, 0, 0, 15, 1},
+	{12506, 0, 0, 8, 1},
+	{12514, 0, 0, 13, 1},
+	{12527, 0, 0, 16, 1},
+	{957, 0, 0, 2, 1},
+	{12543, 0, 0, 9, 1},
+	{9823, 7346, 1, 8, 0},
+	{12552, 7347, 1, 6, 0},
+	{12558, 0, 0, 3, 1},
+	{12561, 0, 0, 9, 1},
+	{12570, 0, 0, 9, 1},
+	{12579, 0, 0, 5, 1},
+	{2118, 0, 0, 2, 1},
+	{12584, 0, 0, 8, 1},
+	{12592, 0, 0, 9, 1},
+	{12601, 0, 0, 10, 1},
+	{12611, 7348, 2, 6, 0},
+	{12617, 0, 0, 13, 2},
+	{12630, 7350, 1, 17, 0},
+	{12647, 7351, 1, 4, 0},
+	{12651, 0, 0, 6, 1},
+	{12657, 0, 0, 10, 1},
+	{12667, 0, 0, 13, 1},
+	{12680, 7352, 1, 11, 0},
+	{12691, 0, 0, 8, 1},
+	{12699, 0, 0, 11, 1},
+	{12710, 7353, 1, 9, 1},
+	{269, 0, 0, 3, 1},
+	{12719, 0, 0, 10, 1},
+	{12729, 0, 0, 17, 1},
+	{12746, 0, 0, 9, 1},
+	{12755, 0, 0, 7, 1},
+	{12762, 0, 0, 8, 1},
+	{12770, 0, 0, 7, 1},
+	{12777, 0, 0, 8, 1},
+	{10171, 0, 0, 11, 1},
+	{12785, 0, 0, 16, 1},
+	{12801, 0, 0, 12, 1},
+	{12813, 0, 0, 9, 1},
+	{8774, 0, 0, 12, 1},
+	{12822, 0, 0, 7, 1},
+	{12829, 7354, 11, 13, 0},
+	{12842, 0, 0, 8, 1},
+	{12850, 0, 0, 5, 1},
+	{12855, 0, 0, 8, 1},
+	{12863, 0, 0, 10, 1},
+	{12873, 0, 0, 7, 1},
+	{943, 0, 0, 2, 1},
+	{12880, 7365, 1, 11, 0},
+	{12891, 7366, 1, 21, 0},
+	{12912, 0, 0, 10, 1},
+	{12922, 0, 0, 9, 1},
+	{12931, 0, 0, 8, 1},
+	{12939, 0, 0, 9, 1},
+	{12948, 0, 0, 5, 1},
+	{12953, 0, 0, 10, 1},
+	{12963, 0, 0, 7, 1},
+	{12970, 0, 0, 15, 1},
+	{12985, 0, 0, 11, 1},
+	{12996, 0, 0, 12, 1},
+	{13008, 0, 0, 18, 1},
+	{13026, 0, 0, 6, 1},
+	{13032, 0, 0, 8, 2},
+	{13040, 0, 0, 5, 1},
+	{13045, 0, 0, 8, 1},
+	{13053, 0, 0, 11, 1},
+	{13064, 0, 0, 17, 1},
+	{13081, 0, 0, 7, 1},
+	{13088, 0, 0, 10, 1},
+	{13098, 0, 0, 12, 1},
+	{13110, 7367, 1, 5, 0},
+	{13115, 0, 0, 12, 1},
+	{13127, 7368, 1, 14, 1},
+	{13141, 0, 0, 3, 1},
+	{13144, 0, 0, 6, 1},
+	{7434, 0, 0, 2, 1},
+	{13150, 0, 0, 11, 1},
+	{13161, 0, 0, 10, 1},
+	{13171, 0, 0, 12, 2},
+	{13183, 0, 0, 8, 1},
+	{13191, 0, 0, 8, 1},
+	{12933, 7369, 1, 6, 0},
+	{13199, 0, 0, 7, 1},
+	{13206, 0, 0, 14, 1},
+	{13220, 0, 0, 7, 1},
+	{865, 0, 0, 2, 1},
+	{88, 0, 0, 2, 1},
+	{13227, 0, 0, 16, 1},
+	{13243, 0, 0, 7, 1},
+	{13250, 0, 0, 15, 1},
+	{8946, 0, 0, 6, 1},
+	{13265, 0, 0, 14, 1},
+	{13279, 0, 0, 11, 1},
+	{13290, 0, 0, 8, 1},
+	{13298, 0, 0, 9, 1},
+	{13307, 0, 0, 18, 1},
+	{13325, 0, 0, 13, 1},
+	{13338, 0, 0, 8, 1},
+	{13346, 0, 0, 9, 1},
+	{13355, 0, 0, 13, 1},
+	{13368, 0, 0, 9, 1},
+	{13377, 0, 0, 11, 1},
+	{13388, 0, 0, 8, 1},
+	{13396, 0, 0, 8, 1},
+	{13404, 0, 0, 8, 1},
+	{13412, 0, 0, 9, 1},
+	{13421, 0, 0, 10, 1},
+	{13431, 0, 0, 12, 1},
+	{13443, 0, 0, 10, 1},
+	{13453, 0, 0, 7, 1},
+	{13460, 0, 0, 10, 1},
+	{13470, 0, 0, 10, 1},
+	{13480, 0, 0, 7, 1},
+	{13487, 0, 0, 10, 1},
+	{13497, 0, 0, 8, 1},
+	{13505, 0, 0, 13, 1},
+	{13518, 0, 0, 17, 1},
+	{13535, 7370, 1, 6, 0},
+	{13541, 0, 0, 12, 1},
+	{13553, 0, 0, 11, 1},
+	{13564, 7371, 1, 10, 0},
+	{13574, 0, 0, 12, 1},
+	{13586, 0, 0, 8, 1},
+	{13594, 0, 0, 9, 1},
+	{13603, 0, 0, 13, 1},
+	{13616, 0, 0, 16, 1},
+	{13632, 0, 0, 12, 1},
+	{13644, 0, 0, 13, 1},
+	{13657, 0, 0, 15, 1},
+	{13672, 7372, 1, 8, 0},
+	{3142, 0, 0, 2, 1},
+	{13680, 0, 0, 13, 1},
+	{154, 0, 0, 2, 1},
+	{644, 0, 0, 2, 1},
+	{13693, 0, 0, 10, 1},
+	{13703, 0, 0, 12, 2},
+	{13715, 7373, 3, 10, 0},
+	{13725, 0, 0, 10, 1},
+	{13735, 7376, 1, 8, 0},
+	{13743, 0, 0, 10, 1},
+	{13753, 0, 0, 11, 1},
+	{13764, 0, 0, 7, 1},
+	{13771, 0, 0, 12, 1},
+	{13783, 0, 0, 12, 1},
+	{13795, 0, 0, 10, 1},
+	{13805, 7377, 1, 15, 1},
+	{13820, 0, 0, 12, 1},
+	{13832, 0, 0, 7, 1},
+	{13839, 0, 0, 14, 1},
+	{13853, 7378, 2, 5, 1},
+	{13858, 0, 0, 8, 1},
+	{206, 0, 0, 2, 1},
+	{13866, 0, 0, 7, 1},
+	{13873, 0, 0, 3, 1},
+	{9901, 0, 0, 7, 1},
+	{55, 0, 0, 2, 1},
+	{9807, 0, 0, 9, 1},
+	{50, 0, 0, 2, 1},
+	{70, 0, 0, 2, 1},
+	{1238, 0, 0, 2, 1},
+	{201, 0, 0, 2, 1},
+	{680, 0, 0, 2, 1},
+	{95, 0, 0, 2, 1},
+	{88, 0, 0, 2, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2848, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{7871, 0, 0, 8, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{1110, 0, 0, 3, 1},
+	{13876, 0, 0, 4, 1},
+	{2343, 0, 0, 3, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{390, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2856, 0, 0, 4, 1},
+	{50, 0, 0, 2, 1},
+	{685, 0, 0, 3, 1},
+	{1272, 7380, 2, 3, 1},
+	{13880, 0, 0, 7, 1},
+	{2456, 0, 0, 3, 1},
+	{3450, 0, 0, 3, 1},
+	{264, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{249, 0, 0, 5, 1},
+	{3079, 0, 0, 3, 1},
+	{322, 0, 0, 2, 1},
+	{7871, 0, 0, 8, 1},
+	{70, 0, 0, 2, 1},
+	{6244, 0, 0, 2, 1},
+	{13887, 7382, 2, 11, 0},
+	{1293, 7384, 1, 4, 0},
+	{13898, 0, 0, 5, 1},
+	{8698, 0, 0, 11, 1},
+	{8709, 0, 0, 4, 1},
+	{8713, 0, 0, 3, 1},
+	{8716, 0, 0, 5, 1},
+	{8861, 0, 0, 5, 1},
+	{7871, 0, 0, 8, 1},
+	{10397, 0, 0, 7, 1},
+	{1272, 0, 0, 3, 1},
+	{13903, 0, 0, 13, 1},
+	{13916, 7385, 1, 7, 0},
+	{13923, 0, 0, 6, 1},
+	{13929, 7386, 2, 5, 1},
+	{13934, 0, 0, 18, 1},
+	{13952, 0, 0, 7, 1},
+	{13959, 0, 0, 10, 1},
+	{13969, 0, 0, 8, 1},
+	{13977, 0, 0, 7, 1},
+	{13984, 0, 0, 10, 1},
+	{13994, 0, 0, 8, 1},
+	{14002, 0, 0, 7, 1},
+	{14009, 0, 0, 15, 1},
+	{14024, 0, 0, 7, 1},
+	{14031, 0, 0, 6, 1},
+	{11114, 0, 0, 16, 1},
+	{14037, 0, 0, 6, 2},
+	{14043, 0, 0, 15, 1},
+	{14058, 0, 0, 9, 1},
+	{12653, 0, 0, 4, 1},
+	{14067, 7388, 1, 14, 1},
+	{14081, 7389, 1, 12, 0},
+	{14093, 0, 0, 9, 1},
+	{14102, 0, 0, 6, 1},
+	{14108, 0, 0, 9, 1},
+	{14117, 0, 0, 6, 1},
+	{14123, 0, 0, 6, 1},
+	{14129, 0, 0, 12, 1},
+	{14141, 0, 0, 11, 1},
+	{14152, 0, 0, 10, 1},
+	{14162, 0, 0, 7, 1},
+	{14169, 0, 0, 10, 1},
+	{14179, 0, 0, 9, 1},
+	{14188, 0, 0, 12, 1},
+	{14200, 0, 0, 10, 1},
+	{14210, 0, 0, 10, 1},
+	{8765, 0, 0, 9, 1},
+	{12651, 0, 0, 6, 1},
+	{14220, 0, 0, 10, 1},
+	{14230, 0, 0, 10, 1},
+	{14240, 0, 0, 10, 1},
+	{14250, 0, 0, 9, 1},
+	{14259, 0, 0, 8, 1},
+	{14267, 0, 0, 6, 1},
+	{14273, 0, 0, 13, 1},
+	{8774, 0, 0, 12, 1},
+	{14286, 0, 0, 14, 1},
+	{14300, 0, 0, 11, 1},
+	{14311, 0, 0, 5, 1},
+	{14316, 7390, 1, 12, 0},
+	{9753, 0, 0, 7, 1},
+	{14328, 0, 0, 9, 1},
+	{14337, 0, 0, 7, 1},
+	{14344, 0, 0, 20, 1},
+	{14364, 0, 0, 11, 1},
+	{14375, 0, 0, 10, 1},
+	{14385, 0, 0, 10, 1},
+	{14395, 0, 0, 13, 1},
+	{14408, 0, 0, 9, 2},
+	{14417, 0, 0, 12, 1},
+	{14429, 0, 0, 11, 1},
+	{14440, 0, 0, 23, 1},
+	{14463, 0, 0, 21, 1},
+	{13296, 0, 0, 3, 1},
+	{14484, 0, 0, 8, 1},
+	{14492, 0, 0, 4, 1},
+	{14496, 0, 0, 4, 1},
+	{14500, 0, 0, 12, 1},
+	{8491, 0, 0, 4, 1},
+	{2145, 0, 0, 3, 1},
+	{11123, 0, 0, 7, 2},
+	{14512, 0, 0, 13, 1},
+	{12722, 0, 0, 5, 1},
+	{14525, 0, 0, 3, 2},
+	{14528, 0, 0, 8, 2},
+	{14536, 7391, 1, 9, 0},
+	{8547, 0, 0, 9, 1},
+	{9630, 0, 0, 9, 1},
+	{10059, 0, 0, 5, 1},
+	{13053, 0, 0, 11, 1},
+	{14545, 0, 0, 2, 1},
+	{14547, 0, 0, 11, 1},
+	{9371, 0, 0, 3, 2},
+	{14558, 0, 0, 8, 2},
+	{8654, 0, 0, 6, 1},
+	{14566, 0, 0, 7, 2},
+	{14573, 0, 0, 7, 1},
+	{14580, 7392, 1, 9, 1},
+	{14589, 0, 0, 13, 1},
+	{685, 0, 0, 3, 1},
+	{7871, 0, 0, 8, 1},
+	{70, 0, 0, 2, 1},
+	{2081, 0, 0, 4, 1},
+	{8774, 0, 0, 12, 1},
+	{6586, 0, 0, 3, 1},
+	{5035, 0, 0, 5, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{9, 0, 0, 3, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{680, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{264, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{14602, 0, 0, 3, 1},
+	{5677, 0, 0, 3, 1},
+	{9, 0, 0, 3, 1},
+	{380, 0, 0, 4, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{3969, 0, 0, 3, 1},
+	{382, 0, 0, 3, 1},
+	{322, 0, 0, 2, 1},
+	{10230, 7393, 1, 5, 2},
+	{556, 0, 0, 4, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{201, 0, 0, 3, 1},
+	{680, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2856, 0, 0, 4, 1},
+	{14605, 0, 0, 3, 1},
+	{1237, 0, 0, 3, 1},
+	{264, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{7860, 0, 0, 8, 1},
+	{2343, 0, 0, 3, 1},
+	{3079, 0, 0, 3, 1},
+	{1090, 7394, 1, 3, 0},
+	{70, 0, 0, 2, 1},
+	{5129, 0, 0, 3, 1},
+	{1272, 7395, 1, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{12384, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{1237, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{1138, 0, 0, 3, 1},
+	{14608, 0, 0, 4, 1},
+	{1272, 7396, 1, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{11702, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{264, 0, 0, 3, 1},
+	{238, 0, 0, 4, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{4728, 0, 0, 3, 1},
+	{14612, 0, 0, 8, 1},
+	{1272, 7397, 1, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{680, 0, 0, 3, 1},
+	{8774, 0, 0, 12, 1},
+	{7868, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{1313, 0, 0, 7, 2},
+	{685, 0, 0, 3, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2856, 0, 0, 4, 1},
+	{238, 0, 0, 4, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{10132, 0, 0, 10, 1},
+	{8861, 0, 0, 5, 1},
+	{8691, 0, 0, 7, 1},
+	{14353, 0, 0, 11, 1},
+	{14620, 7398, 1, 6, 0},
+	{14626, 0, 0, 4, 1},
+	{14311, 0, 0, 5, 1},
+	{8843, 0, 0, 8, 2},
+	{14630, 0, 0, 13, 1},
+	{4078, 7399, 1, 5, 0},
+	{70, 0, 0, 2, 1},
+	{14643, 0, 0, 6, 1},
+	{14649, 0, 0, 3, 1},
+	{14652, 0, 0, 5, 1},
+	{14657, 0, 0, 11, 1},
+	{3222, 0, 0, 5, 1},
+	{7871, 0, 0, 8, 1},
+	{14668, 7400, 1, 13, 0},
+	{14681, 7401, 2, 10, 0},
+	{2414, 0, 0, 2, 1},
+	{5530, 0, 0, 3, 1},
+	{14691, 0, 0, 5, 1},
+	{8774, 0, 0, 12, 1},
+	{14696, 0, 0, 15, 1},
+	{70, 0, 0, 2, 1},
+	{50, 0, 0, 2, 1},
+	{685, 0, 0, 3, 1},
+	{1272, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2856, 0, 0, 4, 1},
+	{264, 0, 0, 3, 1},
+	{238, 0, 0, 4, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{3079, 0, 0, 3, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{4369, 0, 0, 5, 1},
+	{10239, 0, 0, 4, 2},
+	{14711, 0, 0, 10, 1},
+	{14721, 0, 0, 8, 1},
+	{380, 0, 0, 4, 1},
+	{8978, 0, 0, 6, 1},
+	{14729, 0, 0, 6, 1},
+	{7871, 0, 0, 8, 1},
+	{1170, 0, 0, 3, 1},
+	{14735, 0, 0, 9, 1},
+	{14744, 0, 0, 21, 1},
+	{14765, 0, 0, 31, 1},
+	{1272, 0, 0, 3, 1},
+	{14796, 0, 0, 7, 1},
+	{14803, 0, 0, 7, 1},
+	{14810, 0, 0, 18, 1},
+	{14828, 0, 0, 6, 1},
+	{14834, 0, 0, 5, 1},
+	{11158, 0, 0, 10, 1},
+	{11168, 0, 0, 9, 1},
+	{14839, 0, 0, 15, 1},
+	{14854, 0, 0, 7, 1},
+	{9760, 0, 0, 4, 1},
+	{14861, 0, 0, 5, 1},
+	{14866, 0, 0, 16, 1},
+	{14882, 0, 0, 7, 1},
+	{8774, 0, 0, 12, 1},
+	{7868, 0, 0, 3, 1},
+	{14889, 0, 0, 8, 1},
+	{14897, 0, 0, 6, 1},
+	{14903, 0, 0, 10, 1},
+	{4474, 0, 0, 4, 1},
+	{14913, 0, 0, 3, 1},
+	{322, 0, 0, 2, 1},
+	{14916, 0, 0, 11, 1},
+	{14927, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{14930, 0, 0, 4, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{264, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{14934, 0, 0, 3, 1},
+	{70, 0, 0, 2, 1},
+	{143, 0, 0, 3, 1},
+	{14937, 0, 0, 4, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{8508, 7403, 1, 5, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{264, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{3450, 0, 0, 3, 1},
+	{3674, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{685, 0, 0, 3, 1},
+	{70, 0, 0, 2, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{5275, 0, 0, 2, 1},
+	{50, 0, 0, 2, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{1224, 0, 0, 5, 1},
+	{14941, 0, 0, 9, 1},
+	{10239, 0, 0, 11, 2},
+	{328, 0, 0, 3, 1},
+	{380, 0, 0, 4, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2830, 0, 0, 4, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{7871, 0, 0, 8, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{13470, 0, 0, 10, 1},
+	{14950, 0, 0, 9, 1},
+	{717, 0, 0, 4, 1},
+	{1272, 0, 0, 3, 1},
+	{55, 0, 0, 2, 1},
+	{1795, 0, 0, 3, 1},
+	{680, 0, 0, 3, 1},
+	{1962, 0, 0, 3, 1},
+	{264, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{94, 0, 0, 2, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{14959, 0, 0, 4, 1},
+	{2856, 0, 0, 4, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{5677, 0, 0, 3, 1},
+	{605, 0, 0, 2, 1},
+	{70, 0, 0, 2, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{14963, 0, 0, 3, 1},
+	{7871, 0, 0, 8, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{14966, 0, 0, 3, 1},
+	{926, 0, 0, 3, 1},
+	{3450, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{14969, 0, 0, 6, 1},
+	{6025, 0, 0, 10, 1},
+	{14975, 0, 0, 9, 1},
+	{14984, 0, 0, 11, 1},
+	{14995, 0, 0, 10, 1},
+	{6654, 0, 0, 10, 1},
+	{15005, 0, 0, 11, 1},
+	{15016, 0, 0, 10, 1},
+	{7241, 0, 0, 10, 1},
+	{10017, 0, 0, 10, 1},
+	{15026, 0, 0, 11, 1},
+	{15037, 0, 0, 9, 1},
+	{15046, 0, 0, 10, 1},
+	{15056, 0, 0, 11, 1},
+	{15067, 0, 0, 11, 1},
+	{15078, 0, 0, 10, 1},
+	{60, 0, 0, 2, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{680, 0, 0, 3, 1},
+	{264, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{15088, 0, 0, 11, 1},
+	{8504, 0, 0, 9, 1},
+	{11084, 0, 0, 7, 1},
+	{15099, 0, 0, 8, 1},
+	{13360, 0, 0, 4, 1},
+	{9831, 0, 0, 4, 1},
+	{15107, 0, 0, 8, 1},
+	{15115, 0, 0, 6, 1},
+	{10176, 0, 0, 6, 1},
+	{15121, 0, 0, 7, 1},
+	{15128, 0, 0, 7, 1},
+	{15135, 0, 0, 9, 1},
+	{7871, 0, 0, 8, 1},
+	{1272, 0, 0, 3, 1},
+	{2207, 0, 0, 4, 1},
+	{11185, 0, 0, 4, 1},
+	{686, 0, 0, 2, 1},
+	{238, 0, 0, 4, 1},
+	{100, 0, 0, 5, 1},
+	{9, 0, 0, 3, 1},
+	{380, 0, 0, 4, 1},
+	{1272, 0, 0, 3, 1},
+	{1398, 0, 0, 4, 1},
+	{1795, 0, 0, 3, 1},
+	{2081, 0, 0, 4, 1},
+	{9760, 0, 0, 4, 1},
+	{2856, 0, 0, 4, 1},
+	{1237, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{12144, 0, 0, 5, 1},
+	{3969, 0, 0, 3, 1},
+	{3079, 0, 0, 3, 1},
+	{342, 0, 0, 3, 1},
+	{4832, 0, 0, 4, 1},
+	{15144, 0, 0, 4, 1},
+	{15148, 0, 0, 5, 1},
+	{7871, 0, 0, 8, 1},
+	{15153, 0, 0, 4, 1},
+	{1016, 0, 0, 6, 1},
+	{1171, 0, 0, 4, 1},
+	{70, 0, 0, 2, 1},
+	{15157, 0, 0, 7, 1},
+	{15164, 0, 0, 7, 1},
+	{2043, 0, 0, 4, 1},
+	{2189, 0, 0, 5, 1},
+	{2307, 0, 0, 5, 1},
+	{2739, 0, 0, 5, 1},
+	{2856, 0, 0, 4, 1},
+	{15171, 0, 0, 8, 1},
+	{15179, 0, 0, 6, 1},
+	{15185, 0, 0, 8, 1},
+	{15193, 0, 0, 5, 1},
+	{3581, 0, 0, 5, 1},
+	{3819, 0, 0, 4, 1},
+	{2343, 0, 0, 3, 1},
+	{8794, 0, 0, 4, 1},
+	{15198, 0, 0, 6, 1},
+	{1917, 0, 0, 3, 1},
+	{4832, 0, 0, 4, 1},
+	{4969, 0, 0, 5, 1},
+	{15204, 0, 0, 4, 1},
+	{15208, 0, 0, 4, 1},
+	{322, 0, 0, 2, 1},
+	{15212, 0, 0, 6, 1},
+	{15218, 0, 0, 6, 1},
+	{5521, 0, 0, 5, 1},
+	{50, 0, 0, 2, 1},
+	{685, 0, 0, 3, 1},
+	{70, 7404, 1, 2, 1},
+	{15224, 0, 0, 4, 1},
+	{15228, 0, 0, 4, 1},
+	{15232, 0, 0, 5, 1},
+	{680, 0, 0, 2, 1},
+	{264, 0, 0, 3, 1},
+	{57, 7405, 1, 2, 1},
+	{2158, 0, 0, 3, 1},
+	{95, 0, 0, 2, 1},
+	{15237, 0, 0, 6, 1},
+	{796, 0, 0, 3, 1},
+	{5677, 0, 0, 3, 1},
+	{7871, 0, 0, 8, 1},
+	{2456, 0, 0, 3, 1},
+	{8774, 0, 0, 12, 1},
+	{50, 0, 0, 2, 1},
+	{70, 7406, 4, 2, 1},
+	{2456, 0, 0, 3, 1},
+	{11267, 0, 0, 3, 1},
+	{14605, 0, 0, 3, 1},
+	{1293, 0, 0, 4, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{50, 0, 0, 2, 1},
+	{70, 7410, 2, 2, 1},
+	{1272, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{112, 0, 0, 2, 1},
+	{20, 0, 0, 2, 1},
+	{1751, 0, 0, 2, 1},
+	{6060, 0, 0, 2, 1},
+	{7043, 0, 0, 2, 1},
+	{50, 0, 0, 2, 1},
+	{145, 0, 0, 2, 1},
+	{231, 0, 0, 2, 1},
+	{8861, 0, 0, 5, 1},
+	{15243, 0, 0, 5, 1},
+	{685, 0, 0, 3, 1},
+	{7871, 0, 0, 8, 1},
+	{887, 0, 0, 8, 1},
+	{30, 0, 0, 2, 1},
+	{8691, 0, 0, 7, 1},
+	{601, 0, 0, 2, 1},
+	{70, 0, 0, 2, 1},
+	{1272, 0, 0, 3, 1},
+	{1398, 0, 0, 4, 1},
+	{298, 0, 0, 2, 1},
+	{15248, 0, 0, 5, 1},
+	{302, 0, 0, 2, 1},
+	{1795, 0, 0, 3, 1},
+	{111, 0, 0, 2, 1},
+	{2081, 0, 0, 4, 1},
+	{140, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{15253, 0, 0, 7, 1},
+	{1962, 0, 0, 3, 1},
+	{2856, 0, 0, 4, 1},
+	{1110, 0, 0, 3, 1},
+	{14129, 0, 0, 8, 1},
+	{411, 0, 0, 2, 1},
+	{182, 0, 0, 2, 1},
+	{264, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{1142, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{2302, 0, 0, 2, 1},
+	{433, 0, 0, 4, 1},
+	{3079, 0, 0, 3, 1},
+	{250, 0, 0, 3, 1},
+	{10081, 0, 0, 8, 1},
+	{5360, 0, 0, 6, 1},
+	{1751, 0, 0, 2, 1},
+	{3142, 0, 0, 2, 1},
+	{1418, 0, 0, 2, 1},
+	{154, 0, 0, 2, 1},
+	{5677, 0, 0, 3, 1},
+	{15260, 0, 0, 19, 1},
+	{15279, 0, 0, 20, 1},
+	{8861, 0, 0, 5, 1},
+	{8691, 0, 0, 7, 1},
+	{13959, 0, 0, 9, 1},
+	{15299, 0, 0, 6, 1},
+	{15305, 0, 0, 11, 1},
+	{8884, 0, 0, 6, 1},
+	{15316, 0, 0, 7, 1},
+	{15323, 0, 0, 6, 1},
+	{15329, 0, 0, 9, 1},
+	{15338, 0, 0, 10, 1},
+	{15348, 0, 0, 13, 1},
+	{15361, 0, 0, 12, 1},
+	{15373, 0, 0, 10, 1},
+	{15383, 0, 0, 8, 1},
+	{8938, 0, 0, 5, 1},
+	{13960, 0, 0, 8, 1},
+	{8946, 0, 0, 6, 1},
+	{15391, 0, 0, 6, 1},
+	{8952, 0, 0, 6, 1},
+	{1897, 0, 0, 2, 1},
+	{15397, 0, 0, 4, 1},
+	{15401, 0, 0, 6, 1},
+	{15407, 0, 0, 14, 2},
+	{15421, 0, 0, 6, 1},
+	{15427, 0, 0, 12, 1},
+	{15439, 7412, 2, 11, 0},
+	{8861, 0, 0, 5, 1},
+	{15450, 0, 0, 11, 1},
+	{15461, 0, 0, 11, 1},
+	{15472, 7414, 1, 7, 0},
+	{15479, 7415, 1, 10, 0},
+	{15489, 7416, 1, 4, 0},
+	{15493, 0, 0, 9, 1},
+	{15502, 0, 0, 8, 1},
+	{15510, 0, 0, 7, 1},
+	{15517, 0, 0, 17, 1},
+	{15534, 0, 0, 10, 1},
+	{1272, 0, 0, 3, 1},
+	{15544, 7417, 1, 8, 0},
+	{15552, 0, 0, 5, 1},
+	{15557, 0, 0, 8, 1},
+	{15565, 0, 0, 4, 1},
+	{15569, 0, 0, 5, 1},
+	{15574, 0, 0, 7, 1},
+	{15581, 0, 0, 6, 1},
+	{15587, 0, 0, 11, 1},
+	{15598, 7418, 1, 9, 0},
+	{15607, 0, 0, 5, 1},
+	{11556, 0, 0, 6, 1},
+	{15612, 0, 0, 6, 1},
+	{15618, 0, 0, 10, 1},
+	{15628, 0, 0, 12, 1},
+	{15640, 0, 0, 3, 1},
+	{9831, 0, 0, 4, 1},
+	{7986, 7419, 1, 4, 0},
+	{8547, 0, 0, 9, 1},
+	{15643, 0, 0, 7, 1},
+	{15650, 0, 0, 10, 1},
+	{15660, 0, 0, 9, 2},
+	{12095, 0, 0, 8, 1},
+	{15669, 0, 0, 5, 1},
+	{15674, 0, 0, 3, 1},
+	{15677, 7420, 1, 7, 0},
+	{15684, 0, 0, 8, 2},
+	{15692, 0, 0, 6, 2},
+	{15698, 0, 0, 6, 2},
+	{15704, 0, 0, 12, 1},
+	{15716, 0, 0, 8, 1},
+	{15724, 7421, 1, 5, 1},
+	{15729, 7422, 1, 3, 1},
+	{15732, 0, 0, 4, 1},
+	{15736, 0, 0, 11, 1},
+	{15747, 0, 0, 11, 1},
+	{15758, 7423, 1, 12, 0},
+	{15770, 0, 0, 3, 2},
+	{15773, 0, 0, 8, 1},
+	{14547, 0, 0, 11, 1},
+	{15781, 0, 0, 9, 1},
+	{15790, 0, 0, 3, 1},
+	{15793, 0, 0, 8, 1},
+	{15801, 0, 0, 6, 2},
+	{8638, 0, 0, 7, 1},
+	{13603, 7424, 4, 9, 0},
+	{5237, 0, 0, 7, 1},
+	{15807, 7428, 1, 8, 0},
+	{15815, 0, 0, 4, 1},
+	{15819, 0, 0, 7, 1},
+	{15826, 0, 0, 10, 1},
+	{15836, 7429, 1, 8, 0},
+	{15844, 0, 0, 13, 1},
+	{15857, 0, 0, 9, 1},
+	{15866, 0, 0, 8, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{264, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{50, 0, 0, 2, 1},
+	{70, 0, 0, 2, 1},
+	{2456, 0, 0, 3, 1},
+	{305, 0, 0, 2, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{796, 0, 0, 3, 1},
+	{6827, 0, 0, 15, 1},
+	{6842, 0, 0, 14, 1},
+	{7871, 0, 0, 8, 1},
+	{1272, 0, 0, 3, 1},
+	{15874, 0, 0, 7, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{1110, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{15881, 0, 0, 11, 1},
+	{15892, 0, 0, 4, 1},
+	{15896, 0, 0, 4, 1},
+	{15900, 0, 0, 4, 1},
+	{4430, 0, 0, 3, 1},
+	{15904, 0, 0, 7, 1},
+	{130, 0, 0, 2, 1},
+	{15911, 0, 0, 9, 1},
+	{174, 0, 0, 2, 1},
+	{15920, 0, 0, 11, 1},
+	{15931, 0, 0, 10, 1},
+	{15941, 0, 0, 9, 1},
+	{75, 0, 0, 2, 1},
+	{15950, 0, 0, 6, 1},
+	{15956, 0, 0, 21, 1},
+	{15977, 0, 0, 21, 1},
+	{15998, 0, 0, 19, 1},
+	{16017, 0, 0, 19, 1},
+	{313, 0, 0, 2, 1},
+	{16036, 0, 0, 5, 1},
+	{16041, 0, 0, 12, 1},
+	{16053, 0, 0, 11, 1},
+	{16064, 0, 0, 5, 1},
+	{318, 0, 0, 2, 1},
+	{336, 0, 0, 2, 1},
+	{16069, 0, 0, 6, 1},
+	{4, 0, 0, 2, 1},
+	{16075, 0, 0, 6, 1},
+	{16081, 0, 0, 13, 1},
+	{16094, 0, 0, 12, 1},
+	{9826, 0, 0, 4, 1},
+	{212, 0, 0, 2, 1},
+	{452, 0, 0, 2, 1},
+	{16106, 0, 0, 8, 1},
+	{8, 0, 0, 2, 1},
+	{16114, 0, 0, 6, 1},
+	{16120, 0, 0, 15, 1},
+	{16135, 0, 0, 16, 1},
+	{16151, 0, 0, 4, 1},
+	{16155, 0, 0, 21, 1},
+	{16004, 0, 0, 19, 1},
+	{556, 0, 0, 3, 1},
+	{16176, 0, 0, 10, 1},
+	{16186, 0, 0, 7, 1},
+	{16193, 0, 0, 9, 1},
+	{16202, 0, 0, 7, 1},
+	{651, 0, 0, 2, 1},
+	{48, 0, 0, 2, 1},
+	{16209, 0, 0, 6, 1},
+	{32, 0, 0, 2, 1},
+	{7871, 0, 0, 8, 1},
+	{742, 0, 0, 2, 1},
+	{18, 0, 0, 2, 1},
+	{16215, 0, 0, 7, 1},
+	{16222, 0, 0, 7, 1},
+	{16229, 0, 0, 17, 1},
+	{16246, 0, 0, 5, 1},
+	{16251, 0, 0, 14, 1},
+	{16265, 0, 0, 15, 1},
+	{822, 0, 0, 2, 1},
+	{16280, 0, 0, 7, 1},
+	{16287, 0, 0, 8, 1},
+	{872, 0, 0, 2, 1},
+	{591, 0, 0, 2, 1},
+	{16295, 0, 0, 6, 1},
+	{16301, 0, 0, 15, 1},
+	{16316, 0, 0, 16, 1},
+	{901, 0, 0, 2, 1},
+	{30, 0, 0, 2, 1},
+	{16332, 0, 0, 8, 1},
+	{910, 0, 0, 3, 1},
+	{16340, 0, 0, 8, 1},
+	{16348, 0, 0, 13, 1},
+	{928, 0, 0, 3, 1},
+	{16361, 0, 0, 8, 1},
+	{16369, 0, 0, 15, 1},
+	{16384, 0, 0, 14, 1},
+	{16398, 0, 0, 10, 1},
+	{16408, 0, 0, 17, 1},
+	{16425, 0, 0, 16, 1},
+	{16441, 0, 0, 13, 1},
+	{16454, 0, 0, 12, 1},
+	{16466, 0, 0, 7, 1},
+	{16473, 0, 0, 7, 1},
+	{16480, 0, 0, 9, 1},
+	{503, 0, 0, 2, 1},
+	{61, 0, 0, 2, 1},
+	{16489, 0, 0, 12, 1},
+	{16501, 0, 0, 11, 1},
+	{359, 0, 0, 2, 1},
+	{16512, 0, 0, 6, 1},
+	{384, 0, 0, 2, 1},
+	{524, 0, 0, 2, 1},
+	{601, 0, 0, 2, 1},
+	{70, 0, 0, 2, 1},
+	{16518, 0, 0, 4, 1},
+	{16522, 0, 0, 7, 1},
+	{1439, 0, 0, 2, 1},
+	{16529, 0, 0, 7, 1},
+	{16536, 0, 0, 7, 1},
+	{298, 0, 0, 2, 1},
+	{93, 0, 0, 2, 1},
+	{16543, 0, 0, 5, 1},
+	{1523, 0, 0, 2, 1},
+	{16548, 0, 0, 14, 1},
+	{16562, 0, 0, 13, 1},
+	{1795, 0, 0, 3, 1},
+	{16575, 0, 0, 14, 1},
+	{16589, 0, 0, 13, 1},
+	{16602, 0, 0, 3, 1},
+	{62, 0, 0, 2, 1},
+	{16605, 0, 0, 4, 1},
+	{1067, 0, 0, 2, 1},
+	{908, 0, 0, 2, 1},
+	{16609, 0, 0, 5, 1},
+	{16614, 0, 0, 7, 1},
+	{2432, 0, 0, 2, 1},
+	{201, 0, 0, 2, 1},
+	{16621, 0, 0, 7, 1},
+	{16628, 0, 0, 8, 1},
+	{2148, 0, 0, 2, 1},
+	{16636, 0, 0, 6, 1},
+	{16642, 0, 0, 12, 1},
+	{16496, 0, 0, 11, 1},
+	{125, 0, 0, 2, 1},
+	{16654, 0, 0, 15, 1},
+	{16669, 0, 0, 16, 1},
+	{16685, 0, 0, 15, 1},
+	{16700, 0, 0, 21, 1},
+	{16721, 0, 0, 20, 1},
+	{16741, 0, 0, 14, 1},
+	{16755, 0, 0, 14, 1},
+	{16769, 0, 0, 15, 1},
+	{16784, 0, 0, 14, 1},
+	{16798, 0, 0, 20, 1},
+	{16818, 0, 0, 19, 1},
+	{16837, 0, 0, 13, 1},
+	{16850, 0, 0, 9, 1},
+	{16859, 0, 0, 3, 1},
+	{140, 0, 0, 2, 1},
+	{16862, 0, 0, 5, 1},
+	{16867, 0, 0, 6, 1},
+	{680, 0, 0, 2, 1},
+	{16873, 0, 0, 7, 1},
+	{2456, 0, 0, 3, 1},
+	{1582, 0, 0, 2, 1},
+	{16880, 0, 0, 8, 1},
+	{16888, 0, 0, 5, 1},
+	{16893, 0, 0, 17, 1},
+	{16417, 0, 0, 16, 1},
+	{16910, 0, 0, 10, 1},
+	{1186, 0, 0, 2, 1},
+	{16920, 0, 0, 7, 1},
+	{1118, 0, 0, 2, 1},
+	{16927, 0, 0, 7, 1},
+	{2118, 0, 0, 2, 1},
+	{16934, 0, 0, 9, 1},
+	{16943, 0, 0, 7, 1},
+	{16950, 0, 0, 8, 1},
+	{16958, 0, 0, 6, 1},
+	{16964, 0, 0, 3, 1},
+	{16967, 0, 0, 5, 1},
+	{912, 0, 0, 2, 1},
+	{33, 0, 0, 2, 1},
+	{16972, 0, 0, 5, 1},
+	{16977, 0, 0, 5, 1},
+	{186, 0, 0, 2, 1},
+	{2121, 0, 0, 3, 1},
+	{16982, 0, 0, 7, 1},
+	{16989, 0, 0, 7, 1},
+	{517, 0, 0, 2, 1},
+	{16996, 0, 0, 4, 1},
+	{17000, 0, 0, 3, 1},
+	{17003, 0, 0, 9, 1},
+	{17012, 0, 0, 8, 1},
+	{103, 0, 0, 2, 1},
+	{731, 0, 0, 2, 1},
+	{17020, 0, 0, 7, 1},
+	{17027, 0, 0, 5, 1},
+	{17032, 0, 0, 8, 1},
+	{17040, 0, 0, 7, 1},
+	{3520, 0, 0, 3, 1},
+	{17047, 0, 0, 6, 1},
+	{17053, 0, 0, 13, 1},
+	{16449, 0, 0, 12, 1},
+	{17066, 0, 0, 6, 1},
+	{725, 0, 0, 2, 1},
+	{354, 0, 0, 2, 1},
+	{182, 0, 0, 2, 1},
+	{17072, 0, 0, 15, 1},
+	{16379, 0, 0, 14, 1},
+	{17087, 0, 0, 7, 1},
+	{264, 0, 0, 2, 1},
+	{17094, 0, 0, 5, 1},
+	{17099, 0, 0, 6, 1},
+	{3666, 0, 0, 2, 1},
+	{1613, 0, 0, 2, 1},
+	{17105, 0, 0, 6, 1},
+	{3363, 0, 0, 3, 1},
+	{17111, 0, 0, 6, 1},
+	{17117, 0, 0, 5, 1},
+	{17122, 0, 0, 13, 1},
+	{17135, 0, 0, 21, 1},
+	{17156, 0, 0, 12, 1},
+	{17168, 0, 0, 13, 1},
+	{17181, 0, 0, 18, 1},
+	{283, 0, 0, 2, 1},
+	{3747, 0, 0, 2, 1},
+	{8774, 0, 0, 12, 1},
+	{117, 0, 0, 2, 1},
+	{17199, 0, 0, 6, 1},
+	{17205, 0, 0, 6, 1},
+	{17211, 7430, 1, 4, 0},
+	{943, 0, 0, 2, 1},
+	{17215, 0, 0, 6, 1},
+	{3613, 0, 0, 2, 1},
+	{17221, 0, 0, 5, 1},
+	{37, 0, 0, 2, 1},
+	{16553, 0, 0, 9, 1},
+	{17226, 0, 0, 12, 1},
+	{17238, 0, 0, 11, 1},
+	{95, 0, 0, 2, 1},
+	{17249, 0, 0, 8, 1},
+	{19, 0, 0, 2, 1},
+	{6, 0, 0, 2, 1},
+	{17257, 0, 0, 6, 1},
+	{17263, 0, 0, 5, 1},
+	{17268, 0, 0, 7, 1},
+	{17275, 0, 0, 5, 1},
+	{17280, 0, 0, 5, 1},
+	{940, 0, 0, 2, 1},
+	{1713, 0, 0, 2, 1},
+	{948, 0, 0, 2, 1},
+	{17285, 0, 0, 7, 1},
+	{17292, 0, 0, 13, 1},
+	{17305, 0, 0, 12, 1},
+	{17317, 0, 0, 7, 1},
+	{2302, 0, 0, 2, 1},
+	{956, 0, 0, 2, 1},
+	{17324, 0, 0, 8, 1},
+	{17332, 0, 0, 8, 1},
+	{17340, 0, 0, 8, 1},
+	{17348, 0, 0, 4, 1},
+	{17352, 0, 0, 7, 1},
+	{17359, 0, 0, 3, 1},
+	{3156, 0, 0, 2, 1},
+	{433, 0, 0, 2, 1},
+	{17362, 0, 0, 9, 1},
+	{17371, 0, 0, 7, 1},
+	{249, 0, 0, 2, 1},
+	{17378, 0, 0, 5, 1},
+	{4339, 0, 0, 2, 1},
+	{498, 0, 0, 2, 1},
+	{17383, 0, 0, 3, 1},
+	{17386, 0, 0, 6, 1},
+	{5543, 0, 0, 2, 1},
+	{7843, 0, 0, 2, 1},
+	{96, 0, 0, 2, 1},
+	{17392, 0, 0, 6, 1},
+	{17398, 0, 0, 7, 1},
+	{161, 0, 0, 2, 1},
+	{66, 0, 0, 2, 1},
+	{17405, 0, 0, 15, 1},
+	{17420, 0, 0, 13, 1},
+	{17433, 0, 0, 14, 1},
+	{17447, 0, 0, 12, 1},
+	{550, 0, 0, 2, 1},
+	{126, 0, 0, 2, 1},
+	{17459, 0, 0, 5, 1},
+	{17464, 0, 0, 6, 1},
+	{363, 0, 0, 2, 1},
+	{401, 0, 0, 2, 1},
+	{112, 0, 0, 2, 1},
+	{4650, 0, 0, 4, 1},
+	{180, 0, 0, 4, 1},
+	{17470, 0, 0, 6, 1},
+	{88, 0, 0, 2, 1},
+	{17476, 0, 0, 7, 1},
+	{4662, 0, 0, 3, 1},
+	{17483, 0, 0, 8, 1},
+	{17491, 0, 0, 8, 1},
+	{17499, 0, 0, 7, 1},
+	{17506, 0, 0, 6, 1},
+	{377, 0, 0, 2, 1},
+	{1405, 0, 0, 3, 1},
+	{17512, 0, 0, 7, 1},
+	{17519, 0, 0, 6, 1},
+	{17525, 0, 0, 5, 1},
+	{17530, 0, 0, 8, 1},
+	{382, 0, 0, 2, 1},
+	{17538, 0, 0, 7, 1},
+	{432, 0, 0, 2, 1},
+	{4407, 0, 0, 2, 1},
+	{252, 0, 0, 2, 1},
+	{16142, 0, 0, 9, 1},
+	{4566, 0, 0, 2, 1},
+	{17545, 0, 0, 8, 1},
+	{21, 0, 0, 2, 1},
+	{395, 0, 0, 3, 1},
+	{17553, 0, 0, 7, 1},
+	{167, 0, 0, 2, 1},
+	{17560, 0, 0, 12, 1},
+	{17232, 0, 0, 11, 1},
+	{17572, 0, 0, 6, 1},
+	{17578, 0, 0, 5, 1},
+	{2819, 7431, 1, 3, 0},
+	{116, 0, 0, 2, 1},
+	{94, 0, 0, 2, 1},
+	{17583, 0, 0, 6, 1},
+	{449, 0, 0, 3, 1},
+	{17589, 0, 0, 7, 1},
+	{4164, 0, 0, 2, 1},
+	{1337, 0, 0, 2, 1},
+	{17596, 0, 0, 21, 1},
+	{17617, 0, 0, 21, 1},
+	{17638, 0, 0, 19, 1},
+	{17657, 0, 0, 19, 1},
+	{17676, 0, 0, 7, 1},
+	{17683, 0, 0, 17, 1},
+	{17700, 0, 0, 16, 1},
+	{17716, 0, 0, 18, 1},
+	{17734, 0, 0, 17, 1},
+	{17751, 0, 0, 8, 1},
+	{17759, 0, 0, 16, 1},
+	{17775, 0, 0, 15, 1},
+	{17790, 0, 0, 19, 1},
+	{17809, 0, 0, 18, 1},
+	{17827, 0, 0, 16, 1},
+	{17843, 0, 0, 15, 1},
+	{17858, 0, 0, 18, 1},
+	{17876, 0, 0, 17, 1},
+	{17893, 0, 0, 19, 1},
+	{17912, 0, 0, 18, 1},
+	{17930, 0, 0, 15, 1},
+	{17945, 0, 0, 14, 1},
+	{17959, 0, 0, 18, 1},
+	{17977, 0, 0, 17, 1},
+	{17994, 0, 0, 15, 1},
+	{18009, 0, 0, 14, 1},
+	{18023, 0, 0, 17, 1},
+	{18040, 0, 0, 16, 1},
+	{18056, 0, 0, 18, 1},
+	{18074, 0, 0, 17, 1},
+	{18091, 0, 0, 16, 1},
+	{18107, 0, 0, 15, 1},
+	{18122, 0, 0, 17, 1},
+	{18139, 0, 0, 16, 1},
+	{18155, 0, 0, 6, 1},
+	{18161, 0, 0, 7, 1},
+	{18168, 0, 0, 7, 1},
+	{87, 0, 0, 2, 1},
+	{18175, 0, 0, 5, 1},
+	{18180, 0, 0, 7, 1},
+	{1751, 0, 0, 2, 1},
+	{44, 0, 0, 2, 1},
+	{18187, 0, 0, 5, 1},
+	{4221, 0, 0, 3, 1},
+	{18192, 0, 0, 6, 1},
+	{18198, 0, 0, 13, 1},
+	{17299, 0, 0, 12, 1},
+	{595, 0, 0, 2, 1},
+	{18211, 0, 0, 11, 1},
+	{18222, 0, 0, 10, 1},
+	{18232, 0, 0, 10, 1},
+	{18242, 0, 0, 9, 1},
+	{18251, 0, 0, 11, 1},
+	{18262, 0, 0, 13, 1},
+	{18275, 0, 0, 12, 1},
+	{18287, 0, 0, 10, 1},
+	{18297, 0, 0, 12, 1},
+	{18309, 0, 0, 11, 1},
+	{18320, 0, 0, 12, 1},
+	{18332, 0, 0, 14, 1},
+	{18346, 0, 0, 11, 1},
+	{18357, 0, 0, 12, 1},
+	{18369, 0, 0, 3, 1},
+	{18372, 0, 0, 6, 1},
+	{14461, 0, 0, 2, 1},
+	{1509, 0, 0, 2, 1},
+	{18378, 0, 0, 3, 1},
+	{1590, 0, 0, 2, 1},
+	{1913, 0, 0, 3, 1},
+	{18381, 0, 0, 6, 1},
+	{16707, 0, 0, 7, 1},
+	{18387, 0, 0, 6, 1},
+	{18393, 0, 0, 8, 1},
+	{18401, 0, 0, 8, 1},
+	{18409, 0, 0, 6, 1},
+	{25, 0, 0, 2, 1},
+	{18415, 0, 0, 13, 1},
+	{18428, 0, 0, 12, 1},
+	{18440, 0, 0, 7, 1},
+	{18447, 0, 0, 7, 1},
+	{1781, 0, 0, 2, 1},
+	{5429, 0, 0, 2, 1},
+	{5413, 0, 0, 2, 1},
+	{18454, 0, 0, 2, 1},
+	{18456, 0, 0, 22, 1},
+	{18478, 0, 0, 21, 1},
+	{18499, 0, 0, 22, 1},
+	{18521, 0, 0, 19, 1},
+	{18540, 0, 0, 18, 1},
+	{18558, 0, 0, 19, 1},
+	{18577, 0, 0, 18, 1},
+	{18595, 0, 0, 15, 1},
+	{18610, 0, 0, 24, 1},
+	{18634, 0, 0, 23, 1},
+	{18657, 0, 0, 25, 1},
+	{18682, 0, 0, 24, 1},
+	{18706, 0, 0, 24, 1},
+	{18730, 0, 0, 23, 1},
+	{18753, 0, 0, 23, 1},
+	{18776, 0, 0, 22, 1},
+	{18798, 0, 0, 19, 1},
+	{18817, 0, 0, 21, 1},
+	{18838, 0, 0, 18, 1},
+	{18856, 0, 0, 19, 1},
+	{70, 0, 0, 2, 1},
+	{2158, 0, 0, 3, 1},
+	{770, 0, 0, 2, 1},
+	{2343, 0, 0, 3, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{264, 0, 0, 3, 1},
+	{238, 0, 0, 4, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{796, 0, 0, 3, 1},
+	{50, 0, 0, 2, 1},
+	{39, 0, 0, 2, 1},
+	{18875, 7432, 52, 5, 1},
+	{18880, 7484, 28, 5, 1},
+	{18885, 0, 0, 5, 1},
+	{18890, 7512, 22, 6, 1},
+	{18896, 0, 0, 8, 1},
+	{18904, 0, 0, 8, 1},
+	{18912, 0, 0, 8, 1},
+	{18920, 0, 0, 7, 1},
+	{18927, 0, 0, 6, 1},
+	{7871, 0, 0, 8, 1},
+	{18933, 0, 0, 5, 1},
+	{780, 0, 0, 3, 1},
+	{18938, 0, 0, 3, 1},
+	{18941, 0, 0, 9, 1},
+	{14111, 0, 0, 3, 1},
+	{18950, 0, 0, 7, 1},
+	{18957, 0, 0, 8, 1},
+	{18965, 0, 0, 5, 1},
+	{18970, 0, 0, 7, 1},
+	{1103, 0, 0, 5, 1},
+	{18977, 7534, 58, 5, 1},
+	{18982, 0, 0, 8, 1},
+	{18990, 0, 0, 8, 1},
+	{18998, 0, 0, 5, 1},
+	{19003, 0, 0, 7, 1},
+	{1130, 0, 0, 3, 1},
+	{19010, 0, 0, 4, 1},
+	{70, 0, 0, 2, 1},
+	{19014, 0, 0, 7, 1},
+	{19021, 0, 0, 8, 1},
+	{19029, 0, 0, 6, 1},
+	{19035, 0, 0, 8, 1},
+	{374, 0, 0, 3, 1},
+	{9283, 0, 0, 4, 1},
+	{14884, 0, 0, 4, 1},
+	{19043, 0, 0, 6, 1},
+	{1238, 0, 0, 2, 1},
+	{19049, 0, 0, 6, 1},
+	{19055, 7592, 22, 5, 1},
+	{19060, 0, 0, 7, 1},
+	{19067, 0, 0, 12, 1},
+	{19079, 0, 0, 3, 1},
+	{19082, 0, 0, 5, 1},
+	{19087, 0, 0, 6, 1},
+	{19093, 0, 0, 4, 1},
+	{19097, 0, 0, 10, 1},
+	{19107, 7614, 15, 5, 1},
+	{19112, 7629, 63, 7, 1},
+	{19119, 7692, 51, 9, 1},
+	{19128, 7743, 38, 4, 1},
+	{19132, 0, 0, 10, 1},
+	{19142, 0, 0, 5, 1},
+	{19147, 0, 0, 6, 1},
+	{680, 0, 0, 2, 1},
+	{19153, 0, 0, 5, 1},
+	{1582, 0, 0, 2, 1},
+	{19158, 0, 0, 7, 1},
+	{19165, 7781, 36, 5, 1},
+	{19170, 0, 0, 5, 1},
+	{19175, 0, 0, 11, 1},
+	{19186, 0, 0, 5, 1},
+	{861, 0, 0, 3, 1},
+	{19191, 0, 0, 4, 1},
+	{19195, 0, 0, 5, 1},
+	{19200, 7817, 25, 9, 1},
+	{19209, 7842, 142, 8, 1},
+	{19217, 0, 0, 4, 1},
+	{19221, 0, 0, 6, 1},
+	{19227, 7984, 46, 5, 1},
+	{19232, 8030, 51, 7, 1},
+	{19239, 0, 0, 6, 1},
+	{19245, 8081, 19, 8, 1},
+	{19253, 0, 0, 5, 1},
+	{19258, 8100, 34, 5, 1},
+	{19263, 0, 0, 9, 1},
+	{19272, 8134, 15, 6, 1},
+	{19278, 8149, 20, 9, 1},
+	{19287, 8169, 30, 8, 1},
+	{19295, 0, 0, 10, 1},
+	{19305, 8199, 1, 8, 2},
+	{19313, 0, 0, 8, 1},
+	{19321, 0, 0, 4, 1},
+	{19325, 0, 0, 4, 1},
+	{19329, 8200, 1, 10, 2},
+	{19339, 8201, 1, 4, 2},
+	{19343, 8202, 31, 5, 1},
+	{19348, 8233, 23, 8, 1},
+	{19356, 0, 0, 5, 1},
+	{3178, 8256, 31, 5, 1},
+	{2284, 0, 0, 2, 1},
+	{19361, 0, 0, 10, 1},
+	{19371, 0, 0, 9, 1},
+	{19380, 0, 0, 10, 1},
+	{19390, 0, 0, 4, 1},
+	{19394, 0, 0, 7, 1},
+	{19401, 0, 0, 8, 1},
+	{1729, 0, 0, 4, 1},
+	{9106, 8287, 30, 3, 1},
+	{19409, 8317, 32, 6, 1},
+	{19415, 8349, 27, 8, 1},
+	{19423, 0, 0, 4, 1},
+	{1651, 0, 0, 4, 1},
+	{19427, 0, 0, 9, 1},
+	{15660, 0, 0, 3, 1},
+	{19436, 8376, 75, 6, 1},
+	{19442, 8451, 22, 8, 1},
+	{3776, 8473, 1, 6, 2},
+	{19450, 0, 0, 7, 1},
+	{19457, 8474, 38, 4, 1},
+	{246, 8512, 2, 2, 1},
+	{19461, 8514, 34, 7, 1},
+	{19468, 0, 0, 6, 1},
+	{19474, 0, 0, 7, 1},
+	{19481, 0, 0, 4, 1},
+	{19485, 8548, 19, 4, 1},
+	{19489, 8567, 26, 7, 1},
+	{3946, 8593, 42, 7, 1},
+	{19496, 0, 0, 4, 1},
+	{95, 0, 0, 2, 1},
+	{4029, 8635, 50, 5, 1},
+	{19500, 0, 0, 8, 1},
+	{19508, 0, 0, 8, 1},
+	{19516, 0, 0, 6, 1},
+	{19522, 0, 0, 6, 1},
+	{19528, 0, 0, 5, 1},
+	{19533, 0, 0, 6, 1},
+	{19539, 0, 0, 5, 1},
+	{19544, 0, 0, 7, 1},
+	{19551, 0, 0, 6, 1},
+	{19557, 0, 0, 5, 1},
+	{19562, 0, 0, 4, 1},
+	{19566, 0, 0, 8, 1},
+	{19574, 0, 0, 3, 1},
+	{19577, 0, 0, 8, 1},
+	{19585, 0, 0, 9, 1},
+	{19594, 0, 0, 6, 1},
+	{19600, 8685, 26, 4, 1},
+	{19604, 8711, 69, 7, 1},
+	{19611, 8780, 1, 7, 2},
+	{19618, 0, 0, 9, 1},
+	{19627, 0, 0, 6, 1},
+	{19633, 8781, 1, 6, 2},
+	{19639, 8782, 23, 5, 1},
+	{19644, 8805, 23, 7, 1},
+	{19651, 8828, 36, 8, 1},
+	{19659, 0, 0, 5, 1},
+	{19664, 0, 0, 8, 1},
+	{3648, 0, 0, 3, 1},
+	{19672, 0, 0, 8, 1},
+	{19680, 0, 0, 9, 1},
+	{19689, 0, 0, 7, 1},
+	{19696, 0, 0, 5, 1},
+	{19701, 8864, 31, 7, 1},
+	{19708, 8895, 17, 9, 1},
+	{5298, 8912, 57, 5, 1},
+	{19717, 0, 0, 8, 1},
+	{19725, 8969, 13, 7, 1},
+	{19732, 8982, 24, 6, 1},
+	{19738, 0, 0, 5, 1},
+	{19743, 0, 0, 5, 1},
+	{10239, 0, 0, 11, 1},
+	{19748, 0, 0, 6, 1},
+	{19754, 0, 0, 5, 1},
+	{19759, 0, 0, 6, 1},
+	{19765, 0, 0, 6, 1},
+	{19771, 9006, 29, 8, 1},
+	{19779, 0, 0, 6, 1},
+	{19785, 0, 0, 7, 1},
+	{19792, 0, 0, 9, 1},
+	{19801, 0, 0, 13, 1},
+	{19814, 0, 0, 9, 1},
+	{19823, 0, 0, 11, 1},
+	{19834, 0, 0, 11, 1},
+	{19845, 0, 0, 11, 1},
+	{19856, 0, 0, 11, 1},
+	{19867, 0, 0, 11, 1},
+	{19878, 0, 0, 11, 1},
+	{19889, 0, 0, 9, 1},
+	{19898, 0, 0, 11, 1},
+	{19909, 0, 0, 11, 1},
+	{19920, 0, 0, 11, 1},
+	{19931, 0, 0, 10, 1},
+	{19941, 0, 0, 10, 1},
+	{19951, 0, 0, 12, 1},
+	{19963, 0, 0, 11, 1},
+	{19974, 0, 0, 10, 1},
+	{19984, 0, 0, 10, 1},
+	{19994, 0, 0, 14, 1},
+	{20008, 0, 0, 14, 1},
+	{20022, 0, 0, 10, 1},
+	{20032, 0, 0, 10, 1},
+	{20042, 0, 0, 11, 1},
+	{20053, 0, 0, 11, 1},
+	{20064, 0, 0, 11, 1},
+	{20075, 0, 0, 11, 1},
+	{20086, 0, 0, 10, 1},
+	{20096, 0, 0, 11, 1},
+	{20107, 0, 0, 10, 1},
+	{20117, 0, 0, 10, 1},
+	{20127, 0, 0, 10, 1},
+	{20137, 0, 0, 11, 1},
+	{20148, 0, 0, 11, 1},
+	{20159, 0, 0, 14, 1},
+	{20173, 0, 0, 11, 1},
+	{20184, 0, 0, 11, 1},
+	{20195, 0, 0, 11, 1},
+	{20206, 0, 0, 10, 1},
+	{20216, 0, 0, 9, 1},
+	{20225, 0, 0, 10, 1},
+	{20235, 0, 0, 10, 1},
+	{20245, 0, 0, 11, 1},
+	{20256, 0, 0, 11, 1},
+	{20267, 0, 0, 10, 1},
+	{20277, 0, 0, 11, 1},
+	{20288, 0, 0, 11, 1},
+	{20299, 0, 0, 11, 1},
+	{20310, 9035, 34, 8, 1},
+	{20318, 9069, 16, 9, 1},
+	{20327, 9085, 28, 9, 1},
+	{7812, 9113, 1, 8, 2},
+	{20336, 0, 0, 6, 1},
+	{50, 0, 0, 2, 1},
+	{70, 9114, 1, 2, 1},
+	{680, 0, 0, 2, 1},
+	{2856, 0, 0, 4, 1},
+	{182, 0, 0, 2, 1},
+	{2830, 0, 0, 4, 1},
+	{246, 0, 0, 2, 1},
+	{95, 0, 0, 2, 1},
+	{796, 0, 0, 2, 1},
+	{717, 0, 0, 4, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{411, 0, 0, 2, 1},
+	{3012, 0, 0, 2, 1},
+	{264, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{1751, 0, 0, 2, 1},
+	{3142, 0, 0, 2, 1},
+	{154, 0, 0, 2, 1},
+	{685, 0, 0, 3, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2856, 0, 0, 4, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{380, 0, 0, 3, 1},
+	{380, 0, 0, 4, 1},
+	{1272, 0, 0, 3, 1},
+	{1398, 0, 0, 4, 1},
+	{1795, 0, 0, 3, 1},
+	{9760, 0, 0, 4, 1},
+	{2456, 0, 0, 3, 1},
+	{14882, 0, 0, 7, 1},
+	{264, 0, 0, 3, 1},
+	{7868, 0, 0, 3, 1},
+	{14889, 0, 0, 8, 1},
+	{2343, 0, 0, 3, 1},
+	{20342, 0, 0, 11, 1},
+	{14913, 0, 0, 3, 1},
+	{9764, 0, 0, 6, 1},
+	{322, 0, 0, 2, 1},
+	{14916, 0, 0, 11, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{496, 0, 0, 3, 1},
+	{1365, 0, 0, 3, 1},
+	{50, 0, 0, 2, 1},
+	{7871, 0, 0, 8, 1},
+	{20353, 0, 0, 5, 1},
+	{20358, 0, 0, 8, 1},
+	{20366, 0, 0, 8, 1},
+	{70, 0, 0, 2, 1},
+	{20374, 0, 0, 5, 1},
+	{20379, 0, 0, 7, 1},
+	{251, 0, 0, 2, 1},
+	{20386, 0, 0, 7, 1},
+	{680, 0, 0, 2, 1},
+	{20393, 0, 0, 7, 1},
+	{20400, 0, 0, 9, 1},
+	{20409, 0, 0, 8, 1},
+	{20417, 0, 0, 9, 1},
+	{2767, 0, 0, 2, 1},
+	{20426, 0, 0, 7, 1},
+	{20433, 0, 0, 4, 1},
+	{20437, 0, 0, 7, 1},
+	{20444, 0, 0, 7, 1},
+	{3092, 0, 0, 2, 1},
+	{264, 0, 0, 3, 1},
+	{283, 0, 0, 2, 1},
+	{246, 0, 0, 2, 1},
+	{95, 0, 0, 2, 1},
+	{948, 0, 0, 2, 1},
+	{66, 0, 0, 2, 1},
+	{796, 0, 0, 2, 1},
+	{20451, 0, 0, 5, 1},
+	{16296, 0, 0, 5, 1},
+	{70, 0, 0, 2, 1},
+	{1795, 0, 0, 3, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{9256, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{1962, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{20456, 0, 0, 6, 1},
+	{20462, 9115, 1, 11, 0},
+	{264, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{20473, 0, 0, 3, 1},
+	{30, 0, 0, 1, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2856, 0, 0, 4, 1},
+	{1110, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{1928, 0, 0, 3, 1},
+	{9928, 9116, 2, 6, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{70, 0, 0, 2, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{3010, 0, 0, 2, 1},
+	{7871, 0, 0, 8, 1},
+	{128, 0, 0, 3, 1},
+	{20476, 0, 0, 4, 1},
+	{13739, 0, 0, 4, 2},
+	{20480, 0, 0, 5, 1},
+	{20485, 0, 0, 3, 1},
+	{50, 0, 0, 2, 1},
+	{20488, 0, 0, 4, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{20492, 0, 0, 3, 1},
+	{2739, 0, 0, 5, 1},
+	{1110, 0, 0, 3, 1},
+	{3450, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{679, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{796, 0, 0, 3, 1},
+	{382, 0, 0, 3, 1},
+	{5677, 0, 0, 3, 1},
+	{20495, 0, 0, 3, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{50, 0, 0, 2, 1},
+	{685, 0, 0, 3, 1},
+	{70, 0, 0, 2, 1},
+	{55, 0, 0, 2, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2856, 0, 0, 4, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{796, 0, 0, 2, 1},
+	{7871, 0, 0, 8, 1},
+	{2456, 0, 0, 3, 1},
+	{8807, 0, 0, 10, 1},
+	{7871, 0, 0, 8, 1},
+	{8798, 0, 0, 3, 1},
+	{1272, 0, 0, 3, 1},
+	{8108, 0, 0, 4, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{305, 0, 0, 2, 1},
+	{264, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{305, 0, 0, 2, 1},
+	{1237, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{20498, 0, 0, 3, 1},
+	{796, 0, 0, 3, 1},
+	{50, 0, 0, 2, 1},
+	{70, 0, 0, 2, 1},
+	{2456, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{249, 0, 0, 5, 1},
+	{14253, 0, 0, 6, 1},
+	{380, 0, 0, 4, 1},
+	{322, 0, 0, 2, 1},
+	{212, 0, 0, 2, 1},
+	{7871, 0, 0, 8, 1},
+	{55, 0, 0, 2, 1},
+	{3012, 0, 0, 2, 1},
+	{94, 0, 0, 2, 1},
+	{50, 0, 0, 2, 1},
+	{8861, 0, 0, 5, 1},
+	{20501, 0, 0, 8, 1},
+	{20509, 0, 0, 3, 1},
+	{70, 0, 0, 2, 1},
+	{20512, 9118, 1, 6, 1},
+	{10571, 0, 0, 4, 1},
+	{14353, 0, 0, 11, 1},
+	{8887, 0, 0, 6, 1},
+	{8877, 0, 0, 7, 1},
+	{20518, 0, 0, 9, 1},
+	{1795, 0, 0, 3, 1},
+	{20527, 0, 0, 8, 1},
+	{20535, 0, 0, 11, 1},
+	{20546, 0, 0, 11, 1},
+	{20557, 0, 0, 11, 1},
+	{20568, 0, 0, 11, 1},
+	{20579, 0, 0, 11, 1},
+	{20590, 0, 0, 11, 1},
+	{20601, 0, 0, 6, 1},
+	{2456, 0, 0, 3, 1},
+	{20607, 0, 0, 5, 1},
+	{20612, 0, 0, 4, 1},
+	{2253, 0, 0, 3, 1},
+	{20616, 0, 0, 7, 1},
+	{20623, 0, 0, 6, 1},
+	{20629, 0, 0, 5, 1},
+	{20634, 0, 0, 4, 1},
+	{20638, 0, 0, 4, 1},
+	{2158, 0, 0, 3, 1},
+	{20642, 0, 0, 6, 1},
+	{20648, 0, 0, 4, 1},
+	{2343, 0, 0, 3, 1},
+	{8794, 0, 0, 4, 1},
+	{9901, 0, 0, 7, 1},
+	{20652, 0, 0, 9, 1},
+	{14344, 0, 0, 8, 1},
+	{20661, 0, 0, 4, 1},
+	{20665, 9119, 1, 7, 0},
+	{20672, 0, 0, 3, 1},
+	{8952, 0, 0, 6, 1},
+	{15866, 0, 0, 8, 1},
+	{20675, 0, 0, 5, 1},
+	{8535, 0, 0, 6, 1},
+	{8861, 0, 0, 5, 1},
+	{70, 0, 0, 2, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{264, 0, 0, 3, 1},
+	{7868, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{14913, 0, 0, 3, 1},
+	{322, 0, 0, 2, 1},
+	{7871, 0, 0, 8, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2848, 0, 0, 3, 1},
+	{238, 0, 0, 4, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{9760, 0, 0, 4, 1},
+	{2456, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{9764, 0, 0, 6, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{1304, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{8861, 0, 0, 5, 1},
+	{8877, 0, 0, 7, 1},
+	{3026, 0, 0, 2, 1},
+	{7871, 0, 0, 8, 1},
+	{2456, 0, 0, 3, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{13775, 0, 0, 3, 1},
+	{20680, 0, 0, 8, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{1272, 9120, 1, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{50, 0, 0, 2, 1},
+	{70, 0, 0, 2, 1},
+	{1272, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{95, 0, 0, 2, 1},
+	{2343, 0, 0, 3, 1},
+	{52, 0, 0, 7, 1},
+	{20688, 0, 0, 11, 1},
+	{150, 0, 0, 3, 1},
+	{20699, 0, 0, 8, 1},
+	{20707, 0, 0, 7, 1},
+	{20714, 0, 0, 6, 1},
+	{20720, 0, 0, 5, 1},
+	{8019, 0, 0, 9, 1},
+	{239, 0, 0, 8, 1},
+	{20725, 0, 0, 9, 1},
+	{20734, 0, 0, 16, 1},
+	{20750, 0, 0, 11, 1},
+	{282, 0, 0, 9, 1},
+	{300, 0, 0, 3, 1},
+	{20761, 0, 0, 9, 1},
+	{20770, 0, 0, 6, 1},
+	{20776, 0, 0, 12, 1},
+	{20742, 0, 0, 8, 1},
+	{20788, 0, 0, 8, 1},
+	{20796, 0, 0, 9, 1},
+	{20805, 0, 0, 14, 1},
+	{20819, 0, 0, 11, 1},
+	{20830, 0, 0, 12, 1},
+	{9, 0, 0, 3, 1},
+	{20842, 0, 0, 12, 1},
+	{20854, 0, 0, 9, 1},
+	{20863, 0, 0, 7, 1},
+	{20870, 0, 0, 12, 1},
+	{20882, 0, 0, 10, 1},
+	{4074, 0, 0, 4, 1},
+	{20892, 0, 0, 13, 1},
+	{20905, 0, 0, 8, 1},
+	{20913, 0, 0, 13, 1},
+	{20926, 0, 0, 6, 1},
+	{8037, 0, 0, 11, 1},
+	{20932, 0, 0, 9, 1},
+	{20941, 0, 0, 7, 1},
+	{20948, 0, 0, 6, 1},
+	{20954, 0, 0, 9, 1},
+	{20963, 0, 0, 10, 1},
+	{8100, 0, 0, 8, 1},
+	{20973, 0, 0, 4, 1},
+	{20977, 0, 0, 7, 1},
+	{20984, 0, 0, 7, 1},
+	{20991, 0, 0, 4, 1},
+	{10312, 0, 0, 4, 1},
+	{20995, 0, 0, 9, 1},
+	{512, 0, 0, 9, 1},
+	{556, 0, 0, 8, 1},
+	{21004, 0, 0, 5, 1},
+	{21009, 0, 0, 5, 1},
+	{21014, 0, 0, 6, 1},
+	{21020, 0, 0, 9, 1},
+	{21029, 0, 0, 13, 1},
+	{21042, 0, 0, 8, 1},
+	{21050, 0, 0, 7, 1},
+	{21057, 0, 0, 8, 1},
+	{629, 0, 0, 6, 1},
+	{9566, 0, 0, 4, 1},
+	{661, 0, 0, 5, 1},
+	{21065, 0, 0, 6, 1},
+	{21071, 0, 0, 4, 1},
+	{21075, 0, 0, 7, 1},
+	{21082, 0, 0, 10, 1},
+	{21092, 0, 0, 4, 1},
+	{805, 0, 0, 6, 1},
+	{21096, 0, 0, 9, 1},
+	{21105, 0, 0, 15, 1},
+	{21120, 0, 0, 13, 1},
+	{21133, 0, 0, 6, 1},
+	{21139, 0, 0, 16, 1},
+	{20501, 0, 0, 6, 1},
+	{21155, 0, 0, 7, 1},
+	{21162, 0, 0, 7, 1},
+	{21169, 0, 0, 15, 1},
+	{21184, 0, 0, 9, 1},
+	{21193, 0, 0, 6, 1},
+	{864, 0, 0, 7, 1},
+	{864, 0, 0, 8, 1},
+	{21199, 0, 0, 9, 1},
+	{21208, 0, 0, 8, 1},
+	{21216, 0, 0, 7, 1},
+	{153, 0, 0, 3, 1},
+	{21223, 0, 0, 6, 1},
+	{21229, 0, 0, 8, 1},
+	{21237, 0, 0, 10, 1},
+	{21247, 0, 0, 9, 1},
+	{244, 0, 0, 3, 1},
+	{21256, 0, 0, 6, 1},
+	{21262, 0, 0, 10, 1},
+	{21272, 0, 0, 7, 1},
+	{21279, 0, 0, 10, 1},
+	{21289, 0, 0, 14, 1},
+	{21303, 0, 0, 6, 1},
+	{21309, 0, 0, 7, 1},
+	{21316, 0, 0, 6, 1},
+	{1053, 0, 0, 6, 1},
+	{21322, 0, 0, 11, 1},
+	{21333, 0, 0, 10, 1},
+	{21343, 0, 0, 13, 1},
+	{21356, 0, 0, 7, 1},
+	{21363, 0, 0, 8, 1},
+	{21371, 0, 0, 9, 1},
+	{21380, 0, 0, 15, 1},
+	{21395, 0, 0, 12, 1},
+	{21407, 0, 0, 9, 1},
+	{21416, 0, 0, 14, 1},
+	{21430, 0, 0, 10, 1},
+	{21440, 0, 0, 6, 1},
+	{21446, 0, 0, 6, 1},
+	{21452, 0, 0, 12, 1},
+	{21464, 0, 0, 12, 1},
+	{21476, 0, 0, 8, 1},
+	{21484, 0, 0, 7, 1},
+	{21491, 0, 0, 5, 1},
+	{21496, 0, 0, 4, 1},
+	{21500, 0, 0, 14, 1},
+	{21514, 0, 0, 4, 1},
+	{21518, 0, 0, 7, 1},
+	{21525, 0, 0, 10, 1},
+	{21535, 0, 0, 20, 1},
+	{21555, 0, 0, 15, 1},
+	{21176, 0, 0, 8, 1},
+	{21570, 0, 0, 8, 1},
+	{21578, 0, 0, 13, 1},
+	{21591, 0, 0, 14, 1},
+	{1290, 0, 0, 9, 1},
+	{1313, 0, 0, 8, 1},
+	{21605, 0, 0, 15, 1},
+	{21620, 0, 0, 12, 1},
+	{21632, 0, 0, 15, 1},
+	{21647, 0, 0, 7, 1},
+	{21654, 0, 0, 10, 1},
+	{21664, 0, 0, 11, 1},
+	{21675, 0, 0, 8, 1},
+	{21683, 0, 0, 7, 1},
+	{21690, 0, 0, 13, 1},
+	{21703, 0, 0, 6, 1},
+	{8388, 0, 0, 6, 1},
+	{21709, 0, 0, 9, 1},
+	{8360, 0, 0, 8, 1},
+	{21718, 0, 0, 8, 1},
+	{21726, 0, 0, 14, 1},
+	{20692, 0, 0, 7, 1},
+	{21740, 0, 0, 5, 1},
+	{1514, 0, 0, 5, 1},
+	{21745, 0, 0, 4, 1},
+	{21749, 0, 0, 6, 1},
+	{21755, 0, 0, 8, 1},
+	{1744, 0, 0, 3, 1},
+	{21763, 0, 0, 14, 1},
+	{21777, 0, 0, 8, 1},
+	{21785, 0, 0, 11, 1},
+	{21796, 0, 0, 7, 1},
+	{2679, 0, 0, 5, 1},
+	{1636, 0, 0, 6, 1},
+	{21803, 0, 0, 7, 1},
+	{21810, 0, 0, 8, 1},
+	{21818, 0, 0, 9, 1},
+	{21827, 0, 0, 5, 1},
+	{21832, 0, 0, 8, 1},
+	{21840, 0, 0, 6, 1},
+	{21846, 0, 0, 10, 1},
+	{21856, 0, 0, 9, 1},
+	{1798, 0, 0, 9, 1},
+	{21865, 0, 0, 11, 1},
+	{21876, 0, 0, 8, 1},
+	{21884, 0, 0, 9, 1},
+	{21893, 0, 0, 6, 1},
+	{21899, 0, 0, 10, 1},
+	{21909, 0, 0, 10, 1},
+	{21919, 0, 0, 12, 1},
+	{21931, 0, 0, 7, 1},
+	{21938, 0, 0, 10, 1},
+	{21948, 0, 0, 11, 1},
+	{21959, 0, 0, 25, 1},
+	{21984, 0, 0, 8, 1},
+	{9766, 0, 0, 5, 1},
+	{1883, 0, 0, 6, 1},
+	{21992, 0, 0, 9, 1},
+	{22001, 0, 0, 6, 1},
+	{22007, 0, 0, 10, 1},
+	{262, 0, 0, 6, 1},
+	{1978, 0, 0, 4, 1},
+	{22017, 0, 0, 13, 1},
+	{1982, 0, 0, 7, 1},
+	{22030, 0, 0, 9, 1},
+	{22039, 0, 0, 5, 1},
+	{22044, 0, 0, 8, 1},
+	{22052, 0, 0, 9, 1},
+	{2043, 0, 0, 4, 1},
+	{22061, 0, 0, 7, 1},
+	{22068, 0, 0, 8, 1},
+	{22076, 0, 0, 7, 1},
+	{22083, 0, 0, 8, 1},
+	{22091, 0, 0, 7, 1},
+	{159, 0, 0, 5, 1},
+	{22098, 0, 0, 12, 1},
+	{22110, 0, 0, 9, 1},
+	{2194, 0, 0, 10, 1},
+	{22119, 0, 0, 9, 1},
+	{22128, 0, 0, 9, 1},
+	{22137, 0, 0, 12, 1},
+	{22149, 0, 0, 11, 1},
+	{22160, 0, 0, 8, 1},
+	{22168, 0, 0, 8, 1},
+	{2223, 0, 0, 4, 1},
+	{22176, 0, 0, 8, 1},
+	{2264, 0, 0, 9, 1},
+	{2285, 0, 0, 7, 1},
+	{2315, 0, 0, 6, 1},
+	{11123, 0, 0, 7, 1},
+	{22184, 0, 0, 9, 1},
+	{22193, 0, 0, 11, 1},
+	{22204, 0, 0, 7, 1},
+	{22211, 0, 0, 7, 1},
+	{22218, 0, 0, 7, 1},
+	{2373, 0, 0, 4, 1},
+	{2373, 0, 0, 5, 1},
+	{22225, 0, 0, 5, 1},
+	{22230, 0, 0, 11, 1},
+	{22241, 0, 0, 4, 1},
+	{22245, 0, 0, 8, 1},
+	{22253, 0, 0, 10, 1},
+	{2552, 0, 0, 7, 1},
+	{22263, 0, 0, 7, 1},
+	{22270, 0, 0, 18, 1},
+	{22288, 0, 0, 6, 1},
+	{2578, 0, 0, 6, 1},
+	{22294, 0, 0, 14, 1},
+	{22308, 0, 0, 6, 1},
+	{2598, 0, 0, 8, 1},
+	{22314, 0, 0, 15, 1},
+	{22329, 0, 0, 8, 1},
+	{22337, 0, 0, 8, 1},
+	{22345, 0, 0, 10, 1},
+	{22355, 0, 0, 17, 1},
+	{22372, 0, 0, 14, 1},
+	{22386, 0, 0, 10, 1},
+	{22396, 0, 0, 12, 1},
+	{21613, 0, 0, 7, 1},
+	{22408, 0, 0, 16, 1},
+	{22424, 0, 0, 8, 1},
+	{2759, 0, 0, 5, 1},
+	{22432, 0, 0, 10, 1},
+	{22442, 0, 0, 12, 1},
+	{22454, 0, 0, 13, 1},
+	{22467, 0, 0, 6, 1},
+	{22473, 0, 0, 7, 1},
+	{22480, 0, 0, 12, 1},
+	{22492, 0, 0, 12, 1},
+	{22504, 0, 0, 12, 1},
+	{22516, 0, 0, 11, 1},
+	{22527, 0, 0, 4, 1},
+	{12575, 0, 0, 4, 1},
+	{22531, 0, 0, 9, 1},
+	{22540, 0, 0, 7, 1},
+	{22547, 0, 0, 9, 1},
+	{22556, 0, 0, 9, 1},
+	{2973, 0, 0, 7, 1},
+	{22565, 0, 0, 6, 1},
+	{22571, 0, 0, 9, 1},
+	{2111, 0, 0, 3, 1},
+	{22580, 0, 0, 10, 1},
+	{22590, 0, 0, 7, 1},
+	{22597, 0, 0, 11, 1},
+	{22608, 0, 0, 10, 1},
+	{22618, 0, 0, 4, 1},
+	{22622, 0, 0, 6, 1},
+	{22628, 0, 0, 9, 1},
+	{3097, 0, 0, 4, 1},
+	{22637, 0, 0, 10, 1},
+	{3131, 0, 0, 5, 1},
+	{22647, 0, 0, 5, 1},
+	{22652, 0, 0, 13, 1},
+	{22665, 0, 0, 14, 1},
+	{22679, 0, 0, 5, 1},
+	{22684, 0, 0, 6, 1},
+	{22690, 0, 0, 7, 1},
+	{22697, 0, 0, 10, 1},
+	{22707, 0, 0, 6, 1},
+	{22713, 0, 0, 4, 1},
+	{22717, 0, 0, 7, 1},
+	{22724, 0, 0, 11, 1},
+	{3365, 0, 0, 7, 1},
+	{10212, 0, 0, 4, 1},
+	{3386, 0, 0, 6, 1},
+	{22735, 0, 0, 13, 1},
+	{22748, 0, 0, 12, 1},
+	{3418, 0, 0, 6, 1},
+	{22760, 0, 0, 10, 1},
+	{22770, 0, 0, 6, 1},
+	{22776, 0, 0, 8, 1},
+	{22784, 0, 0, 7, 1},
+	{22791, 0, 0, 10, 1},
+	{22801, 0, 0, 6, 1},
+	{3480, 0, 0, 3, 1},
+	{3480, 0, 0, 6, 1},
+	{22807, 0, 0, 8, 1},
+	{22815, 0, 0, 10, 1},
+	{22825, 0, 0, 7, 1},
+	{22832, 0, 0, 8, 1},
+	{22840, 0, 0, 4, 1},
+	{22844, 0, 0, 7, 1},
+	{22851, 0, 0, 8, 1},
+	{22859, 0, 0, 8, 1},
+	{22867, 0, 0, 8, 1},
+	{22875, 0, 0, 10, 1},
+	{3581, 0, 0, 5, 1},
+	{22885, 0, 0, 7, 1},
+	{22892, 0, 0, 19, 1},
+	{22911, 0, 0, 6, 1},
+	{3603, 0, 0, 8, 1},
+	{22917, 0, 0, 9, 1},
+	{22926, 0, 0, 8, 1},
+	{22934, 0, 0, 11, 1},
+	{22945, 0, 0, 8, 1},
+	{22729, 0, 0, 4, 1},
+	{22953, 0, 0, 6, 1},
+	{22959, 0, 0, 6, 1},
+	{22965, 0, 0, 9, 1},
+	{22974, 0, 0, 7, 1},
+	{22102, 0, 0, 8, 1},
+	{22981, 0, 0, 6, 1},
+	{22865, 0, 0, 4, 1},
+	{3690, 0, 0, 5, 1},
+	{22987, 0, 0, 8, 1},
+	{22995, 0, 0, 10, 1},
+	{23005, 0, 0, 8, 1},
+	{3716, 0, 0, 6, 1},
+	{3726, 0, 0, 10, 1},
+	{23013, 0, 0, 8, 1},
+	{15590, 0, 0, 8, 1},
+	{23021, 0, 0, 8, 1},
+	{23029, 0, 0, 6, 1},
+	{23035, 0, 0, 6, 1},
+	{23041, 0, 0, 12, 1},
+	{23053, 0, 0, 16, 1},
+	{3761, 0, 0, 5, 1},
+	{2889, 0, 0, 8, 1},
+	{23069, 0, 0, 16, 1},
+	{23085, 0, 0, 16, 1},
+	{23101, 0, 0, 14, 1},
+	{23115, 0, 0, 14, 1},
+	{23129, 0, 0, 20, 1},
+	{23149, 0, 0, 15, 1},
+	{23164, 0, 0, 6, 1},
+	{23170, 0, 0, 17, 1},
+	{23187, 0, 0, 19, 1},
+	{23206, 0, 0, 8, 1},
+	{23214, 0, 0, 5, 1},
+	{23219, 0, 0, 8, 1},
+	{23227, 0, 0, 5, 1},
+	{23232, 0, 0, 12, 1},
+	{23244, 0, 0, 9, 1},
+	{23253, 0, 0, 9, 1},
+	{23262, 0, 0, 7, 1},
+	{23269, 0, 0, 9, 1},
+	{23278, 0, 0, 7, 1},
+	{23285, 0, 0, 6, 1},
+	{23291, 0, 0, 7, 1},
+	{3883, 0, 0, 5, 1},
+	{3926, 0, 0, 3, 1},
+	{1304, 0, 0, 3, 1},
+	{23298, 0, 0, 4, 1},
+	{23302, 0, 0, 13, 1},
+	{23315, 0, 0, 15, 1},
+	{23330, 0, 0, 5, 1},
+	{3990, 0, 0, 6, 1},
+	{23335, 0, 0, 7, 1},
+	{23342, 0, 0, 7, 1},
+	{23349, 0, 0, 6, 1},
+	{23355, 0, 0, 11, 1},
+	{23366, 0, 0, 5, 1},
+	{23371, 0, 0, 6, 1},
+	{23377, 0, 0, 7, 1},
+	{23384, 0, 0, 9, 1},
+	{23393, 0, 0, 6, 1},
+	{23399, 0, 0, 5, 1},
+	{23404, 0, 0, 11, 1},
+	{23415, 0, 0, 6, 1},
+	{4056, 0, 0, 5, 1},
+	{23421, 0, 0, 8, 1},
+	{4104, 0, 0, 8, 1},
+	{23429, 0, 0, 12, 1},
+	{23441, 0, 0, 16, 1},
+	{23457, 0, 0, 9, 1},
+	{23466, 0, 0, 7, 1},
+	{4132, 0, 0, 11, 1},
+	{23473, 0, 0, 6, 1},
+	{23479, 0, 0, 10, 1},
+	{23489, 0, 0, 11, 1},
+	{23500, 0, 0, 10, 1},
+	{23510, 0, 0, 6, 1},
+	{23516, 0, 0, 5, 1},
+	{23521, 0, 0, 6, 1},
+	{23527, 0, 0, 8, 1},
+	{23535, 0, 0, 10, 1},
+	{23545, 0, 0, 28, 1},
+	{23573, 0, 0, 12, 1},
+	{23585, 0, 0, 8, 1},
+	{249, 0, 0, 5, 1},
+	{23593, 0, 0, 7, 1},
+	{498, 0, 0, 6, 1},
+	{23600, 0, 0, 5, 1},
+	{4352, 0, 0, 6, 1},
+	{23605, 0, 0, 8, 1},
+	{23613, 0, 0, 7, 1},
+	{8375, 0, 0, 8, 1},
+	{23620, 0, 0, 10, 1},
+	{23630, 0, 0, 12, 1},
+	{23642, 0, 0, 9, 1},
+	{23651, 0, 0, 7, 1},
+	{4650, 0, 0, 4, 1},
+	{23658, 0, 0, 6, 1},
+	{23664, 0, 0, 10, 1},
+	{22560, 0, 0, 5, 1},
+	{23674, 0, 0, 12, 1},
+	{23686, 0, 0, 8, 1},
+	{23694, 0, 0, 8, 1},
+	{23702, 0, 0, 12, 1},
+	{23714, 0, 0, 12, 1},
+	{23726, 0, 0, 9, 1},
+	{23735, 0, 0, 7, 1},
+	{23742, 0, 0, 12, 1},
+	{23754, 0, 0, 4, 1},
+	{23758, 0, 0, 10, 1},
+	{23768, 0, 0, 12, 1},
+	{23780, 0, 0, 11, 1},
+	{23791, 0, 0, 11, 1},
+	{4709, 0, 0, 6, 1},
+	{23802, 0, 0, 7, 1},
+	{4728, 0, 0, 7, 1},
+	{23809, 0, 0, 15, 1},
+	{23824, 0, 0, 17, 1},
+	{23841, 0, 0, 18, 1},
+	{23859, 0, 0, 13, 1},
+	{23872, 0, 0, 14, 1},
+	{23886, 0, 0, 14, 1},
+	{4728, 0, 0, 8, 1},
+	{23900, 0, 0, 18, 1},
+	{23918, 0, 0, 8, 1},
+	{23926, 0, 0, 7, 1},
+	{23933, 0, 0, 10, 1},
+	{23943, 0, 0, 8, 1},
+	{4811, 0, 0, 5, 1},
+	{23951, 0, 0, 10, 1},
+	{23961, 0, 0, 7, 1},
+	{4862, 0, 0, 4, 1},
+	{3100, 0, 0, 3, 1},
+	{23968, 0, 0, 5, 1},
+	{22365, 0, 0, 7, 1},
+	{23973, 0, 0, 7, 1},
+	{23980, 0, 0, 14, 1},
+	{23994, 0, 0, 13, 1},
+	{24007, 0, 0, 9, 1},
+	{1944, 0, 0, 5, 1},
+	{24016, 0, 0, 3, 1},
+	{9753, 0, 0, 6, 1},
+	{24019, 0, 0, 5, 1},
+	{24024, 0, 0, 8, 1},
+	{24032, 0, 0, 9, 1},
+	{210, 0, 0, 5, 1},
+	{24041, 0, 0, 15, 1},
+	{4212, 0, 0, 7, 1},
+	{24056, 0, 0, 5, 1},
+	{24061, 0, 0, 10, 1},
+	{24071, 0, 0, 6, 1},
+	{5019, 0, 0, 9, 1},
+	{24077, 0, 0, 12, 1},
+	{24089, 0, 0, 9, 1},
+	{24098, 0, 0, 6, 1},
+	{24104, 0, 0, 12, 1},
+	{24116, 0, 0, 6, 1},
+	{24122, 0, 0, 8, 1},
+	{24130, 0, 0, 6, 1},
+	{5113, 0, 0, 6, 1},
+	{24136, 0, 0, 4, 1},
+	{24140, 0, 0, 3, 1},
+	{5192, 0, 0, 10, 1},
+	{24143, 0, 0, 17, 1},
+	{24160, 0, 0, 10, 1},
+	{24170, 0, 0, 5, 1},
+	{24175, 0, 0, 7, 1},
+	{5219, 0, 0, 7, 1},
+	{4858, 0, 0, 4, 1},
+	{24182, 0, 0, 11, 1},
+	{24193, 0, 0, 8, 1},
+	{17583, 0, 0, 6, 1},
+	{24201, 0, 0, 5, 1},
+	{950, 0, 0, 4, 1},
+	{9204, 0, 0, 9, 1},
+	{24206, 0, 0, 4, 1},
+	{24210, 0, 0, 7, 1},
+	{5406, 0, 0, 5, 1},
+	{24217, 0, 0, 7, 1},
+	{22303, 0, 0, 5, 1},
+	{24224, 0, 0, 3, 1},
+	{24227, 0, 0, 8, 1},
+	{5442, 0, 0, 10, 1},
+	{154, 0, 0, 3, 1},
+	{24235, 0, 0, 10, 1},
+	{24245, 0, 0, 6, 1},
+	{24251, 0, 0, 15, 1},
+	{24266, 0, 0, 9, 1},
+	{24275, 0, 0, 16, 1},
+	{24291, 0, 0, 8, 1},
+	{24299, 0, 0, 9, 1},
+	{24308, 0, 0, 7, 1},
+	{24315, 0, 0, 15, 1},
+	{24330, 0, 0, 4, 1},
+	{24334, 0, 0, 4, 1},
+	{16047, 0, 0, 6, 1},
+	{24338, 0, 0, 6, 1},
+	{24344, 0, 0, 10, 1},
+	{5529, 0, 0, 6, 1},
+	{24354, 0, 0, 7, 1},
+	{24361, 0, 0, 8, 1},
+	{14417, 0, 0, 7, 1},
+	{24369, 0, 0, 7, 1},
+	{5562, 0, 0, 10, 1},
+	{24376, 0, 0, 11, 1},
+	{5620, 0, 0, 5, 1},
+	{24387, 0, 0, 8, 1},
+	{4724, 0, 0, 3, 1},
+	{24395, 0, 0, 12, 1},
+	{24407, 0, 0, 15, 1},
+	{24422, 0, 0, 13, 1},
+	{3888, 0, 0, 7, 1},
+	{24435, 0, 0, 9, 1},
+	{24444, 0, 0, 7, 1},
+	{24451, 0, 0, 8, 1},
+	{21543, 0, 0, 12, 1},
+	{24459, 0, 0, 8, 1},
+	{24467, 0, 0, 8, 1},
+	{24475, 0, 0, 14, 1},
+	{24489, 0, 0, 20, 1},
+	{24509, 0, 0, 36, 1},
+	{24545, 0, 0, 10, 1},
+	{24555, 0, 0, 11, 1},
+	{23281, 0, 0, 4, 1},
+	{24566, 0, 0, 9, 1},
+	{24575, 0, 0, 8, 1},
+	{24583, 0, 0, 5, 1},
+	{24588, 0, 0, 10, 1},
+	{24598, 0, 0, 7, 1},
+	{110, 0, 0, 4, 1},
+	{685, 0, 0, 3, 1},
+	{1272, 0, 0, 3, 1},
+	{1398, 0, 0, 4, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2856, 0, 0, 4, 1},
+	{1110, 0, 0, 3, 1},
+	{264, 0, 0, 3, 1},
+	{3755, 0, 0, 6, 1},
+	{238, 0, 0, 4, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{3079, 0, 0, 3, 1},
+	{50, 0, 0, 2, 1},
+	{685, 0, 0, 3, 1},
+	{70, 0, 0, 2, 1},
+	{1272, 0, 0, 3, 1},
+	{1398, 0, 0, 4, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{1110, 0, 0, 3, 1},
+	{3755, 0, 0, 6, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{7871, 0, 0, 8, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{680, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{685, 0, 0, 3, 1},
+	{7871, 0, 0, 8, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{264, 0, 0, 3, 1},
+	{238, 0, 0, 4, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{50, 0, 0, 2, 1},
+	{9223, 0, 0, 3, 1},
+	{70, 0, 0, 2, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{264, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{30, 0, 0, 2, 1},
+	{60, 0, 0, 2, 1},
+	{70, 0, 0, 2, 1},
+	{1272, 0, 0, 3, 1},
+	{302, 0, 0, 2, 1},
+	{202, 0, 0, 2, 1},
+	{2856, 0, 0, 4, 1},
+	{2830, 0, 0, 4, 1},
+	{2407, 0, 0, 2, 1},
+	{238, 0, 0, 4, 1},
+	{95, 0, 0, 2, 1},
+	{2343, 0, 0, 3, 1},
+	{3079, 0, 0, 3, 1},
+	{4709, 0, 0, 6, 1},
+	{1751, 0, 0, 2, 1},
+	{154, 0, 0, 2, 1},
+	{462, 0, 0, 2, 1},
+	{861, 9121, 1, 3, 0},
+	{2626, 9122, 1, 3, 0},
+	{380, 0, 0, 4, 1},
+	{7868, 0, 0, 3, 1},
+	{10119, 0, 0, 13, 1},
+	{24605, 0, 0, 14, 1},
+	{24619, 0, 0, 14, 1},
+	{24633, 0, 0, 6, 1},
+	{24639, 0, 0, 6, 1},
+	{24645, 0, 0, 14, 1},
+	{24659, 0, 0, 10, 1},
+	{24669, 0, 0, 18, 1},
+	{24687, 0, 0, 8, 1},
+	{24695, 0, 0, 16, 1},
+	{24711, 0, 0, 12, 1},
+	{24723, 0, 0, 20, 1},
+	{24743, 0, 0, 9, 1},
+	{24752, 0, 0, 17, 1},
+	{24769, 0, 0, 10, 1},
+	{24779, 0, 0, 6, 1},
+	{24785, 0, 0, 12, 1},
+	{24797, 9123, 1, 13, 0},
+	{24810, 0, 0, 12, 1},
+	{24822, 9124, 7, 15, 1},
+	{24837, 0, 0, 13, 1},
+	{24850, 0, 0, 4, 1},
+	{24854, 0, 0, 4, 1},
+	{24858, 0, 0, 4, 1},
+	{8861, 0, 0, 5, 1},
+	{24862, 0, 0, 9, 1},
+	{24871, 0, 0, 12, 1},
+	{10358, 0, 0, 7, 1},
+	{24883, 0, 0, 6, 1},
+	{24889, 0, 0, 8, 1},
+	{10397, 0, 0, 7, 1},
+	{24897, 0, 0, 8, 1},
+	{24905, 0, 0, 10, 1},
+	{24915, 0, 0, 7, 1},
+	{24922, 0, 0, 9, 1},
+	{24931, 9131, 1, 5, 0},
+	{24936, 0, 0, 9, 1},
+	{24945, 9132, 1, 11, 1},
+	{24956, 0, 0, 11, 1},
+	{15088, 0, 0, 11, 1},
+	{14580, 0, 0, 8, 1},
+	{24967, 0, 0, 10, 1},
+	{24977, 0, 0, 14, 1},
+	{24991, 9133, 2, 10, 1},
+	{25001, 0, 0, 13, 1},
+	{13903, 0, 0, 13, 1},
+	{25014, 0, 0, 11, 2},
+	{10543, 0, 0, 10, 1},
+	{10571, 0, 0, 4, 1},
+	{25025, 0, 0, 6, 1},
+	{15557, 0, 0, 8, 1},
+	{10686, 0, 0, 8, 1},
+	{10694, 0, 0, 7, 1},
+	{13959, 0, 0, 5, 1},
+	{25031, 0, 0, 7, 1},
+	{10722, 0, 0, 9, 1},
+	{10764, 0, 0, 7, 1},
+	{10781, 0, 0, 8, 1},
+	{25038, 0, 0, 9, 1},
+	{25047, 0, 0, 4, 1},
+	{25051, 0, 0, 5, 1},
+	{25056, 0, 0, 14, 1},
+	{25070, 0, 0, 7, 1},
+	{25077, 0, 0, 7, 1},
+	{25084, 0, 0, 15, 1},
+	{25099, 0, 0, 9, 1},
+	{25108, 0, 0, 17, 1},
+	{25125, 9135, 3, 6, 0},
+	{25131, 0, 0, 13, 1},
+	{11049, 0, 0, 8, 1},
+	{11057, 9138, 4, 6, 0},
+	{25144, 9142, 1, 8, 1},
+	{25152, 0, 0, 10, 1},
+	{25162, 0, 0, 8, 1},
+	{11114, 0, 0, 16, 1},
+	{25170, 0, 0, 12, 1},
+	{25182, 0, 0, 7, 1},
+	{25189, 0, 0, 7, 1},
+	{25196, 0, 0, 7, 1},
+	{25203, 0, 0, 7, 1},
+	{599, 0, 0, 2, 1},
+	{25210, 0, 0, 7, 1},
+	{25217, 0, 0, 12, 1},
+	{25229, 0, 0, 6, 1},
+	{25235, 0, 0, 5, 1},
+	{25240, 0, 0, 7, 1},
+	{25247, 0, 0, 6, 1},
+	{11661, 0, 0, 9, 1},
+	{11699, 0, 0, 8, 1},
+	{1131, 0, 0, 2, 1},
+	{202, 0, 0, 2, 1},
+	{14117, 0, 0, 6, 1},
+	{25253, 0, 0, 11, 1},
+	{14123, 0, 0, 6, 1},
+	{25264, 0, 0, 4, 1},
+	{25268, 0, 0, 7, 1},
+	{11861, 0, 0, 9, 1},
+	{11971, 0, 0, 9, 1},
+	{12506, 0, 0, 8, 1},
+	{3012, 0, 0, 2, 1},
+	{25275, 0, 0, 9, 1},
+	{25284, 0, 0, 8, 1},
+	{25292, 0, 0, 10, 1},
+	{25302, 0, 0, 8, 1},
+	{12680, 9143, 1, 11, 0},
+	{25310, 0, 0, 9, 1},
+	{25319, 0, 0, 6, 1},
+	{15660, 0, 0, 9, 1},
+	{25325, 0, 0, 7, 1},
+	{12755, 0, 0, 7, 1},
+	{25332, 0, 0, 9, 1},
+	{25341, 0, 0, 8, 1},
+	{25349, 0, 0, 7, 1},
+	{25356, 0, 0, 9, 1},
+	{25365, 0, 0, 5, 1},
+	{12785, 0, 0, 16, 1},
+	{8774, 0, 0, 12, 1},
+	{25370, 0, 0, 6, 1},
+	{8938, 0, 0, 5, 1},
+	{25376, 0, 0, 7, 1},
+	{25383, 0, 0, 13, 1},
+	{25396, 0, 0, 9, 1},
+	{4040, 9144, 2, 3, 0},
+	{25405, 0, 0, 5, 1},
+	{25410, 0, 0, 6, 1},
+	{25416, 0, 0, 7, 1},
+	{25423, 0, 0, 24, 1},
+	{13183, 0, 0, 8, 1},
+	{25447, 0, 0, 10, 1},
+	{13206, 0, 0, 14, 1},
+	{865, 0, 0, 2, 1},
+	{25457, 9146, 2, 11, 0},
+	{25468, 9148, 1, 10, 0},
+	{25478, 0, 0, 10, 1},
+	{25488, 0, 0, 13, 1},
+	{558, 0, 0, 2, 1},
+	{25501, 0, 0, 6, 1},
+	{8946, 0, 0, 6, 1},
+	{25507, 0, 0, 8, 1},
+	{25515, 0, 0, 10, 1},
+	{13290, 0, 0, 8, 1},
+	{25525, 0, 0, 9, 1},
+	{13338, 0, 0, 8, 1},
+	{25534, 0, 0, 14, 1},
+	{25548, 0, 0, 10, 1},
+	{25558, 0, 0, 8, 1},
+	{9753, 0, 0, 7, 1},
+	{25566, 9149, 2, 4, 0},
+	{25570, 0, 0, 13, 1},
+	{10081, 0, 0, 8, 1},
+	{13166, 0, 0, 5, 1},
+	{25583, 0, 0, 8, 1},
+	{25591, 9151, 1, 9, 0},
+	{25600, 0, 0, 8, 1},
+	{25608, 9152, 1, 10, 1},
+	{87, 0, 0, 2, 1},
+	{25618, 9153, 1, 8, 0},
+	{9713, 0, 0, 6, 1},
+	{3142, 0, 0, 2, 1},
+	{25626, 0, 0, 4, 1},
+	{25630, 0, 0, 6, 1},
+	{25636, 9154, 1, 8, 1},
+	{8952, 0, 0, 6, 1},
+	{25644, 9155, 2, 11, 1},
+	{206, 0, 0, 2, 1},
+	{25655, 0, 0, 5, 2},
+	{25660, 0, 0, 4, 1},
+	{25664, 0, 0, 7, 1},
+	{70, 0, 0, 2, 1},
+	{25671, 0, 0, 4, 1},
+	{25675, 0, 0, 10, 1},
+	{4074, 0, 0, 4, 1},
+	{1272, 0, 0, 3, 1},
+	{2081, 0, 0, 4, 1},
+	{2856, 0, 0, 4, 1},
+	{2158, 0, 0, 3, 1},
+	{859, 0, 0, 5, 1},
+	{1928, 0, 0, 3, 1},
+	{985, 0, 0, 3, 1},
+	{5035, 0, 0, 5, 1},
+	{5677, 0, 0, 3, 1},
+	{1258, 0, 0, 3, 1},
+	{1272, 9157, 1, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2081, 0, 0, 4, 1},
+	{140, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{26, 0, 0, 1, 1},
+	{3450, 0, 0, 3, 1},
+	{264, 0, 0, 3, 1},
+	{2830, 0, 0, 4, 1},
+	{238, 0, 0, 4, 1},
+	{2158, 0, 0, 3, 1},
+	{679, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{796, 0, 0, 3, 1},
+	{50, 0, 0, 2, 1},
+	{685, 0, 0, 3, 1},
+	{70, 0, 0, 2, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{680, 0, 0, 3, 1},
+	{202, 0, 0, 2, 1},
+	{2856, 0, 0, 4, 1},
+	{1110, 0, 0, 3, 1},
+	{264, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{7868, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{5677, 0, 0, 3, 1},
+	{8807, 0, 0, 10, 1},
+	{7871, 0, 0, 8, 1},
+	{25685, 0, 0, 7, 1},
+	{70, 0, 0, 2, 1},
+	{25692, 0, 0, 5, 1},
+	{2456, 0, 0, 3, 1},
+	{25697, 0, 0, 15, 1},
+	{25712, 0, 0, 6, 1},
+	{8774, 0, 0, 12, 1},
+	{8843, 0, 0, 8, 2},
+	{14589, 0, 0, 13, 1},
+	{0, 9158, 1, 2, 1},
+	{25718, 0, 0, 8, 1},
+	{25726, 0, 0, 6, 1},
+	{25732, 0, 0, 6, 1},
+	{25738, 0, 0, 7, 1},
+	{2711, 9159, 1, 2, 1},
+	{25745, 9160, 1, 8, 0},
+	{25753, 0, 0, 10, 1},
+	{25763, 0, 0, 8, 1},
+	{174, 0, 0, 2, 1},
+	{25771, 0, 0, 9, 1},
+	{25780, 0, 0, 7, 1},
+	{21112, 0, 0, 6, 1},
+	{25787, 0, 0, 9, 1},
+	{16349, 0, 0, 4, 1},
+	{25796, 0, 0, 6, 1},
+	{8633, 0, 0, 4, 1},
+	{5153, 0, 0, 4, 1},
+	{25802, 0, 0, 9, 1},
+	{25811, 0, 0, 6, 1},
+	{25817, 0, 0, 5, 1},
+	{20704, 0, 0, 5, 1},
+	{25822, 0, 0, 7, 1},
+	{25829, 0, 0, 7, 1},
+	{25836, 0, 0, 4, 1},
+	{25840, 0, 0, 6, 1},
+	{25846, 0, 0, 5, 1},
+	{25851, 0, 0, 5, 1},
+	{25856, 0, 0, 5, 1},
+	{25861, 0, 0, 7, 1},
+	{25868, 0, 0, 5, 1},
+	{25873, 0, 0, 9, 1},
+	{25882, 0, 0, 5, 1},
+	{25887, 0, 0, 4, 1},
+	{25891, 0, 0, 7, 1},
+	{25898, 0, 0, 14, 1},
+	{25912, 0, 0, 9, 1},
+	{25921, 0, 0, 9, 1},
+	{25930, 0, 0, 6, 1},
+	{25936, 0, 0, 8, 1},
+	{25944, 0, 0, 11, 1},
+	{25955, 0, 0, 12, 1},
+	{25967, 0, 0, 6, 1},
+	{25973, 0, 0, 7, 1},
+	{25980, 0, 0, 5, 1},
+	{25985, 0, 0, 10, 1},
+	{25995, 0, 0, 9, 1},
+	{26004, 0, 0, 9, 1},
+	{26013, 0, 0, 6, 1},
+	{26019, 0, 0, 5, 1},
+	{26024, 0, 0, 5, 1},
+	{26029, 0, 0, 9, 1},
+	{26038, 0, 0, 11, 1},
+	{26049, 0, 0, 6, 1},
+	{26055, 0, 0, 6, 1},
+	{726, 0, 0, 4, 1},
+	{26061, 0, 0, 6, 1},
+	{26067, 0, 0, 8, 1},
+	{26075, 0, 0, 6, 1},
+	{26081, 0, 0, 6, 1},
+	{26087, 0, 0, 8, 1},
+	{26095, 0, 0, 7, 1},
+	{26102, 0, 0, 9, 1},
+	{26111, 0, 0, 5, 1},
+	{7871, 0, 0, 8, 1},
+	{26116, 0, 0, 4, 1},
+	{26120, 0, 0, 4, 1},
+	{26124, 0, 0, 5, 1},
+	{26129, 0, 0, 9, 1},
+	{26138, 0, 0, 7, 1},
+	{26145, 0, 0, 11, 1},
+	{26156, 0, 0, 10, 1},
+	{26166, 0, 0, 5, 1},
+	{43, 9161, 1, 2, 1},
+	{26171, 0, 0, 7, 1},
+	{26178, 9162, 1, 8, 0},
+	{26186, 0, 0, 7, 1},
+	{26193, 0, 0, 5, 1},
+	{26198, 0, 0, 10, 1},
+	{70, 0, 0, 2, 1},
+	{26208, 0, 0, 11, 1},
+	{26219, 0, 0, 10, 1},
+	{26229, 0, 0, 6, 1},
+	{2679, 0, 0, 3, 1},
+	{26235, 0, 0, 13, 1},
+	{26248, 0, 0, 12, 1},
+	{26260, 0, 0, 13, 1},
+	{26273, 0, 0, 5, 1},
+	{26278, 0, 0, 5, 1},
+	{26283, 0, 0, 7, 1},
+	{26290, 0, 0, 9, 1},
+	{26299, 0, 0, 6, 1},
+	{26305, 0, 0, 5, 1},
+	{26310, 0, 0, 8, 1},
+	{25502, 0, 0, 3, 1},
+	{26318, 0, 0, 8, 1},
+	{26326, 0, 0, 8, 1},
+	{26334, 0, 0, 7, 1},
+	{26341, 0, 0, 8, 1},
+	{26349, 0, 0, 9, 1},
+	{26358, 0, 0, 7, 1},
+	{26365, 0, 0, 7, 1},
+	{26372, 0, 0, 8, 1},
+	{26380, 0, 0, 4, 1},
+	{26384, 0, 0, 7, 1},
+	{26391, 0, 0, 8, 1},
+	{26399, 0, 0, 6, 1},
+	{26405, 0, 0, 15, 1},
+	{26420, 0, 0, 7, 1},
+	{26427, 0, 0, 6, 1},
+	{26433, 0, 0, 5, 1},
+	{4604, 0, 0, 3, 1},
+	{26438, 0, 0, 7, 1},
+	{26445, 0, 0, 3, 1},
+	{26448, 0, 0, 6, 1},
+	{26454, 0, 0, 6, 1},
+	{26460, 0, 0, 6, 1},
+	{26466, 0, 0, 5, 1},
+	{122, 0, 0, 3, 1},
+	{26471, 0, 0, 8, 1},
+	{26479, 0, 0, 9, 1},
+	{26488, 0, 0, 11, 1},
+	{26499, 0, 0, 8, 1},
+	{26507, 0, 0, 5, 1},
+	{26512, 0, 0, 5, 1},
+	{2148, 9163, 1, 2, 1},
+	{26517, 0, 0, 9, 1},
+	{26526, 0, 0, 7, 1},
+	{26533, 0, 0, 5, 1},
+	{26538, 0, 0, 7, 1},
+	{26545, 0, 0, 6, 1},
+	{26551, 0, 0, 5, 1},
+	{26556, 0, 0, 11, 1},
+	{22160, 0, 0, 4, 1},
+	{26567, 0, 0, 5, 1},
+	{26572, 0, 0, 7, 1},
+	{26579, 0, 0, 6, 1},
+	{26585, 0, 0, 5, 1},
+	{26590, 0, 0, 7, 1},
+	{26597, 0, 0, 7, 1},
+	{26604, 0, 0, 4, 1},
+	{26608, 0, 0, 10, 1},
+	{26618, 0, 0, 8, 1},
+	{26626, 0, 0, 9, 1},
+	{26635, 0, 0, 5, 1},
+	{26640, 0, 0, 6, 1},
+	{26646, 0, 0, 10, 1},
+	{26656, 0, 0, 6, 1},
+	{26662, 0, 0, 7, 1},
+	{26669, 0, 0, 13, 1},
+	{26682, 0, 0, 9, 1},
+	{26691, 0, 0, 5, 1},
+	{26696, 0, 0, 7, 1},
+	{26703, 0, 0, 8, 1},
+	{26711, 0, 0, 8, 1},
+	{26719, 0, 0, 7, 1},
+	{26726, 0, 0, 6, 1},
+	{26732, 0, 0, 7, 1},
+	{2416, 0, 0, 3, 1},
+	{9279, 0, 0, 4, 1},
+	{26739, 0, 0, 5, 1},
+	{26744, 0, 0, 7, 1},
+	{26751, 0, 0, 9, 1},
+	{26760, 0, 0, 8, 1},
+	{26768, 0, 0, 5, 1},
+	{26773, 0, 0, 4, 1},
+	{26777, 0, 0, 5, 1},
+	{26782, 0, 0, 13, 1},
+	{12, 0, 0, 2, 1},
+	{26795, 0, 0, 6, 1},
+	{26801, 0, 0, 6, 1},
+	{26807, 0, 0, 10, 1},
+	{26817, 0, 0, 6, 1},
+	{26823, 0, 0, 5, 1},
+	{26828, 0, 0, 5, 1},
+	{26833, 0, 0, 7, 1},
+	{26840, 0, 0, 12, 1},
+	{26852, 0, 0, 10, 1},
+	{26862, 0, 0, 6, 1},
+	{26868, 0, 0, 5, 1},
+	{26873, 0, 0, 6, 1},
+	{26879, 0, 0, 7, 1},
+	{26886, 0, 0, 6, 1},
+	{26892, 0, 0, 12, 1},
+	{26904, 0, 0, 9, 1},
+	{26913, 9164, 3, 7, 0},
+	{26920, 0, 0, 5, 1},
+	{26925, 0, 0, 6, 1},
+	{26931, 0, 0, 8, 1},
+	{26939, 0, 0, 5, 1},
+	{26944, 0, 0, 5, 1},
+	{26949, 0, 0, 8, 1},
+	{26957, 0, 0, 10, 1},
+	{392, 9167, 1, 2, 1},
+	{2650, 9168, 1, 2, 1},
+	{26967, 0, 0, 5, 1},
+	{21220, 0, 0, 3, 1},
+	{26972, 0, 0, 8, 1},
+	{1036, 0, 0, 3, 1},
+	{26980, 0, 0, 4, 1},
+	{26984, 0, 0, 11, 1},
+	{26995, 0, 0, 8, 1},
+	{27003, 0, 0, 8, 1},
+	{27011, 9169, 1, 9, 0},
+	{27020, 0, 0, 9, 1},
+	{27029, 0, 0, 6, 1},
+	{27035, 0, 0, 8, 1},
+	{27043, 0, 0, 9, 1},
+	{27052, 0, 0, 6, 1},
+	{27058, 0, 0, 5, 1},
+	{27063, 0, 0, 6, 1},
+	{27069, 0, 0, 9, 1},
+	{27078, 0, 0, 7, 1},
+	{27085, 0, 0, 6, 1},
+	{27091, 0, 0, 7, 1},
+	{27098, 0, 0, 7, 1},
+	{27105, 0, 0, 4, 1},
+	{27109, 9170, 1, 9, 1},
+	{27118, 0, 0, 8, 1},
+	{27126, 0, 0, 8, 1},
+	{27134, 0, 0, 7, 1},
+	{27141, 0, 0, 6, 1},
+	{27147, 0, 0, 9, 1},
+	{27156, 0, 0, 7, 1},
+	{27163, 0, 0, 10, 1},
+	{27173, 0, 0, 8, 1},
+	{27181, 0, 0, 7, 1},
+	{27188, 0, 0, 6, 1},
+	{27194, 0, 0, 10, 1},
+	{27204, 0, 0, 8, 1},
+	{27212, 0, 0, 5, 1},
+	{27217, 0, 0, 5, 1},
+	{27222, 0, 0, 7, 1},
+	{27229, 0, 0, 9, 1},
+	{27238, 0, 0, 11, 1},
+	{27249, 0, 0, 8, 1},
+	{27257, 0, 0, 9, 1},
+	{27266, 0, 0, 7, 1},
+	{27273, 0, 0, 12, 1},
+	{27285, 0, 0, 12, 1},
+	{27297, 0, 0, 10, 1},
+	{27307, 0, 0, 12, 1},
+	{27319, 0, 0, 8, 1},
+	{27327, 0, 0, 8, 1},
+	{27335, 0, 0, 4, 1},
+	{27339, 0, 0, 9, 1},
+	{27348, 0, 0, 9, 1},
+	{27357, 0, 0, 10, 1},
+	{27367, 0, 0, 9, 1},
+	{27376, 0, 0, 7, 1},
+	{27383, 0, 0, 12, 1},
+	{27395, 0, 0, 6, 1},
+	{27401, 0, 0, 8, 1},
+	{27409, 0, 0, 6, 1},
+	{27415, 0, 0, 6, 1},
+	{27421, 0, 0, 7, 1},
+	{27428, 0, 0, 8, 1},
+	{27436, 0, 0, 11, 1},
+	{27447, 0, 0, 7, 1},
+	{27454, 0, 0, 9, 1},
+	{27463, 0, 0, 9, 1},
+	{27472, 0, 0, 7, 1},
+	{27479, 0, 0, 4, 1},
+	{27483, 0, 0, 7, 1},
+	{27490, 0, 0, 6, 1},
+	{27496, 0, 0, 6, 1},
+	{27502, 0, 0, 5, 1},
+	{27507, 0, 0, 8, 1},
+	{19083, 0, 0, 4, 1},
+	{27515, 0, 0, 6, 1},
+	{27521, 0, 0, 11, 1},
+	{27532, 0, 0, 9, 1},
+	{27541, 0, 0, 6, 1},
+	{27547, 0, 0, 9, 1},
+	{27556, 0, 0, 6, 1},
+	{27562, 0, 0, 8, 1},
+	{17000, 0, 0, 3, 1},
+	{27570, 0, 0, 5, 1},
+	{27575, 0, 0, 9, 1},
+	{27584, 0, 0, 5, 1},
+	{3457, 0, 0, 4, 1},
+	{27589, 0, 0, 6, 1},
+	{27595, 0, 0, 5, 1},
+	{25008, 0, 0, 6, 1},
+	{27600, 0, 0, 7, 1},
+	{27607, 0, 0, 6, 1},
+	{27613, 0, 0, 11, 1},
+	{27624, 0, 0, 7, 1},
+	{27631, 0, 0, 6, 1},
+	{27637, 0, 0, 6, 1},
+	{27643, 0, 0, 6, 1},
+	{27649, 0, 0, 9, 1},
+	{27658, 0, 0, 10, 1},
+	{27668, 0, 0, 5, 1},
+	{27673, 0, 0, 13, 1},
+	{26961, 0, 0, 6, 1},
+	{27686, 0, 0, 6, 1},
+	{27692, 0, 0, 6, 1},
+	{27698, 0, 0, 5, 1},
+	{27703, 0, 0, 7, 1},
+	{27710, 0, 0, 7, 1},
+	{27717, 0, 0, 14, 1},
+	{264, 0, 0, 3, 1},
+	{27731, 0, 0, 9, 1},
+	{27740, 0, 0, 9, 1},
+	{27749, 0, 0, 7, 1},
+	{27756, 0, 0, 7, 1},
+	{27763, 0, 0, 5, 1},
+	{27768, 0, 0, 5, 1},
+	{27773, 9171, 2, 15, 0},
+	{27788, 0, 0, 7, 1},
+	{27795, 0, 0, 8, 1},
+	{27803, 0, 0, 4, 1},
+	{27807, 0, 0, 6, 1},
+	{1516, 9173, 1, 2, 1},
+	{27813, 0, 0, 6, 1},
+	{3755, 0, 0, 6, 1},
+	{8774, 0, 0, 12, 1},
+	{27819, 0, 0, 14, 1},
+	{27833, 0, 0, 10, 1},
+	{27843, 0, 0, 6, 1},
+	{27849, 0, 0, 10, 1},
+	{27859, 0, 0, 9, 1},
+	{27868, 0, 0, 5, 1},
+	{27873, 0, 0, 8, 1},
+	{27881, 0, 0, 6, 1},
+	{27887, 0, 0, 8, 1},
+	{27895, 0, 0, 8, 1},
+	{27903, 0, 0, 11, 1},
+	{27914, 0, 0, 5, 1},
+	{27919, 0, 0, 8, 1},
+	{27927, 0, 0, 12, 1},
+	{27939, 0, 0, 7, 1},
+	{27946, 0, 0, 6, 1},
+	{27952, 0, 0, 8, 1},
+	{27960, 0, 0, 8, 1},
+	{1740, 9174, 1, 2, 1},
+	{27968, 0, 0, 11, 1},
+	{27979, 0, 0, 9, 1},
+	{27988, 0, 0, 9, 1},
+	{27997, 0, 0, 7, 1},
+	{28004, 0, 0, 8, 1},
+	{28012, 9175, 4, 8, 0},
+	{28020, 0, 0, 11, 1},
+	{28031, 0, 0, 9, 1},
+	{28040, 0, 0, 13, 1},
+	{28053, 0, 0, 8, 1},
+	{28061, 0, 0, 8, 1},
+	{63, 9179, 1, 2, 1},
+	{28069, 0, 0, 4, 1},
+	{770, 9180, 1, 2, 1},
+	{28073, 0, 0, 6, 1},
+	{316, 9181, 1, 2, 1},
+	{28079, 0, 0, 10, 1},
+	{28089, 0, 0, 6, 1},
+	{28095, 0, 0, 8, 1},
+	{28103, 0, 0, 8, 1},
+	{28111, 0, 0, 6, 1},
+	{28117, 0, 0, 6, 1},
+	{28123, 0, 0, 6, 1},
+	{5157, 0, 0, 5, 1},
+	{16523, 0, 0, 4, 1},
+	{28129, 9182, 1, 4, 1},
+	{28133, 0, 0, 6, 1},
+	{28139, 0, 0, 7, 1},
+	{28146, 9183, 1, 7, 0},
+	{28153, 0, 0, 11, 1},
+	{28164, 0, 0, 9, 1},
+	{28173, 0, 0, 10, 1},
+	{28183, 0, 0, 4, 1},
+	{28187, 0, 0, 8, 1},
+	{28195, 0, 0, 13, 1},
+	{28208, 0, 0, 9, 1},
+	{28217, 0, 0, 8, 1},
+	{28225, 0, 0, 9, 1},
+	{8794, 0, 0, 4, 1},
+	{825, 0, 0, 4, 1},
+	{28234, 0, 0, 5, 1},
+	{28239, 0, 0, 11, 1},
+	{28250, 0, 0, 6, 1},
+	{28256, 0, 0, 5, 1},
+	{28261, 0, 0, 9, 1},
+	{28270, 0, 0, 8, 1},
+	{3786, 0, 0, 4, 1},
+	{28278, 0, 0, 9, 1},
+	{28287, 0, 0, 5, 1},
+	{28292, 0, 0, 8, 1},
+	{28300, 0, 0, 7, 1},
+	{28307, 0, 0, 8, 1},
+	{28315, 0, 0, 6, 1},
+	{28321, 0, 0, 7, 1},
+	{28328, 0, 0, 9, 1},
+	{28337, 0, 0, 9, 1},
+	{28346, 0, 0, 5, 1},
+	{28351, 0, 0, 5, 1},
+	{631, 9184, 1, 2, 1},
+	{20774, 0, 0, 4, 1},
+	{28356, 0, 0, 5, 1},
+	{28361, 0, 0, 6, 1},
+	{28367, 0, 0, 5, 1},
+	{28372, 0, 0, 7, 1},
+	{28379, 0, 0, 5, 1},
+	{26580, 0, 0, 4, 1},
+	{28384, 0, 0, 6, 1},
+	{28390, 0, 0, 7, 1},
+	{28397, 0, 0, 6, 1},
+	{28403, 0, 0, 5, 1},
+	{28408, 0, 0, 8, 1},
+	{1892, 0, 0, 5, 1},
+	{28416, 0, 0, 7, 1},
+	{28423, 0, 0, 9, 1},
+	{28432, 0, 0, 10, 1},
+	{28442, 0, 0, 7, 1},
+	{28449, 0, 0, 12, 1},
+	{28461, 0, 0, 6, 1},
+	{28467, 0, 0, 9, 1},
+	{28476, 0, 0, 5, 1},
+	{28481, 0, 0, 8, 1},
+	{868, 0, 0, 3, 1},
+	{28489, 0, 0, 5, 1},
+	{28494, 0, 0, 5, 1},
+	{28499, 0, 0, 7, 1},
+	{1965, 9185, 1, 2, 1},
+	{28506, 0, 0, 7, 1},
+	{28513, 0, 0, 6, 1},
+	{28519, 0, 0, 6, 1},
+	{28525, 0, 0, 6, 1},
+	{28531, 0, 0, 6, 1},
+	{28537, 0, 0, 8, 1},
+	{28545, 0, 0, 5, 1},
+	{28550, 0, 0, 7, 1},
+	{28557, 0, 0, 13, 1},
+	{3100, 0, 0, 3, 1},
+	{28570, 0, 0, 5, 1},
+	{28575, 0, 0, 7, 1},
+	{28582, 0, 0, 8, 1},
+	{28590, 0, 0, 5, 1},
+	{28595, 0, 0, 8, 1},
+	{28603, 0, 0, 6, 1},
+	{28609, 0, 0, 7, 1},
+	{28616, 0, 0, 5, 1},
+	{28621, 0, 0, 6, 1},
+	{28627, 0, 0, 5, 1},
+	{28632, 0, 0, 10, 1},
+	{28642, 0, 0, 6, 1},
+	{28648, 0, 0, 7, 1},
+	{28655, 0, 0, 5, 1},
+	{28660, 0, 0, 7, 1},
+	{4944, 0, 0, 4, 1},
+	{28667, 0, 0, 6, 1},
+	{28673, 0, 0, 5, 1},
+	{28678, 0, 0, 11, 1},
+	{28689, 0, 0, 9, 1},
+	{28698, 0, 0, 10, 1},
+	{28708, 0, 0, 8, 1},
+	{28716, 0, 0, 8, 1},
+	{28724, 0, 0, 12, 1},
+	{28736, 0, 0, 7, 1},
+	{28743, 0, 0, 8, 1},
+	{28751, 0, 0, 8, 1},
+	{28759, 0, 0, 5, 1},
+	{28764, 0, 0, 10, 1},
+	{28774, 0, 0, 9, 1},
+	{210, 9186, 1, 2, 1},
+	{28783, 0, 0, 6, 1},
+	{210, 0, 0, 4, 1},
+	{28789, 0, 0, 9, 1},
+	{28798, 0, 0, 9, 1},
+	{28807, 0, 0, 7, 1},
+	{28814, 0, 0, 7, 1},
+	{28821, 0, 0, 9, 1},
+	{28830, 0, 0, 8, 1},
+	{28838, 0, 0, 15, 1},
+	{28853, 0, 0, 6, 1},
+	{28859, 0, 0, 11, 1},
+	{28870, 0, 0, 5, 1},
+	{28875, 0, 0, 7, 1},
+	{28882, 0, 0, 9, 1},
+	{25989, 0, 0, 6, 1},
+	{28891, 0, 0, 7, 1},
+	{28898, 0, 0, 5, 1},
+	{28903, 0, 0, 4, 1},
+	{28907, 0, 0, 6, 1},
+	{1555, 0, 0, 4, 1},
+	{28913, 0, 0, 7, 1},
+	{28920, 0, 0, 8, 1},
+	{28928, 9187, 1, 8, 1},
+	{28936, 0, 0, 5, 1},
+	{28941, 0, 0, 7, 1},
+	{28948, 0, 0, 9, 1},
+	{28957, 0, 0, 4, 1},
+	{28961, 0, 0, 8, 1},
+	{28969, 9188, 2, 8, 0},
+	{4858, 0, 0, 4, 1},
+	{28977, 0, 0, 8, 1},
+	{28985, 0, 0, 4, 1},
+	{28989, 0, 0, 9, 1},
+	{28998, 0, 0, 5, 1},
+	{322, 9190, 1, 2, 1},
+	{28854, 0, 0, 5, 1},
+	{29003, 0, 0, 5, 1},
+	{29008, 0, 0, 8, 1},
+	{29016, 0, 0, 7, 1},
+	{1337, 9191, 1, 2, 1},
+	{29023, 0, 0, 5, 1},
+	{29028, 0, 0, 6, 1},
+	{29034, 0, 0, 6, 1},
+	{29040, 0, 0, 8, 1},
+	{29048, 0, 0, 8, 1},
+	{29056, 0, 0, 6, 1},
+	{29062, 0, 0, 6, 1},
+	{29068, 0, 0, 9, 1},
+	{29077, 0, 0, 6, 1},
+	{29083, 0, 0, 11, 1},
+	{29094, 0, 0, 5, 1},
+	{29099, 0, 0, 6, 1},
+	{29105, 0, 0, 8, 1},
+	{29113, 0, 0, 6, 1},
+	{29119, 0, 0, 6, 1},
+	{29125, 0, 0, 10, 1},
+	{29135, 0, 0, 10, 1},
+	{29145, 0, 0, 5, 1},
+	{29150, 0, 0, 7, 1},
+	{29157, 0, 0, 6, 1},
+	{595, 9192, 1, 2, 1},
+	{29163, 0, 0, 7, 1},
+	{29170, 0, 0, 5, 1},
+	{29175, 0, 0, 4, 1},
+	{29179, 0, 0, 5, 1},
+	{29184, 0, 0, 6, 1},
+	{29190, 0, 0, 7, 1},
+	{16047, 0, 0, 5, 1},
+	{5471, 0, 0, 4, 1},
+	{29197, 0, 0, 8, 1},
+	{29205, 0, 0, 5, 1},
+	{29210, 0, 0, 7, 1},
+	{29217, 0, 0, 5, 1},
+	{29222, 0, 0, 5, 1},
+	{5479, 0, 0, 4, 1},
+	{29227, 0, 0, 9, 1},
+	{29236, 0, 0, 8, 1},
+	{29244, 0, 0, 6, 1},
+	{29250, 0, 0, 6, 1},
+	{29256, 0, 0, 6, 1},
+	{29262, 9193, 1, 8, 0},
+	{29270, 0, 0, 7, 1},
+	{29277, 0, 0, 13, 1},
+	{29290, 0, 0, 12, 1},
+	{29302, 0, 0, 9, 1},
+	{29311, 0, 0, 9, 1},
+	{6885, 9194, 1, 2, 1},
+	{29320, 0, 0, 3, 1},
+	{4638, 0, 0, 3, 1},
+	{27884, 0, 0, 5, 1},
+	{29323, 0, 0, 10, 1},
+	{29333, 0, 0, 6, 1},
+	{29339, 0, 0, 5, 1},
+	{29344, 0, 0, 4, 1},
+	{29348, 0, 0, 11, 1},
+	{29359, 0, 0, 12, 1},
+	{29371, 0, 0, 12, 1},
+	{29383, 0, 0, 21, 1},
+	{29404, 0, 0, 13, 1},
+	{29417, 0, 0, 15, 1},
+	{29432, 0, 0, 18, 1},
+	{29450, 0, 0, 15, 1},
+	{29465, 0, 0, 18, 1},
+	{29483, 0, 0, 19, 1},
+	{29502, 0, 0, 13, 1},
+	{29515, 0, 0, 13, 1},
+	{29528, 0, 0, 14, 1},
+	{29542, 0, 0, 14, 1},
+	{29556, 0, 0, 12, 1},
+	{29568, 0, 0, 12, 1},
+	{29580, 0, 0, 11, 1},
+	{29591, 0, 0, 14, 1},
+	{29605, 0, 0, 18, 1},
+	{29623, 0, 0, 12, 1},
+	{29635, 0, 0, 16, 1},
+	{29651, 0, 0, 18, 1},
+	{29669, 0, 0, 12, 1},
+	{29681, 0, 0, 13, 1},
+	{29694, 0, 0, 12, 1},
+	{29706, 0, 0, 17, 1},
+	{29723, 0, 0, 13, 1},
+	{29736, 0, 0, 13, 1},
+	{29749, 0, 0, 10, 1},
+	{29759, 0, 0, 12, 1},
+	{29771, 0, 0, 12, 1},
+	{29783, 0, 0, 12, 1},
+	{29795, 0, 0, 12, 1},
+	{29807, 0, 0, 19, 1},
+	{29826, 0, 0, 16, 1},
+	{29842, 0, 0, 16, 1},
+	{29858, 0, 0, 13, 1},
+	{29871, 0, 0, 12, 1},
+	{29883, 0, 0, 9, 1},
+	{29892, 0, 0, 13, 1},
+	{29905, 0, 0, 19, 1},
+	{29924, 0, 0, 17, 1},
+	{29941, 0, 0, 19, 1},
+	{29960, 0, 0, 15, 1},
+	{29975, 0, 0, 12, 1},
+	{29987, 0, 0, 15, 1},
+	{30002, 0, 0, 13, 1},
+	{30015, 0, 0, 15, 1},
+	{30030, 0, 0, 16, 1},
+	{30046, 0, 0, 14, 1},
+	{30060, 0, 0, 14, 1},
+	{30074, 0, 0, 16, 1},
+	{30090, 0, 0, 13, 1},
+	{30103, 0, 0, 14, 1},
+	{30117, 0, 0, 12, 1},
+	{30129, 0, 0, 19, 1},
+	{30148, 0, 0, 14, 1},
+	{30162, 0, 0, 16, 1},
+	{30178, 0, 0, 17, 1},
+	{30195, 0, 0, 15, 1},
+	{30210, 0, 0, 19, 1},
+	{30229, 0, 0, 13, 1},
+	{30242, 0, 0, 15, 1},
+	{30257, 0, 0, 14, 1},
+	{30271, 0, 0, 16, 1},
+	{30287, 0, 0, 9, 1},
+	{30296, 0, 0, 16, 1},
+	{30312, 0, 0, 15, 1},
+	{30327, 0, 0, 15, 1},
+	{30342, 0, 0, 18, 1},
+	{30360, 0, 0, 14, 1},
+	{30374, 0, 0, 13, 1},
+	{30387, 0, 0, 13, 1},
+	{30400, 0, 0, 13, 1},
+	{30413, 0, 0, 13, 1},
+	{30426, 0, 0, 13, 1},
+	{30439, 0, 0, 16, 1},
+	{30455, 0, 0, 11, 1},
+	{30466, 0, 0, 12, 1},
+	{30478, 0, 0, 12, 1},
+	{30490, 0, 0, 12, 1},
+	{30502, 0, 0, 14, 1},
+	{30516, 0, 0, 16, 1},
+	{30532, 0, 0, 18, 1},
+	{30550, 0, 0, 11, 1},
+	{30561, 0, 0, 14, 1},
+	{30575, 0, 0, 14, 1},
+	{30589, 0, 0, 14, 1},
+	{30603, 0, 0, 11, 1},
+	{30614, 9195, 2, 22, 0},
+	{30636, 0, 0, 13, 1},
+	{30649, 0, 0, 20, 1},
+	{30669, 0, 0, 13, 1},
+	{30682, 0, 0, 21, 1},
+	{30703, 0, 0, 13, 1},
+	{30716, 0, 0, 15, 1},
+	{30731, 0, 0, 15, 1},
+	{30746, 0, 0, 15, 1},
+	{30761, 0, 0, 14, 1},
+	{30775, 0, 0, 13, 1},
+	{30788, 0, 0, 17, 1},
+	{30805, 0, 0, 12, 1},
+	{30817, 0, 0, 12, 1},
+	{30829, 0, 0, 11, 1},
+	{30840, 0, 0, 12, 1},
+	{30852, 0, 0, 15, 1},
+	{30867, 0, 0, 18, 1},
+	{30885, 0, 0, 13, 1},
+	{30898, 0, 0, 12, 1},
+	{30910, 0, 0, 12, 1},
+	{30922, 0, 0, 13, 1},
+	{30935, 0, 0, 15, 1},
+	{30950, 0, 0, 14, 1},
+	{30964, 0, 0, 12, 1},
+	{30976, 0, 0, 13, 1},
+	{30989, 0, 0, 11, 1},
+	{31000, 0, 0, 12, 1},
+	{31012, 0, 0, 13, 1},
+	{31025, 0, 0, 14, 1},
+	{31039, 0, 0, 9, 1},
+	{31048, 0, 0, 19, 1},
+	{31067, 0, 0, 13, 1},
+	{31080, 0, 0, 13, 1},
+	{31093, 0, 0, 12, 1},
+	{31105, 0, 0, 14, 1},
+	{31119, 0, 0, 15, 1},
+	{31134, 0, 0, 12, 1},
+	{31146, 0, 0, 13, 1},
+	{31159, 0, 0, 15, 1},
+	{31174, 0, 0, 12, 1},
+	{31186, 0, 0, 12, 1},
+	{31198, 0, 0, 12, 1},
+	{31210, 0, 0, 12, 1},
+	{31222, 0, 0, 13, 1},
+	{31235, 0, 0, 18, 1},
+	{31253, 0, 0, 12, 1},
+	{31265, 0, 0, 12, 1},
+	{31277, 0, 0, 17, 1},
+	{31294, 0, 0, 15, 1},
+	{31309, 0, 0, 15, 1},
+	{31324, 0, 0, 19, 1},
+	{31343, 0, 0, 14, 1},
+	{31357, 0, 0, 15, 1},
+	{31372, 0, 0, 12, 1},
+	{31384, 9197, 1, 14, 0},
+	{31398, 0, 0, 15, 1},
+	{31413, 0, 0, 22, 1},
+	{31435, 0, 0, 18, 1},
+	{31453, 0, 0, 12, 1},
+	{31465, 0, 0, 15, 1},
+	{31480, 0, 0, 13, 1},
+	{31493, 0, 0, 15, 1},
+	{31508, 0, 0, 12, 1},
+	{31520, 0, 0, 13, 1},
+	{31533, 0, 0, 13, 1},
+	{31546, 0, 0, 14, 1},
+	{31560, 0, 0, 12, 1},
+	{31572, 0, 0, 12, 1},
+	{31584, 0, 0, 16, 1},
+	{31600, 0, 0, 17, 1},
+	{31617, 0, 0, 11, 1},
+	{31628, 0, 0, 12, 1},
+	{31640, 0, 0, 14, 1},
+	{31654, 0, 0, 17, 1},
+	{31671, 0, 0, 14, 1},
+	{31685, 0, 0, 13, 1},
+	{31698, 0, 0, 11, 1},
+	{31709, 0, 0, 15, 1},
+	{31724, 0, 0, 20, 1},
+	{685, 0, 0, 3, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2856, 0, 0, 4, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{31744, 0, 0, 15, 1},
+	{31759, 0, 0, 8, 1},
+	{22953, 0, 0, 4, 1},
+	{31767, 0, 0, 8, 1},
+	{50, 0, 0, 2, 1},
+	{70, 9198, 1, 2, 1},
+	{1468, 0, 0, 3, 1},
+	{10588, 0, 0, 4, 1},
+	{140, 0, 0, 3, 1},
+	{31775, 0, 0, 4, 1},
+	{2578, 0, 0, 6, 1},
+	{3124, 0, 0, 3, 1},
+	{3123, 0, 0, 4, 1},
+	{31779, 0, 0, 5, 1},
+	{264, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{31784, 0, 0, 10, 1},
+	{4709, 0, 0, 6, 1},
+	{31794, 0, 0, 12, 1},
+	{70, 0, 0, 2, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{1237, 0, 0, 3, 1},
+	{3755, 0, 0, 6, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{3079, 0, 0, 3, 1},
+	{31806, 0, 0, 8, 1},
+	{31814, 9199, 1, 5, 1},
+	{4778, 0, 0, 7, 1},
+	{8861, 0, 0, 5, 1},
+	{31819, 0, 0, 4, 1},
+	{31823, 0, 0, 10, 1},
+	{5188, 0, 0, 4, 1},
+	{31833, 0, 0, 9, 1},
+	{105, 0, 0, 2, 1},
+	{31842, 0, 0, 10, 1},
+	{31852, 9200, 1, 5, 0},
+	{8861, 0, 0, 5, 1},
+	{10358, 0, 0, 7, 1},
+	{31857, 0, 0, 8, 1},
+	{31865, 0, 0, 14, 1},
+	{31879, 0, 0, 18, 1},
+	{31897, 0, 0, 11, 1},
+	{31908, 0, 0, 6, 1},
+	{24931, 9201, 2, 5, 0},
+	{31914, 9203, 1, 12, 0},
+	{31926, 0, 0, 7, 1},
+	{8691, 0, 0, 7, 1},
+	{31933, 0, 0, 10, 1},
+	{31943, 0, 0, 16, 1},
+	{13929, 0, 0, 5, 1},
+	{14353, 0, 0, 11, 1},
+	{10686, 0, 0, 8, 1},
+	{10694, 0, 0, 7, 1},
+	{10711, 0, 0, 11, 1},
+	{10722, 0, 0, 9, 1},
+	{10731, 0, 0, 7, 1},
+	{10764, 0, 0, 7, 1},
+	{31959, 0, 0, 7, 1},
+	{31966, 0, 0, 6, 1},
+	{10781, 0, 0, 8, 1},
+	{8884, 9204, 2, 6, 1},
+	{31972, 0, 0, 7, 1},
+	{25131, 0, 0, 13, 1},
+	{31979, 0, 0, 16, 1},
+	{1897, 9206, 55, 2, 1},
+	{11049, 0, 0, 8, 1},
+	{31995, 0, 0, 16, 1},
+	{32011, 0, 0, 12, 1},
+	{32023, 9261, 3, 13, 0},
+	{10580, 0, 0, 8, 1},
+	{32036, 0, 0, 11, 1},
+	{32047, 0, 0, 7, 1},
+	{32054, 0, 0, 9, 1},
+	{9733, 0, 0, 6, 1},
+	{32063, 0, 0, 8, 1},
+	{2645, 0, 0, 2, 1},
+	{11651, 0, 0, 10, 1},
+	{13955, 0, 0, 7, 1},
+	{25240, 0, 0, 7, 1},
+	{11661, 0, 0, 9, 1},
+	{11699, 0, 0, 8, 1},
+	{20607, 0, 0, 5, 1},
+	{32071, 0, 0, 7, 1},
+	{14117, 0, 0, 6, 1},
+	{14123, 0, 0, 6, 1},
+	{32078, 0, 0, 14, 1},
+	{32092, 0, 0, 14, 1},
+	{32106, 0, 0, 15, 1},
+	{11861, 0, 0, 9, 1},
+	{11971, 0, 0, 9, 1},
+	{32121, 0, 0, 11, 1},
+	{32132, 0, 0, 15, 1},
+	{32147, 0, 0, 12, 1},
+	{32159, 0, 0, 11, 1},
+	{32170, 0, 0, 8, 1},
+	{32178, 0, 0, 7, 1},
+	{32185, 0, 0, 8, 1},
+	{32193, 0, 0, 11, 1},
+	{32204, 0, 0, 12, 1},
+	{32216, 0, 0, 12, 1},
+	{32228, 0, 0, 12, 1},
+	{32240, 0, 0, 13, 1},
+	{12506, 0, 0, 8, 1},
+	{9999, 0, 0, 2, 1},
+	{25275, 0, 0, 9, 1},
+	{15383, 0, 0, 8, 1},
+	{32253, 0, 0, 11, 1},
+	{32264, 0, 0, 6, 1},
+	{32270, 0, 0, 11, 1},
+	{32281, 0, 0, 11, 1},
+	{32292, 0, 0, 10, 1},
+	{8933, 0, 0, 5, 1},
+	{12785, 0, 0, 16, 1},
+	{32302, 0, 0, 6, 1},
+	{32308, 0, 0, 6, 1},
+	{8938, 0, 0, 5, 1},
+	{25376, 0, 0, 7, 1},
+	{32314, 0, 0, 8, 1},
+	{25416, 0, 0, 7, 1},
+	{32322, 0, 0, 7, 1},
+	{32329, 0, 0, 7, 1},
+	{32336, 0, 0, 6, 1},
+	{32342, 0, 0, 10, 1},
+	{32352, 0, 0, 10, 1},
+	{8946, 0, 0, 6, 1},
+	{32362, 0, 0, 13, 1},
+	{13290, 0, 0, 8, 1},
+	{13338, 0, 0, 8, 1},
+	{13346, 0, 0, 9, 1},
+	{32375, 0, 0, 9, 1},
+	{14311, 0, 0, 5, 1},
+	{32384, 0, 0, 12, 1},
+	{32396, 0, 0, 11, 1},
+	{32407, 9264, 1, 7, 0},
+	{32414, 0, 0, 9, 1},
+	{32423, 0, 0, 4, 1},
+	{32427, 0, 0, 9, 1},
+	{9713, 0, 0, 6, 1},
+	{32436, 0, 0, 6, 1},
+	{154, 0, 0, 2, 1},
+	{8952, 0, 0, 6, 1},
+	{32442, 0, 0, 11, 1},
+	{32453, 0, 0, 7, 1},
+	{32460, 0, 0, 7, 1},
+	{206, 0, 0, 2, 1},
+	{32467, 0, 0, 5, 1},
+	{32472, 0, 0, 7, 1},
+	{35, 0, 0, 3, 1},
+	{50, 0, 0, 2, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{680, 0, 0, 3, 1},
+	{674, 0, 0, 3, 1},
+	{1237, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{7868, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{14602, 0, 0, 3, 1},
+	{32479, 0, 0, 8, 1},
+	{20485, 0, 0, 3, 1},
+	{32487, 0, 0, 4, 1},
+	{32491, 0, 0, 6, 1},
+	{10685, 0, 0, 4, 1},
+	{13081, 0, 0, 5, 1},
+	{32497, 0, 0, 5, 1},
+	{32502, 0, 0, 5, 1},
+	{14941, 0, 0, 10, 1},
+	{14649, 0, 0, 3, 1},
+	{7871, 0, 0, 8, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{680, 0, 0, 3, 1},
+	{264, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{7868, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{26, 0, 0, 1, 1},
+	{264, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{679, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{8535, 0, 0, 6, 1},
+	{32507, 0, 0, 4, 1},
+	{685, 0, 0, 3, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{262, 0, 0, 3, 1},
+	{680, 0, 0, 3, 1},
+	{32511, 0, 0, 3, 1},
+	{3984, 0, 0, 3, 1},
+	{2450, 0, 0, 3, 1},
+	{3029, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2856, 0, 0, 4, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{5677, 0, 0, 3, 1},
+	{8958, 0, 0, 4, 1},
+	{479, 0, 0, 3, 1},
+	{9, 0, 0, 3, 1},
+	{27684, 0, 0, 3, 1},
+	{32514, 0, 0, 8, 1},
+	{443, 0, 0, 4, 1},
+	{32522, 0, 0, 10, 1},
+	{32532, 0, 0, 6, 1},
+	{32538, 0, 0, 4, 1},
+	{32542, 0, 0, 7, 1},
+	{32549, 0, 0, 10, 1},
+	{32559, 0, 0, 9, 1},
+	{32568, 0, 0, 7, 1},
+	{32575, 0, 0, 10, 1},
+	{685, 0, 0, 3, 1},
+	{32585, 0, 0, 11, 1},
+	{32596, 0, 0, 9, 1},
+	{32605, 0, 0, 5, 1},
+	{32610, 0, 0, 7, 1},
+	{70, 0, 0, 2, 1},
+	{1272, 0, 0, 3, 1},
+	{32617, 0, 0, 7, 1},
+	{32624, 0, 0, 5, 1},
+	{32629, 0, 0, 9, 1},
+	{32638, 0, 0, 14, 1},
+	{1795, 0, 0, 3, 1},
+	{32652, 0, 0, 6, 1},
+	{28767, 0, 0, 3, 1},
+	{1551, 0, 0, 3, 1},
+	{32658, 0, 0, 6, 1},
+	{32664, 0, 0, 6, 1},
+	{32670, 0, 0, 7, 1},
+	{32677, 0, 0, 6, 1},
+	{32683, 0, 0, 5, 1},
+	{32688, 0, 0, 7, 1},
+	{32695, 0, 0, 7, 1},
+	{2456, 9265, 47, 3, 1},
+	{32702, 0, 0, 7, 1},
+	{4897, 0, 0, 3, 1},
+	{32709, 0, 0, 9, 1},
+	{32718, 0, 0, 5, 1},
+	{2856, 0, 0, 4, 1},
+	{32723, 0, 0, 8, 1},
+	{32731, 0, 0, 12, 1},
+	{32743, 0, 0, 5, 1},
+	{32748, 0, 0, 6, 1},
+	{32754, 0, 0, 7, 1},
+	{32761, 0, 0, 7, 1},
+	{32768, 0, 0, 7, 1},
+	{32775, 0, 0, 8, 1},
+	{32783, 0, 0, 15, 1},
+	{32798, 0, 0, 5, 1},
+	{32803, 0, 0, 7, 1},
+	{32810, 0, 0, 7, 1},
+	{32817, 0, 0, 10, 1},
+	{32827, 0, 0, 9, 1},
+	{32836, 0, 0, 5, 1},
+	{32841, 0, 0, 10, 1},
+	{32851, 0, 0, 6, 1},
+	{32857, 0, 0, 7, 1},
+	{32864, 0, 0, 5, 1},
+	{32869, 0, 0, 4, 1},
+	{32873, 0, 0, 6, 1},
+	{32879, 0, 0, 6, 1},
+	{32885, 0, 0, 7, 1},
+	{32892, 0, 0, 7, 1},
+	{32899, 0, 0, 8, 1},
+	{32907, 0, 0, 5, 1},
+	{32912, 0, 0, 6, 1},
+	{32918, 0, 0, 8, 1},
+	{32926, 0, 0, 5, 1},
+	{32931, 0, 0, 6, 1},
+	{32937, 0, 0, 5, 1},
+	{1808, 0, 0, 4, 1},
+	{32942, 0, 0, 7, 1},
+	{32949, 0, 0, 10, 1},
+	{32959, 0, 0, 8, 1},
+	{32967, 0, 0, 6, 1},
+	{1237, 0, 0, 3, 1},
+	{3581, 0, 0, 5, 1},
+	{32973, 0, 0, 6, 1},
+	{32979, 0, 0, 6, 1},
+	{32985, 0, 0, 6, 1},
+	{264, 0, 0, 3, 1},
+	{32991, 0, 0, 7, 1},
+	{8774, 0, 0, 12, 1},
+	{32998, 0, 0, 5, 1},
+	{2158, 0, 0, 3, 1},
+	{33003, 0, 0, 13, 1},
+	{7868, 0, 0, 3, 1},
+	{33016, 0, 0, 8, 1},
+	{33024, 0, 0, 4, 1},
+	{33028, 0, 0, 5, 1},
+	{33033, 0, 0, 6, 1},
+	{33039, 0, 0, 6, 1},
+	{33045, 0, 0, 7, 1},
+	{33052, 0, 0, 7, 1},
+	{33059, 0, 0, 5, 1},
+	{2343, 0, 0, 3, 1},
+	{33064, 0, 0, 7, 1},
+	{33071, 0, 0, 9, 1},
+	{33080, 0, 0, 9, 1},
+	{33089, 0, 0, 10, 1},
+	{940, 0, 0, 2, 1},
+	{27399, 0, 0, 4, 1},
+	{33099, 0, 0, 4, 1},
+	{33103, 0, 0, 7, 1},
+	{33110, 0, 0, 8, 1},
+	{33118, 0, 0, 9, 1},
+	{33127, 0, 0, 9, 1},
+	{33136, 0, 0, 7, 1},
+	{33143, 0, 0, 9, 1},
+	{33152, 0, 0, 6, 1},
+	{33158, 0, 0, 6, 1},
+	{8794, 0, 0, 4, 1},
+	{33164, 0, 0, 10, 1},
+	{33174, 0, 0, 8, 1},
+	{33182, 0, 0, 9, 1},
+	{33191, 0, 0, 6, 1},
+	{33197, 0, 0, 5, 1},
+	{33202, 0, 0, 8, 1},
+	{4378, 0, 0, 10, 1},
+	{342, 0, 0, 3, 1},
+	{33210, 0, 0, 6, 1},
+	{33216, 0, 0, 7, 1},
+	{33223, 0, 0, 5, 1},
+	{33228, 0, 0, 8, 1},
+	{33236, 0, 0, 5, 1},
+	{1917, 0, 0, 3, 1},
+	{4832, 0, 0, 4, 1},
+	{33241, 0, 0, 9, 1},
+	{13470, 0, 0, 10, 1},
+	{32713, 0, 0, 5, 1},
+	{33250, 0, 0, 7, 1},
+	{33257, 0, 0, 5, 1},
+	{33262, 0, 0, 6, 1},
+	{33268, 0, 0, 5, 1},
+	{4028, 0, 0, 3, 1},
+	{33273, 0, 0, 9, 1},
+	{33282, 0, 0, 12, 1},
+	{33294, 0, 0, 12, 1},
+	{33306, 0, 0, 8, 1},
+	{33314, 0, 0, 7, 1},
+	{33321, 0, 0, 8, 1},
+	{33329, 0, 0, 7, 1},
+	{33336, 0, 0, 10, 1},
+	{33346, 0, 0, 11, 1},
+	{33357, 0, 0, 8, 1},
+	{33365, 0, 0, 8, 1},
+	{33373, 0, 0, 6, 1},
+	{33379, 0, 0, 5, 1},
+	{33384, 0, 0, 10, 1},
+	{33394, 0, 0, 5, 1},
+	{322, 0, 0, 2, 1},
+	{8997, 0, 0, 7, 1},
+	{5360, 0, 0, 6, 1},
+	{33399, 0, 0, 5, 1},
+	{33404, 0, 0, 9, 1},
+	{33413, 0, 0, 5, 1},
+	{33418, 0, 0, 8, 1},
+	{33426, 0, 0, 5, 1},
+	{33431, 0, 0, 9, 1},
+	{33440, 0, 0, 6, 1},
+	{33446, 0, 0, 8, 1},
+	{460, 0, 0, 3, 1},
+	{33454, 0, 0, 6, 1},
+	{33460, 0, 0, 6, 1},
+	{33466, 0, 0, 5, 1},
+	{33471, 0, 0, 9, 1},
+	{33480, 0, 0, 9, 1},
+	{33489, 0, 0, 7, 1},
+	{33496, 0, 0, 4, 1},
+	{33500, 0, 0, 7, 1},
+	{33507, 0, 0, 9, 1},
+	{33516, 0, 0, 5, 1},
+	{33521, 0, 0, 8, 1},
+	{33529, 0, 0, 5, 1},
+	{33534, 0, 0, 5, 1},
+	{33539, 0, 0, 9, 1},
+	{70, 0, 0, 2, 1},
+	{238, 0, 0, 4, 1},
+	{951, 0, 0, 3, 1},
+	{70, 0, 0, 2, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{33548, 0, 0, 5, 1},
+	{50, 0, 0, 2, 1},
+	{685, 0, 0, 3, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{636, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2856, 0, 0, 4, 1},
+	{27426, 0, 0, 4, 1},
+	{238, 0, 0, 4, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{3079, 0, 0, 3, 1},
+	{4288, 0, 0, 4, 1},
+	{0, 0, 0, 3, 1},
+	{50, 0, 0, 3, 1},
+	{33553, 0, 0, 4, 1},
+	{8978, 0, 0, 6, 1},
+	{8, 0, 0, 3, 1},
+	{8861, 0, 0, 5, 1},
+	{8691, 0, 0, 7, 1},
+	{1436, 0, 0, 3, 1},
+	{33557, 9312, 1, 8, 0},
+	{1824, 0, 0, 3, 1},
+	{28248, 0, 0, 3, 1},
+	{3263, 0, 0, 3, 1},
+	{1237, 0, 0, 3, 1},
+	{33565, 0, 0, 5, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{3394, 0, 0, 3, 1},
+	{1010, 0, 0, 3, 1},
+	{33570, 0, 0, 12, 1},
+	{7871, 0, 0, 8, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{1110, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{13876, 0, 0, 4, 1},
+	{2343, 0, 0, 3, 1},
+	{498, 0, 0, 4, 1},
+	{8861, 0, 0, 5, 1},
+	{33582, 0, 0, 5, 1},
+	{8691, 0, 0, 7, 1},
+	{70, 0, 0, 2, 1},
+	{1238, 0, 0, 2, 1},
+	{680, 0, 0, 2, 1},
+	{246, 0, 0, 2, 1},
+	{95, 0, 0, 2, 1},
+	{33587, 0, 0, 4, 1},
+	{1272, 0, 0, 3, 1},
+	{1398, 0, 0, 4, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{264, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{7871, 0, 0, 8, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{264, 0, 0, 3, 1},
+	{238, 0, 0, 4, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{796, 0, 0, 3, 1},
+	{380, 0, 0, 4, 1},
+	{7871, 0, 0, 8, 1},
+	{1272, 0, 0, 3, 1},
+	{7868, 0, 0, 3, 1},
+	{14649, 0, 0, 3, 1},
+	{33591, 0, 0, 4, 1},
+	{4074, 0, 0, 4, 1},
+	{8861, 0, 0, 5, 1},
+	{7871, 0, 0, 8, 1},
+	{70, 0, 0, 2, 1},
+	{1272, 0, 0, 3, 1},
+	{2081, 0, 0, 4, 1},
+	{2856, 0, 0, 4, 1},
+	{7868, 0, 0, 3, 1},
+	{63, 0, 0, 2, 1},
+	{2343, 0, 0, 3, 1},
+	{985, 0, 0, 3, 1},
+	{4832, 0, 0, 4, 1},
+	{5035, 0, 0, 5, 1},
+	{322, 0, 0, 2, 1},
+	{9785, 0, 0, 3, 1},
+	{8765, 0, 0, 9, 1},
+	{33595, 0, 0, 6, 1},
+	{33601, 0, 0, 8, 1},
+	{50, 0, 0, 2, 1},
+	{7871, 0, 0, 8, 1},
+	{33609, 9313, 1, 7, 0},
+	{70, 0, 0, 2, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{202, 0, 0, 2, 1},
+	{2343, 0, 0, 3, 1},
+	{820, 0, 0, 2, 1},
+	{310, 0, 0, 2, 1},
+	{33616, 0, 0, 7, 1},
+	{50, 0, 0, 2, 1},
+	{33623, 0, 0, 7, 1},
+	{33630, 0, 0, 9, 1},
+	{21075, 0, 0, 3, 1},
+	{7871, 0, 0, 8, 1},
+	{33639, 0, 0, 3, 1},
+	{33642, 9314, 1, 7, 0},
+	{1272, 0, 0, 3, 1},
+	{33649, 0, 0, 8, 1},
+	{1795, 0, 0, 3, 1},
+	{33657, 0, 0, 7, 1},
+	{2456, 0, 0, 3, 1},
+	{33664, 0, 0, 6, 1},
+	{1110, 0, 0, 3, 1},
+	{33670, 0, 0, 8, 1},
+	{33678, 0, 0, 8, 1},
+	{33686, 0, 0, 3, 1},
+	{33689, 0, 0, 6, 1},
+	{20629, 9315, 1, 5, 1},
+	{33695, 0, 0, 5, 1},
+	{264, 0, 0, 3, 1},
+	{15107, 0, 0, 8, 1},
+	{33700, 0, 0, 8, 1},
+	{28374, 0, 0, 3, 1},
+	{33708, 9316, 4, 6, 1},
+	{33714, 0, 0, 5, 1},
+	{33719, 0, 0, 4, 1},
+	{33723, 0, 0, 7, 1},
+	{2158, 0, 0, 3, 1},
+	{16869, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{329, 0, 0, 2, 1},
+	{33730, 0, 0, 10, 1},
+	{1942, 0, 0, 3, 1},
+	{33740, 9320, 1, 12, 0},
+	{33752, 0, 0, 3, 1},
+	{9926, 0, 0, 4, 1},
+	{33755, 0, 0, 11, 1},
+	{33766, 0, 0, 8, 1},
+	{874, 0, 0, 5, 2},
+	{1247, 0, 0, 4, 2},
+	{21755, 0, 0, 8, 2},
+	{33774, 0, 0, 11, 1},
+	{2767, 0, 0, 2, 1},
+	{33785, 0, 0, 9, 2},
+	{33794, 0, 0, 8, 1},
+	{9901, 0, 0, 7, 1},
+	{10049, 0, 0, 4, 1},
+	{14280, 0, 0, 7, 1},
+	{50, 0, 0, 2, 1},
+	{70, 0, 0, 2, 1},
+	{1398, 0, 0, 4, 1},
+	{2456, 0, 0, 3, 1},
+	{264, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{1237, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{498, 0, 0, 3, 1},
+	{796, 0, 0, 3, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{14649, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 9321, 1, 3, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2856, 0, 0, 4, 1},
+	{1237, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{1751, 0, 0, 2, 1},
+	{33802, 0, 0, 10, 1},
+	{0, 0, 0, 1, 1},
+	{50, 0, 0, 2, 1},
+	{8, 0, 0, 1, 1},
+	{603, 0, 0, 2, 1},
+	{7871, 0, 0, 8, 1},
+	{21139, 0, 0, 5, 1},
+	{30, 0, 0, 1, 1},
+	{1272, 0, 0, 3, 1},
+	{8108, 0, 0, 4, 1},
+	{40, 0, 0, 1, 1},
+	{27, 0, 0, 1, 1},
+	{120, 0, 0, 1, 1},
+	{3090, 0, 0, 2, 1},
+	{33812, 0, 0, 4, 1},
+	{33816, 0, 0, 3, 1},
+	{38, 0, 0, 1, 1},
+	{12, 0, 0, 1, 1},
+	{26, 0, 0, 1, 1},
+	{33819, 0, 0, 6, 1},
+	{33825, 0, 0, 12, 1},
+	{135, 0, 0, 1, 1},
+	{33837, 0, 0, 7, 1},
+	{33844, 0, 0, 15, 1},
+	{33859, 0, 0, 6, 1},
+	{33, 0, 0, 1, 1},
+	{33865, 0, 0, 6, 1},
+	{57, 0, 0, 1, 1},
+	{8774, 0, 0, 12, 1},
+	{63, 0, 0, 1, 1},
+	{33871, 0, 0, 14, 1},
+	{19, 0, 0, 1, 1},
+	{2343, 0, 0, 3, 1},
+	{6, 0, 0, 1, 1},
+	{6, 9322, 1, 4, 0},
+	{33885, 0, 0, 5, 1},
+	{329, 0, 0, 2, 1},
+	{249, 0, 0, 5, 1},
+	{5, 0, 0, 1, 1},
+	{88, 0, 0, 1, 1},
+	{11, 0, 0, 1, 1},
+	{322, 0, 0, 2, 1},
+	{44, 0, 0, 1, 1},
+	{460, 0, 0, 1, 1},
+	{248, 0, 0, 1, 1},
+	{58, 0, 0, 1, 1},
+	{206, 0, 0, 1, 1},
+	{8547, 0, 0, 9, 1},
+	{7871, 0, 0, 8, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{33890, 0, 0, 8, 1},
+	{2456, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{1928, 0, 0, 3, 1},
+	{25267, 0, 0, 3, 1},
+	{1272, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{33898, 0, 0, 8, 1},
+	{264, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{3907, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{8611, 9323, 4, 8, 0},
+	{33906, 0, 0, 3, 1},
+	{15866, 0, 0, 8, 1},
+	{8861, 0, 0, 5, 1},
+	{556, 0, 0, 4, 1},
+	{33909, 0, 0, 6, 1},
+	{7871, 0, 0, 8, 1},
+	{33915, 0, 0, 6, 1},
+	{33921, 0, 0, 7, 1},
+	{8861, 0, 0, 5, 1},
+	{33928, 0, 0, 4, 1},
+	{33932, 0, 0, 8, 2},
+	{20476, 0, 0, 4, 1},
+	{11084, 0, 0, 7, 1},
+	{33940, 0, 0, 4, 1},
+	{33944, 0, 0, 12, 1},
+	{9831, 0, 0, 4, 1},
+	{33956, 0, 0, 5, 1},
+	{8547, 0, 0, 9, 1},
+	{33961, 0, 0, 7, 1},
+	{33968, 0, 0, 8, 1},
+	{33976, 0, 0, 6, 1},
+	{33982, 0, 0, 10, 1},
+	{33992, 0, 0, 10, 2},
+	{34002, 0, 0, 4, 1},
+	{5242, 0, 0, 3, 2},
+	{7871, 0, 0, 8, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{9, 0, 0, 3, 1},
+	{7871, 0, 0, 8, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{9760, 0, 0, 4, 1},
+	{2343, 0, 0, 3, 1},
+	{12144, 0, 0, 5, 1},
+	{5442, 0, 0, 4, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{182, 0, 0, 2, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{796, 0, 0, 3, 1},
+	{34006, 0, 0, 5, 2},
+	{15115, 0, 0, 6, 1},
+	{12483, 0, 0, 4, 1},
+	{34011, 0, 0, 6, 1},
+	{685, 0, 0, 3, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{182, 0, 0, 2, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{796, 0, 0, 3, 1},
+	{70, 0, 0, 2, 1},
+	{1272, 0, 0, 3, 1},
+	{34017, 0, 0, 9, 1},
+	{1795, 0, 0, 3, 1},
+	{34026, 0, 0, 9, 1},
+	{264, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{20642, 0, 0, 4, 1},
+	{2343, 0, 0, 3, 1},
+	{34035, 0, 0, 8, 1},
+	{34043, 0, 0, 7, 1},
+	{5035, 0, 0, 5, 1},
+	{34050, 0, 0, 6, 1},
+	{34056, 0, 0, 8, 1},
+	{34064, 0, 0, 9, 1},
+	{34073, 0, 0, 8, 1},
+	{33623, 0, 0, 7, 1},
+	{34081, 0, 0, 10, 1},
+	{34091, 0, 0, 11, 1},
+	{34102, 0, 0, 7, 1},
+	{34109, 0, 0, 8, 1},
+	{34117, 0, 0, 10, 1},
+	{34127, 0, 0, 8, 1},
+	{33630, 0, 0, 9, 1},
+	{34135, 0, 0, 7, 1},
+	{34142, 0, 0, 7, 1},
+	{34149, 0, 0, 8, 1},
+	{33649, 0, 0, 8, 1},
+	{34157, 0, 0, 15, 1},
+	{34172, 0, 0, 5, 1},
+	{22211, 0, 0, 7, 1},
+	{33664, 0, 0, 6, 1},
+	{34177, 0, 0, 7, 1},
+	{34184, 0, 0, 6, 1},
+	{33670, 0, 0, 8, 1},
+	{34190, 0, 0, 6, 1},
+	{34196, 0, 0, 7, 1},
+	{34203, 0, 0, 9, 1},
+	{34212, 0, 0, 7, 1},
+	{34219, 0, 0, 9, 1},
+	{34228, 0, 0, 9, 1},
+	{34237, 0, 0, 6, 1},
+	{33678, 0, 0, 8, 1},
+	{34243, 0, 0, 5, 1},
+	{34248, 0, 0, 10, 1},
+	{33700, 0, 0, 8, 1},
+	{28374, 0, 0, 3, 1},
+	{34258, 0, 0, 8, 1},
+	{33723, 0, 0, 7, 1},
+	{34266, 0, 0, 5, 1},
+	{34271, 0, 0, 16, 1},
+	{16869, 0, 0, 3, 1},
+	{34287, 0, 0, 7, 1},
+	{34294, 0, 0, 5, 1},
+	{34299, 0, 0, 8, 1},
+	{34307, 0, 0, 5, 1},
+	{33752, 0, 0, 3, 1},
+	{34312, 0, 0, 8, 1},
+	{34320, 0, 0, 6, 1},
+	{34326, 0, 0, 9, 1},
+	{34335, 0, 0, 7, 1},
+	{34342, 0, 0, 11, 1},
+	{34353, 0, 0, 4, 1},
+	{34357, 0, 0, 4, 1},
+	{33755, 0, 0, 11, 1},
+	{33766, 0, 0, 8, 1},
+	{34361, 0, 0, 7, 1},
+	{8861, 0, 0, 5, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{680, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{1442, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{264, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{34368, 0, 0, 11, 1},
+	{50, 0, 0, 2, 1},
+	{70, 0, 0, 2, 1},
+	{2343, 0, 0, 3, 1},
+	{359, 0, 0, 2, 1},
+	{182, 0, 0, 2, 1},
+	{2141, 0, 0, 2, 1},
+	{7871, 0, 0, 8, 1},
+	{14950, 0, 0, 9, 1},
+	{9823, 0, 0, 8, 1},
+	{70, 0, 0, 2, 1},
+	{796, 0, 0, 3, 1},
+	{50, 0, 0, 2, 1},
+	{70, 0, 0, 2, 1},
+	{680, 0, 0, 2, 1},
+	{202, 0, 0, 2, 1},
+	{264, 0, 0, 2, 1},
+	{2158, 0, 0, 3, 1},
+	{3990, 0, 0, 6, 1},
+	{95, 0, 0, 2, 1},
+	{4832, 0, 0, 4, 1},
+	{50, 0, 0, 2, 1},
+	{685, 0, 0, 3, 1},
+	{70, 0, 0, 2, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{680, 0, 0, 2, 1},
+	{2456, 0, 0, 3, 1},
+	{1110, 0, 0, 3, 1},
+	{264, 0, 0, 3, 1},
+	{238, 0, 0, 4, 1},
+	{2158, 0, 0, 3, 1},
+	{1142, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{9926, 0, 0, 4, 1},
+	{5677, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{70, 0, 0, 2, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{264, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{7868, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{1272, 0, 0, 3, 1},
+	{2703, 0, 0, 3, 1},
+	{201, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{1962, 0, 0, 3, 1},
+	{2856, 0, 0, 4, 1},
+	{23666, 0, 0, 4, 1},
+	{34379, 0, 0, 6, 1},
+	{2889, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{34385, 0, 0, 11, 1},
+	{2343, 0, 0, 3, 1},
+	{12144, 0, 0, 5, 1},
+	{8997, 0, 0, 7, 1},
+	{34396, 0, 0, 3, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{264, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{7792, 0, 0, 4, 1},
+	{2343, 0, 0, 3, 1},
+	{3779, 0, 0, 3, 1},
+	{10003, 9327, 1, 12, 0},
+	{5477, 0, 0, 3, 1},
+	{34399, 0, 0, 7, 1},
+	{34406, 0, 0, 12, 1},
+	{25376, 0, 0, 7, 1},
+	{34418, 0, 0, 5, 1},
+	{452, 0, 0, 2, 1},
+	{13295, 0, 0, 3, 1},
+	{3261, 0, 0, 3, 1},
+	{685, 0, 0, 3, 1},
+	{1272, 9328, 1, 3, 1},
+	{302, 0, 0, 2, 1},
+	{1795, 0, 0, 3, 1},
+	{140, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2856, 0, 0, 4, 1},
+	{14605, 0, 0, 3, 1},
+	{32798, 0, 0, 3, 1},
+	{264, 0, 0, 3, 1},
+	{238, 0, 0, 4, 1},
+	{142, 9329, 1, 2, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{3969, 0, 0, 3, 1},
+	{167, 0, 0, 3, 1},
+	{8401, 0, 0, 3, 1},
+	{1751, 0, 0, 2, 1},
+	{5677, 0, 0, 3, 1},
+	{14649, 0, 0, 3, 1},
+	{110, 0, 0, 4, 1},
+	{685, 0, 0, 3, 1},
+	{70, 0, 0, 2, 1},
+	{1272, 0, 0, 3, 1},
+	{1398, 0, 0, 4, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2856, 0, 0, 4, 1},
+	{1110, 0, 0, 3, 1},
+	{2996, 0, 0, 4, 1},
+	{2830, 0, 0, 4, 1},
+	{3755, 0, 0, 6, 1},
+	{238, 0, 0, 4, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{3079, 0, 0, 3, 1},
+	{5360, 0, 0, 6, 1},
+	{34423, 0, 0, 11, 1},
+	{8884, 0, 0, 6, 1},
+	{34434, 0, 0, 10, 1},
+	{34444, 0, 0, 10, 1},
+	{7871, 0, 0, 8, 1},
+	{1229, 0, 0, 4, 1},
+	{1272, 9330, 1, 3, 1},
+	{34454, 0, 0, 4, 1},
+	{1795, 0, 0, 3, 1},
+	{2303, 0, 0, 4, 1},
+	{2456, 0, 0, 3, 1},
+	{14966, 0, 0, 3, 1},
+	{264, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{8848, 0, 0, 3, 1},
+	{34458, 0, 0, 11, 1},
+	{15046, 0, 0, 10, 1},
+	{34469, 0, 0, 12, 1},
+	{50, 0, 0, 2, 1},
+	{70, 0, 0, 2, 1},
+	{680, 0, 0, 2, 1},
+	{2739, 0, 0, 5, 1},
+	{2856, 0, 0, 4, 1},
+	{182, 0, 0, 2, 1},
+	{264, 0, 0, 3, 1},
+	{2830, 0, 0, 4, 1},
+	{246, 0, 0, 2, 1},
+	{95, 0, 0, 2, 1},
+	{796, 0, 0, 2, 1},
+	{1751, 0, 0, 2, 1},
+	{685, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{34481, 0, 0, 9, 1},
+	{34490, 0, 0, 8, 1},
+	{34498, 0, 0, 9, 1},
+	{34507, 0, 0, 9, 1},
+	{34516, 0, 0, 10, 1},
+	{34526, 0, 0, 10, 1},
+	{693, 0, 0, 2, 1},
+	{601, 0, 0, 2, 1},
+	{70, 0, 0, 2, 1},
+	{1272, 0, 0, 3, 1},
+	{1439, 0, 0, 2, 1},
+	{34536, 0, 0, 6, 1},
+	{1508, 0, 0, 2, 1},
+	{1512, 0, 0, 2, 1},
+	{172, 0, 0, 2, 1},
+	{34542, 0, 0, 14, 1},
+	{34556, 0, 0, 14, 1},
+	{34570, 0, 0, 7, 1},
+	{2423, 0, 0, 2, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2019, 0, 0, 2, 1},
+	{202, 0, 0, 2, 1},
+	{2848, 0, 0, 3, 1},
+	{34577, 0, 0, 15, 1},
+	{135, 0, 0, 2, 1},
+	{34592, 0, 0, 7, 1},
+	{34599, 0, 0, 7, 1},
+	{34606, 0, 0, 7, 1},
+	{34613, 0, 0, 12, 1},
+	{34625, 0, 0, 12, 1},
+	{34637, 0, 0, 4, 1},
+	{34641, 0, 0, 10, 1},
+	{3127, 0, 0, 2, 1},
+	{2118, 0, 0, 2, 1},
+	{34651, 0, 0, 4, 1},
+	{4548, 0, 0, 2, 1},
+	{6388, 0, 0, 2, 1},
+	{34655, 0, 0, 4, 1},
+	{2284, 0, 0, 2, 1},
+	{103, 0, 0, 2, 1},
+	{3450, 0, 0, 3, 1},
+	{34659, 0, 0, 7, 1},
+	{34666, 0, 0, 5, 1},
+	{919, 0, 0, 2, 1},
+	{34671, 0, 0, 4, 1},
+	{3103, 0, 0, 2, 1},
+	{34675, 0, 0, 8, 1},
+	{2158, 0, 0, 3, 1},
+	{34683, 0, 0, 8, 1},
+	{1248, 0, 0, 2, 1},
+	{34691, 0, 0, 5, 1},
+	{34696, 0, 0, 6, 1},
+	{2343, 0, 0, 3, 1},
+	{333, 0, 0, 2, 1},
+	{34702, 0, 0, 7, 1},
+	{329, 0, 0, 2, 1},
+	{34709, 0, 0, 5, 1},
+	{34714, 0, 0, 5, 1},
+	{3936, 0, 0, 2, 1},
+	{539, 0, 0, 2, 1},
+	{34719, 0, 0, 10, 1},
+	{34729, 0, 0, 10, 1},
+	{2928, 0, 0, 2, 1},
+	{34739, 0, 0, 4, 1},
+	{167, 0, 0, 2, 1},
+	{34743, 0, 0, 8, 1},
+	{896, 0, 0, 2, 1},
+	{34751, 0, 0, 8, 1},
+	{25, 0, 0, 1, 1},
+	{34759, 0, 0, 7, 1},
+	{34766, 0, 0, 9, 1},
+	{3920, 0, 0, 2, 1},
+	{34775, 0, 0, 5, 1},
+	{34780, 0, 0, 5, 1},
+	{34785, 0, 0, 11, 1},
+	{34796, 0, 0, 12, 1},
+	{34808, 0, 0, 8, 1},
+	{34816, 0, 0, 8, 1},
+	{33102, 0, 0, 2, 1},
+	{2971, 0, 0, 2, 1},
+	{50, 0, 0, 2, 1},
+	{7871, 0, 0, 8, 1},
+	{70, 0, 0, 2, 1},
+	{1272, 0, 0, 3, 1},
+	{680, 0, 0, 2, 1},
+	{246, 0, 0, 2, 1},
+	{95, 0, 0, 2, 1},
+	{2343, 0, 0, 3, 1},
+	{796, 0, 0, 2, 1},
+	{50, 0, 0, 2, 1},
+	{8861, 0, 0, 5, 1},
+	{70, 9331, 11, 2, 1},
+	{10008, 0, 0, 4, 1},
+	{34824, 0, 0, 5, 1},
+	{2456, 9342, 4, 3, 1},
+	{2717, 0, 0, 4, 1},
+	{34829, 0, 0, 22, 1},
+	{34851, 0, 0, 19, 1},
+	{34870, 0, 0, 19, 1},
+	{34889, 0, 0, 17, 1},
+	{34906, 0, 0, 18, 1},
+	{3450, 0, 0, 3, 1},
+	{182, 0, 0, 2, 1},
+	{2158, 0, 0, 3, 1},
+	{34924, 0, 0, 3, 1},
+	{2343, 9346, 6, 3, 1},
+	{20498, 0, 0, 3, 1},
+	{34927, 0, 0, 6, 1},
+	{34933, 0, 0, 14, 1},
+	{34947, 0, 0, 5, 1},
+	{34952, 0, 0, 16, 1},
+	{796, 0, 0, 3, 2},
+	{134, 9352, 3, 2, 1},
+	{174, 9355, 3, 2, 1},
+	{4, 9358, 3, 2, 1},
+	{370, 9361, 3, 2, 1},
+	{235, 9364, 3, 2, 1},
+	{30, 9367, 3, 2, 1},
+	{8691, 0, 0, 7, 1},
+	{70, 9370, 3, 2, 1},
+	{93, 9373, 3, 2, 1},
+	{1052, 9376, 3, 2, 1},
+	{55, 9379, 3, 2, 1},
+	{11792, 0, 0, 3, 1},
+	{15565, 0, 0, 4, 1},
+	{33890, 9382, 1, 8, 0},
+	{2000, 0, 0, 3, 1},
+	{122, 9383, 3, 2, 1},
+	{10580, 0, 0, 8, 1},
+	{38, 9386, 3, 2, 1},
+	{34968, 0, 0, 7, 1},
+	{34975, 0, 0, 7, 1},
+	{2511, 9389, 3, 2, 1},
+	{360, 9392, 2, 2, 1},
+	{49, 9394, 3, 2, 1},
+	{305, 9397, 3, 2, 1},
+	{265, 9400, 3, 2, 1},
+	{202, 9403, 3, 2, 1},
+	{34982, 0, 0, 5, 1},
+	{1891, 0, 0, 3, 1},
+	{3097, 0, 0, 4, 1},
+	{4548, 9406, 3, 2, 1},
+	{3176, 9409, 3, 2, 1},
+	{123, 9412, 3, 2, 1},
+	{34987, 0, 0, 11, 1},
+	{230, 9415, 3, 2, 1},
+	{1710, 9418, 3, 2, 1},
+	{182, 9421, 3, 2, 1},
+	{264, 9424, 11, 2, 1},
+	{15107, 0, 0, 8, 1},
+	{3666, 9435, 3, 2, 1},
+	{1613, 9438, 3, 2, 1},
+	{283, 9441, 3, 2, 1},
+	{3747, 9444, 3, 2, 1},
+	{142, 9447, 3, 2, 1},
+	{301, 9450, 2, 2, 1},
+	{246, 9452, 3, 2, 1},
+	{2653, 9455, 3, 2, 1},
+	{2992, 9458, 3, 2, 1},
+	{3495, 9461, 3, 2, 1},
+	{20648, 0, 0, 4, 1},
+	{34998, 0, 0, 3, 1},
+	{2904, 9464, 3, 2, 1},
+	{1304, 9467, 3, 2, 1},
+	{4235, 9470, 3, 2, 1},
+	{785, 9473, 3, 2, 1},
+	{95, 9476, 3, 2, 1},
+	{6, 9479, 3, 2, 1},
+	{35001, 0, 0, 8, 1},
+	{35009, 0, 0, 7, 1},
+	{249, 9482, 3, 2, 1},
+	{126, 9485, 2, 2, 1},
+	{796, 9487, 3, 2, 1},
+	{373, 9490, 2, 2, 1},
+	{32384, 0, 0, 12, 1},
+	{116, 9492, 3, 2, 1},
+	{6342, 9495, 3, 2, 1},
+	{438, 9498, 3, 2, 1},
+	{595, 9501, 3, 2, 1},
+	{25, 9504, 3, 2, 1},
+	{5413, 9507, 3, 2, 1},
+	{460, 9510, 3, 2, 1},
+	{1961, 9513, 3, 2, 1},
+	{11505, 9516, 1, 2, 1},
+	{3268, 9517, 3, 2, 1},
+	{1272, 9520, 1, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{35016, 0, 0, 3, 1},
+	{264, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{70, 0, 0, 2, 1},
+	{1272, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{6309, 0, 0, 2, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{5511, 9521, 1, 2, 1},
+	{264, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{4074, 0, 0, 4, 1},
+	{661, 0, 0, 3, 1},
+	{70, 0, 0, 2, 1},
+	{1272, 0, 0, 3, 1},
+	{8708, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2081, 0, 0, 4, 1},
+	{680, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2856, 0, 0, 4, 1},
+	{1110, 0, 0, 3, 1},
+	{264, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{7868, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{2016, 0, 0, 3, 1},
+	{985, 0, 0, 3, 1},
+	{5035, 0, 0, 5, 1},
+	{4319, 0, 0, 3, 1},
+	{5677, 0, 0, 3, 1},
+	{212, 0, 0, 2, 1},
+	{70, 0, 0, 2, 1},
+	{1272, 0, 0, 3, 1},
+	{14605, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{50, 0, 0, 2, 1},
+	{685, 0, 0, 3, 1},
+	{7871, 0, 0, 8, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2578, 0, 0, 6, 1},
+	{2856, 0, 0, 4, 1},
+	{1110, 0, 0, 3, 1},
+	{238, 0, 0, 4, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{3079, 0, 0, 3, 1},
+	{717, 0, 0, 4, 1},
+	{601, 0, 0, 2, 1},
+	{1272, 0, 0, 3, 1},
+	{1642, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{182, 0, 0, 2, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{8535, 0, 0, 6, 1},
+	{685, 0, 0, 3, 1},
+	{796, 0, 0, 3, 1},
+	{8535, 0, 0, 6, 1},
+	{11964, 0, 0, 7, 2},
+	{35019, 0, 0, 7, 1},
+	{1272, 0, 0, 3, 1},
+	{8884, 0, 0, 6, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{35026, 0, 0, 6, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{35032, 0, 0, 13, 1},
+	{35045, 0, 0, 11, 1},
+	{35056, 0, 0, 10, 1},
+	{35066, 0, 0, 11, 1},
+	{35077, 0, 0, 8, 1},
+	{35085, 0, 0, 9, 1},
+	{6247, 0, 0, 9, 1},
+	{35094, 0, 0, 8, 1},
+	{35102, 0, 0, 8, 1},
+	{35110, 0, 0, 9, 1},
+	{6025, 0, 0, 10, 1},
+	{14995, 0, 0, 10, 1},
+	{7241, 0, 0, 10, 1},
+	{10017, 0, 0, 10, 1},
+	{15046, 0, 0, 10, 1},
+	{15067, 0, 0, 11, 1},
+	{35119, 0, 0, 13, 1},
+	{35132, 0, 0, 15, 1},
+	{35147, 0, 0, 16, 1},
+	{35163, 0, 0, 13, 1},
+	{35176, 0, 0, 12, 1},
+	{35188, 0, 0, 11, 1},
+	{35199, 0, 0, 7, 1},
+	{35206, 0, 0, 14, 1},
+	{35220, 0, 0, 10, 1},
+	{35230, 0, 0, 9, 1},
+	{6247, 0, 0, 9, 1},
+	{35239, 0, 0, 9, 1},
+	{35248, 0, 0, 10, 1},
+	{35258, 0, 0, 9, 1},
+	{6664, 0, 0, 9, 1},
+	{35267, 0, 0, 11, 1},
+	{31857, 0, 0, 8, 1},
+	{35278, 0, 0, 8, 1},
+	{35286, 0, 0, 9, 1},
+	{8638, 0, 0, 7, 2},
+	{32467, 0, 0, 5, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{264, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{50, 0, 0, 2, 1},
+	{14740, 0, 0, 5, 1},
+	{2580, 0, 0, 3, 1},
+	{70, 9522, 1, 2, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{35295, 0, 0, 7, 1},
+	{3263, 0, 0, 3, 1},
+	{264, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{679, 0, 0, 3, 1},
+	{1142, 0, 0, 3, 1},
+	{3866, 0, 0, 3, 1},
+	{7868, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{4709, 0, 0, 6, 1},
+	{322, 0, 0, 2, 1},
+	{5677, 0, 0, 3, 1},
+	{50, 0, 0, 2, 1},
+	{685, 0, 0, 3, 1},
+	{70, 0, 0, 2, 1},
+	{1272, 0, 0, 3, 1},
+	{1795, 0, 0, 3, 1},
+	{2456, 0, 0, 3, 1},
+	{2856, 0, 0, 4, 1},
+	{264, 0, 0, 3, 1},
+	{2158, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{796, 0, 0, 3, 1},
+	{35019, 0, 0, 7, 1},
+	{2767, 0, 0, 2, 1},
+	{8717, 0, 0, 4, 1},
+	{35302, 0, 0, 6, 2},
+	{50, 0, 0, 2, 1},
+	{70, 0, 0, 2, 1},
+	{2456, 0, 0, 3, 1},
+	{264, 0, 0, 3, 1},
+	{2343, 0, 0, 3, 1},
+	{0, 0, 0, 1, 1},
+	{35308, 0, 0, 11, 1},
+	{7871, 0, 0, 8, 1},
+	{2727, 0, 0, 3, 1},
+	{7871, 0, 0, 8, 1},
+	{5720, 0, 0, 4, 1},
+	{247, 0, 0, 2, 2},
+	{202, 0, 0, 2, 2},
+	{247, 0, 0, 2, 2},
+	{35319, 0, 0, 6, 2},
+	{7871, 0, 0, 8, 1},
+	{35325, 9523, 1, 9, 0},
+	{8774, 0, 0, 12, 1},
+	{92, 0, 0, 3, 1},
+	{1033, 0, 0, 8, 1},
+	{8801, 9524, 1, 3, 1},
+	{63, 0, 0, 2, 1},
+	{8804, 0, 0, 3, 1},
+	{88, 0, 0, 2, 1},
+	{8036, 0, 0, 3, 1},
+	{4781, 0, 0, 3, 1},
+	{460, 0, 0, 2, 1},
+	{8804, 0, 0, 3, 1},
+	{88, 0, 0, 2, 1},
+	{8036, 0, 0, 3, 1},
+	{4781, 0, 0, 3, 1},
+	{460, 0, 0, 2, 1},
+	{1224, 0, 0, 5, 1},
+	{35334, 0, 0, 7, 1},
+	{7871, 0, 0, 8, 1},
+	{13470, 0, 0, 10, 1},
+	{35341, 9525, 1, 12, 0},
+	{50, 0, 0, 2, 1},
+	{174, 0, 0, 2, 1},
+	{231, 0, 0, 2, 1},
+	{318, 0, 0, 2, 1},
+	{8, 0, 0, 2, 1},
+	{61, 0, 0, 2, 1},
+	{2153, 0, 0, 2, 1},
+	{251, 0, 0, 2, 1},
+	{680, 0, 0, 2, 1},
+	{230, 0, 0, 2, 1},
+	{2393, 0, 0, 2, 1},
+	{283, 0, 0, 2, 1},
+	{3747, 0, 0, 2, 1},
+	{6, 0, 0, 2, 1},
+	{8370, 0, 0, 2, 1},
+	{948, 0, 0, 2, 1},
+	{956, 0, 0, 2, 1},
+	{249, 0, 0, 2, 1},
+	{2954, 0, 0, 2, 1},
+	{401, 0, 0, 2, 1},
+	{112, 0, 0, 2, 1},
+	{2015, 0, 0, 2, 1},
+	{885, 0, 0, 2, 1},
+	{796, 0, 0, 2, 1},
+	{558, 0, 0, 2, 1},
+	{432, 0, 0, 2, 1},
+	{94, 0, 0, 2, 1},
+	{50, 0, 0, 2, 1},
+	{174, 0, 0, 2, 1},
+	{231, 0, 0, 2, 1},
+	{318, 0, 0, 2, 1},
+	{8, 0, 0, 2, 1},
+	{61, 0, 0, 2, 1},
+	{2153, 0, 0, 2, 1},
+	{251, 0, 0, 2, 1},
+	{680, 0, 0, 2, 1},
+	{230, 0, 0, 2, 1},
+	{2393, 0, 0, 2, 1},
+	{283, 0, 0, 2, 1},
+	{3747, 0, 0, 2, 1},
+	{6, 0, 0, 2, 1},
+	{8370, 0, 0, 2, 1},
+	{948, 0, 0, 2, 1},
+	{956, 0, 0, 2, 1},
+	{249, 0, 0, 2, 1},
+	{2954, 0, 0, 2, 1},
+	{401, 0, 0, 2, 1},
+	{112, 0, 0, 2, 1},
+	{2015, 0, 0, 2, 1},
+	{885, 0, 0, 2, 1},
+	{796, 0, 0, 2, 1},
+	{558, 0, 0, 2, 1},
+	{432, 0, 0, 2, 1},
+	{94, 0, 0, 2, 1},
+	{7871, 0, 0, 8, 1},
+	{875, 0, 0, 2, 1},
+	{35353, 0, 0, 9, 1},
+	{35362, 0, 0, 3, 2},
+	{105, 9526, 1, 2, 0},
+	{35365, 0, 0, 9, 1},
+	{35374, 0, 0, 4, 1},
+	{1897, 0, 0, 2, 1},
+	{5541, 0, 0, 3, 1},
+	{9840, 9527, 1, 5, 0},
+	{19872, 0, 0, 3, 1},
+	{298, 0, 0, 2, 1},
+	{116, 0, 0, 2, 1},
+	{3142, 0, 0, 2, 1},
+	{3142, 0, 0, 2, 1},
+	{30, 0, 0, 2, 1},
+	{3142, 0, 0, 2, 1},
+	{154, 0, 0, 2, 1},
+	{35378, 9528, 3, 9, 0},
+	{35387, 9531, 5, 6, 0},
+	{35353, 9536, 2, 9, 0},
+	{35393, 0, 0, 3, 1},
+	{35396, 9538, 4, 6, 0},
+	{35402, 9542, 3, 6, 0},
+	{35408, 0, 0, 9, 1},
+	{35417, 0, 0, 13, 1},
+	{359, 0, 0, 2, 1},
+	{55, 0, 0, 2, 1},
+	{10182, 9545, 4, 9, 0},
+	{1667, 0, 0, 6, 1},
+	{7871, 0, 0, 8, 1},
+	{305, 0, 0, 2, 1},
+	{305, 0, 0, 2, 1},
+	{1642, 0, 0, 3, 2},
+	{35430, 9549, 1, 10, 0},
+	{35440, 9550, 1, 9, 0},
+	{35449, 9551, 2, 14, 0},
+	{35463, 9553, 4, 14, 0},
+	{35477, 9557, 1, 14, 0},
+	{35491, 9558, 4, 10, 0},
+	{35501, 9562, 2, 14, 0},
+	{35515, 9564, 2, 14, 0},
+	{35529, 9566, 4, 12, 0},
+	{1313, 0, 0, 7, 2},
+	{35541, 0, 0, 9, 2},
+	{3591, 0, 0, 3, 2},
+	{35550, 9570, 4, 12, 0},
+	{35562, 9574, 1, 10, 0},
+	{35572, 9575, 1, 10, 0},
+	{35582, 9576, 2, 9, 0},
+	{35591, 9578, 4, 9, 0},
+	{35600, 9582, 4, 9, 0},
+	{35609, 9586, 1, 10, 0},
+	{35619, 0, 0, 2, 1},
+	{35621, 0, 0, 17, 1},
+	{35638, 0, 0, 17, 1},
+	{35655, 0, 0, 13, 1},
+	{35668, 0, 0, 17, 1},
+	{35685, 0, 0, 17, 1},
+	{35702, 0, 0, 15, 1},
+	{35717, 0, 0, 15, 1},
+	{35732, 0, 0, 12, 1},
+	{35744, 0, 0, 12, 1},
+	{35756, 0, 0, 12, 1},
+	{35768, 0, 0, 13, 1},
+	{35781, 0, 0, 21, 1},
+	{35802, 0, 0, 12, 1},
+	{35814, 0, 0, 12, 1},
+	{35826, 0, 0, 16, 1},
+	{35842, 0, 0, 12, 1},
+	{35854, 0, 0, 12, 1},
+	{35866, 0, 0, 25, 1},
+	{35891, 0, 0, 25, 1},
+	{35916, 0, 0, 25, 1},
+	{35941, 0, 0, 20, 1},
+	{35961, 0, 0, 20, 1},
+	{35981, 0, 0, 20, 1},
+	{36001, 0, 0, 20, 1},
+	{36021, 0, 0, 20, 1},
+	{35805, 9587, 2, 9, 0},
+	{35992, 9589, 2, 9, 1},
+	{35817, 9591, 4, 9, 0},
+	{35845, 9595, 1, 9, 0},
+	{35857, 9596, 1, 9, 0},
+	{5, 0, 0, 1, 2},
+	{10165, 0, 0, 5, 1},
+	{10348, 0, 0, 4, 1},
+	{879, 0, 0, 7, 2},
+	{36041, 0, 0, 11, 2},
+	{36052, 0, 0, 11, 2},
+	{383, 0, 0, 3, 2},
+	{36063, 0, 0, 3, 2},
+	{1715, 0, 0, 3, 2},
+	{1611, 0, 0, 4, 1},
+	{35353, 0, 0, 8, 1},
+	{35449, 0, 0, 14, 1},
+	{35463, 0, 0, 14, 1},
+	{35477, 0, 0, 14, 1},
+	{35491, 0, 0, 10, 1},
+	{35501, 0, 0, 14, 1},
+	{35515, 0, 0, 14, 1},
+	{35529, 0, 0, 12, 1},
+	{35550, 0, 0, 12, 1},
+	{35582, 0, 0, 9, 1},
+	{35591, 0, 0, 9, 1},
+	{35600, 0, 0, 9, 1},
+	{35805, 0, 0, 9, 1},
+	{35992, 0, 0, 9, 1},
+	{35817, 0, 0, 9, 1},
+	{35789, 0, 0, 13, 1},
+	{35845, 0, 0, 9, 1},
+	{35857, 0, 0, 9, 1},
+	{36066, 0, 0, 4, 1},
+	{36070, 0, 0, 4, 1},
+	{36074, 0, 0, 4, 1},
+	{36078, 0, 0, 4, 1},
+	{36082, 0, 0, 4, 1},
+	{36086, 0, 0, 4, 1},
+	{36090, 0, 0, 4, 1},
+	{36094, 0, 0, 4, 1},
+	{9983, 0, 0, 4, 1},
+	{10740, 0, 0, 4, 1},
+	{36098, 0, 0, 9, 1},
+	{36107, 0, 0, 12, 1},
+	{20456, 0, 0, 6, 1},
+	{36119, 0, 0, 14, 1},
+	{1611, 0, 0, 4, 1},
+	{36133, 0, 0, 3, 2},
+	{36136, 0, 0, 7, 1},
+	{36143, 0, 0, 12, 2},
+	{194, 0, 0, 2, 1},
+	{328, 0, 0, 3, 1},
+	{10740, 0, 0, 4, 1},
+	{1897, 0, 0, 2, 1},
+	{36155, 0, 0, 7, 1},
+	{10511, 0, 0, 8, 1},
+	{36162, 0, 0, 8, 1},
+	{36170, 0, 0, 4, 1},
+	{36174, 0, 0, 6, 1},
+	{36180, 0, 0, 7, 1},
+	{17118, 0, 0, 4, 1},
+	{36187, 0, 0, 6, 1},
+	{5429, 0, 0, 2, 1},
+	{248, 0, 0, 1, 1},
+	{22778, 0, 0, 4, 1},
+	{1224, 0, 0, 5, 1},
+	{9928, 0, 0, 6, 1},
+	{14802, 0, 0, 3, 1},
+	{1897, 0, 0, 2, 1},
+	{328, 0, 0, 3, 1},
+	{955, 0, 0, 3, 1},
+	{4877, 0, 0, 4, 1},
+	{3079, 0, 0, 3, 1},
+	{36193, 0, 0, 3, 1},
+	{517, 0, 0, 3, 1},
+	{1592, 0, 0, 3, 1},
+	{10059, 0, 0, 5, 1},
+	{9999, 0, 0, 2, 1},
+	{6350, 0, 0, 2, 1},
+	{36196, 0, 0, 8, 1},
+	{7871, 0, 0, 8, 1},
+	{25468, 9597, 1, 10, 0},
+	{1224, 0, 0, 5, 2},
+	{10511, 0, 0, 6, 1},
+	{1224, 9598, 2, 5, 0},
+	{8884, 0, 0, 3, 1},
+	{8884, 0, 0, 3, 1},
+	{8884, 0, 0, 6, 1},
+	{8884, 0, 0, 3, 1},
+	{957, 9600, 1, 2, 0},
+	{10511, 0, 0, 8, 1},
+	{10239, 0, 0, 4, 2},
+	{3418, 0, 0, 6, 1},
+	{36204, 0, 0, 3, 2},
+	{36207, 0, 0, 9, 1},
+	{7871, 0, 0, 8, 1},
+	{7871, 0, 0, 8, 1},
+	{7871, 0, 0, 8, 1},
+	{9823, 0, 0, 8, 1},
+	{10239, 0, 0, 4, 1},
+	{201, 0, 0, 2, 1},
+	{1611, 0, 0, 4, 1},
+	{10740, 0, 0, 4, 1},
+	{36216, 0, 0, 6, 1},
+	{7871, 0, 0, 8, 1},
+	{22719, 0, 0, 3, 2},
+	{7871, 0, 0, 8, 1},
+	{12822, 0, 0, 7, 1},
+	{36222, 0, 0, 7, 1},
+	{36229, 0, 0, 10, 1},
+	{3450, 0, 0, 3, 1},
+	{20498, 0, 0, 3, 1},
+	{328, 0, 0, 3, 1},
+	{36239, 0, 0, 9, 2},
+	{10740, 0, 0, 4, 1},
+	{36248, 0, 0, 5, 1},
+	{36253, 0, 0, 3, 1},
+	{8884, 0, 0, 6, 1},
+	{305, 0, 0, 2, 1},
+	{9983, 0, 0, 4, 1},
+	{8486, 0, 0, 5, 1},
+	{36256, 0, 0, 4, 1},
+	{5119, 0, 0, 3, 2},
+	{10319, 0, 0, 7, 1},
+	{1642, 9601, 2, 3, 0},
+	{36260, 9603, 2, 6, 0},
+	{4273, 9605, 1, 4, 0},
+	{36266, 9606, 2, 7, 0},
+	{36273, 0, 0, 9, 1},
+	{38, 0, 0, 1, 1},
+	{2959, 0, 0, 2, 1},
+	{3999, 9608, 1, 4, 0},
+	{36282, 0, 0, 5, 1},
+	{231, 0, 0, 3, 1},
+	{15177, 0, 0, 4, 1},
+	{36287, 0, 0, 5, 1},
+	{36292, 0, 0, 6, 1},
+	{34309, 0, 0, 5, 1},
+	{36298, 0, 0, 4, 1},
+	{36302, 0, 0, 8, 1},
+	{36310, 0, 0, 5, 1},
+	{36315, 0, 0, 4, 1},
+	{36319, 0, 0, 7, 1},
+	{36326, 0, 0, 10, 1},
+	{36336, 0, 0, 10, 1},
+	{36346, 0, 0, 7, 1},
+	{36353, 0, 0, 7, 1},
+	{36360, 0, 0, 7, 1},
+	{36367, 0, 0, 7, 1},
+	{36374, 0, 0, 5, 1},
+	{36379, 0, 0, 6, 1},
+	{36385, 0, 0, 7, 1},
+	{19315, 0, 0, 4, 1},
+	{36392, 0, 0, 6, 1},
+	{36398, 0, 0, 6, 1},
+	{36404, 0, 0, 5, 1},
+	{36409, 0, 0, 4, 1},
+	{36413, 0, 0, 6, 1},
+	{36419, 0, 0, 7, 1},
+	{36426, 0, 0, 6, 1},
+	{36432, 0, 0, 7, 1},
+	{3001, 0, 0, 3, 1},
+	{36439, 0, 0, 6, 1},
+	{36445, 0, 0, 5, 1},
+	{36450, 0, 0, 7, 1},
+	{36457, 0, 0, 10, 1},
+	{16884, 0, 0, 4, 1},
+	{36467, 0, 0, 8, 1},
+	{36475, 0, 0, 9, 1},
+	{36484, 0, 0, 7, 1},
+	{36491, 0, 0, 6, 1},
+	{36497, 0, 0, 8, 1},
+	{36505, 0, 0, 9, 1},
+	{36514, 0, 0, 4, 1},
+	{36518, 0, 0, 4, 1},
+	{36522, 0, 0, 5, 1},
+	{36527, 0, 0, 8, 1},
+	{36535, 0, 0, 7, 1},
+	{36542, 0, 0, 9, 1},
+	{36551, 0, 0, 8, 1},
+	{36559, 0, 0, 6, 1},
+	{5330, 0, 0, 6, 1},
+	{36565, 0, 0, 8, 1},
+	{36573, 0, 0, 6, 1},
+	{18880, 0, 0, 5, 1},
+	{36579, 0, 0, 6, 1},
+	{36585, 0, 0, 8, 1},
+	{36593, 0, 0, 6, 1},
+	{36599, 0, 0, 11, 1},
+	{36610, 0, 0, 6, 1},
+	{36616, 0, 0, 13, 1},
+	{36629, 0, 0, 5, 1},
+	{36634, 0, 0, 6, 1},
+	{19248, 0, 0, 5, 1},
+	{36640, 0, 0, 9, 1},
+	{36649, 0, 0, 7, 1},
+	{36656, 0, 0, 8, 1},
+	{36664, 0, 0, 6, 1},
+	{36670, 0, 0, 9, 1},
+	{36679, 0, 0, 6, 1},
+	{36685, 0, 0, 5, 1},
+	{36690, 0, 0, 6, 1},
+	{36696, 0, 0, 6, 1},
+	{36702, 0, 0, 9, 1},
+	{36711, 0, 0, 6, 1},
+	{36717, 0, 0, 7, 1},
+	{36724, 0, 0, 5, 1},
+	{37, 0, 0, 3, 1},
+	{36605, 0, 0, 5, 1},
+	{36729, 0, 0, 7, 1},
+	{36736, 0, 0, 6, 1},
+	{36742, 0, 0, 9, 1},
+	{18890, 0, 0, 6, 1},
+	{36751, 0, 0, 6, 1},
+	{36757, 0, 0, 9, 1},
+	{36766, 0, 0, 9, 1},
+	{36775, 0, 0, 7, 1},
+	{36782, 0, 0, 8, 1},
+	{36790, 0, 0, 9, 1},
+	{36799, 0, 0, 8, 1},
+	{36807, 0, 0, 6, 1},
+	{36813, 0, 0, 5, 1},
+	{36818, 0, 0, 10, 1},
+	{36828, 0, 0, 6, 1},
+	{36834, 0, 0, 6, 1},
+	{36840, 0, 0, 5, 1},
+	{36845, 0, 0, 8, 1},
+	{36853, 0, 0, 7, 1},
+	{36860, 0, 0, 10, 1},
+	{36870, 0, 0, 6, 1},
+	{36876, 0, 0, 5, 1},
+	{36881, 0, 0, 6, 1},
+	{36887, 0, 0, 7, 1},
+	{36894, 0, 0, 7, 1},
+	{36901, 0, 0, 5, 1},
+	{36462, 0, 0, 5, 1},
+	{36906, 0, 0, 6, 1},
+	{36912, 0, 0, 6, 1},
+	{36918, 0, 0, 6, 1},
+	{36924, 0, 0, 4, 1},
+	{36928, 0, 0, 9, 1},
+	{36937, 0, 0, 6, 1},
+	{36943, 0, 0, 10, 1},
+	{36953, 0, 0, 8, 1},
+	{36961, 0, 0, 8, 1},
+	{36336, 0, 0, 10, 1},
+	{36969, 0, 0, 5, 1},
+	{36974, 0, 0, 5, 1},
+	{36979, 0, 0, 8, 1},
+	{36987, 0, 0, 8, 1},
+	{36995, 0, 0, 7, 1},
+	{37002, 0, 0, 6, 1},
+	{37008, 0, 0, 8, 1},
+	{37016, 0, 0, 7, 1},
+	{37023, 0, 0, 8, 1},
+	{37031, 0, 0, 6, 1},
+	{37037, 0, 0, 8, 1},
+	{37045, 0, 0, 6, 1},
+	{37051, 0, 0, 7, 1},
+	{37058, 0, 0, 6, 1},
+	{36413, 0, 0, 6, 1},
+	{37064, 0, 0, 10, 1},
+	{37074, 0, 0, 6, 1},
+	{37080, 0, 0, 9, 1},
+	{37089, 0, 0, 6, 1},
+	{37095, 0, 0, 10, 1},
+	{37105, 0, 0, 9, 1},
+	{37114, 0, 0, 6, 1},
+	{34232, 0, 0, 4, 1},
+	{37120, 0, 0, 13, 1},
+	{37133, 0, 0, 7, 1},
+	{37140, 0, 0, 6, 1},
+	{37146, 0, 0, 5, 1},
+	{37151, 0, 0, 5, 1},
+	{4608, 0, 0, 6, 1},
+	{37156, 0, 0, 9, 1},
+	{37165, 0, 0, 7, 1},
+	{37172, 0, 0, 6, 1},
+	{37178, 0, 0, 6, 1},
+	{37184, 0, 0, 9, 1},
+	{4028, 0, 0, 4, 1},
+	{36677, 0, 0, 4, 1},
+	{37193, 0, 0, 8, 1},
+	{37201, 0, 0, 6, 1},
+	{37207, 0, 0, 8, 1},
+	{37215, 0, 0, 8, 1},
+	{37223, 0, 0, 7, 1},
+	{37230, 0, 0, 9, 1},
+	{37239, 0, 0, 7, 1},
+	{37246, 0, 0, 10, 1},
+	{37256, 0, 0, 15, 1},
+	{37271, 0, 0, 10, 1},
+	{37281, 0, 0, 5, 1},
+	{37286, 0, 0, 5, 1},
+	{37291, 0, 0, 5, 1},
+	{37296, 0, 0, 7, 1},
+	{7807, 0, 0, 3, 1},
+	{37303, 0, 0, 8, 1},
+	{37311, 0, 0, 6, 1},
+	{37317, 0, 0, 9, 1},
+	{37326, 0, 0, 6, 1},
+	{37332, 0, 0, 7, 1},
+	{37339, 0, 0, 9, 1},
+	{37348, 0, 0, 8, 1},
+	{37356, 0, 0, 7, 1},
+	{37363, 0, 0, 3, 1},
+	{37366, 0, 0, 5, 1},
+	{37371, 0, 0, 5, 1},
+	{37376, 0, 0, 11, 1},
+	{16200, 0, 0, 4, 1},
+	{12431, 0, 0, 4, 1},
+	{37387, 0, 0, 6, 1},
+	{37393, 0, 0, 7, 1},
+	{37400, 0, 0, 10, 1},
+	{37410, 0, 0, 7, 1},
+	{37417, 0, 0, 7, 1},
+	{19107, 0, 0, 5, 1},
+	{37424, 0, 0, 5, 1},
+	{37429, 0, 0, 9, 1},
+	{36413, 0, 0, 6, 1},
+	{37438, 0, 0, 13, 1},
+	{37451, 0, 0, 5, 1},
+	{19194, 0, 0, 3, 1},
+	{3988, 0, 0, 3, 1},
+	{37456, 0, 0, 5, 1},
+	{37461, 0, 0, 5, 1},
+	{36497, 0, 0, 8, 1},
+	{37466, 0, 0, 7, 1},
+	{37473, 0, 0, 6, 1},
+	{37479, 0, 0, 6, 1},
+	{37485, 0, 0, 5, 1},
+	{37490, 0, 0, 7, 1},
+	{37497, 0, 0, 7, 1},
+	{37504, 0, 0, 7, 1},
+	{37511, 0, 0, 10, 1},
+	{37521, 0, 0, 8, 1},
+	{36924, 0, 0, 4, 1},
+	{37529, 0, 0, 7, 1},
+	{37536, 0, 0, 7, 1},
+	{37543, 0, 0, 6, 1},
+	{19640, 0, 0, 7, 1},
+	{37549, 0, 0, 8, 1},
+	{37557, 0, 0, 8, 1},
+	{37565, 0, 0, 6, 1},
+	{37571, 0, 0, 8, 1},
+	{36713, 0, 0, 4, 1},
+	{36385, 0, 0, 6, 1},
+	{37579, 0, 0, 6, 1},
+	{37585, 0, 0, 6, 1},
+	{37591, 0, 0, 6, 1},
+	{27854, 0, 0, 4, 1},
+	{37597, 0, 0, 6, 1},
+	{37603, 0, 0, 6, 1},
+	{37609, 0, 0, 6, 1},
+	{37064, 0, 0, 6, 1},
+	{37615, 0, 0, 6, 1},
+	{37621, 0, 0, 6, 1},
+	{37627, 0, 0, 8, 1},
+	{37635, 0, 0, 8, 1},
+	{37643, 0, 0, 8, 1},
+	{37651, 0, 0, 8, 1},
+	{24722, 0, 0, 6, 1},
+	{36426, 0, 0, 5, 1},
+	{37659, 0, 0, 6, 1},
+	{37665, 0, 0, 5, 1},
+	{37670, 0, 0, 7, 1},
+	{36554, 0, 0, 5, 1},
+	{789, 0, 0, 3, 1},
+	{37677, 0, 0, 5, 1},
+	{20384, 0, 0, 4, 1},
+	{37682, 0, 0, 5, 1},
+	{3180, 0, 0, 3, 1},
+	{37687, 0, 0, 7, 1},
+	{37694, 0, 0, 8, 1},
+	{37702, 0, 0, 6, 1},
+	{37708, 0, 0, 13, 1},
+	{37721, 0, 0, 6, 1},
+	{37727, 0, 0, 5, 1},
+	{16142, 0, 0, 3, 1},
+	{37732, 0, 0, 9, 1},
+	{37741, 0, 0, 6, 1},
+	{37747, 0, 0, 6, 1},
+	{37753, 0, 0, 4, 1},
+	{37757, 0, 0, 7, 1},
+	{37764, 0, 0, 6, 1},
+	{37770, 0, 0, 5, 1},
+	{36976, 0, 0, 3, 1},
+	{37775, 0, 0, 4, 1},
+	{37779, 0, 0, 6, 1},
+	{267, 0, 0, 4, 1},
+	{37785, 0, 0, 8, 1},
+	{37793, 0, 0, 9, 1},
+	{37802, 0, 0, 9, 1},
+	{37811, 0, 0, 10, 1},
+	{37821, 0, 0, 13, 1},
+	{37834, 0, 0, 7, 1},
+	{37841, 0, 0, 6, 1},
+	{1542, 0, 0, 4, 1},
+	{19119, 0, 0, 9, 1},
+	{37847, 0, 0, 8, 1},
+	{37855, 0, 0, 6, 1},
+	{37861, 0, 0, 6, 1},
+	{19640, 0, 0, 7, 1},
+	{37867, 0, 0, 6, 1},
+	{37873, 0, 0, 6, 1},
+	{37879, 0, 0, 6, 1},
+	{37885, 0, 0, 10, 1},
+	{19245, 0, 0, 8, 1},
+	{37895, 0, 0, 5, 1},
+	{37900, 0, 0, 9, 1},
+	{37909, 0, 0, 10, 1},
+	{37919, 0, 0, 8, 1},
+	{37927, 0, 0, 8, 1},
+	{37935, 0, 0, 8, 1},
+	{37943, 0, 0, 12, 1},
+	{37955, 0, 0, 5, 1},
+	{37960, 0, 0, 8, 1},
+	{37968, 0, 0, 6, 1},
+	{37974, 0, 0, 6, 1},
+	{37980, 0, 0, 7, 1},
+	{37440, 0, 0, 5, 1},
+	{37987, 0, 0, 5, 1},
+	{37992, 0, 0, 9, 1},
+	{38001, 0, 0, 7, 1},
+	{38008, 0, 0, 5, 1},
+	{38013, 0, 0, 7, 1},
+	{3988, 0, 0, 3, 1},
+	{38020, 0, 0, 5, 1},
+	{38025, 0, 0, 8, 1},
+	{38033, 0, 0, 7, 1},
+	{38040, 0, 0, 9, 1},
+	{38049, 0, 0, 5, 1},
+	{28078, 0, 0, 4, 1},
+	{38054, 0, 0, 8, 1},
+	{38062, 0, 0, 7, 1},
+	{38069, 0, 0, 8, 1},
+	{38077, 0, 0, 8, 1},
+	{38085, 0, 0, 5, 1},
+	{38090, 0, 0, 6, 1},
+	{37197, 0, 0, 6, 1},
+	{38096, 0, 0, 9, 1},
+	{38105, 0, 0, 7, 1},
+	{38112, 0, 0, 6, 1},
+	{38118, 0, 0, 7, 1},
+	{8275, 0, 0, 3, 1},
+	{19128, 0, 0, 4, 1},
+	{38125, 0, 0, 5, 1},
+	{38130, 0, 0, 4, 1},
+	{38134, 0, 0, 4, 1},
+	{38138, 0, 0, 7, 1},
+	{38145, 0, 0, 7, 1},
+	{38152, 0, 0, 4, 1},
+	{38156, 0, 0, 16, 1},
+	{38172, 0, 0, 7, 1},
+	{37424, 0, 0, 5, 1},
+	{38179, 0, 0, 12, 1},
+	{28532, 0, 0, 4, 1},
+	{38191, 0, 0, 8, 1},
+	{38199, 0, 0, 9, 1},
+	{38208, 0, 0, 6, 1},
+	{38214, 0, 0, 8, 1},
+	{38222, 0, 0, 4, 1},
+	{38226, 0, 0, 8, 1},
+	{38234, 0, 0, 6, 1},
+	{38240, 0, 0, 8, 1},
+	{38248, 0, 0, 6, 1},
+	{38254, 0, 0, 11, 1},
+	{38265, 0, 0, 5, 1},
+	{38270, 0, 0, 8, 1},
+	{38278, 0, 0, 4, 1},
+	{38282, 0, 0, 10, 1},
+	{38040, 0, 0, 9, 1},
+	{38292, 0, 0, 6, 1},
+	{38298, 0, 0, 8, 1},
+	{38306, 0, 0, 5, 1},
+	{38311, 0, 0, 4, 1},
+	{38315, 0, 0, 6, 1},
+	{38321, 0, 0, 8, 1},
+	{20310, 0, 0, 8, 1},
+	{38329, 0, 0, 6, 1},
+	{38335, 0, 0, 4, 1},
+	{38339, 0, 0, 6, 1},
+	{38345, 0, 0, 7, 1},
+	{38352, 0, 0, 7, 1},
+	{38359, 0, 0, 15, 1},
+	{38374, 0, 0, 7, 1},
+	{38381, 0, 0, 7, 1},
+	{38388, 0, 0, 5, 1},
+	{38393, 0, 0, 5, 1},
+	{38398, 0, 0, 9, 1},
+	{37837, 0, 0, 6, 1},
+	{38407, 0, 0, 5, 1},
+	{38412, 0, 0, 7, 1},
+	{38419, 0, 0, 8, 1},
+	{38427, 0, 0, 5, 1},
+	{37058, 0, 0, 6, 1},
+	{38432, 0, 0, 8, 1},
+	{38440, 0, 0, 10, 1},
+	{38450, 0, 0, 8, 1},
+	{38458, 0, 0, 7, 1},
+	{38465, 0, 0, 6, 1},
+	{38471, 0, 0, 6, 1},
+	{95, 0, 0, 3, 1},
+	{5143, 0, 0, 3, 1},
+	{38477, 0, 0, 9, 1},
+	{38486, 0, 0, 9, 1},
+	{38495, 0, 0, 6, 1},
+	{38049, 0, 0, 5, 1},
+	{38501, 0, 0, 8, 1},
+	{38298, 0, 0, 8, 1},
+	{38509, 0, 0, 8, 1},
+	{38517, 0, 0, 11, 1},
+	{38528, 0, 0, 7, 1},
+	{38535, 0, 0, 9, 1},
+	{38544, 0, 0, 8, 1},
+	{38552, 0, 0, 4, 1},
+	{38556, 0, 0, 8, 1},
+	{38564, 0, 0, 9, 1},
+	{38573, 0, 0, 5, 1},
+	{38578, 0, 0, 7, 1},
+	{38585, 0, 0, 5, 1},
+	{38590, 0, 0, 8, 1},
+	{38598, 0, 0, 11, 1},
+	{38609, 0, 0, 16, 1},
+	{38625, 0, 0, 5, 1},
+	{38630, 0, 0, 12, 1},
+	{38642, 0, 0, 5, 1},
+	{19109, 0, 0, 3, 1},
+	{38647, 0, 0, 6, 1},
+	{38653, 0, 0, 4, 1},
+	{38657, 0, 0, 6, 1},
+	{36419, 0, 0, 7, 1},
+	{24722, 0, 0, 4, 1},
+	{38663, 0, 0, 8, 1},
+	{38671, 0, 0, 13, 1},
+	{38684, 0, 0, 5, 1},
+	{4030, 0, 0, 4, 1},
+	{3561, 0, 0, 4, 1},
+	{38689, 0, 0, 9, 1},
+	{38698, 0, 0, 8, 1},
+	{38706, 0, 0, 7, 1},
+	{38713, 0, 0, 8, 1},
+	{38721, 0, 0, 8, 1},
+	{38729, 0, 0, 5, 1},
+	{38734, 0, 0, 7, 1},
+	{38741, 0, 0, 7, 1},
+	{38748, 0, 0, 7, 1},
+	{38755, 0, 0, 9, 1},
+	{38764, 0, 0, 9, 1},
+	{38773, 0, 0, 6, 1},
+	{38779, 0, 0, 6, 1},
+	{38368, 0, 0, 6, 1},
+	{38785, 0, 0, 5, 1},
+	{38790, 0, 0, 4, 1},
+	{38794, 0, 0, 6, 1},
+	{38800, 0, 0, 6, 1},
+	{38806, 0, 0, 8, 1},
+	{38814, 0, 0, 11, 1},
+	{38825, 0, 0, 7, 1},
+	{1542, 0, 0, 4, 1},
+	{38832, 0, 0, 6, 1},
+	{38838, 0, 0, 7, 1},
+	{38845, 0, 0, 5, 1},
+	{38850, 0, 0, 5, 1},
+	{27536, 0, 0, 4, 1},
+	{38855, 0, 0, 6, 1},
+	{38861, 0, 0, 8, 1},
+	{19119, 0, 0, 9, 1},
+	{38869, 0, 0, 6, 1},
+	{38875, 0, 0, 8, 1},
+	{38883, 0, 0, 6, 1},
+	{38889, 0, 0, 8, 1},
+	{38897, 0, 0, 12, 1},
+	{38909, 0, 0, 6, 1},
+	{38915, 0, 0, 13, 1},
+	{38928, 0, 0, 11, 1},
+	{36720, 0, 0, 5, 1},
+	{38939, 0, 0, 7, 1},
+	{38946, 0, 0, 6, 1},
+	{38952, 0, 0, 8, 1},
+	{38960, 0, 0, 9, 1},
+	{38969, 0, 0, 8, 1},
+	{37424, 0, 0, 5, 1},
+	{38977, 0, 0, 7, 1},
+	{38984, 0, 0, 8, 1},
+	{38992, 0, 0, 9, 1},
+	{39001, 0, 0, 6, 1},
+	{39007, 0, 0, 10, 1},
+	{39017, 0, 0, 8, 1},
+	{39025, 0, 0, 11, 1},
+	{39036, 0, 0, 12, 1},
+	{39048, 0, 0, 8, 1},
+	{39056, 0, 0, 6, 1},
+	{39062, 0, 0, 8, 1},
+	{39070, 0, 0, 7, 1},
+	{39077, 0, 0, 9, 1},
+	{39086, 0, 0, 13, 1},
+	{39099, 0, 0, 6, 1},
+	{39105, 0, 0, 8, 1},
+	{39113, 0, 0, 9, 1},
+	{39122, 0, 0, 8, 1},
+	{39130, 0, 0, 8, 1},
+	{39138, 0, 0, 12, 1},
+	{39150, 0, 0, 7, 1},
+	{39157, 0, 0, 7, 1},
+	{36685, 0, 0, 5, 1},
+	{39164, 0, 0, 7, 1},
+	{39171, 0, 0, 8, 1},
+	{39179, 0, 0, 6, 1},
+	{39185, 0, 0, 12, 1},
+	{39197, 0, 0, 8, 1},
+	{39205, 0, 0, 8, 1},
+	{39213, 0, 0, 6, 1},
+	{39219, 0, 0, 7, 1},
+	{39226, 0, 0, 4, 1},
+	{37651, 0, 0, 8, 1},
+	{39230, 0, 0, 12, 1},
+	{39242, 0, 0, 12, 1},
+	{39254, 0, 0, 5, 1},
+	{39259, 0, 0, 7, 1},
+	{39266, 0, 0, 6, 1},
+	{39272, 0, 0, 6, 1},
+	{39278, 0, 0, 8, 1},
+	{19468, 0, 0, 4, 1},
+	{39286, 0, 0, 11, 1},
+	{39297, 0, 0, 11, 1},
+	{38465, 0, 0, 6, 1},
+	{39308, 0, 0, 7, 1},
+	{38805, 0, 0, 5, 1},
+	{39315, 0, 0, 5, 1},
+	{39291, 0, 0, 6, 1},
+	{39320, 0, 0, 5, 1},
+	{39325, 0, 0, 5, 1},
+	{39330, 0, 0, 7, 1},
+	{39337, 0, 0, 9, 1},
+	{39346, 0, 0, 4, 1},
+	{39350, 0, 0, 5, 1},
+	{39355, 0, 0, 5, 1},
+	{39360, 0, 0, 8, 1},
+	{39368, 0, 0, 5, 1},
+	{39373, 0, 0, 9, 1},
+	{39382, 0, 0, 7, 1},
+	{39389, 0, 0, 11, 1},
+	{39400, 0, 0, 6, 1},
+	{39406, 0, 0, 9, 1},
+	{39415, 0, 0, 8, 1},
+	{39423, 0, 0, 5, 1},
+	{39428, 0, 0, 8, 1},
+	{38765, 0, 0, 8, 1},
+	{39436, 0, 0, 7, 1},
+	{39443, 0, 0, 7, 1},
+	{39450, 0, 0, 9, 1},
+	{39115, 0, 0, 7, 1},
+	{39459, 0, 0, 9, 1},
+	{39468, 0, 0, 12, 1},
+	{39480, 0, 0, 8, 1},
+	{39488, 0, 0, 9, 1},
+	{39497, 0, 0, 7, 1},
+	{39504, 0, 0, 9, 1},
+	{39513, 0, 0, 7, 1},
+	{39040, 0, 0, 8, 1},
+	{39520, 0, 0, 5, 1},
+	{39525, 0, 0, 6, 1},
+	{39531, 0, 0, 8, 1},
+	{39539, 0, 0, 8, 1},
+	{39547, 0, 0, 9, 1},
+	{39556, 0, 0, 7, 1},
+	{39563, 0, 0, 5, 1},
+	{39568, 0, 0, 9, 1},
+	{39577, 0, 0, 6, 1},
+	{19732, 0, 0, 4, 1},
+	{39583, 0, 0, 6, 1},
+	{39589, 0, 0, 8, 1},
+	{39597, 0, 0, 7, 1},
+	{39604, 0, 0, 8, 1},
+	{39612, 0, 0, 9, 1},
+	{39621, 0, 0, 7, 1},
+	{39628, 0, 0, 6, 1},
+	{38942, 0, 0, 4, 1},
+	{39634, 0, 0, 9, 1},
+	{39643, 0, 0, 8, 1},
+	{39651, 0, 0, 7, 1},
+	{39658, 0, 0, 6, 1},
+	{39664, 0, 0, 6, 1},
+	{39670, 0, 0, 4, 1},
+	{36994, 0, 0, 6, 1},
+	{32853, 0, 0, 3, 1},
+	{39674, 0, 0, 9, 1},
+	{38264, 0, 0, 6, 1},
+	{39683, 0, 0, 5, 1},
+	{37479, 0, 0, 6, 1},
+	{39688, 0, 0, 5, 1},
+	{39693, 0, 0, 8, 1},
+	{39701, 0, 0, 7, 1},
+	{39708, 0, 0, 6, 1},
+	{39714, 0, 0, 6, 1},
+	{36961, 0, 0, 8, 1},
+	{39720, 0, 0, 7, 1},
+	{39100, 0, 0, 5, 1},
+	{39727, 0, 0, 8, 1},
+	{39735, 0, 0, 8, 1},
+	{39017, 0, 0, 8, 1},
+	{39743, 0, 0, 5, 1},
+	{36385, 0, 0, 6, 1},
+	{39748, 0, 0, 9, 1},
+	{39103, 0, 0, 4, 1},
+	{39757, 0, 0, 11, 1},
+	{39768, 0, 0, 11, 1},
+	{39779, 0, 0, 9, 1},
+	{3988, 0, 0, 3, 1},
+	{39788, 0, 0, 5, 1},
+	{39793, 0, 0, 6, 1},
+	{39799, 0, 0, 8, 1},
+	{39807, 0, 0, 4, 1},
+	{37702, 0, 0, 6, 1},
+	{39811, 0, 0, 9, 1},
+	{39820, 0, 0, 5, 1},
+	{39825, 0, 0, 6, 1},
+	{38062, 0, 0, 6, 1},
+	{36497, 0, 0, 4, 1},
+	{39831, 0, 0, 10, 1},
+	{39841, 0, 0, 8, 1},
+	{39539, 0, 0, 6, 1},
+	{39849, 0, 0, 5, 1},
+	{39854, 0, 0, 7, 1},
+	{39861, 0, 0, 7, 1},
+	{37483, 0, 0, 4, 1},
+	{39868, 0, 0, 7, 1},
+	{36553, 0, 0, 4, 1},
+	{36553, 0, 0, 6, 1},
+	{263, 0, 0, 3, 1},
+	{36462, 0, 0, 5, 1},
+	{39875, 0, 0, 5, 1},
+	{39880, 0, 0, 8, 1},
+	{39888, 0, 0, 5, 1},
+	{39893, 0, 0, 9, 1},
+	{2635, 0, 0, 7, 1},
+	{39902, 0, 0, 11, 1},
+	{39913, 0, 0, 12, 1},
+	{39925, 0, 0, 10, 1},
+	{19232, 0, 0, 7, 1},
+	{202, 0, 0, 3, 1},
+	{39935, 0, 0, 8, 1},
+	{36676, 0, 0, 5, 1},
+	{39943, 0, 0, 5, 1},
+	{39948, 0, 0, 4, 1},
+	{39036, 0, 0, 6, 1},
+	{38199, 0, 0, 6, 1},
+	{39952, 0, 0, 7, 1},
+	{39959, 0, 0, 11, 1},
+	{27854, 0, 0, 4, 1},
+	{39970, 0, 0, 4, 1},
+	{39595, 0, 0, 4, 1},
+	{39974, 0, 0, 6, 1},
+	{24722, 0, 0, 4, 1},
+	{39980, 0, 0, 8, 1},
+	{39988, 0, 0, 5, 1},
+	{36990, 0, 0, 5, 1},
+	{39993, 0, 0, 7, 1},
+	{40000, 0, 0, 9, 1},
+	{37461, 0, 0, 5, 1},
+	{40009, 0, 0, 10, 1},
+	{40019, 0, 0, 9, 1},
+	{40028, 0, 0, 10, 1},
+	{40038, 0, 0, 9, 1},
+	{40047, 0, 0, 4, 1},
+	{40051, 0, 0, 5, 1},
+	{40056, 0, 0, 8, 1},
+	{40064, 0, 0, 11, 1},
+	{36522, 0, 0, 5, 1},
+	{40075, 0, 0, 6, 1},
+	{839, 0, 0, 4, 1},
+	{40081, 0, 0, 6, 1},
+	{40087, 0, 0, 9, 1},
+	{40096, 0, 0, 7, 1},
+	{40103, 0, 0, 8, 1},
+	{40111, 0, 0, 6, 1},
+	{37239, 0, 0, 7, 1},
+	{20310, 0, 0, 8, 1},
+	{40117, 0, 0, 6, 1},
+	{40123, 0, 0, 4, 1},
+	{40127, 0, 0, 7, 1},
+	{40134, 0, 0, 5, 1},
+	{40139, 0, 0, 7, 1},
+	{19272, 0, 0, 4, 1},
+	{40146, 0, 0, 6, 1},
+	{40152, 0, 0, 8, 1},
+	{40160, 0, 0, 8, 1},
+	{3136, 0, 0, 7, 1},
+	{40168, 0, 0, 8, 1},
+	{40176, 0, 0, 5, 1},
+	{9065, 0, 0, 4, 1},
+	{40181, 0, 0, 8, 1},
+	{17587, 0, 0, 4, 1},
+	{19246, 0, 0, 5, 1},
+	{5094, 0, 0, 4, 1},
+	{40189, 0, 0, 7, 1},
+	{40196, 0, 0, 7, 1},
+	{40203, 0, 0, 8, 1},
+	{37394, 0, 0, 6, 1},
+	{40211, 0, 0, 5, 1},
+	{40216, 0, 0, 8, 1},
+	{40224, 0, 0, 8, 1},
+	{40232, 0, 0, 9, 1},
+	{37873, 0, 0, 6, 1},
+	{36862, 0, 0, 8, 1},
+	{40241, 0, 0, 10, 1},
+	{40251, 0, 0, 8, 1},
+	{19258, 0, 0, 5, 1},
+	{40259, 0, 0, 6, 1},
+	{40265, 0, 0, 8, 1},
+	{40273, 0, 0, 10, 1},
+	{40283, 0, 0, 7, 1},
+	{19249, 0, 0, 5, 1},
+	{40290, 0, 0, 8, 1},
+	{40298, 0, 0, 4, 1},
+	{36847, 0, 0, 6, 1},
+	{40302, 0, 0, 8, 1},
+	{37615, 0, 0, 6, 1},
+	{40310, 0, 0, 8, 1},
+	{40318, 0, 0, 7, 1},
+	{40325, 0, 0, 6, 1},
+	{34232, 0, 0, 4, 1},
+	{40331, 0, 0, 7, 1},
+	{40338, 0, 0, 4, 1},
+	{40342, 0, 0, 7, 1},
+	{40349, 0, 0, 13, 1},
+	{36997, 0, 0, 5, 1},
+	{40362, 0, 0, 11, 1},
+	{40373, 0, 0, 6, 1},
+	{40379, 0, 0, 8, 1},
+	{25018, 0, 0, 4, 1},
+	{40387, 0, 0, 6, 1},
+	{37779, 0, 0, 6, 1},
+	{40393, 0, 0, 7, 1},
+	{40400, 0, 0, 13, 1},
+	{40413, 0, 0, 7, 1},
+	{40420, 0, 0, 8, 1},
+	{40428, 0, 0, 5, 1},
+	{40433, 0, 0, 8, 1},
+	{39595, 0, 0, 6, 1},
+	{40441, 0, 0, 8, 1},
+	{40449, 0, 0, 6, 1},
+	{40455, 0, 0, 7, 1},
+	{40462, 0, 0, 9, 1},
+	{40471, 0, 0, 7, 1},
+	{40478, 0, 0, 8, 1},
+	{40486, 0, 0, 5, 1},
+	{40491, 0, 0, 8, 1},
+	{40499, 0, 0, 5, 1},
+	{275, 0, 0, 5, 1},
+	{40504, 0, 0, 5, 1},
+	{1891, 0, 0, 3, 1},
+	{4439, 0, 0, 4, 1},
+	{37812, 0, 0, 5, 1},
+	{19278, 0, 0, 9, 1},
+	{40509, 0, 0, 6, 1},
+	{40515, 0, 0, 8, 1},
+	{40523, 0, 0, 5, 1},
+	{40528, 0, 0, 7, 1},
+	{40535, 0, 0, 10, 1},
+	{40545, 0, 0, 9, 1},
+	{40554, 0, 0, 10, 1},
+	{40564, 0, 0, 8, 1},
+	{40572, 0, 0, 12, 1},
+	{40584, 0, 0, 13, 1},
+	{40597, 0, 0, 3, 1},
+	{40600, 0, 0, 8, 1},
+	{40608, 0, 0, 5, 1},
+	{39746, 0, 0, 6, 1},
+	{40613, 0, 0, 6, 1},
+	{40619, 0, 0, 5, 1},
+	{40624, 0, 0, 9, 1},
+	{40633, 0, 0, 5, 1},
+	{40216, 0, 0, 8, 1},
+	{40638, 0, 0, 6, 1},
+	{40644, 0, 0, 6, 1},
+	{40650, 0, 0, 9, 1},
+	{40659, 0, 0, 7, 1},
+	{40666, 0, 0, 6, 1},
+	{40672, 0, 0, 8, 1},
+	{40680, 0, 0, 8, 1},
+	{40688, 0, 0, 7, 1},
+	{40695, 0, 0, 14, 1},
+	{40709, 0, 0, 5, 1},
+	{40714, 0, 0, 5, 1},
+	{40719, 0, 0, 8, 1},
+	{40727, 0, 0, 7, 1},
+	{304, 0, 0, 2, 1},
+	{40734, 0, 0, 4, 1},
+	{40738, 0, 0, 10, 1},
+	{40748, 0, 0, 8, 1},
+	{40756, 0, 0, 6, 1},
+	{40762, 0, 0, 8, 1},
+	{37197, 0, 0, 6, 1},
+	{40770, 0, 0, 8, 1},
+	{40778, 0, 0, 8, 1},
+	{40786, 0, 0, 4, 1},
+	{40790, 0, 0, 5, 1},
+	{1171, 0, 0, 4, 4},
+	{1171, 0, 0, 4, 4},
+	{1171, 0, 0, 4, 4},
+	{3096, 0, 0, 3, 1},
+	{40795, 0, 0, 6, 1},
+	{38909, 0, 0, 6, 1},
+	{40801, 0, 0, 12, 1},
+	{1019, 0, 0, 3, 1},
+	{37909, 0, 0, 6, 1},
+	{36640, 0, 0, 4, 1},
+	{40813, 0, 0, 8, 1},
+	{19343, 0, 0, 5, 1},
+	{38657, 0, 0, 6, 1},
+	{40821, 0, 0, 8, 1},
+	{40829, 0, 0, 6, 1},
+	{40835, 0, 0, 6, 1},
+	{40841, 0, 0, 8, 1},
+	{40849, 0, 0, 7, 1},
+	{40856, 0, 0, 9, 1},
+	{40865, 0, 0, 10, 1},
+	{19344, 0, 0, 4, 1},
+	{36554, 0, 0, 5, 1},
+	{37756, 0, 0, 5, 1},
+	{40875, 0, 0, 6, 1},
+	{37835, 0, 0, 6, 1},
+	{40881, 0, 0, 6, 1},
+	{40887, 0, 0, 6, 1},
+	{449, 0, 0, 4, 1},
+	{40893, 0, 0, 11, 1},
+	{5330, 0, 0, 4, 1},
+	{37334, 0, 0, 5, 1},
+	{40904, 0, 0, 5, 1},
+	{40909, 0, 0, 6, 1},
+	{40915, 0, 0, 8, 1},
+	{40923, 0, 0, 7, 1},
+	{38660, 0, 0, 4, 1},
+	{4050, 0, 0, 3, 1},
+	{40930, 0, 0, 5, 1},
+	{40935, 0, 0, 7, 1},
+	{40942, 0, 0, 11, 1},
+	{40953, 0, 0, 7, 1},
+	{19348, 0, 0, 8, 1},
+	{40960, 0, 0, 7, 1},
+	{40967, 0, 0, 6, 1},
+	{40973, 0, 0, 8, 1},
+	{40981, 0, 0, 11, 1},
+	{40992, 0, 0, 6, 1},
+	{40998, 0, 0, 9, 1},
+	{40987, 0, 0, 5, 1},
+	{37363, 0, 0, 3, 1},
+	{39825, 0, 0, 6, 1},
+	{41007, 0, 0, 8, 1},
+	{5097, 0, 0, 3, 1},
+	{444, 0, 0, 3, 1},
+	{20310, 0, 0, 6, 1},
+	{37197, 0, 0, 6, 1},
+	{41015, 0, 0, 10, 1},
+	{39057, 0, 0, 5, 1},
+	{41025, 0, 0, 11, 1},
+	{41036, 0, 0, 11, 1},
+	{1635, 0, 0, 3, 1},
+	{890, 0, 0, 3, 1},
+	{41047, 0, 0, 4, 1},
+	{41051, 0, 0, 7, 1},
+	{36987, 0, 0, 4, 1},
+	{10135, 0, 0, 4, 1},
+	{41058, 0, 0, 4, 1},
+	{41062, 0, 0, 8, 1},
+	{41070, 0, 0, 8, 1},
+	{41078, 0, 0, 9, 1},
+	{41087, 0, 0, 8, 1},
+	{41095, 0, 0, 7, 1},
+	{37064, 0, 0, 6, 1},
+	{41102, 0, 0, 15, 1},
+	{41117, 0, 0, 6, 1},
+	{41123, 0, 0, 4, 1},
+	{41127, 0, 0, 10, 1},
+	{41137, 0, 0, 7, 1},
+	{41144, 0, 0, 6, 1},
+	{41150, 0, 0, 9, 1},
+	{41159, 0, 0, 5, 1},
+	{40669, 0, 0, 5, 1},
+	{41081, 0, 0, 6, 1},
+	{2251, 0, 0, 3, 1},
+	{41164, 0, 0, 9, 1},
+	{41173, 0, 0, 6, 1},
+	{41179, 0, 0, 9, 1},
+	{37400, 0, 0, 6, 1},
+	{36462, 0, 0, 5, 1},
+	{41188, 0, 0, 5, 1},
+	{1486, 0, 0, 3, 1},
+	{41193, 0, 0, 8, 1},
+	{41201, 0, 0, 7, 1},
+	{37311, 0, 0, 4, 1},
+	{41208, 0, 0, 8, 1},
+	{41216, 0, 0, 4, 1},
+	{41220, 0, 0, 6, 1},
+	{38647, 0, 0, 6, 1},
+	{41226, 0, 0, 6, 1},
+	{41232, 0, 0, 9, 1},
+	{38427, 0, 0, 5, 1},
+	{36413, 0, 0, 6, 1},
+	{41241, 0, 0, 9, 1},
+	{41250, 0, 0, 6, 1},
+	{37621, 0, 0, 6, 1},
+	{41256, 0, 0, 6, 1},
+	{19123, 0, 0, 5, 1},
+	{41262, 0, 0, 6, 1},
+	{40455, 0, 0, 4, 1},
+	{39520, 0, 0, 5, 1},
+	{37147, 0, 0, 4, 1},
+	{41268, 0, 0, 6, 1},
+	{41274, 0, 0, 4, 1},
+	{1554, 0, 0, 3, 1},
+	{37850, 0, 0, 5, 1},
+	{41278, 0, 0, 8, 1},
+	{41286, 0, 0, 7, 1},
+	{41293, 0, 0, 9, 1},
+	{41302, 0, 0, 8, 1},
+	{41310, 0, 0, 17, 1},
+	{41327, 0, 0, 10, 1},
+	{41337, 0, 0, 7, 1},
+	{41344, 0, 0, 6, 1},
+	{36640, 0, 0, 4, 1},
+	{19305, 0, 0, 8, 1},
+	{41350, 0, 0, 8, 1},
+	{41317, 0, 0, 10, 1},
+	{41358, 0, 0, 13, 1},
+	{36690, 0, 0, 6, 1},
+	{38513, 0, 0, 6, 1},
+	{41371, 0, 0, 6, 1},
+	{41377, 0, 0, 7, 1},
+	{40423, 0, 0, 5, 1},
+	{41384, 0, 0, 7, 1},
+	{36785, 0, 0, 5, 1},
+	{39394, 0, 0, 4, 1},
+	{41391, 0, 0, 6, 1},
+	{41397, 0, 0, 7, 1},
+	{41404, 0, 0, 13, 1},
+	{41417, 0, 0, 7, 1},
+	{41424, 0, 0, 8, 1},
+	{37172, 0, 0, 9, 1},
+	{41432, 0, 0, 6, 1},
+	{41438, 0, 0, 5, 1},
+	{10514, 0, 0, 4, 1},
+	{41443, 0, 0, 6, 1},
+	{41449, 0, 0, 6, 1},
+	{41455, 0, 0, 6, 1},
+	{41461, 0, 0, 8, 1},
+	{41469, 0, 0, 3, 1},
+	{196, 0, 0, 3, 1},
+	{41472, 0, 0, 5, 1},
+	{41477, 0, 0, 6, 1},
+	{41483, 0, 0, 5, 1},
+	{41488, 0, 0, 8, 1},
+	{41496, 0, 0, 10, 1},
+	{41506, 0, 0, 4, 1},
+	{40813, 0, 0, 8, 1},
+	{37935, 0, 0, 8, 1},
+	{41510, 0, 0, 7, 1},
+	{41517, 0, 0, 9, 1},
+	{41526, 0, 0, 8, 1},
+	{19121, 0, 0, 7, 1},
+	{41534, 0, 0, 6, 1},
+	{41540, 0, 0, 10, 1},
+	{19415, 0, 0, 8, 1},
+	{41550, 0, 0, 9, 1},
+	{41559, 0, 0, 8, 1},
+	{41567, 0, 0, 9, 1},
+	{41576, 0, 0, 7, 1},
+	{41583, 0, 0, 5, 1},
+	{41588, 0, 0, 6, 1},
+	{41594, 0, 0, 8, 1},
+	{41602, 0, 0, 8, 1},
+	{41610, 0, 0, 8, 1},
+	{41618, 0, 0, 8, 1},
+	{37334, 0, 0, 5, 1},
+	{2638, 0, 0, 4, 1},
+	{41626, 0, 0, 8, 1},
+	{491, 0, 0, 4, 1},
+	{41634, 0, 0, 4, 1},
+	{36462, 0, 0, 5, 1},
+	{41638, 0, 0, 7, 1},
+	{41645, 0, 0, 9, 1},
+	{19345, 0, 0, 7, 1},
+	{36337, 0, 0, 5, 1},
+	{41654, 0, 0, 6, 1},
+	{41660, 0, 0, 6, 1},
+	{26868, 0, 0, 4, 1},
+	{41666, 0, 0, 6, 1},
+	{26225, 0, 0, 4, 1},
+	{41672, 0, 0, 6, 1},
+	{41678, 0, 0, 6, 1},
+	{41684, 0, 0, 6, 1},
+	{37424, 0, 0, 5, 1},
+	{41690, 0, 0, 7, 1},
+	{202, 0, 0, 3, 1},
+	{41697, 0, 0, 9, 1},
+	{39021, 0, 0, 8, 1},
+	{41208, 0, 0, 4, 1},
+	{41706, 0, 0, 13, 1},
+	{41719, 0, 0, 8, 1},
+	{41727, 0, 0, 8, 1},
+	{41735, 0, 0, 6, 1},
+	{38203, 0, 0, 9, 1},
+	{40545, 0, 0, 9, 1},
+	{41741, 0, 0, 5, 1},
+	{41746, 0, 0, 10, 1},
+	{41756, 0, 0, 10, 1},
+	{41766, 0, 0, 12, 1},
+	{41772, 0, 0, 6, 1},
+	{41778, 0, 0, 6, 1},
+	{41784, 0, 0, 6, 1},
+	{41790, 0, 0, 9, 1},
+	{19436, 0, 0, 6, 1},
+	{19289, 0, 0, 6, 1},
+	{41799, 0, 0, 6, 1},
+	{37651, 0, 0, 8, 1},
+	{38450, 0, 0, 6, 1},
+	{41805, 0, 0, 11, 1},
+	{41816, 0, 0, 5, 1},
+	{36990, 0, 0, 5, 1},
+	{19489, 0, 0, 5, 1},
+	{41821, 0, 0, 6, 1},
+	{9066, 0, 0, 3, 1},
+	{41827, 0, 0, 6, 1},
+	{41833, 0, 0, 7, 1},
+	{37146, 0, 0, 5, 1},
+	{41840, 0, 0, 5, 1},
+	{37151, 0, 0, 5, 1},
+	{41845, 0, 0, 6, 1},
+	{4608, 0, 0, 4, 1},
+	{41851, 0, 0, 6, 1},
+	{41857, 0, 0, 9, 1},
+	{41866, 0, 0, 12, 1},
+	{41878, 0, 0, 8, 1},
+	{33314, 0, 0, 4, 1},
+	{41886, 0, 0, 6, 1},
+	{41892, 0, 0, 6, 1},
+	{41007, 0, 0, 8, 1},
+	{38298, 0, 0, 8, 1},
+	{41898, 0, 0, 9, 1},
+	{39854, 0, 0, 7, 1},
+	{41907, 0, 0, 9, 1},
+	{41916, 0, 0, 6, 1},
+	{34811, 0, 0, 4, 1},
+	{41922, 0, 0, 4, 1},
+	{36883, 0, 0, 4, 1},
+	{20310, 0, 0, 8, 1},
+	{41926, 0, 0, 10, 1},
+	{41936, 0, 0, 6, 1},
+	{41942, 0, 0, 7, 1},
+	{41949, 0, 0, 7, 1},
+	{39410, 0, 0, 5, 1},
+	{36520, 0, 0, 4, 1},
+	{41956, 0, 0, 6, 1},
+	{41962, 0, 0, 6, 1},
+	{5530, 0, 0, 3, 1},
+	{41968, 0, 0, 7, 1},
+	{38073, 0, 0, 8, 1},
+	{41975, 0, 0, 10, 1},
+	{41985, 0, 0, 8, 1},
+	{19442, 0, 0, 8, 1},
+	{37451, 0, 0, 5, 1},
+	{41993, 0, 0, 5, 1},
+	{41998, 0, 0, 5, 1},
+	{42003, 0, 0, 6, 1},
+	{42009, 0, 0, 6, 1},
+	{40798, 0, 0, 5, 1},
+	{42015, 0, 0, 9, 1},
+	{42024, 0, 0, 12, 1},
+	{42036, 0, 0, 7, 1},
+	{36565, 0, 0, 8, 1},
+	{42043, 0, 0, 5, 1},
+	{1171, 0, 0, 4, 4},
+	{25029, 0, 0, 4, 1},
+	{42048, 0, 0, 4, 1},
+	{42052, 0, 0, 6, 1},
+	{42058, 0, 0, 14, 1},
+	{42072, 0, 0, 7, 1},
+	{41726, 0, 0, 5, 1},
+	{42079, 0, 0, 12, 1},
+	{42091, 0, 0, 7, 1},
+	{42098, 0, 0, 7, 1},
+	{42105, 0, 0, 9, 1},
+	{42114, 0, 0, 9, 1},
+	{19249, 0, 0, 5, 1},
+	{39021, 0, 0, 8, 1},
+	{39748, 0, 0, 9, 1},
+	{42123, 0, 0, 5, 1},
+	{42128, 0, 0, 8, 1},
+	{42136, 0, 0, 6, 1},
+	{42142, 0, 0, 6, 1},
+	{19457, 0, 0, 4, 1},
+	{42148, 0, 0, 8, 1},
+	{38629, 0, 0, 3, 1},
+	{9643, 0, 0, 4, 1},
+	{42156, 0, 0, 5, 1},
+	{42161, 0, 0, 7, 1},
+	{42168, 0, 0, 5, 1},
+	{42173, 0, 0, 9, 1},
+	{42182, 0, 0, 13, 1},
+	{42195, 0, 0, 6, 1},
+	{4051, 0, 0, 4, 1},
+	{42201, 0, 0, 8, 1},
+	{42209, 0, 0, 10, 1},
+	{42219, 0, 0, 7, 1},
+	{42226, 0, 0, 5, 1},
+	{9644, 0, 0, 3, 1},
+	{42231, 0, 0, 14, 1},
+	{42245, 0, 0, 12, 1},
+	{42257, 0, 0, 7, 1},
+	{39809, 0, 0, 7, 1},
+	{42264, 9609, 1, 7, 0},
+	{42271, 0, 0, 6, 1},
+	{130, 0, 0, 3, 1},
+	{19437, 0, 0, 5, 1},
+	{42277, 0, 0, 5, 1},
+	{42282, 0, 0, 8, 1},
+	{42290, 0, 0, 9, 1},
+	{42299, 0, 0, 6, 1},
+	{36987, 0, 0, 4, 1},
+	{42305, 0, 0, 6, 1},
+	{42311, 0, 0, 11, 1},
+	{42322, 0, 0, 12, 1},
+	{42334, 0, 0, 7, 1},
+	{42341, 0, 0, 5, 1},
+	{42346, 0, 0, 8, 1},
+	{42354, 0, 0, 5, 1},
+	{41127, 0, 0, 7, 1},
+	{19461, 0, 0, 7, 1},
+	{42359, 0, 0, 5, 1},
+	{9066, 0, 0, 3, 1},
+	{42364, 0, 0, 4, 1},
+	{42368, 0, 0, 5, 1},
+	{42373, 0, 0, 5, 1},
+	{42378, 0, 0, 6, 1},
+	{42384, 0, 0, 8, 1},
+	{41397, 0, 0, 7, 1},
+	{36658, 0, 0, 6, 1},
+	{42392, 0, 0, 6, 1},
+	{42398, 0, 0, 6, 1},
+	{42404, 0, 0, 9, 1},
+	{42413, 0, 0, 7, 1},
+	{39251, 0, 0, 6, 1},
+	{42328, 0, 0, 6, 1},
+	{42420, 0, 0, 6, 1},
+	{42426, 0, 0, 5, 1},
+	{42431, 0, 0, 6, 1},
+	{42437, 0, 0, 5, 1},
+	{42442, 0, 0, 8, 1},
+	{42450, 0, 0, 11, 1},
+	{42461, 0, 0, 6, 1},
+	{41950, 0, 0, 4, 1},
+	{42467, 0, 0, 9, 1},
+	{2635, 0, 0, 4, 1},
+	{42476, 0, 0, 8, 1},
+	{42484, 0, 0, 7, 1},
+	{37037, 0, 0, 4, 1},
+	{42491, 0, 0, 8, 1},
+	{42499, 0, 0, 4, 1},
+	{19485, 0, 0, 4, 1},
+	{42503, 0, 0, 5, 1},
+	{42508, 0, 0, 6, 1},
+	{42514, 0, 0, 7, 1},
+	{154, 0, 0, 3, 1},
+	{42521, 0, 0, 5, 1},
+	{36296, 0, 0, 4, 1},
+	{42526, 0, 0, 6, 1},
+	{42532, 0, 0, 8, 1},
+	{42540, 0, 0, 5, 1},
+	{42545, 0, 0, 9, 1},
+	{19232, 0, 0, 5, 1},
+	{42554, 0, 0, 8, 1},
+	{42562, 0, 0, 7, 1},
+	{42569, 0, 0, 8, 1},
+	{42577, 0, 0, 7, 1},
+	{42584, 0, 0, 9, 1},
+	{42593, 0, 0, 6, 1},
+	{42599, 0, 0, 6, 1},
+	{26680, 0, 0, 4, 1},
+	{42605, 0, 0, 5, 1},
+	{42610, 0, 0, 12, 1},
+	{19489, 0, 0, 7, 1},
+	{42622, 0, 0, 7, 1},
+	{42629, 0, 0, 8, 1},
+	{42195, 0, 0, 6, 1},
+	{42637, 0, 0, 4, 1},
+	{42641, 0, 0, 4, 1},
+	{42645, 0, 0, 9, 1},
+	{42654, 0, 0, 6, 1},
+	{37341, 0, 0, 7, 1},
+	{42660, 0, 0, 4, 1},
+	{42664, 0, 0, 6, 1},
+	{42670, 0, 0, 5, 1},
+	{42675, 0, 0, 7, 1},
+	{42682, 0, 0, 6, 1},
+	{42688, 0, 0, 9, 1},
+	{42697, 0, 0, 7, 1},
+	{19640, 0, 0, 7, 1},
+	{42704, 0, 0, 6, 1},
+	{42710, 0, 0, 5, 1},
+	{42715, 0, 0, 8, 1},
+	{19245, 0, 0, 8, 1},
+	{42723, 0, 0, 6, 1},
+	{42729, 0, 0, 5, 1},
+	{42734, 0, 0, 6, 1},
+	{790, 0, 0, 3, 1},
+	{42740, 0, 0, 9, 1},
+	{42749, 0, 0, 14, 1},
+	{42763, 0, 0, 8, 1},
+	{42771, 0, 0, 8, 1},
+	{42779, 0, 0, 11, 1},
+	{42790, 0, 0, 6, 1},
+	{3776, 0, 0, 4, 1},
+	{40636, 0, 0, 4, 1},
+	{42753, 0, 0, 10, 1},
+	{42796, 0, 0, 7, 1},
+	{42803, 0, 0, 5, 1},
+	{40998, 0, 0, 9, 1},
+	{42808, 0, 0, 5, 1},
+	{3946, 0, 0, 7, 1},
+	{19154, 0, 0, 4, 1},
+	{42813, 0, 0, 7, 1},
+	{42820, 0, 0, 8, 1},
+	{42828, 0, 0, 6, 1},
+	{42834, 0, 0, 9, 1},
+	{42843, 0, 0, 10, 1},
+	{42853, 0, 0, 6, 1},
+	{42859, 0, 0, 6, 1},
+	{42865, 0, 0, 5, 1},
+	{42870, 0, 0, 5, 1},
+	{42875, 0, 0, 7, 1},
+	{42882, 0, 0, 8, 1},
+	{42890, 0, 0, 8, 1},
+	{42898, 0, 0, 6, 1},
+	{42904, 0, 0, 5, 1},
+	{42909, 0, 0, 14, 1},
+	{36924, 0, 0, 4, 1},
+	{42744, 0, 0, 5, 1},
+	{42923, 0, 0, 9, 1},
+	{42932, 0, 0, 8, 1},
+	{42940, 0, 0, 6, 1},
+	{42946, 0, 0, 12, 1},
+	{42958, 0, 0, 16, 1},
+	{42974, 0, 0, 15, 1},
+	{42989, 0, 0, 8, 1},
+	{19232, 0, 0, 7, 1},
+	{37424, 0, 0, 5, 1},
+	{37812, 0, 0, 5, 1},
+	{42997, 0, 0, 9, 1},
+	{43006, 0, 0, 9, 1},
+	{36820, 0, 0, 6, 1},
+	{43015, 0, 0, 7, 1},
+	{43022, 0, 0, 5, 1},
+	{43027, 0, 0, 9, 1},
+	{43036, 0, 0, 6, 1},
+	{43042, 0, 0, 13, 1},
+	{43055, 0, 0, 9, 1},
+	{10135, 0, 0, 4, 1},
+	{43064, 0, 0, 8, 1},
+	{43072, 0, 0, 9, 1},
+	{43081, 0, 0, 6, 1},
+	{43087, 0, 0, 5, 1},
+	{42599, 0, 0, 6, 1},
+	{43092, 0, 0, 9, 1},
+	{43101, 0, 0, 8, 1},
+	{36426, 0, 0, 5, 1},
+	{34717, 0, 0, 4, 1},
+	{43109, 0, 0, 11, 1},
+	{37461, 0, 0, 5, 1},
+	{37559, 0, 0, 6, 1},
+	{43120, 0, 0, 6, 1},
+	{43126, 0, 0, 6, 1},
+	{43132, 0, 0, 11, 1},
+	{43143, 0, 0, 9, 1},
+	{43152, 0, 0, 5, 1},
+	{43157, 0, 0, 7, 1},
+	{38062, 0, 0, 6, 1},
+	{43164, 0, 0, 6, 1},
+	{43170, 0, 0, 8, 1},
+	{43178, 0, 0, 9, 1},
+	{43187, 0, 0, 12, 1},
+	{43199, 0, 0, 8, 1},
+	{43207, 0, 0, 6, 1},
+	{16052, 0, 0, 3, 1},
+	{43213, 0, 0, 6, 1},
+	{37115, 0, 0, 5, 1},
+	{43219, 0, 0, 8, 1},
+	{38639, 0, 0, 6, 1},
+	{43227, 0, 0, 8, 1},
+	{37412, 0, 0, 5, 1},
+	{43235, 0, 0, 5, 1},
+	{43240, 0, 0, 8, 1},
+	{43248, 0, 0, 7, 1},
+	{43255, 0, 0, 7, 1},
+	{39952, 0, 0, 7, 1},
+	{38214, 0, 0, 8, 1},
+	{43262, 0, 0, 8, 1},
+	{38094, 0, 0, 6, 1},
+	{43270, 0, 0, 7, 1},
+	{43277, 0, 0, 7, 1},
+	{43284, 0, 0, 10, 1},
+	{3066, 0, 0, 3, 1},
+	{41821, 0, 0, 6, 1},
+	{37386, 0, 0, 5, 1},
+	{19600, 0, 0, 4, 1},
+	{37172, 0, 0, 9, 1},
+	{38382, 0, 0, 4, 1},
+	{17553, 0, 0, 4, 1},
+	{38250, 0, 0, 4, 1},
+	{43294, 0, 0, 11, 1},
+	{43305, 0, 0, 7, 1},
+	{37834, 0, 0, 5, 1},
+	{43312, 0, 0, 8, 1},
+	{41654, 0, 0, 6, 1},
+	{43320, 0, 0, 8, 1},
+	{43328, 0, 0, 6, 1},
+	{43334, 0, 0, 5, 1},
+	{43339, 0, 0, 5, 1},
+	{43344, 0, 0, 6, 1},
+	{43350, 0, 0, 8, 1},
+	{43358, 0, 0, 8, 1},
+	{38909, 0, 0, 6, 1},
+	{43366, 0, 0, 15, 1},
+	{43381, 0, 0, 16, 1},
+	{36629, 0, 0, 5, 1},
+	{202, 0, 0, 3, 1},
+	{43397, 0, 0, 5, 1},
+	{43402, 0, 0, 8, 1},
+	{43410, 0, 0, 9, 1},
+	{39017, 0, 0, 8, 1},
+	{43419, 0, 0, 8, 1},
+	{43427, 0, 0, 8, 1},
+	{41201, 0, 0, 7, 1},
+	{43435, 0, 0, 9, 1},
+	{43444, 0, 0, 8, 1},
+	{43452, 0, 0, 4, 1},
+	{43456, 0, 0, 8, 1},
+	{43464, 0, 0, 9, 1},
+	{43473, 0, 0, 7, 1},
+	{43480, 0, 0, 4, 1},
+	{43484, 0, 0, 8, 1},
+	{43492, 0, 0, 10, 1},
+	{43502, 0, 0, 6, 1},
+	{36690, 0, 0, 6, 1},
+	{43508, 0, 0, 9, 1},
+	{36419, 0, 0, 7, 1},
+	{43517, 0, 0, 8, 1},
+	{43525, 0, 0, 8, 1},
+	{43533, 0, 0, 8, 1},
+	{43541, 0, 0, 5, 1},
+	{43546, 0, 0, 5, 1},
+	{36990, 0, 0, 5, 1},
+	{43551, 0, 0, 5, 1},
+	{43556, 0, 0, 7, 1},
+	{36341, 0, 0, 5, 1},
+	{37146, 0, 0, 5, 1},
+	{43563, 0, 0, 6, 1},
+	{43569, 0, 0, 7, 1},
+	{19604, 0, 0, 7, 1},
+	{43576, 0, 0, 6, 1},
+	{43582, 0, 0, 5, 1},
+	{37559, 0, 0, 6, 1},
+	{36362, 0, 0, 5, 1},
+	{43587, 0, 0, 8, 1},
+	{39950, 0, 0, 4, 1},
+	{43595, 0, 0, 6, 1},
+	{5293, 0, 0, 4, 1},
+	{43601, 0, 0, 8, 1},
+	{43609, 0, 0, 10, 1},
+	{43619, 0, 0, 12, 1},
+	{43631, 0, 0, 5, 1},
+	{43636, 0, 0, 6, 1},
+	{43642, 0, 0, 6, 1},
+	{43648, 0, 0, 6, 1},
+	{38540, 0, 0, 4, 1},
+	{43654, 0, 0, 5, 1},
+	{43659, 0, 0, 7, 1},
+	{43666, 0, 0, 9, 1},
+	{43675, 0, 0, 7, 1},
+	{1171, 0, 0, 4, 4},
+	{1171, 0, 0, 4, 4},
+	{43682, 0, 0, 5, 1},
+	{9449, 0, 0, 4, 1},
+	{43687, 0, 0, 10, 1},
+	{43697, 0, 0, 6, 1},
+	{43703, 0, 0, 4, 1},
+	{36404, 0, 0, 5, 1},
+	{43707, 0, 0, 5, 1},
+	{36879, 0, 0, 4, 1},
+	{38412, 0, 0, 7, 1},
+	{43712, 0, 0, 7, 1},
+	{43719, 0, 0, 8, 1},
+	{43727, 0, 0, 8, 1},
+	{43735, 0, 0, 9, 1},
+	{43744, 0, 0, 8, 1},
+	{43752, 0, 0, 11, 1},
+	{4034, 0, 0, 4, 1},
+	{43763, 0, 0, 5, 1},
+	{43768, 0, 0, 5, 1},
+	{43773, 0, 0, 9, 1},
+	{43178, 0, 0, 9, 1},
+	{43782, 0, 0, 8, 1},
+	{43790, 0, 0, 8, 1},
+	{12747, 0, 0, 4, 1},
+	{41893, 0, 0, 5, 1},
+	{231, 0, 0, 3, 1},
+	{43798, 0, 0, 5, 1},
+	{43803, 0, 0, 6, 1},
+	{43809, 0, 0, 12, 1},
+	{19247, 0, 0, 6, 1},
+	{40963, 0, 0, 6, 1},
+	{42290, 0, 0, 5, 1},
+	{43821, 0, 0, 8, 1},
+	{43829, 0, 0, 6, 1},
+	{43835, 0, 0, 6, 1},
+	{36690, 0, 0, 6, 1},
+	{43841, 0, 0, 12, 1},
+	{43853, 0, 0, 4, 1},
+	{43857, 0, 0, 10, 1},
+	{43867, 0, 0, 8, 1},
+	{19644, 0, 0, 7, 1},
+	{43875, 0, 0, 6, 1},
+	{43881, 0, 0, 7, 1},
+	{43888, 0, 0, 5, 1},
+	{39658, 0, 0, 6, 1},
+	{43893, 0, 0, 6, 1},
+	{43899, 0, 0, 7, 1},
+	{19576, 0, 0, 4, 1},
+	{38219, 0, 0, 5, 1},
+	{2250, 0, 0, 4, 1},
+	{43906, 0, 0, 7, 1},
+	{43913, 0, 0, 8, 1},
+	{43921, 0, 0, 10, 1},
+	{43931, 0, 0, 7, 1},
+	{43938, 0, 0, 7, 1},
+	{43945, 0, 0, 7, 1},
+	{43952, 0, 0, 9, 1},
+	{43809, 0, 0, 10, 1},
+	{15576, 0, 0, 3, 1},
+	{43961, 0, 0, 5, 1},
+	{19653, 0, 0, 3, 1},
+	{43966, 0, 0, 9, 1},
+	{43975, 0, 0, 8, 1},
+	{43983, 0, 0, 7, 1},
+	{43990, 0, 0, 9, 1},
+	{43999, 0, 0, 6, 1},
+	{44005, 0, 0, 8, 1},
+	{44013, 0, 0, 5, 1},
+	{44018, 0, 0, 10, 1},
+	{44028, 0, 0, 9, 1},
+	{44037, 0, 0, 9, 1},
+	{37980, 0, 0, 7, 1},
+	{44046, 0, 0, 9, 1},
+	{44055, 0, 0, 8, 1},
+	{44063, 0, 0, 6, 1},
+	{44069, 0, 0, 8, 1},
+	{44077, 0, 0, 7, 1},
+	{39115, 0, 0, 7, 1},
+	{40019, 0, 0, 7, 1},
+	{19651, 0, 0, 8, 1},
+	{44084, 0, 0, 6, 1},
+	{44090, 0, 0, 5, 1},
+	{43659, 0, 0, 7, 1},
+	{40403, 0, 0, 8, 1},
+	{5318, 0, 0, 4, 1},
+	{44095, 0, 0, 4, 1},
+	{44099, 0, 0, 7, 1},
+	{44106, 0, 0, 7, 1},
+	{44113, 0, 0, 10, 1},
+	{44123, 0, 0, 6, 1},
+	{44129, 0, 0, 10, 1},
+	{44139, 0, 0, 7, 1},
+	{44146, 0, 0, 7, 1},
+	{44153, 0, 0, 4, 1},
+	{39462, 0, 0, 4, 1},
+	{44157, 0, 0, 6, 1},
+	{44163, 0, 0, 4, 1},
+	{44167, 0, 0, 12, 1},
+	{44179, 0, 0, 5, 1},
+	{44184, 0, 0, 9, 1},
+	{44193, 0, 0, 4, 1},
+	{40423, 0, 0, 5, 1},
+	{44197, 0, 0, 8, 1},
+	{7785, 0, 0, 5, 1},
+	{4608, 0, 0, 6, 1},
+	{4656, 0, 0, 4, 1},
+	{44205, 0, 0, 10, 1},
+	{44215, 0, 0, 6, 1},
+	{44221, 0, 0, 10, 1},
+	{19701, 0, 0, 7, 1},
+	{36887, 0, 0, 5, 1},
+	{44231, 0, 0, 5, 1},
+	{44236, 0, 0, 10, 1},
+	{44246, 0, 0, 5, 1},
+	{37811, 0, 0, 6, 1},
+	{491, 0, 0, 4, 1},
+	{37250, 0, 0, 6, 1},
+	{19471, 0, 0, 5, 1},
+	{44251, 0, 0, 6, 1},
+	{44257, 0, 0, 12, 1},
+	{44269, 0, 0, 10, 1},
+	{27622, 0, 0, 4, 1},
+	{37064, 0, 0, 6, 1},
+	{36419, 0, 0, 7, 1},
+	{44279, 0, 0, 4, 1},
+	{37651, 0, 0, 8, 1},
+	{44283, 0, 0, 6, 1},
+	{44289, 0, 0, 9, 1},
+	{44298, 0, 0, 9, 1},
+	{19708, 0, 0, 9, 1},
+	{44307, 0, 0, 6, 1},
+	{44313, 0, 0, 6, 1},
+	{44319, 0, 0, 7, 1},
+	{44074, 0, 0, 8, 1},
+	{44326, 0, 0, 9, 1},
+	{43305, 0, 0, 7, 1},
+	{44335, 0, 0, 6, 1},
+	{38345, 0, 0, 7, 1},
+	{44341, 0, 0, 5, 1},
+	{36924, 0, 0, 4, 1},
+	{44346, 0, 0, 7, 1},
+	{38585, 0, 0, 5, 1},
+	{44353, 0, 0, 5, 1},
+	{44358, 0, 0, 7, 1},
+	{44365, 0, 0, 8, 1},
+	{44373, 0, 0, 6, 1},
+	{44379, 0, 0, 13, 1},
+	{44392, 0, 0, 15, 1},
+	{44407, 0, 0, 13, 1},
+	{19479, 0, 0, 4, 1},
+	{44420, 0, 0, 6, 1},
+	{44426, 0, 0, 8, 1},
+	{41798, 0, 0, 5, 1},
+	{44434, 0, 0, 8, 1},
+	{44442, 0, 0, 10, 1},
+	{10135, 0, 0, 4, 1},
+	{44452, 0, 0, 6, 1},
+	{44458, 0, 0, 7, 1},
+	{44465, 0, 0, 7, 1},
+	{44472, 0, 0, 9, 1},
+	{44481, 0, 0, 5, 1},
+	{36879, 0, 0, 4, 1},
+	{44486, 0, 0, 10, 1},
+	{44496, 0, 0, 9, 1},
+	{44505, 0, 0, 7, 1},
+	{44512, 0, 0, 6, 1},
+	{43081, 0, 0, 6, 1},
+	{38296, 0, 0, 6, 1},
+	{44518, 0, 0, 6, 1},
+	{44524, 0, 0, 15, 1},
+	{44539, 0, 0, 9, 1},
+	{38450, 0, 0, 6, 1},
+	{44548, 0, 0, 6, 1},
+	{44554, 0, 0, 9, 1},
+	{44563, 0, 0, 7, 1},
+	{181, 0, 0, 3, 1},
+	{19203, 0, 0, 6, 1},
+	{5143, 0, 0, 3, 1},
+	{44570, 0, 0, 8, 1},
+	{44578, 0, 0, 7, 1},
+	{44585, 0, 0, 9, 1},
+	{44594, 0, 0, 8, 1},
+	{44602, 0, 0, 8, 1},
+	{44610, 0, 0, 6, 1},
+	{44616, 0, 0, 9, 1},
+	{44625, 0, 0, 5, 1},
+	{9546, 0, 0, 4, 1},
+	{44630, 0, 0, 7, 1},
+	{41792, 0, 0, 5, 1},
+	{19479, 0, 0, 4, 1},
+	{44637, 0, 0, 8, 1},
+	{26338, 0, 0, 4, 1},
+	{44645, 0, 0, 7, 1},
+	{44652, 0, 0, 6, 1},
+	{44658, 0, 0, 5, 1},
+	{41559, 0, 0, 8, 1},
+	{44663, 0, 0, 11, 1},
+	{19725, 0, 0, 7, 1},
+	{37473, 0, 0, 6, 1},
+	{41119, 0, 0, 4, 1},
+	{44674, 0, 0, 6, 1},
+	{36462, 0, 0, 5, 1},
+	{38585, 0, 0, 5, 1},
+	{44680, 0, 0, 9, 1},
+	{44689, 0, 0, 9, 1},
+	{36805, 0, 0, 4, 1},
+	{39117, 0, 0, 5, 1},
+	{17091, 0, 0, 5, 1},
+	{44698, 0, 0, 6, 1},
+	{44704, 0, 0, 8, 1},
+	{44712, 0, 0, 6, 1},
+	{44718, 0, 0, 11, 1},
+	{44729, 0, 0, 10, 1},
+	{44739, 0, 0, 5, 1},
+	{44744, 0, 0, 6, 1},
+	{44750, 0, 0, 5, 1},
+	{44755, 0, 0, 5, 1},
+	{44760, 0, 0, 7, 1},
+	{37193, 0, 0, 8, 1},
+	{37201, 0, 0, 4, 1},
+	{44767, 0, 0, 6, 1},
+	{19732, 0, 0, 6, 1},
+	{44773, 0, 0, 7, 1},
+	{44780, 0, 0, 4, 1},
+	{37779, 0, 0, 6, 1},
+	{44784, 0, 0, 5, 1},
+	{44789, 0, 0, 9, 1},
+	{44798, 0, 0, 4, 1},
+	{44802, 0, 0, 9, 1},
+	{38909, 0, 0, 6, 1},
+	{44811, 0, 0, 8, 1},
+	{17091, 0, 0, 5, 1},
+	{44819, 0, 0, 5, 1},
+	{44251, 0, 0, 6, 1},
+	{44824, 0, 0, 9, 1},
+	{42114, 0, 0, 9, 1},
+	{44833, 0, 0, 6, 1},
+	{44839, 0, 0, 8, 1},
+	{42083, 0, 0, 8, 1},
+	{25858, 0, 0, 4, 1},
+	{37031, 0, 0, 4, 1},
+	{44847, 0, 0, 8, 1},
+	{44855, 0, 0, 8, 1},
+	{44863, 0, 0, 9, 1},
+	{36413, 0, 0, 6, 1},
+	{36690, 0, 0, 6, 1},
+	{44872, 0, 0, 13, 1},
+	{37702, 0, 0, 6, 1},
+	{44885, 0, 0, 9, 1},
+	{44894, 0, 0, 5, 1},
+	{41081, 0, 0, 6, 1},
+	{19771, 0, 0, 8, 1},
+	{44899, 0, 0, 5, 1},
+	{43278, 0, 0, 4, 1},
+	{36462, 0, 0, 5, 1},
+	{44904, 0, 0, 8, 1},
+	{44912, 0, 0, 9, 1},
+	{42926, 0, 0, 4, 1},
+	{40146, 0, 0, 6, 1},
+	{44921, 0, 0, 10, 1},
+	{37919, 0, 0, 8, 1},
+	{39748, 0, 0, 9, 1},
+	{44931, 0, 0, 10, 1},
+	{38317, 0, 0, 6, 1},
+	{44399, 0, 0, 8, 1},
+	{44941, 0, 0, 5, 1},
+	{44946, 0, 0, 8, 1},
+	{44954, 0, 0, 5, 1},
+	{44959, 0, 0, 9, 1},
+	{44968, 0, 0, 9, 1},
+	{760, 0, 0, 2, 1},
+	{40987, 0, 0, 5, 1},
+	{44977, 0, 0, 6, 1},
+	{44983, 0, 0, 7, 1},
+	{44990, 0, 0, 5, 1},
+	{44995, 0, 0, 6, 1},
+	{45001, 0, 0, 8, 1},
+	{42195, 0, 0, 6, 1},
+	{45009, 0, 0, 9, 1},
+	{37721, 0, 0, 6, 1},
+	{45018, 0, 0, 8, 1},
+	{45026, 0, 0, 5, 1},
+	{45031, 0, 0, 6, 1},
+	{45037, 0, 0, 8, 1},
+	{20310, 0, 0, 8, 1},
+	{45045, 0, 0, 8, 1},
+	{45053, 0, 0, 8, 1},
+	{42431, 0, 0, 4, 1},
+	{42, 0, 0, 3, 1},
+	{40060, 0, 0, 4, 1},
+	{37265, 0, 0, 6, 1},
+	{44342, 0, 0, 4, 1},
+	{45061, 0, 0, 7, 1},
+	{45068, 0, 0, 9, 1},
+	{45077, 0, 0, 5, 1},
+	{43525, 0, 0, 6, 1},
+	{19203, 0, 0, 6, 1},
+	{45082, 0, 0, 11, 1},
+	{45093, 0, 0, 6, 1},
+	{45099, 0, 0, 6, 1},
+	{45105, 0, 0, 8, 1},
+	{5330, 0, 0, 6, 1},
+	{5415, 0, 0, 3, 1},
+	{45113, 0, 0, 3, 1},
+	{36924, 0, 0, 4, 1},
+	{45116, 0, 0, 5, 1},
+	{45121, 0, 0, 7, 1},
+	{43913, 0, 0, 8, 1},
+	{45128, 0, 0, 15, 1},
+	{45143, 0, 0, 11, 1},
+	{45154, 0, 0, 8, 1},
+	{38946, 0, 0, 6, 1},
+	{45162, 0, 0, 14, 1},
+	{15169, 0, 0, 3, 1},
+	{26602, 0, 0, 4, 1},
+	{45176, 0, 0, 5, 1},
+	{45181, 0, 0, 6, 1},
+	{45187, 0, 0, 11, 1},
+	{45198, 0, 0, 6, 1},
+	{45204, 0, 0, 9, 1},
+	{44658, 0, 0, 5, 1},
+	{45213, 0, 0, 8, 1},
+	{45221, 0, 0, 8, 1},
+	{45229, 0, 0, 12, 1},
+	{39810, 0, 0, 6, 1},
+	{40875, 0, 0, 6, 1},
+	{38049, 0, 0, 5, 1},
+	{45241, 0, 0, 8, 1},
+	{36894, 0, 0, 5, 1},
+	{45249, 0, 0, 8, 1},
+	{45257, 0, 0, 10, 1},
+	{20327, 0, 0, 9, 1},
+	{1171, 0, 0, 4, 4},
+	{7871, 0, 0, 8, 1},
+	{45267, 0, 0, 5, 1},
+	{1642, 0, 0, 3, 1},
+	{4877, 0, 0, 5, 1},
+	{45272, 0, 0, 9, 1},
+	{4877, 0, 0, 4, 1},
+	{7871, 0, 0, 8, 1},
+	{45281, 0, 0, 6, 1},
+	{45281, 0, 0, 6, 1},
+	{4273, 9610, 1, 4, 0},
+	{5829, 0, 0, 1, 1},
+	{5843, 0, 0, 1, 1},
+	{45287, 0, 0, 9, 1},
+	{45296, 0, 0, 8, 1},
+	{45304, 0, 0, 7, 1},
+	{45311, 0, 0, 10, 1},
+	{45321, 0, 0, 7, 1},
+	{5, 0, 0, 1, 1},
+	{44, 0, 0, 1, 1},
+	{45328, 0, 0, 7, 1},
+	{45335, 0, 0, 8, 1},
+	{45343, 0, 0, 8, 1},
+	{45351, 0, 0, 8, 1},
+	{45359, 0, 0, 8, 1},
+	{45367, 0, 0, 7, 1},
+	{3517, 0, 0, 3, 1},
+	{4273, 9611, 2, 4, 0},
+	{3241, 9613, 3, 3, 0},
+	{3517, 0, 0, 3, 1},
+	{10740, 9616, 6, 4, 0},
+	{2729, 0, 0, 7, 2},
+	{45374, 0, 0, 7, 2},
+	{9823, 0, 0, 8, 1},
+	{45381, 0, 0, 12, 1},
+	{689, 0, 0, 1, 1},
+	{382, 0, 0, 3, 1},
+	{10239, 0, 0, 4, 1},
+	{10348, 0, 0, 4, 1},
+	{10059, 0, 0, 5, 1},
+	{9823, 0, 0, 8, 1},
+	{9823, 9622, 3, 8, 0},
+	{5028, 0, 0, 7, 1},
+	{5688, 0, 0, 7, 1},
+	{7871, 0, 0, 8, 1},
+	{2507, 0, 0, 2, 1},
+	{2507, 0, 0, 2, 1},
+	{891, 0, 0, 3, 1},
+	{2507, 0, 0, 2, 1},
+	{891, 0, 0, 3, 1},
+	{2507, 0, 0, 2, 1},
+	{434, 0, 0, 2, 1},
+	{27064, 0, 0, 5, 1},
+	{45393, 0, 0, 12, 1},
+	{2507, 0, 0, 2, 1},
+	{2507, 0, 0, 2, 1},
+	{434, 0, 0, 2, 1},
+	{2507, 0, 0, 2, 1},
+	{45405, 0, 0, 5, 1},
+	{28432, 0, 0, 5, 1},
+	{2507, 0, 0, 2, 1},
+	{2507, 0, 0, 2, 1},
+	{18, 0, 0, 2, 1},
+	{45405, 0, 0, 5, 1},
+	{45410, 0, 0, 9, 1},
+	{45419, 0, 0, 12, 1},
+	{2507, 0, 0, 2, 1},
+	{2507, 0, 0, 2, 1},
+	{2507, 0, 0, 2, 1},
+	{2507, 0, 0, 2, 1},
+	{27064, 0, 0, 5, 1},
+	{2507, 0, 0, 2, 1},
+	{2507, 0, 0, 2, 1},
+	{2507, 0, 0, 2, 1},
+	{2507, 0, 0, 2, 1},
+	{18, 0, 0, 2, 1},
+	{45410, 0, 0, 9, 1},
+	{2507, 0, 0, 2, 1},
+	{2507, 0, 0, 2, 1},
+	{2507, 0, 0, 2, 1},
+	{28432, 0, 0, 5, 1},
+	{2507, 0, 0, 2, 1},
+	{28432, 0, 0, 5, 1},
+	{45419, 0, 0, 12, 1},
+	{45393, 0, 0, 12, 1},
+	{7871, 0, 0, 8, 1},
+	{10266, 0, 0, 7, 1},
+	{2741, 0, 0, 4, 1},
+	{30, 0, 0, 1, 1},
+	{998, 0, 0, 3, 1},
+	{4022, 9625, 1, 6, 0},
+	{680, 0, 0, 2, 1},
+	{2675, 0, 0, 4, 1},
+	{174, 0, 0, 2, 1},
+	{380, 0, 0, 4, 1},
+	{212, 0, 0, 2, 1},
+	{405, 0, 0, 2, 1},
+	{605, 0, 0, 2, 1},
+	{651, 0, 0, 2, 1},
+	{30, 0, 0, 2, 1},
+	{1051, 0, 0, 2, 1},
+	{359, 0, 0, 2, 1},
+	{601, 0, 0, 2, 1},
+	{143, 0, 0, 2, 1},
+	{1523, 0, 0, 2, 1},
+	{55, 0, 0, 2, 1},
+	{1707, 0, 0, 2, 1},
+	{1795, 0, 0, 3, 1},
+	{619, 0, 0, 2, 1},
+	{251, 0, 0, 2, 1},
+	{201, 0, 0, 2, 1},
+	{125, 0, 0, 2, 1},
+	{1582, 0, 0, 2, 1},
+	{762, 0, 0, 2, 1},
+	{1131, 0, 0, 2, 1},
+	{26, 0, 0, 2, 1},
+	{265, 0, 0, 2, 1},
+	{202, 0, 0, 2, 1},
+	{1110, 0, 0, 3, 1},
+	{1118, 0, 0, 2, 1},
+	{957, 0, 0, 2, 1},
+	{3012, 0, 0, 2, 1},
+	{2118, 0, 0, 2, 1},
+	{103, 0, 0, 2, 1},
+	{731, 0, 0, 2, 1},
+	{919, 0, 0, 2, 1},
+	{354, 0, 0, 2, 1},
+	{182, 0, 0, 2, 1},
+	{3103, 0, 0, 2, 1},
+	{3747, 0, 0, 2, 1},
+	{57, 0, 0, 2, 1},
+	{2158, 0, 0, 3, 1},
+	{675, 0, 0, 2, 1},
+	{1740, 0, 0, 2, 1},
+	{943, 0, 0, 2, 1},
+	{205, 0, 0, 2, 1},
+	{4056, 0, 0, 5, 1},
+	{333, 0, 0, 2, 1},
+	{4339, 0, 0, 2, 1},
+	{45431, 0, 0, 3, 1},
+	{112, 0, 0, 2, 1},
+	{865, 0, 0, 2, 1},
+	{558, 0, 0, 2, 1},
+	{377, 0, 0, 2, 1},
+	{566, 0, 0, 2, 1},
+	{1337, 0, 0, 2, 1},
+	{3142, 0, 0, 2, 1},
+	{154, 0, 0, 2, 1},
+	{1224, 0, 0, 5, 1},
+	{434, 9626, 1, 2, 0},
+	{9371, 9627, 1, 3, 0},
+	{35619, 0, 0, 2, 1},
+	{318, 0, 0, 2, 1},
+	{45434, 0, 0, 4, 1},
+	{127, 0, 0, 2, 1},
+	{1118, 0, 0, 2, 1},
+	{45438, 0, 0, 5, 1},
+	{45443, 0, 0, 8, 1},
+	{45451, 0, 0, 5, 1},
+	{45456, 0, 0, 3, 1},
+	{45459, 0, 0, 5, 1},
+	{45464, 0, 0, 3, 1},
+	{740, 0, 0, 2, 1},
+	{45467, 0, 0, 4, 1},
+	{39346, 0, 0, 3, 1},
+	{6, 0, 0, 2, 1},
+	{45471, 0, 0, 4, 1},
+	{45475, 0, 0, 3, 1},
+	{433, 0, 0, 2, 1},
+	{4120, 0, 0, 3, 1},
+	{45478, 0, 0, 4, 1},
+	{19562, 0, 0, 3, 1},
+	{45482, 0, 0, 4, 1},
+	{88, 0, 0, 2, 1},
+	{10693, 0, 0, 3, 1},
+	{23968, 0, 0, 3, 1},
+	{382, 0, 0, 2, 1},
+	{4407, 0, 0, 2, 1},
+	{45486, 0, 0, 9, 1},
+	{2512, 0, 0, 2, 1},
+	{45495, 0, 0, 4, 1},
+	{2192, 0, 0, 2, 1},
+	{39962, 0, 0, 4, 1},
+	{45499, 0, 0, 4, 1},
+	{5077, 0, 0, 4, 1},
+	{154, 0, 0, 2, 1},
+	{5648, 0, 0, 2, 1},
+	{23733, 0, 0, 3, 1},
+	{11498, 0, 0, 3, 1},
+	{45503, 0, 0, 4, 1},
+	{45507, 0, 0, 4, 1},
+	{45511, 0, 0, 4, 1},
+	{45515, 0, 0, 4, 1},
+	{45519, 0, 0, 3, 1},
+	{462, 0, 0, 3, 1},
+	{45522, 0, 0, 4, 1},
+	{45526, 0, 0, 4, 1},
+	{45530, 0, 0, 6, 1},
+	{33102, 0, 0, 2, 1},
+	{2794, 0, 0, 3, 1},
+	{4832, 0, 0, 4, 1},
+	{654, 0, 0, 2, 1},
+	{11088, 0, 0, 3, 1},
+	{2729, 0, 0, 7, 2},
+	{45536, 0, 0, 7, 2},
+	{45543, 0, 0, 8, 2},
+	{11088, 0, 0, 3, 2},
+	{9823, 0, 0, 8, 1},
+	{4778, 0, 0, 7, 1},
+	{1348, 0, 0, 2, 1},
+	{29, 0, 0, 2, 1},
+	{62, 0, 0, 3, 1},
+	{1897, 0, 0, 2, 1},
+	{154, 0, 0, 2, 1},
+	{1667, 0, 0, 6, 1},
+	{7871, 0, 0, 8, 1},
+	{2456, 0, 0, 3, 1},
+	{45551, 0, 0, 8, 1},
+	{45559, 0, 0, 5, 1},
+	{8861, 0, 0, 5, 1},
+	{10337, 0, 0, 11, 1},
+	{7871, 0, 0, 8, 1},
+	{45564, 9628, 2, 8, 0},
+	{45572, 9630, 1, 10, 0},
+	{8774, 0, 0, 12, 1},
+	{45582, 0, 0, 7, 1},
+	{8938, 0, 0, 5, 1},
+	{45589, 9631, 1, 9, 0},
+	{14630, 0, 0, 13, 1},
+	{955, 0, 0, 3, 1},
+	{45598, 0, 0, 8, 1},
+	{45606, 0, 0, 10, 1},
+	{4778, 0, 0, 7, 1},
+	{45616, 0, 0, 15, 1},
+	{45631, 0, 0, 4, 1},
+	{32630, 0, 0, 3, 1},
+	{45635, 0, 0, 4, 1},
+	{45639, 0, 0, 11, 1},
+	{45650, 0, 0, 13, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{45663, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 9632, 3, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{45666, 0, 0, 9, 1},
+	{60, 0, 0, 2, 1},
+	{45675, 0, 0, 3, 1},
+	{4410, 0, 0, 3, 1},
+	{45678, 0, 0, 5, 1},
+	{140, 0, 0, 3, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{3755, 0, 0, 3, 1},
+	{4319, 0, 0, 3, 1},
+	{45683, 0, 0, 9, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{60, 0, 0, 2, 1},
+	{60, 0, 0, 2, 1},
+	{14605, 0, 0, 3, 1},
+	{186, 0, 0, 3, 1},
+	{7871, 0, 0, 8, 1},
+	{40, 0, 0, 1, 1},
+	{7871, 0, 0, 8, 1},
+	{3590, 0, 0, 3, 1},
+	{4709, 0, 0, 7, 1},
+	{15664, 9635, 1, 5, 0},
+	{45692, 0, 0, 4, 1},
+	{1899, 9636, 1, 3, 0},
+	{45696, 0, 0, 8, 1},
+	{45704, 0, 0, 8, 1},
+	{45712, 0, 0, 8, 1},
+	{45720, 9637, 1, 3, 1},
+	{35393, 9638, 1, 3, 1},
+	{35619, 0, 0, 2, 1},
+	{35866, 0, 0, 10, 1},
+	{45723, 0, 0, 3, 1},
+	{8794, 0, 0, 4, 1},
+	{498, 0, 0, 3, 1},
+	{35393, 9639, 1, 3, 1},
+	{35619, 0, 0, 2, 1},
+	{35866, 0, 0, 10, 1},
+	{45723, 0, 0, 3, 1},
+	{35393, 9640, 1, 3, 1},
+	{35619, 0, 0, 2, 1},
+	{35866, 0, 0, 10, 1},
+	{45726, 9641, 1, 10, 0},
+	{1313, 0, 0, 7, 2},
+	{473, 9642, 2, 2, 0},
+	{3591, 0, 0, 3, 2},
+	{45736, 9644, 2, 6, 0},
+	{45736, 9646, 2, 6, 0},
+	{45736, 9648, 2, 6, 0},
+	{45742, 9650, 1, 9, 0},
+	{45736, 9651, 2, 6, 0},
+	{45742, 9653, 1, 9, 0},
+	{35619, 0, 0, 2, 1},
+	{35866, 0, 0, 10, 1},
+	{45736, 9654, 2, 6, 0},
+	{45736, 9656, 2, 6, 0},
+	{45742, 9658, 1, 9, 0},
+	{35619, 0, 0, 2, 1},
+	{35866, 0, 0, 10, 1},
+	{45736, 9659, 2, 6, 0},
+	{45742, 9661, 1, 9, 0},
+	{45736, 9662, 2, 6, 0},
+	{45742, 9664, 1, 9, 0},
+	{45736, 9665, 2, 6, 0},
+	{45742, 9667, 1, 9, 0},
+	{35619, 0, 0, 2, 1},
+	{35866, 0, 0, 10, 1},
+	{45736, 9668, 2, 6, 0},
+	{45742, 9670, 1, 9, 0},
+	{35619, 0, 0, 2, 1},
+	{35866, 0, 0, 10, 1},
+	{45736, 9671, 2, 6, 0},
+	{45736, 9673, 2, 6, 0},
+	{45736, 9675, 2, 6, 0},
+	{45742, 9677, 1, 9, 0},
+	{45736, 9678, 2, 6, 0},
+	{45742, 9680, 1, 9, 0},
+	{35619, 0, 0, 2, 1},
+	{35866, 0, 0, 10, 1},
+	{45736, 9681, 2, 6, 0},
+	{45742, 9683, 1, 9, 0},
+	{35619, 0, 0, 2, 1},
+	{35866, 0, 0, 10, 1},
+	{45736, 9684, 2, 6, 0},
+	{45736, 9686, 2, 6, 0},
+	{45742, 9688, 1, 9, 0},
+	{45736, 9689, 2, 6, 0},
+	{45742, 9691, 1, 9, 0},
+	{45736, 9692, 2, 6, 0},
+	{45742, 9694, 1, 9, 0},
+	{35619, 0, 0, 2, 1},
+	{35866, 0, 0, 10, 1},
+	{45736, 9695, 2, 6, 0},
+	{45736, 9697, 2, 6, 0},
+	{689, 0, 0, 1, 1},
+	{45751, 0, 0, 3, 1},
+	{45754, 0, 0, 3, 1},
+	{10059, 0, 0, 5, 1},
+	{10511, 0, 0, 4, 1},
+	{13199, 0, 0, 7, 1},
+	{10511, 0, 0, 4, 1},
+	{13199, 0, 0, 7, 1},
+	{10511, 0, 0, 4, 1},
+	{10511, 0, 0, 4, 1},
+	{13199, 0, 0, 7, 1},
+	{9823, 9699, 1, 8, 0},
+	{10239, 0, 0, 4, 1},
+	{10626, 0, 0, 3, 1},
+	{0, 0, 0, 1, 1},
+	{2381, 0, 0, 6, 1},
+	{0, 0, 0, 1, 1},
+	{8, 0, 0, 1, 1},
+	{2381, 0, 0, 6, 1},
+	{45757, 0, 0, 4, 1},
+	{45761, 0, 0, 5, 1},
+	{45766, 0, 0, 5, 1},
+	{45771, 0, 0, 4, 1},
+	{45775, 0, 0, 4, 1},
+	{45779, 0, 0, 4, 1},
+	{15174, 0, 0, 3, 1},
+	{45783, 0, 0, 3, 1},
+	{126, 0, 0, 3, 1},
+	{3241, 0, 0, 3, 1},
+	{328, 0, 0, 3, 1},
+	{434, 9700, 1, 2, 0},
+	{45, 0, 0, 2, 1},
+	{3739, 0, 0, 2, 1},
+	{689, 0, 0, 1, 1},
+	{10511, 0, 0, 4, 1},
+	{24204, 0, 0, 4, 1},
+	{45786, 0, 0, 6, 1},
+	{14934, 0, 0, 3, 1},
+	{45792, 0, 0, 5, 1},
+	{19872, 0, 0, 3, 1},
+	{24982, 0, 0, 9, 1},
+	{45797, 0, 0, 5, 1},
+	{45797, 0, 0, 5, 1},
+	{45797, 0, 0, 5, 1},
+	{35619, 0, 0, 2, 1},
+	{45726, 0, 0, 10, 1},
+	{45802, 0, 0, 14, 1},
+	{45816, 0, 0, 3, 1},
+	{45819, 0, 0, 14, 1},
+	{45816, 0, 0, 3, 1},
+	{45819, 0, 0, 14, 1},
+	{45816, 0, 0, 3, 1},
+	{45819, 0, 0, 14, 1},
+	{35619, 0, 0, 2, 1},
+	{45816, 0, 0, 3, 1},
+	{45819, 0, 0, 14, 1},
+	{35619, 0, 0, 2, 1},
+	{45816, 0, 0, 3, 1},
+	{45819, 0, 0, 14, 1},
+	{45816, 0, 0, 3, 1},
+	{45819, 0, 0, 14, 1},
+	{35619, 0, 0, 2, 1},
+	{45816, 0, 0, 3, 1},
+	{45819, 0, 0, 14, 1},
+	{35619, 0, 0, 2, 1},
+	{45816, 0, 0, 3, 1},
+	{45819, 0, 0, 14, 1},
+	{35619, 0, 0, 2, 1},
+	{45816, 0, 0, 3, 1},
+	{45819, 0, 0, 14, 1},
+	{35619, 0, 0, 2, 1},
+	{45816, 0, 0, 3, 1},
+	{45819, 0, 0, 14, 1},
+	{35619, 0, 0, 2, 1},
+	{45816, 0, 0, 3, 1},
+	{45819, 0, 0, 14, 1},
+	{45816, 0, 0, 3, 1},
+	{45819, 0, 0, 14, 1},
+	{45816, 0, 0, 3, 1},
+	{45819, 0, 0, 14, 1},
+	{35619, 0, 0, 2, 1},
+	{45816, 0, 0, 3, 1},
+	{45819, 0, 0, 14, 1},
+	{35619, 0, 0, 2, 1},
+	{45816, 0, 0, 3, 1},
+	{45819, 0, 0, 14, 1},
+	{35619, 0, 0, 2, 1},
+	{45816, 0, 0, 3, 1},
+	{45819, 0, 0, 14, 1},
+	{45816, 0, 0, 3, 1},
+	{45819, 0, 0, 14, 1},
+	{35619, 0, 0, 2, 1},
+	{45816, 0, 0, 3, 1},
+	{45819, 0, 0, 14, 1},
+	{35619, 0, 0, 2, 1},
+	{45816, 0, 0, 3, 1},
+	{45819, 0, 0, 14, 1},
+	{35619, 0, 0, 2, 1},
+	{45816, 0, 0, 3, 1},
+	{45819, 0, 0, 14, 1},
+	{45816, 0, 0, 3, 1},
+	{45819, 0, 0, 14, 1},
+	{1224, 0, 0, 5, 1},
+	{328, 0, 0, 3, 1},
+};
@@ -0,0 +1,131 @@
+"""
+Compiles the Public Suffix List into the trie used by resolve.c.
+
+Usage: python3 psl.py public_suffix_list.dat > psl.h
+"""
+
+import sys
+from encodings import idna
+
+
+FLAG_RULE = 1
+FLAG_WILDCARD = 2
+FLAG_EXCEPTION = 4
+
+MAX_NODES = 0x10000
+MAX_LABEL_LENGTH = 0xff
+
+
+class Node:
+	def __init__(self):
+		self.children = {}
+		self.flags = 0
+
+	def child(self, label):
+		return self.children.setdefault(label, Node())
+
+
+def to_ascii(label: str) -> bytes:
+	return idna.ToASCII(label).lower() if not label.isascii() else label.lower().encode('ascii')
+
+
+def read_rules(lines):
+	for line in lines:
+		rule = line.strip()
+
+		if not rule or rule.startswith('//'):
+			continue
+
+		yield rule.split()[0]
+
+
+def build_trie(rules) -> Node:
+	root = Node()
+
+	for rule in rules:
+		flag = FLAG_RULE
+
+		if rule.startswith('!'):
+			rule = rule[1:]
+			flag = FLAG_EXCEPTION
+
+		labels = rule.split('.')
+		labels.reverse()
+
+		if labels[-1] == '*':
+			labels.pop()
+			flag = FLAG_WILDCARD
+
+		if '*' in labels:
+			raise ValueError(f'unsupported wildcard position in rule {rule!r}')
+
+		node = root
+
+		for label in labels:
+			node = node.child(to_ascii(label))
+
+		node.flags |= flag
+
+	return root
+
+
+def flatten(root: Node):
+	"""
+	Lays the trie out breadth-first, so each node's children are contiguous and sorted for binary search.
+	"""
+	nodes = [(b'', root)]
+	entries = []
+	i = 0
+
+	while i < len(nodes):
+		label, node = nodes[i]
+		children = sorted(node.children.items())
+		entries.append((label, node.flags, len(nodes) if children else 0, len(children)))
+		nodes.extend(children)
+		i += 1
+
+	if len(nodes) > MAX_NODES:
+		raise ValueError(f'too many nodes: {len(nodes)}')
+
+	return entries
+
+
+def main():
+	with open(sys.argv[1], encoding='utf-8') as f:
+		entries = flatten(build_trie(read_rules(f)))
+
+	labels = bytearray()
+	offsets = {}
+
+	for label, _, _, _ in entries:
+		if len(label) > MAX_LABEL_LENGTH:
+			raise ValueError(f'label too long: {label!r}')
+
+		if label not in offsets:
+			offset = labels.find(label)
+
+			if offset == -1:
+				offset = len(labels)
+				labels += label
+
+			offsets[label] = offset
+
+	out = sys.stdout
+	out.write('/* Generated by psl.py from the Public Suffix List (https://publicsuffix.org/); do not edit. */\n\n')
+	out.write(f'#define PSL_NODE_COUNT {len(entries)}\n\n')
+	out.write('static char const psl_labels[] = {\n')
+
+	for i in range(0, len(labels), 16):
+		out.write('\t' + ' '.join(f"'{chr(c)}'," if chr(c) not in "'\\" else f"'\\{chr(c)}'," for c in labels[i:i + 16]) + '\n')
+
+	out.write('};\n\n')
+	out.write('static struct psl_node const psl_nodes[PSL_NODE_COUNT] = {\n')
+
+	for label, flags, children, child_count in entries:
+		out.write(f'\t{{{offsets[label]}, {children}, {child_count}, {len(label)}, {flags}}},\n')
+
+	out.write('};\n')
+
+
+if __name__ == '__main__':
+	main()
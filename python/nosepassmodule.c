@@ -0,0 +1,256 @@
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#include <limits.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "bcrypt/explicit_bzero.h"
+#include "nosepass.h"
+
+/*
+ * One derivation, with everything it needs copied out of Python objects so it can run without the GIL.
+ */
+struct job {
+	struct nosepass_schema schema;
+	char const* site_name;
+	Py_ssize_t site_name_length;
+	enum nosepass_status status;
+	char password[NOSEPASS_MAX_COUNT];
+};
+
+/*
+ * Fills in a job’s schema from the arguments of get_password, or sets an exception. `group` is NULL for none.
+ */
+__attribute__ ((nonnull (1, 3, 6), warn_unused_result))
+static int prepare_job(struct job* const job, Py_ssize_t const kdf_rounds, char const* const character_set, Py_ssize_t const character_set_length, Py_ssize_t const length, PyObject* const increment, char const* const group, Py_ssize_t const group_length, Py_ssize_t const lanes) {
+	nosepass_schema_init(&job->schema);
+
+	if (kdf_rounds < 1 || (size_t)kdf_rounds > UINT_MAX) {
+		PyErr_SetString(PyExc_ValueError, nosepass_strerror(kdf_rounds < 1 ? NOSEPASS_ROUNDS_ZERO : NOSEPASS_ROUNDS_TOO_LARGE));
+		return 0;
+	}
+
+	if (length < 1 || length > NOSEPASS_MAX_COUNT) {
+		PyErr_SetString(PyExc_ValueError, nosepass_strerror(length < 1 ? NOSEPASS_COUNT_ZERO : NOSEPASS_COUNT_TOO_LARGE));
+		return 0;
+	}
+
+	if (group != NULL && (group_length < 1 || group_length > NOSEPASS_MAX_GROUP_LENGTH)) {
+		PyErr_SetString(PyExc_ValueError, nosepass_strerror(group_length < 1 ? NOSEPASS_INVALID_GROUP : NOSEPASS_GROUP_TOO_LONG));
+		return 0;
+	}
+
+	if (lanes < 1 || lanes > NOSEPASS_MAX_LANES) {
+		PyErr_SetString(PyExc_ValueError, nosepass_strerror(lanes < 1 ? NOSEPASS_INVALID_LANES : NOSEPASS_LANES_TOO_LARGE));
+		return 0;
+	}
+
+	unsigned long long const increment_value = PyLong_AsUnsignedLongLong(increment);
+
+	if (increment_value == (unsigned long long)-1 && PyErr_Occurred()) {
+		return 0;
+	}
+
+	enum nosepass_status const status = nosepass_set_characters(&job->schema, character_set, (size_t)character_set_length);
+
+	if (status != NOSEPASS_OK) {
+		PyErr_SetString(PyExc_ValueError, nosepass_strerror(status));
+		return 0;
+	}
+
+	job->schema.rounds = (unsigned int)kdf_rounds;
+	job->schema.count = (unsigned int)length;
+	job->schema.increment = (uint64_t)increment_value;
+	job->schema.lanes = (uint8_t)lanes;
+
+	if (group != NULL) {
+		job->schema.group_length = (uint8_t)group_length;
+		memcpy(job->schema.group, group, (size_t)group_length);
+	}
+
+	return 1;
+}
+
+/*
+ * Runs a job; called without the GIL.
+ */
+__attribute__ ((nonnull))
+static void run_job(struct job* const job, char const* const master_password, Py_ssize_t const master_password_length) {
+	uint8_t key[NOSEPASS_KEY_SIZE];
+
+	job->status = nosepass_derive_site_key(master_password, (size_t)master_password_length, job->site_name, (size_t)job->site_name_length, &job->schema, key);
+
+	if (job->status == NOSEPASS_OK) {
+		job->status = nosepass_generate(key, &job->schema, job->password, sizeof job->password);
+	}
+
+	explicit_bzero(key, sizeof key);
+}
+
+__attribute__ ((nonnull, warn_unused_result))
+static PyObject* finish_job(struct job* const job) {
+	PyObject* result = NULL;
+
+	if (job->status == NOSEPASS_OK) {
+		result = PyBytes_FromStringAndSize(job->password, job->schema.count);
+	} else {
+		PyErr_SetString(job->status == NOSEPASS_KDF_FAILED ? PyExc_RuntimeError : PyExc_ValueError, nosepass_strerror(job->status));
+	}
+
+	explicit_bzero(job->password, sizeof job->password);
+	return result;
+}
+
+PyDoc_STRVAR(get_password_doc,
+"get_password(kdf_rounds, character_set, length, increment, site_name, master_password, group=None, lanes=1) -> bytes\n"
+"\n"
+"Derives a site's password, like get_password in reference.py. character_set is a str or bytes of distinct\n"
+"printable ASCII characters, used in the given order; site_name and master_password are str (encoded as UTF-8)\n"
+"or bytes. group, if not None, is the str or bytes name of the group whose key the site's key is expanded from, of\n"
+"1 to 64 bytes; lanes is the number of bcrypt_pbkdf chains the key is combined from, 1 to 16, which run one after\n"
+"another. The GIL is released during the derivation.");
+
+static PyObject* get_password(PyObject* const self, PyObject* const args, PyObject* const kwargs) {
+	(void)self;
+
+	static char* keywords[] = {"kdf_rounds", "character_set", "length", "increment", "site_name", "master_password", "group", "lanes", NULL};
+	Py_ssize_t kdf_rounds;
+	char const* character_set;
+	Py_ssize_t character_set_length;
+	Py_ssize_t length;
+	PyObject* increment;
+	char const* master_password;
+	Py_ssize_t master_password_length;
+	char const* group = NULL;
+	Py_ssize_t group_length = 0;
+	Py_ssize_t lanes = 1;
+	struct job job;
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "ns#nOs#s#|z#n:get_password", keywords, &kdf_rounds, &character_set, &character_set_length, &length, &increment, &job.site_name, &job.site_name_length, &master_password, &master_password_length, &group, &group_length, &lanes)) {
+		return NULL;
+	}
+
+	if (!prepare_job(&job, kdf_rounds, character_set, character_set_length, length, increment, group, group_length, lanes)) {
+		return NULL;
+	}
+
+	Py_BEGIN_ALLOW_THREADS
+	run_job(&job, master_password, master_password_length);
+	Py_END_ALLOW_THREADS
+
+	return finish_job(&job);
+}
+
+PyDoc_STRVAR(get_passwords_doc,
+"get_passwords(master_password, requests) -> list[bytes]\n"
+"\n"
+"Derives the passwords for a sequence of (kdf_rounds, character_set, length, increment, site_name[, group[,\n"
+"lanes]]) tuples, taking the arguments of get_password, with one master password. The GIL is released for the\n"
+"whole batch, so batches submitted from several threads run in parallel.");
+
+static PyObject* get_passwords(PyObject* const self, PyObject* const args, PyObject* const kwargs) {
+	(void)self;
+
+	static char* keywords[] = {"master_password", "requests", NULL};
+	char const* master_password;
+	Py_ssize_t master_password_length;
+	PyObject* requests;
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "s#O:get_passwords", keywords, &master_password, &master_password_length, &requests)) {
+		return NULL;
+	}
+
+	/*
+	 * a snapshot of the requests that this call owns: the caller’s own list could be changed by another thread while
+	 * the GIL is released, freeing the strings the jobs point into, but neither this tuple nor the request tuples in it
+	 * can be
+	 */
+	PyObject* const request_list = PySequence_Tuple(requests);
+
+	if (request_list == NULL) {
+		return NULL;
+	}
+
+	Py_ssize_t const job_count = PyTuple_GET_SIZE(request_list);
+	struct job* const jobs = PyMem_Calloc(job_count > 0 ? (size_t)job_count : 1, sizeof *jobs);
+	PyObject* result = NULL;
+
+	if (jobs == NULL) {
+		PyErr_NoMemory();
+		Py_DECREF(request_list);
+		return NULL;
+	}
+
+	for (Py_ssize_t i = 0; i < job_count; i++) {
+		PyObject* const request = PyTuple_GET_ITEM(request_list, i);
+		Py_ssize_t kdf_rounds;
+		char const* character_set;
+		Py_ssize_t character_set_length;
+		Py_ssize_t length;
+		PyObject* increment;
+		char const* group = NULL;
+		Py_ssize_t group_length = 0;
+		Py_ssize_t lanes = 1;
+
+		if (!PyTuple_Check(request)) {
+			PyErr_Format(PyExc_TypeError, "request %zd must be a tuple", i);
+			goto done;
+		}
+
+		if (!PyArg_ParseTuple(request, "ns#nOs#|z#n:get_passwords", &kdf_rounds, &character_set, &character_set_length, &length, &increment, &jobs[i].site_name, &jobs[i].site_name_length, &group, &group_length, &lanes)) {
+			goto done;
+		}
+
+		if (!prepare_job(&jobs[i], kdf_rounds, character_set, character_set_length, length, increment, group, group_length, lanes)) {
+			goto done;
+		}
+	}
+
+	Py_BEGIN_ALLOW_THREADS
+
+	for (Py_ssize_t i = 0; i < job_count; i++) {
+		run_job(&jobs[i], master_password, master_password_length);
+	}
+
+	Py_END_ALLOW_THREADS
+
+	if ((result = PyList_New(job_count)) == NULL) {
+		goto done;
+	}
+
+	for (Py_ssize_t i = 0; i < job_count; i++) {
+		PyObject* const password = finish_job(&jobs[i]);
+
+		if (password == NULL) {
+			Py_CLEAR(result);
+			goto done;
+		}
+
+		PyList_SET_ITEM(result, i, password);
+	}
+
+done:
+	explicit_bzero(jobs, (size_t)(job_count > 0 ? job_count : 1) * sizeof *jobs);
+	PyMem_Free(jobs);
+	Py_DECREF(request_list);
+	return result;
+}
+
+static PyMethodDef methods[] = {
+	{"get_password", (PyCFunction)(void(*)(void))get_password, METH_VARARGS | METH_KEYWORDS, get_password_doc},
+	{"get_passwords", (PyCFunction)(void(*)(void))get_passwords, METH_VARARGS | METH_KEYWORDS, get_passwords_doc},
+	{NULL, NULL, 0, NULL},
+};
+
+static struct PyModuleDef module = {
+	PyModuleDef_HEAD_INIT,
+	.m_name = "nosepass",
+	.m_doc = "Native nosepass password derivation.",
+	.m_size = -1,
+	.m_methods = methods,
+};
+
+PyMODINIT_FUNC PyInit_nosepass(void) {
+	return PyModule_Create(&module);
+}
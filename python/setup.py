@@ -0,0 +1,26 @@
+"""
+Builds the nosepass extension module against libnosepass.a; run `make python` from the repository root.
+"""
+
+from pathlib import Path
+
+from setuptools import Extension, setup
+
+
+root = Path(__file__).resolve().parent.parent
+
+setup(
+	name='nosepass',
+	version='1.0.0',
+	description='Native nosepass password derivation',
+	ext_modules=[
+		Extension(
+			'nosepass',
+			sources=['nosepassmodule.c'],
+			include_dirs=[str(root)],
+			extra_compile_args=['-std=c11'],
+			extra_objects=[str(root / 'libnosepass.a')],
+			libraries=['m'],
+		),
+	],
+)
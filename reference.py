@@ -1,5 +1,7 @@
+import hashlib
+import hmac
 import itertools
-from typing import Iterator, Sequence
+from typing import Iterator, Optional, Sequence
 
 import bcrypt
 from cryptography.hazmat.primitives.ciphers import Cipher, algorithms
@@ -23,12 +25,24 @@ def get_stream(key: bytes, nonce: bytes) -> Iterator[int]:
 		yield from encryptor.update(_EMPTY_BLOCK)
 
 
-def get_password(kdf_rounds: int, character_set: Sequence[str], length: int, increment: int, site_name: str, master_password: str) -> str:
+def get_key(master_password: bytes, salt: bytes, kdf_rounds: int, lanes: int) -> bytes:
+	if lanes == 1:
+		return bcrypt.kdf(master_password, salt, 32, kdf_rounds)
+
+	lane_keys = (bcrypt.kdf(master_password, hashlib.sha512(b'nosepass lane\0' + bytes([lanes, lane]) + salt).digest(), 32, kdf_rounds) for lane in range(lanes))
+	return hashlib.sha512(b'nosepass lanes\0' + bytes([lanes]) + b''.join(lane_keys)).digest()[:32]
+
+
+def get_password(kdf_rounds: int, character_set: Sequence[str], length: int, increment: int, site_name: str, master_password: str, group: Optional[str] = None, lanes: int = 1) -> str:
 	set_size = len(character_set)
 	mask = get_mask(set_size)
 	nonce = increment.to_bytes(8, 'little')
 
-	key = bcrypt.kdf(master_password.encode('utf-8'), site_name.encode('utf-8'), 32, kdf_rounds)
+	if group is None:
+		key = get_key(master_password.encode('utf-8'), site_name.encode('utf-8'), kdf_rounds, lanes)
+	else:
+		group_key = get_key(master_password.encode('utf-8'), b'nosepass group\0' + group.encode('utf-8'), kdf_rounds, lanes)
+		key = hmac.new(group_key, site_name.encode('utf-8'), hashlib.sha512).digest()[:32]
 
 	byte_stream = get_stream(key, nonce)
 	character_stream = (character_set[b & mask] for b in byte_stream if b & mask < set_size)
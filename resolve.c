@@ -0,0 +1,249 @@
+#include <stdint.h>
+#include <string.h>
+
+#include "resolve.h"
+
+#define PSL_RULE 1
+#define PSL_WILDCARD 2
+#define PSL_EXCEPTION 4
+
+/*
+ * A node in the public suffix trie, keyed by labels from right to left. The children of each node are contiguous
+ * and sorted bytewise, so they can be binary searched.
+ */
+struct psl_node {
+	uint32_t label;
+	uint16_t children;
+	uint16_t child_count;
+	uint8_t label_length;
+	uint8_t flags;
+};
+
+#include "psl.h"
+
+_Static_assert(PSL_NODE_COUNT <= UINT16_MAX + 1, "trie nodes are addressable");
+
+__attribute__ ((const, warn_unused_result))
+static char to_lower(char const c) {
+	return c >= 'A' && c <= 'Z' ? (char)(c - 'A' + 'a') : c;
+}
+
+__attribute__ ((const, warn_unused_result))
+static int is_host_character(char const c) {
+	return (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9') || c == '-' || c == '_';
+}
+
+__attribute__ ((nonnull, pure, warn_unused_result))
+static char const* skip_scheme(char const* const url) {
+	char const* p = url;
+
+	if (!((*p >= 'a' && *p <= 'z') || (*p >= 'A' && *p <= 'Z'))) {
+		return url;
+	}
+
+	do {
+		p++;
+	} while ((*p >= 'a' && *p <= 'z') || (*p >= 'A' && *p <= 'Z') || (*p >= '0' && *p <= '9') || *p == '+' || *p == '-' || *p == '.');
+
+	return strncmp(p, "://", 3) == 0 ? p + 3 : url;
+}
+
+size_t extract_host(char const* const url, char* const host) {
+	char const* start = skip_scheme(url);
+	char const* end = start + strcspn(start, "/?#");
+
+	char const* const at = memchr(start, '@', (size_t)(end - start));
+
+	if (at != NULL) {
+		start = at + 1;
+
+		/* there can only be one unescaped “@” in the authority, but the password is allowed to contain it */
+		for (char const* p = at + 1; p < end; p++) {
+			if (*p == '@') {
+				start = p + 1;
+			}
+		}
+	}
+
+	if (start < end && *start == '[') {
+		char const* const close = memchr(start, ']', (size_t)(end - start));
+
+		if (close == NULL) {
+			return 0;
+		}
+
+		end = close + 1;
+	} else {
+		char const* const colon = memchr(start, ':', (size_t)(end - start));
+
+		if (colon != NULL) {
+			for (char const* p = colon + 1; p < end; p++) {
+				if (*p < '0' || *p > '9') {
+					return 0;
+				}
+			}
+
+			end = colon;
+		}
+
+		if (end > start && end[-1] == '.') {
+			end--;
+		}
+	}
+
+	size_t const length = (size_t)(end - start);
+
+	if (length == 0 || length > MAX_HOST_LENGTH) {
+		return 0;
+	}
+
+	if (*start == '[') {
+		memcpy(host, start, length);
+		host[length] = '\0';
+		return length;
+	}
+
+	size_t label_length = 0;
+
+	for (size_t i = 0; i < length; i++) {
+		char const c = to_lower(start[i]);
+
+		if (c == '.') {
+			if (label_length == 0) {
+				return 0;
+			}
+
+			label_length = 0;
+		} else if (is_host_character(c)) {
+			label_length++;
+		} else {
+			return 0;
+		}
+
+		host[i] = c;
+	}
+
+	if (label_length == 0) {
+		return 0;
+	}
+
+	host[length] = '\0';
+	return length;
+}
+
+__attribute__ ((nonnull, pure, warn_unused_result))
+static struct psl_node const* find_child(struct psl_node const* const parent, char const* const label, size_t const label_length) {
+	size_t low = parent->children;
+	size_t high = low + parent->child_count;
+
+	while (low < high) {
+		size_t const mid = low + (high - low) / 2;
+		struct psl_node const* const node = &psl_nodes[mid];
+		size_t const common = node->label_length < label_length ? node->label_length : label_length;
+		int order = memcmp(psl_labels + node->label, label, common);
+
+		if (order == 0) {
+			order = (node->label_length > label_length) - (node->label_length < label_length);
+		}
+
+		if (order == 0) {
+			return node;
+		}
+
+		if (order < 0) {
+			low = mid + 1;
+		} else {
+			high = mid;
+		}
+	}
+
+	return NULL;
+}
+
+size_t get_registrable_domain(char const* const host, size_t const host_length) {
+	if (host[0] == '[') {
+		return 0;
+	}
+
+	/* the last label of a domain name is never all digits, so this is an IPv4 address */
+	{
+		size_t i = host_length;
+
+		while (i > 0 && host[i - 1] >= '0' && host[i - 1] <= '9') {
+			i--;
+		}
+
+		if (i == 0 || host[i - 1] == '.') {
+			return 0;
+		}
+	}
+
+	/* unlisted top-level domains are public suffixes by the implicit “*” rule */
+	size_t suffix_labels = 1;
+	size_t depth = 0;
+	struct psl_node const* node = &psl_nodes[0];
+	size_t end = host_length;
+
+	for (;;) {
+		size_t start = end;
+
+		while (start > 0 && host[start - 1] != '.') {
+			start--;
+		}
+
+		if (node->flags & PSL_WILDCARD) {
+			suffix_labels = depth + 1;
+		}
+
+		struct psl_node const* const child = find_child(node, host + start, end - start);
+
+		if (child == NULL) {
+			break;
+		}
+
+		depth++;
+
+		if (child->flags & PSL_EXCEPTION) {
+			suffix_labels = depth - 1;
+			break;
+		}
+
+		if (child->flags & PSL_RULE) {
+			suffix_labels = depth;
+		}
+
+		if (start == 0) {
+			break;
+		}
+
+		node = child;
+		end = start - 1;
+	}
+
+	/* skip back over the public suffix and one more label */
+	size_t offset = host_length;
+
+	for (size_t labels = 0; labels <= suffix_labels; labels++) {
+		if (offset == 0) {
+			return 0;
+		}
+
+		if (labels != 0) {
+			offset--;
+		}
+
+		while (offset > 0 && host[offset - 1] != '.') {
+			offset--;
+		}
+	}
+
+	return offset;
+}
+
+int host_in_domain(char const* const host, size_t const host_length, char const* const domain, size_t const domain_length) {
+	if (domain_length > host_length || memcmp(host + (host_length - domain_length), domain, domain_length) != 0) {
+		return 0;
+	}
+
+	return domain_length == host_length || host[host_length - domain_length - 1] == '.';
+}
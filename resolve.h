@@ -0,0 +1,26 @@
+#include <stddef.h>
+
+/* The longest hostname allowed by DNS, excluding the terminating null. */
+#define MAX_HOST_LENGTH 253
+
+/*
+ * Extracts the hostname from a URL or bare hostname, lowercased and without userinfo, port, or trailing dot.
+ * Returns its length, or 0 if the input doesn’t contain a valid hostname. Internationalized hostnames have to be in
+ * their ASCII form (with “xn--” labels), which is how the public suffix list is compiled. `host` must have room for
+ * MAX_HOST_LENGTH + 1 bytes.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+size_t extract_host(char const* url, char* host);
+
+/*
+ * Gets the offset of the registrable domain (the public suffix plus one label) within a hostname returned by
+ * extract_host. IP addresses and hostnames that are themselves public suffixes are returned whole, at offset 0.
+ */
+__attribute__ ((nonnull, pure, warn_unused_result))
+size_t get_registrable_domain(char const* host, size_t host_length);
+
+/*
+ * Checks whether a hostname is the given domain or one of its subdomains.
+ */
+__attribute__ ((nonnull, pure, warn_unused_result))
+int host_in_domain(char const* host, size_t host_length, char const* domain, size_t domain_length);
@@ -0,0 +1,132 @@
+#include <stdint.h>
+#include <string.h>
+
+#include "sample.h"
+
+#define SET_PRINTABLE "!\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ[\\]^_`abcdefghijklmnopqrstuvwxyz{|}~"
+#define SET_ALPHANUMERIC "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz"
+#define SET_HEX "0123456789abcdef"
+#define SET_DIGITS "0123456789"
+#define SET_BASE32 "234567ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+
+/* the next power of two above n, minus one, for n < 256 */
+#define MASK(n) ((n) | (n) >> 1 | (n) >> 2 | (n) >> 3 | (n) >> 4 | (n) >> 5 | (n) >> 6 | (n) >> 7)
+
+/*
+ * Builds a 256-entry byte-to-character table at compile time from a macro mapping indexes to characters.
+ */
+#define TABLE_ENTRY(size, map, b) ((((b) & MASK(size)) < (size)) ? (char)(map((b) & MASK(size))) : '\0')
+#define TABLE_1(size, map, b) TABLE_ENTRY(size, map, b),
+#define TABLE_4(size, map, b) TABLE_1(size, map, b) TABLE_1(size, map, b + 1) TABLE_1(size, map, b + 2) TABLE_1(size, map, b + 3)
+#define TABLE_16(size, map, b) TABLE_4(size, map, b) TABLE_4(size, map, b + 4) TABLE_4(size, map, b + 8) TABLE_4(size, map, b + 12)
+#define TABLE_64(size, map, b) TABLE_16(size, map, b) TABLE_16(size, map, b + 16) TABLE_16(size, map, b + 32) TABLE_16(size, map, b + 48)
+#define TABLE(size, map) { TABLE_64(size, map, 0) TABLE_64(size, map, 64) TABLE_64(size, map, 128) TABLE_64(size, map, 192) }
+
+#define MAP_PRINTABLE(i) ('!' + (i))
+#define MAP_ALPHANUMERIC(i) ((i) < 10 ? '0' + (i) : (i) < 36 ? 'A' + (i) - 10 : 'a' + (i) - 36)
+#define MAP_HEX(i) ((i) < 10 ? '0' + (i) : 'a' + (i) - 10)
+#define MAP_DIGITS(i) ('0' + (i))
+#define MAP_BASE32(i) ((i) < 6 ? '2' + (i) : 'A' + (i) - 6)
+
+static char const table_printable[256] = TABLE(sizeof SET_PRINTABLE - 1, MAP_PRINTABLE);
+static char const table_alphanumeric[256] = TABLE(sizeof SET_ALPHANUMERIC - 1, MAP_ALPHANUMERIC);
+static char const table_hex[256] = TABLE(sizeof SET_HEX - 1, MAP_HEX);
+static char const table_digits[256] = TABLE(sizeof SET_DIGITS - 1, MAP_DIGITS);
+static char const table_base32[256] = TABLE(sizeof SET_BASE32 - 1, MAP_BASE32);
+
+/*
+ * Writes every byte’s character, accepted or not, and only advances past accepted ones.
+ */
+#define SAMPLE_STEP(j) { \
+	char const c = table[block[j]]; \
+	out[n] = c; \
+	n += (size_t)(c != '\0'); \
+}
+
+__attribute__ ((always_inline, nonnull, warn_unused_result))
+static inline size_t sample_table(char const table[256], uint8_t const* const block, char* const out) {
+	size_t n = 0;
+
+	for (size_t j = 0; j < SAMPLE_BLOCK_LENGTH; j += 8) {
+		SAMPLE_STEP(j)
+		SAMPLE_STEP(j + 1)
+		SAMPLE_STEP(j + 2)
+		SAMPLE_STEP(j + 3)
+		SAMPLE_STEP(j + 4)
+		SAMPLE_STEP(j + 5)
+		SAMPLE_STEP(j + 6)
+		SAMPLE_STEP(j + 7)
+	}
+
+	return n;
+}
+
+enum sampler_kind {
+	SAMPLER_TABLE,
+	SAMPLER_PRINTABLE,
+	SAMPLER_ALPHANUMERIC,
+	SAMPLER_HEX,
+	SAMPLER_DIGITS,
+	SAMPLER_BASE32,
+};
+
+static struct {
+	char const* set;
+	size_t set_size;
+	enum sampler_kind kind;
+} const specialized[] = {
+	{SET_PRINTABLE, sizeof SET_PRINTABLE - 1, SAMPLER_PRINTABLE},
+	{SET_ALPHANUMERIC, sizeof SET_ALPHANUMERIC - 1, SAMPLER_ALPHANUMERIC},
+	{SET_HEX, sizeof SET_HEX - 1, SAMPLER_HEX},
+	{SET_DIGITS, sizeof SET_DIGITS - 1, SAMPLER_DIGITS},
+	{SET_BASE32, sizeof SET_BASE32 - 1, SAMPLER_BASE32},
+};
+
+void sampler_init(struct nosepass_sampler* const sampler, char const* const set, uint8_t const set_size) {
+	for (size_t i = 0; i < sizeof specialized / sizeof specialized[0]; i++) {
+		if (set_size == specialized[i].set_size && memcmp(set, specialized[i].set, set_size) == 0) {
+			sampler->kind = (uint8_t)specialized[i].kind;
+			return;
+		}
+	}
+
+	uint8_t const mask = (uint8_t)MASK(set_size);
+
+	for (size_t b = 0; b < 256; b++) {
+		uint8_t const index = (uint8_t)(b & mask);
+		sampler->table[b] = index < set_size ? set[index] : '\0';
+	}
+
+	sampler->kind = SAMPLER_TABLE;
+}
+
+unsigned int sampler_range(uint8_t const set_size) {
+	return (unsigned int)MASK(set_size) + 1;
+}
+
+/*
+ * Each case inlines sample_table with a constant table, giving one specialized kernel per set.
+ */
+size_t sampler_sample(struct nosepass_sampler const* const sampler, uint8_t const block[const SAMPLE_BLOCK_LENGTH], char* const out) {
+	switch ((enum sampler_kind)sampler->kind) {
+	case SAMPLER_PRINTABLE:
+		return sample_table(table_printable, block, out);
+
+	case SAMPLER_ALPHANUMERIC:
+		return sample_table(table_alphanumeric, block, out);
+
+	case SAMPLER_HEX:
+		return sample_table(table_hex, block, out);
+
+	case SAMPLER_DIGITS:
+		return sample_table(table_digits, block, out);
+
+	case SAMPLER_BASE32:
+		return sample_table(table_base32, block, out);
+
+	case SAMPLER_TABLE:
+		break;
+	}
+
+	return sample_table(sampler->table, block, out);
+}
@@ -0,0 +1,27 @@
+#include <stddef.h>
+#include <stdint.h>
+
+#include "nosepass.h"
+
+#define SAMPLE_BLOCK_LENGTH 64
+
+/*
+ * Selects a sampler for a character set of 2 to 95 distinct printable ASCII characters: a specialized one for common
+ * sets, or one driven by a table built from the set otherwise.
+ */
+__attribute__ ((nonnull))
+void sampler_init(struct nosepass_sampler* sampler, char const* set, uint8_t set_size);
+
+/*
+ * Gets the number of values a byte is masked to for a set of the given size, which is the next power of two above it.
+ */
+__attribute__ ((const, warn_unused_result))
+unsigned int sampler_range(uint8_t set_size);
+
+/*
+ * Samples one block of random bytes: each byte is masked to the next power of two above the set size, minus one, and
+ * kept as that index into the set if it’s in range. Writes the accepted characters to `out` and returns how many there
+ * were. `out` must have room for SAMPLE_BLOCK_LENGTH characters, regardless of how many are needed.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+size_t sampler_sample(struct nosepass_sampler const* sampler, uint8_t const block[SAMPLE_BLOCK_LENGTH], char* out);
@@ -0,0 +1,130 @@
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "bcrypt/explicit_bzero.h"
+#include "secure.h"
+
+struct secure_arena {
+	uint8_t* mapping;
+	size_t mapping_size;
+
+	/* the usable bytes of each slot, a whole number of pages, and the distance between slots, including a guard page */
+	size_t slot_size;
+	size_t stride;
+	size_t slot_count;
+
+	/* a stack of the free slots’ indices */
+	pthread_mutex_t lock;
+	size_t free_count;
+	size_t free_slots[];
+};
+
+/*
+ * Locks a range when its pages are first touched, or right away on kernels without MLOCK_ONFAULT.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int lock_range(void* const start, size_t const size) {
+	if (mlock2(start, size, MLOCK_ONFAULT) == 0) {
+		return 1;
+	}
+
+	return (errno == ENOSYS || errno == EINVAL) && mlock(start, size) == 0;
+}
+
+struct secure_arena* secure_arena_create(size_t const slot_size, size_t const slot_count) {
+	long const page_size_value = sysconf(_SC_PAGESIZE);
+	size_t const page_size = (size_t)(page_size_value > 0 ? page_size_value : 4096);
+	size_t const usable = ((slot_size != 0 ? slot_size : 1) + page_size - 1) & ~(page_size - 1);
+	size_t const stride = usable + page_size;
+
+	if (slot_count == 0 || slot_count > (SIZE_MAX - page_size) / stride || slot_count > (SIZE_MAX - sizeof(struct secure_arena)) / sizeof(size_t)) {
+		fputs("secure arena too large\n", stderr);
+		return NULL;
+	}
+
+	struct secure_arena* const arena = malloc(sizeof *arena + slot_count * sizeof *arena->free_slots);
+
+	if (arena == NULL) {
+		fputs("failed to allocate memory\n", stderr);
+		return NULL;
+	}
+
+	arena->mapping_size = slot_count * stride + page_size;
+	arena->slot_size = usable;
+	arena->stride = stride;
+	arena->slot_count = slot_count;
+
+	/* everything starts as a guard page, and each slot is opened up after the one before it */
+	arena->mapping = mmap(NULL, arena->mapping_size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+	if (arena->mapping == MAP_FAILED) {
+		perror("failed to map secure memory");
+		free(arena);
+		return NULL;
+	}
+
+	if (madvise(arena->mapping, arena->mapping_size, MADV_DONTDUMP) != 0) {
+		perror("failed to exclude secure memory from core dumps");
+		munmap(arena->mapping, arena->mapping_size);
+		free(arena);
+		return NULL;
+	}
+
+	for (size_t i = 0; i < slot_count; i++) {
+		uint8_t* const slot = arena->mapping + page_size + i * stride;
+
+		if (mprotect(slot, usable, PROT_READ | PROT_WRITE) != 0 || !lock_range(slot, usable)) {
+			perror("failed to lock secure memory");
+			munlock(arena->mapping, arena->mapping_size);
+			munmap(arena->mapping, arena->mapping_size);
+			free(arena);
+			return NULL;
+		}
+
+		/* handed out lowest first */
+		arena->free_slots[i] = slot_count - 1 - i;
+	}
+
+	pthread_mutex_init(&arena->lock, NULL);
+	arena->free_count = slot_count;
+	return arena;
+}
+
+void* secure_alloc(struct secure_arena* const arena) {
+	pthread_mutex_lock(&arena->lock);
+
+	size_t const index = arena->free_count != 0 ? arena->free_slots[--arena->free_count] : SIZE_MAX;
+
+	pthread_mutex_unlock(&arena->lock);
+
+	/* slots are wiped when freed, so a taken slot is always zeroed */
+	return index == SIZE_MAX ? NULL : arena->mapping + arena->stride - arena->slot_size + index * arena->stride;
+}
+
+void secure_free(struct secure_arena* const arena, void* const slot) {
+	size_t const index = (size_t)((uint8_t*)slot - arena->mapping) / arena->stride;
+
+	explicit_bzero(slot, arena->slot_size);
+
+	pthread_mutex_lock(&arena->lock);
+	arena->free_slots[arena->free_count++] = index;
+	pthread_mutex_unlock(&arena->lock);
+}
+
+void secure_arena_destroy(struct secure_arena* const arena) {
+	for (size_t i = 0; i < arena->slot_count; i++) {
+		explicit_bzero(arena->mapping + arena->stride - arena->slot_size + i * arena->stride, arena->slot_size);
+	}
+
+	munlock(arena->mapping, arena->mapping_size);
+	munmap(arena->mapping, arena->mapping_size);
+	pthread_mutex_destroy(&arena->lock);
+	free(arena);
+}
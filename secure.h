@@ -0,0 +1,34 @@
+#include <stddef.h>
+
+/*
+ * A pool of equal slots for secrets in one mapping, locked against swapping and excluded from core dumps. Each slot
+ * starts on its own page with an inaccessible guard page before it, and another follows the last, so that running off
+ * the end of one faults instead of reaching the next.
+ */
+struct secure_arena;
+
+/*
+ * Maps an arena of `slot_count` slots of at least `slot_size` bytes. Pages are locked as they’re first touched, so a
+ * slot is placed on the NUMA node of the thread that first writes to it.
+ */
+__attribute__ ((warn_unused_result))
+struct secure_arena* secure_arena_create(size_t slot_size, size_t slot_count);
+
+/*
+ * Takes a free, zeroed slot, or returns NULL if every slot is taken. Takes constant time under the arena’s mutex, and
+ * never maps or locks memory, which the arena did once when it was created; safe to call from any thread.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+void* secure_alloc(struct secure_arena* arena);
+
+/*
+ * Wipes a slot and returns it to its arena.
+ */
+__attribute__ ((nonnull))
+void secure_free(struct secure_arena* arena, void* slot);
+
+/*
+ * Wipes every slot, taken or not, and unmaps the arena.
+ */
+__attribute__ ((nonnull))
+void secure_arena_destroy(struct secure_arena* arena);
@@ -0,0 +1,498 @@
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <limits.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <sys/uio.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "bcrypt/explicit_bzero.h"
+#include "secure.h"
+#include "stream.h"
+#include "workspace.h"
+
+/* all powers of two; the ring is as large as the lock limit allows, between the two ring sizes */
+#define QUEUE_SIZE 128
+#define RING_SIZE 512
+#define MIN_RING_SIZE 8
+
+#define WRITE_BATCH 256
+#define LINE_SIZE (STREAM_SITE_SIZE + NOSEPASS_MAX_COUNT + 1)
+
+#define SPIN_LIMIT 64
+#define BACKOFF_NANOSECONDS 100000
+
+_Static_assert((QUEUE_SIZE & (QUEUE_SIZE - 1)) == 0, "queue size is a power of two");
+_Static_assert((RING_SIZE & (RING_SIZE - 1)) == 0 && (MIN_RING_SIZE & (MIN_RING_SIZE - 1)) == 0, "ring sizes are powers of two");
+_Static_assert(MIN_RING_SIZE <= RING_SIZE && QUEUE_SIZE <= RING_SIZE && WRITE_BATCH <= RING_SIZE, "every queued job and write fits in a full ring");
+
+struct stream_job {
+	size_t index;
+	struct nosepass_schema schema;
+	size_t site_name_length;
+	char site_name[STREAM_SITE_SIZE];
+};
+
+/*
+ * A cell of the input queue, a bounded multi-producer multi-consumer queue after Dmitry Vyukov’s. A cell’s sequence
+ * is its position when it’s free to enqueue into and its position + 1 when it holds a job.
+ */
+struct queue_cell {
+	_Atomic size_t sequence;
+	struct stream_job job;
+};
+
+/*
+ * An output line, filled in by whichever worker derives it and written by the writer when every line before it has
+ * been.
+ */
+struct ring_slot {
+	atomic_int ready;
+	enum nosepass_status status;
+	size_t site_name_length;
+	size_t length;
+	char line[LINE_SIZE];
+};
+
+/*
+ * A worker’s derivation in progress, in its slot of the stream’s secure arena.
+ */
+struct job_secrets {
+	struct nosepass_derivation derivation;
+	uint8_t key[NOSEPASS_KEY_SIZE];
+};
+
+struct stream {
+	struct queue_cell* cells;
+	_Alignas(64) _Atomic size_t enqueue_position;
+	_Alignas(64) _Atomic size_t dequeue_position;
+
+	/* the ring, which holds passwords, is the only slot of one secure arena, and each worker has a slot of another */
+	struct ring_slot* ring;
+	size_t ring_size;
+	struct secure_arena* ring_arena;
+	struct secure_arena* arena;
+
+	/* a Blowfish workspace for each worker, which takes the next lane when it starts */
+	struct workspace_pool* workspaces;
+	atomic_uint next_lane;
+
+	/* the number of lines written; the reader stays less than ring_size jobs ahead of it */
+	_Alignas(64) _Atomic size_t flushed;
+
+	/* the number of jobs, once the input has ended */
+	_Atomic size_t total;
+	atomic_int input_done;
+
+	atomic_int stopped;
+	atomic_int failed;
+
+	char const* master_password;
+	size_t master_password_length;
+	int output_fd;
+};
+
+/*
+ * Waits a little, first by yielding and then by sleeping, for another thread to make progress.
+ */
+__attribute__ ((nonnull))
+static void back_off(unsigned int* const spins) {
+	if (*spins < SPIN_LIMIT) {
+		(*spins)++;
+		sched_yield();
+		return;
+	}
+
+	struct timespec const delay = {.tv_sec = 0, .tv_nsec = BACKOFF_NANOSECONDS};
+	nanosleep(&delay, NULL);
+}
+
+__attribute__ ((nonnull, warn_unused_result))
+static int enqueue(struct stream* const stream, struct stream_job const* const job) {
+	size_t position = atomic_load_explicit(&stream->enqueue_position, memory_order_relaxed);
+	struct queue_cell* cell;
+
+	for (;;) {
+		cell = &stream->cells[position & (QUEUE_SIZE - 1)];
+		size_t const sequence = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+		intptr_t const difference = (intptr_t)sequence - (intptr_t)position;
+
+		if (difference == 0) {
+			if (atomic_compare_exchange_weak_explicit(&stream->enqueue_position, &position, position + 1, memory_order_relaxed, memory_order_relaxed)) {
+				break;
+			}
+		} else if (difference < 0) {
+			return 0;
+		} else {
+			position = atomic_load_explicit(&stream->enqueue_position, memory_order_relaxed);
+		}
+	}
+
+	cell->job.index = job->index;
+	cell->job.schema = job->schema;
+	cell->job.site_name_length = job->site_name_length;
+	memcpy(cell->job.site_name, job->site_name, job->site_name_length);
+	atomic_store_explicit(&cell->sequence, position + 1, memory_order_release);
+	return 1;
+}
+
+__attribute__ ((nonnull, warn_unused_result))
+static int dequeue(struct stream* const stream, struct stream_job* const job) {
+	size_t position = atomic_load_explicit(&stream->dequeue_position, memory_order_relaxed);
+	struct queue_cell* cell;
+
+	for (;;) {
+		cell = &stream->cells[position & (QUEUE_SIZE - 1)];
+		size_t const sequence = atomic_load_explicit(&cell->sequence, memory_order_acquire);
+		intptr_t const difference = (intptr_t)sequence - (intptr_t)(position + 1);
+
+		if (difference == 0) {
+			if (atomic_compare_exchange_weak_explicit(&stream->dequeue_position, &position, position + 1, memory_order_relaxed, memory_order_relaxed)) {
+				break;
+			}
+		} else if (difference < 0) {
+			return 0;
+		} else {
+			position = atomic_load_explicit(&stream->dequeue_position, memory_order_relaxed);
+		}
+	}
+
+	job->index = cell->job.index;
+	job->schema = cell->job.schema;
+	job->site_name_length = cell->job.site_name_length;
+	memcpy(job->site_name, cell->job.site_name, cell->job.site_name_length);
+	atomic_store_explicit(&cell->sequence, position + QUEUE_SIZE, memory_order_release);
+	return 1;
+}
+
+/*
+ * Derives a job’s password straight into its output line.
+ */
+__attribute__ ((nonnull))
+static void run_job(struct stream* const stream, struct stream_job const* const job, struct job_secrets* const secrets, unsigned int const lane) {
+	struct ring_slot* const slot = &stream->ring[job->index & (stream->ring_size - 1)];
+
+	memcpy(slot->line, job->site_name, job->site_name_length);
+	slot->line[job->site_name_length] = ' ';
+	slot->site_name_length = job->site_name_length;
+
+	char* const password = slot->line + job->site_name_length + 1;
+	enum nosepass_status status = nosepass_derivation_init_site(&secrets->derivation, stream->master_password, stream->master_password_length, job->site_name, job->site_name_length, &job->schema, secrets->key);
+
+	if (status == NOSEPASS_OK) {
+		nosepass_derivation_set_workspace(&secrets->derivation, workspace_pool_lane(stream->workspaces, lane), workspace_pool_initial(stream->workspaces, lane));
+
+		while (nosepass_derivation_step(&secrets->derivation, UINT_MAX)) {}
+
+		status = nosepass_derivation_finish(&secrets->derivation);
+	}
+
+	if (status == NOSEPASS_OK) {
+		status = nosepass_generate(secrets->key, &job->schema, password, NOSEPASS_MAX_COUNT);
+	}
+
+	explicit_bzero(secrets->key, sizeof secrets->key);
+
+	if (status == NOSEPASS_OK) {
+		password[job->schema.count] = '\n';
+		slot->length = job->site_name_length + 1 + job->schema.count + 1;
+	} else {
+		slot->length = 0;
+	}
+
+	slot->status = status;
+	atomic_store_explicit(&slot->ready, 1, memory_order_release);
+}
+
+static void* work(void* const arg) {
+	struct stream* const stream = arg;
+	struct stream_job job;
+	unsigned int spins = 0;
+
+	/* there’s a slot and a lane for every worker */
+	struct job_secrets* const secrets = secure_alloc(stream->arena);
+	unsigned int const lane = atomic_fetch_add(&stream->next_lane, 1);
+
+	while (!atomic_load(&stream->stopped)) {
+		/* checked before dequeuing, so that an empty queue after the input is done means there’s nothing left */
+		int const input_done = atomic_load(&stream->input_done);
+
+		if (dequeue(stream, &job)) {
+			run_job(stream, &job, secrets, lane);
+			spins = 0;
+		} else if (input_done) {
+			break;
+		} else {
+			back_off(&spins);
+		}
+	}
+
+	secure_free(stream->arena, secrets);
+	return NULL;
+}
+
+__attribute__ ((nonnull, warn_unused_result))
+static int write_lines(int const fd, struct iovec* iov, int count) {
+	while (count > 0) {
+		ssize_t written = writev(fd, iov, count);
+
+		if (written == -1) {
+			if (errno == EINTR) {
+				continue;
+			}
+
+			return 0;
+		}
+
+		while (count > 0 && (size_t)written >= iov->iov_len) {
+			written -= (ssize_t)iov->iov_len;
+			iov++;
+			count--;
+		}
+
+		if (count > 0) {
+			iov->iov_base = (char*)iov->iov_base + written;
+			iov->iov_len -= (size_t)written;
+		}
+	}
+
+	return 1;
+}
+
+/*
+ * Writes out each run of consecutive finished lines with one writev, then wipes them and frees their slots.
+ */
+static void* write_output(void* const arg) {
+	struct stream* const stream = arg;
+	struct iovec iov[WRITE_BATCH];
+	size_t next = 0;
+	unsigned int spins = 0;
+
+	while (!atomic_load(&stream->stopped)) {
+		size_t const total = atomic_load(&stream->input_done) ? atomic_load(&stream->total) : SIZE_MAX;
+
+		if (next == total) {
+			break;
+		}
+
+		size_t count = 0;
+		int iov_count = 0;
+
+		while (count < WRITE_BATCH && count < stream->ring_size && next + count < total) {
+			struct ring_slot* const slot = &stream->ring[(next + count) & (stream->ring_size - 1)];
+
+			if (!atomic_load_explicit(&slot->ready, memory_order_acquire)) {
+				break;
+			}
+
+			if (slot->status == NOSEPASS_OK) {
+				iov[iov_count].iov_base = slot->line;
+				iov[iov_count].iov_len = slot->length;
+				iov_count++;
+			} else {
+				fprintf(stderr, "%.*s: %s\n", (int)slot->site_name_length, slot->line, nosepass_strerror(slot->status));
+				atomic_store(&stream->failed, 1);
+			}
+
+			count++;
+		}
+
+		if (count == 0) {
+			back_off(&spins);
+			continue;
+		}
+
+		spins = 0;
+
+		if (!write_lines(stream->output_fd, iov, iov_count)) {
+			perror("failed to write output");
+			atomic_store(&stream->failed, 1);
+			atomic_store(&stream->stopped, 1);
+		}
+
+		for (size_t i = 0; i < count; i++) {
+			struct ring_slot* const slot = &stream->ring[(next + i) & (stream->ring_size - 1)];
+			explicit_bzero(slot->line, slot->length);
+			atomic_store_explicit(&slot->ready, 0, memory_order_relaxed);
+		}
+
+		next += count;
+		atomic_store_explicit(&stream->flushed, next, memory_order_release);
+	}
+
+	return NULL;
+}
+
+/*
+ * Reads jobs from the source into the queue, staying within the ring’s capacity of the writer.
+ */
+__attribute__ ((nonnull (1, 2)))
+static void read_input(struct stream* const stream, stream_source* const source, void* const context) {
+	struct stream_job job;
+	size_t index = 0;
+	unsigned int spins = 0;
+
+	while (!atomic_load(&stream->stopped)) {
+		while (index - atomic_load_explicit(&stream->flushed, memory_order_acquire) >= stream->ring_size && !atomic_load(&stream->stopped)) {
+			back_off(&spins);
+		}
+
+		int const read = source(context, job.site_name, &job.schema);
+
+		if (read == 0) {
+			break;
+		}
+
+		if (read < 0) {
+			atomic_store(&stream->failed, 1);
+			break;
+		}
+
+		job.index = index;
+		job.site_name_length = strlen(job.site_name);
+		spins = 0;
+
+		while (!enqueue(stream, &job) && !atomic_load(&stream->stopped)) {
+			back_off(&spins);
+		}
+
+		spins = 0;
+		index++;
+	}
+
+	atomic_store(&stream->total, index);
+	atomic_store(&stream->input_done, 1);
+}
+
+/*
+ * Gets the number of ring slots to lock: RING_SIZE, or, when the lock limit is low, as many as fit in a quarter of it,
+ * leaving the rest for the workers’ derivations and workspaces.
+ */
+__attribute__ ((warn_unused_result))
+static size_t choose_ring_size(void) {
+	struct rlimit limit;
+	size_t ring_size = RING_SIZE;
+
+	if (getrlimit(RLIMIT_MEMLOCK, &limit) != 0 || limit.rlim_cur == RLIM_INFINITY) {
+		return ring_size;
+	}
+
+	while (ring_size > MIN_RING_SIZE && ring_size * sizeof(struct ring_slot) > limit.rlim_cur / 4) {
+		ring_size /= 2;
+	}
+
+	return ring_size;
+}
+
+int stream_run(stream_source* const source, void* const context, char const* const master_password, size_t const master_password_length, unsigned int const thread_count, int const output_fd) {
+	struct stream* const stream = aligned_alloc(_Alignof(struct stream), sizeof *stream);
+	pthread_t* const workers = malloc((thread_count == 0 ? 1 : thread_count) * sizeof *workers);
+
+	if (stream == NULL || workers == NULL) {
+		fputs("failed to allocate memory\n", stderr);
+		free(stream);
+		free(workers);
+		return 0;
+	}
+
+	stream->cells = aligned_alloc(64, QUEUE_SIZE * sizeof *stream->cells);
+	stream->ring_size = choose_ring_size();
+	stream->ring_arena = secure_arena_create(stream->ring_size * sizeof *stream->ring, 1);
+	stream->arena = secure_arena_create(sizeof(struct job_secrets), thread_count == 0 ? 1 : thread_count);
+	stream->workspaces = workspace_pool_create(thread_count, NULL);
+
+	if (stream->cells == NULL || stream->ring_arena == NULL || stream->arena == NULL || stream->workspaces == NULL) {
+		if (stream->cells == NULL) {
+			fputs("failed to allocate memory\n", stderr);
+		}
+
+		if (stream->ring_arena != NULL) {
+			secure_arena_destroy(stream->ring_arena);
+		}
+
+		if (stream->arena != NULL) {
+			secure_arena_destroy(stream->arena);
+		}
+
+		if (stream->workspaces != NULL) {
+			workspace_pool_destroy(stream->workspaces);
+		}
+
+		free(stream->cells);
+		free(stream);
+		free(workers);
+		return 0;
+	}
+
+	/* page-aligned, so the slots stay on their own cache lines */
+	stream->ring = secure_alloc(stream->ring_arena);
+
+	for (size_t i = 0; i < QUEUE_SIZE; i++) {
+		atomic_init(&stream->cells[i].sequence, i);
+	}
+
+	for (size_t i = 0; i < stream->ring_size; i++) {
+		atomic_init(&stream->ring[i].ready, 0);
+		stream->ring[i].length = 0;
+	}
+
+	atomic_init(&stream->enqueue_position, 0);
+	atomic_init(&stream->dequeue_position, 0);
+	atomic_init(&stream->flushed, 0);
+	atomic_init(&stream->total, 0);
+	atomic_init(&stream->input_done, 0);
+	atomic_init(&stream->stopped, 0);
+	atomic_init(&stream->failed, 0);
+	atomic_init(&stream->next_lane, 0);
+	stream->master_password = master_password;
+	stream->master_password_length = master_password_length;
+	stream->output_fd = output_fd;
+
+	pthread_t writer;
+	unsigned int started = 0;
+	int const writer_started = pthread_create(&writer, NULL, write_output, stream) == 0;
+
+	if (writer_started) {
+		for (unsigned int i = 0; i < thread_count; i++) {
+			if (pthread_create(&workers[started], NULL, work, stream) == 0) {
+				started++;
+			}
+		}
+	}
+
+	if (started == 0) {
+		fputs("failed to start threads\n", stderr);
+		atomic_store(&stream->failed, 1);
+		atomic_store(&stream->stopped, 1);
+	}
+
+	read_input(stream, source, context);
+
+	for (unsigned int i = 0; i < started; i++) {
+		pthread_join(workers[i], NULL);
+	}
+
+	if (writer_started) {
+		pthread_join(writer, NULL);
+	}
+
+	int const result = !atomic_load(&stream->failed);
+
+	/* wipes lines left unwritten after a failure */
+	secure_arena_destroy(stream->ring_arena);
+	secure_arena_destroy(stream->arena);
+	workspace_pool_destroy(stream->workspaces);
+
+	free(stream->cells);
+	free(stream);
+	free(workers);
+	return result;
+}
@@ -0,0 +1,20 @@
+#include <stddef.h>
+
+#include "nosepass.h"
+
+/* The longest site name a stream can carry, including the terminating null. */
+#define STREAM_SITE_SIZE 1024
+
+/*
+ * Gets the next site of a stream and its schema. Returns 1 for a site, 0 at the end of the input, or -1 after
+ * reporting an error.
+ */
+typedef int stream_source(void* context, char site_name[STREAM_SITE_SIZE], struct nosepass_schema* schema);
+
+/*
+ * Derives the password of every site from a source on a pool of threads, writing `<site> <password>` lines to
+ * `output_fd` in input order. Memory use is constant however long the input is: sites are read only as fast as their
+ * lines are written, and each line is wiped once written. Returns 1 if every password was derived and written.
+ */
+__attribute__ ((nonnull (1, 3), warn_unused_result))
+int stream_run(stream_source* source, void* context, char const* master_password, size_t master_password_length, unsigned int thread_count, int output_fd);
@@ -0,0 +1,111 @@
+/*
+ * Cancels a derivation while it waits in a worker_pool’s queue behind another, then lets the worker move on. The
+ * cancelled coroutine’s frame, with the derivation in it, is freed as soon as it resumes, so a worker that still found
+ * it in the queue would run a freed derivation; build with -fsanitize=address, as `make test` does, to catch that.
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <future>
+#include <string>
+
+#include "nosepass.hpp"
+
+namespace {
+
+/* a coroutine that starts at once and frees its frame when it finishes */
+struct task {
+	struct promise_type {
+		task get_return_object() noexcept {
+			return {};
+		}
+
+		std::suspend_never initial_suspend() noexcept {
+			return {};
+		}
+
+		std::suspend_never final_suspend() noexcept {
+			return {};
+		}
+
+		void return_void() noexcept {}
+
+		void unhandled_exception() noexcept {
+			std::terminate();
+		}
+	};
+};
+
+task derive_into(nosepass::worker_pool& pool, char const* const site_name, nosepass_schema const& schema, std::stop_token stop, std::promise<std::string>& result) {
+	try {
+		nosepass::password const password = co_await nosepass::derive(pool, nosepass::inline_executor {}, "test", site_name, schema, std::move(stop));
+		result.set_value(std::string(password.view()));
+	} catch (nosepass::cancelled const&) {
+		result.set_value("cancelled");
+	} catch (nosepass::error const& e) {
+		result.set_value(e.what());
+	}
+}
+
+bool ready(std::future<std::string> const& future) {
+	return future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+}
+
+int check(bool const condition, char const* const description) {
+	if (!condition) {
+		std::fprintf(stderr, "failed: %s\n", description);
+	}
+
+	return condition ? 0 : 1;
+}
+
+}
+
+int main() {
+	nosepass_schema slow;
+	nosepass_schema fast;
+	nosepass_schema_init(&slow);
+	nosepass_schema_init(&fast);
+	slow.rounds = 1000000;
+	fast.rounds = 2;
+
+	std::promise<std::string> running_result;
+	std::promise<std::string> queued_result;
+	std::promise<std::string> last_result;
+	std::future<std::string> running = running_result.get_future();
+	std::future<std::string> queued = queued_result.get_future();
+	std::future<std::string> last = last_result.get_future();
+	std::stop_source running_stop;
+	std::stop_source queued_stop;
+	int failures = 0;
+
+	{
+		nosepass::worker_pool pool(1);
+
+		derive_into(pool, "running", slow, running_stop.get_token(), running_result);
+		derive_into(pool, "queued", fast, queued_stop.get_token(), queued_result);
+		derive_into(pool, "last", fast, {}, last_result);
+
+		/* taken out of the queue, the derivation completes on the thread that stopped it, not the busy worker */
+		queued_stop.request_stop();
+		failures += check(ready(queued) && queued.get() == "cancelled", "a queued derivation completes when stopped");
+		failures += check(!ready(running), "the running derivation is unaffected");
+
+		running_stop.request_stop();
+		failures += check(running.get() == "cancelled", "a running derivation stops");
+
+		uint8_t key[NOSEPASS_KEY_SIZE];
+		char expected[NOSEPASS_MAX_COUNT];
+
+		if (nosepass_derive_site_key("test", 4, "last", 4, &fast, key) != NOSEPASS_OK || nosepass_generate(key, &fast, expected, sizeof expected) != NOSEPASS_OK) {
+			std::fputs("failed to derive the expected password\n", stderr);
+			return EXIT_FAILURE;
+		}
+
+		failures += check(last.get() == std::string(expected, fast.count), "the worker moves on to the next derivation");
+	}
+
+	return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
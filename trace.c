@@ -0,0 +1,217 @@
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "trace.h"
+
+#define CHUNK_RECORDS 256
+
+struct chunk {
+	struct chunk* next;
+	struct trace_job records[CHUNK_RECORDS];
+};
+
+/*
+ * A thread’s buffers, on cache lines of their own, since each is written by a different thread.
+ */
+struct thread_buffer {
+	_Alignas(64) struct chunk* first;
+	struct chunk* last;
+	size_t used;
+};
+
+struct trace {
+	struct timespec origin;
+	unsigned int thread_count;
+	struct thread_buffer* threads;
+};
+
+struct trace* trace_create(unsigned int const thread_count) {
+	struct trace* const trace = malloc(sizeof *trace);
+
+	if (trace == NULL) {
+		fputs("failed to allocate memory\n", stderr);
+		return NULL;
+	}
+
+	trace->thread_count = thread_count;
+	trace->threads = aligned_alloc(_Alignof(struct thread_buffer), (thread_count != 0 ? thread_count : 1) * sizeof *trace->threads);
+
+	if (trace->threads == NULL) {
+		fputs("failed to allocate memory\n", stderr);
+		free(trace);
+		return NULL;
+	}
+
+	for (unsigned int i = 0; i < thread_count; i++) {
+		trace->threads[i].first = NULL;
+		trace->threads[i].last = NULL;
+
+		/* a full chunk, so that the first record allocates one */
+		trace->threads[i].used = CHUNK_RECORDS;
+	}
+
+	clock_gettime(CLOCK_MONOTONIC, &trace->origin);
+	return trace;
+}
+
+uint64_t trace_now(struct trace const* const trace) {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)(now.tv_sec - trace->origin.tv_sec) * UINT64_C(1000000000) + (uint64_t)now.tv_nsec - (uint64_t)trace->origin.tv_nsec;
+}
+
+struct trace_job* trace_add(struct trace* const trace, unsigned int const thread) {
+	struct thread_buffer* const buffer = &trace->threads[thread];
+
+	if (buffer->used == CHUNK_RECORDS) {
+		struct chunk* const chunk = malloc(sizeof *chunk);
+
+		if (chunk == NULL) {
+			return NULL;
+		}
+
+		chunk->next = NULL;
+
+		if (buffer->last != NULL) {
+			buffer->last->next = chunk;
+		} else {
+			buffer->first = chunk;
+		}
+
+		buffer->last = chunk;
+		buffer->used = 0;
+	}
+
+	struct trace_job* const record = &buffer->last->records[buffer->used++];
+	memset(record, 0, sizeof *record);
+	return record;
+}
+
+/*
+ * Writes a string as a JSON string literal.
+ */
+__attribute__ ((nonnull))
+static void write_json_string(FILE* const output, char const* const s) {
+	putc('"', output);
+
+	for (char const* p = s; *p != '\0'; p++) {
+		unsigned char const c = (unsigned char)*p;
+
+		if (c == '"' || c == '\\') {
+			putc('\\', output);
+			putc(c, output);
+		} else if (c < 0x20) {
+			fprintf(output, "\\u%04x", c);
+		} else {
+			putc(c, output);
+		}
+	}
+
+	putc('"', output);
+}
+
+/*
+ * Writes the start of a complete event, through to the opening brace of its arguments, with times in microseconds.
+ */
+__attribute__ ((nonnull))
+static void write_span(FILE* const output, char const* const name, long const pid, unsigned int const tid, uint64_t const start, uint64_t const end) {
+	fprintf(output, ",\n{\"name\":\"%s\",\"cat\":\"batch\",\"ph\":\"X\",\"pid\":%ld,\"tid\":%u,\"ts\":%.3f,\"dur\":%.3f,\"args\":{", name, pid, tid, (double)start / 1e3, (double)(end - start) / 1e3);
+}
+
+__attribute__ ((const, warn_unused_result))
+static double to_ms(uint64_t const ns) {
+	return (double)ns / 1e6;
+}
+
+/*
+ * Writes one job’s stages as nested spans: the whole job, then its key derivation, its password generation, waiting
+ * for the output, and writing it.
+ */
+__attribute__ ((nonnull))
+static void write_job(FILE* const output, long const pid, unsigned int const tid, struct trace_job const* const record, struct batch_job const* const job) {
+	struct nosepass_profile const* const profile = &record->profile;
+
+	write_span(output, "job", pid, tid, record->taken, record->written);
+	fputs("\"site\":", output);
+	write_json_string(output, job->site_name);
+	fprintf(output, ",\"rounds\":%u,\"queued_ms\":%.3f,\"stolen\":%s}}", job->schema.rounds, to_ms(record->taken), record->stolen ? "true" : "false");
+
+	write_span(output, "kdf", pid, tid, record->taken, record->derived);
+	fprintf(output, "\"sha512_ms\":%.3f,\"blowfish_ms\":%.3f}}", to_ms(profile->wall_ns[NOSEPASS_PHASE_SHA512]), to_ms(profile->wall_ns[NOSEPASS_PHASE_BLOWFISH]));
+
+	write_span(output, "generate", pid, tid, record->derived, record->generated);
+	fprintf(output, "\"keystream_ms\":%.3f,\"sampling_ms\":%.3f,\"keystream_blocks\":%" PRIu64 "}}",
+		to_ms(profile->wall_ns[NOSEPASS_PHASE_KEYSTREAM]), to_ms(profile->wall_ns[NOSEPASS_PHASE_SAMPLING]), profile->keystream_blocks);
+
+	write_span(output, "output wait", pid, tid, record->generated, record->locked);
+	fputs("}}", output);
+
+	write_span(output, "output", pid, tid, record->locked, record->written);
+	fputs("}}", output);
+}
+
+int trace_write(struct trace const* const trace, struct batch_job const* const jobs, int const* const cpus, char const* const path) {
+	FILE* const output = fopen(path, "w");
+
+	if (output == NULL) {
+		perror("failed to open trace file");
+		return 0;
+	}
+
+	long const pid = (long)getpid();
+
+	fprintf(output, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%ld,\"args\":{\"name\":\"nosepass batch\"}}", pid);
+
+	for (unsigned int t = 0; t < trace->thread_count; t++) {
+		fprintf(output, ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%ld,\"tid\":%u,\"args\":{\"name\":\"worker %u", pid, t, t);
+
+		if (cpus != NULL) {
+			fprintf(output, " (CPU %d)", cpus[t]);
+		}
+
+		fputs("\"}}", output);
+
+		struct thread_buffer const* const buffer = &trace->threads[t];
+
+		for (struct chunk const* chunk = buffer->first; chunk != NULL; chunk = chunk->next) {
+			size_t const count = chunk == buffer->last ? buffer->used : CHUNK_RECORDS;
+
+			for (size_t i = 0; i < count; i++) {
+				write_job(output, pid, t, &chunk->records[i], &jobs[chunk->records[i].job]);
+			}
+		}
+	}
+
+	fputs("\n]}\n", output);
+
+	int written = !ferror(output);
+
+	if (fclose(output) != 0) {
+		written = 0;
+	}
+
+	if (!written) {
+		perror("failed to write trace file");
+	}
+
+	return written;
+}
+
+void trace_destroy(struct trace* const trace) {
+	for (unsigned int t = 0; t < trace->thread_count; t++) {
+		struct chunk* chunk = trace->threads[t].first;
+
+		while (chunk != NULL) {
+			struct chunk* const next = chunk->next;
+			free(chunk);
+			chunk = next;
+		}
+	}
+
+	free(trace->threads);
+	free(trace);
+}
@@ -0,0 +1,59 @@
+#include <stddef.h>
+#include <stdint.h>
+
+#include "batch.h"
+#include "nosepass.h"
+
+/*
+ * A record of where a batch’s time went, kept by each thread in buffers of its own, so that recording a job never
+ * waits on another thread, and written out once the batch is over in the Chrome trace event format, which Perfetto
+ * and chrome://tracing open.
+ */
+struct trace;
+
+/*
+ * When a job passed through each stage of a batch, in nanoseconds since its trace was created, and how the time of
+ * its key derivation and password generation divides between their phases.
+ */
+struct trace_job {
+	/* its index in the batch’s jobs, and whether it was stolen from another thread’s share */
+	size_t job;
+	int stolen;
+
+	uint64_t taken;
+	uint64_t derived;
+	uint64_t generated;
+	uint64_t locked;
+	uint64_t written;
+
+	struct nosepass_profile profile;
+};
+
+/*
+ * Creates an empty trace for a batch of `thread_count` threads, starting its clock.
+ */
+__attribute__ ((warn_unused_result))
+struct trace* trace_create(unsigned int thread_count);
+
+/*
+ * Gets the time since the trace was created, in nanoseconds.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+uint64_t trace_now(struct trace const* trace);
+
+/*
+ * Adds a zeroed record to a thread’s buffers, or returns NULL if there’s no memory for it. Only that thread may call
+ * this, but no two threads ever wait on each other to.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+struct trace_job* trace_add(struct trace* trace, unsigned int thread);
+
+/*
+ * Writes the trace, once every thread is done with it, as a JSON file of each job’s stages on each thread. `cpus` is
+ * the CPU each thread was pinned to, or NULL.
+ */
+__attribute__ ((nonnull (1, 2, 4), warn_unused_result))
+int trace_write(struct trace const* trace, struct batch_job const* jobs, int const* cpus, char const* path);
+
+__attribute__ ((nonnull))
+void trace_destroy(struct trace* trace);
@@ -0,0 +1,735 @@
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <limits.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "bcrypt/explicit_bzero.h"
+#include "secure.h"
+#include "workers.h"
+
+#define PROTOCOL_HEADER "nosepass-worker 3\n"
+
+/* the longest master password, with its line ending and a null terminator */
+#define PASSWORD_SIZE 1024
+
+/* jobs sent to a worker ahead of its answers, to hide the round trip */
+#define WORKER_WINDOW 4
+
+/* how far past the first job not yet output a job may be sent, which bounds the passwords waiting to be output */
+#define PENDING_LIMIT 256
+
+/* times in a row a worker may die without answering anything before the batch gives up */
+#define MAX_RESTARTS 3
+
+/* an answer: the job’s position, its status, and its password */
+#define ANSWER_SIZE (20 + 1 + 10 + 1 + NOSEPASS_MAX_COUNT + 1)
+
+static char const hex_digits[16] = "0123456789abcdef";
+
+__attribute__ ((const, warn_unused_result))
+static int hex_value(char const c) {
+	if (c >= '0' && c <= '9') {
+		return c - '0';
+	}
+
+	if (c >= 'a' && c <= 'f') {
+		return c - 'a' + 10;
+	}
+
+	return -1;
+}
+
+/*
+ * Parses an unsigned decimal number of at most `max` followed by a space, advancing past both.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int parse_field(char const** const p, uint64_t const max, uint64_t* const value) {
+	char const* s = *p;
+	uint64_t n = 0;
+
+	if (*s < '0' || *s > '9') {
+		return 0;
+	}
+
+	for (; *s >= '0' && *s <= '9'; s++) {
+		if (n > (max - (uint64_t)(*s - '0')) / 10) {
+			return 0;
+		}
+
+		n = n * 10 + (uint64_t)(*s - '0');
+	}
+
+	if (*s != ' ') {
+		return 0;
+	}
+
+	*p = s + 1;
+	*value = n;
+	return 1;
+}
+
+/*
+ * Parses bytes in hex followed by a space, advancing past both.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int parse_hex_field(char const** const p, char* const out, size_t const size, size_t* const length) {
+	char const* s = *p;
+	size_t n = 0;
+
+	for (; *s != ' '; s += 2) {
+		int const high = hex_value(s[0]);
+		int const low = high == -1 ? -1 : hex_value(s[1]);
+
+		if (low == -1 || n == size) {
+			return 0;
+		}
+
+		out[n++] = (char)(high << 4 | low);
+	}
+
+	*p = s + 1;
+	*length = n;
+	return 1;
+}
+
+/*
+ * Writes bytes in hex, null-terminated, into a buffer of twice their length and one more byte.
+ */
+__attribute__ ((nonnull))
+static void format_hex(char const* const bytes, size_t const length, char* const out) {
+	for (size_t i = 0; i < length; i++) {
+		out[2 * i] = hex_digits[(unsigned char)bytes[i] >> 4];
+		out[2 * i + 1] = hex_digits[(unsigned char)bytes[i] & 0xf];
+	}
+
+	out[2 * length] = '\0';
+}
+
+/*
+ * Reads a job: its position, schema, and site name. Its group is in hex, or `-` for none.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static enum nosepass_status parse_job(char const* p, uint64_t* const position, struct nosepass_schema* const schema, char const** const site_name) {
+	uint64_t rounds;
+	uint64_t lanes;
+	uint64_t count;
+	uint64_t increment;
+
+	if (!parse_field(&p, UINT64_MAX, position) || !parse_field(&p, UINT32_MAX, &rounds) || !parse_field(&p, UINT8_MAX, &lanes) || !parse_field(&p, UINT32_MAX, &count) || !parse_field(&p, UINT64_MAX, &increment)) {
+		return NOSEPASS_INVALID_ARGUMENT;
+	}
+
+	char set[sizeof schema->set];
+	size_t set_length;
+	char group[NOSEPASS_MAX_GROUP_LENGTH + 1];
+	size_t group_length = 0;
+
+	if (!parse_hex_field(&p, set, sizeof set, &set_length)) {
+		return NOSEPASS_INVALID_ARGUMENT;
+	}
+
+	if (p[0] == '-' && p[1] == ' ') {
+		p += 2;
+	} else if (!parse_hex_field(&p, group, NOSEPASS_MAX_GROUP_LENGTH, &group_length) || group_length == 0) {
+		return NOSEPASS_INVALID_ARGUMENT;
+	}
+
+	if (*p == '\0') {
+		return NOSEPASS_INVALID_ARGUMENT;
+	}
+
+	*site_name = p;
+	group[group_length] = '\0';
+
+	/* the lanes and group are checked like any others, so a bad one fails only its job */
+	char parameters[80 + sizeof " group=" + NOSEPASS_MAX_GROUP_LENGTH];
+	snprintf(parameters, sizeof parameters, "rounds=%" PRIu64 " lanes=%" PRIu64 " count=%" PRIu64 " increment=%" PRIu64 "%s%s", rounds, lanes, count, increment, group_length != 0 ? " group=" : "", group);
+	nosepass_schema_init(schema);
+
+	enum nosepass_status const status = nosepass_parse_schema(parameters, schema, NULL);
+	return status != NOSEPASS_OK ? status : nosepass_set_characters(schema, set, set_length);
+}
+
+/*
+ * What a worker keeps secret, in the only slot of a secure arena.
+ */
+struct worker_secrets {
+	char password[PASSWORD_SIZE];
+	struct nosepass_derivation derivation;
+	uint8_t key[NOSEPASS_KEY_SIZE];
+	char site_password[NOSEPASS_MAX_COUNT];
+};
+
+int workers_serve(FILE* const input, FILE* const output) {
+	char header[sizeof PROTOCOL_HEADER];
+
+	if (fgets(header, sizeof header, input) == NULL || strcmp(header, PROTOCOL_HEADER) != 0) {
+		fputs("expected a nosepass coordinator on standard input\n", stderr);
+		return 0;
+	}
+
+	struct secure_arena* const arena = secure_arena_create(sizeof(struct worker_secrets), 1);
+
+	if (arena == NULL) {
+		return 0;
+	}
+
+	/* the arena’s only slot, which can’t be taken already */
+	struct worker_secrets* const secrets = secure_alloc(arena);
+
+	if (fgets(secrets->password, sizeof secrets->password, input) == NULL || strchr(secrets->password, '\n') == NULL) {
+		fputs("failed to read password\n", stderr);
+		secure_arena_destroy(arena);
+		return 0;
+	}
+
+	size_t const password_length = strlen(secrets->password) - 1;
+	char* line = NULL;
+	size_t line_size = 0;
+	ssize_t line_length;
+	int result = 1;
+
+	while ((line_length = getline(&line, &line_size, input)) != -1) {
+		if (line[line_length - 1] != '\n') {
+			fputs("incomplete job\n", stderr);
+			result = 0;
+			break;
+		}
+
+		line[line_length - 1] = '\0';
+
+		uint64_t position;
+		struct nosepass_schema schema;
+		char const* site_name;
+		enum nosepass_status status = parse_job(line, &position, &schema, &site_name);
+
+		if (status == NOSEPASS_INVALID_ARGUMENT) {
+			fputs("malformed job\n", stderr);
+			result = 0;
+			break;
+		}
+
+		if (status == NOSEPASS_OK) {
+			status = nosepass_derivation_init_site(&secrets->derivation, secrets->password, password_length, site_name, strlen(site_name), &schema, secrets->key);
+		}
+
+		if (status == NOSEPASS_OK) {
+			while (nosepass_derivation_step(&secrets->derivation, UINT_MAX)) {}
+
+			status = nosepass_derivation_finish(&secrets->derivation);
+		}
+
+		if (status == NOSEPASS_OK) {
+			status = nosepass_generate(secrets->key, &schema, secrets->site_password, sizeof secrets->site_password);
+		}
+
+		explicit_bzero(secrets->key, sizeof secrets->key);
+
+		int const written =
+			status == NOSEPASS_OK ?
+				fprintf(output, "%" PRIu64 " 0 ", position) > 0 && fwrite(secrets->site_password, sizeof(char), schema.count, output) == schema.count && putc('\n', output) != EOF :
+				fprintf(output, "%" PRIu64 " %d\n", position, (int)status) > 0;
+
+		explicit_bzero(secrets->site_password, sizeof secrets->site_password);
+
+		if (!written || fflush(output) == EOF) {
+			fputs("failed to write answer\n", stderr);
+			result = 0;
+			break;
+		}
+	}
+
+	secure_arena_destroy(arena);
+	free(line);
+
+	if (result && ferror(input)) {
+		fputs("failed to read jobs\n", stderr);
+		result = 0;
+	}
+
+	return result;
+}
+
+struct worker {
+	/* the command to run it with, or NULL to run this program */
+	char const* command;
+
+	pid_t pid;
+	int to_worker;
+	int from_worker;
+
+	/* the positions of the worker’s shard’s jobs, in order, and how many of them it has been sent and has answered */
+	size_t* jobs;
+	size_t job_count;
+	size_t sent;
+	size_t answered;
+
+	unsigned int failures;
+
+	char buffer[ANSWER_SIZE];
+	size_t buffered;
+};
+
+struct coordinator {
+	struct worker* workers;
+	unsigned int worker_count;
+
+	struct batch_job const* jobs;
+	size_t job_count;
+
+	char const* master_password;
+	size_t master_password_length;
+
+	/*
+	 * answers waiting for the jobs before them; a job is answered when its status is set, and its password is in the
+	 * ring of PENDING_LIMIT slots of `password_stride` bytes, in a secure arena, until it’s output
+	 */
+	struct secure_arena* password_arena;
+	char* passwords;
+	size_t password_stride;
+	enum nosepass_status* statuses;
+	uint8_t* answered;
+
+	/* the number of jobs output */
+	size_t emitted;
+	int failed;
+
+	batch_output* output;
+	void* context;
+};
+
+__attribute__ ((nonnull, warn_unused_result))
+static int write_all(int const fd, char const* const data, size_t const length) {
+	size_t written = 0;
+
+	while (written < length) {
+		ssize_t const n = write(fd, data + written, length - written);
+
+		if (n == -1) {
+			if (errno == EINTR) {
+				continue;
+			}
+
+			return 0;
+		}
+
+		written += (size_t)n;
+	}
+
+	return 1;
+}
+
+/*
+ * Starts a worker process and sends it the master password. Its jobs are sent again from the first unanswered one.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int start_worker(struct coordinator const* const coordinator, struct worker* const worker) {
+	int to_worker[2];
+	int from_worker[2];
+
+	if (pipe2(to_worker, O_CLOEXEC) != 0) {
+		perror("failed to create pipe");
+		return 0;
+	}
+
+	if (pipe2(from_worker, O_CLOEXEC) != 0) {
+		perror("failed to create pipe");
+		close(to_worker[0]);
+		close(to_worker[1]);
+		return 0;
+	}
+
+	pid_t const pid = fork();
+
+	if (pid == 0) {
+		if (dup2(to_worker[0], STDIN_FILENO) == -1 || dup2(from_worker[1], STDOUT_FILENO) == -1) {
+			_exit(127);
+		}
+
+		signal(SIGPIPE, SIG_DFL);
+
+		if (worker->command == NULL) {
+			execl("/proc/self/exe", "nosepass", "--worker", (char*)NULL);
+		} else {
+			execl("/bin/sh", "sh", "-c", worker->command, (char*)NULL);
+		}
+
+		_exit(127);
+	}
+
+	close(to_worker[0]);
+	close(from_worker[1]);
+
+	if (pid == -1) {
+		perror("failed to start worker");
+		close(to_worker[1]);
+		close(from_worker[0]);
+		return 0;
+	}
+
+	worker->pid = pid;
+	worker->to_worker = to_worker[1];
+	worker->from_worker = from_worker[0];
+	worker->sent = worker->answered;
+	worker->buffered = 0;
+
+	/* a worker that dies before reading this is restarted like any other */
+	(void)(write_all(worker->to_worker, PROTOCOL_HEADER, sizeof PROTOCOL_HEADER - 1)
+		&& write_all(worker->to_worker, coordinator->master_password, coordinator->master_password_length)
+		&& write_all(worker->to_worker, "\n", 1));
+
+	return 1;
+}
+
+/*
+ * Closes a worker’s pipes and waits for it to exit, reporting an unexpected exit.
+ */
+__attribute__ ((nonnull))
+static void stop_worker(struct worker* const worker, unsigned int const number) {
+	int status;
+
+	if (worker->pid == 0) {
+		return;
+	}
+
+	close(worker->to_worker);
+	close(worker->from_worker);
+	explicit_bzero(worker->buffer, worker->buffered);
+
+	while (waitpid(worker->pid, &status, 0) == -1) {
+		if (errno != EINTR) {
+			perror("failed to wait for worker");
+			worker->pid = 0;
+			return;
+		}
+	}
+
+	if (WIFSIGNALED(status)) {
+		fprintf(stderr, "worker %u was killed by signal %d\n", number, WTERMSIG(status));
+	} else if (WEXITSTATUS(status) != 0) {
+		fprintf(stderr, "worker %u exited with status %d\n", number, WEXITSTATUS(status));
+	}
+
+	worker->pid = 0;
+}
+
+__attribute__ ((nonnull, warn_unused_result))
+static int restart_worker(struct coordinator const* const coordinator, struct worker* const worker, unsigned int const number) {
+	stop_worker(worker, number);
+
+	if (++worker->failures > MAX_RESTARTS) {
+		fprintf(stderr, "worker %u failed %u times in a row; giving up\n", number, worker->failures);
+		return 0;
+	}
+
+	fprintf(stderr, "\x1b[36m●\x1b[0m restarting worker %u with %zu unanswered jobs\n", number, worker->job_count - worker->answered);
+	return start_worker(coordinator, worker);
+}
+
+/*
+ * Gets the slot of a job’s password in the ring.
+ */
+__attribute__ ((nonnull, returns_nonnull, warn_unused_result))
+static char* password_slot(struct coordinator const* const coordinator, size_t const position) {
+	return coordinator->passwords + position % PENDING_LIMIT * coordinator->password_stride;
+}
+
+/*
+ * Sends a worker jobs until it has WORKER_WINDOW unanswered, or its next is PENDING_LIMIT past the first job not yet
+ * output, whose slot in the ring it would take. Returns 0 if the worker is gone.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int send_jobs(struct coordinator const* const coordinator, struct worker* const worker) {
+	while (worker->sent < worker->job_count && worker->sent - worker->answered < WORKER_WINDOW && worker->jobs[worker->sent] - coordinator->emitted < PENDING_LIMIT) {
+		size_t const position = worker->jobs[worker->sent];
+		struct batch_job const* const job = &coordinator->jobs[position];
+		char set[2 * sizeof job->schema.set + 1];
+		char group[2 * NOSEPASS_MAX_GROUP_LENGTH + 1] = "-";
+
+		format_hex(job->schema.set, job->schema.set_size, set);
+
+		if (job->schema.group_length != 0) {
+			format_hex(job->schema.group, job->schema.group_length, group);
+		}
+
+		if (dprintf(worker->to_worker, "%zu %u %u %u %" PRIu64 " %s %s %s\n", position, job->schema.rounds, job->schema.lanes, job->schema.count, job->schema.increment, set, group, job->site_name) < 0) {
+			return 0;
+		}
+
+		worker->sent++;
+	}
+
+	return 1;
+}
+
+/*
+ * Takes one answer from a worker, which must be for its oldest unanswered job.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int take_answer(struct coordinator* const coordinator, struct worker* const worker, char const* p, size_t const length) {
+	char const* const end = p + length;
+	uint64_t position;
+	uint64_t status;
+
+	if (worker->answered == worker->sent || !parse_field(&p, UINT64_MAX, &position) || position != worker->jobs[worker->answered]) {
+		return 0;
+	}
+
+	if (p == end || *p < '0' || *p > '9') {
+		return 0;
+	}
+
+	for (status = 0; p != end && *p >= '0' && *p <= '9'; p++) {
+		if ((status = status * 10 + (uint64_t)(*p - '0')) > NOSEPASS_INCOMPLETE) {
+			return 0;
+		}
+	}
+
+	struct batch_job const* const job = &coordinator->jobs[position];
+
+	if (status == NOSEPASS_OK) {
+		if (end - p != (ptrdiff_t)job->schema.count + 1 || *p != ' ') {
+			return 0;
+		}
+
+		memcpy(password_slot(coordinator, position), p + 1, job->schema.count);
+	} else if (p != end) {
+		return 0;
+	}
+
+	coordinator->statuses[position] = (enum nosepass_status)status;
+	coordinator->answered[position] = 1;
+	worker->answered++;
+	worker->failures = 0;
+	return 1;
+}
+
+/*
+ * Reads what a worker has answered. Returns 0 if the worker is gone or broke the protocol.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int read_answers(struct coordinator* const coordinator, struct worker* const worker, unsigned int const number) {
+	ssize_t n;
+
+	while ((n = read(worker->from_worker, worker->buffer + worker->buffered, sizeof worker->buffer - worker->buffered)) == -1 && errno == EINTR) {
+	}
+
+	if (n <= 0) {
+		if (n == -1) {
+			perror("failed to read from worker");
+		}
+
+		return 0;
+	}
+
+	worker->buffered += (size_t)n;
+
+	char* start = worker->buffer;
+	char* newline;
+
+	while ((newline = memchr(start, '\n', worker->buffered - (size_t)(start - worker->buffer))) != NULL) {
+		if (!take_answer(coordinator, worker, start, (size_t)(newline - start))) {
+			fprintf(stderr, "unexpected answer from worker %u\n", number);
+			return 0;
+		}
+
+		start = newline + 1;
+	}
+
+	size_t const consumed = (size_t)(start - worker->buffer);
+
+	if (consumed == 0 && worker->buffered == sizeof worker->buffer) {
+		fprintf(stderr, "unexpected answer from worker %u\n", number);
+		return 0;
+	}
+
+	memmove(worker->buffer, start, worker->buffered - consumed);
+	worker->buffered -= consumed;
+	explicit_bzero(worker->buffer + worker->buffered, consumed);
+	return 1;
+}
+
+/*
+ * Outputs the answered jobs that every job before has been output for, wiping their passwords.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int emit_answers(struct coordinator* const coordinator) {
+	while (coordinator->emitted < coordinator->job_count && coordinator->answered[coordinator->emitted]) {
+		size_t const position = coordinator->emitted++;
+		char* const password = password_slot(coordinator, position);
+		enum nosepass_status const status = coordinator->statuses[position];
+		struct batch_job const* const job = &coordinator->jobs[position];
+		int const proceed = coordinator->output(coordinator->context, job, status == NOSEPASS_OK ? password : NULL, status);
+
+		if (status == NOSEPASS_OK) {
+			explicit_bzero(password, job->schema.count);
+		} else {
+			coordinator->failed = 1;
+		}
+
+		if (!proceed) {
+			return 0;
+		}
+	}
+
+	return 1;
+}
+
+/*
+ * Starts the workers, sends them their jobs, and outputs their answers in order until every job is output.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+static int coordinate(struct coordinator* const coordinator) {
+	struct pollfd* const polls = malloc(coordinator->worker_count * sizeof *polls);
+	unsigned int* const polled = malloc(coordinator->worker_count * sizeof *polled);
+
+	if (polls == NULL || polled == NULL) {
+		fputs("failed to allocate memory\n", stderr);
+		free(polls);
+		free(polled);
+		return 0;
+	}
+
+	int result = 1;
+
+	for (unsigned int i = 0; result && i < coordinator->worker_count; i++) {
+		if (coordinator->workers[i].job_count != 0) {
+			result = start_worker(coordinator, &coordinator->workers[i]);
+		}
+	}
+
+	while (result && coordinator->emitted < coordinator->job_count) {
+		nfds_t poll_count = 0;
+
+		for (unsigned int i = 0; result && i < coordinator->worker_count; i++) {
+			struct worker* const worker = &coordinator->workers[i];
+
+			if (worker->pid == 0) {
+				continue;
+			}
+
+			if (worker->answered == worker->job_count) {
+				stop_worker(worker, i);
+				continue;
+			}
+
+			while (result && !send_jobs(coordinator, worker)) {
+				result = restart_worker(coordinator, worker, i);
+			}
+
+			polls[poll_count].fd = worker->from_worker;
+			polls[poll_count].events = POLLIN;
+			polled[poll_count++] = i;
+		}
+
+		if (!result) {
+			break;
+		}
+
+		if (poll(polls, poll_count, -1) == -1) {
+			if (errno == EINTR) {
+				continue;
+			}
+
+			perror("failed to wait for workers");
+			result = 0;
+			break;
+		}
+
+		for (nfds_t j = 0; result && j < poll_count; j++) {
+			if (polls[j].revents != 0 && !read_answers(coordinator, &coordinator->workers[polled[j]], polled[j])) {
+				result = restart_worker(coordinator, &coordinator->workers[polled[j]], polled[j]);
+			}
+		}
+
+		result = result && emit_answers(coordinator);
+	}
+
+	for (unsigned int i = 0; i < coordinator->worker_count; i++) {
+		stop_worker(&coordinator->workers[i], i);
+	}
+
+	free(polls);
+	free(polled);
+	return result;
+}
+
+int workers_run(char const* const* const commands, unsigned int const worker_count, struct batch_job const* const jobs, size_t const job_count, char const* const master_password, size_t const master_password_length, batch_output* const output, void* const context) {
+	struct coordinator coordinator = {
+		.workers = calloc(worker_count, sizeof *coordinator.workers),
+		.worker_count = worker_count,
+		.jobs = jobs,
+		.job_count = job_count,
+		.master_password = master_password,
+		.master_password_length = master_password_length,
+		.password_arena = NULL,
+		.passwords = NULL,
+		.password_stride = 1,
+		.statuses = calloc(job_count != 0 ? job_count : 1, sizeof *coordinator.statuses),
+		.answered = calloc(job_count != 0 ? job_count : 1, sizeof *coordinator.answered),
+		.emitted = 0,
+		.failed = 0,
+		.output = output,
+		.context = context,
+	};
+	size_t* const shard_jobs = malloc((job_count != 0 ? job_count : 1) * sizeof *shard_jobs);
+	int result = 0;
+
+	for (size_t i = 0; i < job_count; i++) {
+		if (jobs[i].schema.count > coordinator.password_stride) {
+			coordinator.password_stride = jobs[i].schema.count;
+		}
+	}
+
+	if (coordinator.workers == NULL || coordinator.statuses == NULL || coordinator.answered == NULL || shard_jobs == NULL) {
+		fputs("failed to allocate memory\n", stderr);
+	} else if ((coordinator.password_arena = secure_arena_create(PENDING_LIMIT * coordinator.password_stride, 1)) != NULL) {
+		/* the arena’s only slot, which can’t be taken already */
+		coordinator.passwords = secure_alloc(coordinator.password_arena);
+
+		/* every worker’s jobs, in order, share one array */
+		for (size_t i = 0; i < job_count; i++) {
+			coordinator.workers[batch_shard(jobs[i].site_name, worker_count)].job_count++;
+		}
+
+		size_t start = 0;
+
+		for (unsigned int i = 0; i < worker_count; i++) {
+			coordinator.workers[i].command = commands[i];
+			coordinator.workers[i].jobs = shard_jobs + start;
+			start += coordinator.workers[i].job_count;
+			coordinator.workers[i].job_count = 0;
+		}
+
+		for (size_t i = 0; i < job_count; i++) {
+			struct worker* const worker = &coordinator.workers[batch_shard(jobs[i].site_name, worker_count)];
+			worker->jobs[worker->job_count++] = i;
+		}
+
+		/* a dead worker shows up as a failed write rather than killing the coordinator */
+		void (* const previous_handler)(int) = signal(SIGPIPE, SIG_IGN);
+		result = coordinate(&coordinator) && !coordinator.failed;
+		signal(SIGPIPE, previous_handler);
+	}
+
+	/* wipes the passwords of any jobs answered but never output */
+	if (coordinator.password_arena != NULL) {
+		secure_arena_destroy(coordinator.password_arena);
+	}
+
+	free(coordinator.workers);
+	free(coordinator.statuses);
+	free(coordinator.answered);
+	free(shard_jobs);
+	return result;
+}
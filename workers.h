@@ -0,0 +1,21 @@
+#include <stddef.h>
+#include <stdio.h>
+
+#include "batch.h"
+
+/*
+ * Serves a coordinator as `nosepass --worker`: reads the master password and then jobs from `input`, one per line,
+ * and answers each on `output` in the order received, until the end of the input. The jobs carry their schemas, so
+ * the worker needs no configuration of its own.
+ */
+__attribute__ ((nonnull, warn_unused_result))
+int workers_serve(FILE* input, FILE* output);
+
+/*
+ * Derives a batch on worker processes, one for each command, or `nosepass --worker` for a NULL command, run with
+ * `/bin/sh -c`. Each worker takes the jobs of one shard, as batch_shard assigns them; one that dies is started again
+ * and given back its unanswered jobs. Passwords are output in the jobs’ order. Returns 1 if all of them were derived
+ * and output.
+ */
+__attribute__ ((nonnull (1, 3, 5, 7), warn_unused_result))
+int workers_run(char const* const* commands, unsigned int worker_count, struct batch_job const* jobs, size_t job_count, char const* master_password, size_t master_password_length, batch_output* output, void* context);
@@ -0,0 +1,203 @@
+#define _GNU_SOURCE
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "bcrypt/explicit_bzero.h"
+#include "nosepass.h"
+#include "placement.h"
+#include "secure.h"
+#include "workspace.h"
+
+#define HUGE_PAGE_SIZE ((size_t)2 << 20)
+
+/* a pair of cache lines, since adjacent-line prefetching moves them together */
+#define LINE_PAIR_SIZE 128
+#define WORKSPACE_STRIDE ((NOSEPASS_WORKSPACE_SIZE + LINE_PAIR_SIZE - 1) / LINE_PAIR_SIZE * LINE_PAIR_SIZE)
+
+/* from linux/mempolicy.h; glibc has no mbind wrapper */
+#define MPOL_PREFERRED 1
+#define MAX_NODES 1024
+
+/*
+ * The workspaces of one NUMA node’s lanes, after that node’s pristine initial state.
+ */
+struct region {
+	int node;
+	unsigned int lane_count;
+	uint8_t* mapping;
+	size_t size;
+
+	/* where the mapping is instead, if huge pages couldn’t be locked */
+	struct secure_arena* arena;
+};
+
+struct workspace_pool {
+	unsigned int region_count;
+	struct region* regions;
+
+	/* each lane’s region, and its position among the region’s lanes */
+	unsigned int* lane_regions;
+	unsigned int* lane_positions;
+};
+
+/*
+ * Maps a multiple of HUGE_PAGE_SIZE bytes from reserved huge pages or, failing that, from ordinary pages aligned for
+ * transparent huge pages. Returns NULL on failure.
+ */
+__attribute__ ((warn_unused_result))
+static uint8_t* map_huge(size_t const size) {
+	void* const reserved = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+
+	if (reserved != MAP_FAILED) {
+		return reserved;
+	}
+
+	/* mapped a huge page larger, and trimmed to a huge page boundary at both ends */
+	void* const padded = mmap(NULL, size + HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+	if (padded == MAP_FAILED) {
+		return NULL;
+	}
+
+	uint8_t* const start = padded;
+	uint8_t* const aligned = (uint8_t*)(((uintptr_t)start + HUGE_PAGE_SIZE - 1) & ~(uintptr_t)(HUGE_PAGE_SIZE - 1));
+	size_t const head = (size_t)(aligned - start);
+
+	if (head != 0) {
+		munmap(start, head);
+	}
+
+	munmap(aligned + size, HUGE_PAGE_SIZE - head);
+
+	/* only a hint; without transparent huge pages, the pool still works on ordinary ones */
+	madvise(aligned, size, MADV_HUGEPAGE);
+	return aligned;
+}
+
+/*
+ * Asks for a range’s pages to come from a node’s memory when they’re first touched. Without NUMA support, there’s only
+ * one node to get them from anyway.
+ */
+__attribute__ ((nonnull))
+static void prefer_node(uint8_t* const start, size_t const size, int const node) {
+	unsigned long mask[MAX_NODES / (8 * sizeof(unsigned long))] = {0};
+
+	if (node < 0 || node >= MAX_NODES) {
+		return;
+	}
+
+	mask[(size_t)node / (8 * sizeof *mask)] |= 1UL << ((size_t)node % (8 * sizeof *mask));
+	syscall(SYS_mbind, start, size, MPOL_PREFERRED, mask, (unsigned long)MAX_NODES + 1, 0);
+}
+
+struct workspace_pool* workspace_pool_create(unsigned int const lane_count, int const* const cpus) {
+	size_t const count = lane_count != 0 ? lane_count : 1;
+	struct workspace_pool* const pool = malloc(sizeof *pool);
+
+	if (pool == NULL) {
+		fputs("failed to allocate memory\n", stderr);
+		return NULL;
+	}
+
+	pool->region_count = 0;
+	pool->regions = calloc(count, sizeof *pool->regions);
+	pool->lane_regions = malloc(count * sizeof *pool->lane_regions);
+	pool->lane_positions = malloc(count * sizeof *pool->lane_positions);
+
+	if (pool->regions == NULL || pool->lane_regions == NULL || pool->lane_positions == NULL) {
+		fputs("failed to allocate memory\n", stderr);
+		workspace_pool_destroy(pool);
+		return NULL;
+	}
+
+	for (unsigned int lane = 0; lane < lane_count; lane++) {
+		int const node = cpus != NULL ? placement_node(cpus[lane]) : -1;
+		unsigned int r = 0;
+
+		while (r < pool->region_count && pool->regions[r].node != node) {
+			r++;
+		}
+
+		if (r == pool->region_count) {
+			pool->regions[r].node = node;
+			pool->region_count++;
+		}
+
+		pool->lane_regions[lane] = r;
+		pool->lane_positions[lane] = pool->regions[r].lane_count++;
+	}
+
+	for (unsigned int r = 0; r < pool->region_count; r++) {
+		struct region* const region = &pool->regions[r];
+		size_t const used = (size_t)(region->lane_count + 1) * WORKSPACE_STRIDE;
+		size_t const size = (used + HUGE_PAGE_SIZE - 1) & ~(HUGE_PAGE_SIZE - 1);
+
+		if ((region->mapping = map_huge(size)) == NULL) {
+			perror("failed to map workspaces");
+			workspace_pool_destroy(pool);
+			return NULL;
+		}
+
+		region->size = size;
+
+		if (madvise(region->mapping, size, MADV_DONTDUMP) != 0) {
+			perror("failed to exclude workspaces from core dumps");
+			workspace_pool_destroy(pool);
+			return NULL;
+		}
+
+		/* the lock limit often doesn’t allow a huge page, but it has to allow the ordinary pages of a secure arena */
+		if (mlock2(region->mapping, size, MLOCK_ONFAULT) != 0) {
+			munmap(region->mapping, size);
+			region->mapping = NULL;
+
+			if ((region->arena = secure_arena_create(used, 1)) == NULL) {
+				workspace_pool_destroy(pool);
+				return NULL;
+			}
+
+			/* the arena’s only slot, which can’t be taken already */
+			region->mapping = secure_alloc(region->arena);
+			region->size = used;
+		}
+
+		prefer_node(region->mapping, region->size, region->node);
+		nosepass_workspace_init(region->mapping);
+	}
+
+	return pool;
+}
+
+void* workspace_pool_lane(struct workspace_pool const* const pool, unsigned int const lane) {
+	return pool->regions[pool->lane_regions[lane]].mapping + (size_t)(pool->lane_positions[lane] + 1) * WORKSPACE_STRIDE;
+}
+
+void const* workspace_pool_initial(struct workspace_pool const* const pool, unsigned int const lane) {
+	return pool->regions[pool->lane_regions[lane]].mapping;
+}
+
+void workspace_pool_destroy(struct workspace_pool* const pool) {
+	if (pool->regions != NULL) {
+		for (unsigned int r = 0; r < pool->region_count; r++) {
+			struct region* const region = &pool->regions[r];
+
+			if (region->arena != NULL) {
+				secure_arena_destroy(region->arena);
+			} else if (region->mapping != NULL) {
+				explicit_bzero(region->mapping, (size_t)(region->lane_count + 1) * WORKSPACE_STRIDE);
+				munlock(region->mapping, region->size);
+				munmap(region->mapping, region->size);
+			}
+		}
+	}
+
+	free(pool->regions);
+	free(pool->lane_regions);
+	free(pool->lane_positions);
+	free(pool);
+}
@@ -0,0 +1,33 @@
+/*
+ * A pool of Blowfish workspaces, one for each lane of a batch, in huge pages. Workspaces are padded to whole pairs of
+ * cache lines, so that lanes on different cores never share one, and each NUMA node’s lanes are mapped together from
+ * that node’s memory, with their own pristine copy of the initial state to start every round from.
+ */
+struct workspace_pool;
+
+/*
+ * Maps workspaces for `lane_count` lanes, where lane i runs on `cpus[i]`, as placement_choose gives them, or anywhere
+ * if `cpus` is NULL. Huge pages are used if any are reserved, or transparent huge pages otherwise. The workspaces are
+ * excluded from core dumps and locked against swapping; where the memory lock limit doesn’t allow a huge page, they’re
+ * placed in ordinary pages of a secure arena instead.
+ */
+__attribute__ ((warn_unused_result))
+struct workspace_pool* workspace_pool_create(unsigned int lane_count, int const* cpus);
+
+/*
+ * Gets a lane’s workspace, of NOSEPASS_WORKSPACE_SIZE bytes.
+ */
+__attribute__ ((nonnull, pure, returns_nonnull, warn_unused_result))
+void* workspace_pool_lane(struct workspace_pool const* pool, unsigned int lane);
+
+/*
+ * Gets the pristine initial state on a lane’s node, for nosepass_derivation_set_workspace.
+ */
+__attribute__ ((nonnull, pure, returns_nonnull, warn_unused_result))
+void const* workspace_pool_initial(struct workspace_pool const* pool, unsigned int lane);
+
+/*
+ * Wipes the workspaces and unmaps them.
+ */
+__attribute__ ((nonnull))
+void workspace_pool_destroy(struct workspace_pool* pool);